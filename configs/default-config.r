@@ -73,6 +73,22 @@ standard: 'c
 rigorous: no
 
 static: no
+
+; Link-time ("whole program") optimization, e.g. -flto or /GL + /LTCG
+;
+lto: no
+
+; Profile-guided optimization: one of "no", "'generate" or "'use".  A build
+; with 'generate writes profile data into %pgo-data/ in the build directory
+; as it runs, and a build with 'use optimizes by that data.  See %make-pgo.sh
+; for running the stages in order.
+;
+pgo: no
+
+; Compile the core as a single translation unit, %prep/core/rebol-core.c (see
+; %tools/make-amalgamation.r), so the compiler can inline across its files.
+;
+amalgamate: no
 pkg-config: try get-env "PKGCONFIG" ;path to pkg-config, or default
 
 odbc-requires-ltdl: no
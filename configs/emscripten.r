@@ -29,7 +29,18 @@ use-wasm: default [true]
 ;
 ; https://forum.rebol.info/t/pros-and-cons-of-the-pthread-web-build/1425
 ;
-use-asyncify: true
+; "JSPI" (JavaScript Promise Integration) is a WebAssembly feature where the
+; engine suspends the WASM stack itself, while a JS promise is pending.  So
+; there's no instrumented code (the build is about half the size, and isn't
+; slowed down by the instrumentation), and rebPromise() works the same.  But
+; only newer browsers have it, so it is a separate build (see %load-r3.js
+; for how the loader picks it):
+;
+; https://v8.dev/blog/jspi
+;
+use-jspi: default [false]
+
+use-asyncify: not use-jspi
 
 ; Making an actual debug build of the interpreter core is prohibitive for
 ; emscripten in general usage--even on a developer machine.  This enables a
@@ -44,7 +55,9 @@ debug-javascript-extension: true
 ;
 top: 'library
 
-os-id: default [0.16.1]  ; 0.16.2 was "pthread" version, no longer supported
+; 0.16.2 was "pthread" version, no longer supported
+;
+os-id: default [either use-jspi [0.16.4] [0.16.1]]
 
 toolset: [
     gcc %emcc
@@ -115,6 +128,10 @@ cflags: compose [
     ((if use-asyncify [[
         {-DUSE_ASYNCIFY}  ; affects rebPromise() methodology
     ]]))
+
+    ((if use-jspi [[
+        {-DUSE_JSPI}  ; JS-NATIVEs wait on a promise instead of polling
+    ]]))
 ]
 
 ldflags: compose [
@@ -277,7 +294,7 @@ ldflags: compose [
     ;
     ;{-s ALLOW_MEMORY_GROWTH=0}
 
-    ((if use-asyncify [[
+    ((case [use-asyncify [[
         {-s ASYNCIFY=1}
 
         ; Memory initialization file,
@@ -312,6 +329,17 @@ ldflags: compose [
         ;
         {--profiling-funcs}
     ]]
+
+    use-jspi [[
+        {-s JSPI=1}  ; older emscripten (before 3.1.60) calls it ASYNCIFY=2
+
+        ; Only the exports listed here may suspend.  The evaluator only runs
+        ; JS-NATIVEs (which can wait on JavaScript) under the rebIdle() that
+        ; rebPromise() queues, see %mod-javascript.c.  The imports that can
+        ; suspend are known to emscripten (EM_ASYNC_JS(), emscripten_sleep()).
+        ;
+        {-s "JSPI_EXPORTS=['RL_rebIdle_internal']"}
+    ]]]
     else [[
         {-s USE_PTHREADS=1}  ; must be in both cflags and ldflags if used
 
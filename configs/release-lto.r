@@ -0,0 +1,13 @@
+REBOL [
+    File: %release-lto.r
+]
+
+; Optimized build without debug checks or symbols, with link-time
+; optimization.  %make-pgo.sh uses this for both of its builds, adding the
+; `pgo=generate` and `pgo=use` options.
+
+debug: no
+
+optimize: 2
+
+lto: yes
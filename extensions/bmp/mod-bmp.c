@@ -307,24 +307,97 @@ REBNATIVE(identify_bmp_q)
 }
 
 
+// When decoding from a PORT!, the file is READ in pieces: the headers (up to
+// the pixels at bfOffBits), then uncompressed pixels a chunk of rows at a
+// time.  So the file is never all in memory along with the image.
+//
+#define BMP_FILE_HEADER_SIZE 14  // on disk, sizeof() may have padding
+#define BMP_INFO_HEADER_SIZE 40
+#define BMP_READ_CHUNK 65536  // rows to READ at once are about this big
+
+static bool Bmp_Has_Room(
+    const REBYTE *data,
+    REBSIZ size,
+    const REBYTE *cp,
+    REBSIZ needed
+){
+    REBSIZ used = cp - data;
+    return used <= size and needed <= size - used;
+}
+
+static REBSIZ Read_Bmp_Bytes(REBYTE *buf, REBSIZ size, const REBVAL *port)
+{
+    return rebBytesInto(buf, size, "read/part", port, rebI(size));
+}
+
+// Gives back the headers and color table, which the caller must rebFree().
+// There's at least room to map a BITMAPINFOHEADER, zero filled if the file
+// isn't that long.
+//
+static REBYTE *Read_Bmp_Headers(REBSIZ *size_out, const REBVAL *port)
+{
+    REBYTE file_header[BMP_FILE_HEADER_SIZE];
+    if (
+        Read_Bmp_Bytes(file_header, BMP_FILE_HEADER_SIZE, port)
+            != BMP_FILE_HEADER_SIZE
+        or file_header[0] != 'B' or file_header[1] != 'M'
+    ){
+        fail (Error_Bad_Media_Raw());
+    }
+
+    const REBYTE *cp = file_header;
+    BITMAPFILEHEADER bmfh;
+    Map_Bytes(&bmfh, &cp, mapBITMAPFILEHEADER);
+
+    if (bmfh.bfOffBits < BMP_FILE_HEADER_SIZE + sizeof(DWORD))
+        fail (Error_Bad_Media_Raw());
+
+    REBSIZ room = MAX(
+        bmfh.bfOffBits, BMP_FILE_HEADER_SIZE + BMP_INFO_HEADER_SIZE
+    );
+    REBYTE *headers = rebAllocN(REBYTE, room);
+    memset(headers, 0, room);
+    memcpy(headers, file_header, BMP_FILE_HEADER_SIZE);
+
+    REBSIZ rest = bmfh.bfOffBits - BMP_FILE_HEADER_SIZE;
+    if (Read_Bmp_Bytes(headers + BMP_FILE_HEADER_SIZE, rest, port) != rest)
+        fail (Error_Bad_Media_Raw());
+
+    *size_out = bmfh.bfOffBits;
+    return headers;
+}
+
+
 //
 //  decode-bmp: native [
 //
 //  {Codec for decoding BINARY! data for a BMP}
 //
 //      return: [image!]
-//      data [binary!]
+//      data "A PORT! is read a chunk at a time instead of all at once"
+//          [binary! port!]
 //  ]
 //
 REBNATIVE(decode_bmp)
 {
     BMP_INCLUDE_PARAMS_OF_DECODE_BMP;
 
+    const REBVAL *port = nullptr;
+    REBYTE *headers = nullptr;
+
     REBSIZ size;
-    const REBYTE *data = VAL_BINARY_SIZE_AT(&size, ARG(data));
+    const REBYTE *data;
+    if (IS_PORT(ARG(data))) {
+        port = ARG(data);
+        headers = Read_Bmp_Headers(&size, port);
+        data = headers;
+    }
+    else {
+        data = VAL_BINARY_SIZE_AT(&size, ARG(data));
 
-    if (not Has_Valid_BITMAPFILEHEADER(data, size))
-        fail (Error_Bad_Media_Raw());
+        if (not Has_Valid_BITMAPFILEHEADER(data, size))
+            fail (Error_Bad_Media_Raw());
+    }
 
     int32_t              i, j, x, y, c;
     int32_t              colors, compression, bitcount;
@@ -358,6 +431,9 @@ REBNATIVE(decode_bmp)
         else
             colors = 0;
 
+        if (not Bmp_Has_Room(data, size, cp, cast(REBSIZ, colors) * 3))
+            fail (Error_Bad_Media_Raw());  // color table is cut off
+
         if (colors) {
             ctab = TRY_ALLOC_N(RGBQUAD, colors);
             for (i = 0; i<colors; i++) {
@@ -379,6 +455,12 @@ REBNATIVE(decode_bmp)
         else
             colors = bmih.biClrUsed;
 
+        if (not Bmp_Has_Room(
+            data, size, cp, cast(REBSIZ, colors) * sizeof(RGBQUAD)
+        )){
+            fail (Error_Bad_Media_Raw());  // color table is cut off
+        }
+
         if (colors) {
             ctab = TRY_ALLOC_N(RGBQUAD, colors);
             memcpy(ctab, cp, colors * sizeof(RGBQUAD));
@@ -389,6 +471,27 @@ REBNATIVE(decode_bmp)
     if (bmfh.bfOffBits != cast(DWORD, cp - data))
         cp = data + bmfh.bfOffBits;
 
+    // From a PORT!, the pixels aren't in `data`.  Uncompressed rows are all
+    // the same size, so they're read a chunk of them at a time.  RLE rows
+    // aren't, so the rest of the file is read at once (it's compressed).
+    //
+    REBYTE *pixels = nullptr;
+    REBLEN row_bytes = 0;
+    REBLEN rows_per_chunk = 0;
+    REBLEN rows_buffered = 0;
+    if (port) {
+        if (compression == BI_RGB and w > 0) {
+            row_bytes = ((w * bitcount + 31) / 32) * 4;  // padded to 4 bytes
+            rows_per_chunk = MAX(BMP_READ_CHUNK / row_bytes, 1);
+            pixels = rebAllocN(REBYTE, rows_per_chunk * row_bytes);
+        }
+        else {
+            size_t pixels_size;
+            pixels = rebBytes(&pixels_size, "read", port);
+            cp = pixels;
+        }
+    }
+
     REBYTE *image_bytes = rebAllocN(REBYTE, (w * h) * 4);  // RGBA is 4 bytes
 
     REBYTE *dp = image_bytes;
@@ -399,6 +502,17 @@ REBNATIVE(decode_bmp)
     x = 0xDECAFBAD; // should be overwritten, but avoid uninitialized warning
 
     for (y = 0; y<h; y++) {
+        if (row_bytes != 0) {  // uncompressed rows from a PORT!
+            if (rows_buffered == 0) {
+                rows_buffered = MIN(rows_per_chunk, cast(REBLEN, h - y));
+                REBSIZ n = rows_buffered * row_bytes;
+                if (Read_Bmp_Bytes(pixels, n, port) != n)
+                    goto bad_encoding_error;  // file is cut off
+                cp = pixels;
+            }
+            --rows_buffered;
+        }
+
         switch(compression) {
         case BI_RGB:
             switch(bitcount) {
@@ -563,6 +677,11 @@ REBNATIVE(decode_bmp)
     }
 
   blockscope {
+    if (headers)
+        rebFree(headers);
+    if (pixels)
+        rebFree(pixels);
+
     REBVAL *binary = rebRepossess(image_bytes, (w * h) * 4);
 
     return rebValue(
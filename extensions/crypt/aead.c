@@ -0,0 +1,1132 @@
+//
+//  File: %aead.c
+//  Summary: "AES-CBC/CTR/GCM and ChaCha20-Poly1305 over whole buffers"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// AEAD ciphers ("Authenticated Encryption with Associated Data") encrypt
+// and produce a tag that proves neither the ciphertext nor some unencrypted
+// data that goes with it (e.g. a packet header) were tampered with.  They are
+// what TLS 1.2's modern cipher suites and all of TLS 1.3 use.
+//
+// The snapshot of mbedTLS in %mbedtls/ doesn't include %gcm.c, %chachapoly.c
+// or %aesni.c.  So the modes are done here, per NIST SP 800-38A (CTR), NIST
+// SP 800-38D (GCM), and RFC 8439 (ChaCha20-Poly1305).  mbedTLS still does
+// the AES key schedule, and encrypts the blocks when the CPU has no AES
+// instructions.  The results are checked against the published test vectors
+// in %tests/aead.test.reb.
+//
+// * On x86, Startup_Aead() checks for AES-NI and PCLMULQDQ at runtime, as
+//   Startup_Checksums() does in %s-crc.c.  With them, AES rounds are one
+//   instruction and 4 counter blocks are encrypted at once, while GHASH
+//   multiplies 4 blocks by H^4..H with carry-less multiplies and reduces
+//   once (the "aggregated reduction" of Intel's paper on GCM, "Carry-Less
+//   Multiplication and Its Usage for Computing the GCM Mode").
+//
+// * Otherwise GHASH uses the 4-bit tables of Shoup's method.
+//
+// * ChaCha20 needs nothing but adds, XORs and rotates, so SSE2 (part of every
+//   x86-64) does 4 blocks at once and is picked at compile time.  Poly1305
+//   uses 26-bit limbs, which work the same everywhere.
+//
+// Neither AES-GCM nor ChaCha20-Poly1305 survives reusing a nonce with the
+// same key: the caller has to make sure that never happens.
+//
+// AES-CBC isn't an AEAD mode, but it's here too so the TLS record layer's
+// CBC suites get the AES-NI rounds (see TLS-ENCRYPT-RECORD).
+//
+
+#include "mbedtls/aes.h"
+#include "mbedtls/platform_util.h"  // mbedtls_platform_zeroize()
+
+#include "sys-core.h"
+
+#include "aead.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) \
+        && (defined(__GNUC__) || defined(__clang__))
+    #define AEAD_X86
+    #include <immintrin.h>
+    #define AESNI_TARGET __attribute__((target("aes,pclmul,sse4.1")))
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)  // MSVC doesn't define __SSE2__
+    #define CHACHA_SSE2
+    #include <emmintrin.h>
+#endif
+
+static bool Has_Aesni = false;  // AES-NI, PCLMULQDQ, and SSE4.1 are all there
+
+
+//=//// BYTE ORDER ////////////////////////////////////////////////////////=//
+
+inline static uint32_t Get_U32_BE(const REBYTE *p) {
+    return (cast(uint32_t, p[0]) << 24) | (cast(uint32_t, p[1]) << 16)
+        | (cast(uint32_t, p[2]) << 8) | p[3];
+}
+
+inline static void Put_U32_BE(REBYTE *p, uint32_t u) {
+    p[0] = u >> 24; p[1] = u >> 16; p[2] = u >> 8; p[3] = u;
+}
+
+inline static uint32_t Get_U32_LE(const REBYTE *p) {
+    return p[0] | (cast(uint32_t, p[1]) << 8)
+        | (cast(uint32_t, p[2]) << 16) | (cast(uint32_t, p[3]) << 24);
+}
+
+inline static void Put_U32_LE(REBYTE *p, uint32_t u) {
+    p[0] = u; p[1] = u >> 8; p[2] = u >> 16; p[3] = u >> 24;
+}
+
+inline static uint64_t Get_U64_BE(const REBYTE *p)
+  { return (cast(uint64_t, Get_U32_BE(p)) << 32) | Get_U32_BE(p + 4); }
+
+inline static void Put_U64_BE(REBYTE *p, uint64_t u)
+  { Put_U32_BE(p, u >> 32); Put_U32_BE(p + 4, cast(uint32_t, u)); }
+
+inline static void Put_U64_LE(REBYTE *p, uint64_t u)
+  { Put_U32_LE(p, cast(uint32_t, u)); Put_U32_LE(p + 4, u >> 32); }
+
+static void Xor_Bytes(REBYTE *out, const REBYTE *a, const REBYTE *b, REBSIZ n)
+{
+    for (; n != 0; --n)
+        *out++ = *a++ ^ *b++;
+}
+
+
+//=//// PORTABLE AES-CTR AND GHASH ////////////////////////////////////////=//
+
+// Encrypt `size` bytes by XORing with the encrypted counter blocks.  GCM only
+// increments the last 32 bits of the counter (`wide` is false), while plain
+// CTR mode treats the whole block as one big-endian number.
+//
+static void Aes_Ctr_Portable(
+    mbedtls_aes_context *aes,
+    REBYTE *counter,  // 16 bytes, updated
+    bool wide,
+    REBYTE *out,
+    const REBYTE *in,
+    REBSIZ size
+){
+    REBYTE stream[16];
+
+    while (size != 0) {
+        mbedtls_internal_aes_encrypt(aes, counter, stream);
+
+        int i;
+        for (i = 15; i >= (wide ? 0 : 12); --i)
+            if (++counter[i] != 0)
+                break;
+
+        REBSIZ n = size < 16 ? size : 16;
+        Xor_Bytes(out, in, stream, n);
+        out += n;
+        in += n;
+        size -= n;
+    }
+
+    mbedtls_platform_zeroize(stream, sizeof(stream));
+}
+
+
+// GHASH multiplies by H in GF(2^128), with the bits of each byte reflected.
+// Shoup's method tabulates H times each 4-bit value, so a multiply is 32
+// table lookups and shifts.  The remainders of shifting 4 bits out are
+// reduced with Ghash_Last4.
+//
+struct Ghash_Table {
+    uint64_t hi[16];
+    uint64_t lo[16];
+};
+
+static const uint64_t Ghash_Last4[16] = {
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+static void Ghash_Init_Table(struct Ghash_Table *t, const REBYTE *h)
+{
+    uint64_t vh = Get_U64_BE(h);
+    uint64_t vl = Get_U64_BE(h + 8);
+
+    t->hi[8] = vh;  // 8 is the reflected 1
+    t->lo[8] = vl;
+
+    int i;
+    for (i = 4; i > 0; i >>= 1) {  // H times 4, 2, 1 are shifts of H
+        uint64_t carry = (vl & 1) ? 0xe100000000000000ull : 0;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ carry;
+        t->hi[i] = vh;
+        t->lo[i] = vl;
+    }
+
+    t->hi[0] = t->lo[0] = 0;
+    for (i = 2; i <= 8; i *= 2) {  // the rest are sums of those
+        int j;
+        for (j = 1; j < i; ++j) {
+            t->hi[i + j] = t->hi[i] ^ t->hi[j];
+            t->lo[i + j] = t->lo[i] ^ t->lo[j];
+        }
+    }
+}
+
+static void Ghash_Mult(const struct Ghash_Table *t, REBYTE *x)
+{
+    REBYTE lo = x[15] & 0x0F;
+    uint64_t zh = t->hi[lo];
+    uint64_t zl = t->lo[lo];
+
+    int i;
+    for (i = 15; i >= 0; --i) {
+        lo = x[i] & 0x0F;
+        REBYTE hi = x[i] >> 4;
+        REBYTE rem;
+
+        if (i != 15) {
+            rem = zl & 0x0F;
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ (Ghash_Last4[rem] << 48);
+            zh ^= t->hi[lo];
+            zl ^= t->lo[lo];
+        }
+
+        rem = zl & 0x0F;
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ (Ghash_Last4[rem] << 48);
+        zh ^= t->hi[hi];
+        zl ^= t->lo[hi];
+    }
+
+    Put_U64_BE(x, zh);
+    Put_U64_BE(x + 8, zl);
+}
+
+// Hash `size` bytes into `y`, with a partial last block padded with zeros
+//
+static void Ghash_Update(
+    const struct Ghash_Table *t,
+    REBYTE *y,
+    const REBYTE *data,
+    REBSIZ size
+){
+    for (; size >= 16; size -= 16, data += 16) {
+        Xor_Bytes(y, y, data, 16);
+        Ghash_Mult(t, y);
+    }
+    if (size != 0) {
+        Xor_Bytes(y, y, data, size);
+        Ghash_Mult(t, y);
+    }
+}
+
+static void Aes_Gcm_Portable(
+    mbedtls_aes_context *aes,
+    REBYTE *out,
+    REBYTE *tag,
+    const REBYTE *nonce,
+    const REBYTE *aad,
+    REBSIZ aad_size,
+    const REBYTE *in,
+    REBSIZ size,
+    bool decrypt
+){
+    REBYTE h[16];
+    memset(h, 0, 16);
+    mbedtls_internal_aes_encrypt(aes, h, h);  // the hash key is E(K, 0)
+
+    struct Ghash_Table t;
+    Ghash_Init_Table(&t, h);
+
+    REBYTE y[16];
+    memset(y, 0, 16);
+    Ghash_Update(&t, y, aad, aad_size);
+
+    REBYTE counter[16];  // "J0" is the nonce and 1, for encrypting the tag
+    memcpy(counter, nonce, AEAD_NONCE_SIZE);
+    Put_U32_BE(counter + 12, 1);
+
+    REBYTE ek0[16];
+    mbedtls_internal_aes_encrypt(aes, counter, ek0);
+
+    Put_U32_BE(counter + 12, 2);  // the data starts at the next counter
+
+    if (decrypt)  // it's the ciphertext that gets hashed
+        Ghash_Update(&t, y, in, size);
+    Aes_Ctr_Portable(aes, counter, false, out, in, size);
+    if (not decrypt)
+        Ghash_Update(&t, y, out, size);
+
+    REBYTE lengths[16];  // in bits
+    Put_U64_BE(lengths, cast(uint64_t, aad_size) * 8);
+    Put_U64_BE(lengths + 8, cast(uint64_t, size) * 8);
+    Ghash_Update(&t, y, lengths, 16);
+
+    Xor_Bytes(tag, y, ek0, 16);
+
+    mbedtls_platform_zeroize(&t, sizeof(t));
+    mbedtls_platform_zeroize(h, sizeof(h));
+    mbedtls_platform_zeroize(ek0, sizeof(ek0));
+}
+
+
+//=//// AES-NI AND PCLMULQDQ //////////////////////////////////////////////=//
+
+#if defined(AEAD_X86)
+
+// mbedTLS keeps its round keys as 32-bit words loaded little-endian from the
+// key bytes, so in memory they are the round key bytes in the usual order,
+// ready for AESENC.  (Its own %aesni.c uses them that way, too.)
+//
+AESNI_TARGET static void Aesni_Load_Keys(
+    __m128i *rk,
+    const mbedtls_aes_context *aes
+){
+    rk[0] = _mm_loadu_si128(cast(const __m128i*, aes->rk));
+    int i;
+    for (i = 1; i <= aes->nr; ++i)
+        rk[i] = _mm_loadu_si128(cast(const __m128i*, aes->rk + 4 * i));
+}
+
+AESNI_TARGET static __m128i Aesni_Block(const __m128i *rk, int nr, __m128i b)
+{
+    b = _mm_xor_si128(b, rk[0]);
+    int i;
+    for (i = 1; i < nr; ++i)
+        b = _mm_aesenc_si128(b, rk[i]);
+    return _mm_aesenclast_si128(b, rk[nr]);
+}
+
+// Four independent blocks keep the AES unit busy while each round's result
+// of the others is still in flight.
+//
+AESNI_TARGET static void Aesni_Block4(const __m128i *rk, int nr, __m128i *b)
+{
+    b[0] = _mm_xor_si128(b[0], rk[0]);
+    b[1] = _mm_xor_si128(b[1], rk[0]);
+    b[2] = _mm_xor_si128(b[2], rk[0]);
+    b[3] = _mm_xor_si128(b[3], rk[0]);
+    int i;
+    for (i = 1; i < nr; ++i) {
+        b[0] = _mm_aesenc_si128(b[0], rk[i]);
+        b[1] = _mm_aesenc_si128(b[1], rk[i]);
+        b[2] = _mm_aesenc_si128(b[2], rk[i]);
+        b[3] = _mm_aesenc_si128(b[3], rk[i]);
+    }
+    b[0] = _mm_aesenclast_si128(b[0], rk[nr]);
+    b[1] = _mm_aesenclast_si128(b[1], rk[nr]);
+    b[2] = _mm_aesenclast_si128(b[2], rk[nr]);
+    b[3] = _mm_aesenclast_si128(b[3], rk[nr]);
+}
+
+// The carry-less code works on blocks with their bytes reversed, so that the
+// reflected bits of GHASH line up with the registers' bit order.
+//
+#define GHASH_BSWAP \
+    _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+
+// Add the 256-bit product of `a` and `b` into `lo` and `hi`
+//
+AESNI_TARGET static void Clmul_Add(
+    __m128i *lo,
+    __m128i *hi,
+    __m128i a,
+    __m128i b
+){
+    __m128i mid = _mm_xor_si128(
+        _mm_clmulepi64_si128(a, b, 0x10),
+        _mm_clmulepi64_si128(a, b, 0x01)
+    );
+    *lo = _mm_xor_si128(*lo, _mm_clmulepi64_si128(a, b, 0x00));
+    *hi = _mm_xor_si128(*hi, _mm_clmulepi64_si128(a, b, 0x11));
+    *lo = _mm_xor_si128(*lo, _mm_slli_si128(mid, 8));
+    *hi = _mm_xor_si128(*hi, _mm_srli_si128(mid, 8));
+}
+
+// Shift the product left a bit (since the bits are reflected), and reduce it
+// modulo x^128 + x^7 + x^2 + x + 1.  As this is linear, it can be done once
+// for the sum of several products.
+//
+AESNI_TARGET static __m128i Ghash_Reduce(__m128i lo, __m128i hi)
+{
+    __m128i lo_carry = _mm_srli_epi32(lo, 31);
+    __m128i hi_carry = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    hi = _mm_or_si128(hi, _mm_srli_si128(lo_carry, 12));
+    hi = _mm_or_si128(hi, _mm_slli_si128(hi_carry, 4));
+    lo = _mm_or_si128(lo, _mm_slli_si128(lo_carry, 4));
+
+    __m128i a = _mm_xor_si128(
+        _mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)),
+        _mm_slli_epi32(lo, 25)
+    );
+    __m128i a_hi = _mm_srli_si128(a, 4);
+    lo = _mm_xor_si128(lo, _mm_slli_si128(a, 12));
+
+    __m128i b = _mm_xor_si128(
+        _mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)),
+        _mm_srli_epi32(lo, 7)
+    );
+    b = _mm_xor_si128(b, a_hi);
+    lo = _mm_xor_si128(lo, b);
+    return _mm_xor_si128(hi, lo);
+}
+
+AESNI_TARGET static __m128i Ghash_Mul(__m128i a, __m128i b)
+{
+    __m128i lo = _mm_setzero_si128();
+    __m128i hi = _mm_setzero_si128();
+    Clmul_Add(&lo, &hi, a, b);
+    return Ghash_Reduce(lo, hi);
+}
+
+// Y = (Y + X1) * H^4 + X2 * H^3 + X3 * H^2 + X4 * H, for blocks that have
+// already been byte-reversed, with `hpow` holding H, H^2, H^3, H^4.
+//
+AESNI_TARGET static __m128i Ghash_4(
+    __m128i y,
+    const __m128i *hpow,
+    const __m128i *x
+){
+    __m128i lo = _mm_setzero_si128();
+    __m128i hi = _mm_setzero_si128();
+    Clmul_Add(&lo, &hi, _mm_xor_si128(y, x[0]), hpow[3]);
+    Clmul_Add(&lo, &hi, x[1], hpow[2]);
+    Clmul_Add(&lo, &hi, x[2], hpow[1]);
+    Clmul_Add(&lo, &hi, x[3], hpow[0]);
+    return Ghash_Reduce(lo, hi);
+}
+
+AESNI_TARGET static __m128i Ghash_Update_Aesni(
+    __m128i y,
+    const __m128i *hpow,
+    const REBYTE *data,
+    REBSIZ size
+){
+    const __m128i bswap = GHASH_BSWAP;
+
+    for (; size >= 64; size -= 64, data += 64) {
+        __m128i x[4];
+        int i;
+        for (i = 0; i < 4; ++i)
+            x[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128(cast(const __m128i*, data + 16 * i)), bswap
+            );
+        y = Ghash_4(y, hpow, x);
+    }
+    for (; size >= 16; size -= 16, data += 16) {
+        __m128i x = _mm_loadu_si128(cast(const __m128i*, data));
+        y = Ghash_Mul(_mm_xor_si128(y, _mm_shuffle_epi8(x, bswap)), hpow[0]);
+    }
+    if (size != 0) {
+        REBYTE last[16];
+        memset(last, 0, 16);
+        memcpy(last, data, size);
+        __m128i x = _mm_loadu_si128(cast(const __m128i*, last));
+        y = Ghash_Mul(_mm_xor_si128(y, _mm_shuffle_epi8(x, bswap)), hpow[0]);
+    }
+    return y;
+}
+
+AESNI_TARGET static void Aes_Gcm_Aesni(
+    const mbedtls_aes_context *aes,
+    REBYTE *out,
+    REBYTE *tag,
+    const REBYTE *nonce,
+    const REBYTE *aad,
+    REBSIZ aad_size,
+    const REBYTE *in,
+    REBSIZ size,
+    bool decrypt
+){
+    const __m128i bswap = GHASH_BSWAP;
+
+    __m128i rk[15];
+    int nr = aes->nr;
+    Aesni_Load_Keys(rk, aes);
+
+    __m128i hpow[4];
+    hpow[0] = _mm_shuffle_epi8(
+        Aesni_Block(rk, nr, _mm_setzero_si128()), bswap
+    );
+    hpow[1] = Ghash_Mul(hpow[0], hpow[0]);
+    hpow[2] = Ghash_Mul(hpow[1], hpow[0]);
+    hpow[3] = Ghash_Mul(hpow[2], hpow[0]);
+
+    __m128i y = Ghash_Update_Aesni(_mm_setzero_si128(), hpow, aad, aad_size);
+
+    REBYTE j0[16];
+    memcpy(j0, nonce, AEAD_NONCE_SIZE);
+    Put_U32_BE(j0 + 12, 1);
+    __m128i base = _mm_loadu_si128(cast(const __m128i*, j0));
+    __m128i ek0 = Aesni_Block(rk, nr, base);
+
+    uint32_t counter = 2;
+    REBSIZ total = size;
+
+    for (; size >= 64; size -= 64, in += 64, out += 64, counter += 4) {
+        __m128i b[4];
+        int i;
+        for (i = 0; i < 4; ++i)
+            b[i] = _mm_insert_epi32(
+                base, cast(int, __builtin_bswap32(counter + i)), 3
+            );
+        Aesni_Block4(rk, nr, b);
+
+        __m128i x[4];  // the ciphertext, for GHASH
+        for (i = 0; i < 4; ++i) {
+            __m128i d = _mm_loadu_si128(cast(const __m128i*, in + 16 * i));
+            __m128i c = _mm_xor_si128(d, b[i]);
+            _mm_storeu_si128(cast(__m128i*, out + 16 * i), c);
+            x[i] = _mm_shuffle_epi8(decrypt ? d : c, bswap);
+        }
+        y = Ghash_4(y, hpow, x);
+    }
+
+    for (; size >= 16; size -= 16, in += 16, out += 16, ++counter) {
+        __m128i b = Aesni_Block(rk, nr, _mm_insert_epi32(
+            base, cast(int, __builtin_bswap32(counter)), 3
+        ));
+        __m128i d = _mm_loadu_si128(cast(const __m128i*, in));
+        __m128i c = _mm_xor_si128(d, b);
+        _mm_storeu_si128(cast(__m128i*, out), c);
+        y = Ghash_Mul(
+            _mm_xor_si128(y, _mm_shuffle_epi8(decrypt ? d : c, bswap)),
+            hpow[0]
+        );
+    }
+
+    if (size != 0) {
+        REBYTE stream[16];
+        _mm_storeu_si128(cast(__m128i*, stream), Aesni_Block(
+            rk, nr, _mm_insert_epi32(
+                base, cast(int, __builtin_bswap32(counter)), 3
+            )
+        ));
+        Xor_Bytes(out, in, stream, size);
+        y = Ghash_Update_Aesni(y, hpow, decrypt ? in : out, size);
+        mbedtls_platform_zeroize(stream, sizeof(stream));
+    }
+
+    __m128i lengths = _mm_set_epi64x(  // bits, as reversed bytes
+        cast(int64_t, aad_size) * 8, cast(int64_t, total) * 8
+    );
+    y = Ghash_Mul(_mm_xor_si128(y, lengths), hpow[0]);
+
+    _mm_storeu_si128(
+        cast(__m128i*, tag),
+        _mm_xor_si128(_mm_shuffle_epi8(y, bswap), ek0)
+    );
+
+    mbedtls_platform_zeroize(rk, sizeof(rk));
+    mbedtls_platform_zeroize(hpow, sizeof(hpow));
+}
+
+AESNI_TARGET static void Aes_Ctr_Aesni(
+    const mbedtls_aes_context *aes,
+    const REBYTE *iv,
+    REBYTE *out,
+    const REBYTE *in,
+    REBSIZ size
+){
+    const __m128i bswap = GHASH_BSWAP;
+
+    __m128i rk[15];
+    int nr = aes->nr;
+    Aesni_Load_Keys(rk, aes);
+
+    uint64_t hi = Get_U64_BE(iv);  // the counter is one 128-bit number
+    uint64_t lo = Get_U64_BE(iv + 8);
+
+    while (size != 0) {
+        __m128i b[4];
+        int i;
+        for (i = 0; i < 4; ++i) {
+            b[i] = _mm_shuffle_epi8(
+                _mm_set_epi64x(cast(int64_t, hi), cast(int64_t, lo)), bswap
+            );
+            if (++lo == 0)
+                ++hi;
+        }
+        Aesni_Block4(rk, nr, b);
+
+        for (i = 0; i < 4 and size != 0; ++i) {
+            if (size >= 16) {
+                __m128i d = _mm_loadu_si128(cast(const __m128i*, in));
+                _mm_storeu_si128(cast(__m128i*, out), _mm_xor_si128(d, b[i]));
+                in += 16;
+                out += 16;
+                size -= 16;
+            }
+            else {
+                REBYTE stream[16];
+                _mm_storeu_si128(cast(__m128i*, stream), b[i]);
+                Xor_Bytes(out, in, stream, size);
+                mbedtls_platform_zeroize(stream, sizeof(stream));
+                size = 0;
+            }
+        }
+    }
+
+    mbedtls_platform_zeroize(rk, sizeof(rk));
+}
+
+// CBC encryption is serial (each block needs the one before), but decryption
+// isn't, so it does 4 blocks at a time like CTR.  `aes` has decryption round
+// keys from mbedtls_aes_setkey_dec(), which are the "equivalent inverse
+// cipher" keys that AESDEC expects.
+//
+AESNI_TARGET static void Aes_Cbc_Aesni(
+    const mbedtls_aes_context *aes,
+    REBYTE *iv,
+    REBYTE *out,
+    const REBYTE *in,
+    REBSIZ size,
+    bool decrypt
+){
+    __m128i rk[15];
+    int nr = aes->nr;
+    Aesni_Load_Keys(rk, aes);
+
+    __m128i prev = _mm_loadu_si128(cast(const __m128i*, iv));
+
+    if (not decrypt) {
+        for (; size != 0; size -= 16, in += 16, out += 16) {
+            __m128i d = _mm_loadu_si128(cast(const __m128i*, in));
+            prev = Aesni_Block(rk, nr, _mm_xor_si128(d, prev));
+            _mm_storeu_si128(cast(__m128i*, out), prev);
+        }
+    }
+    else {
+        while (size != 0) {
+            __m128i c[4];
+            __m128i b[4];
+            int n = size >= 64 ? 4 : 1;
+            int i;
+            for (i = 0; i < n; ++i) {  // load all first, in case in == out
+                c[i] = _mm_loadu_si128(cast(const __m128i*, in + 16 * i));
+                b[i] = _mm_xor_si128(c[i], rk[0]);
+            }
+            int r;
+            for (r = 1; r < nr; ++r)
+                for (i = 0; i < n; ++i)
+                    b[i] = _mm_aesdec_si128(b[i], rk[r]);
+            for (i = 0; i < n; ++i) {
+                b[i] = _mm_aesdeclast_si128(b[i], rk[nr]);
+                _mm_storeu_si128(
+                    cast(__m128i*, out + 16 * i), _mm_xor_si128(b[i], prev)
+                );
+                prev = c[i];
+            }
+
+            in += 16 * n;
+            out += 16 * n;
+            size -= 16 * n;
+        }
+    }
+
+    _mm_storeu_si128(cast(__m128i*, iv), prev);
+    mbedtls_platform_zeroize(rk, sizeof(rk));
+}
+
+#endif  // AEAD_X86
+
+
+//
+//  Startup_Aead: C
+//
+// Pick the fastest versions this CPU can run (called by INIT-CRYPTO).
+//
+void Startup_Aead(void)
+{
+  #if defined(AEAD_X86)
+    __builtin_cpu_init();
+    Has_Aesni = __builtin_cpu_supports("aes")
+        and __builtin_cpu_supports("pclmul")
+        and __builtin_cpu_supports("sse4.1");
+  #endif
+}
+
+
+//
+//  Aes_Ctr_Crypt: C
+//
+// AES in counter mode, with `iv` as the first counter block (incremented as
+// a 128-bit big-endian number after each block).  Encrypting and decrypting
+// are the same.  Returns false if the key isn't 16, 24, or 32 bytes.
+//
+bool Aes_Ctr_Crypt(
+    REBYTE *out,
+    const REBYTE *key,
+    REBSIZ key_size,
+    const REBYTE *iv,
+    const REBYTE *in,
+    REBSIZ size
+){
+    mbedtls_aes_context aes;
+    mbedtls_aes_init(&aes);
+    if (mbedtls_aes_setkey_enc(&aes, key, key_size * 8) != 0) {
+        mbedtls_aes_free(&aes);
+        return false;
+    }
+
+  #if defined(AEAD_X86)
+    if (Has_Aesni)
+        Aes_Ctr_Aesni(&aes, iv, out, in, size);
+    else
+  #endif
+    {
+        REBYTE counter[16];
+        memcpy(counter, iv, AES_CTR_IV_SIZE);
+        Aes_Ctr_Portable(&aes, counter, true, out, in, size);
+    }
+
+    mbedtls_aes_free(&aes);  // zeroizes the round keys
+    return true;
+}
+
+
+//
+//  Aes_Gcm_Crypt: C
+//
+// AES-GCM with a 12-byte nonce.  The tag is computed over the ciphertext,
+// which is the output when encrypting and the input when decrypting; it is
+// up to the caller to compare it (see Aead_Tags_Equal()) before trusting a
+// decryption.  Returns false if the key isn't 16, 24, or 32 bytes.
+//
+bool Aes_Gcm_Crypt(
+    REBYTE *out,
+    REBYTE *tag,
+    const REBYTE *key,
+    REBSIZ key_size,
+    const REBYTE *nonce,
+    const REBYTE *aad,
+    REBSIZ aad_size,
+    const REBYTE *in,
+    REBSIZ size,
+    bool decrypt
+){
+    mbedtls_aes_context aes;
+    mbedtls_aes_init(&aes);
+    if (mbedtls_aes_setkey_enc(&aes, key, key_size * 8) != 0) {
+        mbedtls_aes_free(&aes);
+        return false;
+    }
+
+  #if defined(AEAD_X86)
+    if (Has_Aesni)
+        Aes_Gcm_Aesni(
+            &aes, out, tag, nonce, aad, aad_size, in, size, decrypt
+        );
+    else
+  #endif
+        Aes_Gcm_Portable(
+            &aes, out, tag, nonce, aad, aad_size, in, size, decrypt
+        );
+
+    mbedtls_aes_free(&aes);
+    return true;
+}
+
+
+//
+//  Aes_Cbc_Crypt: C
+//
+// AES-CBC with no padding, using a key already set up with
+// mbedtls_aes_setkey_enc() (or mbedtls_aes_setkey_dec() to decrypt), so that
+// things encrypting many buffers with the same key only expand it once.
+// The `size` must be a multiple of 16.  The 16 bytes of `iv` are updated to
+// the last ciphertext block, which is the IV for continuing the chain.
+//
+void Aes_Cbc_Crypt(
+    mbedtls_aes_context *aes,
+    REBYTE *iv,
+    REBYTE *out,
+    const REBYTE *in,
+    REBSIZ size,
+    bool decrypt
+){
+    assert(size % 16 == 0);
+
+  #if defined(AEAD_X86)
+    if (Has_Aesni) {
+        Aes_Cbc_Aesni(aes, iv, out, in, size, decrypt);
+        return;
+    }
+  #endif
+
+    int ret = mbedtls_aes_crypt_cbc(
+        aes,
+        decrypt ? MBEDTLS_AES_DECRYPT : MBEDTLS_AES_ENCRYPT,
+        size,
+        iv,
+        in,
+        out
+    );
+    assert(ret == 0);  // the only error is a size that isn't whole blocks
+    UNUSED(ret);
+}
+
+
+//=//// CHACHA20 //////////////////////////////////////////////////////////=//
+
+#define CHACHA_ROTL(v,n) \
+    (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define CHACHA_QUARTER(a,b,c,d) \
+    do { \
+        a += b; d ^= a; d = CHACHA_ROTL(d, 16); \
+        c += d; b ^= c; b = CHACHA_ROTL(b, 12); \
+        a += b; d ^= a; d = CHACHA_ROTL(d, 8); \
+        c += d; b ^= c; b = CHACHA_ROTL(b, 7); \
+    } while (0)
+
+static void Chacha20_Block(const uint32_t *state, REBYTE *out)
+{
+    uint32_t x[16];
+    memcpy(x, state, sizeof(x));
+
+    int i;
+    for (i = 0; i < 10; ++i) {  // 20 rounds: a column, then a diagonal round
+        CHACHA_QUARTER(x[0], x[4], x[8], x[12]);
+        CHACHA_QUARTER(x[1], x[5], x[9], x[13]);
+        CHACHA_QUARTER(x[2], x[6], x[10], x[14]);
+        CHACHA_QUARTER(x[3], x[7], x[11], x[15]);
+        CHACHA_QUARTER(x[0], x[5], x[10], x[15]);
+        CHACHA_QUARTER(x[1], x[6], x[11], x[12]);
+        CHACHA_QUARTER(x[2], x[7], x[8], x[13]);
+        CHACHA_QUARTER(x[3], x[4], x[9], x[14]);
+    }
+
+    for (i = 0; i < 16; ++i)
+        Put_U32_LE(out + 4 * i, x[i] + state[i]);
+
+    mbedtls_platform_zeroize(x, sizeof(x));
+}
+
+#if defined(CHACHA_SSE2)
+
+#define CHACHA_ROTL_SSE2(v,n) \
+    _mm_or_si128(_mm_slli_epi32((v), (n)), _mm_srli_epi32((v), 32 - (n)))
+
+#define CHACHA_QUARTER_SSE2(a,b,c,d) \
+    do { \
+        a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); \
+        d = CHACHA_ROTL_SSE2(d, 16); \
+        c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); \
+        b = CHACHA_ROTL_SSE2(b, 12); \
+        a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); \
+        d = CHACHA_ROTL_SSE2(d, 8); \
+        c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); \
+        b = CHACHA_ROTL_SSE2(b, 7); \
+    } while (0)
+
+// XOR 4 blocks (256 bytes) of keystream into the output.  Each register
+// holds the same word of 4 consecutive blocks, so the rounds are the scalar
+// code's, and a 4x4 transpose of each group of words puts the blocks back.
+//
+static void Chacha20_Xor_4(
+    const uint32_t *state,
+    REBYTE *out,
+    const REBYTE *in
+){
+    __m128i s[16];
+    __m128i x[16];
+    int i;
+    for (i = 0; i < 16; ++i)
+        s[i] = _mm_set1_epi32(cast(int, state[i]));
+    s[12] = _mm_add_epi32(s[12], _mm_set_epi32(3, 2, 1, 0));
+    for (i = 0; i < 16; ++i)
+        x[i] = s[i];
+
+    for (i = 0; i < 10; ++i) {
+        CHACHA_QUARTER_SSE2(x[0], x[4], x[8], x[12]);
+        CHACHA_QUARTER_SSE2(x[1], x[5], x[9], x[13]);
+        CHACHA_QUARTER_SSE2(x[2], x[6], x[10], x[14]);
+        CHACHA_QUARTER_SSE2(x[3], x[7], x[11], x[15]);
+        CHACHA_QUARTER_SSE2(x[0], x[5], x[10], x[15]);
+        CHACHA_QUARTER_SSE2(x[1], x[6], x[11], x[12]);
+        CHACHA_QUARTER_SSE2(x[2], x[7], x[8], x[13]);
+        CHACHA_QUARTER_SSE2(x[3], x[4], x[9], x[14]);
+    }
+
+    int g;
+    for (g = 0; g < 4; ++g) {  // words 4g..4g+3 of each of the 4 blocks
+        __m128i a0 = _mm_add_epi32(x[4 * g], s[4 * g]);
+        __m128i a1 = _mm_add_epi32(x[4 * g + 1], s[4 * g + 1]);
+        __m128i a2 = _mm_add_epi32(x[4 * g + 2], s[4 * g + 2]);
+        __m128i a3 = _mm_add_epi32(x[4 * g + 3], s[4 * g + 3]);
+
+        __m128i t0 = _mm_unpacklo_epi32(a0, a1);
+        __m128i t1 = _mm_unpacklo_epi32(a2, a3);
+        __m128i t2 = _mm_unpackhi_epi32(a0, a1);
+        __m128i t3 = _mm_unpackhi_epi32(a2, a3);
+
+        __m128i blocks[4];
+        blocks[0] = _mm_unpacklo_epi64(t0, t1);
+        blocks[1] = _mm_unpackhi_epi64(t0, t1);
+        blocks[2] = _mm_unpacklo_epi64(t2, t3);
+        blocks[3] = _mm_unpackhi_epi64(t2, t3);
+
+        int b;
+        for (b = 0; b < 4; ++b) {
+            REBSIZ at = 64 * b + 16 * g;
+            __m128i d = _mm_loadu_si128(cast(const __m128i*, in + at));
+            _mm_storeu_si128(
+                cast(__m128i*, out + at), _mm_xor_si128(d, blocks[b])
+            );
+        }
+    }
+}
+
+#endif  // CHACHA_SSE2
+
+// Encrypt (or decrypt) with the keystream, starting at the block counter in
+// state[12] and advancing it.
+//
+static void Chacha20_Xor(
+    uint32_t *state,
+    REBYTE *out,
+    const REBYTE *in,
+    REBSIZ size
+){
+  #if defined(CHACHA_SSE2)
+    for (; size >= 256; size -= 256, in += 256, out += 256) {
+        Chacha20_Xor_4(state, out, in);
+        state[12] += 4;
+    }
+  #endif
+
+    REBYTE stream[64];
+    while (size != 0) {
+        Chacha20_Block(state, stream);
+        ++state[12];
+
+        REBSIZ n = size < 64 ? size : 64;
+        Xor_Bytes(out, in, stream, n);
+        out += n;
+        in += n;
+        size -= n;
+    }
+    mbedtls_platform_zeroize(stream, sizeof(stream));
+}
+
+
+//=//// POLY1305 //////////////////////////////////////////////////////////=//
+//
+// The accumulator and key are in 26-bit limbs, so products of limbs fit in
+// 64 bits on any platform.  (This is the layout of Andrew Moon's public
+// domain "poly1305-donna".)  The AEAD construction pads everything it hashes
+// to 16 bytes, so only whole blocks are needed here.
+//
+
+struct Poly1305 {
+    uint32_t r[5];
+    uint32_t h[5];
+    uint32_t pad[4];
+};
+
+static void Poly1305_Init(struct Poly1305 *p, const REBYTE *key)
+{
+    p->r[0] = Get_U32_LE(key + 0) & 0x3ffffff;  // "clamped" per the RFC
+    p->r[1] = (Get_U32_LE(key + 3) >> 2) & 0x3ffff03;
+    p->r[2] = (Get_U32_LE(key + 6) >> 4) & 0x3ffc0ff;
+    p->r[3] = (Get_U32_LE(key + 9) >> 6) & 0x3f03fff;
+    p->r[4] = (Get_U32_LE(key + 12) >> 8) & 0x00fffff;
+
+    memset(p->h, 0, sizeof(p->h));
+
+    int i;
+    for (i = 0; i < 4; ++i)
+        p->pad[i] = Get_U32_LE(key + 16 + 4 * i);
+}
+
+static void Poly1305_Blocks(struct Poly1305 *p, const REBYTE *m, REBSIZ size)
+{
+    const uint32_t r0 = p->r[0], r1 = p->r[1], r2 = p->r[2];
+    const uint32_t r3 = p->r[3], r4 = p->r[4];
+    const uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+
+    uint32_t h0 = p->h[0], h1 = p->h[1], h2 = p->h[2];
+    uint32_t h3 = p->h[3], h4 = p->h[4];
+
+    assert(size % 16 == 0);
+    for (; size != 0; size -= 16, m += 16) {
+        h0 += Get_U32_LE(m + 0) & 0x3ffffff;
+        h1 += (Get_U32_LE(m + 3) >> 2) & 0x3ffffff;
+        h2 += (Get_U32_LE(m + 6) >> 4) & 0x3ffffff;
+        h3 += (Get_U32_LE(m + 9) >> 6) & 0x3ffffff;
+        h4 += (Get_U32_LE(m + 12) >> 8) | (1 << 24);  // the 2^128 bit
+
+        uint64_t d0 = cast(uint64_t, h0) * r0 + cast(uint64_t, h1) * s4
+            + cast(uint64_t, h2) * s3 + cast(uint64_t, h3) * s2
+            + cast(uint64_t, h4) * s1;
+        uint64_t d1 = cast(uint64_t, h0) * r1 + cast(uint64_t, h1) * r0
+            + cast(uint64_t, h2) * s4 + cast(uint64_t, h3) * s3
+            + cast(uint64_t, h4) * s2;
+        uint64_t d2 = cast(uint64_t, h0) * r2 + cast(uint64_t, h1) * r1
+            + cast(uint64_t, h2) * r0 + cast(uint64_t, h3) * s4
+            + cast(uint64_t, h4) * s3;
+        uint64_t d3 = cast(uint64_t, h0) * r3 + cast(uint64_t, h1) * r2
+            + cast(uint64_t, h2) * r1 + cast(uint64_t, h3) * r0
+            + cast(uint64_t, h4) * s4;
+        uint64_t d4 = cast(uint64_t, h0) * r4 + cast(uint64_t, h1) * r3
+            + cast(uint64_t, h2) * r2 + cast(uint64_t, h3) * r1
+            + cast(uint64_t, h4) * r0;
+
+        uint32_t c = cast(uint32_t, d0 >> 26); h0 = d0 & 0x3ffffff;
+        d1 += c; c = cast(uint32_t, d1 >> 26); h1 = d1 & 0x3ffffff;
+        d2 += c; c = cast(uint32_t, d2 >> 26); h2 = d2 & 0x3ffffff;
+        d3 += c; c = cast(uint32_t, d3 >> 26); h3 = d3 & 0x3ffffff;
+        d4 += c; c = cast(uint32_t, d4 >> 26); h4 = d4 & 0x3ffffff;
+        h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+        h1 += c;
+    }
+
+    p->h[0] = h0; p->h[1] = h1; p->h[2] = h2; p->h[3] = h3; p->h[4] = h4;
+}
+
+static void Poly1305_Padded(struct Poly1305 *p, const REBYTE *m, REBSIZ size)
+{
+    Poly1305_Blocks(p, m, size & ~cast(REBSIZ, 15));
+    if (size % 16 != 0) {
+        REBYTE last[16];
+        memset(last, 0, 16);
+        memcpy(last, m + (size & ~cast(REBSIZ, 15)), size % 16);
+        Poly1305_Blocks(p, last, 16);
+    }
+}
+
+static void Poly1305_Finish(struct Poly1305 *p, REBYTE *mac)
+{
+    uint32_t h0 = p->h[0], h1 = p->h[1], h2 = p->h[2];
+    uint32_t h3 = p->h[3], h4 = p->h[4];
+
+    uint32_t c = h1 >> 26; h1 &= 0x3ffffff;  // fully carry h
+    h2 += c; c = h2 >> 26; h2 &= 0x3ffffff;
+    h3 += c; c = h3 >> 26; h3 &= 0x3ffffff;
+    h4 += c; c = h4 >> 26; h4 &= 0x3ffffff;
+    h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+    h1 += c;
+
+    // Compute h - p = h + 5 - 2^130, and use it if it didn't go negative
+    //
+    uint32_t g0 = h0 + 5; c = g0 >> 26; g0 &= 0x3ffffff;
+    uint32_t g1 = h1 + c; c = g1 >> 26; g1 &= 0x3ffffff;
+    uint32_t g2 = h2 + c; c = g2 >> 26; g2 &= 0x3ffffff;
+    uint32_t g3 = h3 + c; c = g3 >> 26; g3 &= 0x3ffffff;
+    uint32_t g4 = h4 + c - (1 << 26);
+
+    uint32_t mask = (g4 >> 31) - 1;  // all ones if h >= p, without branching
+    h0 = (h0 & ~mask) | (g0 & mask);
+    h1 = (h1 & ~mask) | (g1 & mask);
+    h2 = (h2 & ~mask) | (g2 & mask);
+    h3 = (h3 & ~mask) | (g3 & mask);
+    h4 = (h4 & ~mask) | (g4 & mask);
+
+    h0 = h0 | (h1 << 26);  // back to 4 words of 32 bits (mod 2^128)
+    h1 = (h1 >> 6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 << 8);
+
+    uint64_t f = cast(uint64_t, h0) + p->pad[0];
+    Put_U32_LE(mac, cast(uint32_t, f));
+    f = cast(uint64_t, h1) + p->pad[1] + (f >> 32);
+    Put_U32_LE(mac + 4, cast(uint32_t, f));
+    f = cast(uint64_t, h2) + p->pad[2] + (f >> 32);
+    Put_U32_LE(mac + 8, cast(uint32_t, f));
+    f = cast(uint64_t, h3) + p->pad[3] + (f >> 32);
+    Put_U32_LE(mac + 12, cast(uint32_t, f));
+
+    mbedtls_platform_zeroize(p, sizeof(*p));
+}
+
+
+//
+//  Chacha20_Poly1305_Crypt: C
+//
+// The AEAD of RFC 8439, with a 32-byte key and 12-byte nonce.  As with
+// Aes_Gcm_Crypt(), the tag is of the ciphertext, and the caller compares it.
+//
+void Chacha20_Poly1305_Crypt(
+    REBYTE *out,
+    REBYTE *tag,
+    const REBYTE *key,
+    const REBYTE *nonce,
+    const REBYTE *aad,
+    REBSIZ aad_size,
+    const REBYTE *in,
+    REBSIZ size,
+    bool decrypt
+){
+    uint32_t state[16];
+    state[0] = 0x61707865;  // "expand 32-byte k"
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+
+    int i;
+    for (i = 0; i < 8; ++i)
+        state[4 + i] = Get_U32_LE(key + 4 * i);
+    state[12] = 0;
+    for (i = 0; i < 3; ++i)
+        state[13 + i] = Get_U32_LE(nonce + 4 * i);
+
+    REBYTE block0[64];  // the first 32 bytes of block 0 are the Poly1305 key
+    Chacha20_Block(state, block0);
+    state[12] = 1;
+
+    struct Poly1305 poly;
+    Poly1305_Init(&poly, block0);
+    mbedtls_platform_zeroize(block0, sizeof(block0));
+
+    Poly1305_Padded(&poly, aad, aad_size);
+
+    if (decrypt)
+        Poly1305_Padded(&poly, in, size);
+    Chacha20_Xor(state, out, in, size);
+    if (not decrypt)
+        Poly1305_Padded(&poly, out, size);
+
+    REBYTE lengths[16];  // in bytes this time, and little-endian
+    Put_U64_LE(lengths, aad_size);
+    Put_U64_LE(lengths + 8, size);
+    Poly1305_Blocks(&poly, lengths, 16);
+
+    Poly1305_Finish(&poly, tag);
+
+    mbedtls_platform_zeroize(state, sizeof(state));
+}
+
+
+//
+//  Aead_Tags_Equal: C
+//
+// Compare tags in a time that doesn't depend on where they differ, which
+// would let an attacker forge a tag a byte at a time.
+//
+bool Aead_Tags_Equal(const REBYTE *a, const REBYTE *b)
+{
+    REBYTE diff = 0;
+    int i;
+    for (i = 0; i < AEAD_TAG_SIZE; ++i)
+        diff |= a[i] ^ b[i];
+    return diff == 0;
+}
@@ -0,0 +1,69 @@
+//
+//  File: %aead.h
+//  Summary: {AES-CTR, AES-GCM, and ChaCha20-Poly1305 for the Crypt extension}
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %aead.c for the implementation notes.  These routines work on whole
+// buffers in one call, writing `size` bytes of output (plus a tag for the
+// AEAD modes).  The output must not overlap the input, except with CBC
+// (which may work in place).
+//
+// Include "mbedtls/aes.h" before this, for mbedtls_aes_context.
+//
+
+#define AEAD_NONCE_SIZE 12  // RFC 5116's recommended size, used by TLS
+#define AEAD_TAG_SIZE 16
+#define AES_CTR_IV_SIZE 16  // the whole first counter block
+
+extern void Startup_Aead(void);
+
+extern bool Aes_Ctr_Crypt(
+    REBYTE *out,
+    const REBYTE *key, REBSIZ key_size,
+    const REBYTE *iv,
+    const REBYTE *in, REBSIZ size
+);
+
+extern void Aes_Cbc_Crypt(
+    mbedtls_aes_context *aes,  // from mbedtls_aes_setkey_enc() or _dec()
+    REBYTE *iv,  // 16 bytes, updated to continue the chain
+    REBYTE *out,
+    const REBYTE *in, REBSIZ size,  // size must be a multiple of 16
+    bool decrypt
+);
+
+extern bool Aes_Gcm_Crypt(
+    REBYTE *out, REBYTE *tag,
+    const REBYTE *key, REBSIZ key_size,
+    const REBYTE *nonce,
+    const REBYTE *aad, REBSIZ aad_size,
+    const REBYTE *in, REBSIZ size,
+    bool decrypt
+);
+
+extern void Chacha20_Poly1305_Crypt(
+    REBYTE *out, REBYTE *tag,
+    const REBYTE *key,  // 32 bytes
+    const REBYTE *nonce,
+    const REBYTE *aad, REBSIZ aad_size,
+    const REBYTE *in, REBSIZ size,
+    bool decrypt
+);
+
+extern bool Aead_Tags_Equal(const REBYTE *a, const REBYTE *b);
@@ -12,6 +12,8 @@ definitions: [
     {MBEDTLS_CONFIG_FILE="mbedtls-rebol-config.h"}
 ]
 depends: [
+    %crypt/aead.c  ; AES-CTR, AES-GCM, ChaCha20-Poly1305 (not from mbedTLS)
+
     [%crypt/mbedtls/library/rsa.c  #no-c++]
     [%crypt/mbedtls/library/rsa_alt_helpers.c  #no-c++]
 
@@ -60,7 +60,10 @@
 
 #include "mbedtls/arc4.h"  // RC4 is technically trademarked, so it's "ARC4"
 
-#include "sys-zlib.h"  // needed for the ADLER32 hash
+#include "mbedtls/aes.h"  // for Aes_Cbc_Crypt() in %aead.h
+#include "mbedtls/platform_util.h"  // mbedtls_platform_zeroize()
+#include "aead.h"  // AES-CTR, AES-GCM, ChaCha20-Poly1305 (not from mbedTLS)
+
 
 #include "tmp-mod-crypt.h"
 
@@ -250,7 +253,16 @@ REBNATIVE(checksum)
         // 32-bit signed INTEGER!.
         //
         rebFree(method_name);
-        Init_Integer(D_SPARE, crc32_z(0L, data, size));
+        Init_Integer(D_SPARE, Checksum_CRC32(0, data, size));
+        return rebValue("enbin [le + 4]", D_SPARE);
+    }
+    else if (0 == strcmp(method_name, "CRC32C")) {
+        //
+        // Castagnoli CRC-32, which CPUs have instructions for (see the
+        // notes in CHECKSUM-CORE).
+        //
+        rebFree(method_name);
+        Init_Integer(D_SPARE, Checksum_CRC32C(0, data, size));
         return rebValue("enbin [le + 4]", D_SPARE);
     }
     else if (0 == strcmp(method_name, "ADLER32")) {
@@ -261,9 +273,24 @@ REBNATIVE(checksum)
         // result of the adler calculation to a signed integer.
         //
         rebFree(method_name);
-        Init_Integer(D_SPARE, z_adler32(1L, data, size));  // Note the 1L (!)
+        Init_Integer(D_SPARE, Checksum_Adler32(1, data, size));  // 1 (!)
         return rebValue("enbin [le + 4]", D_SPARE);
     }
+    else if (0 == strcmp(method_name, "HASH64")) {
+        //
+        // The hash used for maps and sets, with a fixed seed (see the notes
+        // in CHECKSUM-CORE).  Gives 8 bytes, little-endian.
+        //
+        rebFree(method_name);
+        uint64_t hash = Hash64_Bytes(data, size, 0);
+        REBYTE *output = rebAllocN(REBYTE, 8);
+        int i;
+        for (i = 0; i < 8; ++i) {
+            output[i] = cast(REBYTE, hash);
+            hash >>= 8;
+        }
+        return rebRepossess(output, 8);
+    }
     else if (0 == strcmp(method_name, "TCP")) {
         //
         // !!! This was an "Internet TCP 16-bit checksum" that was initially
@@ -320,6 +347,245 @@ REBNATIVE(checksum)
 }
 
 
+//=//// INCREMENTAL CHECKSUMS /////////////////////////////////////////////=//
+//
+// CHECKSUM needs all of its data in one BINARY!, which means reading a whole
+// file into memory to hash it.  CHECKSUM-START returns a HANDLE! holding the
+// state of a hash in progress, CHECKSUM-UPDATE feeds it data a piece at a
+// time, and CHECKSUM-FINISH gives the same result CHECKSUM would have for
+// all the pieces together.  CHECKSUM-FILE (in %ext-crypt-init.reb) uses these
+// to hash a file in constant memory by reading it in chunks.
+//
+// The mbedTLS digests are all incremental, and so are the CRCs and Adler-32
+// (they take the sum so far as their first argument).  HASH64 and TCP aren't,
+// so they're only available through CHECKSUM.
+//
+
+enum Checksum_Kind {
+    CHECKSUM_MD,  // any of the mbedTLS digests, possibly with an HMAC key
+    CHECKSUM_CRC32,
+    CHECKSUM_CRC32C,
+    CHECKSUM_ADLER32
+};
+
+struct Checksum_Context {
+    enum Checksum_Kind kind;
+    bool hmac;
+    bool finished;  // mbedTLS contexts can't be updated after finishing
+    uint32_t sum;  // running CRC or Adler-32 if not CHECKSUM_MD
+    struct mbedtls_md_context_t md;
+};
+
+static void cleanup_checksum_ctx(const REBVAL *v)
+{
+    struct Checksum_Context *ctx
+        = VAL_HANDLE_POINTER(struct Checksum_Context, v);
+    mbedtls_md_free(&ctx->md);  // fine to call if never set up
+    FREE(struct Checksum_Context, ctx);
+}
+
+// Give back the context in a CHECKSUM-START handle, or fail if it isn't one
+// or it's already been finished.
+//
+static struct Checksum_Context *Checksum_Context_From_Handle(
+    const REBVAL *handle
+){
+    if (VAL_HANDLE_CLEANER(handle) != cleanup_checksum_ctx)
+        rebJumps ("fail [{Not a CHECKSUM-START context:}", handle, "]");
+
+    struct Checksum_Context *ctx
+        = VAL_HANDLE_POINTER(struct Checksum_Context, handle);
+    if (ctx->finished)
+        rebJumps ("fail {CHECKSUM-FINISH was already called on context}");
+
+    return ctx;
+}
+
+
+//
+//  export checksum-start: native [
+//
+//  "Begin a checksum or hash whose data is given a piece at a time"
+//
+//      return: "Context for CHECKSUM-UPDATE and CHECKSUM-FINISH"
+//          [handle!]
+//      method "Any CHECKSUM method except HASH64 and TCP (e.g. SHA256)"
+//          [word!]
+//      /key "Compute a keyed HMAC value"
+//          [binary! text!]
+//  ]
+//
+REBNATIVE(checksum_start)
+{
+    CRYPT_INCLUDE_PARAMS_OF_CHECKSUM_START;
+
+    char *method_name = rebSpell("uppercase to text!", ARG(method));
+
+    enum Checksum_Kind kind;
+    const mbedtls_md_info_t *info = mbedtls_md_info_from_string(method_name);
+    if (info)
+        kind = CHECKSUM_MD;
+    else if (0 == strcmp(method_name, "CRC32"))
+        kind = CHECKSUM_CRC32;
+    else if (0 == strcmp(method_name, "CRC32C"))
+        kind = CHECKSUM_CRC32C;
+    else if (0 == strcmp(method_name, "ADLER32"))
+        kind = CHECKSUM_ADLER32;
+    else {
+        rebFree(method_name);
+        rebJumps (
+            "fail [{No incremental CHECKSUM method:}", ARG(method), "]"
+        );
+    }
+    rebFree(method_name);
+
+    if (kind != CHECKSUM_MD and REF(key))
+        rebJumps (
+            "fail [{Method does not support HMAC keying:}", ARG(method), "]"
+        );
+
+    struct Checksum_Context *ctx = TRY_ALLOC(struct Checksum_Context);
+    ctx->kind = kind;
+    ctx->hmac = did REF(key);
+    ctx->finished = false;
+    ctx->sum = (kind == CHECKSUM_ADLER32) ? 1 : 0;  // 1 (!), see CHECKSUM
+    mbedtls_md_init(&ctx->md);
+
+    // Make the handle before the mbedTLS setup, so a failure there leaves the
+    // context for the GC to clean up instead of leaking it.
+    //
+    Init_Handle_Cdata_Managed(
+        D_OUT,
+        ctx,
+        sizeof(struct Checksum_Context),
+        &cleanup_checksum_ctx
+    );
+
+    if (kind == CHECKSUM_MD) {
+        REBVAL *error = nullptr;
+
+        IF_NOT_0(cleanup, error, mbedtls_md_setup(&ctx->md, info, ctx->hmac));
+        if (ctx->hmac) {
+            REBSIZ key_size;
+            const REBYTE *key_bytes = VAL_BYTES_AT(&key_size, ARG(key));
+            IF_NOT_0(cleanup, error,
+                mbedtls_md_hmac_starts(&ctx->md, key_bytes, key_size)
+            );
+        }
+        else
+            IF_NOT_0(cleanup, error, mbedtls_md_starts(&ctx->md));
+
+      cleanup:
+        if (error)
+            rebJumps ("fail", error);
+    }
+
+    return D_OUT;
+}
+
+
+//
+//  export checksum-update: native [
+//
+//  "Add data to a checksum begun with CHECKSUM-START"
+//
+//      return: "The same context"
+//          [handle!]
+//      ctx [handle!]
+//      data "Data to digest (TEXT! is interpreted as UTF-8 bytes)"
+//          [binary! text!]
+//      /part "Length of data to use, default is current index to series end"
+//          [any-value!]
+//  ]
+//
+REBNATIVE(checksum_update)
+{
+    CRYPT_INCLUDE_PARAMS_OF_CHECKSUM_UPDATE;
+
+    struct Checksum_Context *ctx = Checksum_Context_From_Handle(ARG(ctx));
+
+    REBLEN len = Part_Len_May_Modify_Index(ARG(data), ARG(part));
+
+    REBSIZ size;
+    const REBYTE *data = VAL_BYTES_LIMIT_AT(&size, ARG(data), len);
+
+    REBVAL *error = nullptr;
+
+    switch (ctx->kind) {
+      case CHECKSUM_MD:
+        if (ctx->hmac)
+            IF_NOT_0(cleanup, error,
+                mbedtls_md_hmac_update(&ctx->md, data, size)
+            );
+        else
+            IF_NOT_0(cleanup, error, mbedtls_md_update(&ctx->md, data, size));
+        break;
+
+      case CHECKSUM_CRC32:
+        ctx->sum = Checksum_CRC32(ctx->sum, data, size);
+        break;
+
+      case CHECKSUM_CRC32C:
+        ctx->sum = Checksum_CRC32C(ctx->sum, data, size);
+        break;
+
+      case CHECKSUM_ADLER32:
+        ctx->sum = Checksum_Adler32(ctx->sum, data, size);
+        break;
+    }
+
+  cleanup:
+    if (error)
+        rebJumps ("fail", error);
+
+    RETURN (ARG(ctx));
+}
+
+
+//
+//  export checksum-finish: native [
+//
+//  "Get the result of a checksum begun with CHECKSUM-START"
+//
+//      return: "Same as CHECKSUM of all the data given to CHECKSUM-UPDATE"
+//          [binary!]
+//      ctx "Can't be updated or finished again afterward"
+//          [handle!]
+//  ]
+//
+REBNATIVE(checksum_finish)
+{
+    CRYPT_INCLUDE_PARAMS_OF_CHECKSUM_FINISH;
+
+    struct Checksum_Context *ctx = Checksum_Context_From_Handle(ARG(ctx));
+    ctx->finished = true;
+
+    if (ctx->kind != CHECKSUM_MD) {  // same as CHECKSUM for these methods
+        Init_Integer(D_SPARE, ctx->sum);
+        return rebValue("enbin [le + 4]", D_SPARE);
+    }
+
+    unsigned char md_size = mbedtls_md_get_size(ctx->md.md_info);
+    REBYTE *output = rebAllocN(REBYTE, md_size);
+
+    REBVAL *error = nullptr;
+
+    if (ctx->hmac)
+        IF_NOT_0(cleanup, error, mbedtls_md_hmac_finish(&ctx->md, output));
+    else
+        IF_NOT_0(cleanup, error, mbedtls_md_finish(&ctx->md, output));
+
+  cleanup:
+    mbedtls_md_free(&ctx->md);  // context is done, don't wait on the GC
+    if (error) {
+        rebFree(output);
+        rebJumps ("fail", error);
+    }
+
+    return rebRepossess(output, md_size);
+}
+
+
 //=//// INDIVIDUAL CRYPTO NATIVES /////////////////////////////////////////=//
 //
 // These natives are the hodgepodge of choices that implemented "enough TLS"
@@ -1058,6 +1324,564 @@ REBNATIVE(aes_stream)
 }
 
 
+//=//// WHOLE-BUFFER CIPHERS (SEE %aead.c) ////////////////////////////////=//
+//
+// Unlike AES-KEY and AES-STREAM, these take all the data in one call, with
+// no context handle, and no padding to the block size.  That lets the work
+// be done a few blocks at a time with AES-NI and PCLMULQDQ where the CPU has
+// them, which Startup_Aead() checks for in INIT-CRYPTO.
+//
+// The AEAD methods put the 16-byte tag after the ciphertext, as TLS records
+// and most libraries' "combined" modes do.  AEAD-DECRYPT checks the tag, and
+// gives back null without any of the output if it doesn't match.
+//
+
+static REBVAL *Aead_Crypt(
+    const REBVAL *method,
+    const REBVAL *key,
+    const REBVAL *nonce,
+    const REBVAL *data,
+    const REBVAL *aad,  // nullptr if no /AAD
+    bool decrypt
+){
+    bool gcm;
+    if (rebDid("'aes-gcm = @", method))
+        gcm = true;
+    else if (rebDid("'chacha20-poly1305 = @", method))
+        gcm = false;
+    else
+        rebJumps ("fail [{Unknown AEAD method:} @", method, "]");
+
+    REBSIZ key_size;
+    const REBYTE *key_bytes = VAL_BINARY_SIZE_AT(&key_size, key);
+    if (
+        gcm ? (key_size != 16 and key_size != 24 and key_size != 32)
+            : key_size != 32
+    ){
+        rebJumps (
+            "fail [{Key for} @", method, "{can't be}", rebI(key_size),
+                "{bytes}]"
+        );
+    }
+
+    REBSIZ nonce_size;
+    const REBYTE *nonce_bytes = VAL_BINARY_SIZE_AT(&nonce_size, nonce);
+    if (nonce_size != AEAD_NONCE_SIZE)
+        rebJumps (
+            "fail [{AEAD nonce must be}", rebI(AEAD_NONCE_SIZE), "{bytes}]"
+        );
+
+    REBSIZ aad_size = 0;
+    const REBYTE *aad_bytes = nullptr;
+    if (aad)
+        aad_bytes = VAL_BINARY_SIZE_AT(&aad_size, aad);
+
+    REBSIZ size;
+    const REBYTE *in = VAL_BINARY_SIZE_AT(&size, data);
+
+    if (decrypt) {
+        if (size < AEAD_TAG_SIZE)
+            return nullptr;  // there's no tag, so it can't be authentic
+        size -= AEAD_TAG_SIZE;  // the tag sent is at `in + size`
+    }
+
+    REBYTE *out = rebAllocN(REBYTE, size + AEAD_TAG_SIZE);
+    REBYTE *tag = out + size;  // the tag computed
+
+    if (gcm) {
+        bool ok = Aes_Gcm_Crypt(
+            out, tag, key_bytes, key_size, nonce_bytes,
+            aad_bytes, aad_size, in, size, decrypt
+        );
+        assert(ok);  // key size was checked
+        UNUSED(ok);
+    }
+    else
+        Chacha20_Poly1305_Crypt(
+            out, tag, key_bytes, nonce_bytes,
+            aad_bytes, aad_size, in, size, decrypt
+        );
+
+    if (decrypt) {
+        if (not Aead_Tags_Equal(tag, in + size)) {
+            memset(out, 0, size);  // don't leave unauthenticated plaintext
+            rebFree(out);
+            return nullptr;
+        }
+        return rebRepossess(out, size);
+    }
+
+    return rebRepossess(out, size + AEAD_TAG_SIZE);
+}
+
+
+//
+//  export aead-encrypt: native [
+//
+//  "Encrypt and authenticate data with AES-GCM or ChaCha20-Poly1305"
+//
+//      return: "Encrypted data, followed by the 16-byte authentication tag"
+//          [binary!]
+//      method "AES-GCM (16, 24, or 32-byte key) or CHACHA20-POLY1305 (32)"
+//          [word!]
+//      key [binary!]
+//      nonce "12 bytes, which must never be used twice with the same key"
+//          [binary!]
+//      data [binary!]
+//      /aad "Additional data to authenticate, but not encrypt"
+//          [binary!]
+//  ]
+//
+REBNATIVE(aead_encrypt)
+{
+    CRYPT_INCLUDE_PARAMS_OF_AEAD_ENCRYPT;
+
+    return Aead_Crypt(
+        ARG(method), ARG(key), ARG(nonce), ARG(data), REF(aad), false
+    );
+}
+
+
+//
+//  export aead-decrypt: native [
+//
+//  "Check and decrypt data from AEAD-ENCRYPT (null if it was tampered with)"
+//
+//      return: "Decrypted data, or null if the tag doesn't match"
+//          [<opt> binary!]
+//      method "AES-GCM or CHACHA20-POLY1305"
+//          [word!]
+//      key [binary!]
+//      nonce "The nonce it was encrypted with"
+//          [binary!]
+//      data "Encrypted data, followed by the 16-byte authentication tag"
+//          [binary!]
+//      /aad "Additional data it was authenticated with"
+//          [binary!]
+//  ]
+//
+REBNATIVE(aead_decrypt)
+{
+    CRYPT_INCLUDE_PARAMS_OF_AEAD_DECRYPT;
+
+    return Aead_Crypt(
+        ARG(method), ARG(key), ARG(nonce), ARG(data), REF(aad), true
+    );
+}
+
+
+//
+//  export aes-ctr: native [
+//
+//  "Encrypt or decrypt data with AES in counter mode (the same operation)"
+//
+//      return: [binary!]
+//      key "16, 24, or 32 bytes"
+//          [binary!]
+//      iv "16-byte first counter block, never to be reused with the same key"
+//          [binary!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(aes_ctr)
+{
+    CRYPT_INCLUDE_PARAMS_OF_AES_CTR;
+
+    REBSIZ key_size;
+    const REBYTE *key = VAL_BINARY_SIZE_AT(&key_size, ARG(key));
+
+    REBSIZ iv_size;
+    const REBYTE *iv = VAL_BINARY_SIZE_AT(&iv_size, ARG(iv));
+    if (iv_size != AES_CTR_IV_SIZE)
+        rebJumps (
+            "fail [{AES-CTR iv must be}", rebI(AES_CTR_IV_SIZE), "{bytes}]"
+        );
+
+    REBSIZ size;
+    const REBYTE *in = VAL_BINARY_SIZE_AT(&size, ARG(data));
+
+    REBYTE *out = rebAllocN(REBYTE, size);
+    if (not Aes_Ctr_Crypt(out, key, key_size, iv, in, size)) {
+        rebFree(out);
+        rebJumps (
+            "fail [{AES bits must be [128 192 256], not}",
+                rebI(key_size * 8), "]"
+        );
+    }
+
+    return rebRepossess(out, size);
+}
+
+
+//=//// TLS RECORD PROTECTION /////////////////////////////////////////////=//
+//
+// These do the per-record work of %prot-tls.r's CBC cipher suites in one
+// call each: the MAC, padding, and encryption of RFC 5246 6.2.3.2 (or the
+// reverse, with the checks).  The AES key is expanded once per direction
+// instead of per record, and the rounds use Aes_Cbc_Crypt() so they get AES-NI
+// when the CPU has it.  The session policy (handshake, which keys, sequence
+// numbers) stays in usermode.
+//
+// TLS 1.0 chains the CBC from record to record, starting from an IV in the
+// key block.  TLS 1.1 and up send a random IV at the front of each record.
+//
+
+#define TLS_MAX_PLAINTEXT 16384  // 2^14, RFC 5246 6.2.1
+
+struct Tls_Record_State {
+    mbedtls_aes_context aes;
+    struct mbedtls_md_context_t md;  // set up with the HMAC key
+    bool decrypt;  // key schedule is for decrypting (TLS-RECORD-KEY/DECRYPT)
+    bool implicit_iv;  // TLS 1.0
+    REBYTE iv[16];  // CBC residue of the last record, if implicit_iv
+};
+
+static void cleanup_tls_record_state(const REBVAL *v)
+{
+    struct Tls_Record_State *state
+        = VAL_HANDLE_POINTER(struct Tls_Record_State, v);
+    mbedtls_aes_free(&state->aes);
+    mbedtls_md_free(&state->md);
+    mbedtls_platform_zeroize(state->iv, sizeof(state->iv));
+    FREE(struct Tls_Record_State, state);
+}
+
+static struct Tls_Record_State *Tls_Record_State_From_Handle(
+    const REBVAL *handle,
+    bool decrypt
+){
+    if (VAL_HANDLE_CLEANER(handle) != cleanup_tls_record_state)
+        rebJumps ("fail [{Not a TLS-RECORD-KEY context:}", handle, "]");
+
+    struct Tls_Record_State *state
+        = VAL_HANDLE_POINTER(struct Tls_Record_State, handle);
+    if (state->decrypt != decrypt)
+        rebJumps (decrypt
+            ? "fail {TLS-DECRYPT-RECORD needs TLS-RECORD-KEY/DECRYPT}"
+            : "fail {TLS-ENCRYPT-RECORD needs TLS-RECORD-KEY (no /DECRYPT)}"
+        );
+    return state;
+}
+
+// The MAC of a record covers its sequence number, type, version, and length
+// before the content (RFC 5246 6.2.3.1).
+//
+static int Tls_Record_Mac(
+    REBYTE *mac,
+    struct Tls_Record_State *state,
+    REBI64 seq,
+    REBYTE type,
+    const REBYTE *version,
+    const REBYTE *content,
+    REBSIZ size
+){
+    REBYTE header[13];
+    int i;
+    for (i = 7; i >= 0; --i) {
+        header[i] = cast(REBYTE, seq);
+        seq >>= 8;
+    }
+    header[8] = type;
+    header[9] = version[0];
+    header[10] = version[1];
+    header[11] = cast(REBYTE, size >> 8);
+    header[12] = cast(REBYTE, size);
+
+    int ret;
+    if ((ret = mbedtls_md_hmac_reset(&state->md)) != 0)
+        return ret;
+    if ((ret = mbedtls_md_hmac_update(&state->md, header, 13)) != 0)
+        return ret;
+    if ((ret = mbedtls_md_hmac_update(&state->md, content, size)) != 0)
+        return ret;
+    return mbedtls_md_hmac_finish(&state->md, mac);
+}
+
+// Get the 2-byte version of TLS-ENCRYPT-RECORD and TLS-DECRYPT-RECORD
+//
+static const REBYTE *Tls_Version_Bytes(const REBVAL *version)
+{
+    REBSIZ size;
+    const REBYTE *bytes = VAL_BINARY_SIZE_AT(&size, version);
+    if (size != 2)
+        rebJumps ("fail [{TLS version must be 2 bytes, not}", version, "]");
+    return bytes;
+}
+
+
+//
+//  export tls-record-key: native [
+//
+//  "Make the state for protecting TLS records sent in one direction"
+//
+//      return: "Context for TLS-ENCRYPT-RECORD or TLS-DECRYPT-RECORD"
+//          [handle!]
+//      mac-method "Hash of the HMAC (e.g. SHA256)"
+//          [word!]
+//      mac-key [binary!]
+//      crypt-key "16, 24, or 32-byte AES key (used in CBC mode)"
+//          [binary!]
+//      iv "TLS 1.0's IV from the key block, BLANK! if records carry their own"
+//          [binary! blank!]
+//      /decrypt "Make the context for TLS-DECRYPT-RECORD"
+//  ]
+//
+REBNATIVE(tls_record_key)
+{
+    CRYPT_INCLUDE_PARAMS_OF_TLS_RECORD_KEY;
+
+    char *method_name = rebSpell("uppercase to text!", ARG(mac_method));
+    const mbedtls_md_info_t *info = mbedtls_md_info_from_string(method_name);
+    rebFree(method_name);
+    if (not info)
+        rebJumps ("fail [{Unknown TLS MAC method:}", ARG(mac_method), "]");
+
+    REBSIZ key_size;
+    const REBYTE *key = VAL_BINARY_SIZE_AT(&key_size, ARG(crypt_key));
+    if (key_size != 16 and key_size != 24 and key_size != 32)
+        rebJumps (
+            "fail [{AES bits must be [128 192 256], not}",
+                rebI(key_size * 8), "]"
+        );
+
+    struct Tls_Record_State *state = TRY_ALLOC(struct Tls_Record_State);
+    mbedtls_aes_init(&state->aes);
+    mbedtls_md_init(&state->md);
+    state->decrypt = did REF(decrypt);
+    state->implicit_iv = IS_BINARY(ARG(iv));
+    memset(state->iv, 0, sizeof(state->iv));
+
+    Init_Handle_Cdata_Managed(  // GC cleans up if a failure happens below
+        D_OUT,
+        state,
+        sizeof(struct Tls_Record_State),
+        &cleanup_tls_record_state
+    );
+
+    if (state->implicit_iv) {
+        REBSIZ iv_size;
+        const REBYTE *iv = VAL_BINARY_SIZE_AT(&iv_size, ARG(iv));
+        if (iv_size != sizeof(state->iv))
+            rebJumps ("fail {TLS-RECORD-KEY iv must be 16 bytes}");
+        memcpy(state->iv, iv, sizeof(state->iv));
+    }
+
+    REBSIZ mac_key_size;
+    const REBYTE *mac_key = VAL_BINARY_SIZE_AT(&mac_key_size, ARG(mac_key));
+
+    REBVAL *error = nullptr;
+
+    if (state->decrypt)
+        IF_NOT_0(cleanup, error,
+            mbedtls_aes_setkey_dec(&state->aes, key, key_size * 8)
+        );
+    else
+        IF_NOT_0(cleanup, error,
+            mbedtls_aes_setkey_enc(&state->aes, key, key_size * 8)
+        );
+
+    IF_NOT_0(cleanup, error, mbedtls_md_setup(&state->md, info, 1));
+    IF_NOT_0(cleanup, error,
+        mbedtls_md_hmac_starts(&state->md, mac_key, mac_key_size)
+    );
+
+  cleanup:
+    if (error)
+        rebJumps ("fail", error);
+
+    return D_OUT;
+}
+
+
+//
+//  export tls-encrypt-record: native [
+//
+//  "Make a whole TLS record (header included) of MAC'd and encrypted content"
+//
+//      return: [binary!]
+//      ctx "From TLS-RECORD-KEY (without /DECRYPT)"
+//          [handle!]
+//      type "Content type (e.g. 23 for application data)"
+//          [integer!]
+//      version "Record version (e.g. #{03 03} for TLS 1.2)"
+//          [binary!]
+//      seq "Sequence number of the record"
+//          [integer!]
+//      content "At most 16384 bytes"
+//          [binary!]
+//  ]
+//
+REBNATIVE(tls_encrypt_record)
+{
+    CRYPT_INCLUDE_PARAMS_OF_TLS_ENCRYPT_RECORD;
+
+    struct Tls_Record_State *state = Tls_Record_State_From_Handle(
+        ARG(ctx), false
+    );
+    REBYTE type = VAL_UINT8(ARG(type));
+    const REBYTE *version = Tls_Version_Bytes(ARG(version));
+    REBI64 seq = VAL_INT64(ARG(seq));
+
+    REBSIZ size;
+    const REBYTE *content = VAL_BINARY_SIZE_AT(&size, ARG(content));
+    if (size > TLS_MAX_PLAINTEXT)
+        rebJumps (
+            "fail [{TLS record content can't exceed}",
+                rebI(TLS_MAX_PLAINTEXT), "{bytes}]"
+        );
+
+    REBSIZ mac_size = mbedtls_md_get_size(state->md.md_info);
+
+    // At least one byte of padding, which gives the count of the others, and
+    // each padding byte holds that count.
+    //
+    REBSIZ pad_size = 16 - ((size + mac_size) % 16);
+    REBSIZ encrypted_size = size + mac_size + pad_size;
+    REBSIZ iv_size = state->implicit_iv ? 0 : 16;
+    REBSIZ fragment_size = iv_size + encrypted_size;
+
+    REBYTE *record = rebAllocN(REBYTE, 5 + fragment_size);
+    record[0] = type;
+    record[1] = version[0];
+    record[2] = version[1];
+    record[3] = cast(REBYTE, fragment_size >> 8);
+    record[4] = cast(REBYTE, fragment_size);
+
+    REBYTE *p = record + 5;
+    REBYTE iv[16];
+    if (not state->implicit_iv) {
+        get_random(nullptr, iv, 16);  // "MUST be unpredictable"
+        memcpy(p, iv, 16);
+        p += 16;
+    }
+
+    memcpy(p, content, size);
+
+    REBVAL *error = nullptr;
+    IF_NOT_0(cleanup, error,
+        Tls_Record_Mac(p + size, state, seq, type, version, content, size)
+    );
+    memset(p + size + mac_size, cast(int, pad_size - 1), pad_size);
+
+    Aes_Cbc_Crypt(
+        &state->aes,
+        state->implicit_iv ? state->iv : iv,
+        p,
+        p,
+        encrypted_size,
+        false
+    );
+
+  cleanup:
+    mbedtls_platform_zeroize(iv, sizeof(iv));
+    if (error) {
+        rebFree(record);
+        rebJumps ("fail", error);
+    }
+
+    return rebRepossess(record, 5 + fragment_size);
+}
+
+
+//
+//  export tls-decrypt-record: native [
+//
+//  "Decrypt the fragment of a TLS record, checking its padding and MAC"
+//
+//      return: "The content, or null if the record was corrupt or tampered"
+//          [<opt> binary!]
+//      ctx "From TLS-RECORD-KEY/DECRYPT"
+//          [handle!]
+//      type "Content type from the record header"
+//          [integer!]
+//      version "Version the MAC was made with (e.g. #{03 03} for TLS 1.2)"
+//          [binary!]
+//      seq "Sequence number of the record"
+//          [integer!]
+//      fragment "The record's data after its 5-byte header"
+//          [binary!]
+//  ]
+//
+REBNATIVE(tls_decrypt_record)
+//
+// !!! All of the failures give back the same null, and the MAC is computed
+// even when the padding is bad (as RFC 5246 6.2.3.2 asks).  But how long that
+// takes still depends on the padding length, which the "Lucky Thirteen"
+// attack can measure; mbedTLS's %ssl_msg.c does extra hashing to even it out.
+{
+    CRYPT_INCLUDE_PARAMS_OF_TLS_DECRYPT_RECORD;
+
+    struct Tls_Record_State *state = Tls_Record_State_From_Handle(
+        ARG(ctx), true
+    );
+    REBYTE type = VAL_UINT8(ARG(type));
+    const REBYTE *version = Tls_Version_Bytes(ARG(version));
+    REBI64 seq = VAL_INT64(ARG(seq));
+
+    REBSIZ size;
+    const REBYTE *fragment = VAL_BINARY_SIZE_AT(&size, ARG(fragment));
+
+    REBSIZ mac_size = mbedtls_md_get_size(state->md.md_info);
+
+    REBYTE iv[16];
+    if (not state->implicit_iv) {
+        if (size < 16)
+            return nullptr;
+        memcpy(iv, fragment, 16);
+        fragment += 16;
+        size -= 16;
+    }
+
+    if (size % 16 != 0 or size < mac_size + 1)
+        return nullptr;
+
+    REBYTE *plain = rebAllocN(REBYTE, size);
+    Aes_Cbc_Crypt(
+        &state->aes,
+        state->implicit_iv ? state->iv : iv,
+        plain,
+        fragment,
+        size,
+        true
+    );
+
+    REBSIZ pad_size = plain[size - 1];
+    REBYTE bad = 0;
+    if (pad_size + 1 + mac_size > size) {
+        bad = 1;
+        pad_size = 0;
+    }
+    REBSIZ i;
+    for (i = 0; i < pad_size; ++i)
+        bad |= plain[size - 2 - i] ^ cast(REBYTE, pad_size);
+
+    REBSIZ content_size = size - mac_size - pad_size - 1;
+
+    REBYTE mac[MBEDTLS_MD_MAX_SIZE];
+    REBVAL *error = nullptr;
+    IF_NOT_0(cleanup, error,
+        Tls_Record_Mac(mac, state, seq, type, version, plain, content_size)
+    );
+
+    for (i = 0; i < mac_size; ++i)
+        bad |= mac[i] ^ plain[content_size + i];
+
+  cleanup:
+    mbedtls_platform_zeroize(iv, sizeof(iv));
+    mbedtls_platform_zeroize(mac, sizeof(mac));
+
+    if (error or bad) {
+        mbedtls_platform_zeroize(plain, size);
+        rebFree(plain);
+        if (error)
+            rebJumps ("fail", error);
+        return nullptr;
+    }
+
+    return rebRepossess(plain, content_size);
+}
+
+
 // For reasons that don't seem particularly good for a generic cryptography
 // library that is not entirely TLS-focused, the 25519 curve isn't in the
 // main list of curves:
@@ -1270,6 +2094,8 @@ REBNATIVE(init_crypto)
 {
     CRYPT_INCLUDE_PARAMS_OF_INIT_CRYPTO;
 
+    Startup_Aead();
+
   #ifdef TO_WINDOWS
     if (CryptAcquireContextW(
         &gCryptProv,
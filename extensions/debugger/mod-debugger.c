@@ -35,12 +35,45 @@
 // Note that RESUME/DO provides a loophole, where it's possible to run code
 // that performs a THROW or FAIL which is not trapped by the sandbox.
 //
+// Having the debugger loaded costs nothing when it isn't being used:
+//
+// * STEP installs a hook that runs on each evaluator step only until it
+//   breaks again, using the core's SIG_STEP.
+//
+// * SET-BREAKPOINT patches a cell of the code with a BREAKPOINT-TRAP action
+//   that holds the original cell, and runs it after the break.  So nothing
+//   has to check for breakpoints as code runs.
+//
 
 #include "sys-core.h"
 
 #include "tmp-mod-debugger.h"
 
 
+// What STEP asked for.  All steps are counted from where the code broke,
+// which is at the stack depth Break_Depth.
+//
+enum Reb_Step_Mode {
+    STEP_IN,  // break at the Nth next evaluator step, wherever it is
+    STEP_OVER,  // break at the next step that isn't deeper in the stack
+    STEP_OUT  // break at the next step that is shallower in the stack
+};
+
+static enum Reb_Step_Mode Step_Mode;
+static REBINT Steps_Left;
+static REBLEN Break_Depth;
+
+
+static REBLEN Frame_Depth(void)
+{
+    REBLEN depth = 0;
+    REBFRM *f = FS_TOP;
+    for (; f != FS_BOTTOM; f = f->prior)
+        ++depth;
+    return depth;
+}
+
+
 //
 //  Do_Breakpoint_Throws: C
 //
@@ -57,9 +90,15 @@ bool Do_Breakpoint_Throws(
     bool interrupted,  // Ctrl-C (as opposed to a BREAKPOINT)
     const REBVAL *paused
 ){
-    UNUSED(interrupted);  // !!! not passed to the REPL, should it be?
     UNUSED(paused);  // !!! feature TBD
 
+    // A STEP is counted from the code that broke, not from the BREAKPOINT
+    // (or PAUSE or BREAKPOINT-TRAP) native's frame.
+    //
+    Break_Depth = Frame_Depth();
+    if (not interrupted)
+        --Break_Depth;
+
     // !!! The unfinished SECURE extension would supposedly either be checked
     // here (or inject a check with HIJACK on BREAKPOINT) to make sure that
     // debugging was allowed.  Review doing that check here.
@@ -80,11 +119,9 @@ bool Do_Breakpoint_Throws(
     if (IS_HANDLE(inst)) {
         CFUNC *cfunc = VAL_HANDLE_CFUNC(inst);
         rebRelease(inst);
-        UNUSED(cfunc);
 
-        // !!! This used to hook the evaluator, with a hook that is no
-        // longer available.  Debugging is being reviewed in light of a
-        // stackless model and is non-functional at time of writing.
+        PG_Step_Hook = cast(STEP_HOOK*, cfunc);
+        SET_SIGNAL(SIG_STEP);  // stays set, so the hook runs every step
 
         Init_None(out);
         return false;  // no throw, run normally (but now, hooked)
@@ -104,6 +141,52 @@ bool Do_Breakpoint_Throws(
 }
 
 
+//
+//  Debug_Step_Hook: C
+//
+// Installed by STEP while the code runs until the step is done, see SIG_STEP.
+//
+static bool Debug_Step_Hook(REBVAL *out)
+{
+    switch (Step_Mode) {
+      case STEP_IN:
+        if (--Steps_Left > 0)
+            return false;
+        break;
+
+      case STEP_OVER:
+        if (Frame_Depth() > Break_Depth)
+            return false;
+        break;
+
+      case STEP_OUT:
+        if (Frame_Depth() >= Break_Depth)
+            return false;
+        break;
+    }
+
+    // Unhook before breaking, so the debug console's code isn't stepped.
+    // Another STEP in the console will hook again when it resumes.
+    //
+    PG_Step_Hook = nullptr;
+    CLR_SIGNAL(SIG_STEP);
+
+    DECLARE_LOCAL (result);  // out is the evaluator's output, don't disturb
+    SET_END(result);
+    PUSH_GC_GUARD(result);
+    bool threw = Do_Breakpoint_Throws(
+        result,
+        true,  // not from a BREAKPOINT native in the code
+        BLANK_VALUE
+    );
+    if (threw)
+        Copy_Cell(out, result);  // !!! RESUME/DO result can't be used here
+    DROP_GC_GUARD(result);
+
+    return threw;
+}
+
+
 //
 //  export breakpoint*: native [
 //
@@ -235,8 +318,83 @@ REBNATIVE(resume)
 //  ]
 //
 REBNATIVE(step)
+//
+// STEP is run in the debug console.  It ends the console's session the way
+// RESUME does, but throws a HANDLE! of the hook to install when resuming.
 {
     DEBUGGER_INCLUDE_PARAMS_OF_STEP;
-    UNUSED(ARG(amount));
-    fail ("STEP's methodology was deprecated, it is being re-implemented");
+
+    REBVAL *amount = ARG(amount);
+
+    Step_Mode = STEP_IN;
+    Steps_Left = 1;
+    if (IS_INTEGER(amount)) {
+        Steps_Left = VAL_INT32(amount);
+        if (Steps_Left < 1)
+            fail (PAR(amount));
+    }
+    else if (IS_WORD(amount)) {
+        if (rebDid("'over = @", amount))
+            Step_Mode = STEP_OVER;
+        else if (rebDid("'out = @", amount))
+            Step_Mode = STEP_OUT;
+        else if (not rebDid("'in = @", amount))
+            fail (PAR(amount));
+    }
+
+    DECLARE_LOCAL (hook);
+    Init_Handle_Cfunc(hook, cast(CFUNC*, &Debug_Step_Hook));
+
+    REBVAL *resume = rebValue(":lib/resume");
+    Init_Thrown_With_Label(D_OUT, hook, resume);
+    rebRelease(resume);
+
+    return R_THROWN;
+}
+
+
+//
+//  export breakpoint-trap: native [
+//
+//  {Break in the debugger, then run a cell that SET-BREAKPOINT patched over}
+//
+//      return: [<opt> <invisible> any-value!]
+//      original "Cell of the code replaced by this action (specialized in)"
+//          [<opt> any-value!]
+//      expressions "More code the original cell may take arguments from"
+//          [<opt> any-value! <variadic>]
+//  ]
+//
+REBNATIVE(breakpoint_trap)
+//
+// The original cell is run as REEVAL does, as if it were still in the code.
+{
+    DEBUGGER_INCLUDE_PARAMS_OF_BREAKPOINT_TRAP;
+
+    UNUSED(ARG(expressions));  // acts variadic, but frame's feed is used
+
+    if (Do_Breakpoint_Throws(
+        D_SPARE,
+        false,  // not a Ctrl-C, it's an actual breakpoint
+        BLANK_VALUE
+    )){
+        Move_Cell(D_OUT, D_SPARE);
+        return R_THROWN;
+    }
+
+    REBVAL *original = ARG(original);
+    bool enfix = (
+        IS_ACTION(original) and GET_ACTION_FLAG(VAL_ACTION(original), ENFIXED)
+    );
+
+    if (Reevaluate_In_Subframe_Maybe_Stale_Throws(
+        D_OUT,
+        frame_,
+        original,
+        EVAL_MASK_DEFAULT,
+        enfix
+    )){
+        return R_THROWN;
+    }
+    return D_OUT;  // don't clear stale flag...act invisibly if original does
 }
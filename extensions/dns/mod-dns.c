@@ -26,6 +26,9 @@
 // they do not have IPv6 equivalents...so applications that want asynchronous
 // lookup are expected to use their own threads and call getnameinfo().
 //
+// Forward lookups now do that, with the resolver threads and cache in the
+// network extension (%extensions/network/dns-resolve.c).
+//
 
 
 #ifdef TO_WINDOWS
@@ -50,6 +53,18 @@
 
 EXTERN_C REBDEV Dev_Net;
 
+// The resolver and its cache are in the network extension, for the sake of
+// OPEN on a TCP port with a host name (see %extensions/network/reb-net.h)
+//
+struct Reb_Dns_Job;
+EXTERN_C bool Dns_Cache_Find(const char *name, int *status, uint32_t *ip);
+EXTERN_C struct Reb_Dns_Job *Dns_Start(const char *name);
+EXTERN_C bool Dns_Done(struct Reb_Dns_Job *job);
+EXTERN_C int Dns_Finish(struct Reb_Dns_Job *job, uint32_t *ip);
+EXTERN_C bool Dns_Not_Found(int status);
+EXTERN_C void Dns_Abandon(struct Reb_Dns_Job *job);
+EXTERN_C REBVAL *Dns_Make_Error(const char *name, int status);
+
 //
 //  DNS_Actor: C
 //
@@ -112,6 +127,10 @@ static REB_R DNS_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
                 fail ("Reverse DNS lookup requires length 4 TUPLE!");
 
             // 93.184.216.34 => example.com
+            //
+            // !!! Unlike forward lookups this still blocks, and can't be
+            // cached by name.  It's much rarer, but could use the same jobs.
+            //
             char buf[MAX_TUPLE];
             Get_Tuple_Bytes(buf, host, 4);
             HOSTENT *he = gethostbyaddr(buf, 4, AF_INET);
@@ -136,13 +155,39 @@ static REB_R DNS_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
             char *name = rebSpell(host);
 
             // example.com => 93.184.216.34
-            HOSTENT *he = gethostbyname(name);
+            //
+            // A name that isn't cached is looked up by a resolver thread.
+            // READ has to give back the answer, so WAIT in the meantime...
+            // that way at least the other ports keep being serviced.
+            //
+            int status;
+            uint32_t ip;
+            if (not Dns_Cache_Find(name, &status, &ip)) {
+                struct Reb_Dns_Job *job = Dns_Start(name);
+                while (not Dns_Done(job)) {
+                    REBVAL *error = rebValue("trap [wait 0.01]");
+                    if (error) {
+                        Dns_Abandon(job);
+                        rebFree(name);
+                        rebJumps("fail", rebR(error));
+                    }
+                }
+                status = Dns_Finish(job, &ip);
+            }
 
-            rebFree(name);
-            if (he != nullptr)
-                return Init_Tuple_Bytes(D_OUT, cast(REBYTE*, *he->h_addr_list), 4);
+            if (status == 0) {
+                rebFree(name);
+                return Init_Tuple_Bytes(D_OUT, cast(REBYTE*, &ip), 4);
+            }
 
-            // ...else fall through to error handling...
+            if (Dns_Not_Found(status)) {
+                rebFree(name);
+                return Init_Nulled(D_OUT);  // "expected" failure, as below
+            }
+
+            REBVAL *error = Dns_Make_Error(name, status);
+            rebFree(name);
+            rebJumps("fail", rebR(error));
         }
         else
             fail (Error_On_Port(SYM_INVALID_SPEC, port, -10));
@@ -0,0 +1,615 @@
+//
+//  File: %channels.c
+//  Summary: "Channels that pass values between interpreters (isolates)"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A channel is a queue of messages that any number of interpreters can send
+// to, and one of them receives from.  Channels are found by name, so the
+// isolates on different threads of a USE_THREAD_ISOLATES build can meet on
+// one without having to pass anything between them first.
+//
+// * Sending doesn't lock or wait.  The queue is Dmitry Vyukov's "intrusive
+//   MPSC" queue: a sender swaps its message in as the newest with an atomic
+//   exchange, and then links the one it replaced to it.  The receiver walks
+//   those links from the oldest.
+//
+// * A port given to LISTEN-CHANNEL gets a READ event in WAIT whenever there
+//   are messages waiting, like SET-TIMER gives one a TIME event.  When the
+//   queue goes from empty to not, the sender also writes a byte to a pipe
+//   that the receiver's WAIT is watching (see OS_Watch_Request()), so it
+//   wakes up right away instead of on its next tick.
+//
+// A value made by SHARE is passed by reference: its series are in a region
+// that belongs to no isolate (see %m-shared.c), and the message carries a
+// reference on the region for the receiver to take over.
+//
+// Otherwise a message can't point at a sender's series--not even a frozen
+// one, since each isolate has its own nodes and the sender's GC would free
+// it when it was done with it.  So a message is a copy, made into malloc()
+// memory (which belongs to no isolate) when it is sent:
+//
+// * BINARY! and ANY-STRING! are copied as their bytes, from their position.
+//
+// * Anything else is MOLD/ALL'd, and TRANSCODE'd back by RECEIVE-CHANNEL.
+//   So words arrive unbound, and only values that mold loadably round trip.
+//
+// A value that was frozen deeply (see FREEZE) arrives frozen, so it can be
+// shared between the receiver's own actors without copying it again.
+//
+
+#if !defined(TO_WINDOWS)
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+#include "sys-core.h"
+
+#include "reb-event.h"
+
+
+struct Reb_Message;  // a value in a channel's queue, see below
+
+// Without USE_THREAD_ISOLATES there is only one interpreter, so senders and
+// the receiver are all on its thread and plain loads and stores will do.
+//
+// !!! The atomics are the GCC/Clang builtins, as in %c-word.c, so isolate
+// builds with MSVC would need the Interlocked functions here.
+//
+#if defined(USE_THREAD_ISOLATES)
+    #define EXCHANGE(lvalue,v) \
+        __atomic_exchange_n(&(lvalue), (v), __ATOMIC_ACQ_REL)
+    #define FETCH_ADD(lvalue,n) \
+        __atomic_fetch_add(&(lvalue), (n), __ATOMIC_ACQ_REL)
+    #define LOAD_ACQUIRE(lvalue) \
+        __atomic_load_n(&(lvalue), __ATOMIC_ACQUIRE)
+    #define STORE_RELEASE(lvalue,v) \
+        __atomic_store_n(&(lvalue), (v), __ATOMIC_RELEASE)
+
+    inline static bool Claim(void **lvalue, void *v) {  // if null, or is `v`
+        void *expected = nullptr;
+        return __atomic_compare_exchange_n(
+            lvalue, &expected, v, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE
+        ) or expected == v;
+    }
+
+    // Only OPEN-CHANNEL and a channel handle's GC take this, so a spinlock
+    // is fine (and doesn't need pthreads linked in).
+    //
+    static char Channels_Lock;
+    #define LOCK_CHANNELS() \
+        while (__atomic_test_and_set(&Channels_Lock, __ATOMIC_ACQUIRE)) {}
+    #define UNLOCK_CHANNELS() \
+        __atomic_clear(&Channels_Lock, __ATOMIC_RELEASE)
+
+    #if !defined(TO_WINDOWS)
+        #define HAS_WAKE_PIPE  // Windows WAIT just sees messages on its tick
+    #endif
+#else
+    #define EXCHANGE(lvalue,v) \
+        Exchange_Message(&(lvalue), (v))
+    #define FETCH_ADD(lvalue,n) \
+        (((lvalue) += (n)) - (n))
+    #define LOAD_ACQUIRE(lvalue) (lvalue)
+    #define STORE_RELEASE(lvalue,v) ((lvalue) = (v))
+
+    inline static struct Reb_Message *Exchange_Message(
+        struct Reb_Message **lvalue,
+        struct Reb_Message *v
+    ){
+        struct Reb_Message *old = *lvalue;
+        *lvalue = v;
+        return old;
+    }
+
+    inline static bool Claim(void **lvalue, void *v) {
+        if (*lvalue == nullptr)
+            *lvalue = v;
+        return *lvalue == v;
+    }
+
+    #define LOCK_CHANNELS() NOOP
+    #define UNLOCK_CHANNELS() NOOP
+#endif
+
+
+struct Reb_Message {
+    struct Reb_Message *next;  // the next newer message, nullptr if newest
+    enum Reb_Kind kind;  // REB_BINARY or ANY-STRING!, REB_0 if it was molded
+    bool frozen;
+    size_t size;
+    REBYTE *data;  // malloc()'d, freed along with the message
+
+    struct Reb_Shared_Region *region;  // if not nullptr, `shared` is the value
+    RELVAL shared;
+};
+
+struct Reb_Channel {
+    struct Reb_Channel *next;  // in the list of all channels, see Channels
+    char *name;  // malloc()'d UTF-8
+    size_t name_size;
+    uintptr_t refcount;  // channel handles in all isolates, under the lock
+
+    struct Reb_Message *newest;  // swapped in by the senders
+    struct Reb_Message *oldest;  // receiver's, always an already-taken one
+    intptr_t count;  // sent and not taken (may dip to -1, see Send_Message)
+
+    void *receiver;  // Isolate_Tag of the isolate that may receive
+    int wake_fds[2];  // byte written to [1] when `count` goes up from 0
+};
+
+static struct Reb_Channel *Channels;  // process-wide (not ISOLATE_LOCAL)
+
+
+// A channel handle, one for each OPEN-CHANNEL.  Its cleaner lets go of the
+// channel, so one that no isolate has a handle to anymore is freed.
+//
+struct Reb_Channel_Ref {
+    struct Reb_Channel *channel;
+    bool claimed;  // this handle made its isolate the channel's receiver
+};
+
+// Ports being sent READ events, see LISTEN-CHANNEL.  The API handles keep
+// the channel handle and port alive, so unlistening is up to this code.
+//
+struct Reb_Listener {
+    struct Reb_Listener *next;
+    REBVAL *channel;  // unmanaged API handle of the HANDLE!
+    REBVAL *port;  // unmanaged API handle
+    REBREQ *watch;  // watches the channel's wake pipe, nullptr if none
+};
+
+static ISOLATE_LOCAL struct Reb_Listener *Listeners;
+
+static ISOLATE_LOCAL char Isolate_Tag;  // its address stands for the isolate
+
+
+static void Free_Message(struct Reb_Message *m)
+{
+    if (m->region)
+        Release_Shared_Region(m->region);
+    free(m->data);
+    free(m);
+}
+
+
+static void Free_Channel(struct Reb_Channel *c)
+{
+    struct Reb_Message *m = c->oldest;
+    while (m != nullptr) {
+        struct Reb_Message *next = m->next;
+        Free_Message(m);
+        m = next;
+    }
+
+  #if defined(HAS_WAKE_PIPE)
+    close(c->wake_fds[0]);
+    close(c->wake_fds[1]);
+  #endif
+
+    free(c->name);
+    free(c);
+}
+
+
+static void Cleanup_Channel_Ref(const REBVAL *v)
+{
+    struct Reb_Channel_Ref *ref = VAL_HANDLE_POINTER(
+        struct Reb_Channel_Ref, v
+    );
+    struct Reb_Channel *c = ref->channel;
+
+    if (ref->claimed)  // another isolate may receive now
+        STORE_RELEASE(c->receiver, cast(void*, nullptr));
+
+    LOCK_CHANNELS();
+    if (--c->refcount == 0) {
+        struct Reb_Channel **link = &Channels;
+        while (*link != c)
+            link = &(*link)->next;
+        *link = c->next;
+    }
+    else
+        c = nullptr;
+    UNLOCK_CHANNELS();
+
+    if (c != nullptr)
+        Free_Channel(c);
+    free(ref);
+}
+
+
+static struct Reb_Channel_Ref *Channel_Ref(const REBVAL *handle)
+{
+    if (VAL_HANDLE_CLEANER(handle) != &Cleanup_Channel_Ref)
+        fail ("HANDLE! is not a channel from OPEN-CHANNEL");
+    return VAL_HANDLE_POINTER(struct Reb_Channel_Ref, handle);
+}
+
+
+static void Claim_Receiving(struct Reb_Channel_Ref *ref)
+{
+    if (not Claim(&ref->channel->receiver, &Isolate_Tag))
+        fail ("Channel is being received from by another isolate");
+    ref->claimed = true;
+}
+
+
+static struct Reb_Channel *Make_Channel(const REBYTE *name, size_t size)
+{
+    struct Reb_Channel *c = cast(
+        struct Reb_Channel*, malloc(sizeof(struct Reb_Channel))
+    );
+    struct Reb_Message *taken = cast(
+        struct Reb_Message*, malloc(sizeof(struct Reb_Message))
+    );
+    char *name_copy = cast(char*, malloc(size + 1));
+    if (c == nullptr or taken == nullptr or name_copy == nullptr) {
+        free(c);
+        free(taken);
+        free(name_copy);
+        return nullptr;
+    }
+
+    taken->next = nullptr;
+    taken->data = nullptr;
+    taken->region = nullptr;
+
+    memcpy(name_copy, name, size);
+    name_copy[size] = '\0';
+    c->name = name_copy;
+    c->name_size = size;
+    c->refcount = 0;
+    c->newest = taken;
+    c->oldest = taken;
+    c->count = 0;
+    c->receiver = nullptr;
+
+  #if defined(HAS_WAKE_PIPE)
+    if (pipe(c->wake_fds) < 0) {
+        free(name_copy);
+        free(taken);
+        free(c);
+        return nullptr;
+    }
+
+    int i;
+    for (i = 0; i < 2; ++i) {  // a sender must never block on a full pipe
+        fcntl(c->wake_fds[i], F_SETFL, O_NONBLOCK);
+        fcntl(c->wake_fds[i], F_SETFD, FD_CLOEXEC);
+    }
+  #else
+    c->wake_fds[0] = c->wake_fds[1] = -1;
+  #endif
+
+    return c;
+}
+
+
+//
+//  Open_Channel: C
+//
+// Give back a HANDLE! for the channel called `name`, making the channel if
+// no isolate has it open yet.
+//
+REBVAL *Open_Channel(REBVAL *out, const REBVAL *name)
+{
+    REBSIZ size;
+    const REBYTE *utf8 = cast(const REBYTE*, VAL_UTF8_SIZE_AT(&size, name));
+
+    struct Reb_Channel_Ref *ref = cast(
+        struct Reb_Channel_Ref*, malloc(sizeof(struct Reb_Channel_Ref))
+    );
+    if (ref == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Channel_Ref)));
+
+    LOCK_CHANNELS();
+    struct Reb_Channel *c = Channels;
+    for (; c != nullptr; c = c->next) {
+        if (c->name_size == size and memcmp(c->name, utf8, size) == 0)
+            break;
+    }
+    if (c == nullptr) {
+        c = Make_Channel(utf8, size);
+        if (c != nullptr) {
+            c->next = Channels;
+            Channels = c;
+        }
+    }
+    if (c != nullptr)
+        ++c->refcount;
+    UNLOCK_CHANNELS();
+
+    if (c == nullptr) {
+        free(ref);
+        fail (Error_No_Memory(sizeof(struct Reb_Channel)));
+    }
+
+    ref->channel = c;
+    ref->claimed = false;
+    return Init_Handle_Cdata_Managed(
+        out, ref, sizeof(struct Reb_Channel_Ref), &Cleanup_Channel_Ref
+    );
+}
+
+
+static void Enqueue_Message(struct Reb_Channel *c, struct Reb_Message *m)
+{
+    // The receiver won't see `m` until it's linked from the message before.
+    // That's one store, but it isn't this sender's alone until the exchange.
+    //
+    struct Reb_Message *prev = EXCHANGE(c->newest, m);
+    STORE_RELEASE(prev->next, m);
+
+    // The count goes up after the link, so the receiver may take `m` first
+    // and bring it to -1.  No byte is written then, nor needs to be.
+    //
+    if (FETCH_ADD(c->count, 1) == 0 and c->wake_fds[1] != -1) {
+      #if defined(HAS_WAKE_PIPE)
+        char byte = 0;
+        if (write(c->wake_fds[1], &byte, 1) < 0)
+            assert(errno == EAGAIN);  // a full pipe is already readable
+      #endif
+    }
+}
+
+
+//
+//  Send_Message: C
+//
+void Send_Message(const REBVAL *channel, const REBVAL *v)
+{
+    struct Reb_Channel *c = Channel_Ref(channel)->channel;
+
+    if (Is_Value_Shared(v)) {
+        struct Reb_Message *m = cast(
+            struct Reb_Message*, malloc(sizeof(struct Reb_Message))
+        );
+        if (m == nullptr)
+            fail (Error_No_Memory(sizeof(struct Reb_Message)));
+
+        m->next = nullptr;
+        m->kind = REB_0;
+        m->frozen = true;
+        m->size = 0;
+        m->data = nullptr;
+        m->region = Acquire_Shared_Region(v);
+        Copy_Cell(Prep_Cell(&m->shared), v);
+
+        Enqueue_Message(c, m);
+        return;
+    }
+
+    enum Reb_Kind kind = VAL_TYPE(v);
+    REBVAL *molded = nullptr;
+    const REBYTE *bytes;
+    REBSIZ size;
+    if (kind == REB_BINARY)
+        bytes = VAL_BINARY_SIZE_AT(&size, v);
+    else if (ANY_STRING_KIND(kind))
+        bytes = cast(const REBYTE*, VAL_UTF8_SIZE_AT(&size, v));
+    else {
+        if (ANY_CONTEXT_KIND(kind) or kind == REB_ACTION or kind == REB_HANDLE)
+            fail ("SEND-CHANNEL can't copy contexts, actions, or handles");
+
+        kind = REB_0;
+        molded = rebValue("mold/all", rebQ(v));
+        bytes = cast(const REBYTE*, VAL_UTF8_SIZE_AT(&size, molded));
+    }
+
+    struct Reb_Message *m = cast(
+        struct Reb_Message*, malloc(sizeof(struct Reb_Message))
+    );
+    REBYTE *data = cast(REBYTE*, malloc(size == 0 ? 1 : size));
+    if (m == nullptr or data == nullptr) {
+        free(m);
+        free(data);
+        if (molded)
+            rebRelease(molded);
+        fail (Error_No_Memory(size));
+    }
+    memcpy(data, bytes, size);
+    if (molded)
+        rebRelease(molded);
+
+    m->next = nullptr;
+    m->kind = kind;
+    m->frozen = Is_Value_Frozen_Deep(v);
+    m->size = size;
+    m->data = data;
+    m->region = nullptr;
+
+    Enqueue_Message(c, m);
+}
+
+
+//
+//  Receive_Message: C
+//
+// Put the oldest message in `out`, or return false if there aren't any.
+//
+bool Receive_Message(REBVAL *out, const REBVAL *channel)
+{
+    struct Reb_Channel_Ref *ref = Channel_Ref(channel);
+    struct Reb_Channel *c = ref->channel;
+    Claim_Receiving(ref);
+
+    // The oldest message has been taken already, so it's freed here and the
+    // next one takes its place.  (A sender that has made its exchange but
+    // not linked yet looks the same as no message; it'll be seen next time.)
+    //
+    struct Reb_Message *taken = c->oldest;
+    struct Reb_Message *m = LOAD_ACQUIRE(taken->next);
+    if (m == nullptr)
+        return false;
+
+    c->oldest = m;
+    FETCH_ADD(c->count, -1);
+    Free_Message(taken);
+
+    // `m` owns its data until the next receive, so if this fails there is
+    // no leak (the message is just lost).
+    //
+    if (m->region) {
+        Copy_Cell(out, SPECIFIC(&m->shared));
+        Adopt_Shared_Region(m->region);  // now this isolate's reference
+        m->region = nullptr;
+        return true;
+    }
+
+    if (m->kind == REB_BINARY) {
+        REBBIN *bin = Make_Binary(m->size);
+        memcpy(BIN_HEAD(bin), m->data, m->size);
+        TERM_BIN_LEN(bin, m->size);
+        Init_Binary(out, bin);
+    }
+    else if (m->kind != REB_0) {
+        REBSTR *s = Make_Sized_String_UTF8(cs_cast(m->data), m->size);
+        Init_Any_String(out, m->kind, s);
+    }
+    else {
+        REBVAL *text = rebSizedText(cs_cast(m->data), m->size);
+        REBVAL *loaded = rebValue("first transcode", rebR(text));
+        Copy_Cell(out, loaded);
+        rebRelease(loaded);
+    }
+
+    if (m->frozen)
+        Force_Value_Frozen_Deep(out);
+    return true;
+}
+
+
+static void Drain_Wake_Pipe(struct Reb_Channel *c)
+{
+  #if defined(HAS_WAKE_PIPE)
+    char buf[16];
+    while (read(c->wake_fds[0], buf, sizeof(buf)) > 0)
+        NOOP;
+  #else
+    UNUSED(c);
+  #endif
+}
+
+
+static void Free_Listener(struct Reb_Listener *l)
+{
+    if (l->watch) {
+        OS_Unwatch_Request(l->watch);
+        Free_Req(l->watch);
+    }
+    rebRelease(l->channel);
+    rebRelease(l->port);
+    free(l);
+}
+
+
+//
+//  Listen_Channel: C
+//
+// Send READ events to `port` (or stop, if it's nullptr) while the channel
+// has messages.  Listening makes this isolate the receiver.
+//
+void Listen_Channel(const REBVAL *channel, option(const REBVAL*) port)
+{
+    struct Reb_Channel_Ref *ref = Channel_Ref(channel);
+    struct Reb_Channel *c = ref->channel;
+    Claim_Receiving(ref);
+
+    struct Reb_Listener **link = &Listeners;
+    for (; *link != nullptr; link = &(*link)->next) {
+        if (Channel_Ref((*link)->channel)->channel == c) {
+            struct Reb_Listener *l = *link;
+            *link = l->next;
+            Free_Listener(l);
+            break;
+        }
+    }
+
+    if (not port)
+        return;
+
+    struct Reb_Listener *l = cast(
+        struct Reb_Listener*, malloc(sizeof(struct Reb_Listener))
+    );
+    if (l == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Listener)));
+
+    l->channel = Copy_Cell(Alloc_Value(), channel);
+    rebUnmanage(l->channel);
+    l->port = Copy_Cell(Alloc_Value(), unwrap(port));
+    rebUnmanage(l->port);
+
+    l->watch = nullptr;
+    if (c->wake_fds[0] != -1) {
+        l->watch = OS_Make_Devreq(&Dev_Event);
+        OS_Watch_Request(l->watch, c->wake_fds[0], RRF_WANT_READ);
+    }
+
+    l->next = Listeners;
+    Listeners = l;
+}
+
+
+//
+//  Fire_Channels: C
+//
+// Queue a READ event for each listening port whose channel has messages.
+// Returns true if any events were queued.
+//
+bool Fire_Channels(void)
+{
+    bool fired = false;
+
+    struct Reb_Listener *l = Listeners;
+    for (; l != nullptr; l = l->next) {
+        struct Reb_Channel *c = Channel_Ref(l->channel)->channel;
+        Drain_Wake_Pipe(c);  // before looking, so no send goes unnoticed
+        if (LOAD_ACQUIRE(c->oldest->next) == nullptr)
+            continue;
+
+        rebElide(
+            "insert system/ports/system make event! [",
+                "type: 'read",
+                "port:", l->port,
+            "]"
+        );
+        fired = true;
+    }
+
+    return fired;
+}
+
+
+//
+//  Shutdown_Channels: C
+//
+// Stop this isolate's listeners.  (Its channel handles are let go of by the
+// GC, as usual.)
+//
+void Shutdown_Channels(void)
+{
+    while (Listeners != nullptr) {
+        struct Reb_Listener *l = Listeners;
+        Listeners = l->next;
+        Free_Listener(l);
+    }
+}
@@ -41,8 +41,26 @@
 #include <sys/wait.h>
 #include <errno.h>
 
+#if defined(TO_LINUX) || defined(TO_ANDROID)
+    #include <sys/epoll.h>
+    #define HAS_EPOLL
+#elif defined(TO_OSX) || defined(TO_FREEBSD) \
+        || defined(TO_OPENBSD) || defined(TO_NETBSD)
+    #include <sys/types.h>
+    #include <sys/event.h>
+    #define HAS_KQUEUE
+#endif
+
 #include "sys-core.h"
 
+#define MAX_READY_EVENTS 64  // more are picked up on the next Query_Events()
+
+// The epoll or kqueue handle which pending socket requests are registered
+// with, see OS_Watch_Request().  -1 if there is no backend (or it couldn't
+// be created), in which case requests are retried on every poll.
+//
+static int Watch_Fd = -1;
+
 //
 //  Delta_Time: C
 //
@@ -86,6 +104,75 @@ int Reap_Process(int pid, int *status, int flags)
 
 extern void Done_Device(uintptr_t handle, int error);
 
+
+//
+// The PG_Watch_Hook for epoll or kqueue.  Registrations are level-triggered,
+// so a socket with data left over after a partial read is reported again.
+// Each registration carries the REBREQ*, so a wakeup costs nothing per
+// socket that isn't ready.
+//
+static bool Watch_Hook(REBREQ *req, int fd, uint16_t want)
+{
+    uint16_t old_want = Req(req)->flags & (RRF_WANT_READ | RRF_WANT_WRITE);
+
+  #if defined(HAS_EPOLL)
+    struct epoll_event ev;
+    ev.events = 0;
+    if (want & RRF_WANT_READ)
+        ev.events |= EPOLLIN;
+    if (want & RRF_WANT_WRITE)
+        ev.events |= EPOLLOUT;
+    ev.data.ptr = req;
+
+    if (want == 0) {  // may fail with EBADF if already closed, that's fine
+        epoll_ctl(Watch_Fd, EPOLL_CTL_DEL, fd, &ev);
+        return true;
+    }
+
+    if (old_want == 0) {
+        if (epoll_ctl(Watch_Fd, EPOLL_CTL_ADD, fd, &ev) == 0)
+            return true;
+        if (errno != EEXIST)
+            return false;
+    }
+
+    // Use MOD also for a registration that was never removed, so that it
+    // can't be left pointing at a request from a previous user of `fd`.
+    //
+    return epoll_ctl(Watch_Fd, EPOLL_CTL_MOD, fd, &ev) == 0;
+  #elif defined(HAS_KQUEUE)
+    struct kevent changes[2];
+    int num_changes = 0;
+
+    if ((old_want & RRF_WANT_READ) and not (want & RRF_WANT_READ))
+        EV_SET(&changes[num_changes++], fd, EVFILT_READ, EV_DELETE, 0, 0, 0);
+    if ((old_want & RRF_WANT_WRITE) and not (want & RRF_WANT_WRITE))
+        EV_SET(&changes[num_changes++], fd, EVFILT_WRITE, EV_DELETE, 0, 0, 0);
+
+    if (num_changes != 0)  // ENOENT or EBADF if already closed, that's fine
+        kevent(Watch_Fd, changes, num_changes, nullptr, 0, nullptr);
+
+    // EV_ADD on a filter that is already there just updates its udata.
+    //
+    num_changes = 0;
+    if (want & RRF_WANT_READ)
+        EV_SET(&changes[num_changes++], fd, EVFILT_READ, EV_ADD, 0, 0, req);
+    if (want & RRF_WANT_WRITE)
+        EV_SET(&changes[num_changes++], fd, EVFILT_WRITE, EV_ADD, 0, 0, req);
+
+    if (num_changes == 0)
+        return true;
+    return kevent(Watch_Fd, changes, num_changes, nullptr, 0, nullptr) == 0;
+  #else
+    UNUSED(req);
+    UNUSED(fd);
+    UNUSED(want);
+    UNUSED(old_want);
+    return false;
+  #endif
+}
+
+
 //
 //  Init_Events: C
 //
@@ -99,11 +186,38 @@ extern void Done_Device(uintptr_t handle, int error);
 DEVICE_CMD Init_Events(REBREQ *dr)
 {
     REBDEV *dev = (REBDEV*)dr; // just to keep compiler happy
+
+    // If the readiness backend can't be made, sockets are just polled.
+    //
+  #if defined(HAS_EPOLL)
+    Watch_Fd = epoll_create1(EPOLL_CLOEXEC);
+  #elif defined(HAS_KQUEUE)
+    Watch_Fd = kqueue();
+  #endif
+    if (Watch_Fd != -1)
+        PG_Watch_Hook = &Watch_Hook;
+
     dev->flags |= RDF_INIT;
     return DR_DONE;
 }
 
 
+//
+//  Quit_Events: C
+//
+DEVICE_CMD Quit_Events(REBREQ *dr)
+{
+    UNUSED(dr);
+
+    PG_Watch_Hook = nullptr;  // requests still watched just get unflagged
+    if (Watch_Fd != -1) {
+        close(Watch_Fd);
+        Watch_Fd = -1;
+    }
+    return DR_DONE;
+}
+
+
 //
 //  Query_Events: C
 //
@@ -111,8 +225,45 @@ DEVICE_CMD Init_Events(REBREQ *dr)
 // req->length. The latter is used by WAIT as the main timing
 // method.
 //
+// With a readiness backend the wait also ends when a watched socket becomes
+// ready, and those requests are flagged so the next poll retries just them.
+//
 DEVICE_CMD Query_Events(REBREQ *req)
 {
+  #if defined(HAS_EPOLL) || defined(HAS_KQUEUE)
+    if (Watch_Fd != -1) {
+      #if defined(HAS_EPOLL)
+        struct epoll_event events[MAX_READY_EVENTS];
+        int n = epoll_wait(
+            Watch_Fd, events, MAX_READY_EVENTS, Req(req)->length
+        );
+      #else
+        struct kevent events[MAX_READY_EVENTS];
+        struct timespec ts;
+        ts.tv_sec = Req(req)->length / 1000;
+        ts.tv_nsec = (Req(req)->length % 1000) * 1000000;
+        int n = kevent(Watch_Fd, nullptr, 0, events, MAX_READY_EVENTS, &ts);
+      #endif
+
+        if (n < 0) {
+            if (errno == EINTR)  // e.g. Ctrl-C, see notes on select() below
+                return DR_DONE;
+            rebFail_OS (errno);
+        }
+
+        int i;
+        for (i = 0; i < n; ++i) {
+          #if defined(HAS_EPOLL)
+            REBREQ *ready = cast(REBREQ*, events[i].data.ptr);
+          #else
+            REBREQ *ready = cast(REBREQ*, events[i].udata);
+          #endif
+            Req(ready)->flags |= RRF_READY;
+        }
+        return DR_DONE;
+    }
+  #endif
+
     struct timeval tv;
     int result;
 
@@ -159,7 +310,7 @@ DEVICE_CMD Connect_Events(REBREQ *req)
 
 static DEVICE_CMD_CFUNC Dev_Cmds[RDC_MAX] = {
     Init_Events,            // init device driver resources
-    0,  // RDC_QUIT,        // cleanup device driver resources
+    Quit_Events,            // cleanup device driver resources
     0,  // RDC_OPEN,        // open device unit (port)
     0,  // RDC_CLOSE,       // close device unit
     0,  // RDC_READ,        // read from unit
@@ -7,6 +7,8 @@ includes: [%prep/extensions/event]
 depends: compose [
     %event/t-event.c
     %event/p-event.c
+    %event/timers.c
+    %event/channels.c
 
     (switch system-config/os-base [
         'Windows [
@@ -56,6 +56,7 @@ REBNATIVE(register_event_hooks)
 
     const enum Reb_Kind k = REB_EVENT;
     Builtin_Type_Hooks[k][IDX_GENERIC_HOOK] = cast(CFUNC*, &T_Event);
+    Builtin_Generic_Hooks[k] = &T_Event;  // dispatch uses this copy
     Builtin_Type_Hooks[k][IDX_PATH_HOOK] = cast(CFUNC*, &PD_Event);
     Builtin_Type_Hooks[k][IDX_COMPARE_HOOK] = cast(CFUNC*, &CT_Event);
     Builtin_Type_Hooks[k][IDX_MAKE_HOOK] = cast(CFUNC*, &MAKE_Event);
@@ -87,6 +88,7 @@ REBNATIVE(unregister_event_hooks)
     //
     const enum Reb_Kind k = REB_EVENT;
     Builtin_Type_Hooks[k][IDX_GENERIC_HOOK] = cast(CFUNC*, &T_Unhooked);
+    Builtin_Generic_Hooks[k] = &T_Unhooked;
     Builtin_Type_Hooks[k][IDX_PATH_HOOK] = cast(CFUNC*, &PD_Unhooked);
     Builtin_Type_Hooks[k][IDX_COMPARE_HOOK] = cast(CFUNC*, &CT_Unhooked);
     Builtin_Type_Hooks[k][IDX_MAKE_HOOK] = cast(CFUNC*, &MAKE_Unhooked);
@@ -376,7 +378,10 @@ REBNATIVE(wait_p)  // See wrapping function WAIT in usermode code
             fail ("BREAKPOINT from SIG_INTERRUPT not currently implemented");
         }
 
-        if (VAL_LEN_HEAD(waiters) == 0 and VAL_LEN_HEAD(waked) == 0) {
+        Fire_Timers();  // TIME events are queued like any other events
+        Fire_Channels();  // ...as are READ events for channels with messages
+
+        if (Queued_Event_Count(waiters) == 0 and VAL_LEN_HEAD(waked) == 0) {
             //
             // No activity (nothing to do) so increase the wait time
             //
@@ -427,7 +432,12 @@ REBNATIVE(wait_p)  // See wrapping function WAIT in usermode code
 
         //printf("%d %d %d\n", dt, time, timeout);
 
-        Wait_For_Device_Events_Interruptible(wait_time, res);
+        // Don't sleep past the next timer.  (Its turn to fire comes on the
+        // next trip, so wait_time is not changed--that would end the loop.)
+        //
+        Wait_For_Device_Events_Interruptible(
+            Timer_Wait_Msec(wait_time), res
+        );
     }
 
     //time = (REBLEN)Delta_Time(base);
@@ -468,6 +478,142 @@ REBNATIVE(wait_p)  // See wrapping function WAIT in usermode code
 }
 
 
+//
+//  export set-timer: native [
+//
+//  {Send a TIME event to a port after a delay (during any WAIT)}
+//
+//      return: "ID for CANCEL-TIMER"
+//          [integer!]
+//      port [port!]
+//      delay "Seconds, or TIME!"
+//          [integer! decimal! time!]
+//      /repeat "Keep sending one every DELAY, until canceled"
+//  ]
+//
+REBNATIVE(set_timer)
+//
+// e.g. an idle timeout is usually canceled (or canceled and set again when
+// there's activity) and rarely fires, so both are cheap; see %timers.c
+{
+    EVENT_INCLUDE_PARAMS_OF_SET_TIMER;
+
+    int64_t delay = cast(int64_t, Milliseconds_From_Value(ARG(delay))) * 1000;
+    if (REF(repeat) and delay == 0)
+        fail ("SET-TIMER/REPEAT needs a DELAY of at least a millisecond");
+
+    int64_t id = Add_Timer(ARG(port), delay, REF(repeat) ? delay : 0);
+    return Init_Integer(D_OUT, id);
+}
+
+
+//
+//  export cancel-timer: native [
+//
+//  {Stop a timer made by SET-TIMER, so it sends no more TIME events}
+//
+//      return: "false if the timer already fired (and wasn't /REPEAT)"
+//          [logic!]
+//      id [integer!]
+//  ]
+//
+REBNATIVE(cancel_timer)
+{
+    EVENT_INCLUDE_PARAMS_OF_CANCEL_TIMER;
+
+    return Init_Logic(D_OUT, Cancel_Timer(VAL_INT64(ARG(id))));
+}
+
+
+//
+//  export open-channel: native [
+//
+//  {Get a channel that values can be sent to, from any isolate (thread)}
+//
+//      return: [handle!]
+//      name "Isolates that open the same name get the same channel"
+//          [text! word!]
+//  ]
+//
+REBNATIVE(open_channel)
+//
+// See %channels.c for how messages are queued and copied.
+{
+    EVENT_INCLUDE_PARAMS_OF_OPEN_CHANNEL;
+
+    return Open_Channel(D_OUT, ARG(name));
+}
+
+
+//
+//  export send-channel: native [
+//
+//  {Queue a copy of a value on a channel (never waits)}
+//
+//      return: []
+//      channel [handle!]
+//      value "Values that are frozen deeply arrive frozen"
+//          [<opt> any-value!]
+//  ]
+//
+REBNATIVE(send_channel)
+{
+    EVENT_INCLUDE_PARAMS_OF_SEND_CHANNEL;
+
+    if (IS_NULLED(ARG(value)))
+        fail ("SEND-CHANNEL can't send NULL (it means no message waiting)");
+
+    Send_Message(ARG(channel), ARG(value));
+    return Init_None(D_OUT);
+}
+
+
+//
+//  export receive-channel: native [
+//
+//  {Take the oldest value sent to a channel, if any}
+//
+//      return: "NULL if no messages are waiting"
+//          [<opt> any-value!]
+//      channel [handle!]
+//  ]
+//
+REBNATIVE(receive_channel)
+//
+// Only one isolate may receive from a channel: the first one that does
+// (or that LISTEN-CHANNELs) keeps it until its handle is garbage collected.
+{
+    EVENT_INCLUDE_PARAMS_OF_RECEIVE_CHANNEL;
+
+    if (not Receive_Message(D_OUT, ARG(channel)))
+        return nullptr;
+    return D_OUT;
+}
+
+
+//
+//  export listen-channel: native [
+//
+//  {Send READ events to a port during WAIT while a channel has messages}
+//
+//      return: []
+//      channel [handle!]
+//      port "BLANK! to stop sending events"
+//          [port! blank!]
+//  ]
+//
+REBNATIVE(listen_channel)
+{
+    EVENT_INCLUDE_PARAMS_OF_LISTEN_CHANNEL;
+
+    Listen_Channel(
+        ARG(channel),
+        IS_BLANK(ARG(port)) ? nullptr : ARG(port)
+    );
+    return Init_None(D_OUT);
+}
+
+
 //
 //  export wake-up: native [
 //
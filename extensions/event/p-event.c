@@ -54,7 +54,170 @@
 #include "reb-event.h"
 
 #define EVENTS_LIMIT 0xFFFF //64k
-#define EVENTS_CHUNK 128
+#define EVENTS_RING_SIZE 128  // preallocated, doubled when full
+
+
+//=//// EVENT QUEUE RING //////////////////////////////////////////////////=//
+//
+// R3-Alpha kept the queue as a plain BLOCK! in the port's state, and took
+// events from the front.  Now the state BLOCK! is a fixed-size ring:
+//
+//     [head count event event _ _ _ ... _]
+//
+// The two INTEGER!s say where the oldest event is and how many there are,
+// and the slots after them are used in a circle--so adding to the back or
+// taking from the front never moves the other events.  Unused slots are
+// BLANK!, so the GC doesn't keep ports alive through a stale event.
+//
+
+#define RING_HEAD 0
+#define RING_COUNT 1
+#define RING_SLOTS 2  // index of first event slot
+
+static REBARR *Make_Event_Ring(REBLEN capacity)
+{
+    REBARR *a = Make_Array(RING_SLOTS + capacity);
+    Init_Integer(Alloc_Tail_Array(a), 0);  // RING_HEAD
+    Init_Integer(Alloc_Tail_Array(a), 0);  // RING_COUNT
+    REBLEN i;
+    for (i = 0; i < capacity; ++i)
+        Init_Blank(Alloc_Tail_Array(a));
+    return a;
+}
+
+inline static REBLEN Ring_Capacity(REBARR *a)
+  { return ARR_LEN(a) - RING_SLOTS; }
+
+inline static REBLEN Ring_Head(REBARR *a)
+  { return VAL_INT32(ARR_AT(a, RING_HEAD)); }
+
+inline static REBLEN Ring_Count(REBARR *a)
+  { return VAL_INT32(ARR_AT(a, RING_COUNT)); }
+
+inline static RELVAL *Ring_Slot(REBARR *a, REBLEN n)  // n-th oldest event
+  { return ARR_AT(a, RING_SLOTS + (Ring_Head(a) + n) % Ring_Capacity(a)); }
+
+// Get the ring in the `state` of an event port, making it if needed.
+//
+static REBARR *Event_Ring(REBVAL *state)
+{
+    if (
+        not IS_BLOCK(state)
+        or VAL_LEN_HEAD(state) <= RING_SLOTS
+        or not IS_INTEGER(ARR_AT(VAL_ARRAY(state), RING_COUNT))
+    ){
+        Init_Block(state, Make_Event_Ring(EVENTS_RING_SIZE));
+    }
+    return VAL_ARRAY_KNOWN_MUTABLE(state);
+}
+
+// Reached the limit, or make a ring twice the size with the events in order.
+// Returns the (possibly new) ring.
+//
+static REBARR *Grow_Event_Ring(REBVAL *state)
+{
+    REBARR *old = VAL_ARRAY_KNOWN_MUTABLE(state);
+    REBLEN count = Ring_Count(old);
+    if (count >= EVENTS_LIMIT)
+        panic (state);
+
+    REBARR *a = Make_Event_Ring(Ring_Capacity(old) * 2);
+    REBLEN n;
+    for (n = 0; n < count; ++n)
+        Copy_Cell(ARR_AT(a, RING_SLOTS + n), SPECIFIC(Ring_Slot(old, n)));
+    Init_Integer(ARR_AT(a, RING_COUNT), count);
+
+    Init_Block(state, a);
+    return a;
+}
+
+
+//
+//  Queued_Event_Count: C
+//
+// How many events are waiting in the event port's `state`.
+//
+REBLEN Queued_Event_Count(REBVAL *state)
+{
+    return Ring_Count(Event_Ring(state));
+}
+
+
+//
+//  Queue_Event: C
+//
+// Add an event to the back of the queue in an event port's `state`.
+//
+// Some events are coalesced with the one queued just before, rather than
+// piling up to run the same handler again with nothing new to see:
+//
+// * A TIME event that is the same as the last one (a /REPEAT timer that
+//   ticked again before WAIT got to it).
+//
+// * A MOVE event for the same target as the last one, which just takes its
+//   place (only the latest position matters).
+//
+void Queue_Event(REBVAL *state, const REBVAL *event)
+{
+    REBARR *a = Event_Ring(state);
+    REBLEN count = Ring_Count(a);
+
+    if (count != 0) {
+        RELVAL *last = Ring_Slot(a, count - 1);
+        if (
+            VAL_EVENT_TYPE(last) == VAL_EVENT_TYPE(event)
+            and VAL_EVENT_MODEL(last) == VAL_EVENT_MODEL(event)
+            and VAL_EVENT_NODE(last) == VAL_EVENT_NODE(event)
+        ){
+            switch (VAL_EVENT_TYPE(event)) {
+              case SYM_TIME:
+                if (VAL_EVENT_DATA(last) == VAL_EVENT_DATA(event))
+                    return;
+                break;
+
+              case SYM_MOVE:
+                Copy_Cell(last, event);
+                return;
+
+              default:
+                break;
+            }
+        }
+    }
+
+    if (count == Ring_Capacity(a))
+        a = Grow_Event_Ring(state);
+
+    Copy_Cell(Ring_Slot(a, count), event);
+    Init_Integer(ARR_AT(a, RING_COUNT), count + 1);
+}
+
+
+//
+//  Take_Event: C
+//
+// Remove the oldest event (or the newest, if `last`) from the queue in an
+// event port's `state` into `out`.  Returns false if there are none.
+//
+bool Take_Event(REBVAL *out, REBVAL *state, bool last)
+{
+    REBARR *a = Event_Ring(state);
+    REBLEN count = Ring_Count(a);
+    if (count == 0)
+        return false;
+
+    RELVAL *slot = Ring_Slot(a, last ? count - 1 : 0);
+    Copy_Cell(out, SPECIFIC(slot));
+    Init_Blank(slot);
+
+    if (not last) {
+        REBLEN head = (Ring_Head(a) + 1) % Ring_Capacity(a);
+        Init_Integer(ARR_AT(a, RING_HEAD), head);
+    }
+    Init_Integer(ARR_AT(a, RING_COUNT), count - 1);
+    return true;
+}
+
 
 //
 //  Append_Event: C
@@ -75,17 +238,13 @@ REBVAL *Append_Event(void)
     REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
     if (!IS_BLOCK(state)) return 0;
 
-    // Append to tail if room:
-    if (SER_FULL(VAL_SERIES(state))) {
-        if (VAL_LEN_HEAD(state) > EVENTS_LIMIT)
-            panic (state);
-
-        Extend_Series(VAL_SERIES_KNOWN_MUTABLE(state), EVENTS_CHUNK);
-    }
+    REBARR *a = Event_Ring(state);
+    REBLEN count = Ring_Count(a);
+    if (count == Ring_Capacity(a))
+        return 0;
 
-    REBARR *state_array = VAL_ARRAY_KNOWN_MUTABLE(state);
-    SET_SERIES_LEN(state_array, VAL_LEN_HEAD(state) + 1);
-    return Init_Blank(ARR_LAST(state_array));
+    Init_Integer(ARR_AT(a, RING_COUNT), count + 1);
+    return Init_Blank(Ring_Slot(a, count));
 }
 
 
@@ -106,8 +265,10 @@ const REBVAL *Find_Last_Event(REBINT model, uint32_t type)
     REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
     if (!IS_BLOCK(state)) return NULL;
 
-    const RELVAL *value = VAL_ARRAY_TAIL(state) - 1;
-    for (; value >= ARR_HEAD(VAL_ARRAY(state)); --value) {
+    REBARR *a = Event_Ring(state);
+    REBLEN n = Ring_Count(a);
+    while (n != 0) {
+        const RELVAL *value = Ring_Slot(a, --n);
         if (VAL_EVENT_MODEL(value) == model) {
             if (cast(uint32_t, VAL_EVENT_TYPE(value)) == type) {
                 return cast(const REBVAL*, value);
@@ -137,8 +298,7 @@ REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
     // Get or setup internal state data:
     //
-    if (!IS_BLOCK(state))
-        Init_Block(state, Make_Array(EVENTS_CHUNK - 1));
+    REBARR *ring = Event_Ring(state);
 
     switch (VAL_WORD_ID(verb)) {
 
@@ -151,7 +311,7 @@ REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         switch (property) {
         case SYM_LENGTH:
-            return Init_Integer(D_OUT, VAL_LEN_HEAD(state));
+            return Init_Integer(D_OUT, Ring_Count(ring));
 
         default:
             break;
@@ -162,46 +322,102 @@ REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
     case SYM_ON_WAKE_UP:
         return Init_None(D_OUT);
 
-    // Normal block actions done on events:
-    case SYM_POKE:
+    // Normal block actions done on events (the ring's slots are in order
+    // from the oldest event, as if they were a BLOCK! at its head):
+
+    case SYM_PICK:
+    case SYM_POKE: {
+        REBVAL *picker = D_ARG(2);
+        if (not IS_INTEGER(picker))
+            fail (picker);
+
+        REBI64 n = VAL_INT64(picker);
+        if (n < 1 or n > cast(REBI64, Ring_Count(ring))) {
+            if (VAL_WORD_ID(verb) == SYM_PICK)
+                return nullptr;
+            fail (Error_Out_Of_Range(picker));
+        }
+
+        RELVAL *slot = Ring_Slot(ring, n - 1);
+        if (VAL_WORD_ID(verb) == SYM_PICK)
+            RETURN (SPECIFIC(slot));
+
         if (not IS_EVENT(D_ARG(3)))
             fail (D_ARG(3));
-        goto act_blk;
+        Copy_Cell(slot, D_ARG(3));
+        RETURN (D_ARG(3)); }
 
     case SYM_INSERT:
-    case SYM_APPEND:
-        if (not IS_EVENT(D_ARG(2)))
-            fail (D_ARG(2));
-        goto act_blk;
+    case SYM_APPEND: {
+        INCLUDE_PARAMS_OF_INSERT;  // compatible frames, see %generics.r
+        UNUSED(PAR(series));
+        UNUSED(REF(line));
 
-    case SYM_PICK: {
-    act_blk:;
-        //
-        // !!! For performance, this reuses the same frame built for the
-        // INSERT/etc. on a PORT! to do an INSERT/etc. on whatever kind of
-        // value the state is.  It saves the value of the port, substitutes
-        // the state value in the first slot of the frame, and calls the
-        // array type dispatcher.  :-/
-        //
-        DECLARE_LOCAL (save_port);
-        Copy_Cell(save_port, D_ARG(1));
-        Copy_Cell(D_ARG(1), state);
+        if (REF(part) or REF(dup))
+            fail (Error_Bad_Refines_Raw());
+
+        if (not IS_EVENT(ARG(value)))
+            fail (ARG(value));
 
-        REB_R r = T_Array(frame_, verb);
+        // Both go to the back, so events are handled in the order they
+        // happened.  (INSERT went to the head of the R3-Alpha BLOCK!, so
+        // the newest events were handled first.)
+        //
+        Queue_Event(state, ARG(value));
         SET_SIGNAL(SIG_EVENT_PORT);
-        if (
-            VAL_WORD_ID(verb) == SYM_INSERT
-            || VAL_WORD_ID(verb) == SYM_APPEND
-            || VAL_WORD_ID(verb) == SYM_REMOVE
-        ){
-            RETURN (save_port);
+        RETURN (port); }
+
+    case SYM_TAKE: {
+        INCLUDE_PARAMS_OF_TAKE;
+        UNUSED(PAR(series));
+
+        if (REF(deep))
+            fail (Error_Bad_Refines_Raw());
+
+        if (not REF(part)) {
+            if (not Take_Event(D_OUT, state, did REF(last)))
+                return nullptr;
+            return D_OUT;
         }
-        return r; }
 
-    case SYM_CLEAR:
-        SET_SERIES_LEN(VAL_ARRAY_KNOWN_MUTABLE(state), 0);
+        // TAKE/PART takes that many of the events that are ready in one go,
+        // e.g. `take/part port length of port` for all of them.
+        //
+        if (not IS_INTEGER(ARG(part)))
+            fail (ARG(part));
+
+        REBI64 limit = VAL_INT64(ARG(part));
+        REBLEN total = Ring_Count(ring);
+        REBLEN count = total;
+        if (limit < 0)
+            limit = 0;
+        if (limit < cast(REBI64, count))
+            count = cast(REBLEN, limit);
+
+        REBLEN first = REF(last) ? total - count : 0;
+        REBARR *a = Make_Array(count);
+        REBLEN n;
+        for (n = first; n < first + count; ++n) {
+            RELVAL *slot = Ring_Slot(ring, n);
+            Copy_Cell(Alloc_Tail_Array(a), SPECIFIC(slot));
+            Init_Blank(slot);
+        }
+
+        if (not REF(last)) {
+            REBLEN head = (Ring_Head(ring) + count) % Ring_Capacity(ring);
+            Init_Integer(ARR_AT(ring, RING_HEAD), head);
+        }
+        Init_Integer(ARR_AT(ring, RING_COUNT), total - count);
+        return Init_Block(D_OUT, a); }
+
+    case SYM_CLEAR: {
+        REBLEN n;
+        for (n = 0; n < Ring_Capacity(ring); ++n)
+            Init_Blank(ARR_AT(ring, RING_SLOTS + n));
+        Init_Integer(ARR_AT(ring, RING_HEAD), 0);
+        Init_Integer(ARR_AT(ring, RING_COUNT), 0);
         CLR_SIGNAL(SIG_EVENT_PORT);
-        RETURN (port);
+        RETURN (port); }
 
     case SYM_OPEN: {
         INCLUDE_PARAMS_OF_OPEN;
@@ -265,4 +481,6 @@ void Startup_Event_Scheme(void)
 //
 void Shutdown_Event_Scheme(void)
 {
+    Shutdown_Channels();
+    Shutdown_Timers();
 }
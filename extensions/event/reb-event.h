@@ -160,6 +160,9 @@ extern REB_R PD_Event(REBPVS *pvs, const RELVAL *picker, option(const REBVAL*) s
 // !!! The port scheme is also being included in the extension.
 
 extern REB_R Event_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb);
+extern REBLEN Queued_Event_Count(REBVAL *state);
+extern void Queue_Event(REBVAL *state, const REBVAL *event);
+extern bool Take_Event(REBVAL *out, REBVAL *state, bool last);
 extern void Startup_Event_Scheme(void);
 extern void Shutdown_Event_Scheme(void);
 
@@ -202,3 +205,20 @@ inline static REBVAL *Init_Gob(RELVAL *out, REBGOB *g) {
 EXTERN_C REBDEV Dev_Event;
 extern int64_t Delta_Time(int64_t base);
 extern int Reap_Process(int pid, int *status, int flags);
+
+// Timers sending TIME events to ports, see %timers.c
+//
+extern int64_t Add_Timer(const REBVAL *port, int64_t delay, int64_t period);
+extern bool Cancel_Timer(int64_t id);
+extern uint32_t Timer_Wait_Msec(uint32_t longest);
+extern bool Fire_Timers(void);
+extern void Shutdown_Timers(void);
+
+// Channels passing values between isolates, see %channels.c
+//
+extern REBVAL *Open_Channel(REBVAL *out, const REBVAL *name);
+extern void Send_Message(const REBVAL *channel, const REBVAL *v);
+extern bool Receive_Message(REBVAL *out, const REBVAL *channel);
+extern void Listen_Channel(const REBVAL *channel, option(const REBVAL*) port);
+extern bool Fire_Channels(void);
+extern void Shutdown_Channels(void);
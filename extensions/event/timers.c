@@ -0,0 +1,297 @@
+//
+//  File: %timers.c
+//  Summary: "Timers that send TIME events to ports, kept in a binary heap"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A server with thousands of connections can have thousands of idle
+// timeouts, and nearly all of them get canceled or pushed back before they
+// ever fire.  So timers are kept in a binary min-heap ordered by deadline:
+//
+// * The next deadline (which WAIT needs on each trip through its loop) is
+//   always at the top of the heap, O(1).
+//
+// * Adding or canceling a timer is O(log n).  Each timer knows where it is
+//   in the heap, so canceling doesn't have to search for it.
+//
+// * Firing pops just the timers that are due.
+//
+// Timers live in a slot array that the heap indexes into.  A timer's ID is
+// its slot and a generation count, so an ID that was used up (fired or got
+// canceled) won't cancel whatever timer reuses the slot.
+//
+// !!! A hierarchical timer wheel would make adding and canceling O(1), but
+// it needs a fixed tick (which would round the deadlines) and gets cheaper
+// only at sizes where log n is already small.
+//
+
+#include <stdlib.h>
+
+#include "sys-core.h"
+
+#include "reb-event.h"
+
+#define NO_SLOT UINT32_MAX
+
+struct Reb_Timer {
+    REBVAL *port;  // unmanaged API handle, nullptr if the slot is free
+    int64_t due;  // in Delta_Time() microseconds
+    int64_t period;  // 0 for a timer that fires once
+    uint32_t generation;  // bumped when the slot is freed, see Timer_Id()
+    uint32_t heap_pos;  // index in Timer_Heap, or next free slot if free
+};
+
+static struct Reb_Timer *Timers;
+static uint32_t Timers_Capacity;
+static uint32_t Free_Slot = NO_SLOT;
+
+static uint32_t *Timer_Heap;  // slot numbers, earliest `due` first
+static uint32_t Heap_Len;
+
+
+inline static int64_t Timer_Id(uint32_t slot) {  // positive INTEGER!
+    uint32_t generation = Timers[slot].generation & 0x7FFFFFFF;
+    return (cast(int64_t, generation) << 32) | slot;
+}
+
+inline static bool Earlier(uint32_t a, uint32_t b) {
+    return Timers[Timer_Heap[a]].due < Timers[Timer_Heap[b]].due;
+}
+
+static void Swap_Heap(uint32_t a, uint32_t b)
+{
+    uint32_t slot = Timer_Heap[a];
+    Timer_Heap[a] = Timer_Heap[b];
+    Timer_Heap[b] = slot;
+    Timers[Timer_Heap[a]].heap_pos = a;
+    Timers[Timer_Heap[b]].heap_pos = b;
+}
+
+static void Sift_Up(uint32_t pos)
+{
+    while (pos > 0) {
+        uint32_t parent = (pos - 1) / 2;
+        if (not Earlier(pos, parent))
+            return;
+        Swap_Heap(pos, parent);
+        pos = parent;
+    }
+}
+
+static void Sift_Down(uint32_t pos)
+{
+    while (true) {
+        uint32_t least = pos;
+        uint32_t left = 2 * pos + 1;
+        uint32_t right = left + 1;
+        if (left < Heap_Len and Earlier(left, least))
+            least = left;
+        if (right < Heap_Len and Earlier(right, least))
+            least = right;
+        if (least == pos)
+            return;
+        Swap_Heap(pos, least);
+        pos = least;
+    }
+}
+
+static void Heap_Remove(uint32_t pos)
+{
+    --Heap_Len;
+    if (pos == Heap_Len)
+        return;
+
+    Timer_Heap[pos] = Timer_Heap[Heap_Len];
+    Timers[Timer_Heap[pos]].heap_pos = pos;
+    Sift_Up(pos);
+    Sift_Down(pos);
+}
+
+static void Free_Timer_Slot(uint32_t slot)
+{
+    struct Reb_Timer *t = &Timers[slot];
+    rebRelease(t->port);
+    t->port = nullptr;
+    ++t->generation;
+    t->heap_pos = Free_Slot;
+    Free_Slot = slot;
+}
+
+
+//
+//  Add_Timer: C
+//
+// Send a TIME event to `port` after `delay` microseconds (and then every
+// `period` microseconds, if that is not 0).  Returns the ID for
+// Cancel_Timer().
+//
+int64_t Add_Timer(const REBVAL *port, int64_t delay, int64_t period)
+{
+    if (Free_Slot == NO_SLOT) {  // grow both arrays, heap is never larger
+        uint32_t capacity = Timers_Capacity == 0 ? 64 : Timers_Capacity * 2;
+        struct Reb_Timer *timers = cast(struct Reb_Timer*, realloc(
+            Timers, capacity * sizeof(struct Reb_Timer)
+        ));
+        if (timers == nullptr)
+            fail (Error_No_Memory(capacity * sizeof(struct Reb_Timer)));
+        Timers = timers;
+
+        uint32_t *heap = cast(uint32_t*, realloc(
+            Timer_Heap, capacity * sizeof(uint32_t)
+        ));
+        if (heap == nullptr)
+            fail (Error_No_Memory(capacity * sizeof(uint32_t)));
+        Timer_Heap = heap;
+
+        uint32_t slot = capacity;
+        while (slot != Timers_Capacity) {  // thread free list, lowest first
+            --slot;
+            Timers[slot].port = nullptr;
+            Timers[slot].generation = 0;
+            Timers[slot].heap_pos = Free_Slot;
+            Free_Slot = slot;
+        }
+        Timers_Capacity = capacity;
+    }
+
+    uint32_t slot = Free_Slot;
+    struct Reb_Timer *t = &Timers[slot];
+    Free_Slot = t->heap_pos;
+
+    t->port = Copy_Cell(Alloc_Value(), port);
+    rebUnmanage(t->port);  // lives until the timer is done
+    t->due = Delta_Time(0) + delay;
+    t->period = period;
+
+    t->heap_pos = Heap_Len;
+    Timer_Heap[Heap_Len++] = slot;
+    Sift_Up(t->heap_pos);
+
+    return Timer_Id(slot);
+}
+
+
+//
+//  Cancel_Timer: C
+//
+// Returns false if the ID is not for a timer that is still waiting to fire.
+//
+bool Cancel_Timer(int64_t id)
+{
+    uint32_t slot = cast(uint32_t, id & 0xFFFFFFFF);
+    if (id < 0 or slot >= Timers_Capacity)
+        return false;
+    if (Timers[slot].port == nullptr or Timer_Id(slot) != id)
+        return false;
+
+    Heap_Remove(Timers[slot].heap_pos);
+    Free_Timer_Slot(slot);
+    return true;
+}
+
+
+//
+//  Timer_Wait_Msec: C
+//
+// How long until the next timer is due, or `longest` if that's sooner (or
+// there are no timers).
+//
+uint32_t Timer_Wait_Msec(uint32_t longest)
+{
+    if (Heap_Len == 0)
+        return longest;
+
+    int64_t wait = Timers[Timer_Heap[0]].due - Delta_Time(0);
+    if (wait <= 0)
+        return 0;
+
+    int64_t msec = (wait + 999) / 1000;  // round up, don't wake up early
+    return msec < longest ? cast(uint32_t, msec) : longest;
+}
+
+
+//
+//  Fire_Timers: C
+//
+// Queue a TIME event for each timer that is due.  A repeating timer is
+// rescheduled one period on--or a period from now, if it fell behind (so a
+// long pause doesn't make it fire a burst of events to catch up).
+//
+// Returns true if any events were queued.
+//
+bool Fire_Timers(void)
+{
+    if (Heap_Len == 0)
+        return false;
+
+    int64_t now = Delta_Time(0);
+    bool fired = false;
+
+    while (Heap_Len != 0) {
+        uint32_t slot = Timer_Heap[0];
+        struct Reb_Timer *t = &Timers[slot];
+        if (t->due > now)
+            break;
+
+        rebElide(
+            "insert system/ports/system make event! [",
+                "type: 'time",
+                "port:", t->port,
+            "]"
+        );
+        fired = true;
+
+        // Timers may move in the realloc() if the insert ran code that
+        // added one, so look the slot up again.
+        //
+        t = &Timers[slot];
+        if (t->period == 0) {
+            Heap_Remove(t->heap_pos);
+            Free_Timer_Slot(slot);
+        }
+        else {
+            t->due += t->period;
+            if (t->due <= now)
+                t->due = now + t->period;
+            Sift_Down(t->heap_pos);
+        }
+    }
+
+    return fired;
+}
+
+
+//
+//  Shutdown_Timers: C
+//
+void Shutdown_Timers(void)
+{
+    uint32_t slot;
+    for (slot = 0; slot < Timers_Capacity; ++slot) {
+        if (Timers[slot].port != nullptr)
+            rebRelease(Timers[slot].port);
+    }
+
+    free(Timers);
+    free(Timer_Heap);
+    Timers = nullptr;
+    Timer_Heap = nullptr;
+    Timers_Capacity = 0;
+    Heap_Len = 0;
+    Free_Slot = NO_SLOT;
+}
@@ -57,6 +57,7 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>  // mmap() for MAP-FILE
 #include <fcntl.h>  // includes `O_XXX` constant definitions
 #include <dirent.h>
 #include <errno.h>
@@ -104,6 +105,8 @@
 **
 ***********************************************************************/
 
+#if !defined(AT_FDCWD)  // else Is_Dir_Entry() uses fstatat()
+
 // dirent.d_type is a BSD extension, actually not part of POSIX
 // reformatted from: http://ports.haiku-files.org/wiki/CommonProblems
 // this comes from: http://ports.haiku-files.org/wiki/CommonProblems
@@ -144,6 +147,8 @@ static int Is_Dir(const char *path_utf8, const char *name_utf8)
     return (stat_result != 0) ? 0 : S_ISDIR(st.st_mode);
 }
 
+#endif
+
 
 static bool Seek_File_64(REBREQ *file)
 {
@@ -207,6 +212,48 @@ static int Get_File_Info(REBREQ *file)
 }
 
 
+// Whether a directory entry is a directory, for the trailing slash in READ
+// of a directory.  Most filesystems say so in the entry's `d_type` (a BSD
+// extension that Linux has too) and then no stat() is needed at all--which
+// matters a lot on network filesystems, with 500,000 entries in a folder.
+//
+// But `d_type` isn't POSIX, and not all OSes (e.g. Haiku) have it.  Even
+// when they do, a filesystem doesn't have to fill it in (VirtualBox shared
+// folders, older XFS) and gives DT_UNKNOWN.  Then it takes a stat(), as it
+// does for a symbolic link (which counts as a directory if it points to
+// one).  fstatat() on the open directory saves building the full path.
+//
+static bool Is_Dir_Entry(
+    DIR *h,
+    struct dirent *d,
+    char **dir_utf8,  // spelled only if a stat() needs it, caller frees
+    const REBVAL *dir_path
+){
+  #if defined(DT_DIR) && defined(DT_UNKNOWN) && defined(DT_LNK)
+    if (d->d_type == DT_DIR)
+        return true;
+    if (d->d_type != DT_UNKNOWN and d->d_type != DT_LNK)
+        return false;
+  #endif
+
+  #if defined(AT_FDCWD)  // POSIX.1-2008, so fstatat() and dirfd() exist
+    UNUSED(dir_utf8);
+    UNUSED(dir_path);
+
+    struct stat st;
+    if (fstatat(dirfd(h), d->d_name, &st, 0) != 0)
+        return false;  // !!! What's the proper result?
+    return S_ISDIR(st.st_mode);
+  #else
+    UNUSED(h);
+
+    if (*dir_utf8 == nullptr)
+        *dir_utf8 = rebSpell("file-to-local", dir_path);
+    return Is_Dir(*dir_utf8, d->d_name);
+  #endif
+}
+
+
 //
 //  Read_Directory: C
 //
@@ -256,14 +303,16 @@ static int Read_Directory(REBREQ *dir, REBREQ *file)
     struct rebol_devreq *dir_req = Req(dir);
     struct rebol_devreq *file_req = Req(file);
 
-    // Note: /WILD append of * is not necessary on POSIX
-    //
-    char *dir_utf8 = rebSpell("file-to-local", ReqFile(dir)->path);
+    char *dir_utf8 = nullptr;  // only spelled out if needed
 
     // If no dir handle, open the dir:
     //
     DIR *h;
     if ((h = cast(DIR*, dir_req->requestee.handle)) == NULL) {
+        //
+        // Note: /WILD append of * is not necessary on POSIX
+        //
+        dir_utf8 = rebSpell("file-to-local", ReqFile(dir)->path);
         h = opendir(dir_utf8); // !!! does opendir() hold pointer?
 
         if (h == NULL) {
@@ -285,7 +334,8 @@ static int Read_Directory(REBREQ *dir, REBREQ *file)
         if ((d = readdir(h)) == NULL) {
             int errno_cache = errno; // in case closedir() changes it
 
-            rebFree(dir_utf8);
+            if (dir_utf8 != nullptr)
+                rebFree(dir_utf8);
 
             closedir(h);
             dir_req->requestee.handle = 0;
@@ -307,22 +357,7 @@ static int Read_Directory(REBREQ *dir, REBREQ *file)
 
     file_req->modes = 0;
 
-#if 0
-    // NOTE: we do not use d_type even if DT_DIR is #define-d.  First of all,
-    // it's not a POSIX requirement and not all operating systems support it.
-    // (Linux/BSD have it defined in their structs, but Haiku doesn't--for
-    // instance).  But secondly, even if your OS supports it...a filesystem
-    // doesn't have to.  (Examples: VirtualBox shared folders, XFS.)
-
-    if (d->d_type == DT_DIR)
-        file_req->modes |= RFM_DIR;
-#endif
-
-    // More widely supported mechanism of determining if something is a
-    // directory, although less efficient than DT_DIR (because it requires
-    // making an additional filesystem call)
-
-    if (Is_Dir(dir_utf8, file_utf8))
+    if (Is_Dir_Entry(h, d, &dir_utf8, ReqFile(dir)->path))
         file_req->modes |= RFM_DIR;
 
     ReqFile(file)->path = rebValue(
@@ -338,7 +373,8 @@ static int Read_Directory(REBREQ *dir, REBREQ *file)
     //
     rebUnmanage(m_cast(REBVAL*, ReqFile(file)->path));
 
-    rebFree(dir_utf8);
+    if (dir_utf8 != nullptr)
+        rebFree(dir_utf8);
 
     // Line below DOES NOT WORK -- because we need full path.
     //Get_File_Info(file); // updates modes, size, time
@@ -347,6 +383,18 @@ static int Read_Directory(REBREQ *dir, REBREQ *file)
 }
 
 
+//
+//  Quit_File: C
+//
+DEVICE_CMD Quit_File(REBREQ *dev)
+{
+    UNUSED(dev);  // RDC_QUIT is passed the REBDEV, not a request
+
+    Shutdown_File_Io();
+    return DR_DONE;
+}
+
+
 //
 //  Open_File: C
 //
@@ -437,6 +485,12 @@ DEVICE_CMD Close_File(REBREQ *file)
 {
     struct rebol_devreq *req = Req(file);
 
+    if (ReqFile(file)->io != nullptr) {  // kernel may still be using it
+        OS_Unwatch_Request(file);
+        File_Io_Cancel(ReqFile(file)->io);
+        ReqFile(file)->io = nullptr;
+    }
+
     if (req->requestee.id) {
         close(req->requestee.id);
         req->requestee.id = 0;
@@ -445,6 +499,81 @@ DEVICE_CMD Close_File(REBREQ *file)
 }
 
 
+// Finish up a READ or WRITE posted by Start_File_Io(), if it's done.  When
+// `retry` it's the pending request being polled, and the actor that posted
+// it returned long ago...so the port is told by an event, even of errors.
+//
+static int32_t Check_File_Io(REBREQ *file, bool retry)
+{
+    struct rebol_devreq *req = Req(file);
+    struct Reb_File_Io *io = ReqFile(file)->io;
+
+    if (not File_Io_Done(io)) {
+        OS_Watch_Request(file, File_Io_Fd(io), RRF_WANT_READ);
+        return DR_PEND;
+    }
+
+    OS_Unwatch_Request(file);  // before File_Io_Finish() closes the handle
+
+    size_t actual;
+    int errnum = File_Io_Finish(io, &actual);
+    ReqFile(file)->io = nullptr;
+
+    req->actual = actual;
+    ReqFile(file)->index += actual;
+    req->modes |= RFM_RESEEK;  // the descriptor's own position didn't move
+
+    if (ReqFile(file)->index > ReqFile(file)->size)  // wrote past the end
+        ReqFile(file)->size = ReqFile(file)->index;
+
+    if (retry)
+        Signal_File_Io(file, errnum);
+    else if (errnum != 0)
+        rebFail_OS (errnum);
+
+    return DR_DONE;
+}
+
+
+// Post an RFM_ASYNC READ or WRITE (see %file-uring.c).  It is done at the
+// port's index with pread() or pwrite() semantics, so it doesn't use the
+// descriptor's position (Check_File_Io() says to reseek for the next one).
+//
+static int32_t Start_File_Io(REBREQ *file, bool writing)
+{
+    struct rebol_devreq *req = Req(file);
+    assert(ReqFile(file)->io == nullptr);
+
+    if (writing and (req->modes & RFM_APPEND)) {  // as in Write_File()
+        req->modes &= ~RFM_APPEND;
+        ReqFile(file)->index = -1;
+    }
+    if (ReqFile(file)->index == -1 and not Seek_File_64(file))  // append
+        rebFail_OS (errno);
+
+    if (writing and (req->modes & RFM_TRUNCATE))
+        if (ftruncate(req->requestee.id, ReqFile(file)->index) != 0)
+            rebFail_OS (errno);
+
+    if (writing and (req->modes & RFM_TEXT)) {  // STRMODE_NO_CR for now
+        const REBYTE *cr = cast(const REBYTE*,
+            memchr(req->common.data, CR, req->length)
+        );
+        if (cr != nullptr)
+            fail (Error_Illegal_Cr(cr, req->common.data));
+    }
+
+    ReqFile(file)->io = File_Io_Start(
+        req->requestee.id,
+        writing,
+        req->common.data,
+        req->length,
+        ReqFile(file)->index
+    );
+    return Check_File_Io(file, false);
+}
+
+
 //
 //  Read_File: C
 //
@@ -461,6 +590,12 @@ DEVICE_CMD Read_File(REBREQ *file)
 
     assert(req->requestee.id != 0);
 
+    if (ReqFile(file)->io != nullptr)  // retried by Poll_Default()
+        return Check_File_Io(file, true);
+
+    if (req->modes & RFM_ASYNC)
+        return Start_File_Io(file, false);
+
     if ((req->modes & (RFM_SEEK | RFM_RESEEK)) != 0) {
         req->modes &= ~RFM_RESEEK;
         if (not Seek_File_64(file))
@@ -493,6 +628,12 @@ DEVICE_CMD Write_File(REBREQ *file)
 
     assert(req->requestee.id != 0);
 
+    if (ReqFile(file)->io != nullptr)  // retried by Poll_Default()
+        return Check_File_Io(file, true);
+
+    if (req->modes & RFM_ASYNC)
+        return Start_File_Io(file, true);
+
     if (req->modes & RFM_APPEND) {
         req->modes &= ~RFM_APPEND;
         lseek(req->requestee.id, 0, SEEK_END);
@@ -701,6 +842,21 @@ DEVICE_CMD Rename_File(REBREQ *file)
 }
 
 
+// Working out the zone takes a localtime() and two mktime()s, and glibc's
+// localtime() may stat() /etc/localtime each time to see if it changed.
+// That's most of the cost of making a file's DATE!.  But the offset only
+// changes at daylight savings transitions (which are on quarter hours) or if
+// TZ is changed.  So the last answer is reused for the rest of its quarter
+// hour, so long as TZ is the same.
+//
+#define ZONE_CACHE_SECS (15 * 60)
+#define ZONE_CACHE_TZ_MAX 128
+
+static time_t zone_cache_quarter = -1;  // now_secs / ZONE_CACHE_SECS
+static int zone_cache_minutes;
+static char zone_cache_tz[ZONE_CACHE_TZ_MAX];  // TZ at the time, "" if unset
+
+
 //
 //  Get_Timezone: C
 //
@@ -714,11 +870,25 @@ DEVICE_CMD Rename_File(REBREQ *file)
 // !!! This code is currently repeated in the time extension, until a better
 // way of sharing it is accomplished.
 //
-static int Get_Timezone(struct tm *utc_tm_unused)
+static int Get_Timezone(time_t now_secs)
 {
-    time_t now_secs;
-    time(&now_secs); // UNIX seconds (since "epoch")
-    struct tm local_tm = *localtime(&now_secs);
+    const char *tz = getenv("TZ");
+    if (tz == nullptr)
+        tz = "";
+    bool cacheable = (strlen(tz) < ZONE_CACHE_TZ_MAX);
+
+    if (
+        cacheable
+        and now_secs / ZONE_CACHE_SECS == zone_cache_quarter
+        and strcmp(tz, zone_cache_tz) == 0
+    ){
+        return zone_cache_minutes;
+    }
+
+    tzset();  // localtime_r() isn't required to notice a change of TZ
+
+    struct tm local_tm;
+    localtime_r(&now_secs, &local_tm);
 
   #if !defined(HAS_SMART_TIMEZONE)
     //
@@ -740,15 +910,19 @@ static int Get_Timezone(struct tm *utc_tm_unused)
     // Then the time zone can be calculated by diffing it from a mktime()
     // inversion of a suitable local time.
     //
-    // !!! For some reason, R3-Alpha expected the caller to pass in a utc tm
-    // structure pointer but then didn't use it, choosing to make another call
-    // to gmtime().  Review.
-    //
-    UNUSED(utc_tm_unused);
-    time_t now_secs_gm = mktime(gmtime(&now_secs));
+    struct tm utc_tm;
+    gmtime_r(&now_secs, &utc_tm);
+    time_t now_secs_gm = mktime(&utc_tm);
 
     double diff = difftime(mktime(&local_tm), now_secs_gm);
-    return cast(int, diff / 60);
+    int minutes = cast(int, diff / 60);
+
+    if (cacheable) {
+        zone_cache_quarter = now_secs / ZONE_CACHE_SECS;
+        zone_cache_minutes = minutes;
+        strcpy(zone_cache_tz, tz);
+    }
+    return minutes;
 }
 
 
@@ -770,30 +944,131 @@ REBVAL *File_Time_To_Rebol(REBREQ *file)
     else
         stime = ReqFile(file)->time.l;
 
-    // gmtime() is badly named.  It's utc time.  Note we have to be careful as
-    // it returns a system static buffer, so we have to copy the result
-    // via dereference to avoid calls to localtime() inside Get_Timezone
-    // from corrupting the buffer before it gets used.
+    // gmtime() is badly named.  It's utc time.  The thread-safe variant is
+    // used, so a localtime() inside Get_Timezone() can't overwrite it.
     //
-    // !!! Consider usage of the thread-safe variants, though they are not
-    // available on all older systems.
-    //
-    struct tm utc_tm = *gmtime(&stime);
-
-    int zone = Get_Timezone(&utc_tm);
+    struct tm utc_tm;
+    gmtime_r(&stime, &utc_tm);
 
-    return rebValue("ensure date! (make-date-ymdsnz",
-        rebI(utc_tm.tm_year + 1900),  // year
-        rebI(utc_tm.tm_mon + 1),  // month
-        rebI(utc_tm.tm_mday),  // day
-        rebI(
+    // !!! This is the zone as of now, not as of the file's time (historical).
+    //
+    int zone = Get_Timezone(time(nullptr));
+
+    return Init_Date_Ymdnz(
+        Alloc_Value(),
+        utc_tm.tm_year + 1900,
+        utc_tm.tm_mon + 1,
+        utc_tm.tm_mday,
+        SECS_TO_NANO(
             utc_tm.tm_hour * 3600
             + utc_tm.tm_min * 60
             + utc_tm.tm_sec
-        ),  // secs
-        rebI(0),  // nanoseconds (file times don't have this)
-        rebI(zone),  // zone
-    ")");
+        ),  // file times don't have nanoseconds
+        zone
+    );
+}
+
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+    #define MAP_ANONYMOUS MAP_ANON  // older BSD and OS X name
+#endif
+
+static void Unmap_File_Cleaner(const REBVAL *v)
+{
+    munmap(VAL_HANDLE_VOID_POINTER(v), VAL_HANDLE_LEN(v));
+}
+
+
+//
+//  Map_File_Binary: C
+//
+// Make a read-only BINARY! of `part` bytes of a file starting at `seek`
+// (or the rest of the file, if `part` is negative) whose data is mapped in
+// from the file instead of read.  The pages come from the OS file cache, so
+// processes mapping the same file share one copy, and only the pages that
+// get touched are ever read from disk.
+//
+// The binary needs a '\0' byte after its data.  That is past the end of the
+// file if the region runs to the end of it, and if the file ends on a page
+// boundary then reading there would crash.  So the whole range is reserved
+// as zeroed anonymous memory first, and only the pages the data covers
+// completely are mapped over that from the file.  The bytes in the last
+// partial page are read into the anonymous page.
+//
+REBVAL *Map_File_Binary(const REBVAL *path, int64_t seek, int64_t part)
+{
+    char *path_utf8 = rebSpell("file-to-local/full", path);
+    int h = open(path_utf8, O_RDONLY | O_BINARY);
+    rebFree(path_utf8);
+
+    if (h < 0)
+        rebFail_OS (errno);
+
+    struct stat info;
+    if (fstat(h, &info) != 0) {
+        int errno_cache = errno;
+        close(h);
+        rebFail_OS (errno_cache);
+    }
+
+    int64_t size = info.st_size;
+    if (seek < 0 or seek > size) {
+        close(h);
+        fail (Error_Index_Out_Of_Range_Raw());
+    }
+    if (part < 0 or part > size - seek)
+        part = size - seek;  // like READ/PART, don't go past the end
+
+    size_t page = sysconf(_SC_PAGESIZE);
+    if (part > 0x7fffffff - cast(int64_t, 2 * page)) {  // REBLEN and bias
+        close(h);
+        fail ("MAP-FILE can't map 2GB or more at once");
+    }
+
+    off_t start = seek - (seek % page);  // mmap() offsets are page aligned
+    size_t lead = seek - start;
+    size_t whole = (lead + part) - ((lead + part) % page);  // from the file
+    size_t total = (lead + part + 1 + page - 1) / page * page;  // + '\0'
+
+    char *base = cast(char*, mmap(
+        nullptr, total, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+    ));
+    if (base == MAP_FAILED) {
+        int errno_cache = errno;
+        close(h);
+        rebFail_OS (errno_cache);
+    }
+
+    if (
+        (
+            whole != 0
+            and mmap(
+                base, whole, PROT_READ, MAP_SHARED | MAP_FIXED, h, start
+            ) == MAP_FAILED
+        )
+        or pread(
+            h, base + whole, lead + part - whole, start + whole
+        ) != cast(ssize_t, lead + part - whole)
+        or mprotect(base + whole, total - whole, PROT_READ) != 0
+    ){
+        int errno_cache = errno;
+        munmap(base, total);
+        close(h);
+        rebFail_OS (errno_cache);
+    }
+
+    close(h);  // the mapping stays valid without the file descriptor
+
+    REBVAL *mapping = rebHandle(base, total, &Unmap_File_Cleaner);
+    REBBIN *bin = Make_Binary_Mapped(
+        mapping,
+        cast(REBYTE*, base) + lead,
+        cast(REBLEN, part)
+    );
+    rebRelease(mapping);  // the binary keeps it alive
+
+    return Init_Binary(Alloc_Value(), bin);
 }
 
 
@@ -960,7 +1235,7 @@ bool Set_Current_Dir_Value(const REBVAL *path)
 
 static DEVICE_CMD_CFUNC Dev_Cmds[RDC_MAX] = {
     0,
-    0,
+    Quit_File,
     Open_File,
     Close_File,
     Read_File,
@@ -15,12 +15,27 @@ typedef struct sInt64 {
 } FILETIME_DEVREQ;
 #pragma pack()
 
+struct Reb_File_Io;  // see %file-uring.c
+
 struct devreq_file {
     struct rebol_devreq devreq;
     const REBVAL *path;     // file string (in OS local format)
     int64_t size;           // file size
     int64_t index;          // file index position
     FILETIME_DEVREQ time;   // file modification time (struct)
+
+    REBVAL *buffer;  // API handle on the data of an RFM_ASYNC READ or WRITE
+    bool held;  // SERIES_INFO_HOLD was set on buffer's series for the I/O
+    struct Reb_File_Io *io;  // the posted operation, if not done yet
+
+    REBLEN ahead_index;  // next unused byte of READ/LINES read-ahead
+    REBLEN ahead_tail;  // how much of port/data was read ahead, 0 if none
+
+    REBYTE *batch;  // small WRITEs not written out yet (malloc()'d)
+    REBLEN batch_used;
+    REBLEN batch_size;  // 0 if WRITEs aren't batched, see MODIFY 'BUFFER
+    bool batch_append;  // the batch goes at the end of the file
+    bool batch_text;  // the batch is of TEXT! (RFM_TEXT)
 };
 
 inline static struct devreq_file* ReqFile(REBREQ *req) {
@@ -30,6 +45,43 @@ inline static struct devreq_file* ReqFile(REBREQ *req) {
 
 extern REBVAL *File_Time_To_Rebol(REBREQ *file);
 extern REBVAL *Query_File_Or_Dir(const REBVAL *port, REBREQ *file);
+extern REBVAL *Map_File_Binary(
+    const REBVAL *path,
+    int64_t seek,
+    int64_t part
+);
+extern void Signal_File_Io(REBREQ *file, int errnum);
+
+#define MAX_TREE_THREADS 32  // READ-TREE/THREADS limit
+
+enum Reb_Tree_Type {
+    TREE_ANY,
+    TREE_FILES,
+    TREE_DIRS
+};
+
+extern REBVAL *Read_Tree(
+    const REBVAL *dir,
+    const char *match,
+    enum Reb_Tree_Type type,
+    const int64_t *newer_than,
+    REBLEN num_threads
+);
+
+#if !defined(TO_WINDOWS)
+    extern struct Reb_File_Io *File_Io_Start(
+        int fd,
+        bool writing,
+        unsigned char *data,
+        size_t length,
+        int64_t offset
+    );
+    extern bool File_Io_Done(struct Reb_File_Io *io);
+    extern int File_Io_Fd(struct Reb_File_Io *io);
+    extern int File_Io_Finish(struct Reb_File_Io *io, size_t *actual);
+    extern void File_Io_Cancel(struct Reb_File_Io *io);
+    extern void Shutdown_File_Io(void);
+#endif
 
 #ifdef TO_WINDOWS
     #define OS_DIR_SEP '\\'  // file path separator (Thanks Bill.)
@@ -0,0 +1,519 @@
+//
+//  File: %file-uring.c
+//  Summary: "File reads and writes that complete in the event loop"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A READ or WRITE on a file port with an AWAKE handler is posted here as an
+// "io", and the port gets a READ or WROTE event when it's done (see
+// RFM_ASYNC).  With USE_IO_URING in %systems.r, an io is handed to the Linux
+// kernel through an io_uring, and the interpreter goes on running code (or
+// servicing sockets) while the disk works.
+//
+// Completions signal an eventfd.  The file device watches it with
+// OS_Watch_Request() as the network device would watch a socket, so a WAIT
+// wakes up when an io finishes.  But a watched handle can only belong to one
+// request, so each io watches its own dup() of the eventfd.  All the dups
+// become readable together, and the ones whose io isn't done yet just go
+// back to waiting.
+//
+// The rings are set up on the first io.  If that fails (a kernel older than
+// 5.1, or io_uring blocked by a seccomp policy), or the build is not using
+// io_uring, an io is done with pread() or pwrite() when it is started.  So
+// it is already done, and the event comes on the next WAIT.
+//
+// !!! This uses the raw system calls instead of liburing, so there's no new
+// library dependency.  READV and WRITEV are used (not READ and WRITE, which
+// need 5.6) so any kernel with io_uring can run it.
+//
+
+#ifndef __cplusplus
+    #define _GNU_SOURCE  // pread(), syscall(), MAP_POPULATE (C++ implies it)
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#if defined(USE_IO_URING)
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+    #include <sys/eventfd.h>
+    #include <linux/io_uring.h>
+#endif
+
+#include "sys-core.h"
+
+#include "file-req.h"
+
+struct Reb_File_Io {
+    int fd;  // the file (not owned)
+    bool write;
+    unsigned char *data;
+    size_t length;
+    int64_t offset;
+    size_t actual;  // bytes transferred so far
+    int errnum;  // errno value, if it failed
+
+  #if defined(USE_IO_URING)
+    struct iovec iov;  // the part not transferred yet, for READV or WRITEV
+    bool in_flight;  // kernel owns the buffer until it posts a completion
+    bool reaped;  // completion posted, but File_Io_Done() hasn't seen it
+    int32_t result;  // from the completion, bytes or -errno
+    int watch_fd;  // dup() of Event_Fd, or -1
+  #endif
+};
+
+
+// Do the rest of an io with pread() or pwrite().
+//
+static void Transfer_Io(struct Reb_File_Io *io)
+{
+    while (io->actual < io->length) {
+        ssize_t n = io->write
+            ? pwrite(
+                io->fd, io->data + io->actual, io->length - io->actual,
+                io->offset + io->actual
+            )
+            : pread(
+                io->fd, io->data + io->actual, io->length - io->actual,
+                io->offset + io->actual
+            );
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            io->errnum = errno;
+            return;
+        }
+        if (n == 0)
+            return;  // end of file
+        io->actual += n;
+    }
+}
+
+
+#if defined(USE_IO_URING)
+
+#define URING_ENTRIES 64
+
+static bool Uring_Tried;  // setup happens on the first io
+static int Ring_Fd = -1;
+static int Event_Fd = -1;
+
+static void *Sq_Ring;
+static size_t Sq_Ring_Size;
+static void *Cq_Ring;  // may be the same mapping as Sq_Ring
+static size_t Cq_Ring_Size;
+static struct io_uring_sqe *Sqes;
+static size_t Sqes_Size;
+
+static unsigned *Sq_Tail;
+static unsigned *Sq_Mask;
+static unsigned *Sq_Array;
+static unsigned *Cq_Head;
+static unsigned *Cq_Tail;
+static unsigned *Cq_Mask;
+static struct io_uring_cqe *Cqes;
+static unsigned Cq_Entries;
+
+static unsigned In_Flight;  // never more than Cq_Entries, so no overflow
+static unsigned Unclaimed;  // reaped, but File_Io_Done() not called yet
+
+
+static void Close_Uring(void)
+{
+    if (Sqes != nullptr)
+        munmap(Sqes, Sqes_Size);
+    if (Cq_Ring != nullptr and Cq_Ring != Sq_Ring)
+        munmap(Cq_Ring, Cq_Ring_Size);
+    if (Sq_Ring != nullptr)
+        munmap(Sq_Ring, Sq_Ring_Size);
+    Sqes = nullptr;
+    Cq_Ring = nullptr;
+    Sq_Ring = nullptr;
+
+    if (Event_Fd != -1)
+        close(Event_Fd);
+    if (Ring_Fd != -1)
+        close(Ring_Fd);
+    Event_Fd = -1;
+    Ring_Fd = -1;
+}
+
+
+static bool Open_Uring(void)
+{
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+
+    Ring_Fd = syscall(__NR_io_uring_setup, URING_ENTRIES, &p);
+    if (Ring_Fd < 0) {
+        Ring_Fd = -1;
+        return false;
+    }
+
+    Sq_Ring_Size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    Cq_Ring_Size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+
+    bool single = false;
+  #if defined(IORING_FEAT_SINGLE_MMAP)
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {  // Linux 5.4 and up
+        single = true;
+        if (Cq_Ring_Size > Sq_Ring_Size)
+            Sq_Ring_Size = Cq_Ring_Size;
+    }
+  #endif
+
+    Sq_Ring = mmap(
+        nullptr, Sq_Ring_Size, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, Ring_Fd, IORING_OFF_SQ_RING
+    );
+    if (Sq_Ring == MAP_FAILED) {
+        Sq_Ring = nullptr;
+        goto failed;
+    }
+
+    if (single)
+        Cq_Ring = Sq_Ring;
+    else {
+        Cq_Ring = mmap(
+            nullptr, Cq_Ring_Size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, Ring_Fd, IORING_OFF_CQ_RING
+        );
+        if (Cq_Ring == MAP_FAILED) {
+            Cq_Ring = nullptr;
+            goto failed;
+        }
+    }
+
+    Sqes_Size = p.sq_entries * sizeof(struct io_uring_sqe);
+    Sqes = cast(struct io_uring_sqe*, mmap(
+        nullptr, Sqes_Size, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, Ring_Fd, IORING_OFF_SQES
+    ));
+    if (Sqes == MAP_FAILED) {
+        Sqes = nullptr;
+        goto failed;
+    }
+
+  blockscope {
+    char *sq = cast(char*, Sq_Ring);
+    Sq_Tail = cast(unsigned*, sq + p.sq_off.tail);
+    Sq_Mask = cast(unsigned*, sq + p.sq_off.ring_mask);
+    Sq_Array = cast(unsigned*, sq + p.sq_off.array);
+
+    char *cq = cast(char*, Cq_Ring);
+    Cq_Head = cast(unsigned*, cq + p.cq_off.head);
+    Cq_Tail = cast(unsigned*, cq + p.cq_off.tail);
+    Cq_Mask = cast(unsigned*, cq + p.cq_off.ring_mask);
+    Cqes = cast(struct io_uring_cqe*, cq + p.cq_off.cqes);
+    Cq_Entries = p.cq_entries;
+  }
+
+    Event_Fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (Event_Fd < 0) {
+        Event_Fd = -1;
+        goto failed;
+    }
+    if (syscall(
+        __NR_io_uring_register, Ring_Fd, IORING_REGISTER_EVENTFD, &Event_Fd, 1
+    ) != 0){
+        goto failed;
+    }
+
+    return true;
+
+  failed:
+    Close_Uring();
+    return false;
+}
+
+
+// Put the rest of an io on the submission queue and tell the kernel about
+// it.  Returns false if it couldn't be submitted (the caller can do it with
+// Transfer_Io() instead).
+//
+static bool Submit_Io(struct Reb_File_Io *io)
+{
+    if (In_Flight == Cq_Entries)
+        return false;  // completions could overflow the queue
+
+    io->iov.iov_base = io->data + io->actual;
+    io->iov.iov_len = io->length - io->actual;
+
+    unsigned tail = *Sq_Tail;  // only we write it (no SQPOLL thread)
+    unsigned index = tail & *Sq_Mask;
+    struct io_uring_sqe *sqe = &Sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = io->write ? IORING_OP_WRITEV : IORING_OP_READV;
+    sqe->fd = io->fd;
+    sqe->addr = cast(uintptr_t, &io->iov);
+    sqe->len = 1;
+    sqe->off = io->offset + io->actual;
+    sqe->user_data = cast(uintptr_t, io);
+    Sq_Array[index] = index;
+
+    __atomic_store_n(Sq_Tail, tail + 1, __ATOMIC_RELEASE);
+
+    int n;
+    do {
+        n = syscall(__NR_io_uring_enter, Ring_Fd, 1, 0, 0, nullptr, 0);
+    } while (n < 0 and errno == EINTR);
+
+    if (n != 1) {  // kernel didn't take it, so it's safe to take back
+        __atomic_store_n(Sq_Tail, tail, __ATOMIC_RELEASE);
+        return false;
+    }
+
+    io->in_flight = true;
+    ++In_Flight;
+    return true;
+}
+
+
+// Take the completions the kernel has posted.  The eventfd is cleared first,
+// so a completion posted right after this will make it readable again.  But
+// if the poll that woke us up ran out of room to flag every io's dup of the
+// eventfd, an io that is done might not have been told...so the eventfd is
+// kept readable while there are any done ios not picked up yet.
+//
+static void Reap_Completions(void)
+{
+    uint64_t count;
+    if (read(Event_Fd, &count, sizeof(count)) < 0)
+        assert(errno == EAGAIN);  // nothing posted since the last time
+
+    unsigned head = *Cq_Head;
+    unsigned tail = __atomic_load_n(Cq_Tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head) {
+        struct io_uring_cqe *cqe = &Cqes[head & *Cq_Mask];
+        struct Reb_File_Io *io = cast(
+            struct Reb_File_Io*, cast(uintptr_t, cqe->user_data)
+        );
+        io->result = cqe->res;
+        io->in_flight = false;
+        io->reaped = true;
+        --In_Flight;
+        ++Unclaimed;
+    }
+    __atomic_store_n(Cq_Head, head, __ATOMIC_RELEASE);
+
+    if (Unclaimed != 0) {
+        count = 1;
+        if (write(Event_Fd, &count, sizeof(count)) < 0)
+            assert(errno == EAGAIN);  // already readable
+    }
+}
+
+#endif
+
+
+//
+//  File_Io_Start: C
+//
+// Start reading or writing `length` bytes at `data` from or to the file `fd`
+// at `offset`.  The memory must stay put until File_Io_Done() is true (or
+// File_Io_Cancel() has been called).
+//
+struct Reb_File_Io *File_Io_Start(
+    int fd,
+    bool writing,
+    unsigned char *data,
+    size_t length,
+    int64_t offset
+){
+    struct Reb_File_Io *io = cast(struct Reb_File_Io*,
+        malloc(sizeof(struct Reb_File_Io))
+    );
+    if (io == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_File_Io)));
+
+    io->fd = fd;
+    io->write = writing;
+    io->data = data;
+    io->length = length;
+    io->offset = offset;
+    io->actual = 0;
+    io->errnum = 0;
+
+  #if defined(USE_IO_URING)
+    io->in_flight = false;
+    io->reaped = false;
+    io->watch_fd = -1;
+
+    if (not Uring_Tried) {
+        Uring_Tried = true;
+        Open_Uring();
+    }
+
+    if (Ring_Fd != -1 and length != 0 and Submit_Io(io))
+        return io;
+  #endif
+
+    Transfer_Io(io);
+    return io;
+}
+
+
+//
+//  File_Io_Done: C
+//
+// A write that the kernel did only part of is resubmitted for the rest, so
+// this is true only when the whole io has finished (or failed).
+//
+bool File_Io_Done(struct Reb_File_Io *io)
+{
+  #if defined(USE_IO_URING)
+    if (io->in_flight)
+        Reap_Completions();
+    if (io->in_flight)
+        return false;
+
+    if (io->reaped) {
+        io->reaped = false;
+        --Unclaimed;
+
+        if (io->result < 0) {
+            if (io->result != -EINTR and io->result != -EAGAIN) {
+                io->errnum = -io->result;
+                return true;
+            }
+        }
+        else {
+            io->actual += io->result;
+            if (io->result == 0 or not io->write)
+                return true;  // a short read is the end of the file
+        }
+
+        if (io->actual < io->length and not Submit_Io(io))
+            Transfer_Io(io);
+        return not io->in_flight;
+    }
+  #else
+    UNUSED(io);
+  #endif
+
+    return true;
+}
+
+
+//
+//  File_Io_Fd: C
+//
+// The handle to watch for RRF_WANT_READ while the io isn't done.
+//
+int File_Io_Fd(struct Reb_File_Io *io)
+{
+  #if defined(USE_IO_URING)
+    if (io->watch_fd == -1)
+        io->watch_fd = dup(Event_Fd);
+    return io->watch_fd;
+  #else
+    UNUSED(io);
+    return -1;  // never pending
+  #endif
+}
+
+
+static void Free_Io(struct Reb_File_Io *io)
+{
+  #if defined(USE_IO_URING)
+    if (io->watch_fd != -1)
+        close(io->watch_fd);
+  #endif
+    free(io);
+}
+
+
+//
+//  File_Io_Finish: C
+//
+// Get the result of an io that is done, and free it.  Gives back 0 or the
+// errno value it failed with, and puts the number of bytes transferred in
+// `actual` (which may be short for a read, at the end of the file).
+//
+// The caller should OS_Unwatch_Request() before this closes the handle.
+//
+int File_Io_Finish(struct Reb_File_Io *io, size_t *actual)
+{
+  #if defined(USE_IO_URING)
+    assert(not io->in_flight and not io->reaped);
+  #endif
+
+    int errnum = io->errnum;
+    *actual = io->actual;
+    Free_Io(io);
+    return errnum;
+}
+
+
+//
+//  File_Io_Cancel: C
+//
+// Free an io that may not be done, e.g. because its port is being closed.
+//
+// !!! The kernel may be writing into the buffer, so this waits for the
+// completion.  IORING_OP_ASYNC_CANCEL could speed that up, but it needs 5.5
+// and a file io can't be interrupted mid-transfer anyway, so the wait is
+// no longer than the disk takes.
+//
+void File_Io_Cancel(struct Reb_File_Io *io)
+{
+  #if defined(USE_IO_URING)
+    while (io->in_flight) {
+        syscall(
+            __NR_io_uring_enter, Ring_Fd, 0, 1, IORING_ENTER_GETEVENTS,
+            nullptr, 0
+        );
+        Reap_Completions();
+    }
+    if (io->reaped)
+        --Unclaimed;
+  #endif
+
+    Free_Io(io);
+}
+
+
+//
+//  Shutdown_File_Io: C
+//
+// Any ios still going when the device quits are waited for (their memory is
+// leaked, as the process is ending).
+//
+void Shutdown_File_Io(void)
+{
+  #if defined(USE_IO_URING)
+    if (Ring_Fd == -1)
+        return;
+
+    while (In_Flight != 0) {
+        syscall(
+            __NR_io_uring_enter, Ring_Fd, 0, 1, IORING_ENTER_GETEVENTS,
+            nullptr, 0
+        );
+        Reap_Completions();
+    }
+
+    Close_Uring();
+    Uring_Tried = false;
+    Unclaimed = 0;
+  #endif
+}
@@ -678,6 +678,25 @@ REBVAL *File_Time_To_Rebol(REBREQ *file)
 }
 
 
+//
+//  Map_File_Binary: C
+//
+// !!! Windows has file mapping (CreateFileMapping() and MapViewOfFile()),
+// but no way to put a zeroed page after the view to hold the terminator a
+// BINARY! needs, as the POSIX version does with MAP_FIXED.  Until that is
+// worked out (e.g. with VirtualAlloc2() placeholders on Windows 10), this
+// reads the region into an ordinary frozen binary, so MAP-FILE works the
+// same way but doesn't save the copy.
+//
+REBVAL *Map_File_Binary(const REBVAL *path, int64_t seek, int64_t part)
+{
+    if (part < 0)
+        return rebValue("freeze read/seek", path, rebI(seek));
+
+    return rebValue("freeze read/seek/part", path, rebI(seek), rebI(part));
+}
+
+
 //
 //  Get_Current_Dir_Value: C
 //
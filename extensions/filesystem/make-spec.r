@@ -9,6 +9,7 @@ includes: [
 depends: compose [
     %filesystem/p-file.c
     %filesystem/p-dir.c
+    %filesystem/read-tree.c
 
     (switch system-config/os-base [
         'Windows [
@@ -19,7 +20,7 @@ depends: compose [
         ; Other options exist, e.g. "aio.h"
         ; https://fwheel.net/aio.html
         ;
-        [%filesystem/file-posix.c]
+        [%filesystem/file-posix.c %filesystem/file-uring.c]
     ])
 
     (if "1" = get-env "USE_BACKDATED_GLIBC" [
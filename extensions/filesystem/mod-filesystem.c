@@ -603,3 +603,94 @@ REBNATIVE(get_current_exec)
 
     return Get_Current_Exec();
 }
+
+
+//
+//  export map-file: native [
+//
+//  {Get a file's bytes as a read-only BINARY! without reading them in}
+//
+//      return: "Pages mapped from the file, loaded as they are used"
+//          [binary!]
+//      path [file!]
+//      /seek "Start at this byte offset"
+//          [integer!]
+//      /part "Map at most this many bytes"
+//          [integer!]
+//  ]
+//
+REBNATIVE(map_file)
+{
+    FILESYSTEM_INCLUDE_PARAMS_OF_MAP_FILE;
+
+    int64_t seek = REF(seek) ? VAL_INT64(ARG(seek)) : 0;
+
+    int64_t part = -1;  // to the end of the file
+    if (REF(part)) {
+        part = VAL_INT64(ARG(part));
+        if (part < 0)
+            fail (PAR(part));
+    }
+
+    return Map_File_Binary(ARG(path), seek, part);
+}
+
+
+//
+//  export read-tree: native [
+//
+//  {List everything under a directory, with paths relative to it}
+//
+//      return: "Sorted, directories end in a slash (links aren't followed)"
+//          [block!]
+//      dir [file!]
+//      /match "Only list names matching this, with * and ? wildcards"
+//          [text!]
+//      /type "FILE or DIR, to only list that type of entry"
+//          [word!]
+//      /newer "Only list entries modified after this"
+//          [date!]
+//      /threads "Number of threads to list directories with"
+//          [integer!]
+//  ]
+//
+REBNATIVE(read_tree)
+{
+    FILESYSTEM_INCLUDE_PARAMS_OF_READ_TREE;
+
+    enum Reb_Tree_Type type = TREE_ANY;
+    if (REF(type))
+        type = cast(enum Reb_Tree_Type, rebUnboxInteger(
+            "switch", rebQ(ARG(type)), "[",
+                "'file [1] 'dir [2]",  // enum order
+                "fail {READ-TREE/TYPE must be FILE or DIR}",
+            "]"
+        ));
+
+    int64_t newer_than = 0;
+    if (REF(newer))  // a date without a time is taken as its midnight, UTC
+        newer_than = rebUnboxInteger(
+            "let d: copy", ARG(newer),
+            "d/time: default [0:00]",
+            "d/zone: default [0:00]",
+            "to integer! to decimal! difference d 1-Jan-1970/0:00+0:00"
+        );
+
+    REBLEN threads = 1;
+    if (REF(threads)) {
+        REBINT n = VAL_INT32(ARG(threads));
+        if (n < 1 or n > MAX_TREE_THREADS)
+            fail (PAR(threads));
+        threads = n;
+    }
+
+    char *match = REF(match) ? rebSpell(ARG(match)) : nullptr;
+
+    REBVAL *result = Read_Tree(
+        ARG(dir), match, type, REF(newer) ? &newer_than : nullptr, threads
+    );
+
+    if (match)
+        rebFree(match);
+    return result;
+}
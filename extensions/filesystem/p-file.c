@@ -28,6 +28,15 @@
 
 #define MAX_READ_MASK 0x7FFFFFFF  // max size per chunk
 
+// MODIFY port 'BUFFER won't hold on to more than this many unwritten bytes.
+//
+#define MAX_WRITE_BATCH (64 * 1024 * 1024)
+
+// READ/LINES of an open port reads ahead this much at a time (more, if a
+// line is longer), see Read_File_Lines().
+//
+#define READ_LINES_AHEAD (256 * 1024)
+
 enum act_open_mask {
     AM_OPEN_NEW = 1 << 0,
     AM_OPEN_READ = 1 << 1,
@@ -180,6 +189,342 @@ static void Read_File_Port(
 }
 
 
+//
+//  Release_File_Buffer: C
+//
+static void Release_File_Buffer(REBREQ *file)
+{
+    REBVAL *buffer = ReqFile(file)->buffer;
+    if (ReqFile(file)->held)
+        CLEAR_SERIES_INFO(m_cast(REBSER*, VAL_SERIES(buffer)), HOLD);
+    rebRelease(buffer);
+
+    ReqFile(file)->buffer = nullptr;
+    ReqFile(file)->held = false;
+}
+
+
+//
+//  Signal_File_Io: C
+//
+// Called when an RFM_ASYNC READ or WRITE is done, to give the port a READ
+// or WROTE event.  If it failed, the port gets an ERROR event instead with
+// the error in `port/error` (as network ports do).
+//
+void Signal_File_Io(REBREQ *file, int errnum)
+{
+    struct rebol_devreq *req = Req(file);
+    bool reading = (req->command == RDC_READ);
+
+    REBSER *s = m_cast(REBSER*, VAL_SERIES(ReqFile(file)->buffer));
+    Release_File_Buffer(file);  // drop the HOLD before changing the length
+    if (reading)
+        TERM_BIN_LEN(BIN(s), req->actual);  // no GC since the release
+
+    REBVAL *port = CTX_ARCHETYPE(MISC(ReqPortCtx, file));
+
+    if (errnum != 0) {
+        rebElide(
+            "(", port, ")/error:", rebR(rebError_OS(errnum)),
+
+            "insert system/ports/system make event! [",
+                "type: 'error",
+                "port:", port,
+            "]"
+        );
+        return;
+    }
+
+    rebElide(
+        "insert system/ports/system make event! [",
+            "type:", reading ? "'read" : "'wrote",
+            "port:", port,
+        "]"
+    );
+}
+
+
+//
+//  Post_File_Port: C
+//
+// A file port with an AWAKE handler does its READ and WRITE in the event
+// loop: the native gives back the port right away, and the AWAKE gets a
+// READ or WROTE event when the transfer is done.  So a program can go on
+// computing, or serving sockets, while the disk works (see %file-uring.c).
+//
+// The data stays alive (and under a HOLD, so it can't be changed or moved)
+// until then.
+//
+static void Post_File_Port(
+    REBREQ *file,
+    const REBVAL *data,
+    enum Reb_Device_Command command
+){
+    struct rebol_devreq *req = Req(file);
+    assert(ReqFile(file)->buffer == nullptr);
+
+    ReqFile(file)->buffer = Copy_Cell(Alloc_Value(), data);
+    rebUnmanage(ReqFile(file)->buffer);  // lives until the I/O is done
+
+    REBSER *s = m_cast(REBSER*, VAL_SERIES(data));
+    if (NOT_SERIES_INFO(s, HOLD)) {  // e.g. already held by a FOR-EACH
+        SET_SERIES_INFO(s, HOLD);
+        ReqFile(file)->held = true;
+    }
+
+    req->modes |= RFM_ASYNC;
+    REBVAL *result = OS_DO_DEVICE(file, command);
+    req->modes &= ~RFM_ASYNC;
+
+    if (result == nullptr)
+        return;  // pending, device calls Signal_File_Io() when it's done
+
+    if (rebDid("error?", result)) {
+        Release_File_Buffer(file);
+        rebJumps("fail", result);
+    }
+    rebRelease(result);
+
+    Signal_File_Io(file, 0);  // done already, e.g. not using io_uring
+}
+
+
+//
+//  Drop_Read_Ahead: C
+//
+// Forget what READ/LINES read ahead but didn't use, and move the port back
+// to the position of the first unused byte.  Everything but READ/LINES does
+// this first, so it sees the port where the lines left off.
+//
+static void Drop_Read_Ahead(REBREQ *file)
+{
+    struct devreq_file *f = ReqFile(file);
+    f->index -= f->ahead_tail - f->ahead_index;
+    f->ahead_index = 0;
+    f->ahead_tail = 0;
+    Req(file)->modes |= RFM_RESEEK;
+}
+
+
+//
+//  Read_File_Lines: C
+//
+// READ/LINES of an open file port gives back up to `max` lines from where
+// the port is, with lines ending (like DELINE/LINES) in LF, CR LF, or CR.
+//
+// The bytes are read ahead into port/data, which is reused from one call to
+// the next, so going through a huge file N lines at a time only takes the
+// memory for N lines.  With /PART, returns false if there were no lines
+// left (so a loop can stop on a null READ).
+//
+static bool Read_File_Lines(
+    REBVAL *out,
+    REBCTX *ctx,
+    REBREQ *file,
+    REBLEN max
+){
+    struct rebol_devreq *req = Req(file);
+    struct devreq_file *f = ReqFile(file);
+
+    REBVAL *port_data = CTX_VAR(ctx, STD_PORT_DATA);
+    if (f->ahead_tail == 0) {  // last READ/LINES used it all (or was none)
+        if (
+            not IS_BINARY(port_data)
+            or SER_REST(VAL_SERIES(port_data)) < READ_LINES_AHEAD + 1
+            or Is_Series_Read_Only(VAL_SERIES(port_data))
+        ){
+            GC_Write_Barrier(CTX_VARLIST(ctx));
+            Init_Binary(port_data, Make_Binary(READ_LINES_AHEAD));
+        }
+        f->ahead_index = 0;
+    }
+    REBBIN *bin = m_cast(REBBIN*, VAL_BINARY(port_data));
+
+    REBDSP dsp_orig = DSP;
+    REBLEN count = 0;
+    bool eof = false;
+
+    while (count < max) {
+        REBYTE *head = BIN_HEAD(bin);
+        REBYTE *bp = head + f->ahead_index;
+        REBYTE *tail = head + f->ahead_tail;
+
+        REBYTE *eol = bp;
+        while (eol != tail and *eol != LF and *eol != CR)
+            ++eol;
+
+        // A CR at the end of what's read ahead might be the start of CR LF,
+        // so only split there once the next byte is known.
+        //
+        if (eol != tail and (*eol == LF or eol + 1 != tail or eof)) {
+            Init_Text(
+                DS_PUSH(), Make_Sized_String_UTF8(cs_cast(bp), eol - bp)
+            );
+            SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+            ++count;
+
+            if (*eol == CR and eol + 1 != tail and eol[1] == LF)
+                ++eol;
+            f->ahead_index = eol + 1 - head;
+            continue;
+        }
+
+        if (eof) {  // end of file is an implicit line break
+            if (bp != tail) {
+                Init_Text(
+                    DS_PUSH(), Make_Sized_String_UTF8(cs_cast(bp), tail - bp)
+                );
+                SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+                ++count;
+            }
+            f->ahead_index = 0;
+            f->ahead_tail = 0;
+            break;
+        }
+
+        // Out of whole lines, so move the partial one to the head and read
+        // more after it.  If it fills the buffer, it's a long line: grow.
+        //
+        REBLEN partial = f->ahead_tail - f->ahead_index;
+        memmove(head, bp, partial);
+        f->ahead_index = 0;
+        f->ahead_tail = partial;
+
+        REBLEN capacity = SER_REST(bin) - 1;
+        if (partial == capacity) {
+            REBBIN *bigger = Make_Binary(capacity * 2);
+            memcpy(BIN_HEAD(bigger), BIN_HEAD(bin), partial);
+            GC_Write_Barrier(CTX_VARLIST(ctx));
+            Init_Binary(port_data, bigger);
+            bin = bigger;
+            capacity = SER_REST(bin) - 1;
+        }
+
+        req->common.data = BIN_AT(bin, partial);
+        req->length = capacity - partial;
+        OS_DO_DEVICE_SYNC(file, RDC_READ);
+
+        if (req->actual == 0)
+            eof = true;
+        f->ahead_tail += req->actual;
+        TERM_BIN_LEN(bin, f->ahead_tail);
+    }
+
+    if (count == 0 and eof and max != UINT32_MAX)
+        return false;
+
+    Init_Block(
+        out, Pop_Stack_Values_Core(dsp_orig, ARRAY_FLAG_NEWLINE_AT_TAIL)
+    );
+    return true;
+}
+
+
+//
+//  Flush_File_Batch: C
+//
+// Write out what WRITEs left in the batch (see Batch_File_Write()).  The
+// batch is emptied first, so a failed write doesn't get tried again by
+// every operation after it (e.g. the CLOSE after the error).
+//
+static void Flush_File_Batch(REBREQ *file)
+{
+    struct rebol_devreq *req = Req(file);
+    struct devreq_file *f = ReqFile(file);
+
+    REBLEN used = f->batch_used;
+    if (used == 0)
+        return;
+    f->batch_used = 0;
+
+    if (f->batch_append) {
+        f->index = -1;  // append
+        req->modes |= RFM_RESEEK;
+    }
+    if (f->batch_text)
+        req->modes |= RFM_TEXT;
+    else
+        req->modes &= ~RFM_TEXT;
+
+    req->common.data = f->batch;
+    req->length = used;
+    OS_DO_DEVICE_SYNC(file, RDC_WRITE);
+}
+
+
+//
+//  Batch_File_Write: C
+//
+// Copy the bytes of a WRITE (already in req->common.data) into the batch,
+// writing the batch out first if they don't fit.  A WRITE as big as the
+// whole batch isn't copied, but is written after the batch is.
+//
+static void Batch_File_Write(REBREQ *file)
+{
+    struct rebol_devreq *req = Req(file);
+    struct devreq_file *f = ReqFile(file);
+
+    REBYTE *data = req->common.data;
+    REBLEN length = req->length;
+    bool text = did (req->modes & RFM_TEXT);
+
+    // Write_File() would fail on a CR in text, so fail on this WRITE that
+    // has it instead of on the later one that writes out the batch.
+    //
+    if (text) {
+        const REBYTE *cr = cast(const REBYTE*, memchr(data, CR, length));
+        if (cr != nullptr)
+            fail (Error_Illegal_Cr(cr, data));
+    }
+
+    if (
+        f->batch_used != 0
+        and (f->batch_text != text or f->batch_used + length > f->batch_size)
+    ){
+        Flush_File_Batch(file);
+    }
+
+    if (length >= f->batch_size) {
+        if (f->batch_append) {
+            f->index = -1;  // append
+            req->modes |= RFM_RESEEK;
+        }
+        if (text)
+            req->modes |= RFM_TEXT;
+        else
+            req->modes &= ~RFM_TEXT;
+
+        req->common.data = data;
+        req->length = length;
+        OS_DO_DEVICE_SYNC(file, RDC_WRITE);
+        return;
+    }
+
+    memcpy(f->batch + f->batch_used, data, length);
+    f->batch_used += length;
+    f->batch_text = text;
+}
+
+
+//
+//  Free_File_Batch: C
+//
+static void Free_File_Batch(REBREQ *file)
+{
+    struct devreq_file *f = ReqFile(file);
+    assert(f->batch_used == 0);
+    free(f->batch);
+    f->batch = nullptr;
+    f->batch_size = 0;
+}
+
+
+enum Reb_File_Write {
+    FILE_WRITE_NOW,
+    FILE_WRITE_ASYNC,  // see Post_File_Port()
+    FILE_WRITE_BATCH  // see Batch_File_Write()
+};
+
 //
 //  Write_File_Port: C
 //
@@ -190,7 +535,8 @@ static void Write_File_Port(
     REBREQ *file,
     REBVAL *data,
     REBLEN limit,
-    bool lines
+    bool lines,
+    enum Reb_File_Write how
 ){
     struct rebol_devreq *req = Req(file);
 
@@ -228,7 +574,12 @@ static void Write_File_Port(
         req->modes &= ~RFM_TEXT; // don't do LF => CR LF, e.g. on Windows
     }
 
-    OS_DO_DEVICE_SYNC(file, RDC_WRITE);
+    if (how == FILE_WRITE_ASYNC)
+        Post_File_Port(file, data, RDC_WRITE);
+    else if (how == FILE_WRITE_BATCH)
+        Batch_File_Write(file);
+    else
+        OS_DO_DEVICE_SYNC(file, RDC_WRITE);
 }
 
 
@@ -305,6 +656,23 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
     // !!! R3-Alpha never implemented quite a number of operations on files,
     // including FLUSH, POKE, etc.
 
+    // Only one READ or WRITE can be posted at a time (see Post_File_Port()),
+    // and no other operation should happen in the middle of it.
+    //
+    if (ReqFile(file)->buffer != nullptr and VAL_WORD_ID(verb) != SYM_CLOSE)
+        fail ("File port's READ or WRITE isn't done (WAIT for its event)");
+
+    if (ReqFile(file)->ahead_tail != 0 and VAL_WORD_ID(verb) != SYM_READ)
+        Drop_Read_Ahead(file);  // READ checks for /LINES, see below
+
+    if (
+        ReqFile(file)->batch_used != 0
+        and VAL_WORD_ID(verb) != SYM_WRITE
+        and VAL_WORD_ID(verb) != SYM_APPEND  // retriggered as WRITE
+    ){
+        Flush_File_Batch(file);  // so e.g. READ, QUERY, CLOSE see the data
+    }
+
     switch (VAL_WORD_ID(verb)) {
       case SYM_REFLECT: {
         INCLUDE_PARAMS_OF_REFLECT;
@@ -356,7 +724,7 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         UNUSED(PAR(source));
         UNUSED(PAR(string)); // handled in dispatcher
-        UNUSED(PAR(lines)); // handled in dispatcher
+        // /LINES is handled in dispatcher, except for open ports (below)
 
         REBFLGS flags = 0;
 
@@ -375,10 +743,50 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
             opened = true; // had to be opened (shortcut case)
         }
 
+        bool lines = not opened and REF(lines);  // see Read_File_Lines()
+        if (ReqFile(file)->ahead_tail != 0 and (REF(seek) or not lines))
+            Drop_Read_Ahead(file);
+
         if (REF(seek))
             Set_Seek(file, ARG(seek));
 
+        // READ/LINES of a port that was already open reads ahead and gives
+        // back lines as it goes, so /PART counts lines instead of bytes.
+        // (The shortcut READ/LINES %file reads it all, then splits it.)
+        //
+        if (lines) {
+            REBLEN max = UINT32_MAX;
+            if (REF(part)) {
+                REBI64 n = VAL_INT64(ARG(part));
+                if (n < 0)
+                    fail (PAR(part));
+                max = n >= UINT32_MAX ? UINT32_MAX - 1 : cast(REBLEN, n);
+            }
+            if (not Read_File_Lines(D_OUT, ctx, file, max))
+                return nullptr;  // no lines left
+            return D_OUT;
+        }
+
         REBLEN len = Set_Length(file, REF(part) ? VAL_INT64(ARG(part)) : -1);
+
+        if (not opened and IS_ACTION(CTX_VAR(ctx, STD_PORT_AWAKE))) {
+            REBVAL *port_data = CTX_VAR(ctx, STD_PORT_DATA);
+            REBBIN *bin = Make_Binary(len);
+            TERM_BIN_LEN(bin, len);  // bytes are filled in by the READ event
+            GC_Write_Barrier(CTX_VARLIST(ctx));
+            Init_Binary(port_data, bin);
+
+            req->common.data = BIN_HEAD(bin);
+            req->length = len;
+            Post_File_Port(file, port_data, RDC_READ);
+            RETURN (port);
+        }
+
+        // READ gives a snapshot of the file, even when it's big.  Mapping the
+        // file in instead would let changes to it show through, and touching
+        // pages lost to a truncation would raise SIGBUS.  MAP-FILE is how to
+        // ask for a mapped (and frozen) binary, with those caveats.
+        //
         Read_File_Port(D_OUT, port, file, path, flags, len);
 
         if (opened) {
@@ -434,7 +842,24 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
             opened = true;
         }
 
-        if (REF(append)) {
+        bool async = not opened and IS_ACTION(CTX_VAR(ctx, STD_PORT_AWAKE));
+
+        // Batched WRITEs (see MODIFY 'BUFFER) stay in order with the ones
+        // that aren't, because those write out the batch first.  So does
+        // switching between WRITE/APPEND and WRITE.
+        //
+        struct devreq_file *f = ReqFile(file);
+        bool batch = f->batch_size != 0 and not async and not REF(seek);
+        if (
+            f->batch_used != 0
+            and (not batch or f->batch_append != did REF(append))
+        ){
+            Flush_File_Batch(file);
+        }
+
+        if (batch)
+            f->batch_append = did REF(append);  // at Flush_File_Batch() time
+        else if (REF(append)) {
             ReqFile(file)->index = -1; // append
             req->modes |= RFM_RESEEK;
         }
@@ -449,7 +874,10 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
                 len = n;
         }
 
-        Write_File_Port(file, data, len, did REF(lines));
+        enum Reb_File_Write how = async ? FILE_WRITE_ASYNC
+            : batch ? FILE_WRITE_BATCH
+            : FILE_WRITE_NOW;
+        Write_File_Port(file, data, len, did REF(lines), how);
 
         if (opened) {
             REBVAL *result = OS_DO_DEVICE(file, RDC_CLOSE);
@@ -514,6 +942,12 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
             Cleanup_File(file);
 
+            if (ReqFile(file)->buffer != nullptr)  // I/O canceled, no event
+                Release_File_Buffer(file);
+
+            if (ReqFile(file)->batch != nullptr)  // written out, see above
+                Free_File_Batch(file);
+
             if (rebDid("error?", result))
                 rebJumps("fail", result);
 
@@ -521,6 +955,12 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         }
         RETURN (port); }
 
+      case SYM_FLUSH: {
+        INCLUDE_PARAMS_OF_FLUSH;
+        UNUSED(PAR(port));
+
+        RETURN (port); }  // batch was written out above, before the switch
+
       case SYM_DELETE: {
         INCLUDE_PARAMS_OF_DELETE;
         UNUSED(PAR(port));
@@ -600,6 +1040,40 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         return Query_File_Or_Dir(port, file); }
 
+      case SYM_MODIFY: {
+        INCLUDE_PARAMS_OF_MODIFY;
+
+        UNUSED(PAR(target));
+
+        // MODIFY port 'BUFFER n batches up WRITEs (and APPENDs) of less than
+        // n bytes, to write them out together.  That's done when the batch
+        // is full, or before anything else is done with the port (FLUSH or
+        // CLOSE included).  0 writes out the batch, and stops batching.
+        //
+        if (not rebDid("'buffer =", rebQ(ARG(field))))
+            fail (PAR(field));
+        if (not (req->flags & RRF_OPEN))
+            fail (Error_Not_Open_Raw(path));
+        if (not IS_INTEGER(ARG(value)))
+            fail (PAR(value));
+
+        REBI64 size = VAL_INT64(ARG(value));
+        if (size < 0 or size > MAX_WRITE_BATCH)
+            fail (PAR(value));
+
+        struct devreq_file *f = ReqFile(file);
+        Flush_File_Batch(file);
+        if (f->batch != nullptr)
+            Free_File_Batch(file);
+
+        if (size != 0) {
+            f->batch = cast(REBYTE*, malloc(size));
+            if (f->batch == nullptr)
+                fail (Error_No_Memory(size));
+            f->batch_size = cast(REBLEN, size);
+        }
+        return Init_True(D_OUT); }
+
       case SYM_SKIP: {
         INCLUDE_PARAMS_OF_SKIP;
 
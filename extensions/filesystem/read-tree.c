@@ -0,0 +1,731 @@
+//
+//  File: %read-tree.c
+//  Summary: "Recursive directory listing, walked on a pool of threads"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A recursive scan written in usermode (e.g. %tools/read-deep.reb) runs a
+// READ of a directory port for each directory, and evaluates code for each
+// entry.  READ-TREE walks the whole tree in C instead:
+//
+// * Directories waiting to be listed go on a shared queue, and a pool of
+//   threads takes them off it.  Listing is mostly waiting on the filesystem
+//   (especially a network one), so threads overlap those waits even when
+//   there are fewer cores than threads.
+//
+// * POSIX opens each directory with openat() relative to the root, and
+//   lists it with fdopendir().  `d_type` says what an entry is, so there's
+//   no stat() unless the filesystem doesn't fill that in--or a /NEWER filter
+//   needs the modification time.  Windows gets both from FindFirstFileW().
+//
+// * Each thread collects the paths it finds into its own buffer, so adding
+//   them takes no lock.  Only at the end are they sorted (so the result does
+//   not depend on thread timing) and made into FILE! values.
+//
+// Symbolic links (and Windows reparse points, e.g. junctions) are listed but
+// never followed, so a link can't send the walk around in a cycle.
+//
+// Threading is enabled by USE_PARALLEL_WALK in %systems.r, for platforms
+// that link with pthreads.  Without it the walk happens on the calling
+// thread, which still saves the per-entry evaluator overhead.
+//
+// !!! A walk of tens of millions of files takes a while, and can't be
+// interrupted with Ctrl-C (the threads don't check for signals).  Results
+// come back as one block; a way of streaming them to a callback as they are
+// found would need the threads to hand paths back to the interpreter thread
+// while they run.
+//
+
+#if !defined(TO_WINDOWS)
+    #ifndef __cplusplus
+        #define _GNU_SOURCE  // openat(), fdopendir(), fstatat()
+    #endif
+
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(USE_PARALLEL_WALK)
+    #define PARALLEL_WALK
+    #include <pthread.h>
+#endif
+
+#if defined(TO_WINDOWS)
+    #include <windows.h>
+    #undef IS_ERROR  // windows.h defines, so undef it to avoid the warning
+#endif
+
+#include "sys-core.h"
+
+#include "file-req.h"
+
+struct Reb_Walk_Dir {  // a directory waiting to be listed
+    struct Reb_Walk_Dir *next;
+    size_t size;  // of path, not counting the '\0'
+    char path[1];  // relative to the root, "" or ending in '/' (extends)
+};
+
+struct Reb_Walk_Out {  // paths one thread found, so it needn't lock to add
+    char *bytes;  // each path is '\0'-terminated
+    size_t used;
+    size_t capacity;
+    REBLEN count;
+};
+
+struct Reb_Walk {
+  #if defined(TO_WINDOWS)
+    const WCHAR *root;  // local path, ending in '\\'
+  #else
+    int root_fd;
+  #endif
+
+    const char *match;  // wildcard for entry names, or nullptr
+    enum Reb_Tree_Type type;
+    bool newer;
+    int64_t newer_than;  // seconds since 1970, if `newer`
+
+    struct Reb_Walk_Dir *queue;
+    REBLEN active;  // threads listing a directory right now
+
+    int errnum;  // first error, or 0
+    char *error_path;  // where it happened (malloc()'d)
+
+  #if defined(PARALLEL_WALK)
+    pthread_mutex_t lock;
+    pthread_cond_t more;  // signaled when queue grows, or the walk is over
+  #endif
+};
+
+
+inline static void Lock_Walk(struct Reb_Walk *w) {
+  #if defined(PARALLEL_WALK)
+    pthread_mutex_lock(&w->lock);
+  #else
+    UNUSED(w);
+  #endif
+}
+
+inline static void Unlock_Walk(struct Reb_Walk *w) {
+  #if defined(PARALLEL_WALK)
+    pthread_mutex_unlock(&w->lock);
+  #else
+    UNUSED(w);
+  #endif
+}
+
+
+// The walk stops at the first error that isn't just a directory that went
+// away, or that we aren't allowed to look in.
+//
+static void Note_Walk_Error(
+    struct Reb_Walk *w,
+    int errnum,
+    const char *path
+){
+    Lock_Walk(w);
+    if (w->errnum == 0) {
+        w->errnum = errnum;
+        w->error_path = cast(char*, malloc(strlen(path) + 1));
+        if (w->error_path != nullptr)
+            strcpy(w->error_path, path);
+    }
+    Unlock_Walk(w);
+}
+
+
+// Match `name` against a pattern where `*` matches any run of characters
+// and `?` matches one (a UTF-8 sequence counts as one).  Case sensitive.
+//
+static bool Match_Wild(const char *pattern, const char *name)
+{
+    const char *star = nullptr;  // pattern just after the last `*`
+    const char *retry = nullptr;  // where in name that `*` matches up to
+
+    while (*name != '\0') {
+        if (*pattern == '*') {
+            star = ++pattern;
+            retry = name;
+            continue;
+        }
+        if (*pattern == '?') {
+            ++pattern;
+            ++name;
+            while ((*name & 0xC0) == 0x80)  // rest of UTF-8 sequence
+                ++name;
+            continue;
+        }
+        if (*pattern == *name) {
+            ++pattern;
+            ++name;
+            continue;
+        }
+        if (star == nullptr)
+            return false;
+        pattern = star;  // let the `*` match one more byte, and try again
+        name = ++retry;
+    }
+
+    while (*pattern == '*')
+        ++pattern;
+    return *pattern == '\0';
+}
+
+
+// A FILE! has to be valid UTF-8 (without CR, see STRMODE_NO_CR).  That's
+// checked here on the thread, so making the values at the end can't fail.
+//
+static bool Is_Utf8_Name(const char *name, size_t size)
+{
+    const REBYTE *bp = cast(const REBYTE*, name);
+    const REBYTE *tail = bp + size;
+
+    while (bp != tail) {
+        REBYTE b = *bp++;
+        if (b < 0x80) {
+            if (b == CR)
+                return false;
+            continue;
+        }
+
+        uint32_t c;
+        int trail;
+        if ((b & 0xE0) == 0xC0) {
+            c = b & 0x1F;
+            trail = 1;
+        }
+        else if ((b & 0xF0) == 0xE0) {
+            c = b & 0x0F;
+            trail = 2;
+        }
+        else if ((b & 0xF8) == 0xF0) {
+            c = b & 0x07;
+            trail = 3;
+        }
+        else
+            return false;
+
+        if (tail - bp < trail)
+            return false;
+        int i;
+        for (i = 0; i < trail; ++i) {
+            if ((*bp & 0xC0) != 0x80)
+                return false;
+            c = (c << 6) | (*bp++ & 0x3F);
+        }
+
+        static const uint32_t least[4] = {0, 0x80, 0x800, 0x10000};
+        if (c < least[trail] or c > 0x10FFFF)
+            return false;  // overlong, or past Unicode
+        if (c >= 0xD800 and c <= 0xDFFF)
+            return false;  // surrogate halves aren't characters
+    }
+    return true;
+}
+
+
+// Append `dir/name` (and a slash if it is a directory) to a thread's paths.
+//
+static bool Add_Path(
+    struct Reb_Walk_Out *out,
+    const struct Reb_Walk_Dir *dir,
+    const char *name,
+    size_t size,
+    bool is_dir
+){
+    size_t need = dir->size + size + (is_dir ? 1 : 0) + 1;
+    if (out->used + need > out->capacity) {
+        size_t capacity = out->capacity == 0 ? 64 * 1024 : out->capacity * 2;
+        while (out->used + need > capacity)
+            capacity *= 2;
+        char *bytes = cast(char*, realloc(out->bytes, capacity));
+        if (bytes == nullptr)
+            return false;
+        out->bytes = bytes;
+        out->capacity = capacity;
+    }
+
+    char *dest = out->bytes + out->used;
+    memcpy(dest, dir->path, dir->size);
+    memcpy(dest + dir->size, name, size);
+    if (is_dir)
+        dest[dir->size + size] = '/';
+    dest[need - 1] = '\0';
+
+    out->used += need;
+    ++out->count;
+    return true;
+}
+
+
+// Put the subdirectory `dir/name/` on the queue to be listed.
+//
+static bool Queue_Dir(
+    struct Reb_Walk *w,
+    const struct Reb_Walk_Dir *dir,
+    const char *name,
+    size_t size
+){
+    size_t path_size = dir->size + size + 1;
+    struct Reb_Walk_Dir *sub = cast(struct Reb_Walk_Dir*,
+        malloc(sizeof(struct Reb_Walk_Dir) + path_size)
+    );
+    if (sub == nullptr)
+        return false;
+
+    memcpy(sub->path, dir->path, dir->size);
+    memcpy(sub->path + dir->size, name, size);
+    sub->path[path_size - 1] = '/';
+    sub->path[path_size] = '\0';
+    sub->size = path_size;
+
+    Lock_Walk(w);
+    sub->next = w->queue;  // a stack, so the walk goes deep first
+    w->queue = sub;
+  #if defined(PARALLEL_WALK)
+    pthread_cond_signal(&w->more);
+  #endif
+    Unlock_Walk(w);
+    return true;
+}
+
+
+// Called with each entry of a directory being listed.
+//
+static void Found_Entry(
+    struct Reb_Walk *w,
+    struct Reb_Walk_Out *out,
+    const struct Reb_Walk_Dir *dir,
+    const char *name,
+    bool is_dir,
+    int64_t mtime  // only needed if w->newer
+){
+    size_t size = strlen(name);
+    if (not Is_Utf8_Name(name, size)) {
+        Note_Walk_Error(w, EILSEQ, dir->path);
+        return;
+    }
+
+    if (is_dir and not Queue_Dir(w, dir, name, size)) {
+        Note_Walk_Error(w, ENOMEM, dir->path);
+        return;
+    }
+
+    if (w->type == (is_dir ? TREE_FILES : TREE_DIRS))
+        return;
+    if (w->match != nullptr and not Match_Wild(w->match, name))
+        return;
+    if (w->newer and mtime <= w->newer_than)
+        return;
+
+    if (not Add_Path(out, dir, name, size, is_dir))
+        Note_Walk_Error(w, ENOMEM, dir->path);
+}
+
+
+#if defined(TO_WINDOWS)
+
+// Windows FILETIME is in 100 nanosecond units since 1601.
+//
+static int64_t Filetime_To_Unix(const FILETIME *ft)
+{
+    uint64_t t = (cast(uint64_t, ft->dwHighDateTime) << 32)
+        | ft->dwLowDateTime;
+    return cast(int64_t, (t - 116444736000000000ULL) / 10000000);
+}
+
+static void Walk_Dir(
+    struct Reb_Walk *w,
+    struct Reb_Walk_Out *out,
+    const struct Reb_Walk_Dir *dir
+){
+    size_t root_len = wcslen(w->root);
+    int dir_len = MultiByteToWideChar(
+        CP_UTF8, 0, dir->path, cast(int, dir->size), nullptr, 0
+    );
+    WCHAR *pattern = cast(WCHAR*,
+        malloc((root_len + dir_len + 2) * sizeof(WCHAR))
+    );
+    if (pattern == nullptr) {
+        Note_Walk_Error(w, ERROR_NOT_ENOUGH_MEMORY, dir->path);
+        return;
+    }
+    wcscpy(pattern, w->root);
+    MultiByteToWideChar(
+        CP_UTF8, 0, dir->path, cast(int, dir->size),
+        pattern + root_len, dir_len
+    );
+    int i;
+    for (i = 0; i < dir_len; ++i) {
+        if (pattern[root_len + i] == '/')
+            pattern[root_len + i] = '\\';
+    }
+    pattern[root_len + dir_len] = '*';
+    pattern[root_len + dir_len + 1] = '\0';
+
+    WIN32_FIND_DATAW info;
+    HANDLE h = FindFirstFileW(pattern, &info);
+    free(pattern);
+
+    if (h == INVALID_HANDLE_VALUE) {
+        DWORD error = GetLastError();
+        if (
+            error != ERROR_FILE_NOT_FOUND
+            and error != ERROR_PATH_NOT_FOUND
+            and error != ERROR_ACCESS_DENIED
+        ){
+            Note_Walk_Error(w, error, dir->path);
+        }
+        return;
+    }
+
+    char name[MAX_PATH * 3 + 1];  // UTF-8 can take 3 bytes per WCHAR
+    do {
+        const WCHAR *wide = info.cFileName;
+        if (wide[0] == '.' and (
+            wide[1] == '\0' or (wide[1] == '.' and wide[2] == '\0')
+        )){
+            continue;
+        }
+
+        if (0 == WideCharToMultiByte(
+            CP_UTF8, 0, wide, -1, name, sizeof(name), nullptr, nullptr
+        )){
+            Note_Walk_Error(w, GetLastError(), dir->path);
+            break;
+        }
+
+        bool is_dir = (
+            (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            and not (info.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+        );
+        Found_Entry(
+            w, out, dir, name, is_dir, Filetime_To_Unix(&info.ftLastWriteTime)
+        );
+    } while (FindNextFileW(h, &info));
+
+    FindClose(h);
+}
+
+#else
+
+static void Walk_Dir(
+    struct Reb_Walk *w,
+    struct Reb_Walk_Out *out,
+    struct Reb_Walk_Dir *dir
+){
+    // Open without the trailing slash, which would make O_NOFOLLOW follow
+    // a link (the directory could have been replaced by one since).
+    //
+    int fd;
+    if (dir->size == 0)
+        fd = openat(w->root_fd, ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    else {
+        dir->path[dir->size - 1] = '\0';
+        fd = openat(
+            w->root_fd, dir->path,
+            O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW
+        );
+        dir->path[dir->size - 1] = '/';
+    }
+
+    if (fd < 0) {
+        if (
+            errno != ENOENT and errno != EACCES and errno != EPERM
+            and errno != ENOTDIR and errno != ELOOP
+        ){
+            Note_Walk_Error(w, errno, dir->path);
+        }
+        return;
+    }
+
+    DIR *h = fdopendir(fd);
+    if (h == nullptr) {
+        Note_Walk_Error(w, errno, dir->path);
+        close(fd);
+        return;
+    }
+
+    while (true) {
+        errno = 0;
+        struct dirent *d = readdir(h);
+        if (d == nullptr) {
+            if (errno != 0)
+                Note_Walk_Error(w, errno, dir->path);
+            break;
+        }
+
+        const char *name = d->d_name;
+        if (name[0] == '.' and (
+            name[1] == '\0' or (name[1] == '.' and name[2] == '\0')
+        )){
+            continue;
+        }
+
+        bool is_dir = false;
+        bool known = false;
+        int64_t mtime = 0;
+
+      #if defined(DT_DIR) && defined(DT_UNKNOWN)
+        if (not w->newer and d->d_type != DT_UNKNOWN) {
+            is_dir = (d->d_type == DT_DIR);  // DT_LNK isn't, not followed
+            known = true;
+        }
+      #endif
+
+        if (not known) {
+            struct stat st;
+            if (fstatat(dirfd(h), name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+                continue;  // went away since readdir() saw it
+            is_dir = S_ISDIR(st.st_mode);
+            mtime = st.st_mtime;
+        }
+
+        Found_Entry(w, out, dir, name, is_dir, mtime);
+    }
+
+    closedir(h);  // closes fd too
+}
+
+#endif
+
+
+// Take directories off the queue and list them, until the queue is empty
+// and no thread is listing one (that could queue more).
+//
+static void Run_Walk(struct Reb_Walk *w, struct Reb_Walk_Out *out)
+{
+    Lock_Walk(w);
+    while (true) {
+        struct Reb_Walk_Dir *dir = w->queue;
+        if (dir == nullptr) {
+            if (w->active == 0)
+                break;
+          #if defined(PARALLEL_WALK)
+            pthread_cond_wait(&w->more, &w->lock);
+          #endif
+            continue;
+        }
+        w->queue = dir->next;
+
+        if (w->errnum != 0) {  // failing, so just empty the queue
+            free(dir);
+            continue;
+        }
+
+        ++w->active;
+        Unlock_Walk(w);
+
+        Walk_Dir(w, out, dir);
+        free(dir);
+
+        Lock_Walk(w);
+        --w->active;
+    }
+
+  #if defined(PARALLEL_WALK)
+    pthread_cond_broadcast(&w->more);  // let the others see it's over
+  #endif
+    Unlock_Walk(w);
+}
+
+
+#if defined(PARALLEL_WALK)
+
+struct Reb_Walk_Thread {
+    struct Reb_Walk *walk;
+    struct Reb_Walk_Out *out;
+};
+
+static void *Walk_Thread(void *p)
+{
+    struct Reb_Walk_Thread *t = cast(struct Reb_Walk_Thread*, p);
+    Run_Walk(t->walk, t->out);
+    return nullptr;
+}
+
+#endif
+
+
+static int Compare_Paths(const void *a, const void *b)
+{
+    return strcmp(*cast(char* const*, a), *cast(char* const*, b));
+}
+
+
+//
+//  Read_Tree: C
+//
+// Give back a BLOCK! of the paths (relative to `dir`) of everything under
+// it, that passes the filters, sorted.  Directories end in a slash.
+//
+REBVAL *Read_Tree(
+    const REBVAL *dir,
+    const char *match,  // nullptr to list any name
+    enum Reb_Tree_Type type,
+    const int64_t *newer_than,  // nullptr to list any modification time
+    REBLEN num_threads
+){
+    assert(num_threads >= 1 and num_threads <= MAX_TREE_THREADS);
+
+    struct Reb_Walk walk;
+    struct Reb_Walk *w = &walk;
+    w->match = match;
+    w->type = type;
+    w->newer = (newer_than != nullptr);
+    w->newer_than = w->newer ? *newer_than : 0;
+    w->active = 0;
+    w->errnum = 0;
+    w->error_path = nullptr;
+
+    w->queue = cast(struct Reb_Walk_Dir*,
+        malloc(sizeof(struct Reb_Walk_Dir))
+    );
+    if (w->queue == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Walk_Dir)));
+    w->queue->next = nullptr;
+    w->queue->size = 0;
+    w->queue->path[0] = '\0';
+
+  #if defined(TO_WINDOWS)
+    WCHAR *root = rebSpellWide("file-to-local/full", dir);
+    size_t root_len = wcslen(root);
+    if (root_len == 0 or root[root_len - 1] != '\\') {
+        WCHAR *slashed = rebAllocN(WCHAR, root_len + 2);
+        wcscpy(slashed, root);
+        slashed[root_len] = '\\';
+        slashed[root_len + 1] = '\0';
+        rebFree(root);
+        root = slashed;
+    }
+    w->root = root;
+
+    DWORD attributes = GetFileAttributesW(root);
+    if (
+        attributes == INVALID_FILE_ATTRIBUTES
+        or not (attributes & FILE_ATTRIBUTE_DIRECTORY)
+    ){
+        DWORD error = attributes == INVALID_FILE_ATTRIBUTES
+            ? GetLastError()
+            : ERROR_DIRECTORY;
+        rebFree(root);
+        free(w->queue);
+        fail (Error_Cannot_Open_Raw(dir, rebError_OS(error)));
+    }
+  #else
+    char *root = rebSpell("file-to-local/full", dir);
+    w->root_fd = open(root, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    rebFree(root);
+    if (w->root_fd < 0) {
+        int errnum = errno;
+        free(w->queue);
+        fail (Error_Cannot_Open_Raw(dir, rebError_OS(errnum)));
+    }
+  #endif
+
+    struct Reb_Walk_Out outs[MAX_TREE_THREADS];
+    memset(outs, 0, sizeof(outs));
+
+  #if defined(PARALLEL_WALK)
+    pthread_mutex_init(&w->lock, nullptr);
+    pthread_cond_init(&w->more, nullptr);
+
+    struct Reb_Walk_Thread jobs[MAX_TREE_THREADS];
+    pthread_t threads[MAX_TREE_THREADS];
+    bool started[MAX_TREE_THREADS];
+
+    REBLEN i;
+    for (i = 1; i < num_threads; ++i) {
+        jobs[i].walk = w;
+        jobs[i].out = &outs[i];
+        started[i] = (
+            pthread_create(&threads[i], nullptr, &Walk_Thread, &jobs[i]) == 0
+        );
+    }
+
+    Run_Walk(w, &outs[0]);  // this thread works too
+
+    for (i = 1; i < num_threads; ++i) {
+        if (started[i])
+            pthread_join(threads[i], nullptr);
+    }
+
+    pthread_cond_destroy(&w->more);
+    pthread_mutex_destroy(&w->lock);
+  #else
+    num_threads = 1;
+    Run_Walk(w, &outs[0]);
+  #endif
+
+  #if defined(TO_WINDOWS)
+    rebFree(root);
+  #else
+    close(w->root_fd);
+  #endif
+
+    REBLEN total = 0;
+    REBLEN t;
+    for (t = 0; t < num_threads; ++t)
+        total += outs[t].count;
+
+    char **paths = nullptr;
+    if (w->errnum == 0 and total != 0) {
+        paths = cast(char**, malloc(total * sizeof(char*)));
+        if (paths == nullptr)
+            w->errnum = ENOMEM;
+    }
+
+    if (w->errnum != 0) {
+        for (t = 0; t < num_threads; ++t)
+            free(outs[t].bytes);
+
+        REBVAL *where = rebValue(
+            "join", dir, rebT(w->error_path ? w->error_path : "")
+        );
+        free(w->error_path);
+        fail (Error_Cannot_Open_Raw(where, rebError_OS(w->errnum)));
+    }
+
+    REBLEN n = 0;
+    for (t = 0; t < num_threads; ++t) {
+        char *p = outs[t].bytes;
+        REBLEN k;
+        for (k = 0; k < outs[t].count; ++k) {
+            paths[n++] = p;
+            p += strlen(p) + 1;
+        }
+    }
+    assert(n == total);
+
+    qsort(paths, total, sizeof(char*), &Compare_Paths);
+
+    REBDSP dsp_orig = DSP;
+    for (n = 0; n < total; ++n)
+        Init_File(DS_PUSH(), Make_String_UTF8(paths[n]));
+
+    free(paths);
+    for (t = 0; t < num_threads; ++t)
+        free(outs[t].bytes);
+
+    return Init_Block(Alloc_Value(), Pop_Stack_Values(dsp_orig));
+}
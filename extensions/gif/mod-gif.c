@@ -243,15 +243,30 @@ REBNATIVE(identify_gif_q)
 //
 //      return: [image! block!]
 //          {Single image or BLOCK! of images if multiple frames (animated)}
-//      data [binary!]
+//      data "A PORT! is read all at once, LZW needs the whole data"
+//          [binary! port!]
 //  ]
 //
 REBNATIVE(decode_gif)
 {
     GIF_INCLUDE_PARAMS_OF_DECODE_GIF;
 
+    // !!! Unlike the other image codecs, this doesn't decode as it reads,
+    // since Decode_LZW() works on all the data at once.  Taking the PORT!
+    // anyway means DECODE can hand any image codec a port.
+    //
+    REBYTE *read = nullptr;  // freed automatically if there's a fail()
+
     REBSIZ size;
-    const REBYTE *data = VAL_BINARY_SIZE_AT(&size, ARG(data));
+    const REBYTE *data;
+    if (IS_PORT(ARG(data))) {
+        size_t read_size;
+        read = rebBytes(&read_size, "read", ARG(data));
+        size = read_size;
+        data = read;
+    }
+    else
+        data = VAL_BINARY_SIZE_AT(&size, ARG(data));
 
     if (not Has_Valid_GIF_Header(data, size))
         fail (Error_Bad_Media_Raw());
@@ -365,6 +380,8 @@ REBNATIVE(decode_gif)
     "] else [", frames, "]");
 
     rebRelease(frames);
+    if (read)
+        rebFree(read);
 
     return result;
 }
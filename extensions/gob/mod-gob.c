@@ -178,3 +178,182 @@ REBNATIVE(map_gob_offset)
 
     return Init_Block(D_OUT, arr);
 }
+
+
+// Rectangles in GOB-DAMAGE are kept as edges, which are easier to merge.
+//
+typedef struct {
+    REBD32 x1;
+    REBD32 y1;
+    REBD32 x2;
+    REBD32 y2;
+} GOB_RECT;
+
+#define MAX_GOB_DAMAGE 32  // past this, rectangles are merged to make room
+
+typedef struct {
+    GOB_RECT rects[MAX_GOB_DAMAGE];
+    REBLEN count;
+} GOB_DAMAGE;
+
+inline static REBD32 Gob_Rect_Area(const GOB_RECT *r)
+  { return (r->x2 - r->x1) * (r->y2 - r->y1); }
+
+inline static GOB_RECT Gob_Rect_Union(const GOB_RECT *a, const GOB_RECT *b)
+{
+    GOB_RECT u;
+    u.x1 = MIN(a->x1, b->x1);
+    u.y1 = MIN(a->y1, b->y1);
+    u.x2 = MAX(a->x2, b->x2);
+    u.y2 = MAX(a->y2, b->y2);
+    return u;
+}
+
+
+//
+//  Add_Gob_Damage: C
+//
+// Add a rectangle to repaint.  It is merged with any rectangle whose union
+// with it is no bigger than the two apart (e.g. one contains the other, or
+// they are side by side), as that covers nothing more than painting both.
+// Merging can make a rectangle that merges with others, so it is re-added.
+//
+static void Add_Gob_Damage(GOB_DAMAGE *d, GOB_RECT r)
+{
+    if (r.x2 <= r.x1 or r.y2 <= r.y1)
+        return;  // nothing to repaint
+
+  add:;
+    REBLEN i;
+    for (i = 0; i < d->count; ++i) {
+        GOB_RECT u = Gob_Rect_Union(&r, &d->rects[i]);
+        if (
+            Gob_Rect_Area(&u)
+            <= Gob_Rect_Area(&r) + Gob_Rect_Area(&d->rects[i])
+        ){
+            d->rects[i] = d->rects[--d->count];
+            r = u;
+            goto add;
+        }
+    }
+
+    if (d->count == MAX_GOB_DAMAGE) {  // full, merge with the least growth
+        REBLEN best = 0;
+        REBD32 best_growth = 0;
+        for (i = 0; i < d->count; ++i) {
+            GOB_RECT u = Gob_Rect_Union(&r, &d->rects[i]);
+            REBD32 growth = Gob_Rect_Area(&u) - Gob_Rect_Area(&d->rects[i]);
+            if (i == 0 or growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        r = Gob_Rect_Union(&r, &d->rects[best]);
+        d->rects[best] = d->rects[--d->count];
+        goto add;
+    }
+
+    d->rects[d->count++] = r;
+}
+
+
+//
+//  Collect_Gob_Damage: C
+//
+// Add the damage of a GOB! and its pane, where (x, y) is the position of its
+// parent.  A dirty GOB! is repainted with everything in it, so once `covered`
+// its pane adds nothing (but is still visited to clear flags).
+//
+static void Collect_Gob_Damage(
+    GOB_DAMAGE *d,
+    REBGOB *gob,
+    REBD32 x,
+    REBD32 y,
+    bool covered,
+    bool keep,
+    REBINT depth
+){
+    if (not (GOB_FLAGS(gob) & (GOBS_DIRTY | GOBS_DIRTY_PANE)))
+        return;
+    if (depth > 1000)
+        return;  // avoid infinite loops
+
+    if (GET_GOB_FLAG(gob, GOBS_DIRTY) and not covered) {
+        GOB_RECT r;
+        r.x1 = x + GOB_X(gob);
+        r.y1 = y + GOB_Y(gob);
+        r.x2 = r.x1 + GOB_W(gob);
+        r.y2 = r.y1 + GOB_H(gob);
+        Add_Gob_Damage(d, r);
+
+        if (not GET_GOB_FLAG(gob, GOBS_NEW)) {  // else old area is bogus
+            r.x1 = x + GOB_XO(gob);
+            r.y1 = y + GOB_YO(gob);
+            r.x2 = r.x1 + GOB_WO(gob);
+            r.y2 = r.y1 + GOB_HO(gob);
+            Add_Gob_Damage(d, r);
+        }
+        covered = true;
+    }
+
+    if (covered and keep)
+        return;  // nothing to add, and no flags to clear
+
+    bool pane_dirty = GET_GOB_FLAG(gob, GOBS_DIRTY_PANE);
+    if (not keep)
+        CLR_GOB_FLAG(gob, GOBS_DIRTY | GOBS_DIRTY_PANE | GOBS_NEW);
+
+    if (not pane_dirty or not GOB_PANE(gob))
+        return;
+
+    REBLEN len = GOB_LEN(gob);
+    REBVAL *item = GOB_HEAD(gob);
+    REBLEN n;
+    for (n = 0; n < len; ++n, ++item)
+        Collect_Gob_Damage(
+            d,
+            VAL_GOB(item),
+            x + GOB_X(gob),
+            y + GOB_Y(gob),
+            covered,
+            keep,
+            depth + 1
+        );
+}
+
+
+//
+//  export gob-damage: native [
+//
+//  {Areas of a GOB! tree to repaint for what changed since last asked}
+//
+//      return: [block!]
+//          "Offset and size PAIR!s, relative to the GOB!'s top left corner"
+//      gob [gob!]
+//          "Window or other top GOB! that gets painted"
+//      /keep
+//          "Don't clear the changes, so the same areas are given next time"
+//  ]
+//
+REBNATIVE(gob_damage)
+{
+    GOB_INCLUDE_PARAMS_OF_GOB_DAMAGE;
+
+    REBGOB *gob = VAL_GOB(ARG(gob));
+
+    GOB_DAMAGE d;
+    d.count = 0;
+    Collect_Gob_Damage(
+        &d, gob, -GOB_X(gob), -GOB_Y(gob), false, REF(keep), 0
+    );
+
+    REBARR *arr = Make_Array(d.count * 2);
+    REBLEN i;
+    for (i = 0; i < d.count; ++i) {
+        GOB_RECT *r = &d.rects[i];
+        Init_Pair_Dec(Alloc_Tail_Array(arr), r->x1, r->y1);
+        Init_Pair_Dec(Alloc_Tail_Array(arr), r->x2 - r->x1, r->y2 - r->y1);
+    }
+
+    return Init_Block(D_OUT, arr);
+}
@@ -114,7 +114,15 @@ enum Reb_Gob_Flags {
     GOBF_MINIMIZE = 1 << 17,  // Window is minimized
     GOBF_MAXIMIZE = 1 << 18,  // Window is maximized
     GOBF_RESTORE = 1 << 19,  // Window is restored
-    GOBF_FULLSCREEN = 1 << 20  // Window is fullscreen
+    GOBF_FULLSCREEN = 1 << 20,  // Window is fullscreen
+
+    // Damage tracking, so only what changed has to be repainted.  A dirty
+    // GOB's old offset and size are the area it covered before it changed
+    // (unless it is also GOBS_NEW).  Its parents get GOBS_DIRTY_PANE, so the
+    // search for damage can skip the parts of the tree that haven't changed.
+    //
+    GOBS_DIRTY = 1 << 21,  // Offset, size, or looks changed
+    GOBS_DIRTY_PANE = 1 << 22  // Some GOB in the pane (or deeper) is dirty
 };
 
 
@@ -185,10 +193,10 @@ typedef struct gob_window {  // Maps gob to window
 #define GOB_LOG_W_INT(g)    ROUND_TO_INT(GOB_LOG_W(g))
 #define GOB_LOG_H_INT(g)    ROUND_TO_INT(GOB_LOG_H(g))
 
-#define GOB_XO(g)       VAL_XYF_X(ARR_AT((g), IDX_OLD_OFFSET))
-#define GOB_YO(g)       VAL_XYF_Y(ARR_AT((g), IDX_OLD_OFFSET))
-#define GOB_WO(g)       VAL_XYF_X(ARR_AT((g), IDX_OLD_SIZE))
-#define GOB_HO(g)       VAL_XYF_Y(ARR_AT((g), IDX_OLD_SIZE))
+#define GOB_XO(g)       VAL_XYF_X(ARR_AT((g), IDX_GOB_OLD_OFFSET))
+#define GOB_YO(g)       VAL_XYF_Y(ARR_AT((g), IDX_GOB_OLD_OFFSET))
+#define GOB_WO(g)       VAL_XYF_X(ARR_AT((g), IDX_GOB_TYPE_AND_OLD_SIZE))
+#define GOB_HO(g)       VAL_XYF_Y(ARR_AT((g), IDX_GOB_TYPE_AND_OLD_SIZE))
 
 #define GOB_XO_INT(g)   ROUND_TO_INT(GOB_XO(g))
 #define GOB_YO_INT(g)   ROUND_TO_INT(GOB_YO(g))
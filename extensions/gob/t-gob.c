@@ -161,6 +161,36 @@ static REBLEN Find_Gob(REBGOB *gob, REBGOB *target)
 }
 
 
+//
+//  Mark_Gob_Dirty: C
+//
+// Called *before* a change to where a GOB! is or how it looks.  The first
+// such change since the damage was last taken saves the offset and size, so
+// the area the GOB! covered before can be repainted along with the new one.
+//
+static void Mark_Gob_Dirty(REBGOB *gob)
+{
+    if (not GET_GOB_FLAG(gob, GOBS_DIRTY)) {
+        SET_GOB_FLAG(gob, GOBS_DIRTY);
+        GOB_XO(gob) = GOB_X(gob);
+        GOB_YO(gob) = GOB_Y(gob);
+        GOB_WO(gob) = GOB_W(gob);
+        GOB_HO(gob) = GOB_H(gob);
+    }
+
+    REBINT max_depth = 1000;  // avoid infinite loops
+    REBGOB *parent = GOB_PARENT(gob);
+    while (
+        parent
+        and not GET_GOB_FLAG(parent, GOBS_DIRTY_PANE)  // ancestors have it
+        and max_depth-- > 0
+    ){
+        SET_GOB_FLAG(parent, GOBS_DIRTY_PANE);
+        parent = GOB_PARENT(parent);
+    }
+}
+
+
 //
 //  Detach_Gob: C
 //
@@ -173,6 +203,8 @@ static void Detach_Gob(REBGOB *gob)
     if (not par)
         return;
 
+    Mark_Gob_Dirty(par);  // repaint where the GOB! was
+
     if (GOB_PANE(par)) {
         REBLEN i = Find_Gob(par, gob);
         if (i != NOT_FOUND)
@@ -224,6 +256,7 @@ static void Insert_Gobs(
                     i = Find_Gob(gob, VAL_GOB(val));
                     if (i > 0 && i == (REBINT)index-1) { // a no-op
                         SET_GOB_FLAG(VAL_GOB(val), GOBS_NEW);
+                        Mark_Gob_Dirty(VAL_GOB(val));
                         return;
                     }
                 }
@@ -277,6 +310,7 @@ static void Insert_Gobs(
 
             SET_GOB_PARENT(VAL_GOB(val), gob);
             SET_GOB_FLAG(VAL_GOB(val), GOBS_NEW);
+            Mark_Gob_Dirty(VAL_GOB(val));
         }
     }
 
@@ -296,6 +330,8 @@ static void Insert_Gobs(
 //
 static void Remove_Gobs(REBGOB *gob, REBLEN index, REBLEN len)
 {
+    Mark_Gob_Dirty(gob);  // repaint where the GOBs were
+
     REBVAL *item = GOB_AT(gob, index);
 
     REBLEN n;
@@ -371,6 +407,24 @@ static void Set_Gob_Flag(REBGOB *gob, const REBSYM *name)
 //
 static bool Did_Set_GOB_Var(REBGOB *gob, const RELVAL *word, const REBVAL *val)
 {
+    switch (VAL_WORD_ID(word)) {  // fields that change what gets painted
+      case SYM_OFFSET:
+      case SYM_SIZE:
+      case SYM_IMAGE:
+      case SYM_DRAW:
+      case SYM_TEXT:
+      case SYM_EFFECT:
+      case SYM_COLOR:
+      case SYM_PANE:
+      case SYM_ALPHA:
+      case SYM_FLAGS:
+        Mark_Gob_Dirty(gob);
+        break;
+
+      default:
+        break;
+    }
+
     switch (VAL_WORD_ID(word)) {
       case SYM_OFFSET:
         return Did_Set_XYF(ARR_AT(gob, IDX_GOB_OFFSET_AND_FLAGS), val);
@@ -488,6 +542,7 @@ static bool Did_Set_GOB_Var(REBGOB *gob, const RELVAL *word, const REBVAL *val)
         else if (IS_INTEGER(val)) {
         }
         else if (IS_BLANK(val)) {
+            Mark_Gob_Dirty(gob);
             SET_GOB_TYPE(gob, GOBT_NONE); // !!! Why touch the content?
             Init_Blank(GOB_CONTENT(gob));
         }
@@ -1079,6 +1134,8 @@ REBTYPE(Gob)
         // !!! Could make the indexed pane into a local if we had a spare
         // local, but its' good to exercise the API as much as possible).
         //
+        Mark_Gob_Dirty(gob);
+
         REBVAL *pane = SPECIFIC(ARR_AT(gob, IDX_GOB_PANE));
         return rebValue(
             "applique :take [",
@@ -1106,6 +1163,7 @@ REBTYPE(Gob)
         return nullptr;
 
     case SYM_REVERSE:
+        Mark_Gob_Dirty(gob);  // changes which GOBs are painted on top
         return rebValue(
             "reverse @", SPECIFIC(ARR_AT(gob, IDX_GOB_PANE))
         );
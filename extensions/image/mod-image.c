@@ -81,3 +81,49 @@ REBNATIVE(unregister_image_hooks)
 
     return Init_None(D_OUT);
 }
+
+
+//
+//  export resample: native [
+//
+//  {Make a copy of an IMAGE! scaled (or stretched) to a new size}
+//
+//      return: [image!]
+//      image "All of its pixels are used, whatever its position"
+//          [image!]
+//      size "Width and height of the result"
+//          [pair!]
+//      /filter "NEAREST, BILINEAR (default), or LANCZOS (sharpest, slowest)"
+//          [word!]
+//      /threads "Number of threads to resample rows with"
+//          [integer!]
+//  ]
+//
+REBNATIVE(resample)
+{
+    IMAGE_INCLUDE_PARAMS_OF_RESAMPLE;
+
+    REBINT w = VAL_PAIR_X_INT(ARG(size));
+    REBINT h = VAL_PAIR_Y_INT(ARG(size));
+    if (w < 0 or h < 0)
+        fail (PAR(size));
+
+    enum Reb_Resample_Filter filter = RESAMPLE_BILINEAR;
+    if (REF(filter))
+        filter = cast(enum Reb_Resample_Filter, rebUnboxInteger(
+            "switch", rebQ(ARG(filter)), "[",
+                "'nearest [0] 'bilinear [1] 'lanczos [2]",  // enum order
+                "fail {RESAMPLE/FILTER must be NEAREST, BILINEAR, or LANCZOS}",
+            "]"
+        ));
+
+    REBLEN threads = 1;
+    if (REF(threads)) {
+        REBINT n = VAL_INT32(ARG(threads));
+        if (n < 1 or n > MAX_RESAMPLE_THREADS)
+            fail (PAR(threads));
+        threads = n;
+    }
+
+    return Resample_Image(D_OUT, ARG(image), w, h, filter, threads);
+}
@@ -0,0 +1,430 @@
+//
+//  File: %resample.c
+//  Summary: "Scaling of IMAGE! pixels with nearest, bilinear, and Lanczos"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Filtered resampling is done in two separable passes: first each source row
+// is filtered horizontally into a float buffer (W' x H), and then each output
+// row is made as a weighted sum of the buffer's rows (W' x H').  Neither pass
+// ever walks down a column, so the memory is always read along rows.  The
+// weights for an axis are computed once, as a start position and a run of
+// weights for each output pixel.
+//
+// When shrinking, the filter is widened by the scale factor so that every
+// source pixel falls under it (bilinear becomes a "tent" average instead of
+// sampling just 2 of many pixels).  Colors are weighted by their alpha
+// ("premultiplied") so transparent pixels don't bleed their RGB into the
+// opaque ones they are averaged with.
+//
+// Rows are independent within a pass, so /THREADS splits them into a band
+// per thread.  The passes only touch pixels and the weight tables--nothing
+// in the interpreter--so there's no restriction to release builds as there
+// is for SORT/THREADS.
+//
+
+#include "sys-core.h"
+
+#include "sys-image.h"
+
+// Threading is enabled by USE_PARALLEL_RESAMPLE in %systems.r, for platforms
+// that link with pthreads.
+//
+#if defined(USE_PARALLEL_RESAMPLE)
+    #define PARALLEL_RESAMPLE
+    #include <pthread.h>
+#endif
+
+#define LANCZOS_LOBES 3
+
+#ifndef PI
+    #define PI 3.14159265358979323846E0
+#endif
+
+
+struct Reb_Resample_Axis {
+    REBLEN *start;  // first source pixel read for each output pixel
+    REBLEN *count;  // how many source pixels are read for it
+    float *weights;  // `stride` weights for each output pixel
+    REBLEN stride;
+};
+
+
+static double Sinc(double x) {
+    if (x == 0.0)
+        return 1.0;
+    x *= PI;
+    return sin(x) / x;
+}
+
+static double Filter_Weight(enum Reb_Resample_Filter filter, double x) {
+    if (x < 0)
+        x = -x;
+
+    switch (filter) {
+      case RESAMPLE_BILINEAR:
+        return x < 1.0 ? 1.0 - x : 0.0;
+
+      case RESAMPLE_LANCZOS:
+        if (x >= LANCZOS_LOBES)
+            return 0.0;
+        return Sinc(x) * Sinc(x / LANCZOS_LOBES);
+
+      default:
+        assert(false);
+        return 0.0;
+    }
+}
+
+
+// Fill in the weights for resampling `src_len` pixels to `dst_len`.  The
+// arrays are allocated with rebAlloc(), so they are freed if there's a fail.
+//
+static void Init_Resample_Axis(
+    struct Reb_Resample_Axis *axis,
+    enum Reb_Resample_Filter filter,
+    REBLEN src_len,
+    REBLEN dst_len
+){
+    double radius = (filter == RESAMPLE_LANCZOS) ? LANCZOS_LOBES : 1.0;
+
+    double scale = cast(double, dst_len) / src_len;
+    double widen = scale < 1.0 ? 1.0 / scale : 1.0;  // so shrinking sees all
+    double support = radius * widen;
+
+    axis->stride = cast(REBLEN, ceil(support * 2)) + 1;
+    axis->start = rebAllocN(REBLEN, dst_len);
+    axis->count = rebAllocN(REBLEN, dst_len);
+    axis->weights = rebAllocN(float, dst_len * axis->stride);
+
+    REBLEN i;
+    for (i = 0; i < dst_len; ++i) {
+        double center = (i + 0.5) / scale;  // in source pixel coordinates
+
+        double lo_d = floor(center - support + 0.5);
+        double hi_d = floor(center + support + 0.5);
+        REBLEN lo = lo_d < 0 ? 0 : cast(REBLEN, lo_d);
+        REBLEN hi = hi_d > src_len ? src_len : cast(REBLEN, hi_d);
+        if (hi - lo > axis->stride)
+            hi = lo + axis->stride;  // rounding could give one extra
+
+        float *w = axis->weights + i * axis->stride;
+        double total = 0.0;
+        REBLEN j;
+        for (j = lo; j < hi; ++j) {
+            double weight = Filter_Weight(filter, (j + 0.5 - center) / widen);
+            w[j - lo] = cast(float, weight);
+            total += weight;
+        }
+
+        if (total == 0.0) {  // can't happen with these filters, but be safe
+            lo = cast(REBLEN, center);
+            if (lo >= src_len)
+                lo = src_len - 1;
+            hi = lo + 1;
+            w[0] = 1.0;
+            total = 1.0;
+        }
+
+        for (j = 0; j < hi - lo; ++j)  // normalized, so weights sum to 1
+            w[j] = cast(float, w[j] / total);
+
+        axis->start[i] = lo;
+        axis->count[i] = hi - lo;
+    }
+}
+
+
+struct Reb_Resample_Job {
+    const REBYTE *src;
+    REBLEN src_w;
+    REBLEN src_h;
+    REBYTE *dst;
+    REBLEN dst_w;
+    REBLEN dst_h;
+    float *buffer;  // dst_w x src_h premultiplied RGBA, between the passes
+    float *sum;  // one row of dst_w floats for this job's vertical sums
+    const struct Reb_Resample_Axis *x_axis;
+    const struct Reb_Resample_Axis *y_axis;
+    enum Reb_Resample_Filter filter;
+    bool vertical;  // second pass (rows of dst), else first (rows of src)
+    REBLEN lo;  // band of rows done by this job
+    REBLEN hi;
+};
+
+
+static REBYTE Clamp_Channel(float f) {
+    if (f <= 0.0f)
+        return 0;
+    if (f >= 255.0f)
+        return 255;
+    return cast(REBYTE, f + 0.5f);
+}
+
+
+static void Resample_Nearest_Rows(struct Reb_Resample_Job *job)
+{
+    REBLEN y;
+    for (y = job->lo; y < job->hi; ++y) {
+        REBLEN sy = cast(REBLEN, (cast(uint64_t, y) * 2 + 1) * job->src_h
+            / (cast(uint64_t, job->dst_h) * 2));
+        const REBYTE *row = job->src + cast(REBSIZ, sy) * job->src_w * 4;
+        REBYTE *out = job->dst + cast(REBSIZ, y) * job->dst_w * 4;
+
+        REBLEN x;
+        for (x = 0; x < job->dst_w; ++x, out += 4) {
+            REBLEN sx = cast(REBLEN, (cast(uint64_t, x) * 2 + 1) * job->src_w
+                / (cast(uint64_t, job->dst_w) * 2));
+            memcpy(out, row + sx * 4, 4);
+        }
+    }
+}
+
+
+// Filter source rows [lo, hi) across into the float buffer, premultiplied.
+//
+static void Resample_Horizontal_Rows(struct Reb_Resample_Job *job)
+{
+    const struct Reb_Resample_Axis *axis = job->x_axis;
+
+    REBLEN y;
+    for (y = job->lo; y < job->hi; ++y) {
+        const REBYTE *row = job->src + cast(REBSIZ, y) * job->src_w * 4;
+        float *out = job->buffer + cast(REBSIZ, y) * job->dst_w * 4;
+
+        REBLEN x;
+        for (x = 0; x < job->dst_w; ++x, out += 4) {
+            const REBYTE *p = row + axis->start[x] * 4;
+            const float *w = axis->weights + x * axis->stride;
+            float r = 0, g = 0, b = 0, a = 0;
+
+            REBLEN n;
+            for (n = 0; n < axis->count[x]; ++n, p += 4) {
+                float wa = w[n] * p[3];
+                r += wa * p[0];
+                g += wa * p[1];
+                b += wa * p[2];
+                a += wa;
+            }
+            out[0] = r;
+            out[1] = g;
+            out[2] = b;
+            out[3] = a;
+        }
+    }
+}
+
+
+// Make output rows [lo, hi) by summing rows of the float buffer, adding a
+// whole weighted row at a time so the buffer is read along its rows.  Then
+// the colors are divided by the alpha again ("unpremultiplied").
+//
+static void Resample_Vertical_Rows(struct Reb_Resample_Job *job)
+{
+    const struct Reb_Resample_Axis *axis = job->y_axis;
+    REBLEN row_floats = job->dst_w * 4;
+    float *sum = job->sum;
+
+    REBLEN y;
+    for (y = job->lo; y < job->hi; ++y) {
+        REBLEN i;
+        for (i = 0; i < row_floats; ++i)
+            sum[i] = 0;
+
+        const float *w = axis->weights + y * axis->stride;
+        REBLEN n;
+        for (n = 0; n < axis->count[y]; ++n) {
+            const float *row = job->buffer
+                + cast(REBSIZ, axis->start[y] + n) * row_floats;
+            for (i = 0; i < row_floats; ++i)
+                sum[i] += w[n] * row[i];
+        }
+
+        REBYTE *out = job->dst + cast(REBSIZ, y) * row_floats;
+        for (i = 0; i < row_floats; i += 4, out += 4) {
+            float a = sum[i + 3];
+            if (a < 0.5f) {  // rounds to fully transparent
+                memset(out, 0, 4);
+                continue;
+            }
+            out[0] = Clamp_Channel(sum[i] / a);
+            out[1] = Clamp_Channel(sum[i + 1] / a);
+            out[2] = Clamp_Channel(sum[i + 2] / a);
+            out[3] = Clamp_Channel(a);
+        }
+    }
+}
+
+
+static void Run_Resample_Job(struct Reb_Resample_Job *job)
+{
+    if (job->filter == RESAMPLE_NEAREST)
+        Resample_Nearest_Rows(job);
+    else if (job->vertical)
+        Resample_Vertical_Rows(job);
+    else
+        Resample_Horizontal_Rows(job);
+}
+
+
+#ifdef PARALLEL_RESAMPLE
+
+static void *Resample_Job_Thread(void *job)
+{
+    Run_Resample_Job(cast(struct Reb_Resample_Job*, job));
+    return nullptr;
+}
+
+#endif
+
+
+// Split `rows` into a band per job and run them, each on its own thread
+// (except the first, which runs on the calling thread).  If a thread can't
+// be started, its job runs here instead.
+//
+static void Run_Resample_Jobs(
+    struct Reb_Resample_Job *jobs,
+    REBLEN num_jobs,
+    REBLEN rows,
+    bool vertical
+){
+    if (num_jobs > rows)
+        num_jobs = rows;
+
+    REBLEN i;
+    for (i = 0; i < num_jobs; ++i) {
+        jobs[i].vertical = vertical;
+        jobs[i].lo = cast(REBLEN, (cast(uint64_t, rows) * i) / num_jobs);
+        jobs[i].hi = cast(REBLEN, (cast(uint64_t, rows) * (i + 1)) / num_jobs);
+    }
+
+  #ifdef PARALLEL_RESAMPLE
+    pthread_t threads[MAX_RESAMPLE_THREADS];
+    bool started[MAX_RESAMPLE_THREADS];
+
+    for (i = 1; i < num_jobs; ++i) {
+        int err = pthread_create(
+            &threads[i], nullptr, &Resample_Job_Thread, &jobs[i]
+        );
+        started[i] = (err == 0);
+    }
+
+    Run_Resample_Job(&jobs[0]);
+
+    for (i = 1; i < num_jobs; ++i) {
+        if (started[i])
+            pthread_join(threads[i], nullptr);
+        else
+            Run_Resample_Job(&jobs[i]);
+    }
+  #else
+    for (i = 0; i < num_jobs; ++i)
+        Run_Resample_Job(&jobs[i]);
+  #endif
+}
+
+
+//
+//  Resample_Image: C
+//
+// Scale all of the pixels of `src` (regardless of its position) into a new
+// `dst_w` x `dst_h` image in `out`, using up to `threads` threads.
+//
+REBVAL *Resample_Image(
+    REBVAL *out,
+    const REBVAL *src,
+    REBLEN dst_w,
+    REBLEN dst_h,
+    enum Reb_Resample_Filter filter,
+    REBLEN threads
+){
+    assert(threads >= 1 and threads <= MAX_RESAMPLE_THREADS);
+
+    REBLEN src_w = VAL_IMAGE_WIDTH(src);
+    REBLEN src_h = VAL_IMAGE_HEIGHT(src);
+
+    if (dst_w == 0 or dst_h == 0)
+        return Init_Image_Black_Opaque(out, dst_w, dst_h);
+
+    if (src_w == 0 or src_h == 0)
+        fail ("Can't resample an IMAGE! with no pixels to a nonzero size");
+
+    // The float buffer between the passes is 16 bytes a pixel, and jobs get
+    // a row of floats each to sum in.
+    //
+    uint64_t dst_size = cast(uint64_t, dst_w) * dst_h * 4;
+    if (dst_size > UINT32_MAX)
+        fail (Error_No_Memory(dst_size));
+
+    uint64_t buffer_floats = cast(uint64_t, dst_w) * src_h * 4;
+    uint64_t floats = buffer_floats + cast(uint64_t, threads) * dst_w * 4;
+    if (filter != RESAMPLE_NEAREST and floats > UINT32_MAX / sizeof(float))
+        fail (Error_No_Memory(floats * sizeof(float)));
+
+    Init_Image_Black_Opaque(out, dst_w, dst_h);
+
+    struct Reb_Resample_Job jobs[MAX_RESAMPLE_THREADS];
+    struct Reb_Resample_Axis x_axis;
+    struct Reb_Resample_Axis y_axis;
+
+    REBLEN i;
+    for (i = 0; i < threads; ++i) {
+        struct Reb_Resample_Job *job = &jobs[i];
+        job->src = VAL_IMAGE_HEAD(src);
+        job->src_w = src_w;
+        job->src_h = src_h;
+        job->dst = VAL_IMAGE_HEAD(out);
+        job->dst_w = dst_w;
+        job->dst_h = dst_h;
+        job->buffer = nullptr;
+        job->sum = nullptr;
+        job->x_axis = &x_axis;
+        job->y_axis = &y_axis;
+        job->filter = filter;
+    }
+
+    if (filter == RESAMPLE_NEAREST) {
+        Run_Resample_Jobs(jobs, threads, dst_h, false);
+        return out;
+    }
+
+    Init_Resample_Axis(&x_axis, filter, src_w, dst_w);
+    Init_Resample_Axis(&y_axis, filter, src_h, dst_h);
+
+    float *buffer = rebAllocN(float, cast(REBLEN, buffer_floats));
+    float *sums = rebAllocN(float, threads * dst_w * 4);
+    for (i = 0; i < threads; ++i) {
+        jobs[i].buffer = buffer;
+        jobs[i].sum = sums + i * dst_w * 4;
+    }
+
+    Run_Resample_Jobs(jobs, threads, src_h, false);
+    Run_Resample_Jobs(jobs, threads, dst_h, true);
+
+    rebFree(sums);
+    rebFree(buffer);
+    rebFree(y_axis.weights);
+    rebFree(y_axis.count);
+    rebFree(y_axis.start);
+    rebFree(x_axis.weights);
+    rebFree(x_axis.count);
+    rebFree(x_axis.start);
+
+    return out;
+}
@@ -144,6 +144,19 @@ inline static REBVAL *Init_Image_Black_Opaque(RELVAL *out, REBLEN w, REBLEN h)
 }
 
 
+// Filters for RESAMPLE, see %resample.c
+//
+enum Reb_Resample_Filter {
+    RESAMPLE_NEAREST,
+    RESAMPLE_BILINEAR,
+    RESAMPLE_LANCZOS
+};
+
+#define MAX_RESAMPLE_THREADS 64  // for RESAMPLE/THREADS
+
+extern REBVAL *Resample_Image(REBVAL *out, const REBVAL *src, REBLEN dst_w, REBLEN dst_h, enum Reb_Resample_Filter filter, REBLEN threads);
+
+
 // !!! These hooks allow the REB_IMAGE cell type to dispatch to code in the
 // IMAGE! extension if it is loaded.
 //
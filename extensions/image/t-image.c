@@ -121,11 +121,103 @@ void Copy_Rect_Data(
 }
 
 
+//=//// PIXEL KERNELS /////////////////////////////////////////////////////=//
+//
+// Pixels are 4 bytes of RGBA, so a 16-byte SSE2 or NEON vector holds four of
+// them.  Filling, copying the RGB but not the alpha, and finding a color are
+// then a matter of splatting the pixel across a vector, and selecting bytes
+// under a mask whose alpha bytes are set.
+//
+// The byte loops after the vector loops are the reference implementations:
+// they do the whole job when there's no SIMD, and finish up the pixels left
+// over when there is.  A plain 4-byte memcpy() per pixel is used where that
+// is all a vector would buy.
+//
+// (Splats and masks are made by memcpy() of 4 bytes into a uint32_t, so the
+// bytes land in memory order whatever the platform's endianness.)
+//
+
+#if !defined(__GNUC__)  // uses __builtin_ctz() (clang defines __GNUC__ too)
+    #define PIXEL_SCALAR
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+    #if defined(__SSSE3__)
+        #include <tmmintrin.h>  // _mm_shuffle_epi8() packs RGBA to RGB
+    #endif
+
+    typedef __m128i PixVec;
+
+    #define PIX_LOAD(p)     _mm_loadu_si128(cast(const __m128i*, (p)))
+    #define PIX_STORE(p,v)  _mm_storeu_si128(cast(__m128i*, (p)), (v))
+    #define PIX_SPLAT(u32)  _mm_set1_epi32(cast(int, (u32)))
+    #define PIX_EQ(v,w)     _mm_cmpeq_epi8((v), (w))
+    #define PIX_OR(a,b)     _mm_or_si128((a), (b))
+    #define PIX_SELECT(mask,a,b) \
+        _mm_or_si128(_mm_and_si128((mask), (a)), _mm_andnot_si128((mask), (b)))
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+
+    #define PIXEL_NEON
+    typedef uint8x16_t PixVec;
+
+    #define PIX_LOAD(p)     vld1q_u8(p)
+    #define PIX_STORE(p,v)  vst1q_u8((p), (v))
+    #define PIX_SPLAT(u32)  vreinterpretq_u8_u32(vdupq_n_u32(u32))
+    #define PIX_EQ(v,w)     vceqq_u8((v), (w))
+    #define PIX_OR(a,b)     vorrq_u8((a), (b))
+    #define PIX_SELECT(mask,a,b)  vbslq_u8((mask), (a), (b))
+#else
+    #define PIXEL_SCALAR
+#endif
+
+#define PIX_CHUNK 4  // pixels per vector
+
+static inline uint32_t Pixel_Word(const REBYTE pixel[4]) {
+    uint32_t u;
+    memcpy(&u, pixel, 4);
+    return u;
+}
+
+#if !defined(PIXEL_SCALAR)
+
+static inline PixVec Alpha_Mask(void) {
+    const REBYTE alpha[4] = {0x00, 0x00, 0x00, 0xFF};
+    return PIX_SPLAT(Pixel_Word(alpha));
+}
+
+// Index of the first of the 4 pixels whose bytes are all set in `v` (e.g.
+// by PIX_EQ()), or PIX_CHUNK if there isn't one.
+//
+static inline REBLEN First_Full_Pixel(PixVec v) {
+  #if defined(PIXEL_NEON)
+    uint32x4_t full = vceqq_u32(vreinterpretq_u32_u8(v), vdupq_n_u32(~0u));
+    uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(
+        vshrn_n_u16(vreinterpretq_u16_u32(full), 4)
+    ), 0);  // a nibble per byte, see Ascii_Match_Len()
+    return bits == 0 ? PIX_CHUNK : cast(REBLEN, __builtin_ctzll(bits) / 16);
+  #else
+    __m128i full = _mm_cmpeq_epi32(v, _mm_set1_epi32(-1));
+    unsigned bits = cast(unsigned, _mm_movemask_epi8(full));
+    return bits == 0 ? PIX_CHUNK : cast(REBLEN, __builtin_ctz(bits) / 4);
+  #endif
+}
+
+#endif
+
+
 //
 //  Fill_Alpha_Line: C
 //
 void Fill_Alpha_Line(REBYTE *rgba, REBYTE alpha, REBINT len)
 {
+  #if !defined(PIXEL_SCALAR)
+    const REBYTE pixel[4] = {0x00, 0x00, 0x00, alpha};
+    PixVec mask = Alpha_Mask();
+    PixVec splat = PIX_SPLAT(Pixel_Word(pixel));
+    for (; len >= PIX_CHUNK; len -= PIX_CHUNK, rgba += PIX_CHUNK * 4)
+        PIX_STORE(rgba, PIX_SELECT(mask, splat, PIX_LOAD(rgba)));
+  #endif
+
     for (; len > 0; len--, rgba += 4)
         rgba[3] = alpha;
 }
@@ -146,6 +238,19 @@ void Fill_Alpha_Rect(REBYTE *ip, REBYTE alpha, REBINT w, REBINT dupx, REBINT dup
 //
 void Fill_Line(REBYTE *ip, const REBYTE pixel[4], REBLEN len, bool only)
 {
+  #if !defined(PIXEL_SCALAR)
+    PixVec splat = PIX_SPLAT(Pixel_Word(pixel));
+    if (only) {
+        PixVec mask = Alpha_Mask();
+        for (; len >= PIX_CHUNK; len -= PIX_CHUNK, ip += PIX_CHUNK * 4)
+            PIX_STORE(ip, PIX_SELECT(mask, PIX_LOAD(ip), splat));
+    }
+    else {
+        for (; len >= PIX_CHUNK; len -= PIX_CHUNK, ip += PIX_CHUNK * 4)
+            PIX_STORE(ip, splat);
+    }
+  #endif
+
     for (; len > 0; len--) {
         *ip++ = pixel[0]; // red
         *ip++ = pixel[1]; // green
@@ -169,6 +274,11 @@ void Fill_Rect(
     REBINT dupy,
     bool only
 ){
+    if (cast(REBINT, w) == dupx and dupy > 0) {  // rows are contiguous
+        Fill_Line(ip, pixel, w * dupy, only);
+        return;
+    }
+
     for (; dupy > 0; dupy--, ip += (w * 4))
         Fill_Line(ip, pixel, dupx, only);
 }
@@ -396,6 +506,18 @@ REBYTE *Find_Color(
     REBLEN len,
     bool only
 ){
+  #if !defined(PIXEL_SCALAR)
+    PixVec splat = PIX_SPLAT(Pixel_Word(pixel));
+    PixVec ignore = only ? Alpha_Mask() : PIX_SPLAT(0);
+    for (; len >= PIX_CHUNK; len -= PIX_CHUNK, ip += PIX_CHUNK * 4) {
+        REBLEN n = First_Full_Pixel(
+            PIX_OR(PIX_EQ(PIX_LOAD(ip), splat), ignore)
+        );
+        if (n != PIX_CHUNK)
+            return ip + n * 4;
+    }
+  #endif
+
     for (; len > 0; len--, ip += 4) {
         if (ip[0] != pixel[0])
             continue; // red not equal
@@ -430,14 +552,33 @@ REBYTE *Find_Alpha(REBYTE *ip, REBYTE alpha, REBLEN len)
 void RGB_To_Bin(REBYTE *bin, REBYTE *rgba, REBINT len, bool alpha)
 {
     if (alpha) {
-        for (; len > 0; len--, rgba += 4, bin += 4) {
-            bin[0] = rgba[0];
-            bin[1] = rgba[1];
-            bin[2] = rgba[2];
-            bin[3] = rgba[3];
-        }
+        if (len > 0)
+            memcpy(bin, rgba, len * 4);
     } else {
-        // Only the RGB part:
+        // Only the RGB part.  The vector and 4-byte stores write past the 3
+        // bytes they're for, but the next pixels overwrite that, so they stop
+        // while there are enough pixels left for it to be in the output.
+
+      #if defined(PIXEL_NEON)
+        for (; len >= 16; len -= 16, rgba += 16 * 4, bin += 16 * 3) {
+            uint8x16x4_t in = vld4q_u8(rgba);  // de-interleaves the channels
+            uint8x16x3_t out;
+            out.val[0] = in.val[0];
+            out.val[1] = in.val[1];
+            out.val[2] = in.val[2];
+            vst3q_u8(bin, out);
+        }
+      #elif defined(__SSSE3__) && !defined(PIXEL_SCALAR)
+        const __m128i pack = _mm_setr_epi8(
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1
+        );
+        for (; len >= 6; len -= PIX_CHUNK, rgba += 16, bin += 12)
+            PIX_STORE(bin, _mm_shuffle_epi8(PIX_LOAD(rgba), pack));
+      #endif
+
+        for (; len > 1; len--, rgba += 4, bin += 3)
+            memcpy(bin, rgba, 4);
+
         for (; len > 0; len--, rgba += 4, bin += 3) {
             bin[0] = rgba[0];
             bin[1] = rgba[1];
@@ -476,6 +617,18 @@ void Bin_To_RGBA(
 ){
     if (len > (REBINT)size) len = size; // avoid over-run
 
+    if (not only) {
+        if (len > 0)
+            memmove(rgba, bin, len * 4);  // bin may be the image's own bytes
+        return;
+    }
+
+  #if !defined(PIXEL_SCALAR)
+    PixVec mask = Alpha_Mask();
+    for (; len >= PIX_CHUNK; len -= PIX_CHUNK, rgba += 16, bin += 16)
+        PIX_STORE(rgba, PIX_SELECT(mask, PIX_LOAD(rgba), PIX_LOAD(bin)));
+  #endif
+
     for (; len > 0; len--, rgba += 4, bin += 4) {
         rgba[0] = bin[0]; // red
         rgba[1] = bin[1]; // green
@@ -796,9 +949,9 @@ void Find_Image(REBFRM *frame_)
 
     REBVAL *value = ARG(series);
     REBVAL *arg = ARG(pattern);
-    REBLEN index = VAL_IMAGE_POS(arg);
-    REBLEN tail = VAL_IMAGE_LEN_HEAD(arg);
-    REBYTE *ip = VAL_IMAGE_AT(arg);
+    REBLEN index = VAL_IMAGE_POS(value);
+    REBLEN tail = VAL_IMAGE_LEN_HEAD(value);
+    REBYTE *ip = VAL_IMAGE_AT(value);
 
     REBLEN len = tail - index;
     if (len == 0) {
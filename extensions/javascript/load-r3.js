@@ -143,7 +143,8 @@ const default_config = {
     info: console_in.info,
     error: console_in.error,
     warn: console_in.warn,
-    tracing_on: false
+    tracing_on: false,
+    jspi: false  // use the JSPI build if the browser can, see below
 }
 
 let console = undefined;  // force use e.g. of config.log(), not console.log()
@@ -279,7 +280,19 @@ config.info("Has Threads => " + hasThreads)
 let use_asyncify = true  /* ! hasThreads */
 let os_id = use_asyncify ? "0.16.1" : "0.16.2"
 
-config.info("Use Asyncify => " + use_asyncify)
+// JSPI ("JavaScript Promise Integration") lets the WebAssembly engine
+// suspend the WASM stack while a promise is pending, instead of Asyncify's
+// instrumentation of the code.  That build (0.16.4) is smaller and faster,
+// but a deployment may not have uploaded it...so it's only used if asked for
+// (`jspi: true` in the config, or `?jspi` in the URL) and the browser has
+// the feature.  Otherwise this falls back on the Asyncify build.
+//
+// https://v8.dev/blog/jspi
+//
+let hasJSPI = typeof WebAssembly.Suspending === "function"
+config.info("Has JSPI => " + hasJSPI)
+
+let use_jspi = false  // decided after the URL switches are read, below
 
 
 //=//// HELPER FOR USE WITH FETCH() ////////////////////////////////////////=//
@@ -335,6 +348,8 @@ for (let i = 0; i < js_args.length; i++) {
             base_dir = "https://metaeducation.s3.amazonaws.com/travis-builds/"
         } else if (a[0] == 'tracing_on') {
             config.tracing_on = true
+        } else if (a[0] == 'jspi') {
+            config.jspi = true
         } else
             reb_args += a[0] + ": true "  // look like being set to true
     }
@@ -349,6 +364,14 @@ for (let i = 0; i < js_args.length; i++) {
 }
 reb_args += "]"
 
+if (config.jspi && hasJSPI) {
+    use_asyncify = false
+    use_jspi = true
+    os_id = "0.16.4"
+}
+config.info("Use Asyncify => " + use_asyncify)
+config.info("Use JSPI => " + use_jspi)
+
 if (is_debug) {
     let old_alert = window.alert
     window.alert = function(message) {
@@ -363,8 +386,9 @@ if (!base_dir) {
     // Default to using the base directory as wherever the %load-r3.js was
     // fetched from.  Today, that is typically on AWS.
     //
-    // The directory should have subdirectories %0.16.2/ (for WASM threading)
-    // and %0.16.1/ (for emterpreter files).
+    // The directory should have subdirectories %0.16.1/ (for asyncify
+    // files) and, if it is offered, %0.16.4/ (for JSPI files).  %0.16.2/
+    // was for WASM threading.
     //
     // WARNING: for this detection to work, load-r3.js URL MUST CONTAIN '/':
     // USE './load-r3.js' INSTEAD OF 'load-r3.js'"
@@ -390,7 +414,7 @@ let load_js_promiser = (url) => new Promise(function(resolve, reject) {
     script.onload = () => { resolve(url) }
     script.onerror = () => { reject(url) }
 
-    if (!use_asyncify) {  // !!! use_asyncify is always true ATM, see note
+    if (!use_asyncify && !use_jspi) {  // !!! never pthreads ATM, see note
         //
         // SharedArrayBuffer is needed to implement a threading model in
         // Emscripten, but issues with the Spectre vulnerability and other
@@ -475,11 +499,11 @@ function libRebolComponentURL(suffix) {  // suffix includes the dot
     if (!lib_suffixes.includes(suffix))
         throw Error("Unknown libRebol component extension: " + suffix)
 
-    if (use_asyncify) {
+    if (use_asyncify || use_jspi) {
         if (suffix == ".worker.js")
             throw Error(
                 "Asking for " + suffix + " file "
-                + " in an emterpreter build (should only be for pthreads)"
+                + " in a non-pthread build (should only be for pthreads)"
             )
     }
 
@@ -544,7 +568,7 @@ function libRebolComponentURL(suffix) {  // suffix includes the dot
 let workerJsBlob = null
 let prefetch_worker_js_promiser = () => new Promise(
     function (resolve, reject) {
-        if (use_asyncify) {
+        if (use_asyncify || use_jspi) {
             resolve()
             return
         }
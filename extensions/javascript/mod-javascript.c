@@ -435,6 +435,7 @@ void RunPromise(void)
     REBARR *code = ARR(Pointer_From_Heapaddr(info->promise_id));
     assert(NOT_SERIES_FLAG(code, MANAGED));  // took off so it didn't GC
     SET_SERIES_FLAG(code, MANAGED);  // but need it back on to execute it
+    Mark_If_Unswept(code);
 
     // We run the code using rebRescue() so that if there are errors, we
     // will be able to trap them.  the difference between `throw()`
@@ -536,6 +537,10 @@ EXTERN_C void RL_rebSignalResolveNative_internal(intptr_t frame_id) {
 
     assert(PG_Native_State == NATIVE_STATE_RUNNING);
     PG_Native_State = NATIVE_STATE_RESOLVED;
+
+  #if defined(USE_JSPI)
+    EM_ASM({ reb.WakeNative_internal() });  // see Wait_For_Native_Signal()
+  #endif
 }
 
 
@@ -546,6 +551,112 @@ EXTERN_C void RL_rebSignalRejectNative_internal(intptr_t frame_id) {
 
     assert(PG_Native_State == NATIVE_STATE_RUNNING);
     PG_Native_State = NATIVE_STATE_REJECTED;
+
+  #if defined(USE_JSPI)
+    EM_ASM({ reb.WakeNative_internal() });  // see Wait_For_Native_Signal()
+  #endif
+}
+
+
+#if defined(USE_JSPI)
+    //
+    // With JSPI the engine can suspend the WASM stack while a promise is
+    // pending, so JavaScript_Dispatcher() doesn't have to poll with
+    // emscripten_sleep().  It waits on a promise, which is settled when the
+    // native calls its resolve or reject.  (A native that already did that
+    // before returning isn't waited on at all.)
+    //
+    EM_ASYNC_JS(void, Wait_For_Native_Signal, (), {
+        await new Promise(function(wake) {
+            reb.WakeNative_internal = function() {
+                reb.WakeNative_internal = function() {}
+                wake()
+            }
+        })
+    })
+#endif
+
+
+//=//// BINARY! VIEWS /////////////////////////////////////////////////////=//
+//
+// reb.Binary() copies the bytes of a JS array into a new BINARY!, and
+// reb.Bytes() copies them back out.  For media code that's one or two full
+// copies per frame.  reb.BinaryView() instead gives JavaScript a Uint8Array
+// that is right on the WASM memory of the binary's data, to read or fill.
+//
+// The data mustn't move while such a view exists.  So a lock holds an API
+// handle to keep the binary from being GC'd, and makes its series
+// FIXED_SIZE.  Anything that would reallocate the data fails with
+// "series is locked" instead.  A view's release() unlocks it, or the GC of
+// the view does (see reb.BinaryView() in %prep-libr3-js.reb).
+//
+// !!! Views would be detached if the WASM memory could grow, since that
+// replaces its ArrayBuffer.  But ALLOW_MEMORY_GROWTH isn't used, see the
+// notes in %configs/emscripten.r.
+//
+
+struct Reb_Binary_Lock {
+    REBVAL *binary;  // unmanaged API handle
+    bool was_fixed;  // series was FIXED_SIZE before (by someone else)
+    struct Reb_Binary_Lock *next;
+};
+
+static struct Reb_Binary_Lock *PG_Binary_Locks;  // Singly-linked list
+
+
+// Returns an ID to give to rebUnlockBinary_internal()
+//
+EXTERN_C intptr_t RL_rebLockBinary_internal(const REBVAL *binary)
+{
+    if (not IS_BINARY(binary))
+        fail ("reb.BinaryView() only takes BINARY!");
+
+    REBBIN *bin = VAL_BINARY_ENSURE_MUTABLE(binary);
+
+    struct Reb_Binary_Lock *lock = TRY_ALLOC(struct Reb_Binary_Lock);
+    lock->binary = Copy_Cell(Alloc_Value(), binary);
+    rebUnmanage(lock->binary);  // lives until the view is released
+    lock->was_fixed = GET_SERIES_FLAG(bin, FIXED_SIZE);
+    SET_SERIES_FLAG(bin, FIXED_SIZE);
+
+    lock->next = PG_Binary_Locks;
+    PG_Binary_Locks = lock;
+
+    return Heapaddr_From_Pointer(lock);
+}
+
+
+EXTERN_C void RL_rebUnlockBinary_internal(intptr_t lock_id)
+{
+    struct Reb_Binary_Lock *lock = cast(
+        struct Reb_Binary_Lock*, Pointer_From_Heapaddr(lock_id)
+    );
+
+    struct Reb_Binary_Lock **link = &PG_Binary_Locks;
+    while (*link != lock) {
+        assert(*link != nullptr);  // JS side doesn't unlock twice
+        link = &(*link)->next;
+    }
+    *link = lock->next;
+
+    // When there are other views of the same binary, the FIXED_SIZE is left
+    // for the last of them to undo (if it was set by a lock at all).
+    //
+    REBBIN *bin = VAL_BINARY_KNOWN_MUTABLE(lock->binary);
+    struct Reb_Binary_Lock *other = PG_Binary_Locks;
+    for (; other != nullptr; other = other->next) {
+        if (VAL_BINARY(other->binary) == bin)
+            break;
+    }
+    if (other) {
+        if (not lock->was_fixed)
+            other->was_fixed = false;
+    }
+    else if (not lock->was_fixed)
+        CLEAR_SERIES_FLAG(bin, FIXED_SIZE);
+
+    rebRelease(lock->binary);
+    FREE(struct Reb_Binary_Lock, lock);
 }
 
 
@@ -616,7 +727,11 @@ REB_R JavaScript_Dispatcher(REBFRM *f)
         // triggering of a cancellation signal.  See implementation notes for
         // `reb.CancelAllCancelables_internal()`.
         //
+      #if defined(USE_JSPI)
+        Wait_For_Native_Signal();
+      #else
         emscripten_sleep(50);
+      #endif
     }
     TRACE("JavaScript_Dispatcher() => end emscripten_sleep() loop");
 
@@ -31,5 +31,16 @@ function toplevelTest() {
 
     logTest(1, 3 == reb.UnboxInteger("1 + 2"))
 
+    // A BINARY! view writes straight into the binary, and the binary can't
+    // grow (which could move its data) until the view is released.
+    //
+    let binary = reb.Binary(3)
+    let view = reb.BinaryView(binary)
+    view.set([1, 2, 3])
+    logTest(2, reb.Did("#{010203} =", binary))
+    logTest(3, reb.Did("error? trap [append", binary, "#{04}]"))
+    view.release()
+    logTest(4, reb.Did("#{01020304} = append", reb.R(binary), "#{04}"))
+
     return all_pass
 }
@@ -34,8 +34,55 @@
 // has a minor dependency on %reb-c.h
 
 extern jmp_buf jpeg_state;
-extern void jpeg_info(char *buffer, int nbytes, int *w, int *h);
-extern void jpeg_load(char *buffer, int nbytes, char *output);
+extern void jpeg_info(char *buffer, int nbytes, int scale, int *w, int *h);
+extern void jpeg_load(
+    char *buffer, int nbytes, int scale, int threads, char *output
+);
+extern char *jpeg_load_stream(
+    int (*read)(void *context, char *buffer, int size),
+    char *(*alloc)(void *context, int w, int h), void *context,
+    int scale, int *w, int *h
+);
+
+#define MAX_JPEG_THREADS 64  // see MAX_JPEG_BANDS in %u-jpg.c
+
+
+// When DECODE-JPEG is given a PORT!, the decoder READs it a chunk at a time
+// through these callbacks, so the file is never all in memory along with the
+// pixels.
+//
+struct Reb_Jpeg_Stream {
+    const REBVAL *port;
+    REBVAL *error;  // READ's error, raised after the decoder is cleaned up
+};
+
+static int Read_Jpeg_Chunk(void *context, char *buffer, int size)
+{
+    struct Reb_Jpeg_Stream *stream = cast(struct Reb_Jpeg_Stream*, context);
+
+    // A fail() here would longjmp past the decoder without it freeing its
+    // memory, so the error is held and the decoder is made to give up.
+    //
+    REBVAL *result = rebValue(
+        "entrap [read/part", stream->port, rebI(size), "]"
+    );
+    if (rebDid("error?", result)) {
+        stream->error = result;
+        return -1;
+    }
+
+    size_t got = rebBytesInto(
+        cast(unsigned char*, buffer), size,
+        "first", rebR(result)
+    );
+    return cast(int, got);
+}
+
+static char *Alloc_Jpeg_Image(void *context, int w, int h)
+{
+    UNUSED(context);
+    return rebAllocN(char, (w * h) * 4);  // RGBA is 4 bytes
+}
 
 
 //
@@ -62,7 +109,7 @@ REBNATIVE(identify_jpeg_q)
     REBYTE *data = m_cast(REBYTE*, VAL_BINARY_SIZE_AT(&size, ARG(data)));
 
     int w, h;
-    jpeg_info(s_cast(data), size, &w, &h); // may longjmp above
+    jpeg_info(s_cast(data), size, 1, &w, &h); // may longjmp above
     return Init_True(D_OUT);
 }
 
@@ -73,28 +120,71 @@ REBNATIVE(identify_jpeg_q)
 //  {Codec for decoding BINARY! data for a JPEG}
 //
 //      return: [image!]
-//      data [binary!]
+//      data "A PORT! is read a chunk at a time instead of all at once"
+//          [binary! port!]
+//      /scale "Decode at 1/2, 1/4, or 1/8 of the size (2, 4, or 8), faster"
+//          [integer!]
+//      /threads "Decode bands between restart markers on this many threads"
+//          [integer!]
 //  ]
 //
 REBNATIVE(decode_jpeg)
+//
+// The scaled decode only does the low-frequency part of the IDCT for each
+// block, which is much less work than decoding in full and then shrinking.
+// It's the way to make a thumbnail (maybe followed by a RESAMPLE to get an
+// exact size).
+//
+// Decoding in parallel needs all the data at once, so /THREADS is ignored
+// when reading from a PORT!.
 {
     JPG_INCLUDE_PARAMS_OF_DECODE_JPEG;
 
+    int scale = 1;
+    if (REF(scale)) {
+        scale = VAL_INT32(ARG(scale));
+        if (scale != 1 and scale != 2 and scale != 4 and scale != 8)
+            fail (PAR(scale));
+    }
+
+    int threads = 1;
+    if (REF(threads)) {
+        threads = VAL_INT32(ARG(threads));
+        if (threads < 1 or threads > MAX_JPEG_THREADS)
+            fail (PAR(threads));
+    }
+
+    struct Reb_Jpeg_Stream stream;
+    stream.port = ARG(data);
+    stream.error = nullptr;
+
     // Handle JPEG error throw:
-    if (setjmp(jpeg_state))
+    if (setjmp(jpeg_state)) {
+        if (stream.error)
+            rebJumps("fail", rebR(stream.error));
         fail (Error_Bad_Media_Raw()); // generic
-
-    // !!! jpeg code is not const-correct, we trust it not to modify data
-    //
-    REBSIZ size;
-    REBYTE *data = m_cast(REBYTE*, VAL_BINARY_SIZE_AT(&size, ARG(data)));
+    }
 
     int w, h;
-    jpeg_info(s_cast(data), size, &w, &h); // may longjmp above
+    char *image_bytes;
 
-    char *image_bytes = rebAllocN(char, (w * h) * 4);  // RGBA is 4 bytes
+    if (IS_PORT(ARG(data))) {
+        image_bytes = jpeg_load_stream(  // may longjmp above
+            &Read_Jpeg_Chunk, &Alloc_Jpeg_Image, &stream, scale, &w, &h
+        );
+    }
+    else {
+        // !!! jpeg code is not const-correct, we trust it not to modify data
+        //
+        REBSIZ size;
+        REBYTE *data = m_cast(REBYTE*, VAL_BINARY_SIZE_AT(&size, ARG(data)));
+
+        jpeg_info(s_cast(data), size, scale, &w, &h); // may longjmp above
 
-    jpeg_load(s_cast(data), size, image_bytes);
+        image_bytes = Alloc_Jpeg_Image(nullptr, w, h);
+
+        jpeg_load(s_cast(data), size, scale, threads, image_bytes);
+    }
 
     REBVAL *binary = rebRepossess(image_bytes, (w * h) * 4);
 
@@ -11,8 +11,15 @@
 #include <setjmp.h>
 
 extern jmp_buf jpeg_state;
-extern void jpeg_info(char *buffer, int nbytes, int *w, int *h);
-extern void jpeg_load(char *buffer, int nbytes, char *output);
+extern void jpeg_info(char *buffer, int nbytes, int scale, int *w, int *h);
+extern void jpeg_load(
+    char *buffer, int nbytes, int scale, int threads, char *output
+);
+extern char *jpeg_load_stream(
+    int (*read)(void *context, char *buffer, int size),
+    char *(*alloc)(void *context, int w, int h), void *context,
+    int scale, int *w, int *h
+);
 
 
 #include "pstdint.h" // for uint32_t
@@ -49,8 +56,14 @@ typedef struct {
   JOCTET * buffer;      /* start of buffer */
   size_t   nbytes;
   boolean start_of_file;    /* have we gotten any data yet? */
+
+  /* If not NULL, the buffer is refilled by this (see jpeg_stream_src) */
+  int (*read) (void *context, char *buffer, int size);
+  void *context;
 } my_source_mgr;
 
+#define JPEG_STREAM_BUF 65536   /* bytes asked of a stream at a time */
+
 typedef my_source_mgr * my_src_ptr;
 
 /*
@@ -110,6 +123,14 @@ fill_input_buffer (j_decompress_ptr cinfo)
   my_src_ptr src = (my_src_ptr) cinfo->src;
   static JOCTET buffer[ 2 ];
 
+  if (src->read != NULL) {
+    int got = (*src->read) (src->context, (char *) src->buffer,
+      JPEG_STREAM_BUF);
+    if (got < 0)
+      ERREXIT(cinfo, JERR_FILE_READ);
+    src->nbytes = (size_t) got;
+  }
+
   if (src->nbytes <= 0) {
     if (src->start_of_file) /* Treat empty input file as fatal error */
       ERREXIT(cinfo, JERR_INPUT_EMPTY);
@@ -123,6 +144,7 @@ fill_input_buffer (j_decompress_ptr cinfo)
   else {
       src->pub.next_input_byte = src->buffer;
       src->pub.bytes_in_buffer = src->nbytes;
+      src->nbytes = 0;  /* a series is all in the buffer at once */
   }
 
   src->start_of_file = FALSE;
@@ -153,6 +175,13 @@ skip_input_data (j_decompress_ptr cinfo, long num_bytes)
    * any trouble anyway --- large skips are infrequent.
    */
   if (num_bytes > 0) {
+    while (num_bytes > (long) src->pub.bytes_in_buffer) {
+      num_bytes -= (long) src->pub.bytes_in_buffer;
+      (void) fill_input_buffer(cinfo);
+      /* note we assume that fill_input_buffer will never return FALSE,
+       * so suspension need not be handled.
+       */
+    }
     src->pub.next_input_byte += (size_t) num_bytes;
     src->pub.bytes_in_buffer -= (size_t) num_bytes;
   }
@@ -217,17 +246,43 @@ jpeg_series_src (j_decompress_ptr cinfo, JOCTET *buffer, size_t nbytes )
   src->pub.term_source = term_source;
   src->buffer = buffer;
   src->nbytes = nbytes;
+  src->read = NULL;
+  src->context = NULL;
   src->pub.bytes_in_buffer = 0; /* forces fill_input_buffer on first read */
   src->pub.next_input_byte = NULL; /* until buffer loaded */
 }
 
-void jpeg_info( char *buffer, int nbytes, int *w, int *h )
+
+/*
+ * Prepare for input that `read` gives a chunk at a time, so the whole file
+ * need not be in memory.  It returns how many bytes it put in the buffer
+ * (up to `size`), 0 at the end of the data, or -1 on an error.
+ */
+
+GLOBAL(void)
+jpeg_stream_src (j_decompress_ptr cinfo,
+    int (*read) (void *context, char *buffer, int size), void *context)
+{
+  my_src_ptr src;
+
+  jpeg_series_src(cinfo, NULL, 0);
+
+  src = (my_src_ptr) cinfo->src;
+  src->buffer = (JOCTET *)
+    (*cinfo->mem->alloc_small) ((j_common_ptr) cinfo, JPOOL_PERMANENT,
+                JPEG_STREAM_BUF * SIZEOF(JOCTET));
+  src->read = read;
+  src->context = context;
+}
+
+void jpeg_info( char *buffer, int nbytes, int scale, int *w, int *h )
 {
   struct jpeg_decompress_struct cinfo;
   struct jpeg_error_mgr jerr;
 
   /* Initialize the JPEG decompression object with default error handling. */
   cinfo.err = jpeg_std_error(&jerr);
+  cinfo.client_data = NULL; /* errors longjmp to jpeg_state */
   jpeg_create_decompress(&cinfo);
 
   /* Specify data source for decompression */
@@ -235,51 +290,136 @@ void jpeg_info( char *buffer, int nbytes, int *w, int *h )
 
   /* Read file header, set default decompression parameters */
   (void) jpeg_read_header(&cinfo, TRUE);
-  *w = cinfo.image_width;
-  *h = cinfo.image_height;
+
+  /* Size after scaling by the IDCT (1, 2, 4, or 8 for 1/scale) */
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = scale;
+  jpeg_calc_output_dimensions(&cinfo);
+  *w = cinfo.output_width;
+  *h = cinfo.output_height;
 
   jpeg_destroy_decompress(&cinfo);
 }
 
-void jpeg_load( char *buffer, int nbytes, char *output )
+
+/*
+ * Decode JPEG data at 1/scale size into RGBA `output`.  The first `skip`
+ * rows are decoded but not stored, then up to `rows` rows are stored (pass
+ * JPEG_ALL_ROWS for the rest of the image).  Errors go to `jump` if it is
+ * not NULL, else to jpeg_state.
+ */
+#define JPEG_ALL_ROWS ((JDIMENSION) -1)
+
+static void jpeg_decode_rows( j_decompress_ptr cinfo,
+    JDIMENSION skip, JDIMENSION rows, char *output );
+
+static void jpeg_load_rows( JOCTET *buffer, size_t nbytes, int scale,
+    JDIMENSION skip, JDIMENSION rows, char *output, jmp_buf *jump )
 {
   struct jpeg_decompress_struct cinfo;
   struct jpeg_error_mgr jerr;
-  JSAMPROW  array[ 4 ];
-  unsigned int  i, j;
 
   /* Initialize the JPEG decompression object with default error handling. */
   cinfo.err = jpeg_std_error(&jerr);
+  cinfo.client_data = jump;
   jpeg_create_decompress(&cinfo);
 
   /* Specify data source for decompression */
-  jpeg_series_src(&cinfo, (unsigned char *)buffer, nbytes);
+  jpeg_series_src(&cinfo, buffer, nbytes);
 
   /* Read file header, set default decompression parameters */
   (void) jpeg_read_header(&cinfo, TRUE);
 
+  /* Scale by skipping IDCT work, see jidctred.c */
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = scale;
+
+  jpeg_decode_rows(&cinfo, skip, rows, output);
+}
+
+
+/*
+ * Decode JPEG data that `read` gives a chunk at a time (see jpeg_stream_src)
+ * at 1/scale size.  Once the header says how big the image is, `alloc` is
+ * asked for the RGBA output, which is returned.  Errors go to jpeg_state.
+ */
+char *jpeg_load_stream( int (*read)(void *context, char *buffer, int size),
+    char *(*alloc)(void *context, int w, int h), void *context,
+    int scale, int *w, int *h )
+{
+  struct jpeg_decompress_struct cinfo;
+  struct jpeg_error_mgr jerr;
+  char *output;
+
+  cinfo.err = jpeg_std_error(&jerr);
+  cinfo.client_data = NULL; /* errors longjmp to jpeg_state */
+  jpeg_create_decompress(&cinfo);
+
+  jpeg_stream_src(&cinfo, read, context);
+
+  (void) jpeg_read_header(&cinfo, TRUE);
+
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = scale;
+  jpeg_calc_output_dimensions(&cinfo);
+  *w = cinfo.output_width;
+  *h = cinfo.output_height;
+
+  output = (*alloc) (context, *w, *h);
+
+  jpeg_decode_rows(&cinfo, 0, JPEG_ALL_ROWS, output);
+  return output;
+}
+
+
+/*
+ * Decompress rows after jpeg_read_header(), then destroy the decompressor.
+ */
+static void jpeg_decode_rows( j_decompress_ptr cinfo,
+    JDIMENSION skip, JDIMENSION rows, char *output )
+{
+  JSAMPROW  array[ 4 ];
+  JSAMPARRAY scratch;
+  JDIMENSION end;
+  unsigned int  i, j, n;
+
   /* Start decompressor */
-  (void) jpeg_start_decompress(&cinfo);
+  (void) jpeg_start_decompress(cinfo);
+
+  /* Skip rows, e.g. ones only decoded to give context to the next ones */
+  if (skip > cinfo->output_height)
+    skip = cinfo->output_height;
+  if (skip > 0) {
+    scratch = (*cinfo->mem->alloc_sarray) ((j_common_ptr) cinfo, JPOOL_IMAGE,
+      cinfo->output_width * cinfo->output_components, 1);
+    while (cinfo->output_scanline < skip)
+      jpeg_read_scanlines(cinfo, scratch, 1);
+  }
+
+  if (rows > cinfo->output_height - skip)
+    rows = cinfo->output_height - skip;
+  end = skip + rows;
 
   /* Process data */
-  while (cinfo.output_scanline < cinfo.output_height) {
-    array[ 0 ] = (JSAMPROW)(output + cinfo.output_scanline * cinfo.image_width * 4);
-    array[ 1 ] = array[ 0 ] + cinfo.image_width * 4;
-    array[ 2 ] = array[ 1 ] + cinfo.image_width * 4;
-    array[ 3 ] = array[ 2 ] + cinfo.image_width * 4;
-    jpeg_read_scanlines(&cinfo, array, 4 );
+  while (cinfo->output_scanline < end) {
+    array[ 0 ] = (JSAMPROW)(output + (cinfo->output_scanline - skip) * cinfo->output_width * 4);
+    array[ 1 ] = array[ 0 ] + cinfo->output_width * 4;
+    array[ 2 ] = array[ 1 ] + cinfo->output_width * 4;
+    array[ 3 ] = array[ 2 ] + cinfo->output_width * 4;
+    n = end - cinfo->output_scanline;
+    jpeg_read_scanlines(cinfo, array, n < 4 ? n : 4 );
   }
 
-  if (cinfo.out_color_space != JCS_GRAYSCALE)
+  if (cinfo->out_color_space != JCS_GRAYSCALE)
   // convert 3 byte values into four byte ones
-  for ( i=0; i<cinfo.image_height; i++ ) {
+  for ( i=0; i<rows; i++ ) {
     unsigned char   *cp;
     unsigned char   *dp;
 
-    cp = (unsigned char *)(output + cinfo.image_width * 3);
-    dp = (unsigned char *)(output + cinfo.image_width * 4);
+    cp = (unsigned char *)(output + cinfo->output_width * 3);
+    dp = (unsigned char *)(output + cinfo->output_width * 4);
     output = ( char * )dp;
-    for ( j=0; j<cinfo.image_width; j++ ) {
+    for ( j=0; j<cinfo->output_width; j++ ) {
         cp -= 3;
         *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
         *--dp = cp[2]; // blue
@@ -289,15 +429,15 @@ void jpeg_load( char *buffer, int nbytes, char *output )
   }
   else
   // convert 1 byte value into four byte ones
-    for ( i=0; i<cinfo.image_height; i++ ) {
+    for ( i=0; i<rows; i++ ) {
       unsigned char *cp;
       unsigned char *dp;
       unsigned char c;
 
-      cp = (unsigned char *)(output + cinfo.image_width);
-      dp = (unsigned char *)(output + cinfo.image_width * 4);
+      cp = (unsigned char *)(output + cinfo->output_width);
+      dp = (unsigned char *)(output + cinfo->output_width * 4);
       output = ( char * )dp;
-      for ( j=0; j<cinfo.image_width; j++ ) {
+      for ( j=0; j<cinfo->output_width; j++ ) {
         c = *--cp;
         *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
         *--dp = c; // blue
@@ -309,9 +449,313 @@ void jpeg_load( char *buffer, int nbytes, char *output )
   /* Finish decompression and release memory.
    * I must do it in this order because output module has allocated memory
    * of lifespan JPOOL_IMAGE; it needs to finish before releasing memory.
+   * (If rows were left unread, there's nothing to finish.)
    */
-  (void) jpeg_finish_decompress(&cinfo);
+  if (cinfo->output_scanline < cinfo->output_height)
+    jpeg_abort_decompress(cinfo);
+  else
+    (void) jpeg_finish_decompress(cinfo);
+  jpeg_destroy_decompress(cinfo);
+}
+
+
+/*
+ * Parallel decoding by restart intervals.
+ *
+ * Entropy-coded data can't be split at arbitrary points, but a restart
+ * marker (RSTn) resets the decoder: DC predictions start over and the bits
+ * begin on a byte boundary.  So if the restart interval puts markers at the
+ * starts of MCU rows, each band of rows between such markers is decodable
+ * by itself.  A band is given to its own decoder as a JPEG of its own: the
+ * original headers with the height patched to the band's, the band's data
+ * with its RSTn renumbered from 0, and an EOI.
+ *
+ * Chroma subsampled vertically is interpolated from the rows above and
+ * below, so each band's JPEG also has the restart interval of rows before
+ * and after it.  The decoder throws away the rows of that context, and the
+ * pixels come out just as one decoder would give them.
+ *
+ * Only single-scan files can be split (a progressive file needs all of its
+ * scans to make any row), and only if the restarts line up with rows often
+ * enough to give 2 bands or more.  Anything else is decoded on one thread.
+ */
+
+#ifdef USE_PARALLEL_JPEG
+
+#include <pthread.h>
+
+#define MAX_JPEG_BANDS 64
+
+struct jpeg_band {
+  JOCTET *data;     /* synthesized JPEG for the band and its context */
+  size_t nbytes;
+  int scale;
+  JDIMENSION skip;  /* rows of context above the band */
+  JDIMENSION rows;  /* rows in the band */
+  char *output;     /* where the band's first RGBA row goes */
+  jmp_buf jump;     /* error_exit of the band's decoder comes here */
+  boolean failed;
+};
+
+static void jpeg_run_band( struct jpeg_band *band )
+{
+  if (setjmp(band->jump)) {
+    band->failed = TRUE;    /* error_exit already destroyed the decoder */
+    return;
+  }
+  jpeg_load_rows(band->data, band->nbytes, band->scale, band->skip,
+    band->rows, band->output, &band->jump);
+}
+
+static void *jpeg_band_thread( void *band )
+{
+  jpeg_run_band((struct jpeg_band *) band);
+  return NULL;
+}
+
+
+/*
+ * Offset of the 2-byte height in the SOFn marker of the headers, or 0 if
+ * there isn't one where expected.
+ */
+static size_t jpeg_sof_height_offset( const JOCTET *data, size_t header )
+{
+  size_t pos = 2;   /* skip SOI */
+  while (pos + 4 <= header) {
+    int marker;
+    if (data[pos] != 0xFF)
+      return 0;
+    marker = data[pos + 1];
+    if (marker == 0xFF) {   /* fill byte */
+      pos++;
+      continue;
+    }
+    if (marker >= 0xC0 && marker <= 0xCF  /* SOFn, but not DHT, JPG, DAC */
+      && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+      return pos + 5 + 2 <= header ? pos + 5 : 0;
+    pos += 2 + ((size_t) data[pos + 2] << 8) + data[pos + 3];
+  }
+  return 0;
+}
+
+
+/*
+ * Returns FALSE (having decoded nothing) if the data can't be split, else
+ * decodes the bands on up to `threads` threads.
+ */
+static boolean jpeg_load_parallel( JOCTET *buffer, size_t nbytes, int scale,
+    int threads, char *output )
+{
+  struct jpeg_decompress_struct cinfo;
+  struct jpeg_error_mgr jerr;
+  struct jpeg_band bands[ MAX_JPEG_BANDS ];
+  pthread_t thread_ids[ MAX_JPEG_BANDS ];
+  boolean started[ MAX_JPEG_BANDS ];
+  size_t *seg_start, *seg_end;
+  size_t header, sof, pos;
+  unsigned long width, height, mcu_w, mcu_h, mcus_per_row, mcu_rows;
+  unsigned long ri, total_segs, period_rows, period_segs, units, k, a, b;
+  unsigned long out_w;
+  boolean ok;
+  int num_bands, i;
+
+  cinfo.err = jpeg_std_error(&jerr);
+  cinfo.client_data = NULL; /* errors longjmp to jpeg_state */
+  jpeg_create_decompress(&cinfo);
+  jpeg_series_src(&cinfo, buffer, nbytes);
+  (void) jpeg_read_header(&cinfo, TRUE);
+
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = scale;
+  jpeg_calc_output_dimensions(&cinfo);
+
+  ok = !cinfo.progressive_mode
+    && !jpeg_has_multiple_scans(&cinfo)
+    && cinfo.restart_interval > 0
+    && cinfo.comps_in_scan == cinfo.num_components
+    && (cinfo.num_components > 1    /* else MCUs are single blocks */
+      || (cinfo.max_h_samp_factor == 1 && cinfo.max_v_samp_factor == 1));
+
+  header = cinfo.src->next_input_byte - buffer;  /* just past the SOS */
+  width = cinfo.image_width;
+  height = cinfo.image_height;
+  mcu_w = cinfo.max_h_samp_factor * DCTSIZE;
+  mcu_h = cinfo.max_v_samp_factor * DCTSIZE;
+  ri = cinfo.restart_interval;
+  out_w = cinfo.output_width;
+
   jpeg_destroy_decompress(&cinfo);
+
+  if (!ok || header >= nbytes)
+    return FALSE;
+
+  sof = jpeg_sof_height_offset(buffer, header);
+  if (sof == 0)
+    return FALSE;
+
+  mcus_per_row = (width + mcu_w - 1) / mcu_w;
+  mcu_rows = (height + mcu_h - 1) / mcu_h;
+  total_segs = (mcus_per_row * mcu_rows + ri - 1) / ri;
+
+  /* Restarts are at row starts every lcm(ri, mcus_per_row) MCUs, which is
+   * period_rows rows and period_segs restart segments.
+   */
+  a = ri;
+  b = mcus_per_row;
+  while (b != 0) {
+    k = a % b;
+    a = b;
+    b = k;
+  }
+  period_rows = ri / a;
+  period_segs = mcus_per_row / a;
+  units = (mcu_rows + period_rows - 1) / period_rows;
+
+  num_bands = threads;
+  if (num_bands > MAX_JPEG_BANDS)
+    num_bands = MAX_JPEG_BANDS;
+  if ((unsigned long) num_bands > units)
+    num_bands = (int) units;
+  if (num_bands < 2)
+    return FALSE;
+
+  /* Find where each restart segment starts and ends (at its RSTn, or at
+   * the marker after the last one, e.g. EOI).
+   */
+  seg_start = (size_t *) malloc(2 * total_segs * sizeof(size_t));
+  if (seg_start == NULL)
+    return FALSE;
+  seg_end = seg_start + total_segs;
+
+  k = 0;
+  seg_start[0] = header;
+  pos = header;
+  while (pos + 1 < nbytes) {
+    int marker;
+    if (buffer[pos] != 0xFF) {
+      pos++;
+      continue;
+    }
+    marker = buffer[pos + 1];
+    if (marker == 0x00) {   /* stuffed zero after a data byte of 0xFF */
+      pos += 2;
+      continue;
+    }
+    if (marker == 0xFF) {   /* fill byte */
+      pos++;
+      continue;
+    }
+    seg_end[k++] = pos;
+    if (marker < JPEG_RST0 || marker > JPEG_RST0 + 7 || k == total_segs)
+      break;    /* anything else ends the scan */
+    pos += 2;
+    seg_start[k] = pos;
+  }
+
+  if (k != total_segs) {    /* truncated, or restarts not as expected */
+    free(seg_start);
+    return FALSE;
+  }
+
+  for (i = 0; i < num_bands; i++) {
+    struct jpeg_band *band = &bands[i];
+    unsigned long u_lo = units * i / num_bands;   /* the band */
+    unsigned long u_hi = units * (i + 1) / num_bands;
+    unsigned long c_lo = u_lo > 0 ? u_lo - 1 : 0;   /* with its context */
+    unsigned long c_hi = u_hi < units ? u_hi + 1 : units;
+    unsigned long row_lo = c_lo * period_rows;
+    unsigned long row_hi = c_hi * period_rows;
+    unsigned long seg_lo = c_lo * period_segs;
+    unsigned long seg_hi = c_hi * period_segs;
+    unsigned long band_height, s;
+    size_t size;
+
+    if (row_hi >= mcu_rows) {
+      row_hi = mcu_rows;
+      seg_hi = total_segs;
+      band_height = height - row_lo * mcu_h;
+    }
+    else
+      band_height = (row_hi - row_lo) * mcu_h;
+
+    size = seg_end[seg_hi - 1] - seg_start[seg_lo];
+    band->data = (JOCTET *) malloc(header + size + 2);
+    band->nbytes = header + size + 2;
+    band->scale = scale;
+    band->skip = (JDIMENSION) ((u_lo - c_lo) * period_rows * mcu_h / scale);
+    band->rows = u_hi < units
+      ? (JDIMENSION) ((u_hi - u_lo) * period_rows * mcu_h / scale)
+      : JPEG_ALL_ROWS;
+    band->output = output + (u_lo * period_rows * mcu_h / scale) * out_w * 4;
+    band->failed = FALSE;
+    if (band->data == NULL) {
+      band->failed = TRUE;
+      continue;
+    }
+
+    memcpy(band->data, buffer, header);
+    band->data[sof] = (JOCTET) (band_height >> 8);
+    band->data[sof + 1] = (JOCTET) (band_height & 0xFF);
+
+    memcpy(band->data + header, buffer + seg_start[seg_lo], size);
+    for (s = seg_lo; s + 1 < seg_hi; s++)    /* RSTn between segments */
+      band->data[header + (seg_end[s] - seg_start[seg_lo]) + 1] =
+        (JOCTET) (JPEG_RST0 + ((s - seg_lo) & 7));
+
+    band->data[header + size] = 0xFF;
+    band->data[header + size + 1] = (JOCTET) JPEG_EOI;
+  }
+
+  free(seg_start);
+
+  /* Run each band on its own thread, except the first, which runs here.
+   * If a thread can't be started, its band runs here instead.
+   */
+  for (i = 1; i < num_bands; i++)
+    started[i] = !bands[i].failed && pthread_create(
+      &thread_ids[i], NULL, &jpeg_band_thread, &bands[i]) == 0;
+
+  if (!bands[0].failed)
+    jpeg_run_band(&bands[0]);
+
+  ok = TRUE;
+  for (i = 0; i < num_bands; i++) {
+    if (i > 0 && started[i])
+      pthread_join(thread_ids[i], NULL);
+    else if (i > 0 && !bands[i].failed)
+      jpeg_run_band(&bands[i]);
+    if (bands[i].failed)
+      ok = FALSE;
+    free(bands[i].data);
+  }
+
+  if (!ok)
+    longjmp(jpeg_state, 1);
+
+  return TRUE;
+}
+
+#endif /* USE_PARALLEL_JPEG */
+
+
+/*
+ * Decode at 1/scale size (scale is 1, 2, 4, or 8) into `output`, which has
+ * room for the size jpeg_info() gives.  Files with suitable restart markers
+ * are decoded in bands on up to `threads` threads.
+ */
+void jpeg_load( char *buffer, int nbytes, int scale, int threads,
+    char *output )
+{
+#ifdef USE_PARALLEL_JPEG
+  if (threads > 1 && jpeg_load_parallel((JOCTET *) buffer, nbytes, scale,
+      threads, output))
+    return;
+#else
+  (void) threads;
+#endif
+
+  jpeg_load_rows((JOCTET *) buffer, nbytes, scale, 0, JPEG_ALL_ROWS, output,
+    NULL);
 }
 
 /*
@@ -6741,6 +7185,137 @@ jpeg_idct_islow (j_decompress_ptr cinfo, jpeg_component_info * compptr,
 }
 
 #endif /* DCT_ISLOW_SUPPORTED */
+/*
+ * jidctred.c (substitute)
+ *
+ * This copy of the IJG library came without its reduced-size IDCTs, so
+ * these are written for it, to the same interface.  They're used when
+ * scale_num/scale_denom asks for 1/2, 1/4 or 1/8 size output, and only
+ * look at the low-frequency NxN corner of each block (N = 4, 2, or 1).
+ *
+ * An N-point IDCT of those coefficients is the same as evaluating the
+ * block's 8-point cosine basis at the centers of the N output pixels, so
+ * each output pixel is the full IDCT sampled at a coarser grid--with the
+ * same average (DC) level, and much less work.
+ */
+
+#define JPEG_INTERNALS
+//#include "jinclude.h"
+//#include "jpeglib.h"
+//#include "jdct.h"     /* Private declarations for DCT subsystem */
+
+#ifdef IDCT_SCALING_SUPPORTED
+
+
+/* red_basis_N[n][k] = C(k)/2 * cos((2n+1)*k*PI/(2N)), C(0) = 1/sqrt(2) and
+ * C(k) = 1 otherwise.  A row pass times a column pass then gives the 1/4
+ * C(u)C(v) factor of the 8x8 IDCT formula.
+ */
+
+static const FAST_FLOAT red_basis_4[4][4] = {
+  { 0.353553391f,  0.461939766f,  0.353553391f,  0.191341716f },
+  { 0.353553391f,  0.191341716f, -0.353553391f, -0.461939766f },
+  { 0.353553391f, -0.191341716f, -0.353553391f,  0.461939766f },
+  { 0.353553391f, -0.461939766f,  0.353553391f, -0.191341716f }
+};
+
+static const FAST_FLOAT red_basis_2[2][2] = {
+  { 0.353553391f,  0.353553391f },
+  { 0.353553391f, -0.353553391f }
+};
+
+
+/*
+ * Dequantize the NxN corner of a block of coefficients and inverse DCT it
+ * into an NxN block of samples.  (The multiplier table is the ISLOW one,
+ * which is just the quantization values; see start_pass in jddctmgr.c.)
+ */
+
+LOCAL(void)
+jpeg_idct_reduced (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col,
+           int n, const FAST_FLOAT * basis)
+{
+  ISLOW_MULT_TYPE * quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  FAST_FLOAT coef[4][4];    /* dequantized low-frequency corner */
+  FAST_FLOAT workspace[4][4];   /* [y][u], after the column pass */
+  FAST_FLOAT sum;
+  JSAMPROW outptr;
+  int u, v, x, y;
+
+  for (v = 0; v < n; v++)
+    for (u = 0; u < n; u++)
+      coef[v][u] = ((FAST_FLOAT) coef_block[v * DCTSIZE + u])
+        * quantptr[v * DCTSIZE + u];
+
+  /* Pass 1: inverse transform the columns (the vertical frequencies). */
+
+  for (u = 0; u < n; u++) {
+    for (y = 0; y < n; y++) {
+      sum = 0;
+      for (v = 0; v < n; v++)
+        sum += basis[y * n + v] * coef[v][u];
+      workspace[y][u] = sum;
+    }
+  }
+
+  /* Pass 2: transform the rows, rounding and range-limiting the results
+   * like the 8x8 IDCTs do.
+   */
+
+  for (y = 0; y < n; y++) {
+    outptr = output_buf[y] + output_col;
+    for (x = 0; x < n; x++) {
+      sum = 0;
+      for (u = 0; u < n; u++)
+        sum += basis[x * n + u] * workspace[y][u];
+      outptr[x] = range_limit[((int) (sum < 0 ? sum - 0.5f : sum + 0.5f))
+                  & RANGE_MASK];
+    }
+  }
+}
+
+
+GLOBAL(void)
+jpeg_idct_4x4 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  jpeg_idct_reduced(cinfo, compptr, coef_block, output_buf, output_col,
+            4, &red_basis_4[0][0]);
+}
+
+
+GLOBAL(void)
+jpeg_idct_2x2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  jpeg_idct_reduced(cinfo, compptr, coef_block, output_buf, output_col,
+            2, &red_basis_2[0][0]);
+}
+
+
+/*
+ * The 1x1 case is just the DC level: 1/8 of the dequantized DC coefficient.
+ */
+
+GLOBAL(void)
+jpeg_idct_1x1 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  ISLOW_MULT_TYPE * quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  INT32 dcval = ((INT32) coef_block[0]) * quantptr[0];
+
+  dcval = (dcval < 0) ? -((-dcval + 4) >> 3) : ((dcval + 4) >> 3);
+  output_buf[0][output_col] = range_limit[((int) dcval) & RANGE_MASK];
+}
+
+#endif /* IDCT_SCALING_SUPPORTED */
 /*
  * jdsample.c
  *
@@ -7938,9 +8513,14 @@ jmp_buf jpeg_state;
 METHODDEF(void)
 error_exit (j_common_ptr cinfo)
 {
+    /* A decoder on a thread other than the caller's has its own jmp_buf in
+     * client_data, as it can't jump to the caller's jpeg_state.
+     */
+    jmp_buf *jump = (jmp_buf *) cinfo->client_data;
+
     jpeg_destroy(cinfo); /* don't just abort, actually destroy the object */
 
-    longjmp(jpeg_state, 1);
+    longjmp(jump ? *jump : jpeg_state, 1);
 }
 
 
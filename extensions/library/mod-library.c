@@ -65,7 +65,7 @@ REB_R MAKE_Library(
         fail (arg);
 
     REBLIB *lib = Alloc_Singular(FLAG_FLAVOR(LIBRARY) | NODE_FLAG_MANAGED);
-    Init_Trash(ARR_SINGLE(lib));  // !!! save name? other data?
+    Init_Trash(ARR_SINGLE(lib));  // symbol cache, see Find_Library_Function()
 
     lib->link.fd = fd;  // seen as shared by all instances
     node_MISC(Meta, lib) = nullptr;  // !!! build from spec, e.g. arg?
@@ -116,6 +116,7 @@ REBTYPE(Library)
         else {
             Close_Library(VAL_LIBRARY_FD(lib));
             VAL_LIBRARY(lib)->link.fd = nullptr;
+            Init_Trash(ARR_SINGLE(VAL_LIBRARY(lib)));  // symbols are gone
         }
         return nullptr; }
 
@@ -127,6 +128,46 @@ REBTYPE(Library)
 }
 
 
+//
+//  Find_Library_Function: C
+//
+// Like Find_Function(), but what is found for each name is remembered in the
+// LIBRARY!, so code that calls into a library over and over (such as FFI
+// routines, or extension loading) doesn't look up the symbol each time.  The
+// cache is a BLOCK! of TEXT! names and HANDLE!s in the library's singular
+// cell, and it is dropped when the library is closed.
+//
+CFUNC *Find_Library_Function(REBLIB *lib, const char *name)
+{
+    if (IS_LIB_CLOSED(lib))
+        return nullptr;
+
+    RELVAL *cache = ARR_SINGLE(lib);
+    if (IS_BLOCK(cache)) {
+        const RELVAL *tail;
+        const RELVAL *item = VAL_ARRAY_AT(&tail, cache);
+        for (; item != tail; item += 2) {
+            if (0 == strcmp(cs_cast(STR_HEAD(VAL_STRING(item))), name))
+                return VAL_HANDLE_CFUNC(item + 1);
+        }
+    }
+
+    CFUNC *cfunc = Find_Function(LIB_FD(lib), name);
+    if (cfunc == nullptr)
+        return nullptr;
+
+    if (not IS_BLOCK(cache)) {
+        GC_Write_Barrier(lib);  // the library may be old or already marked
+        Init_Block(cache, Make_Array(2));
+    }
+
+    REBARR *a = VAL_ARRAY_KNOWN_MUTABLE(cache);
+    Init_Text(Alloc_Tail_Array(a), Make_String_UTF8(name));
+    Init_Handle_Cfunc(Alloc_Tail_Array(a), cfunc);
+    return cfunc;
+}
+
+
 //
 //  register-library-hooks: native [
 //
@@ -186,8 +227,8 @@ REBNATIVE(run_library_collator)
     //     OS_CLOSE_LIBRARY(VAL_LIBRARY_FD(lib));
     //
 
-    CFUNC *cfunc = Find_Function(
-        VAL_LIBRARY_FD(ARG(library)),
+    CFUNC *cfunc = Find_Library_Function(
+        VAL_LIBRARY(ARG(library)),
         cs_cast(STR_HEAD(VAL_STRING(ARG(linkname))))
     );
     if (cfunc == nullptr)
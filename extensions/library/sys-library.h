@@ -26,6 +26,7 @@
 //
 // File descriptor in singular->link.fd
 // Meta information in singular->misc.meta
+// Symbols found by Find_Library_Function() in the singular cell
 //
 
 typedef REBARR REBLIB;
@@ -63,3 +64,4 @@ inline static void *VAL_LIBRARY_FD(REBCEL(const*) v) {
 extern void *Open_Library(const REBVAL *path);
 extern void Close_Library(void *dll);
 extern CFUNC *Find_Function(void *dll, const char *funcname);
+extern CFUNC *Find_Library_Function(REBLIB *lib, const char *name);
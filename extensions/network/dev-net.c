@@ -25,11 +25,33 @@
 //=////////////////////////////////////////////////////////////////////////=//
 //
 
+#if !defined(__cplusplus) && (defined(TO_LINUX) || defined(TO_ANDROID))
+    // See feature_test_macros(7)
+    // This definition is redundant under C++
+    #define _GNU_SOURCE  // Needed for accept4() on Linux
+#endif
+
 #include <stdlib.h>
 #include <string.h>
 
 #include "sys-net.h"
 
+#if defined(TO_LINUX) || defined(TO_ANDROID)
+    #include <sys/sendfile.h>
+    #include <signal.h>
+    #define HAS_SENDFILE_LINUX
+#elif defined(TO_OSX) || defined(TO_FREEBSD)
+    #include <sys/types.h>
+    #include <sys/uio.h>
+    #define HAS_SENDFILE_BSD  // (argument orders differ, see below)
+#endif
+
+#if defined(TO_LINUX) || defined(TO_ANDROID) || defined(TO_FREEBSD)
+    #define HAS_ACCEPT4  // accepted socket can start out non-blocking
+#endif
+
+#define ACCEPT_BATCH_MAX 64  // connections taken per poll of a listen socket
+
 #ifdef IS_ERROR
     #undef IS_ERROR  // winerror.h defines, so undef it to avoid the warning
 #endif
@@ -90,19 +112,69 @@ static void Get_Local_IP(REBREQ *sock)
     ReqNet(sock)->local_port = ntohs(sa.sin_port);
 }
 
-static bool Try_Set_Sock_Options(SOCKET sock)
+static bool Try_Set_Int_Option(SOCKET sock, int level, int name, int value)
 {
+    return 0 == setsockopt(
+        sock, level, name, cast(char*, &value), sizeof(value)
+    );
+}
+
+// The options that come from the port spec are in `net` (which is the
+// listener's for an accepted connection, so they are inherited).  Pass
+// false for `nonblock` if the socket was made non-blocking already.
+//
+static bool Try_Set_Sock_Options(
+    SOCKET sock,
+    struct devreq_net *net,
+    bool nonblock
+){
   #if defined(SO_NOSIGPIPE)
     //
     // Prevent sendmsg/write raising SIGPIPE if the TCP socket is closed:
     // https://stackoverflow.com/q/108183/
     //
-    int on = 1;
-    if (setsockopt(sock, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on)) < 0) {
+    if (not Try_Set_Int_Option(sock, SOL_SOCKET, SO_NOSIGPIPE, 1))
         return false;
-    }
   #endif
 
+    // Buffer sizes are set before connect() or listen(), so that the TCP
+    // window scale negotiated at the handshake can take advantage of them.
+    //
+    if (net->recv_buffer != 0) {
+        if (not Try_Set_Int_Option(
+            sock, SOL_SOCKET, SO_RCVBUF, net->recv_buffer
+        )){
+            return false;
+        }
+    }
+    if (net->send_buffer != 0) {
+        if (not Try_Set_Int_Option(
+            sock, SOL_SOCKET, SO_SNDBUF, net->send_buffer
+        )){
+            return false;
+        }
+    }
+    if (net->options & RSO_KEEPALIVE) {
+        if (not Try_Set_Int_Option(sock, SOL_SOCKET, SO_KEEPALIVE, 1))
+            return false;
+    }
+
+    if (not (net->devreq.modes & RST_UDP)) {
+        if (net->options & RSO_NODELAY) {
+            if (not Try_Set_Int_Option(sock, IPPROTO_TCP, TCP_NODELAY, 1))
+                return false;
+        }
+      #if defined(TCP_QUICKACK)
+        if (net->options & RSO_QUICKACK) {
+            if (not Try_Set_Int_Option(sock, IPPROTO_TCP, TCP_QUICKACK, 1))
+                return false;
+        }
+      #endif
+    }
+
+    if (not nonblock)
+        return true;
+
     // Set non-blocking mode. Return TRUE if no error.
   #ifdef FIONBIO
     unsigned long mode = 1;
@@ -116,6 +188,111 @@ static bool Try_Set_Sock_Options(SOCKET sock)
 }
 
 
+#define SEND_FILE_BUF_SIZE (64 * 1024)  // if no sendfile(), read this much
+
+//
+//  Send_File_Chunk: C
+//
+// Send up to `len` bytes of a SEND-FILE from where it left off, returning how
+// many were sent (or -1, with the socket error in GET_ERROR).  Where the OS
+// has sendfile() the bytes go from the page cache to the socket without
+// coming through userspace; elsewhere they are read into a scratch buffer.
+//
+// !!! Windows could use TransmitFile(), but on a non-overlapped socket it
+// blocks until the whole range is sent, so it needs IOCP to be useful here.
+//
+static int Send_File_Chunk(REBREQ *sock, size_t len)
+{
+    SOCKET s = Req(sock)->requestee.socket;
+    int fd = ReqNet(sock)->file;
+    int64_t pos = ReqNet(sock)->file_pos;
+
+  #if defined(HAS_SENDFILE_LINUX)
+    //
+    // sendfile() has no MSG_NOSIGNAL, so hold off a SIGPIPE it would raise
+    // and take the pending signal before unblocking.  EPIPE is still given.
+    //
+    sigset_t pipe_mask;
+    sigset_t old_mask;
+    sigemptyset(&pipe_mask);
+    sigaddset(&pipe_mask, SIGPIPE);
+    sigprocmask(SIG_BLOCK, &pipe_mask, &old_mask);
+
+    off_t offset = pos;
+    ssize_t sent = sendfile(s, fd, &offset, len);
+
+    if (sent < 0 and errno == EPIPE) {
+        struct timespec no_wait = {0, 0};
+        sigtimedwait(&pipe_mask, nullptr, &no_wait);
+        errno = EPIPE;
+    }
+    int saved_errno = errno;
+    sigprocmask(SIG_SETMASK, &old_mask, nullptr);
+    errno = saved_errno;
+  #elif defined(HAS_SENDFILE_BSD)
+    //
+    // On EAGAIN these still report what was sent before the socket filled.
+    //
+    off_t sent_bytes = 0;
+   #if defined(TO_OSX)
+    sent_bytes = len;  // in: how much to send, out: how much was sent
+    int result = sendfile(fd, s, pos, &sent_bytes, nullptr, 0);
+   #else
+    int result = sendfile(fd, s, pos, len, nullptr, &sent_bytes, 0);
+   #endif
+    ssize_t sent = (result < 0 and sent_bytes == 0) ? -1 : sent_bytes;
+  #else
+    static char buffer[SEND_FILE_BUF_SIZE];
+    if (len > SEND_FILE_BUF_SIZE)
+        len = SEND_FILE_BUF_SIZE;
+
+   #if defined(TO_WINDOWS)
+    int got = -1;
+    if (_lseeki64(fd, pos, SEEK_SET) == pos)
+        got = _read(fd, buffer, len);
+    if (got <= 0) {
+        WSASetLastError(ERROR_READ_FAULT);
+        return -1;
+    }
+   #else
+    ssize_t got = pread(fd, buffer, len, pos);
+    if (got < 0)
+        return -1;
+   #endif
+
+    int sent = send(s, buffer, got, MSG_NOSIGNAL);
+  #endif
+
+    if (sent == 0) {  // file got shorter than it was at SEND-FILE time
+      #if defined(TO_WINDOWS)
+        WSASetLastError(ERROR_HANDLE_EOF);
+      #else
+        errno = EIO;
+      #endif
+        return -1;
+    }
+
+    if (sent > 0)
+        ReqNet(sock)->file_pos += sent;
+    return sent;
+}
+
+
+//
+//  Close_Send_File: C
+//
+// Stop a SEND-FILE (if one is running) and close its file.
+//
+void Close_Send_File(REBREQ *sock)
+{
+    if (not (Req(sock)->state & RSM_SENDFILE))
+        return;
+
+    CLOSE_FILE(ReqNet(sock)->file);
+    Req(sock)->state &= ~RSM_SENDFILE;
+}
+
+
 //
 //  Init_Net: C
 //
@@ -205,7 +382,7 @@ DEVICE_CMD Open_Socket(REBREQ *req)
     sock->state |= RSM_OPEN;
 
     // Set socket to non-blocking async mode:
-    if (not Try_Set_Sock_Options(sock->requestee.socket))
+    if (not Try_Set_Sock_Options(sock->requestee.socket, ReqNet(req), true))
         rebFail_OS (GET_ERROR);
 
     if (ReqNet(req)->local_port != 0) {
@@ -244,13 +421,16 @@ DEVICE_CMD Close_Socket(REBREQ *sock)
     struct rebol_devreq *req = Req(sock);
 
     if (req->state & RSM_OPEN) {
+        Close_Send_File(sock);
 
         req->state = 0;  // clear: RSM_OPEN, RSM_CONNECT
 
+        OS_Unwatch_Request(sock);  // before the fd number can be reused
+
         // If DNS pending, abort it:
         if (ReqNet(sock)->host_info) {  // indicates DNS phase active
-            rebFree(ReqNet(sock)->host_info);
-            req->requestee.socket = req->length; // Restore TCP socket (see Lookup)
+            Dns_Abandon(cast(struct Reb_Dns_Job*, ReqNet(sock)->host_info));
+            ReqNet(sock)->host_info = nullptr;
         }
 
         if (CLOSE_SOCKET(req->requestee.socket) != 0)
@@ -264,27 +444,64 @@ DEVICE_CMD Close_Socket(REBREQ *sock)
 //
 //  Lookup_Socket: C
 //
-// Initiate the GetHost request and return immediately.
-// This is very similar to the DNS device.
-// Note the temporary results buffer (must be freed later).
-// Note we use the sock->requestee.handle for the DNS handle. During use,
-// we store the TCP socket in the length field.
+// Resolve the host name in req->common.data to ReqNet(sock)->remote_ip.  On
+// a cache miss the name goes to a resolver thread (see %dns-resolve.c) and
+// the request is pending, with the job in `host_info`, until it's done.
+// Either way a `lookup` event is sent when the address is known.
 //
 DEVICE_CMD Lookup_Socket(REBREQ *sock)
 {
     struct rebol_devreq *req = Req(sock);
+    struct devreq_net *net = ReqNet(sock);
 
-    ReqNet(sock)->host_info = NULL; // no allocated data
+    int status;
+    uint32_t ip;
 
-    // !!! R3-Alpha would use asynchronous DNS API on Windows, but that API
-    // was not supported by IPv6, and developers are encouraged to use normal
-    // socket APIs with their own threads.
+    bool polled = (net->host_info != nullptr);  // job started by prior call
+    if (not polled) {
+        const char *name = s_cast(req->common.data);
+        if (Dns_Cache_Find(name, &status, &ip))
+            goto resolved;
 
-    HOSTENT *host = gethostbyname(s_cast(req->common.data));
-    if (host == NULL)
-        rebFail_OS (GET_ERROR);
+        net->host_info = Dns_Start(name);
+    }
+
+  blockscope {
+    struct Reb_Dns_Job *job = cast(struct Reb_Dns_Job*, net->host_info);
+    if (not Dns_Done(job)) {
+        OS_Watch_Request(sock, Dns_Fd(job), RRF_WANT_READ);
+        return DR_PEND;
+    }
+
+    OS_Unwatch_Request(sock);  // before Dns_Finish() closes the pipe
+    status = Dns_Finish(job, &ip);
+    net->host_info = nullptr;
+  }
+
+  resolved:
 
-    memcpy(&ReqNet(sock)->remote_ip, *host->h_addr_list, 4); //he->h_length);
+    if (status != 0) {
+        REBVAL *error = Dns_Make_Error(s_cast(req->common.data), status);
+        if (not polled)
+            rebJumps("fail", rebR(error));
+
+        // Same as in Transfer_Socket(), the lookup finished in the event
+        // loop, so don't raise the error outside of whatever TRAP the OPEN
+        // was in.  Poke it into the port and send an `error` event.
+        //
+        REBVAL *port = CTX_ARCHETYPE(MISC(ReqPortCtx, sock));
+        rebElide(
+            "(", port, ")/error:", rebR(error),
+
+            "insert system/ports/system make event! [",
+                "type: 'error",
+                "port:", port,
+            "]"
+        );
+        return DR_DONE;
+    }
+
+    net->remote_ip = ip;
     req->flags &= ~RRF_DONE;
 
     rebElide(
@@ -367,8 +584,9 @@ DEVICE_CMD Connect_Socket(REBREQ *sock)
       case NE_WOULDBLOCK:
       case NE_INPROGRESS:
       case NE_ALREADY:
-        // Still trying:
+        // Still trying (the socket becomes writable when it connects):
         req->state |= RSM_ATTEMPT;
+        OS_Watch_Request(sock, req->requestee.socket, RRF_WANT_WRITE);
         return DR_PEND;
 
       default:
@@ -447,21 +665,27 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
     if (mode == RSM_SEND) {
         size_t len = req->length - req->actual;  // how much to try to write
 
-        REBBIN *bin = VAL_BINARY_KNOWN_MUTABLE(req->common.binary);
+        if (req->state & RSM_SENDFILE) {
+            result = Send_File_Chunk(sock, len);
+            WATCH2("sendfile() len: %d actual: %d\n", cast(int, len), result);
+        }
+        else {
+            REBBIN *bin = VAL_BINARY_KNOWN_MUTABLE(req->common.binary);
 
-        // If host is no longer connected:
-        Set_Addr(
-            &remote_addr,
-            ReqNet(sock)->remote_ip,
-            ReqNet(sock)->remote_port
-        );
-        result = sendto(
-            req->requestee.socket,
-            s_cast(BIN_AT(bin, req->actual)), len,
-            MSG_NOSIGNAL, // Flags
-            cast(struct sockaddr*, &remote_addr), addr_len
-        );
-        WATCH2("send() len: %d actual: %d\n", cast(int, len), result);
+            // If host is no longer connected:
+            Set_Addr(
+                &remote_addr,
+                ReqNet(sock)->remote_ip,
+                ReqNet(sock)->remote_port
+            );
+            result = sendto(
+                req->requestee.socket,
+                s_cast(BIN_AT(bin, req->actual)), len,
+                MSG_NOSIGNAL, // Flags
+                cast(struct sockaddr*, &remote_addr), addr_len
+            );
+            WATCH2("send() len: %d actual: %d\n", cast(int, len), result);
+        }
 
         if (result < 0)
             goto error_unless_wouldblock;  // may release and trash binary
@@ -470,7 +694,10 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
 
         assert(req->actual <= req->length);
         if (req->actual == req->length) {
-            rebRelease(req->common.binary);
+            if (req->state & RSM_SENDFILE)
+                Close_Send_File(sock);
+            else
+                rebRelease(req->common.binary);
             TRASH_POINTER_IF_DEBUG(req->common.binary);
 
             rebElide(
@@ -484,6 +711,7 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
         }
 
         req->flags |= RRF_ACTIVE; // notify OS_WAIT of activity
+        OS_Watch_Request(sock, req->requestee.socket, RRF_WANT_WRITE);
         return DR_PEND;  // still more to go
     }
     else {
@@ -517,6 +745,21 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
         TERM_BIN_LEN(bin, old_len + result);
         req->actual += result;
 
+      #if defined(TCP_QUICKACK)
+        //
+        // Linux drops back to delayed ACKs on its own after a while, so the
+        // option has to be renewed after reads for it to keep working.
+        //
+        if (
+            (ReqNet(sock)->options & RSO_QUICKACK)
+            and not (req->modes & RST_UDP)
+        ){
+            Try_Set_Int_Option(
+                req->requestee.socket, IPPROTO_TCP, TCP_QUICKACK, 1
+            );
+        }
+      #endif
+
         if (req->modes & RST_UDP) {
             ReqNet(sock)->remote_ip = remote_addr.sin_addr.s_addr;
             ReqNet(sock)->remote_port = ntohs(remote_addr.sin_port);
@@ -574,6 +817,7 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
         if (finished)
             return DR_DONE;  // This request got everything it needed
 
+        OS_Watch_Request(sock, req->requestee.socket, RRF_WANT_READ);
         return DR_PEND;  // Not done (and we didn't send a READ EVENT! yet)
     }
 
@@ -581,8 +825,14 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
 
     result = GET_ERROR;
 
-    if (result == NE_WOULDBLOCK)
-        return DR_PEND;  // don't consider blocking to be an actual "error"
+    if (result == NE_WOULDBLOCK) {  // don't consider blocking an "error"
+        OS_Watch_Request(
+            sock,
+            req->requestee.socket,
+            mode == RSM_SEND ? RRF_WANT_WRITE : RRF_WANT_READ
+        );
+        return DR_PEND;
+    }
 
     REBVAL *error = rebError_OS(result);
 
@@ -604,7 +854,10 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
     // can be overridden.
 
     if (mode == RSM_SEND) {
-        rebRelease(req->common.binary);
+        if (req->state & RSM_SENDFILE)
+            Close_Send_File(sock);
+        else
+            rebRelease(req->common.binary);
         TRASH_POINTER_IF_DEBUG(req->common.binary);
     }
 
@@ -647,6 +900,22 @@ DEVICE_CMD Listen_Socket(REBREQ *sock)
     if (result != 0)
         rebFail_OS (GET_ERROR);
 
+    // Let other processes bind the same port, with the kernel spreading the
+    // incoming connections (or datagrams) among them.
+    //
+    // !!! Windows doesn't have it.  Its SO_REUSEADDR lets another socket
+    // steal the port instead, and is not a substitute...so it's ignored.
+    //
+  #if defined(SO_REUSEPORT)
+    if (ReqNet(sock)->options & RSO_REUSEPORT) {
+        if (not Try_Set_Int_Option(
+            req->requestee.socket, SOL_SOCKET, SO_REUSEPORT, 1
+        )){
+            rebFail_OS (GET_ERROR);
+        }
+    }
+  #endif
+
     // Bind the socket to our local address:
     result = bind(
         req->requestee.socket, cast(struct sockaddr *, &sa), sizeof(sa)
@@ -662,6 +931,10 @@ DEVICE_CMD Listen_Socket(REBREQ *sock)
         if (result != 0)
             rebFail_OS (GET_ERROR);
         req->state |= RSM_LISTEN;
+
+        // A listen socket is "readable" when a connection can be accepted.
+        //
+        OS_Watch_Request(sock, req->requestee.socket, RRF_WANT_READ);
     }
 
     Get_Local_IP(sock);
@@ -671,60 +944,13 @@ DEVICE_CMD Listen_Socket(REBREQ *sock)
 }
 
 
+// Make a PORT! for a connection accepted on the listening `sock`, add it to
+// the listener's connections, and signal an `accept` event.
 //
-//  Accept_Socket: C
-//
-// Accept an inbound connection on a TCP listen socket.
-//
-// The function will return:
-//     =0: succeeded
-//     >0: in-progress, still trying
-//     <0: error occurred, no longer trying
-//
-// Before usage:
-//     Open_Socket();
-//     Set local_port to desired port number.
-//     Listen_Socket();
-//
-DEVICE_CMD Accept_Socket(REBREQ *sock)
+static void Add_Connection(REBREQ *sock, int fd, struct sockaddr_in *sa)
 {
     struct rebol_devreq *req = Req(sock);
 
-    // !!! In order to make packets appear to originate from a specific UDP
-    // point, a "two-ended" connection-like socket is created for UDP.  But
-    // it cannot accept connections.  Without better knowledge of how to stay
-    // pending for UDP purposes but not TCP purposes, just return for now.
-    //
-    // This happens because of RDC_CREATE being posted in Listen_Socket; so
-    // it's not clear whether to not send that event or squash it here.  It
-    // must be accepted, however, to recvfrom() data in the future.
-    //
-    if (req->modes & RST_UDP) {
-        rebElide("insert system/ports/system make event! [",
-            "type: 'accept",
-            "port:", CTX_ARCHETYPE(MISC(ReqPortCtx, sock)),
-        "]");
-
-        return DR_PEND;
-    }
-
-    // Accept a new socket, if there is one:
-
-    struct sockaddr_in sa;
-    socklen_t len = sizeof(sa);
-    int fd = accept(req->requestee.socket, cast(struct sockaddr *, &sa), &len);
-
-    if (fd == -1) {
-        int errnum = GET_ERROR;
-        if (errnum == NE_WOULDBLOCK)
-            return DR_PEND;
-
-        rebFail_OS (errnum);
-    }
-
-    if (not Try_Set_Sock_Options(fd))
-        rebFail_OS (GET_ERROR);
-
     // Create a new port using ACCEPT
 
     REBCTX *listener = MISC(ReqPortCtx, sock);
@@ -748,8 +974,12 @@ DEVICE_CMD Accept_Socket(REBREQ *sock)
     // NOTE: REBOL stays in network byte order, no htonl(ip) needed
     //
     req_new->requestee.socket = fd;
-    ReqNet(sock_new)->remote_ip = sa.sin_addr.s_addr;
-    ReqNet(sock_new)->remote_port = ntohs(sa.sin_port);
+    ReqNet(sock_new)->read_size = ReqNet(sock)->read_size;
+    ReqNet(sock_new)->recv_buffer = ReqNet(sock)->recv_buffer;
+    ReqNet(sock_new)->send_buffer = ReqNet(sock)->send_buffer;
+    ReqNet(sock_new)->options = ReqNet(sock)->options;
+    ReqNet(sock_new)->remote_ip = sa->sin_addr.s_addr;
+    ReqNet(sock_new)->remote_port = ntohs(sa->sin_port);
     Get_Local_IP(sock_new);
 
     mutable_MISC(ReqPortCtx, sock_new) = connection;
@@ -770,10 +1000,91 @@ DEVICE_CMD Accept_Socket(REBREQ *sock)
             "port:", CTX_ARCHETYPE(listener),
         "]"
     );
+}
+
+
+//
+//  Accept_Socket: C
+//
+// Accept inbound connections on a TCP listen socket.  Under a burst of
+// connections, taking one per poll would fall behind--so this takes all of
+// the ones that are waiting (up to ACCEPT_BATCH_MAX, to be fair to the
+// other ports), with an `accept` event for each.
+//
+// The function will return:
+//     =0: succeeded
+//     >0: in-progress, still trying
+//     <0: error occurred, no longer trying
+//
+// Before usage:
+//     Open_Socket();
+//     Set local_port to desired port number.
+//     Listen_Socket();
+//
+DEVICE_CMD Accept_Socket(REBREQ *sock)
+{
+    struct rebol_devreq *req = Req(sock);
+
+    // !!! In order to make packets appear to originate from a specific UDP
+    // point, a "two-ended" connection-like socket is created for UDP.  But
+    // it cannot accept connections.  Without better knowledge of how to stay
+    // pending for UDP purposes but not TCP purposes, just return for now.
+    //
+    // This happens because of RDC_CREATE being posted in Listen_Socket; so
+    // it's not clear whether to not send that event or squash it here.  It
+    // must be accepted, however, to recvfrom() data in the future.
+    //
+    if (req->modes & RST_UDP) {
+        rebElide("insert system/ports/system make event! [",
+            "type: 'accept",
+            "port:", CTX_ARCHETYPE(MISC(ReqPortCtx, sock)),
+        "]");
+
+        return DR_PEND;
+    }
+
+    int n;
+    for (n = 0; n < ACCEPT_BATCH_MAX; ++n) {
+        struct sockaddr_in sa;
+        socklen_t len = sizeof(sa);
+
+      #if defined(HAS_ACCEPT4)
+        int fd = accept4(
+            req->requestee.socket, cast(struct sockaddr *, &sa), &len,
+            SOCK_NONBLOCK | SOCK_CLOEXEC
+        );
+        bool nonblock = false;  // already is
+      #else
+        int fd = accept(
+            req->requestee.socket, cast(struct sockaddr *, &sa), &len
+        );
+        bool nonblock = true;
+      #endif
+
+        if (fd == -1) {
+            int errnum = GET_ERROR;
+            if (errnum == NE_WOULDBLOCK)
+                break;  // queue is drained
+
+            if (n != 0)
+                break;  // deliver what was accepted, error on next poll
+
+            rebFail_OS (errnum);
+        }
+
+        if (not Try_Set_Sock_Options(fd, ReqNet(sock), nonblock)) {
+            int errnum = GET_ERROR;
+            CLOSE_SOCKET(fd);
+            rebFail_OS (errnum);
+        }
+
+        Add_Connection(sock, fd, &sa);  // (inherits listener's options)
+    }
 
     // Even though we signalled, we keep the listen pending to
     // accept additional connections.
     //
+    OS_Watch_Request(sock, req->requestee.socket, RRF_WANT_READ);
     return DR_PEND;
 }
 
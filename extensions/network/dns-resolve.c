@@ -0,0 +1,436 @@
+//
+//  File: %dns-resolve.c
+//  Summary: "Host name resolution off the event loop, with a cache"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// getaddrinfo() can take seconds when a name server is slow, and R3-Alpha
+// called gethostbyname() right in the device command...so every other port
+// in the WAIT stalled along with it.  Here a name is handed to a small pool
+// of resolver threads as a "job", and the job has a pipe that becomes
+// readable when it's done.  The network device watches that pipe with
+// OS_Watch_Request() like it would a socket, so the WAIT wakes up for it.
+//
+// Answers are kept in a small cache, so opening many connections to the same
+// host only resolves it once.  Only the main thread touches the cache.
+//
+// Threading is enabled by USE_ASYNC_DNS in %systems.r, for platforms that
+// link with pthreads.  Without it a job is resolved synchronously when it is
+// started (so it is already done), and only the cache helps.
+//
+// !!! getaddrinfo() does not report the TTL of the records it found.  A DNS
+// client of our own could honor it, but would also have to replicate the
+// system's configuration (/etc/hosts, search domains, nsswitch...).  So the
+// cache keeps answers for DNS_CACHE_SECONDS, which is short enough to be
+// under the TTL of almost any record that is in real use.
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sys-net.h"
+
+#if defined(USE_ASYNC_DNS)
+    #define ASYNC_DNS
+    #include <pthread.h>
+#endif
+
+#if defined(TO_WINDOWS)
+    #include <windows.h>  // GetTickCount64()
+#else
+    #include <time.h>  // clock_gettime()
+#endif
+
+#ifdef IS_ERROR
+    #undef IS_ERROR  // winerror.h defines, so undef it to avoid the warning
+#endif
+#include "sys-core.h"
+
+#include "reb-net.h"
+
+#define DNS_THREADS_MAX 8
+#define DNS_CACHE_SIZE 64
+#define DNS_CACHE_SECONDS 60  // how long an address is trusted
+#define DNS_NEGATIVE_SECONDS 5  // how long "no such host" is trusted
+
+struct Reb_Dns_Job {
+    struct Reb_Dns_Job *next;  // in Dns_Queue, while waiting for a thread
+    char *name;
+    int status;  // 0 or EAI_XXX from getaddrinfo()
+    uint32_t ip;  // network byte order, like remote_ip
+
+  #if defined(ASYNC_DNS)
+    int pipe[2];  // a byte is written to pipe[1] when done
+    bool started;  // a thread took it off the queue
+    bool done;
+    bool abandoned;  // thread frees it when done (Dns_Abandon() called)
+  #endif
+};
+
+struct Reb_Dns_Cache_Entry {
+    char name[MAX_HOST_NAME];  // empty if slot unused
+    int status;
+    uint32_t ip;
+    int64_t expires;  // in Dns_Now() seconds
+};
+
+static struct Reb_Dns_Cache_Entry Dns_Cache[DNS_CACHE_SIZE];
+
+
+static int64_t Dns_Now(void)
+{
+  #if defined(TO_WINDOWS)
+    return GetTickCount64() / 1000;
+  #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec;
+  #endif
+}
+
+
+static bool Same_Host_Name(const char *a, const char *b)
+{
+    for (; *a != '\0'; ++a, ++b) {
+        char ca = (*a >= 'A' and *a <= 'Z') ? *a - 'A' + 'a' : *a;
+        char cb = (*b >= 'A' and *b <= 'Z') ? *b - 'A' + 'a' : *b;
+        if (ca != cb)
+            return false;
+    }
+    return *b == '\0';
+}
+
+
+//
+//  Dns_Not_Found: C
+//
+// Is the status from Dns_Finish() an "expected" failure, where the name
+// server answered and said there is no such host (or it has no address)?
+//
+bool Dns_Not_Found(int status)
+{
+  #if defined(EAI_NODATA) && EAI_NODATA != EAI_NONAME
+    if (status == EAI_NODATA)  // (deprecated, but glibc still gives it)
+        return true;
+  #endif
+    return status == EAI_NONAME;
+}
+
+
+// Runs on a resolver thread (or inline, without ASYNC_DNS).  Nothing here
+// may use the Rebol API, which is not thread-safe.
+//
+static void Resolve_Dns_Job(struct Reb_Dns_Job *job)
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;  // remote_ip is IPv4 only, for now
+    hints.ai_socktype = SOCK_STREAM;  // else one answer per socket type
+
+    struct addrinfo *info;
+    job->status = getaddrinfo(job->name, nullptr, &hints, &info);
+    if (job->status != 0)
+        return;
+
+    struct sockaddr_in *sa = cast(struct sockaddr_in*, info->ai_addr);
+    job->ip = sa->sin_addr.s_addr;
+    freeaddrinfo(info);
+}
+
+
+static void Free_Dns_Job(struct Reb_Dns_Job *job)
+{
+  #if defined(ASYNC_DNS)
+    close(job->pipe[0]);
+    close(job->pipe[1]);
+  #endif
+    free(job->name);  // malloc(), not rebMalloc(), as threads free jobs too
+    free(job);
+}
+
+
+#if defined(ASYNC_DNS)
+
+static pthread_mutex_t Dns_Mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Dns_Cond = PTHREAD_COND_INITIALIZER;
+
+static struct Reb_Dns_Job *Dns_Queue;  // oldest first
+static int Dns_Threads;  // threads started (they never exit)
+static int Dns_Idle;  // threads waiting on Dns_Cond
+
+static void *Dns_Thread(void *unused)
+{
+    UNUSED(unused);
+
+    pthread_mutex_lock(&Dns_Mutex);
+    while (true) {
+        while (Dns_Queue == nullptr) {
+            ++Dns_Idle;
+            pthread_cond_wait(&Dns_Cond, &Dns_Mutex);
+            --Dns_Idle;
+        }
+
+        struct Reb_Dns_Job *job = Dns_Queue;
+        Dns_Queue = job->next;
+        job->started = true;
+        pthread_mutex_unlock(&Dns_Mutex);
+
+        Resolve_Dns_Job(job);
+
+        pthread_mutex_lock(&Dns_Mutex);
+        job->done = true;
+        if (job->abandoned)
+            Free_Dns_Job(job);
+        else {
+            char byte = 0;
+            ssize_t wrote = write(job->pipe[1], &byte, 1);
+            UNUSED(wrote);  // pipe is fresh, so there's room for one byte
+        }
+    }
+
+    DEAD_END;
+}
+
+#endif
+
+
+//
+//  Dns_Cache_Find: C
+//
+// Look for an unexpired answer for `name`.  Returns false on a miss, else
+// true with the getaddrinfo() status (0 or EAI_XXX) in `status` and the
+// address in `ip`.  Only "no such host" answers are kept for a failure, so
+// a server error is retried the next time.
+//
+bool Dns_Cache_Find(const char *name, int *status, uint32_t *ip)
+{
+    int64_t now = Dns_Now();
+
+    int i;
+    for (i = 0; i < DNS_CACHE_SIZE; ++i) {
+        struct Reb_Dns_Cache_Entry *e = &Dns_Cache[i];
+        if (e->name[0] == '\0' or e->expires <= now)
+            continue;
+        if (not Same_Host_Name(e->name, name))
+            continue;
+        *status = e->status;
+        *ip = e->ip;
+        return true;
+    }
+    return false;
+}
+
+
+static void Dns_Cache_Store(const char *name, int status, uint32_t ip)
+{
+    if (status != 0 and not Dns_Not_Found(status))
+        return;  // e.g. EAI_AGAIN, worth asking again
+
+    if (strlen(name) >= MAX_HOST_NAME)
+        return;  // not a legal host name anyway
+
+    // Replace the entry closest to expiring (unused slots are 0, and an
+    // earlier answer for the same name is expired or it would have hit).
+    //
+    struct Reb_Dns_Cache_Entry *e = &Dns_Cache[0];
+    int i;
+    for (i = 1; i < DNS_CACHE_SIZE; ++i) {
+        if (Dns_Cache[i].expires < e->expires)
+            e = &Dns_Cache[i];
+    }
+
+    strcpy(e->name, name);
+    e->status = status;
+    e->ip = ip;
+    e->expires = Dns_Now() + (
+        status == 0 ? DNS_CACHE_SECONDS : DNS_NEGATIVE_SECONDS
+    );
+}
+
+
+//
+//  Dns_Start: C
+//
+// Begin resolving `name` (which is copied).  The job must be given to
+// Dns_Finish() once Dns_Done() says it is done, or to Dns_Abandon().
+//
+struct Reb_Dns_Job *Dns_Start(const char *name)
+{
+    size_t len = strlen(name);
+    struct Reb_Dns_Job *job = cast(
+        struct Reb_Dns_Job*, malloc(sizeof(struct Reb_Dns_Job))
+    );
+    if (job == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Dns_Job)));
+    job->name = cast(char*, malloc(len + 1));
+    if (job->name == nullptr) {
+        free(job);
+        fail (Error_No_Memory(len + 1));
+    }
+    memcpy(job->name, name, len + 1);
+    job->next = nullptr;
+    job->status = 0;
+    job->ip = 0;
+
+  #if defined(ASYNC_DNS)
+    job->started = false;
+    job->done = false;
+    job->abandoned = false;
+
+    if (pipe(job->pipe) != 0) {  // out of descriptors, so do it here
+        job->pipe[0] = job->pipe[1] = -1;  // close(-1) is harmless
+        Resolve_Dns_Job(job);
+        job->done = true;
+        return job;
+    }
+
+    pthread_mutex_lock(&Dns_Mutex);
+
+    struct Reb_Dns_Job **tail = &Dns_Queue;
+    while (*tail != nullptr)
+        tail = &(*tail)->next;
+    *tail = job;
+
+    bool need_thread = (Dns_Idle == 0 and Dns_Threads < DNS_THREADS_MAX);
+    if (need_thread) {
+        pthread_t thread;
+        if (pthread_create(&thread, nullptr, &Dns_Thread, nullptr) == 0) {
+            pthread_detach(thread);
+            ++Dns_Threads;
+        }
+        else if (Dns_Threads == 0) {  // no thread will ever take it
+            Dns_Queue = nullptr;
+            pthread_mutex_unlock(&Dns_Mutex);
+            Resolve_Dns_Job(job);
+            job->done = true;
+            return job;
+        }
+    }
+    else
+        pthread_cond_signal(&Dns_Cond);
+
+    pthread_mutex_unlock(&Dns_Mutex);
+  #else
+    Resolve_Dns_Job(job);
+  #endif
+
+    return job;
+}
+
+
+//
+//  Dns_Fd: C
+//
+// Descriptor that becomes readable when the job is done, or -1 if there is
+// none (it won't be, if it's done already or there are no threads).
+//
+int Dns_Fd(struct Reb_Dns_Job *job)
+{
+  #if defined(ASYNC_DNS)
+    return job->pipe[0];
+  #else
+    UNUSED(job);
+    return -1;
+  #endif
+}
+
+
+//
+//  Dns_Done: C
+//
+bool Dns_Done(struct Reb_Dns_Job *job)
+{
+  #if defined(ASYNC_DNS)
+    pthread_mutex_lock(&Dns_Mutex);
+    bool done = job->done;
+    pthread_mutex_unlock(&Dns_Mutex);
+    return done;
+  #else
+    UNUSED(job);
+    return true;
+  #endif
+}
+
+
+//
+//  Dns_Finish: C
+//
+// Free a job that is done, caching its answer.  Returns the getaddrinfo()
+// status (0 or EAI_XXX), and on success sets `ip`.
+//
+int Dns_Finish(struct Reb_Dns_Job *job, uint32_t *ip)
+{
+    assert(Dns_Done(job));
+
+    int status = job->status;
+    *ip = job->ip;
+    Dns_Cache_Store(job->name, status, job->ip);
+    Free_Dns_Job(job);
+    return status;
+}
+
+
+//
+//  Dns_Abandon: C
+//
+// The requester went away (e.g. the port was closed).  A job still in the
+// queue is dropped; one being resolved is freed by its thread when done.
+//
+void Dns_Abandon(struct Reb_Dns_Job *job)
+{
+  #if defined(ASYNC_DNS)
+    pthread_mutex_lock(&Dns_Mutex);
+
+    if (job->done) {
+        pthread_mutex_unlock(&Dns_Mutex);
+        Free_Dns_Job(job);
+        return;
+    }
+
+    if (job->started) {
+        job->abandoned = true;
+        pthread_mutex_unlock(&Dns_Mutex);
+        return;
+    }
+
+    struct Reb_Dns_Job **prior = &Dns_Queue;
+    while (*prior != job)
+        prior = &(*prior)->next;
+    *prior = job->next;
+
+    pthread_mutex_unlock(&Dns_Mutex);
+  #endif
+
+    Free_Dns_Job(job);
+}
+
+
+//
+//  Dns_Make_Error: C
+//
+// !!! gai_strerror() messages are at least readable, unlike the numbers.
+//
+REBVAL *Dns_Make_Error(const char *name, int status)
+{
+    return rebValue(
+        "make error! spaced [",
+            "{Could not resolve}", rebT(name),
+            "{-}", rebT(gai_strerror(status)),
+        "]"
+    );
+}
@@ -8,4 +8,5 @@ includes: [
 
 depends: [
     %network/dev-net.c
+    %network/dns-resolve.c
 ]
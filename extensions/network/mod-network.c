@@ -22,8 +22,27 @@
 //=////////////////////////////////////////////////////////////////////////=//
 //
 
+#if !defined(__cplusplus) && (defined(TO_LINUX) || defined(TO_ANDROID))
+    // See feature_test_macros(7)
+    // This definition is redundant under C++
+    #define _GNU_SOURCE  // Needed for recvmmsg() and sendmmsg() on Linux
+#endif
+
 #include "sys-net.h"
 
+#ifdef TO_WINDOWS
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #define FILE_ERROR _doserrno  // Win32 code, as rebFail_OS() expects
+#else
+    #include <sys/stat.h>
+    #define FILE_ERROR errno
+#endif
+
+#if defined(TO_LINUX) || defined(TO_ANDROID) || defined(TO_FREEBSD)
+    #define HAS_MMSG  // recvmmsg() and sendmmsg(), many datagrams per call
+#endif
+
 #undef IS_ERROR
 
 #include "sys-core.h"
@@ -34,6 +53,9 @@
 
 #define NET_BUF_SIZE 32*1024
 
+#define UDP_BATCH_MAX 64  // datagrams per recvmmsg()/sendmmsg() call
+#define UDP_DATAGRAM_SIZE 2048  // UDP-RECEIVE-BATCH default for /SIZE
+
 enum Transport_Types {
     TRANSPORT_TCP,
     TRANSPORT_UDP
@@ -75,6 +97,78 @@ static void Query_Net(REBVAL *out, REBVAL *port, struct devreq_net *sock)
 }
 
 
+//
+//  Spec_Size: C
+//
+// Get a byte count from a port spec field, or 0 if it is BLANK!.
+//
+static int32_t Spec_Size(REBVAL *spec, REBLEN n, const char *field)
+{
+    REBVAL *v = Obj_Value(spec, n);
+    if (IS_BLANK(v))
+        return 0;
+
+    if (not IS_INTEGER(v) or VAL_INT64(v) < 1 or VAL_INT64(v) > INT32_MAX)
+        rebJumps(
+            "fail [", rebT(field),
+                "{field of PORT! spec must be BLANK! or positive INTEGER!}",
+            "]"
+        );
+
+    return VAL_INT32(v);
+}
+
+
+//
+//  Spec_Flag: C
+//
+// Get a yes/no port spec field, where BLANK! means no.
+//
+static bool Spec_Flag(REBVAL *spec, REBLEN n, const char *field)
+{
+    REBVAL *v = Obj_Value(spec, n);
+    if (IS_BLANK(v))
+        return false;
+
+    if (not IS_LOGIC(v))
+        rebJumps(
+            "fail [", rebT(field),
+                "{field of PORT! spec must be BLANK! or LOGIC!}",
+            "]"
+        );
+
+    return VAL_LOGIC(v);
+}
+
+
+//
+//  Get_Net_Options: C
+//
+// Fill in the tuning fields of the request from the port spec, so that they
+// can be applied when the socket is opened (see Try_Set_Sock_Options()).
+//
+static void Get_Net_Options(struct devreq_net *net, REBVAL *spec)
+{
+    net->read_size = Spec_Size(spec, STD_PORT_SPEC_NET_READ_SIZE, "read-size");
+    net->recv_buffer = Spec_Size(
+        spec, STD_PORT_SPEC_NET_RECEIVE_BUFFER, "receive-buffer"
+    );
+    net->send_buffer = Spec_Size(
+        spec, STD_PORT_SPEC_NET_SEND_BUFFER, "send-buffer"
+    );
+
+    net->options = 0;
+    if (Spec_Flag(spec, STD_PORT_SPEC_NET_NO_DELAY, "no-delay"))
+        net->options |= RSO_NODELAY;
+    if (Spec_Flag(spec, STD_PORT_SPEC_NET_KEEP_ALIVE, "keep-alive"))
+        net->options |= RSO_KEEPALIVE;
+    if (Spec_Flag(spec, STD_PORT_SPEC_NET_QUICK_ACK, "quick-ack"))
+        net->options |= RSO_QUICKACK;
+    if (Spec_Flag(spec, STD_PORT_SPEC_NET_REUSE_PORT, "reuse-port"))
+        net->options |= RSO_REUSEPORT;
+}
+
+
 //
 //  Transport_Actor: C
 //
@@ -149,6 +243,8 @@ static REB_R Transport_Actor(
             else
                 fail ("local-id field of PORT! spec must be BLANK!/INTEGER!");
 
+            Get_Net_Options(ReqNet(sock), spec);
+
             OS_DO_DEVICE_SYNC(sock, RDC_OPEN);
 
             req->flags |= RRF_OPEN;
@@ -168,14 +264,17 @@ static REB_R Transport_Actor(
                 ReqNet(sock)->remote_port =
                     IS_INTEGER(port_id) ? VAL_INT32(port_id) : 80;
 
-                // Note: sets remote_ip field
+                // Note: sets remote_ip field.  A name that isn't cached is
+                // resolved on another thread, and the request is pending
+                // until then (either way, a `lookup` event is sent).
                 //
                 REBVAL *l_result = OS_DO_DEVICE(sock, RDC_LOOKUP);
 
-                assert(l_result != nullptr);
-                if (rebDid("error?", l_result))
-                    rebJumps("fail", l_result);
-                rebRelease(l_result); // ignore result
+                if (l_result != nullptr) {
+                    if (rebDid("error?", l_result))
+                        rebJumps("fail", l_result);
+                    rebRelease(l_result); // ignore result
+                }
 
                 RETURN (port);
             }
@@ -316,7 +415,9 @@ static REB_R Transport_Actor(
             // is specified.
             //
             req->length = UINT32_MAX;  // signal "read as much as you can"
-            bufsize = NET_BUF_SIZE;
+            bufsize = ReqNet(sock)->read_size;  // from port spec
+            if (bufsize == 0)
+                bufsize = NET_BUF_SIZE;
         }
 
         // Setup the read buffer (allocate a buffer if needed)
@@ -324,6 +425,7 @@ static REB_R Transport_Actor(
         REBBIN *buffer;
         if (IS_BLANK(port_data)) {
             buffer = Make_Binary(bufsize);
+            GC_Write_Barrier(CTX_VARLIST(ctx));
             Init_Binary(port_data, buffer);
         }
         else {
@@ -387,6 +489,8 @@ static REB_R Transport_Actor(
             fail (Error_On_Port(SYM_NOT_CONNECTED, port, -15));
         }
 
+        if (req->state & RSM_SENDFILE)  // would take over its request
+            rebJumps("fail {Can't WRITE while SEND-FILE is in progress}");
 
         // !!! R3-Alpha did not lay out the invariants of the port model,
         // or what datatypes it would accept at what levels.  TEXT! could be
@@ -663,3 +767,339 @@ REBNATIVE(set_udp_ttl)
 
     return rebVoid();
 }
+
+
+//
+//  export udp-receive-batch: native [
+//
+//  {Receive all the datagrams waiting on a UDP port, without blocking}
+//
+//      return: "One BINARY! per datagram, in arrival order (may be empty)"
+//          [block!]
+//      port [port!]
+//          {An open UDP port}
+//      /max "Most datagrams to receive (default 64)"
+//          [integer!]
+//      /size "Longest datagram expected, longer are truncated (default 2048)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(udp_receive_batch)
+//
+// Reading a UDP port with READ costs a WAIT round trip, an event, and a
+// recvfrom() for each datagram.  This drains the socket's queue in one call,
+// with recvmmsg() taking up to UDP_BATCH_MAX datagrams per syscall where the
+// OS has it.  As with READ, the port's remote address is updated to the
+// sender of the last datagram received.
+{
+    NETWORK_INCLUDE_PARAMS_OF_UDP_RECEIVE_BATCH;
+
+    REBREQ *sock = Force_Get_Port_State(ARG(port), &Dev_Net);
+    struct rebol_devreq *req = Req(sock);
+
+    if (not (req->modes & RST_UDP))
+        rebJumps("fail {UDP-RECEIVE-BATCH used on non-UDP port}");
+
+    if (not (req->state & RSM_OPEN))
+        fail (Error_On_Port(SYM_NOT_OPEN, ARG(port), -12));
+
+    REBINT max = REF(max) ? VAL_INT32(ARG(max)) : UDP_BATCH_MAX;
+    if (max < 1)
+        fail (Error_Out_Of_Range(ARG(max)));
+
+    REBINT size = REF(size) ? VAL_INT32(ARG(size)) : UDP_DATAGRAM_SIZE;
+    if (size < 1 or size > 65535)
+        fail (Error_Out_Of_Range(ARG(size)));
+
+  #if defined(HAS_MMSG)
+    REBYTE *buf = rebAllocN(REBYTE, UDP_BATCH_MAX * size);
+    struct mmsghdr msgs[UDP_BATCH_MAX];
+    struct iovec iovs[UDP_BATCH_MAX];
+    struct sockaddr_in addrs[UDP_BATCH_MAX];
+  #else
+    REBYTE *buf = rebAllocN(REBYTE, size);
+  #endif
+
+    struct sockaddr_in from;  // sender of the last datagram
+    int errnum = 0;
+
+    REBDSP dsp_orig = DSP;
+
+    while (errnum == 0 and DSP - dsp_orig < cast(REBDSP, max)) {
+        int want = max - (DSP - dsp_orig);
+        if (want > UDP_BATCH_MAX)
+            want = UDP_BATCH_MAX;
+
+      #if defined(HAS_MMSG)
+        int i;
+        for (i = 0; i < want; ++i) {
+            iovs[i].iov_base = buf + i * size;
+            iovs[i].iov_len = size;
+            memset(&msgs[i], 0, sizeof(msgs[i]));
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_name = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+        }
+
+        int n = recvmmsg(
+            req->requestee.socket, msgs, want, MSG_DONTWAIT, nullptr
+        );
+        if (n < 0) {
+            errnum = GET_ERROR;
+            break;
+        }
+
+        for (i = 0; i < n; ++i) {
+            REBLEN len = msgs[i].msg_len;
+            REBBIN *bin = Make_Binary(len);
+            memcpy(BIN_HEAD(bin), buf + i * size, len);
+            TERM_BIN_LEN(bin, len);
+            Init_Binary(DS_PUSH(), bin);
+        }
+        if (n > 0)
+            from = addrs[n - 1];
+
+        if (n < want)
+            break;  // queue is drained
+      #else
+        socklen_t addr_len = sizeof(from);
+        int len = recvfrom(
+            req->requestee.socket, s_cast(buf), size, 0,
+            cast(struct sockaddr*, &from), &addr_len
+        );
+        if (len < 0) {
+            errnum = GET_ERROR;
+            break;
+        }
+
+        REBBIN *bin = Make_Binary(len);
+        memcpy(BIN_HEAD(bin), buf, len);
+        TERM_BIN_LEN(bin, len);
+        Init_Binary(DS_PUSH(), bin);
+      #endif
+    }
+
+    rebFree(buf);
+
+    if (errnum != 0 and errnum != NE_WOULDBLOCK) {
+        DS_DROP_TO(dsp_orig);
+        rebFail_OS (errnum);
+    }
+
+    if (DSP != dsp_orig) {
+        ReqNet(sock)->remote_ip = from.sin_addr.s_addr;
+        ReqNet(sock)->remote_port = ntohs(from.sin_port);
+    }
+
+    return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+}
+
+
+//
+//  export udp-send-batch: native [
+//
+//  {Send a block of datagrams to a UDP port's remote address without waiting}
+//
+//      return: "How many were sent (the rest if the socket's buffer filled)"
+//          [integer!]
+//      port [port!]
+//          {An open UDP port}
+//      packets "One BINARY! per datagram"
+//          [block!]
+//  ]
+//
+REBNATIVE(udp_send_batch)
+//
+// The sending half of UDP-RECEIVE-BATCH, using sendmmsg() where the OS has
+// it.  Unlike WRITE this doesn't wait for room in the socket's buffer: if it
+// fills, the count says where to pick up again.
+{
+    NETWORK_INCLUDE_PARAMS_OF_UDP_SEND_BATCH;
+
+    REBREQ *sock = Force_Get_Port_State(ARG(port), &Dev_Net);
+    struct rebol_devreq *req = Req(sock);
+
+    if (not (req->modes & RST_UDP))
+        rebJumps("fail {UDP-SEND-BATCH used on non-UDP port}");
+
+    if (not (req->state & RSM_OPEN))
+        fail (Error_On_Port(SYM_NOT_OPEN, ARG(port), -12));
+
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, ARG(packets));
+
+    const RELVAL *check = item;
+    for (; check != tail; ++check) {
+        if (not IS_BINARY(check))
+            fail (Error_Bad_Value_Core(check, VAL_SPECIFIER(ARG(packets))));
+    }
+
+    struct sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = ReqNet(sock)->remote_ip;  // network byte order
+    to.sin_port = htons(cast(unsigned short, ReqNet(sock)->remote_port));
+
+    REBINT sent = 0;
+    int errnum = 0;
+
+    while (errnum == 0 and item != tail) {
+      #if defined(HAS_MMSG)
+        struct mmsghdr msgs[UDP_BATCH_MAX];
+        struct iovec iovs[UDP_BATCH_MAX];
+
+        int want = 0;
+        for (; want < UDP_BATCH_MAX and item + want != tail; ++want) {
+            REBSIZ size;
+            const REBYTE *data = VAL_BINARY_SIZE_AT(&size, item + want);
+            iovs[want].iov_base = m_cast(REBYTE*, data);
+            iovs[want].iov_len = size;
+            memset(&msgs[want], 0, sizeof(msgs[want]));
+            msgs[want].msg_hdr.msg_iov = &iovs[want];
+            msgs[want].msg_hdr.msg_iovlen = 1;
+            msgs[want].msg_hdr.msg_name = &to;
+            msgs[want].msg_hdr.msg_namelen = sizeof(to);
+        }
+
+        int n = sendmmsg(req->requestee.socket, msgs, want, 0);
+        if (n < 0) {
+            errnum = GET_ERROR;
+            break;
+        }
+
+        sent += n;
+        item += n;
+        if (n < want)
+            break;  // socket buffer is full
+      #else
+        REBSIZ size;
+        const REBYTE *data = VAL_BINARY_SIZE_AT(&size, item);
+        int result = sendto(
+            req->requestee.socket, cs_cast(data), size, 0,
+            cast(struct sockaddr*, &to), sizeof(to)
+        );
+        if (result < 0) {
+            errnum = GET_ERROR;
+            break;
+        }
+
+        ++sent;
+        ++item;
+      #endif
+    }
+
+    if (errnum != 0 and errnum != NE_WOULDBLOCK)
+        rebFail_OS (errnum);
+
+    return Init_Integer(D_OUT, sent);
+}
+
+//
+//  export send-file: native [
+//
+//  {Write a file (or part of it) to a TCP port without reading it into memory}
+//
+//      return: [port!]
+//      port [port!]
+//          {An open, connected TCP port}
+//      source [file!]
+//      /seek "Byte offset in the file to start from (default is 0)"
+//          [integer!]
+//      /part "Number of bytes to send (default is to the end of the file)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(send_file)
+//
+// This is WRITE for static content: the port gets a `wrote` event once all
+// of the bytes are sent, finishing in the background like any other WRITE.
+// Where the OS has sendfile() the bytes go from the page cache straight to
+// the socket, otherwise they're read a buffer at a time (see dev-net.c).
+//
+// !!! Only a FILE! is taken, not a file PORT!...the file device belongs to
+// another extension, and there is no API for borrowing its descriptor.
+{
+    NETWORK_INCLUDE_PARAMS_OF_SEND_FILE;
+
+    REBVAL *port = ARG(port);
+    REBREQ *sock = Force_Get_Port_State(port, &Dev_Net);
+    struct rebol_devreq *req = Req(sock);
+
+    if (req->modes & RST_UDP)
+        rebJumps("fail {SEND-FILE used on non-TCP port}");
+
+    if (not (req->state & RSM_CONNECT))
+        fail (Error_On_Port(SYM_NOT_CONNECTED, port, -15));
+
+    if (req->state & RSM_SENDFILE)
+        rebJumps("fail {SEND-FILE already in progress on port}");
+
+  #ifdef TO_WINDOWS
+    WCHAR *path_wide = rebSpellWide("file-to-local/full", ARG(source));
+    int fd = _wopen(path_wide, _O_RDONLY | _O_BINARY);
+    rebFree(path_wide);
+  #else
+    char *path_utf8 = rebSpell("file-to-local/full", ARG(source));
+    int fd = open(path_utf8, O_RDONLY);
+    rebFree(path_utf8);
+  #endif
+
+    if (fd < 0)
+        rebFail_OS (FILE_ERROR);
+
+  #ifdef TO_WINDOWS
+    struct _stati64 info;
+    int stat_result = _fstati64(fd, &info);
+  #else
+    struct stat info;
+    int stat_result = fstat(fd, &info);
+  #endif
+
+    if (stat_result != 0) {
+        int errnum = FILE_ERROR;
+        CLOSE_FILE(fd);
+        rebFail_OS (errnum);
+    }
+
+    int64_t size = info.st_size;
+    int64_t pos = REF(seek) ? VAL_INT64(ARG(seek)) : 0;
+    if (pos < 0 or pos > size) {
+        CLOSE_FILE(fd);
+        fail (Error_Out_Of_Range(ARG(seek)));
+    }
+
+    int64_t len = REF(part) ? VAL_INT64(ARG(part)) : size - pos;
+    if (len < 0 or len > size - pos) {
+        CLOSE_FILE(fd);
+        fail (Error_Out_Of_Range(ARG(part)));
+    }
+
+    if (len == 0) {  // nothing for the device to do, but still signal it
+        CLOSE_FILE(fd);
+        rebElide(
+            "insert system/ports/system make event! [",
+                "type: 'wrote",
+                "port:", port,
+            "]"
+        );
+        RETURN (port);
+    }
+
+    ReqNet(sock)->file = fd;
+    ReqNet(sock)->file_pos = pos;
+    req->state |= RSM_SENDFILE;  // Close_Send_File() clears, closes `fd`
+
+    TRASH_POINTER_IF_DEBUG(req->common.binary);
+    req->length = len;
+    req->actual = 0;
+
+    REBVAL *result = OS_DO_DEVICE(sock, RDC_WRITE);
+    if (result != nullptr) {  // sent the whole thing already
+        if (rebDid("error?", result))
+            rebJumps("fail", result);
+        rebRelease(result);
+    }
+
+    RETURN (port);
+}
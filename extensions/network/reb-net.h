@@ -39,7 +39,16 @@ enum {
     RSM_LISTEN  = 1 << 4,   // socket is listening (TCP)
     RSM_SEND    = 1 << 5,   // sending
     RSM_RECEIVE = 1 << 6,   // receiving
-    RSM_ACCEPT  = 1 << 7    // an inbound connection
+    RSM_ACCEPT  = 1 << 7,   // an inbound connection
+    RSM_SENDFILE = 1 << 8   // RDC_WRITE is from `file`, not common.binary
+};
+
+// REBOL Socket Options (from the port spec, see Try_Set_Sock_Options())
+enum {
+    RSO_NODELAY     = 1 << 0,   // TCP_NODELAY
+    RSO_KEEPALIVE   = 1 << 1,   // SO_KEEPALIVE
+    RSO_QUICKACK    = 1 << 2,   // TCP_QUICKACK (Linux only, else ignored)
+    RSO_REUSEPORT   = 1 << 3    // SO_REUSEPORT (ignored on Windows)
 };
 
 #define IPA(a,b,c,d) (a<<24 | b<<16 | c<<8 | d)
@@ -50,9 +59,27 @@ struct devreq_net {
     uint32_t local_port;    // local port used
     uint32_t remote_ip;     // remote address
     uint32_t remote_port;   // remote port
-    void *host_info;        // for DNS usage
+    void *host_info;        // Reb_Dns_Job while RDC_LOOKUP is pending
+    int file;               // file descriptor for SEND-FILE
+    int64_t file_pos;       // where next byte of SEND-FILE is in the file
+    uint32_t read_size;     // buffer room for READ without /PART (0=default)
+    int32_t recv_buffer;    // SO_RCVBUF (0 is OS default)
+    int32_t send_buffer;    // SO_SNDBUF (0 is OS default)
+    uint32_t options;       // RSO_XXX flags
 };
 
+// Host name resolution, see %dns-resolve.c (also used by the DNS extension)
+//
+struct Reb_Dns_Job;
+EXTERN_C bool Dns_Cache_Find(const char *name, int *status, uint32_t *ip);
+EXTERN_C struct Reb_Dns_Job *Dns_Start(const char *name);
+EXTERN_C int Dns_Fd(struct Reb_Dns_Job *job);
+EXTERN_C bool Dns_Done(struct Reb_Dns_Job *job);
+EXTERN_C int Dns_Finish(struct Reb_Dns_Job *job, uint32_t *ip);
+EXTERN_C bool Dns_Not_Found(int status);
+EXTERN_C void Dns_Abandon(struct Reb_Dns_Job *job);
+EXTERN_C REBVAL *Dns_Make_Error(const char *name, int status);
+
 inline static struct devreq_net *ReqNet(REBREQ *req) {
     assert(Req(req)->device == &Dev_Net);
     return cast(struct devreq_net*, Req(req));
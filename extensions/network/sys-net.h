@@ -46,6 +46,9 @@
     #define NE_INVALID      WSAEINVAL
 
     typedef int socklen_t;
+
+    #include <io.h>  // SEND-FILE uses CRT file descriptors, see dev-net.c
+    #define CLOSE_FILE      _close
 #else
     #ifdef TO_AMIGA
         typedef char __BYTE;
@@ -59,11 +62,13 @@
     #include <netdb.h>
     #include <sys/socket.h>
     #include <netinet/in.h>
+    #include <netinet/tcp.h>  // TCP_NODELAY, TCP_QUICKACK
     #include <unistd.h>
 
     #define GET_ERROR       errno
     #define IOCTL           ioctl
     #define CLOSE_SOCKET    close
+    #define CLOSE_FILE      close
     #define SOCKET          unsigned int
 
     #define NE_ISCONN       EISCONN
@@ -101,6 +101,21 @@ typedef struct {
     bool is_unsigned;
 } COLUMN;  // For describing columns
 
+typedef struct {
+    SQLULEN size;  // rows per SQLFetchScroll(), SQL_ATTR_ROW_ARRAY_SIZE
+    SQLULEN fetched;  // rows it got, written via SQL_ATTR_ROWS_FETCHED_PTR
+    SQLULEN next;  // next of the fetched rows for COPY-ODBC to give back
+    bool done;  // SQLFetchScroll() said SQL_NO_DATA
+    SQLUSMALLINT *status;  // row statuses, SQL_ATTR_ROW_STATUS_PTR
+    SQLSMALLINT num_columns;
+    SQLULEN *element_sizes;  // per column, bytes for one row's value
+    char **buffers;  // per column, `size` values one after the other
+    SQLLEN **lengths;  // per column, `size` length/indicators
+} ROWSET;  // For fetching many rows at once with column-wise binding
+
+static void ODBC_DropRowset(REBVAL *statement, SQLHSTMT hstmt);
+static void ODBC_ResetParamArrays(SQLHSTMT hstmt);
+
 
 //=////////////////////////////////////////////////////////////////////////=//
 //
@@ -299,6 +314,38 @@ REBNATIVE(odbc_set_char_encoding)
 }
 
 
+// Result sets often have the same strings in many rows (e.g. status values or
+// country codes).  If asked, strings are frozen and share one series when
+// equal (see %s-pool.c), so the repeats take no memory of their own.
+//
+bool dedup_text_columns = false;
+
+//
+//  export odbc-set-dedup: native [
+//
+//  {Set whether strings fetched from CHAR, VARCHAR... fields are deduplicated}
+//
+//      return: []
+//      dedup "If true, strings are frozen and equal ones share a series"
+//          [logic!]
+//  ]
+//
+REBNATIVE(odbc_set_dedup)
+{
+    ODBC_INCLUDE_PARAMS_OF_ODBC_SET_DEDUP;
+
+    dedup_text_columns = rebDid(ARG(dedup));
+
+    return rebNone();
+}
+
+inline static REBVAL *Dedup_If_Asked(REBVAL *text) {
+    if (dedup_text_columns)
+        Dedup_String_Value(text);
+    return text;
+}
+
+
 //
 //  export open-connection: native [
 //
@@ -449,22 +496,378 @@ REBNATIVE(open_statement)
 }
 
 
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// PREPARED STATEMENT CACHE
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Services tend to run the same few dozen queries over and over, often
+// from statement ports opened and closed for each one.  Preparing SQL can
+// be a round trip to the server, so each connection keeps the prepared
+// statement handles of recently used SQL:
+//
+// * CLOSE of a statement port gives its handle to the cache, under the SQL
+//   it was prepared with.
+//
+// * INSERT on a statement port with SQL that's in the cache swaps handles
+//   with it, so the handle the port had is cached (under its own SQL).
+//
+// The connection's `cache-size` field limits how many are kept (0 for no
+// cache), and the least recently used ones are freed to make room.
+//
+// !!! Lookup is a linear search of hash codes, which is fine for the sizes
+// this is meant for.  A cache of thousands would want a hash table.
+//
+
+typedef struct {
+    SQLWCHAR *sql;  // malloc()'d copy, null terminated
+    size_t sql_len;  // in SQLWCHARs, not counting the terminator
+    uint32_t hash;
+    SQLHSTMT hstmt;
+    uint64_t last_used;  // STMT_CACHE's `clock` when it was cached
+} CACHED_STMT;
+
+typedef struct {
+    REBLEN count;
+    REBLEN capacity;  // entries allocated (grown as needed, up to the limit)
+    CACHED_STMT *entries;
+    uint64_t clock;
+    uint64_t hits;
+    uint64_t misses;
+} STMT_CACHE;
+
+static uint32_t Hash_Sql(const SQLWCHAR *sql, size_t *len_out) {
+    uint32_t hash = 2166136261u;  // FNV-1a
+    size_t len;
+    for (len = 0; sql[len] != 0; ++len) {
+        hash ^= sql[len];
+        hash *= 16777619u;
+    }
+    *len_out = len;
+    return hash;
+}
+
+static void cleanup_stmt_cache(const REBVAL *v) {
+    STMT_CACHE *cache = cast(STMT_CACHE*, VAL_HANDLE_VOID_POINTER(v));
+    if (cache == nullptr)
+        return;  // already cleared out by CLOSE-CONNECTION
+
+    // The statement handles aren't freed here, since the GC may have already
+    // run cleanup_hdbc() (disconnecting frees a connection's statements).
+    //
+    REBLEN n;
+    for (n = 0; n < cache->count; ++n)
+        free(cache->entries[n].sql);
+    free(cache->entries);
+    free(cache);
+}
+
+
+// Gives nullptr if the connection has no cache and CACHE-SIZE is 0.
+//
+static STMT_CACHE *ODBC_GetStmtCache(const REBVAL *connection, REBINT *limit)
+{
+    *limit = rebUnboxInteger(
+        "any [match integer! pick", connection, "'cache-size 0]"
+    );
+    if (*limit < 0)
+        *limit = 0;
+
+    REBVAL *cache_value = rebValue(
+        "ensure [<opt> handle!] pick", connection, "'cache"
+    );
+    if (cache_value) {
+        STMT_CACHE *cache = VAL_HANDLE_POINTER(STMT_CACHE, cache_value);
+        rebRelease(cache_value);
+        return cache;
+    }
+
+    if (*limit == 0)
+        return nullptr;
+
+    STMT_CACHE *cache = cast(STMT_CACHE*, malloc(sizeof(STMT_CACHE)));
+    if (not cache)
+        fail ("Couldn't allocate statement cache!");
+    cache->count = 0;
+    cache->capacity = 0;
+    cache->entries = nullptr;
+    cache->clock = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+
+    cache_value = rebHandle(cache, sizeof(STMT_CACHE), &cleanup_stmt_cache);
+    rebElide("poke", connection, "'cache", rebR(cache_value));
+    return cache;
+}
+
+
+// Take the handle prepared with `sql` out of the cache, if there is one.
+//
+static SQLHSTMT ODBC_TakeCachedStmt(STMT_CACHE *cache, const SQLWCHAR *sql)
+{
+    size_t len;
+    uint32_t hash = Hash_Sql(sql, &len);
+
+    REBLEN n;
+    for (n = 0; n < cache->count; ++n) {
+        CACHED_STMT *entry = &cache->entries[n];
+        if (
+            entry->hash != hash
+            or entry->sql_len != len
+            or memcmp(entry->sql, sql, len * sizeof(SQLWCHAR)) != 0
+        ){
+            continue;
+        }
+
+        SQLHSTMT hstmt = entry->hstmt;
+        free(entry->sql);
+        *entry = cache->entries[--cache->count];  // order doesn't matter
+        ++cache->hits;
+        return hstmt;
+    }
+
+    ++cache->misses;
+    return SQL_NULL_HANDLE;
+}
+
+
+// Keep `hstmt` (prepared with `sql`) in the cache.  It must not have a
+// cursor open, or any columns or parameters bound.  If the cache won't take
+// it, it is freed.
+//
+// (Two statement ports can be given the same SQL and then closed, which
+// caches the SQL twice.  That's left alone, both can be used.)
+//
+static void ODBC_CacheStmt(
+    STMT_CACHE *cache,
+    REBINT limit,
+    const SQLWCHAR *sql,
+    SQLHSTMT hstmt
+){
+    while (cache->count != 0 and cache->count >= cast(REBLEN, limit)) {
+        REBLEN oldest = 0;
+        REBLEN n;
+        for (n = 1; n < cache->count; ++n) {
+            if (cache->entries[n].last_used < cache->entries[oldest].last_used)
+                oldest = n;
+        }
+        SQLFreeHandle(SQL_HANDLE_STMT, cache->entries[oldest].hstmt);
+        free(cache->entries[oldest].sql);
+        cache->entries[oldest] = cache->entries[--cache->count];
+    }
+
+    if (limit == 0)
+        goto no_room;
+
+    if (cache->count == cache->capacity) {
+        REBLEN capacity = MIN(
+            cast(REBLEN, limit), cache->capacity == 0 ? 8 : cache->capacity * 2
+        );
+        CACHED_STMT *entries = cast(CACHED_STMT*, realloc(
+            cache->entries, capacity * sizeof(CACHED_STMT)
+        ));
+        if (not entries)
+            goto no_room;  // it's just a cache, don't fail
+        cache->entries = entries;
+        cache->capacity = capacity;
+    }
+
+    blockscope {
+        CACHED_STMT *entry = &cache->entries[cache->count];
+        entry->hash = Hash_Sql(sql, &entry->sql_len);
+        entry->sql = cast(SQLWCHAR*,
+            malloc((entry->sql_len + 1) * sizeof(SQLWCHAR))
+        );
+        if (not entry->sql)
+            goto no_room;
+        memcpy(entry->sql, sql, (entry->sql_len + 1) * sizeof(SQLWCHAR));
+        entry->hstmt = hstmt;
+        entry->last_used = ++cache->clock;
+        ++cache->count;
+    }
+    return;
+
+  no_room:
+    SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+}
+
+
+// Free the handles while the connection is still open to free them with.
+//
+static void ODBC_ClearStmtCache(REBVAL *connection)
+{
+    REBVAL *cache_value = rebValue(
+        "ensure [<opt> handle!] pick", connection, "'cache"
+    );
+    if (not cache_value)
+        return;
+
+    STMT_CACHE *cache = VAL_HANDLE_POINTER(STMT_CACHE, cache_value);
+    REBLEN n;
+    for (n = 0; n < cache->count; ++n)
+        SQLFreeHandle(SQL_HANDLE_STMT, cache->entries[n].hstmt);
+
+    cleanup_stmt_cache(cache_value);
+    SET_HANDLE_CDATA(cache_value, nullptr);  // avoid GC cleanup
+    rebElide("poke", connection, "'cache", "null");
+    rebRelease(cache_value);
+}
+
+
+// The connection of a statement, if it's still open (and so can use the
+// cache).  Release the result.
+//
+static REBVAL *ODBC_StatementConnection(const REBVAL *statement)
+{
+    return rebValue(
+        "match object! pick", statement, "'database",
+            "then connection -> [",
+                "if handle? try pick connection 'hdbc [connection]",
+            "]"
+    );
+}
+
+
+// Get the statement ready to run `sql` and return the handle to run it
+// with, which may be a different one from the cache.  No cursor can be
+// open, and no parameters bound.  `*reused` (if not nullptr) says if it was
+// prepared already, by the statement port itself or in the cache.
+//
+static SQLHSTMT ODBC_PrepareStatement(
+    REBVAL *statement,
+    SQLHSTMT hstmt,
+    const REBVAL *sql,
+    bool *reused
+){
+    REBVAL *connection = ODBC_StatementConnection(statement);
+
+    REBINT limit = 0;
+    STMT_CACHE *cache = connection
+        ? ODBC_GetStmtCache(connection, &limit)
+        : nullptr;
+
+    if (rebDid(
+        "strict-equal?", sql,
+            "ensure [text! blank!] pick", statement, "'string"
+    )){
+        if (cache)
+            ++cache->hits;
+        rebRelease(connection);
+        if (reused)
+            *reused = true;
+        return hstmt;
+    }
+
+    SQLWCHAR *sql_string = rebSpellWide(sql);
+    SQLWCHAR *old_sql = rebSpellWide(  // gives nullptr if BLANK!
+        "ensure [text! blank!] pick", statement, "'string"
+    );
+
+    // The port won't be prepared if this fails partway, and the titles of
+    // the old SQL's results don't go with whatever handle it ends up with.
+    //
+    rebElide("poke", statement, "'string", "blank");
+    rebElide("poke", statement, "'titles", "blank");
+
+    bool prepared = false;
+    SQLHSTMT new_hstmt = SQL_NULL_HANDLE;
+    if (cache) {
+        new_hstmt = ODBC_TakeCachedStmt(cache, sql_string);
+        prepared = (new_hstmt != SQL_NULL_HANDLE);
+
+        if (new_hstmt == SQL_NULL_HANDLE and old_sql) {  // keep old one too
+            REBVAL *hdbc_value = rebValue(
+                "ensure handle! pick", connection, "'hdbc"
+            );
+            SQLHDBC hdbc = VAL_HANDLE_POINTER(SQLHDBC, hdbc_value);
+            rebRelease(hdbc_value);
+
+            SQLRETURN rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &new_hstmt);
+            if (not SQL_SUCCEEDED(rc))
+                new_hstmt = SQL_NULL_HANDLE;  // just prepare the port's own
+        }
+    }
+
+    if (new_hstmt != SQL_NULL_HANDLE) {
+        if (old_sql)
+            ODBC_CacheStmt(cache, limit, old_sql, hstmt);
+        else
+            SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+        hstmt = new_hstmt;
+
+        REBVAL *hstmt_value = rebHandle(hstmt, sizeof(hstmt), nullptr);
+        rebElide("poke", statement, "'hstmt", rebR(hstmt_value));
+    }
+
+    if (old_sql)
+        rebFree(old_sql);
+    rebRelease(connection);  // nullptr is ok
+
+    if (not prepared) {
+        SQLRETURN rc = SQLPrepareW(hstmt, sql_string, SQL_NTS);
+        if (not SQL_SUCCEEDED(rc))
+            fail (Error_ODBC_Stmt(hstmt));
+    }
+    rebFree(sql_string);
+
+    // Remember statement string handle, but keep a copy since it may be
+    // mutated by the user.
+    //
+    // !!! Could re-use value with existing series if read only
+    //
+    rebElide("poke", statement, "'string", "(copy", sql, ")");
+
+    if (reused)
+        *reused = prepared;
+    return hstmt;
+}
+
+
+//
+//  export cache-stats-odbc: native [
+//
+//  {Counts for a connection's cache of prepared statements}
+//
+//      return: [object!]
+//      connection [object!]
+//  ]
+//
+REBNATIVE(cache_stats_odbc)
+//
+// HITS counts the times SQL was run without preparing it, by a statement
+// port that had just run it or with a handle from the cache.  MISSES are
+// the times it had to be prepared.
+{
+    ODBC_INCLUDE_PARAMS_OF_CACHE_STATS_ODBC;
+
+    REBINT limit;
+    STMT_CACHE *cache = ODBC_GetStmtCache(ARG(connection), &limit);
+
+    return rebValue("make object! [",
+        "size:", rebI(cache ? cache->count : 0),
+        "limit:", rebI(limit),
+        "hits:", rebI(cache ? cache->hits : 0),
+        "misses:", rebI(cache ? cache->misses : 0),
+    "]");
+}
+
+
 // The buffer at *ParameterValuePtr SQLBindParameter binds to is deferred
 // buffer, and so is the StrLen_or_IndPtr. They need to be vaild over until
 // Execute or ExecDirect are called.
 //
 // Bound parameters are a Rebol value of incoming type.  These values inform
 // the dynamic allocation of a buffer for the parameter, pre-filling it with
-// the content of the value.
+// the content of the value.  ODBC_EncodeParameter() makes the buffer and
+// returns its SQL_C_XXX type (with the SQL_XXX type in *sql_type_out), so
+// parameter arrays can be built from the same encodings.
 //
-SQLRETURN ODBC_BindParameter(
-    SQLHSTMT hstmt,
+static SQLSMALLINT ODBC_EncodeParameter(
     PARAMETER *p,
-    SQLUSMALLINT number,  // parameter number
+    SQLSMALLINT *sql_type_out,
     const REBVAL *v
 ){
-    assert(number != 0);
-
     p->length = 0;  // ignored for most types
     p->column_size = 0;  // also ignored for most types
     TRASH_POINTER_IF_DEBUG(p->buffer);  // required to be set by switch()
@@ -716,6 +1119,22 @@ SQLRETURN ODBC_BindParameter(
         rebJumps ("panic {Unhandled SQL type in switch() statement}");
     }
 
+    *sql_type_out = sql_type;
+    return c_type;
+}
+
+
+SQLRETURN ODBC_BindParameter(
+    SQLHSTMT hstmt,
+    PARAMETER *p,
+    SQLUSMALLINT number,  // parameter number
+    const REBVAL *v
+){
+    assert(number != 0);
+
+    SQLSMALLINT sql_type;
+    SQLSMALLINT c_type = ODBC_EncodeParameter(p, &sql_type, v);
+
     SQLRETURN rc = SQLBindParameter(
         hstmt,  // StatementHandle
         number,  // ParameterNumber
@@ -1105,6 +1524,9 @@ REBNATIVE(insert_odbc)
     rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
     rc = SQLCloseCursor(hstmt);  // !!! check rc?
 
+    ODBC_DropRowset(statement, hstmt);  // its arrays fit the last query
+    ODBC_ResetParamArrays(hstmt);  // in case INSERT-ODBC-ROWS failed
+
     //=//// MAKE SQL REQUEST FROM DIALECTED SQL BLOCK /////////////////////=//
     //
     // The block passed in is used to form a query.
@@ -1119,6 +1541,7 @@ REBNATIVE(insert_odbc)
     );
 
     if (get_catalog) {
+        rebElide("poke", statement, "'string", "blank");  // not prepared now
         rc = ODBC_GetCatalog(hstmt, ARG(sql));
     }
     else {
@@ -1126,38 +1549,21 @@ REBNATIVE(insert_odbc)
         // (statement) string
 
         // Compare with previously prepared statement, and if not the same,
-        // then prepare a new statement.
+        // then prepare a new statement (or get one from the cache).
+        //
+        REBVAL *sql_string = rebValue("first", ARG(sql));
+        bool reused;
+        hstmt = ODBC_PrepareStatement(statement, hstmt, sql_string, &reused);
+        rebRelease(sql_string);
+
+        // Titles are kept for the SQL the port ran last, not in the cache.
         //
-        use_cache = rebDid(
-            "strict-equal? first", ARG(sql),
-                "ensure [text! blank!] pick", statement, "'string"
+        use_cache = reused and rebDid(
+            "block? pick", statement, "'titles"
         );
 
         REBLEN sql_index = 1;
 
-        if (not use_cache) {
-            SQLWCHAR *sql_string = rebSpellWide("first", ARG(sql));
-
-            rc = SQLPrepareW(
-                hstmt,
-                sql_string,
-                SQL_NTS  // Null-Terminated String
-            );
-            if (not SQL_SUCCEEDED(rc))
-                fail (Error_ODBC_Stmt(hstmt));
-
-            rebFree(sql_string);
-
-            // Remember statement string handle, but keep a copy since it
-            // may be mutated by the user.
-            //
-            // !!! Could re-use value with existing series if read only
-            //
-            rebElide(
-                "poke", statement, "'string", "(copy first", ARG(sql), ")"
-            );
-        }
-
         // The SQL string may contain ? characters, which indicates that it is
         // a parameterized query.  The separation of the parameters into a
         // different quarantined part of the query is to protect against SQL
@@ -1303,74 +1709,466 @@ REBNATIVE(insert_odbc)
 }
 
 
+//=////////////////////////////////////////////////////////////////////////=//
 //
-// A query will fill a column's buffer with data.  This data can be
-// reinterpreted as a Rebol value.  Successive queries for records reuse the
-// buffer for a column.
+// PARAMETER ARRAYS (BULK INSERT)
 //
-REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Running an INSERT once per row is a round trip per row.  With
+// SQL_ATTR_PARAMSET_SIZE, each parameter is bound to an array holding its
+// value for many rows ("column-wise binding"), and one SQLExecute() runs
+// the statement for all of them.  The driver reports how each row went in
+// the SQL_ATTR_PARAM_STATUS_PTR array, and the diagnostic records say which
+// row (SQL_DIAG_ROW_NUMBER) they are for.
+//
+
+#define DEFAULT_PARAMSET_SIZE 100
+
+
+// Go back to running with one set of parameters.  Called before any
+// execute, since a failed INSERT-ODBC-ROWS could leave arrays set up (and
+// their status arrays were freed).
+//
+static void ODBC_ResetParamArrays(SQLHSTMT hstmt)
 {
-    if (col->length == SQL_NULL_DATA)
-        return rebBlank();
+    SQLSetStmtAttr(  // !!! check rc?
+        hstmt,
+        SQL_ATTR_PARAMSET_SIZE,
+        cast(SQLPOINTER, cast(uintptr_t, 1)),
+        0
+    );
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, nullptr, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, nullptr, 0);
+}
 
-    switch (col->c_type) {
-      case SQL_C_BIT:
-        //
-        // Note: MySQL ODBC returns -2 for sql_type when a field is BIT(n)
-        // where n != 1, as opposed to SQL_BIT and column_size of n.  See
-        // remarks on the fail() below.
-        //
-        if (col->column_size != 1)
-            fail ("BIT(n) fields are only supported for n = 1");
 
-        return rebLogic(*cast(unsigned char*, col->buffer) != 0);
+inline static bool Is_Integer_C_Type(SQLSMALLINT c_type) {
+    return c_type == SQL_C_LONG or c_type == SQL_C_ULONG
+        or c_type == SQL_C_SBIGINT or c_type == SQL_C_UBIGINT;
+}
 
-    // ODBC was asked at SQLGetData time to give back *most* integer
-    // types as SQL_C_SLONG or SQL_C_ULONG, regardless of actual size
-    // in the sql_type (not the c_type)
+inline static SQLBIGINT Encoded_Integer(PARAMETER *p, SQLSMALLINT c_type) {
+    switch (c_type) {
+      case SQL_C_LONG:
+        return *cast(SQLINTEGER*, p->buffer);
+      case SQL_C_ULONG:
+        return *cast(SQLUINTEGER*, p->buffer);
+      case SQL_C_UBIGINT:
+        return *cast(SQLUBIGINT*, p->buffer);  // INTEGER! was in range
+      default:
+        assert(c_type == SQL_C_SBIGINT);
+        return *cast(SQLBIGINT*, p->buffer);
+    }
+}
 
-      case SQL_C_SLONG:  // signed: -32,768..32,767
-        return rebInteger(*cast(SQLINTEGER*, col->buffer));
 
-      case SQL_C_ULONG:  // signed: -2[31]..2[31] - 1
-        return rebInteger(*cast(SQLUINTEGER*, col->buffer));
+//
+// The ERROR! for diagnostic record `rec` of the statement, and the row of
+// the parameter set it is about (0 if it doesn't say).  nullptr if no such
+// record.
+//
+static REBVAL *ODBC_Diag_Error(SQLHSTMT hstmt, SQLSMALLINT rec, SQLLEN *row)
+{
+    SQLWCHAR state[6];
+    SQLINTEGER native;
+    SQLWCHAR message[4086];
+    SQLSMALLINT message_len;
 
-    // Special exception made for big integers, where seemingly MySQL
-    // would not properly map smaller types into big integers if all
-    // you ask for are big ones.
-    //
-    // !!! Review: bug may not exist if SQLGetData() is used.
+    SQLRETURN rc = SQLGetDiagRecW(
+        SQL_HANDLE_STMT, hstmt, rec, state, &native,
+        message, 4086, &message_len
+    );
+    if (rc == SQL_SUCCESS_WITH_INFO)
+        message_len = 4086;  // truncated, as in Error_ODBC_Core()
+    else if (rc != SQL_SUCCESS)
+        return nullptr;
+
+    *row = 0;
+    rc = SQLGetDiagField(
+        SQL_HANDLE_STMT, hstmt, rec, SQL_DIAG_ROW_NUMBER, row, 0, nullptr
+    );
+    if (not SQL_SUCCEEDED(rc) or *row < 0)  // e.g. SQL_NO_ROW_NUMBER
+        *row = 0;
 
-      case SQL_C_SBIGINT:  // signed: -2[63]..2[63]-1
-        return rebInteger(*cast(SQLBIGINT*, col->buffer));
+    return rebValue(
+        "make error!", rebR(rebLengthedTextWide(message, message_len))
+    );
+}
 
-      case SQL_C_UBIGINT:  // unsigned: 0..2[64] - 1
-        if (*cast(REBU64*, col->buffer) > INT64_MAX)
-            fail ("INTEGER! can't hold some unsigned 64-bit values");
 
-        return rebInteger(*cast(SQLUBIGINT*, col->buffer));
+//
+//  export insert-odbc-rows: native [
+//
+//  {Execute a parameterized SQL statement for many rows of parameters}
+//
+//      return: "COUNT of rows changed, ERRORS block of row number + ERROR!"
+//          [object!]
+//      statement [object!]
+//      sql "SQL text with a `?` for each parameter"
+//          [text!]
+//      rows "Block of parameter blocks, each with a value for every `?`"
+//          [block!]
+//      /batch "Rows to send per execute (default 100)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(insert_odbc_rows)
+{
+    ODBC_INCLUDE_PARAMS_OF_INSERT_ODBC_ROWS;
 
-    // ODBC was asked at column binding time to give back all floating
-    // point types as SQL_C_DOUBLE, regardless of actual size.
+    REBVAL *statement = ARG(statement);
+    REBVAL *hstmt_value = rebValue(
+        "ensure handle! pick", statement, "'hstmt"
+    );
+    SQLHSTMT hstmt = VAL_HANDLE_POINTER(SQLHSTMT, hstmt_value);
+    rebRelease(hstmt_value);
 
-      case SQL_C_DOUBLE:
-        return rebDecimal(*cast(SQLDOUBLE*, col->buffer));
+    REBINT batch = REF(batch)
+        ? rebUnboxInteger(ARG(batch))
+        : DEFAULT_PARAMSET_SIZE;
+    if (batch < 1)
+        fail (PAR(batch));
 
-      case SQL_C_TYPE_DATE: {
-        DATE_STRUCT *date = cast(DATE_STRUCT*, col->buffer);
-        return rebValue(
-            "make date! [",
-                rebI(date->year), rebI(date->month), rebI(date->day),
-            "]"
-        ); }
+    // Check the rows before any are sent, so a bad one doesn't leave the
+    // batches before it inserted.
+    //
+    const RELVAL *tail;
+    const RELVAL *first = VAL_ARRAY_AT(&tail, ARG(rows));
+    REBLEN num_rows = tail - first;
+    REBLEN num_params = 0;
+    if (num_rows != 0 and IS_BLOCK(first))
+        num_params = VAL_LEN_AT(first);
+
+    const RELVAL *item;
+    for (item = first; item != tail; ++item) {
+        if (not IS_BLOCK(item) or VAL_LEN_AT(item) != num_params)
+            fail ("ROWS must be blocks with the same number of parameters");
+    }
 
-      case SQL_C_TYPE_TIME: {
-        //
-        // The TIME_STRUCT in ODBC does not contain a fraction/nanosecond
-        // component.  Hence a TIME(7) might be able to store 17:32:19.123457
-        // but when it is retrieved it will just be 17:32:19
+    SQLRETURN rc;
+
+    rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
+    rc = SQLCloseCursor(hstmt);  // !!! check rc?
+
+    ODBC_DropRowset(statement, hstmt);
+    ODBC_ResetParamArrays(hstmt);
+
+    hstmt = ODBC_PrepareStatement(statement, hstmt, ARG(sql), nullptr);
+
+    REBVAL *errors = rebValue("copy []");
+    SQLLEN count = 0;
+
+    if (num_rows == 0 or num_params == 0) {  // nothing to make arrays of
+        if (num_rows != 0)
+            fail ("INSERT-ODBC-ROWS needs a parameterized statement");
+        goto finished;
+    }
+
+  blockscope {
+    SQLULEN size = MIN(cast(REBLEN, batch), num_rows);
+
+    SQLUSMALLINT *status = rebAllocN(SQLUSMALLINT, size);
+    SQLULEN processed = 0;
+
+    rc = SQLSetStmtAttr(
+        hstmt,
+        SQL_ATTR_PARAM_BIND_TYPE,
+        cast(SQLPOINTER, cast(uintptr_t, SQL_PARAM_BIND_BY_COLUMN)),
+        0
+    );
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, status, 0);
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(
+            hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &processed, 0
+        );
+    if (not SQL_SUCCEEDED(rc))
+        fail (Error_ODBC_Stmt(hstmt));
+
+    PARAMETER *cells = rebAllocN(PARAMETER, size * num_params);
+    SQLSMALLINT *c_types = rebAllocN(SQLSMALLINT, size * num_params);
+    SQLSMALLINT *sql_types = rebAllocN(SQLSMALLINT, size * num_params);
+    char **arrays = rebAllocN(char*, num_params);
+    SQLLEN **indicators = rebAllocN(SQLLEN*, num_params);
+
+    REBLEN base;
+    for (base = 0; base < num_rows; base += size) {
+        SQLULEN n = MIN(size, num_rows - base);
+
+        // Encode every value of the batch as ODBC_BindParameter() would.
+        //
+        SQLULEN r;
+        REBLEN k;
+        for (r = 0; r < n; ++r) {
+            REBVAL *row = rebValue("pick", ARG(rows), rebI(base + r + 1));
+            for (k = 0; k < num_params; ++k) {
+                REBVAL *value = rebValue("pick", row, rebI(k + 1));
+                REBLEN i = r * num_params + k;
+                c_types[i] = ODBC_EncodeParameter(
+                    &cells[i], &sql_types[i], value
+                );
+                rebRelease(value);
+            }
+            rebRelease(row);
+        }
+
+        // Each parameter's array needs one C type for all the rows, and
+        // elements big enough for its biggest value.  Integers may have
+        // been encoded at different sizes, so those widen to SQLBIGINT.
+        //
+        for (k = 0; k < num_params; ++k) {
+            SQLSMALLINT c_type = SQL_C_DEFAULT;  // if all are BLANK!
+            SQLSMALLINT sql_type = SQL_VARCHAR;
+            SQLULEN column_size = 0;
+            SQLULEN element_size = 1;
+
+            for (r = 0; r < n; ++r) {
+                REBLEN i = r * num_params + k;
+                if (c_types[i] == SQL_C_DEFAULT)
+                    continue;
+
+                if (c_type == SQL_C_DEFAULT) {
+                    c_type = c_types[i];
+                    sql_type = sql_types[i];
+                }
+                else if (c_type != c_types[i]) {
+                    if (
+                        not Is_Integer_C_Type(c_type)
+                        or not Is_Integer_C_Type(c_types[i])
+                    ){
+                        fail (
+                            "Parameter types must match in all ROWS"
+                            " (except for BLANK!)"
+                        );
+                    }
+                    c_type = SQL_C_SBIGINT;
+                }
+
+                column_size = MAX(column_size, cells[i].column_size);
+                element_size = MAX(element_size, cells[i].buffer_size);
+            }
+
+            if (c_type == SQL_C_DEFAULT) {  // any type will do for all NULLs
+                c_type = SQL_C_CHAR;
+                column_size = 1;
+            }
+            else if (c_type == SQL_C_SBIGINT)
+                element_size = sizeof(SQLBIGINT);
+
+            arrays[k] = rebAllocN(char, element_size * n);
+            indicators[k] = rebAllocN(SQLLEN, n);
+
+            for (r = 0; r < n; ++r) {
+                REBLEN i = r * num_params + k;
+                char *element = arrays[k] + r * element_size;
+                PARAMETER *p = &cells[i];
+
+                if (c_types[i] == SQL_C_DEFAULT)
+                    indicators[k][r] = SQL_NULL_DATA;
+                else if (c_type == SQL_C_SBIGINT) {
+                    SQLBIGINT i64 = Encoded_Integer(p, c_types[i]);
+                    memcpy(element, &i64, sizeof(SQLBIGINT));
+                    indicators[k][r] = 0;
+                }
+                else {
+                    memcpy(element, p->buffer, p->buffer_size);
+                    indicators[k][r] = p->length;
+                }
+
+                if (p->buffer != nullptr)
+                    rebFree(p->buffer);
+            }
+
+            rc = SQLBindParameter(
+                hstmt,  // StatementHandle
+                k + 1,  // ParameterNumber
+                SQL_PARAM_INPUT,  // InputOutputType
+                c_type,  // ValueType
+                sql_type,  // ParameterType
+                column_size,  // ColumnSize
+                0,  // DecimalDigits
+                arrays[k],  // ParameterValuePtr
+                element_size,  // BufferLength (of each element)
+                indicators[k]  // StrLen_Or_IndPtr
+            );
+            if (not SQL_SUCCEEDED(rc))
+                fail (Error_ODBC_Stmt(hstmt));
+        }
+
+        rc = SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_PARAMSET_SIZE,
+            cast(SQLPOINTER, cast(uintptr_t, n)),
+            0
+        );
+        if (not SQL_SUCCEEDED(rc))
+            fail (Error_ODBC_Stmt(hstmt));
+
+        for (r = 0; r < n; ++r)
+            status[r] = SQL_PARAM_UNUSED;
+        processed = 0;
+
+        rc = SQLExecute(hstmt);
+
+        for (k = 0; k < num_params; ++k) {
+            rebFree(arrays[k]);
+            rebFree(indicators[k]);
+        }
+
+        if (rc == SQL_ERROR and processed == 0)  // e.g. the SQL was bad
+            fail (Error_ODBC_Stmt(hstmt));
+
+        if (
+            rc != SQL_SUCCESS and rc != SQL_SUCCESS_WITH_INFO
+            and rc != SQL_ERROR and rc != SQL_NO_DATA
+        ){
+            fail (Error_ODBC_Stmt(hstmt));  // see notes in INSERT-ODBC
+        }
+
+        if (rc != SQL_SUCCESS and rc != SQL_NO_DATA) {  // rows failed?
+            REBVAL *row_errors = rebValue("make block!", rebI(n));
+            for (r = 0; r < n; ++r)
+                rebElide("append", row_errors, "_");
+
+            SQLSMALLINT rec;
+            for (rec = 1; ; ++rec) {
+                SQLLEN row;
+                REBVAL *error = ODBC_Diag_Error(hstmt, rec, &row);
+                if (error == nullptr)
+                    break;
+                if (row >= 1 and cast(SQLULEN, row) <= n) {
+                    rebElide(
+                        "if blank? pick", row_errors, rebI(row), "[",
+                            "poke", row_errors, rebI(row), rebQ(error),
+                        "]"
+                    );
+                }
+                rebRelease(error);
+            }
+
+            for (r = 0; r < n; ++r) {
+                if (
+                    status[r] == SQL_PARAM_SUCCESS
+                    or status[r] == SQL_PARAM_SUCCESS_WITH_INFO
+                ){
+                    continue;
+                }
+                rebElide(
+                    "append", errors, "reduce [", rebI(base + r + 1), "any [",
+                        "pick", row_errors, rebI(r + 1),
+                        "make error!", rebT(
+                            status[r] == SQL_PARAM_UNUSED
+                                ? "Row was not executed"
+                                : "Row failed (no diagnostic available)"
+                        ),
+                    "]]"
+                );
+            }
+            rebRelease(row_errors);
+        }
+
+        SQLLEN num_changed = 0;
+        rc = SQLRowCount(hstmt, &num_changed);
+        if (SQL_SUCCEEDED(rc) and num_changed > 0)
+            count += num_changed;
+
+        SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
+    }
+
+    rebFree(arrays);
+    rebFree(indicators);
+    rebFree(cells);
+    rebFree(c_types);
+    rebFree(sql_types);
+
+    ODBC_ResetParamArrays(hstmt);
+    rebFree(status);
+  }
+
+  finished:
+
+    return rebValue(
+        "make object! [",
+            "count:", rebI(count),
+            "errors:", rebR(errors),
+        "]"
+    );
+}
+
+
+//
+// A query will fill a column's buffer with data.  This data can be
+// reinterpreted as a Rebol value.  Successive queries for records reuse the
+// buffer for a column.  (A ROWSET has a buffer and length for each row, so
+// the buffer and length are passed separately from the column.)
+//
+REBVAL *ODBC_Cell_To_Rebol_Value(
+    COLUMN *col,
+    SQLPOINTER buffer,
+    SQLLEN length
+){
+    if (length == SQL_NULL_DATA)
+        return rebBlank();
+
+    switch (col->c_type) {
+      case SQL_C_BIT:
+        //
+        // Note: MySQL ODBC returns -2 for sql_type when a field is BIT(n)
+        // where n != 1, as opposed to SQL_BIT and column_size of n.  See
+        // remarks on the fail() below.
         //
-        TIME_STRUCT *time = cast(TIME_STRUCT*, col->buffer);
+        if (col->column_size != 1)
+            fail ("BIT(n) fields are only supported for n = 1");
+
+        return rebLogic(*cast(unsigned char*, buffer) != 0);
+
+    // ODBC was asked at SQLGetData time to give back *most* integer
+    // types as SQL_C_SLONG or SQL_C_ULONG, regardless of actual size
+    // in the sql_type (not the c_type)
+
+      case SQL_C_SLONG:  // signed: -32,768..32,767
+        return rebInteger(*cast(SQLINTEGER*, buffer));
+
+      case SQL_C_ULONG:  // signed: -2[31]..2[31] - 1
+        return rebInteger(*cast(SQLUINTEGER*, buffer));
+
+    // Special exception made for big integers, where seemingly MySQL
+    // would not properly map smaller types into big integers if all
+    // you ask for are big ones.
+    //
+    // !!! Review: bug may not exist if SQLGetData() is used.
+
+      case SQL_C_SBIGINT:  // signed: -2[63]..2[63]-1
+        return rebInteger(*cast(SQLBIGINT*, buffer));
+
+      case SQL_C_UBIGINT:  // unsigned: 0..2[64] - 1
+        if (*cast(REBU64*, buffer) > INT64_MAX)
+            fail ("INTEGER! can't hold some unsigned 64-bit values");
+
+        return rebInteger(*cast(SQLUBIGINT*, buffer));
+
+    // ODBC was asked at column binding time to give back all floating
+    // point types as SQL_C_DOUBLE, regardless of actual size.
+
+      case SQL_C_DOUBLE:
+        return rebDecimal(*cast(SQLDOUBLE*, buffer));
+
+      case SQL_C_TYPE_DATE: {
+        DATE_STRUCT *date = cast(DATE_STRUCT*, buffer);
+        return rebValue(
+            "make date! [",
+                rebI(date->year), rebI(date->month), rebI(date->day),
+            "]"
+        ); }
+
+      case SQL_C_TYPE_TIME: {
+        //
+        // The TIME_STRUCT in ODBC does not contain a fraction/nanosecond
+        // component.  Hence a TIME(7) might be able to store 17:32:19.123457
+        // but when it is retrieved it will just be 17:32:19
+        //
+        TIME_STRUCT *time = cast(TIME_STRUCT*, buffer);
         return rebValue(
             "make time! [",
                 rebI(time->hour), rebI(time->minute), rebI(time->second),
@@ -1383,7 +2181,7 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
     // try and figure this out in the future if they are so inclined.
 
       case SQL_C_TYPE_TIMESTAMP: {
-        TIMESTAMP_STRUCT *stamp = cast(TIMESTAMP_STRUCT*, col->buffer);
+        TIMESTAMP_STRUCT *stamp = cast(TIMESTAMP_STRUCT*, buffer);
 
         // !!! The fraction is generally 0, even if you wrote a nonzero value
         // in the timestamp:
@@ -1412,7 +2210,7 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
     // as SQL_C_BINARY.
 
       case SQL_C_BINARY:
-        return rebSizedBinary(col->buffer, col->length);
+        return rebSizedBinary(buffer, length);
 
     // There's no guarantee that CHAR fields contain valid UTF-8, but we
     // currently only support that.
@@ -1423,10 +2221,10 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
       case SQL_C_CHAR: {
         switch (char_column_encoding) {
           case CHAR_COL_UTF8:
-            return rebSizedText(
-                cast(char*, col->buffer),  // unixodbc SQLCHAR is unsigned
-                col->length
-            );
+            return Dedup_If_Asked(rebSizedText(
+                cast(char*, buffer),  // unixodbc SQLCHAR is unsigned
+                length
+            ));
 
           case CHAR_COL_UTF16:
             assert(!"UTF-16/UCS-2 should have requested SQL_C_WCHAR");
@@ -1439,22 +2237,22 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
             // (Should there be rebSizedTextLatin1() ?)
             //
             REBVAL *binary = rebSizedBinary(
-                cast(unsigned char*, col->buffer),
-                col->length
+                cast(unsigned char*, buffer),
+                length
             );
-            return rebValue(
-                "append make text!", rebI(col->length),
+            return Dedup_If_Asked(rebValue(
+                "append make text!", rebI(length),
                     "map-each byte", rebR(binary), "[to char! byte]"
-            ); }
+            )); }
         }
         break; }
 
       case SQL_C_WCHAR:
-        assert(col->length % 2 == 0);
-        return rebLengthedTextWide(
-            cast(SQLWCHAR*, col->buffer),
-            col->length / 2
-        );
+        assert(length % 2 == 0);
+        return Dedup_If_Asked(rebLengthedTextWide(
+            cast(SQLWCHAR*, buffer),
+            length / 2
+        ));
 
       default:
         break;
@@ -1467,6 +2265,338 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
 }
 
 
+REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
+{
+    return ODBC_Cell_To_Rebol_Value(col, col->buffer, col->length);
+}
+
+
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// ROWSETS (BLOCK CURSOR FETCHES)
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Fetching one row at a time with SQLFetch() is a round trip to the server
+// per row on many drivers.  With SQL_ATTR_ROW_ARRAY_SIZE, one call to
+// SQLFetchScroll() gets many rows, written into arrays bound to each column
+// with SQLBindCol() ("column-wise binding").  COPY-ODBC then hands out rows
+// from the rowset until it runs out, and fetches another.
+//
+// The catch is that bound buffers are of a fixed size, where SQLGetData()
+// can be called again for the rest of a long value.  So statements with a
+// LONG column (or a column too big to bind an array of) keep fetching a row
+// at a time.  That is also the case if the statement's BATCH is 1.
+//
+
+#define MAX_ROWSET_ELEMENT 8192  // bytes, for one row of one column
+#define MAX_ROWSET_BYTES (4 * 1024 * 1024)  // for all of a rowset's buffers
+
+
+static void cleanup_rowset(const REBVAL *v) {
+    ROWSET *rowset = cast(ROWSET*, VAL_HANDLE_VOID_POINTER(v));
+    if (rowset == nullptr)
+        return;  // cleanup_rowset() may be called explicitly
+
+    SQLSMALLINT col_num;
+    for (col_num = 0; col_num < rowset->num_columns; ++col_num) {
+        if (rowset->buffers)  // free(nullptr) is a no-op
+            free(rowset->buffers[col_num]);
+        if (rowset->lengths)
+            free(rowset->lengths[col_num]);
+    }
+    free(rowset->element_sizes);
+    free(rowset->buffers);
+    free(rowset->lengths);
+    free(rowset->status);
+    free(rowset);
+}
+
+
+//
+// Unbind the statement's rowset so its arrays can be freed, and go back to
+// single row fetches (a new query gets a new rowset, if it can use one).
+//
+static void ODBC_DropRowset(REBVAL *statement, SQLHSTMT hstmt)
+{
+    REBVAL *rowset_value = rebValue(
+        "ensure [<opt> handle!] pick", statement, "'rowset"
+    );
+    if (not rowset_value)
+        return;
+
+    if (VAL_HANDLE_VOID_POINTER(rowset_value) != nullptr) {
+        SQLFreeStmt(hstmt, SQL_UNBIND);  // !!! check rc?
+        SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_ROW_ARRAY_SIZE,
+            cast(SQLPOINTER, cast(uintptr_t, 1)),
+            0
+        );
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+
+        cleanup_rowset(rowset_value);
+        SET_HANDLE_CDATA(rowset_value, nullptr);  // avoid GC cleanup
+    }
+    rebElide("poke", statement, "'rowset", "null");
+    rebRelease(rowset_value);
+}
+
+
+//
+// How many bytes a bound array needs for each row of a column, or 0 if the
+// column can't be bound (and must be fetched with SQLGetData()).
+//
+static SQLULEN Rowset_Element_Size(COLUMN *col)
+{
+    switch (col->sql_type) {
+      case SQL_LONGVARCHAR:
+      case SQL_WLONGVARCHAR:
+      case SQL_LONGVARBINARY:  // buffer is capped, SQLGetData() can go on
+        return 0;
+
+      default:
+        break;
+    }
+
+    SQLULEN size = col->buffer_size;
+    if (col->c_type == SQL_C_CHAR and char_column_encoding == CHAR_COL_UTF8)
+        size = 4 * col->column_size + 1;  // column_size counts characters
+
+    if (size > MAX_ROWSET_ELEMENT)
+        return 0;
+    return size;
+}
+
+
+//
+// Get the statement's rowset, making and binding one if there isn't one.
+// Returns nullptr if the columns have to be fetched a row at a time.
+//
+static ROWSET *ODBC_GetRowset(
+    REBVAL *statement,
+    SQLHSTMT hstmt,
+    COLUMN *columns,
+    SQLSMALLINT num_columns
+){
+    REBVAL *rowset_value = rebValue(
+        "ensure [<opt> handle!] pick", statement, "'rowset"
+    );
+    if (rowset_value) {
+        ROWSET *rowset = cast(ROWSET*, VAL_HANDLE_VOID_POINTER(rowset_value));
+        rebRelease(rowset_value);
+        if (rowset)
+            return rowset;
+    }
+
+    REBINT batch = rebUnboxInteger(
+        "any [match integer! pick", statement, "'batch 1]"
+    );
+    if (batch <= 1 or num_columns == 0)
+        return nullptr;
+
+    SQLULEN row_bytes = 0;
+    SQLSMALLINT col_num;
+    for (col_num = 0; col_num < num_columns; ++col_num) {
+        SQLULEN size = Rowset_Element_Size(&columns[col_num]);
+        if (size == 0)
+            return nullptr;
+        row_bytes += size + sizeof(SQLLEN);
+    }
+
+    SQLULEN size = batch;
+    if (size > MAX_ROWSET_BYTES / row_bytes)
+        size = MAX_ROWSET_BYTES / row_bytes;
+    if (size <= 1)
+        return nullptr;
+
+    ROWSET *rowset = cast(ROWSET*, malloc(sizeof(ROWSET)));
+    if (not rowset)
+        fail ("Couldn't allocate rowset!");
+    rowset->size = size;
+    rowset->fetched = 0;
+    rowset->next = 0;
+    rowset->done = false;
+    rowset->num_columns = num_columns;
+    rowset->status = cast(SQLUSMALLINT*, malloc(sizeof(SQLUSMALLINT) * size));
+    rowset->element_sizes = cast(SQLULEN*,
+        malloc(sizeof(SQLULEN) * num_columns)
+    );
+    rowset->buffers = cast(char**, calloc(num_columns, sizeof(char*)));
+    rowset->lengths = cast(SQLLEN**, calloc(num_columns, sizeof(SQLLEN*)));
+
+    // Put the handle in the statement first, so the GC frees it if a
+    // failure below means it never gets used.
+    //
+    rowset_value = rebHandle(rowset, sizeof(ROWSET), &cleanup_rowset);
+    rebElide("poke", statement, "'rowset", rebR(rowset_value));
+
+    if (
+        not rowset->status or not rowset->element_sizes
+        or not rowset->buffers or not rowset->lengths
+    ){
+        fail ("Couldn't allocate rowset!");
+    }
+
+    for (col_num = 0; col_num < num_columns; ++col_num) {
+        SQLULEN element_size = Rowset_Element_Size(&columns[col_num]);
+        rowset->element_sizes[col_num] = element_size;
+        rowset->buffers[col_num] = cast(char*, malloc(element_size * size));
+        rowset->lengths[col_num] = cast(SQLLEN*,
+            malloc(sizeof(SQLLEN) * size)
+        );
+        if (not rowset->buffers[col_num] or not rowset->lengths[col_num])
+            fail ("Couldn't allocate rowset!");
+    }
+
+    SQLRETURN rc = SQLSetStmtAttr(
+        hstmt,
+        SQL_ATTR_ROW_BIND_TYPE,
+        cast(SQLPOINTER, cast(uintptr_t, SQL_BIND_BY_COLUMN)),
+        0
+    );
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_ROW_ARRAY_SIZE,
+            cast(SQLPOINTER, cast(uintptr_t, size)),
+            0
+        );
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(
+            hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &rowset->fetched, 0
+        );
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(
+            hstmt, SQL_ATTR_ROW_STATUS_PTR, rowset->status, 0
+        );
+
+    for (col_num = 0; col_num < num_columns and SQL_SUCCEEDED(rc); ++col_num)
+        rc = SQLBindCol(
+            hstmt,
+            col_num + 1,
+            columns[col_num].c_type,
+            rowset->buffers[col_num],
+            rowset->element_sizes[col_num],
+            rowset->lengths[col_num]
+        );
+
+    if (not SQL_SUCCEEDED(rc)) {
+        REBVAL *error = Error_ODBC_Stmt(hstmt);
+        ODBC_DropRowset(statement, hstmt);
+        rebJumps ("fail", error);
+    }
+
+    return rowset;
+}
+
+
+//
+// Get the index in the rowset's arrays of the next row, fetching more rows
+// if it has given back all the ones it had.  Returns false at end of data.
+//
+static bool ODBC_Next_Rowset_Index(
+    ROWSET *rowset,
+    SQLHSTMT hstmt,
+    SQLULEN *index
+){
+    while (true) {
+        if (rowset->next == rowset->fetched) {
+            if (rowset->done)
+                return false;
+
+            rowset->fetched = 0;
+            rowset->next = 0;
+
+            SQLRETURN rc = SQLFetchScroll(hstmt, SQL_FETCH_NEXT, 0);
+            if (rc == SQL_NO_DATA) {
+                rowset->done = true;
+                return false;
+            }
+            if (not SQL_SUCCEEDED(rc))  // WITH_INFO, e.g. if one row failed
+                rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+            continue;
+        }
+
+        SQLULEN i = rowset->next++;
+        switch (rowset->status[i]) {
+          case SQL_ROW_SUCCESS:
+          case SQL_ROW_SUCCESS_WITH_INFO:
+            break;
+
+          case SQL_ROW_NOROW:
+            continue;
+
+          default:  // SQL_ROW_ERROR
+            rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+        }
+
+        *index = i;
+        return true;
+    }
+}
+
+
+//
+// A value bigger than what was bound gets cut off, and there's no getting
+// the rest from a block cursor.  (The terminator is counted in the bound
+// size of character data.)
+//
+static void Fail_If_Rowset_Truncated(
+    COLUMN *col,
+    SQLULEN element_size,
+    SQLLEN length
+){
+    if (length == SQL_NULL_DATA)
+        return;
+
+    SQLLEN room = element_size;
+    if (col->c_type == SQL_C_CHAR)
+        room -= 1;
+    else if (col->c_type == SQL_C_WCHAR)
+        room -= sizeof(WCHAR);
+
+    if (length == SQL_NO_TOTAL or length > room)
+        fail (
+            "Column value too long for the statement's BATCH"
+            " (use a BATCH of 1 to fetch it)"
+        );
+}
+
+
+//
+// Make the BLOCK! for the next row of the rowset.  Returns nullptr at the
+// end of data.
+//
+static REBVAL *ODBC_Next_Rowset_Row(
+    ROWSET *rowset,
+    SQLHSTMT hstmt,
+    COLUMN *columns
+){
+    SQLULEN i;
+    if (not ODBC_Next_Rowset_Index(rowset, hstmt, &i))
+        return nullptr;
+
+    REBVAL *record = rebValue("make block!", rebI(rowset->num_columns));
+
+    SQLSMALLINT col_num;
+    for (col_num = 0; col_num < rowset->num_columns; ++col_num) {
+        COLUMN *col = &columns[col_num];
+        SQLULEN element_size = rowset->element_sizes[col_num];
+        char *buffer = rowset->buffers[col_num] + i * element_size;
+        SQLLEN length = rowset->lengths[col_num][i];
+
+        Fail_If_Rowset_Truncated(col, element_size, length);
+
+        REBVAL *temp = ODBC_Cell_To_Rebol_Value(col, buffer, length);
+        rebElide("append", record, "quote", rebR(temp));
+    }
+
+    return record;
+}
+
+
 //
 //  export copy-odbc: native [
 //
@@ -1512,6 +2642,20 @@ REBNATIVE(copy_odbc)
     );
 
     SQLLEN row = 0;
+
+    ROWSET *rowset = ODBC_GetRowset(
+        ARG(statement), hstmt, columns, num_columns
+    );
+    if (rowset) {
+        for (; row != num_rows; ++row) {
+            REBVAL *record = ODBC_Next_Rowset_Row(rowset, hstmt, columns);
+            if (record == nullptr)
+                break;
+            rebElide("append", results, "quote", rebR(record));
+        }
+        return results;
+    }
+
     while (row != num_rows) {
 
         // This SQLFetch operation "fetches" the next row.  If we were using
@@ -1636,6 +2780,212 @@ REBNATIVE(copy_odbc)
 }
 
 
+//
+// For COPY-ODBC-COLUMNS, a column that's packed into a BINARY! rather than
+// being a BLOCK! of values.
+//
+typedef struct {
+    bool is_float;  // 64-bit floats, else 64-bit integers
+    char *data;  // rebAlloc()'d, given to a BINARY! with rebRepossess()
+    size_t capacity;  // in elements
+    REBVAL *nulls;  // BLOCK! of the row numbers that were NULL
+} PACKED_COLUMN;
+
+inline static bool Is_Packable_Column(COLUMN *col, bool *is_float) {
+    switch (col->c_type) {
+      case SQL_C_SLONG:
+      case SQL_C_ULONG:
+      case SQL_C_SBIGINT:
+      case SQL_C_UBIGINT:
+        *is_float = false;
+        return true;
+
+      case SQL_C_DOUBLE:
+        *is_float = true;
+        return true;
+
+      default:
+        return false;
+    }
+}
+
+
+//
+//  export copy-odbc-columns: native [
+//
+//  {Get result rows as columns, with numbers packed into VECTOR!s}
+//
+//      return: "For each column a VECTOR! or BLOCK!, then its NULL rows"
+//          [block!]
+//      statement [object!]
+//      /part "Most rows to get"
+//          [integer!]
+//  ]
+//
+REBNATIVE(copy_odbc_columns)
+//
+// COPY-ODBC makes a value for every cell, in a BLOCK! for every row.  That
+// is a lot of memory (and conversion) for a big numeric result.  This goes
+// through the same rowset, but copies integer columns straight out of the
+// bound arrays into a vector of 64-bit integers, and float columns into
+// one of 64-bit floats.  Any other column is a BLOCK! of its values.
+//
+// NULLs in a VECTOR! column are 0 (or NaN), and the row numbers they were
+// at are in a BLOCK! after it in the result.  A BLOCK! column has BLANK!
+// for each NULL, so what comes after it is BLANK!.
+//
+// The vectors are made with AS-VECTOR, so this needs the VECTOR extension.
+{
+    ODBC_INCLUDE_PARAMS_OF_COPY_ODBC_COLUMNS;
+
+    REBVAL *statement = ARG(statement);
+
+    REBVAL *hstmt_value = rebValue(
+        "ensure handle! pick", statement, "'hstmt"
+    );
+    SQLHSTMT hstmt = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(hstmt_value));
+    rebRelease(hstmt_value);
+
+    REBVAL *columns_value = rebValue(
+        "ensure handle! pick", statement, "'columns"
+    );
+    COLUMN *columns = VAL_HANDLE_POINTER(COLUMN, columns_value);
+    rebRelease(columns_value);
+
+    if (hstmt == SQL_NULL_HANDLE or not columns)
+        fail ("Invalid statement object!");
+
+    REBVAL *as_vector = rebValue("select lib 'as-vector");
+    if (not as_vector)
+        fail ("COPY-ODBC-COLUMNS needs the VECTOR extension");
+
+    SQLSMALLINT num_columns;
+    SQLRETURN rc = SQLNumResultCols(hstmt, &num_columns);
+    if (not SQL_SUCCEEDED(rc))
+        fail (Error_ODBC_Stmt(hstmt));
+
+    ROWSET *rowset = ODBC_GetRowset(statement, hstmt, columns, num_columns);
+    if (not rowset)
+        fail (
+            "COPY-ODBC-COLUMNS needs a statement BATCH over 1, and no LONG"
+            " columns (use COPY-ODBC)"
+        );
+
+    SQLLEN max_rows = rebUnbox("any [", REF(part), "-1]");  // -1 for all
+
+    // The rebAlloc()'d buffers and BLOCK!s are freed if there's a failure.
+    //
+    PACKED_COLUMN *packed = rebAllocN(PACKED_COLUMN, num_columns);
+    REBVAL **blocks = rebAllocN(REBVAL*, num_columns);
+
+    SQLSMALLINT col_num;
+    for (col_num = 0; col_num < num_columns; ++col_num) {
+        PACKED_COLUMN *p = &packed[col_num];
+        if (Is_Packable_Column(&columns[col_num], &p->is_float)) {
+            p->capacity = rowset->size;
+            p->data = rebAllocN(char, p->capacity * 8);
+            p->nulls = rebValue("copy []");
+            blocks[col_num] = nullptr;
+        }
+        else {
+            p->data = nullptr;
+            p->nulls = nullptr;
+            blocks[col_num] = rebValue("make block!", rebI(rowset->size));
+        }
+    }
+
+    REBLEN num_rows = 0;
+    SQLULEN i;
+    while (
+        cast(SQLLEN, num_rows) != max_rows
+        and ODBC_Next_Rowset_Index(rowset, hstmt, &i)
+    ){
+        for (col_num = 0; col_num < num_columns; ++col_num) {
+            COLUMN *col = &columns[col_num];
+            SQLULEN element_size = rowset->element_sizes[col_num];
+            char *buffer = rowset->buffers[col_num] + i * element_size;
+            SQLLEN length = rowset->lengths[col_num][i];
+
+            PACKED_COLUMN *p = &packed[col_num];
+            if (not p->data) {
+                Fail_If_Rowset_Truncated(col, element_size, length);
+                REBVAL *value = ODBC_Cell_To_Rebol_Value(col, buffer, length);
+                rebElide("append", blocks[col_num], "quote", rebR(value));
+                continue;
+            }
+
+            if (num_rows == p->capacity) {
+                p->capacity *= 2;
+                p->data = cast(char*, rebRealloc(p->data, p->capacity * 8));
+            }
+            char *out = p->data + num_rows * 8;
+
+            if (length == SQL_NULL_DATA) {
+                if (p->is_float) {
+                    double nan = NAN;
+                    memcpy(out, &nan, 8);
+                }
+                else
+                    memset(out, 0, 8);
+                rebElide("append", p->nulls, rebI(num_rows + 1));
+                continue;
+            }
+
+            int64_t i64;
+            switch (col->c_type) {
+              case SQL_C_SLONG:
+                i64 = *cast(SQLINTEGER*, buffer);
+                break;
+
+              case SQL_C_ULONG:
+                i64 = *cast(SQLUINTEGER*, buffer);
+                break;
+
+              case SQL_C_SBIGINT:
+                i64 = *cast(SQLBIGINT*, buffer);
+                break;
+
+              case SQL_C_UBIGINT:
+                if (*cast(SQLUBIGINT*, buffer) > INT64_MAX)
+                    fail ("INTEGER! can't hold some unsigned 64-bit values");
+                i64 = *cast(SQLUBIGINT*, buffer);
+                break;
+
+              default:
+                assert(col->c_type == SQL_C_DOUBLE);
+                memcpy(out, buffer, 8);  // SQLDOUBLE is a double
+                continue;
+            }
+            memcpy(out, &i64, 8);
+        }
+        ++num_rows;
+    }
+
+    REBVAL *results = rebValue("make block!", rebI(num_columns * 2));
+    for (col_num = 0; col_num < num_columns; ++col_num) {
+        PACKED_COLUMN *p = &packed[col_num];
+        if (p->data) {
+            REBVAL *binary = rebRepossess(p->data, num_rows * 8);
+            rebElide(
+                "append", results, "quote", as_vector,
+                    p->is_float ? "[decimal! 64]" : "[integer! 64]",
+                    rebR(binary)
+            );
+            rebElide("append", results, "quote", rebR(p->nulls));
+        }
+        else {
+            rebElide("append", results, "quote", rebR(blocks[col_num]));
+            rebElide("append", results, "quote _");
+        }
+    }
+
+    rebRelease(as_vector);
+    rebFree(blocks);
+    rebFree(packed);
+    return results;
+}
+
+
 //
 //  export update-odbc: native [
 //
@@ -1703,6 +3053,44 @@ REBNATIVE(close_statement)
 
     REBVAL *statement = ARG(statement);
 
+    REBVAL *hstmt_value = rebValue(
+        "ensure [<opt> handle!] pick", statement, "'hstmt"
+    );
+
+    // If the statement was prepared, its handle can go in the connection's
+    // cache (see PREPARED STATEMENT CACHE) once it's back to a clean state.
+    //
+    REBVAL *connection = nullptr;
+    STMT_CACHE *cache = nullptr;
+    REBINT limit = 0;
+    SQLWCHAR *sql_string = nullptr;
+    if (hstmt_value and rebDid("text? pick", statement, "'string")) {
+        connection = ODBC_StatementConnection(statement);
+        if (connection)
+            cache = ODBC_GetStmtCache(connection, &limit);
+    }
+    if (cache) {
+        SQLHSTMT hstmt = VAL_HANDLE_POINTER(SQLHSTMT, hstmt_value);
+        SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
+        SQLCloseCursor(hstmt);  // !!! check rc?
+        ODBC_DropRowset(statement, hstmt);
+        ODBC_ResetParamArrays(hstmt);
+
+        sql_string = rebSpellWide("pick", statement, "'string");
+    }
+    rebRelease(connection);  // nullptr is ok
+
+    REBVAL *rowset_value = rebValue(
+        "ensure [<opt> handle!] pick", statement, "'rowset"
+    );
+    if (rowset_value) {
+        cleanup_rowset(rowset_value);  // hstmt is freed below, no unbinding
+        SET_HANDLE_CDATA(rowset_value, nullptr);  // avoid GC cleanup
+        rebElide("poke", statement, "'rowset", "null");
+
+        rebRelease(rowset_value);
+    }
+
     REBVAL *columns_value = rebValue(
         "ensure [<opt> handle!] pick", statement, "'columns"
     );
@@ -1714,14 +3102,17 @@ REBNATIVE(close_statement)
         rebRelease(columns_value);
     }
 
-    REBVAL *hstmt_value = rebValue(
-        "ensure [<opt> handle!] pick", statement, "'hstmt"
-    );
     if (hstmt_value) {
         SQLHSTMT hstmt = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(hstmt_value));
         assert(hstmt);
 
-        SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+        if (cache) {
+            ODBC_CacheStmt(cache, limit, sql_string, hstmt);
+            rebFree(sql_string);
+        }
+        else
+            SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+        rebElide("poke", statement, "'string", "blank");
         SET_HANDLE_CDATA(hstmt_value, SQL_NULL_HANDLE);  // avoid GC cleanup
         rebElide("poke", statement, "'hstmt", "null");
 
@@ -1755,6 +3146,8 @@ REBNATIVE(close_connection)
         SQLHDBC hdbc = cast(SQLHDBC, VAL_HANDLE_VOID_POINTER(hdbc_value));
         assert(hdbc);
 
+        ODBC_ClearStmtCache(connection);
+
         SQLDisconnect(hdbc);
         SQLFreeHandle(SQL_HANDLE_DBC, hdbc);
         SET_HANDLE_CDATA(hdbc_value, SQL_NULL_HANDLE);  // avoid GC cleanup
@@ -44,8 +44,25 @@
 
 #include "sys-core.h"
 
+#include "sys-zlib.h"  // deflate() directly, for the level and threading
+
 #include "tmp-mod-png.h"
 
+// Threading is enabled by USE_PARALLEL_PNG in %systems.r, for platforms
+// that link with pthreads.
+//
+#if defined(USE_PARALLEL_PNG)
+    #define PARALLEL_PNG
+    #include <pthread.h>
+#endif
+
+#define MAX_PNG_THREADS 64
+
+// Row groups smaller than this aren't worth a thread of their own (the same
+// block size the parallel gzip "pigz" uses)
+//
+#define PNG_DEFLATE_GROUP_MIN (128 * 1024)
+
 
 //=//// CUSTOM SERIES-BACKED MEMORY ALLOCATOR /////////////////////////////=//
 //
@@ -112,6 +129,94 @@ static unsigned rebol_zlib_decompress(
     return 0;
 }
 
+// ENCODE-PNG's options for the compressor, passed via the custom_context.
+//
+struct Reb_Png_Deflate_Options {
+    int level;  // 0 (store) to 9 (smallest), or Z_DEFAULT_COMPRESSION
+    REBLEN threads;
+    size_t row_size;  // filtered scanline: filter type byte, then the pixels
+};
+
+
+// Each group of rows is deflated as its own raw stream.  All but the last
+// end with a sync flush instead of a final block, so the streams can just be
+// put end to end.  A group's window is primed with the 32K of input before
+// it, so matches across the seam aren't lost.  (This is how "pigz" works.)
+//
+// Streams are made on the calling thread with rebMalloc(), so a fail() frees
+// them.  deflate() allocates nothing after deflateInit2(), so the threads
+// touch no memory but their own.
+//
+struct Reb_Png_Deflate_Job {
+    z_stream strm;
+    const unsigned char *dict;  // input before the group, or nullptr
+    uInt dict_size;
+    const unsigned char *in;
+    size_t in_size;
+    bool last;
+    unsigned char *out;  // part of the shared output, `out_size` big
+    size_t out_size;
+    uLong adler;
+    int ret;
+};
+
+static void *zalloc(void *opaque, unsigned nr, unsigned size)
+{
+    UNUSED(opaque);
+    return rebMalloc(nr * size);
+}
+
+static void zfree(void *opaque, void *addr)
+{
+    UNUSED(opaque);
+    rebFree(addr);
+}
+
+static void Run_Png_Deflate_Job(struct Reb_Png_Deflate_Job *job)
+{
+    job->adler = adler32(adler32(0L, Z_NULL, 0), job->in, job->in_size);
+
+    if (job->dict) {
+        job->ret = deflateSetDictionary(&job->strm, job->dict, job->dict_size);
+        if (job->ret != Z_OK)
+            return;
+    }
+
+    job->strm.next_in = cast(const z_Bytef*, job->in);
+    job->strm.avail_in = job->in_size;
+    job->strm.next_out = job->out;
+    job->strm.avail_out = job->out_size;
+
+    int ret = deflate(&job->strm, job->last ? Z_FINISH : Z_SYNC_FLUSH);
+
+    bool done;
+    if (job->last)
+        done = (ret == Z_STREAM_END);
+    else  // a full output buffer might mean the flush isn't all there
+        done = (
+            ret == Z_OK
+            and job->strm.avail_in == 0 and job->strm.avail_out != 0
+        );
+
+    if (done)
+        job->ret = Z_OK;
+    else if (ret == Z_OK or ret == Z_STREAM_END)
+        job->ret = Z_BUF_ERROR;  // the deflateBound() wasn't enough
+    else
+        job->ret = ret;
+}
+
+#ifdef PARALLEL_PNG
+
+static void *Png_Deflate_Thread(void *job)
+{
+    Run_Png_Deflate_Job(cast(struct Reb_Png_Deflate_Job*, job));
+    return nullptr;
+}
+
+#endif
+
+
 static unsigned rebol_zlib_compress(
     unsigned char **out,
     size_t *outsize,
@@ -121,13 +226,151 @@ static unsigned rebol_zlib_compress(
 ){
     lodepng_free(*out); // see remarks in decompress, and about COMPRESS/INTO
 
-    assert(5 == *cast(const int*, settings->custom_context)); // just testing
-    UNUSED(settings->custom_context);
+    const struct Reb_Png_Deflate_Options *opts =
+        cast(const struct Reb_Png_Deflate_Options*, settings->custom_context);
+
+    // Split the rows into a group per thread, if they're big enough.
+    //
+    REBLEN num_jobs = 1;
+    size_t rows = 0;
+  #ifdef PARALLEL_PNG
+    if (opts->threads > 1 and insize % opts->row_size == 0) {
+        rows = insize / opts->row_size;
+        num_jobs = insize / PNG_DEFLATE_GROUP_MIN;
+        if (num_jobs > opts->threads)
+            num_jobs = opts->threads;
+        if (num_jobs > rows)
+            num_jobs = rows;
+        if (num_jobs < 1)
+            num_jobs = 1;
+    }
+  #endif
+
+    struct Reb_Png_Deflate_Job jobs[MAX_PNG_THREADS];
+    size_t total = 2 + 4;  // zlib envelope: 2 byte header, ADLER32 at tail
+
+    REBLEN i;
+    for (i = 0; i < num_jobs; ++i) {
+        struct Reb_Png_Deflate_Job *job = &jobs[i];
+
+        size_t lo = 0;
+        size_t hi = insize;
+        if (num_jobs > 1) {
+            lo = (rows * i / num_jobs) * opts->row_size;
+            hi = (rows * (i + 1) / num_jobs) * opts->row_size;
+        }
+        job->in = in + lo;
+        job->in_size = hi - lo;
+        job->last = (i == num_jobs - 1);
+
+        job->dict_size = lo < 32768 ? lo : 32768;
+        job->dict = job->dict_size != 0 ? in + lo - job->dict_size : nullptr;
+
+        job->strm.zalloc = &zalloc;  // fail() cleans up automatically
+        job->strm.zfree = &zfree;
+        job->strm.opaque = nullptr;
+
+        int ret_init = deflateInit2(
+            &job->strm,
+            opts->level,
+            Z_DEFLATED,
+            -(MAX_WBITS),  // raw, the zlib envelope is added below
+            8,
+            Z_DEFAULT_STRATEGY
+        );
+        if (ret_init != Z_OK)
+            fail (job->strm.msg ? job->strm.msg : "PNG deflateInit2() failed");
+
+        // deflateBound() is for a Z_FINISH, a sync flush adds an empty
+        // stored block (and deflate might need a byte to finish the last)
+        //
+        job->out_size = deflateBound(&job->strm, job->in_size) + 6;
+        total += job->out_size;
+    }
+
+    unsigned char *output = rebAllocN(unsigned char, total);
+    unsigned char *pos = output + 2;
+    for (i = 0; i < num_jobs; ++i) {
+        jobs[i].out = pos;
+        pos += jobs[i].out_size;
+    }
+
+    // The first job runs on the calling thread.  If a thread can't be
+    // started, its job runs here instead.
+    //
+  #ifdef PARALLEL_PNG
+    pthread_t threads[MAX_PNG_THREADS];
+    bool started[MAX_PNG_THREADS];
+
+    for (i = 1; i < num_jobs; ++i) {
+        int err = pthread_create(
+            &threads[i], nullptr, &Png_Deflate_Thread, &jobs[i]
+        );
+        started[i] = (err == 0);
+    }
+
+    Run_Png_Deflate_Job(&jobs[0]);
 
-    // PNG uses "zlib envelope" w/ADLER32 checksum, hence "Zdeflate"
+    for (i = 1; i < num_jobs; ++i) {
+        if (started[i])
+            pthread_join(threads[i], nullptr);
+        else
+            Run_Png_Deflate_Job(&jobs[i]);
+    }
+  #else
+    Run_Png_Deflate_Job(&jobs[0]);
+  #endif
+
+    // Put the streams end to end, and combine their checksums.
+    //
+    pos = output + 2;
+    uLong adler = adler32(0L, Z_NULL, 0);
+    for (i = 0; i < num_jobs; ++i) {
+        struct Reb_Png_Deflate_Job *job = &jobs[i];
+        if (job->ret != Z_OK)
+            fail (job->strm.msg ? job->strm.msg : "PNG deflate() failed");
+
+        size_t size = job->out_size - job->strm.avail_out;
+        memmove(pos, job->out, size);
+        pos += size;
+
+        adler = adler32_combine(adler, job->adler, job->in_size);
+        deflateEnd(&job->strm);
+    }
+
+    // Header of the zlib envelope is the deflate method with a 32K window,
+    // then a "level" hint, padded out so the 16-bit value divides by 31.
+    //
+    int flevel;
+    if (opts->level == Z_DEFAULT_COMPRESSION)
+        flevel = 2;
+    else if (opts->level < 2)
+        flevel = 0;
+    else if (opts->level < 6)
+        flevel = 1;
+    else if (opts->level == 6)
+        flevel = 2;
+    else
+        flevel = 3;
+
+    output[0] = 0x78;
+    output[1] = flevel << 6;
+    output[1] += 31 - ((output[0] << 8) + output[1]) % 31;
+
+    pos[0] = cast(unsigned char, adler >> 24);
+    pos[1] = cast(unsigned char, adler >> 16);
+    pos[2] = cast(unsigned char, adler >> 8);
+    pos[3] = cast(unsigned char, adler);
+    pos += 4;
+
+    *outsize = pos - output;
+
+    // !!! Trim if more than 1K extra capacity, as Compress_Alloc_Core() does
     //
-    *out = cast(unsigned char*, rebZdeflateAlloc(outsize, in, insize));
+    if (total - *outsize > 1024)
+        output = cast(unsigned char*, rebRealloc(output, *outsize));
 
+    *out = output;
     return 0;
 }
 
@@ -188,19 +431,11 @@ REBNATIVE(identify_png_q)
 }
 
 
+// LodePNG only decodes a whole PNG that is already in memory, so it's used
+// for a BINARY!.
 //
-//  decode-png: native [
-//
-//  {Codec for decoding BINARY! data for a PNG}
-//
-//      return: [image!]
-//      data [binary!]
-//  ]
-//
-REBNATIVE(decode_png)
+static REBVAL *Decode_Png_Bytes(const REBYTE *data, REBSIZ size)
 {
-    PNG_INCLUDE_PARAMS_OF_DECODE_PNG;
-
     LodePNGState state;
     lodepng_state_init(&state);
 
@@ -221,9 +456,6 @@ REBNATIVE(decode_png)
     state.info_png.color.colortype = LCT_RGBA;
     state.info_png.color.bitdepth = 8;
 
-    REBSIZ size;
-    const REBYTE *data = VAL_BINARY_SIZE_AT(&size, ARG(data));
-
     unsigned char* image_bytes;
     unsigned w;
     unsigned h;
@@ -264,6 +496,477 @@ REBNATIVE(decode_png)
 }
 
 
+//=//// STREAMING DECODE FROM A PORT! /////////////////////////////////////=//
+//
+// For a PORT!, the usual kind of PNG (8 bits per channel, not interlaced) is
+// decoded while it is READ a chunk at a time.  IDAT data is inflated as it
+// arrives, and each scanline is unfiltered and converted to RGBA right into
+// the image.  So the file and the pixels are never both in memory, nor is
+// all of the inflated data (which LodePNG holds alongside the other two).
+//
+// Other kinds of PNG read the rest of the file and go to LodePNG.  Errors
+// use LodePNG's codes, so they're reported the same either way.
+//
+//=////////////////////////////////////////////////////////////////////////=//
+
+#define PNG_READ_CHUNK 65536
+#define PNG_HEADER_SIZE 33  // signature, then the IHDR chunk
+
+struct Reb_Png_Reader {
+    const REBVAL *port;
+    REBYTE *buf;  // PNG_READ_CHUNK bytes
+    const REBYTE *at;
+    REBSIZ avail;
+};
+
+// Take up to `max` bytes from the reader (at least 1), READing if it has run
+// out.  The bytes are good until the next call.
+//
+static const REBYTE *Png_Take(
+    REBSIZ *got,
+    struct Reb_Png_Reader *r,
+    REBSIZ max
+){
+    if (r->avail == 0) {
+        r->avail = rebBytesInto(
+            r->buf, PNG_READ_CHUNK,
+            "read/part", r->port, rebI(PNG_READ_CHUNK)
+        );
+        r->at = r->buf;
+        if (r->avail == 0)
+            fail (lodepng_error_text(30));  // chunk broken off at end
+    }
+
+    *got = MIN(max, r->avail);
+    const REBYTE *bytes = r->at;
+    r->at += *got;
+    r->avail -= *got;
+    return bytes;
+}
+
+static void Png_Read(struct Reb_Png_Reader *r, REBYTE *dest, REBSIZ size)
+{
+    while (size != 0) {
+        REBSIZ got;
+        const REBYTE *bytes = Png_Take(&got, r, size);
+        if (dest) {
+            memcpy(dest, bytes, got);
+            dest += got;
+        }
+        size -= got;
+    }
+}
+
+inline static uint32_t Png_U32(const REBYTE *bytes) {
+    return (
+        (cast(uint32_t, bytes[0]) << 24) | (cast(uint32_t, bytes[1]) << 16)
+        | (cast(uint32_t, bytes[2]) << 8) | bytes[3]
+    );
+}
+
+// The five PNG filters predict each byte from the ones to its left (`bpp`
+// bytes back), above, and above-left.  `prior` is the previous unfiltered
+// row (all zero for the first).
+//
+static void Unfilter_Png_Row(
+    REBYTE *row,
+    const REBYTE *prior,
+    REBLEN size,
+    REBLEN bpp,
+    REBYTE filter
+){
+    REBLEN i;
+    switch (filter) {
+      case 0:  // None
+        break;
+
+      case 1:  // Sub
+        for (i = bpp; i < size; ++i)
+            row[i] += row[i - bpp];
+        break;
+
+      case 2:  // Up
+        for (i = 0; i < size; ++i)
+            row[i] += prior[i];
+        break;
+
+      case 3:  // Average
+        for (i = 0; i < bpp; ++i)
+            row[i] += prior[i] >> 1;
+        for (; i < size; ++i)
+            row[i] += (row[i - bpp] + prior[i]) >> 1;
+        break;
+
+      case 4:  // Paeth
+        for (i = 0; i < bpp; ++i)
+            row[i] += prior[i];
+        for (; i < size; ++i) {
+            int a = row[i - bpp];
+            int b = prior[i];
+            int c = prior[i - bpp];
+            int pa = abs(b - c);  // |p - a| where p = a + b - c
+            int pb = abs(a - c);
+            int pc = abs(a + b - c - c);
+            if (pa <= pb and pa <= pc)
+                row[i] += a;
+            else if (pb <= pc)
+                row[i] += b;
+            else
+                row[i] += c;
+        }
+        break;
+
+      default:
+        fail (lodepng_error_text(36));  // illegal filter type
+    }
+}
+
+struct Reb_Png_Stream {
+    unsigned w;
+    unsigned h;
+    LodePNGColorType colortype;
+    REBLEN bpp;  // bytes per pixel, 1 to 4 at 8 bits per channel
+    REBYTE palette[256 * 4];  // RGBA, black and opaque if not given
+    unsigned palette_size;
+    bool key_defined;  // tRNS color for gray or RGB that is transparent
+    unsigned key_r, key_g, key_b;
+
+    REBYTE *rows;  // two rows, each with the filter type byte in front
+    REBYTE *row;  // the one being inflated into
+    REBYTE *prior;  // the one before, unfiltered
+    REBLEN row_size;  // 1 + w * bpp
+    REBLEN filled;  // how much of `row` is inflated
+    unsigned y;  // rows finished
+
+    z_stream strm;
+    bool inflated;  // zlib stream is done
+
+    REBYTE *image_bytes;
+};
+
+static void Convert_Png_Row(struct Reb_Png_Stream *s, const REBYTE *in)
+{
+    REBYTE *out = s->image_bytes + cast(size_t, s->y) * s->w * 4;
+    unsigned x;
+
+    switch (s->colortype) {
+      case LCT_GREY:
+        for (x = 0; x < s->w; ++x, out += 4) {
+            out[0] = out[1] = out[2] = in[x];
+            out[3] = (s->key_defined and in[x] == s->key_r) ? 0 : 255;
+        }
+        break;
+
+      case LCT_RGB:
+        for (x = 0; x < s->w; ++x, in += 3, out += 4) {
+            out[0] = in[0];
+            out[1] = in[1];
+            out[2] = in[2];
+            out[3] = (
+                s->key_defined and in[0] == s->key_r
+                and in[1] == s->key_g and in[2] == s->key_b
+            ) ? 0 : 255;
+        }
+        break;
+
+      case LCT_PALETTE:
+        for (x = 0; x < s->w; ++x, out += 4)
+            memcpy(out, &s->palette[in[x] * 4], 4);
+        break;
+
+      case LCT_GREY_ALPHA:
+        for (x = 0; x < s->w; ++x, in += 2, out += 4) {
+            out[0] = out[1] = out[2] = in[0];
+            out[3] = in[1];
+        }
+        break;
+
+      case LCT_RGBA:
+        memcpy(out, in, cast(size_t, s->w) * 4);
+        break;
+
+      default:
+        assert(false);
+    }
+}
+
+// Inflate some IDAT data, finishing rows as they fill up.
+//
+static void Inflate_Png_Data(
+    struct Reb_Png_Stream *s,
+    const REBYTE *data,
+    REBSIZ size
+){
+    s->strm.next_in = cast(const z_Bytef*, data);
+    s->strm.avail_in = size;
+
+    while (s->strm.avail_in != 0 and not s->inflated) {
+        REBYTE extra;  // anything inflated after the last row is an error
+        if (s->y == s->h) {
+            s->strm.next_out = &extra;
+            s->strm.avail_out = 1;
+        }
+        else {
+            s->strm.next_out = s->row + s->filled;
+            s->strm.avail_out = s->row_size - s->filled;
+        }
+
+        int ret = inflate(&s->strm, Z_NO_FLUSH);
+        if (ret == Z_STREAM_END)
+            s->inflated = true;
+        else if (ret != Z_OK)
+            fail (s->strm.msg ? s->strm.msg : lodepng_error_text(52));
+
+        if (s->y == s->h) {
+            if (s->strm.avail_out == 0)
+                fail (lodepng_error_text(91));  // too much data
+            continue;
+        }
+
+        s->filled = s->row_size - s->strm.avail_out;
+        if (s->filled != s->row_size)
+            continue;
+
+        Unfilter_Png_Row(
+            s->row + 1, s->prior + 1, s->row_size - 1, s->bpp, s->row[0]
+        );
+        Convert_Png_Row(s, s->row + 1);
+        ++s->y;
+
+        REBYTE *temp = s->prior;  // this row is the prior for the next
+        s->prior = s->row;
+        s->row = temp;
+        s->filled = 0;
+    }
+}
+
+static REBVAL *Decode_Png_Port(const REBVAL *port)
+{
+    struct Reb_Png_Reader r;
+    r.port = port;
+    r.buf = rebAllocN(REBYTE, PNG_READ_CHUNK);
+    r.at = r.buf;
+    r.avail = 0;
+
+    REBYTE header[PNG_HEADER_SIZE];
+    REBSIZ header_size = 0;
+    while (header_size < PNG_HEADER_SIZE) {  // a READ/PART may come up short
+        REBSIZ got = rebBytesInto(
+            header + header_size, PNG_HEADER_SIZE - header_size,
+            "read/part", port, rebI(PNG_HEADER_SIZE - header_size)
+        );
+        if (got == 0)
+            break;
+        header_size += got;
+    }
+
+    LodePNGState state;
+    lodepng_state_init(&state);
+    unsigned w;
+    unsigned h;
+    unsigned error = lodepng_inspect(&w, &h, &state, header, header_size);
+    LodePNGColorType colortype = state.info_png.color.colortype;
+    unsigned bitdepth = state.info_png.color.bitdepth;
+    unsigned interlace = state.info_png.interlace_method;
+    lodepng_state_cleanup(&state);
+
+    if (error != 0)
+        fail (lodepng_error_text(error));
+
+    if (bitdepth != 8 or interlace != 0) {  // let LodePNG deal with it
+        size_t rest_size;
+        REBYTE *rest = rebBytes(&rest_size, "read", port);
+
+        REBSIZ size = PNG_HEADER_SIZE + rest_size;
+        REBYTE *data = rebAllocN(REBYTE, size);
+        memcpy(data, header, PNG_HEADER_SIZE);
+        memcpy(data + PNG_HEADER_SIZE, rest, rest_size);
+        rebFree(rest);
+        rebFree(r.buf);
+
+        REBVAL *image = Decode_Png_Bytes(data, size);
+        rebFree(data);
+        return image;
+    }
+
+    struct Reb_Png_Stream s;
+    s.w = w;
+    s.h = h;
+    s.colortype = colortype;
+    switch (colortype) {
+      case LCT_GREY: s.bpp = 1; break;
+      case LCT_RGB: s.bpp = 3; break;
+      case LCT_PALETTE: s.bpp = 1; break;
+      case LCT_GREY_ALPHA: s.bpp = 2; break;
+      default: s.bpp = 4; break;  // LCT_RGBA
+    }
+
+    unsigned i;
+    for (i = 0; i < 256; ++i) {
+        s.palette[i * 4 + 0] = 0;
+        s.palette[i * 4 + 1] = 0;
+        s.palette[i * 4 + 2] = 0;
+        s.palette[i * 4 + 3] = 255;
+    }
+    s.palette_size = 0;
+    s.key_defined = false;
+    s.key_r = s.key_g = s.key_b = 0;
+
+    uint64_t row_size = 1 + cast(uint64_t, w) * s.bpp;
+    uint64_t image_size = cast(uint64_t, w) * h * 4;
+    if (row_size > UINT32_MAX / 2 or image_size > UINT32_MAX)
+        fail (lodepng_error_text(77));  // integer overflow in buffer size
+
+    s.row_size = cast(REBLEN, row_size);
+    s.rows = rebAllocN(REBYTE, 2 * s.row_size);
+    memset(s.rows, 0, 2 * s.row_size);
+    s.row = s.rows;
+    s.prior = s.rows + s.row_size;
+    s.filled = 0;
+    s.y = 0;
+    s.image_bytes = rebAllocN(REBYTE, cast(size_t, image_size));
+
+    s.strm.zalloc = &zalloc;  // fail() cleans up automatically
+    s.strm.zfree = &zfree;
+    s.strm.opaque = nullptr;
+    s.strm.next_in = nullptr;
+    s.strm.avail_in = 0;
+    if (inflateInit(&s.strm) != Z_OK)
+        fail (s.strm.msg ? s.strm.msg : "PNG inflateInit() failed");
+    s.inflated = false;
+
+    // Chunks are a 4 byte length and type, the data, and a CRC of the type
+    // and data.  Like LodePNG, skip unknown chunks without checking CRCs.
+    //
+    while (true) {
+        REBYTE chunk[8];
+        Png_Read(&r, chunk, 8);
+
+        uint32_t length = Png_U32(chunk);
+        if (length > 0x7FFFFFFF)
+            fail (lodepng_error_text(63));
+
+        const REBYTE *type = chunk + 4;
+        uLong crc = crc32_z(0L, type, 4);
+
+        if (memcmp(type, "IDAT", 4) == 0) {
+            if (colortype == LCT_PALETTE and s.palette_size == 0)
+                fail (lodepng_error_text(106));  // PLTE must come first
+
+            while (length != 0) {
+                REBSIZ got;
+                const REBYTE *data = Png_Take(&got, &r, length);
+                crc = crc32_z(crc, data, got);
+                Inflate_Png_Data(&s, data, got);
+                length -= got;
+            }
+        }
+        else if (
+            memcmp(type, "PLTE", 4) == 0 or memcmp(type, "tRNS", 4) == 0
+            or memcmp(type, "IEND", 4) == 0
+        ){
+            REBYTE data[256 * 3];  // biggest a good PLTE or tRNS can be
+            if (length > sizeof(data))
+                fail (lodepng_error_text(
+                    type[0] == 'P' ? 38 : type[0] == 't' ? 39 : 30
+                ));
+            Png_Read(&r, data, length);
+            crc = crc32_z(crc, data, length);
+
+            if (type[0] == 'P') {
+                s.palette_size = length / 3;
+                if (s.palette_size == 0 or s.palette_size > 256)
+                    fail (lodepng_error_text(38));
+                for (i = 0; i < s.palette_size; ++i) {
+                    s.palette[i * 4 + 0] = data[i * 3 + 0];
+                    s.palette[i * 4 + 1] = data[i * 3 + 1];
+                    s.palette[i * 4 + 2] = data[i * 3 + 2];
+                    s.palette[i * 4 + 3] = 255;
+                }
+            }
+            else if (type[0] == 't') {
+                if (colortype == LCT_PALETTE) {
+                    if (length > s.palette_size)
+                        fail (lodepng_error_text(39));
+                    for (i = 0; i < length; ++i)
+                        s.palette[i * 4 + 3] = data[i];
+                }
+                else if (colortype == LCT_GREY) {
+                    if (length != 2)
+                        fail (lodepng_error_text(30));
+                    s.key_defined = true;
+                    s.key_r = s.key_g = s.key_b = 256u * data[0] + data[1];
+                }
+                else if (colortype == LCT_RGB) {
+                    if (length != 6)
+                        fail (lodepng_error_text(41));
+                    s.key_defined = true;
+                    s.key_r = 256u * data[0] + data[1];
+                    s.key_g = 256u * data[2] + data[3];
+                    s.key_b = 256u * data[4] + data[5];
+                }
+                else
+                    fail (lodepng_error_text(42));
+            }
+        }
+        else {
+            if (not (type[0] & 32))  // "critical" if the first letter is caps
+                fail (lodepng_error_text(69));
+            Png_Read(&r, nullptr, length + 4);  // skip data and CRC
+            continue;
+        }
+
+        REBYTE crc_bytes[4];
+        Png_Read(&r, crc_bytes, 4);
+        if (Png_U32(crc_bytes) != (crc & 0xFFFFFFFF))
+            fail (lodepng_error_text(57));
+
+        if (memcmp(type, "IEND", 4) == 0)
+            break;
+    }
+
+    if (s.y != s.h or not s.inflated)
+        fail (lodepng_error_text(91));  // not as much data as the image
+
+    inflateEnd(&s.strm);
+    rebFree(s.rows);
+    rebFree(r.buf);
+
+    REBVAL *binary = rebRepossess(s.image_bytes, cast(size_t, image_size));
+
+    return rebValue(
+        "make image! compose [",
+            "(make pair! [", rebI(w), rebI(h), "])",
+            rebR(binary),
+        "]"
+    );
+}
+
+
+//
+//  decode-png: native [
+//
+//  {Codec for decoding BINARY! data for a PNG}
+//
+//      return: [image!]
+//      data "A PORT! is read a chunk at a time instead of all at once"
+//          [binary! port!]
+//  ]
+//
+REBNATIVE(decode_png)
+{
+    PNG_INCLUDE_PARAMS_OF_DECODE_PNG;
+
+    if (IS_PORT(ARG(data)))
+        return Decode_Png_Port(ARG(data));
+
+    REBSIZ size;
+    const REBYTE *data = VAL_BINARY_SIZE_AT(&size, ARG(data));
+
+    return Decode_Png_Bytes(data, size);
+}
+
+
 //
 //  encode-png: native [
 //
@@ -271,14 +974,53 @@ REBNATIVE(decode_png)
 //
 //      return: [binary!]
 //      image [image!]
+//      /level "Compression from 0 (none) to 9 (smallest), default is 6"
+//          [integer!]
+//      /filter "NONE SUB UP AVERAGE PAETH, or MINSUM (default) or ENTROPY"
+//          [word!]
+//      /fast "Favor speed over size (level 1 and UP, unless given)"
+//      /threads "Deflate groups of rows on this many threads"
+//          [integer!]
 // ]
 //
 REBNATIVE(encode_png)
+//
+// The filter is applied to each row before compressing.  NONE through PAETH
+// use the same filter on every row, while MINSUM and ENTROPY try them all
+// and pick per row (so they're slower).  ENCODE/OPTIONS gives these, e.g.
+// `encode/options 'png image [fast: # threads: 4]`.
 {
     PNG_INCLUDE_PARAMS_OF_ENCODE_PNG;
 
     REBVAL *image = ARG(image);
 
+    struct Reb_Png_Deflate_Options opts;
+    opts.level = REF(fast) ? 1 : Z_DEFAULT_COMPRESSION;
+    if (REF(level)) {
+        opts.level = VAL_INT32(ARG(level));
+        if (opts.level < 0 or opts.level > 9)
+            fail (PAR(level));
+    }
+
+    LodePNGFilterStrategy filter = REF(fast) ? LFS_TWO : LFS_MINSUM;
+    if (REF(filter))
+        filter = cast(LodePNGFilterStrategy, rebUnboxInteger(
+            "switch", rebQ(ARG(filter)), "[",
+                "'none [0] 'sub [1] 'up [2] 'average [3] 'paeth [4]",
+                "'minsum [5] 'entropy [6]",  // LodePNGFilterStrategy order
+                "fail {ENCODE-PNG/FILTER must be NONE, SUB, UP, AVERAGE,",
+                    "PAETH, MINSUM, or ENTROPY}",
+            "]"
+        ));
+
+    opts.threads = 1;
+    if (REF(threads)) {
+        REBINT n = VAL_INT32(ARG(threads));
+        if (n < 1 or n > MAX_PNG_THREADS)
+            fail (PAR(threads));
+        opts.threads = n;
+    }
+
     // Historically, Rebol would write (key="Software" value="REBOL") into
     // image metadata.  Is that interesting?  If so, the state has fields for
     // this...assuming the encoder pays attention to them (the decoder does).
@@ -291,10 +1033,10 @@ REBNATIVE(encode_png)
     state.encoder.zlibsettings.custom_zlib = rebol_zlib_compress;
 
     // this is how to pass an arbitrary void* that custom zlib can access
-    // (so one could put dompression settings or state in there)
     //
-    int arg = 5;
-    state.encoder.zlibsettings.custom_context = &arg;
+    state.encoder.zlibsettings.custom_context = &opts;
+
+    state.encoder.filter_strategy = filter;
 
     // input format
     //
@@ -317,6 +1059,8 @@ REBNATIVE(encode_png)
     REBLEN height = rebUnboxInteger("pick", size, "'y");
     rebRelease(size);
 
+    opts.row_size = 1 + width * 4;  // filter type byte, then RGBA pixels
+
     size_t binsize;
     REBYTE *image_bytes = rebBytes(&binsize, "bytes of", image);
 
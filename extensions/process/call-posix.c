@@ -48,6 +48,17 @@
 #include <signal.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
+
+// posix_spawn() starts the child without copying the parent's page tables,
+// as fork() does (the bigger the interpreter's heap, the slower that is,
+// and under overcommit it can fail for lack of memory).  _POSIX_SPAWN comes
+// from <unistd.h> on systems that have it.
+//
+#if defined(_POSIX_SPAWN) && _POSIX_SPAWN > 0
+    #define USE_SPAWN
+    #include <spawn.h>
+#endif
+
 #if !defined(WIFCONTINUED) && defined(TO_ANDROID)
 // old version of bionic doesn't define WIFCONTINUED
 // https://android.googlesource.com/platform/bionic/+/c6043f6b27dc8961890fed12ddb5d99622204d6d%5E%21/#F0
@@ -107,6 +118,101 @@ static inline bool Set_Nonblocking_Fails(int fd) {
 }
 
 
+#if defined(USE_SPAWN)
+
+// Make one of the child's standard handles what the CALL asked for, as the
+// fork() branch of Call_Core() does it (pipe ends are close-on-exec, so the
+// ones the child doesn't dup2() close by themselves).
+//
+static int Spawn_Redirect(
+    posix_spawn_file_actions_t *actions,
+    const REBVAL *arg,  // from /INPUT, /OUTPUT, or /ERROR (nullptr if none)
+    int pipe_end,  // child's end of the pipe if there is one, else -1
+    int fd,  // STDIN_FILENO, STDOUT_FILENO, or STDERR_FILENO
+    int oflag  // for opening a FILE! (O_RDONLY or O_CREAT | O_WRONLY)
+){
+    if (pipe_end != -1)  // TEXT! or BINARY! (or CALL/PORTS)
+        return posix_spawn_file_actions_adddup2(actions, pipe_end, fd);
+
+    if (arg == nullptr or (IS_LOGIC(arg) and VAL_LOGIC(arg)))
+        return 0;  // inherit it from the parent
+
+    if (IS_FILE(arg)) {
+        char *local_utf8 = rebSpell("file-to-local", arg);
+        int ret = posix_spawn_file_actions_addopen(
+            actions, fd, local_utf8, oflag, 0666
+        );
+        rebFree(local_utf8);  // addopen() made its own copy
+        return ret;
+    }
+
+    assert(IS_LOGIC(arg));  // false, so /dev/null
+    return posix_spawn_file_actions_addopen(
+        actions, fd, "/dev/null", oflag & ~O_CREAT, 0
+    );
+}
+
+
+// Start the process with posix_spawnp().  Returns an errno (0 on success),
+// including for a program that couldn't be run.
+//
+static int Spawn_Process(
+    pid_t *pid,
+    bool shell,
+    int argc,
+    const char **argv,
+    const REBVAL *input, int stdin_end,
+    const REBVAL *output, int stdout_end,
+    const REBVAL *error, int stderr_end
+){
+    posix_spawn_file_actions_t actions;
+    int ret = posix_spawn_file_actions_init(&actions);
+    if (ret != 0)
+        return ret;
+
+    ret = Spawn_Redirect(&actions, input, stdin_end, STDIN_FILENO, O_RDONLY);
+    if (ret == 0)
+        ret = Spawn_Redirect(
+            &actions, output, stdout_end, STDOUT_FILENO, O_CREAT | O_WRONLY
+        );
+    if (ret == 0)
+        ret = Spawn_Redirect(
+            &actions, error, stderr_end, STDERR_FILENO, O_CREAT | O_WRONLY
+        );
+
+    if (ret == 0) {
+        char * const *argv_hack;  // see notes in Call_Core() on -Wcast-qual
+
+        if (shell) {
+            const char *sh = getenv("SHELL");
+            if (sh == nullptr)
+                sh = "sh";  // see notes in Call_Core()
+
+            const char **argv_new = rebAllocN(const char*, argc + 3);
+            argv_new[0] = sh;
+            argv_new[1] = "-c";
+            memcpy(&argv_new[2], argv, argc * sizeof(argv[0]));
+            argv_new[argc + 2] = nullptr;
+
+            memcpy(&argv_hack, &argv_new, sizeof(argv_hack));
+            ret = posix_spawnp(pid, sh, &actions, nullptr, argv_hack, environ);
+            rebFree(m_cast(char**, argv_new));
+        }
+        else {
+            memcpy(&argv_hack, &argv, sizeof(argv_hack));
+            ret = posix_spawnp(
+                pid, argv[0], &actions, nullptr, argv_hack, environ
+            );
+        }
+    }
+
+    posix_spawn_file_actions_destroy(&actions);
+    return ret;
+}
+
+#endif
+
+
 //
 //  Call_Core: C
 //
@@ -178,6 +284,19 @@ REB_R Call_Core(REBFRM *frame_) {
         or IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))
     );  // I/O redirection implies /WAIT
 
+    // CALL/PORTS reads stdout and stderr through ports as the process runs,
+    // so it can't wait for the process (or write it all of its input, which
+    // could block while the process blocks on output no one reads yet).
+    //
+    if (REF(ports)) {
+        if (
+            REF(wait) or REF(output) or REF(error)
+            or IS_TEXT(ARG(input)) or IS_BINARY(ARG(input))
+        ){
+            fail (Error_Bad_Refines_Raw());
+        }
+    }
+
     // We synthesize the argc and argv from the "command", and in the process
     // we do dynamic allocations of argc strings through the API.  These need
     // to be freed before we return.
@@ -277,6 +396,9 @@ REB_R Call_Core(REBFRM *frame_) {
     int stderr_pipe[] = {-1, -1};
     int info_pipe[] = {-1, -1};
 
+    REBVAL *output_port = nullptr;  // for CALL/PORTS
+    REBVAL *error_port = nullptr;
+
     pid_t forked_pid = -1;
 
     if (IS_TEXT(ARG(input)) or IS_BINARY(ARG(input))) {
@@ -284,12 +406,12 @@ REB_R Call_Core(REBFRM *frame_) {
             goto stdin_pipe_err;
     }
 
-    if (IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))) {
+    if (IS_TEXT(ARG(output)) or IS_BINARY(ARG(output)) or REF(ports)) {
         if (Open_Pipe_Fails(stdout_pipe))
             goto stdout_pipe_err;
     }
 
-    if (IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))) {
+    if (IS_TEXT(ARG(error)) or IS_BINARY(ARG(error)) or REF(ports)) {
         if (Open_Pipe_Fails(stderr_pipe))
             goto stdout_pipe_err;
     }
@@ -297,14 +419,28 @@ REB_R Call_Core(REBFRM *frame_) {
     if (Open_Pipe_Fails(info_pipe))
         goto info_pipe_err;
 
+  #if defined(USE_SPAWN)
+    ret = Spawn_Process(
+        &forked_pid,
+        did REF(shell),
+        argc,
+        argv,
+        REF(input), stdin_pipe[R],
+        REF(output), stdout_pipe[W],
+        REF(error), stderr_pipe[W]
+    );
+    if (ret != 0)
+        goto error;
+  #else
     forked_pid = fork();  // can't declare here (gotos cross initialization)
 
     if (forked_pid < 0) {  // error
         ret = errno;
         goto error;
     }
+  #endif
 
-    if (forked_pid == 0) {
+    if (forked_pid == 0) {  // only with fork(), Spawn_Process() did this
 
     //=//// CHILD BRANCH OF FORK() ////////////////////////////////////////=//
 
@@ -350,16 +486,16 @@ REB_R Call_Core(REBFRM *frame_) {
         else
             panic(ARG(input));
 
-        if (not REF(output)) {
-          inherit_stdout_from_parent:
-            NOOP;  // it's the default
-        }
-        else if (IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))) {
+        if (stdout_pipe[W] != -1) {  // TEXT! or BINARY! (or CALL/PORTS)
             close(stdout_pipe[R]);
             if (dup2(stdout_pipe[W], STDOUT_FILENO) < 0)
                 goto child_error;
             close(stdout_pipe[W]);
         }
+        else if (not REF(output)) {
+          inherit_stdout_from_parent:
+            NOOP;  // it's the default
+        }
         else if (IS_FILE(ARG(output))) {
             char *local_utf8 = rebSpell("file-to-local", ARG(output));
 
@@ -385,16 +521,16 @@ REB_R Call_Core(REBFRM *frame_) {
             close(fd);
         }
 
-        if (not REF(error)) {
-          inherit_stderr_from_parent:
-            NOOP;  // it's the default
-        }
-        else if (IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))) {
+        if (stderr_pipe[W] != -1) {  // TEXT! or BINARY! (or CALL/PORTS)
             close(stderr_pipe[R]);
             if (dup2(stderr_pipe[W], STDERR_FILENO) < 0)
                 goto child_error;
             close(stderr_pipe[W]);
         }
+        else if (not REF(error)) {
+          inherit_stderr_from_parent:
+            NOOP;  // it's the default
+        }
         else if (IS_FILE(ARG(error))) {
             char *local_utf8 = rebSpell("file-to-local", ARG(error));
 
@@ -523,6 +659,21 @@ REB_R Call_Core(REBFRM *frame_) {
         size_t outbuf_capacity = 0;
         size_t errbuf_capacity = 0;
 
+        // With CALL/PORTS the pipes are read by PIPE ports (in the event
+        // loop), not by the loop here.
+        //
+        if (REF(ports)) {
+            close(stdout_pipe[W]);
+            stdout_pipe[W] = -1;
+            close(stderr_pipe[W]);
+            stderr_pipe[W] = -1;
+
+            output_port = Make_Pipe_Port(stdout_pipe[R]);
+            stdout_pipe[R] = -1;  // the port closes it
+            error_port = Make_Pipe_Port(stderr_pipe[R]);
+            stderr_pipe[R] = -1;
+        }
+
         // Only put the input pipe in the consideration if we can write to
         // it and we have data to send to it.
 
@@ -933,8 +1084,21 @@ REB_R Call_Core(REBFRM *frame_) {
     if (inbuf != nullptr)
         rebFree(inbuf);
 
-    if (ret != 0)
+    if (ret != 0) {
+        if (output_port != nullptr)
+            rebElide("close", rebR(output_port));
+        if (error_port != nullptr)
+            rebElide("close", rebR(error_port));
         rebFail_OS (ret);
+    }
+
+    if (REF(ports)) {
+        return rebValue("make object! [",
+            "id:", rebI(forked_pid),
+            "output:", rebR(output_port),
+            "error:", rebR(error_port),
+        "]");
+    }
 
     if (REF(info)) {
         REBCTX *info = Alloc_Context(REB_OBJECT, 2);
@@ -957,3 +1121,362 @@ REB_R Call_Core(REBFRM *frame_) {
 
     return Init_Integer(D_OUT, forked_pid);
 }
+
+
+// What one command of a CALL-POOL has written to stdout or stderr so far.
+//
+struct Reb_Pool_Buf {
+    int fd;  // read end of the pipe, -1 once it's closed
+    char *data;  // rebAlloc()'d, so it can be rebRepossess()'d as a BINARY!
+    size_t used;
+    size_t capacity;
+};
+
+struct Reb_Pool_Job {
+    pid_t pid;  // 0 if not started yet, -1 once it has been reaped
+    int code;  // exit code, or negative number of the signal that ended it
+    struct Reb_Pool_Buf out;
+    struct Reb_Pool_Buf err;
+};
+
+
+// Read what is in the pipe without blocking, closing it at end of file (or
+// on an error, since there's no one to tell about it mid-pool).
+//
+static void Read_Pool_Pipe(struct Reb_Pool_Buf *buf)
+{
+    while (true) {
+        if (buf->used == buf->capacity) {
+            buf->capacity *= 2;
+            buf->data = cast(char*, rebRealloc(buf->data, buf->capacity));
+        }
+
+        ssize_t nbytes = read(
+            buf->fd, buf->data + buf->used, buf->capacity - buf->used
+        );
+        if (nbytes > 0) {
+            buf->used += nbytes;
+            continue;
+        }
+        if (nbytes < 0 and errno == EINTR)
+            continue;
+        if (nbytes < 0 and (errno == EAGAIN or errno == EWOULDBLOCK))
+            return;  // more may come
+
+        close(buf->fd);
+        buf->fd = -1;
+        return;
+    }
+}
+
+
+// Start the process for one command of a CALL-POOL.  Its stdin is /dev/null
+// (no two jobs should fight over the console), stdout and stderr are pipes.
+// Returns an errno (0 on success).
+//
+static int Start_Pool_Job(
+    struct Reb_Pool_Job *job,
+    const RELVAL *command,  // TEXT! for the shell, or BLOCK! of TEXT!
+    int null_fd
+){
+    const unsigned int R = 0;
+    const unsigned int W = 1;
+    int stdout_pipe[] = {-1, -1};
+    int stderr_pipe[] = {-1, -1};
+
+    bool shell = IS_TEXT(command);
+    int argc;
+    const char **argv;
+
+    if (shell) {
+        argc = 1;
+        argv = rebAllocN(const char*, 2);
+        argv[0] = rebSpell(SPECIFIC(command));
+    }
+    else {
+        const RELVAL *tail;
+        const RELVAL *item = VAL_ARRAY_AT(&tail, command);
+        argc = tail - item;
+        argv = rebAllocN(const char*, argc + 1);
+
+        int i;
+        for (i = 0; i < argc; ++i, ++item)
+            argv[i] = rebSpell(SPECIFIC(item));
+    }
+    argv[argc] = nullptr;
+
+    int ret = 0;
+    pid_t pid = -1;
+
+    if (
+        Open_Pipe_Fails(stdout_pipe) or Open_Pipe_Fails(stderr_pipe)
+        or Set_Nonblocking_Fails(stdout_pipe[R])
+        or Set_Nonblocking_Fails(stderr_pipe[R])
+    ){
+        ret = errno;
+        goto cleanup;
+    }
+
+  #if defined(USE_SPAWN)
+    ret = Spawn_Process(
+        &pid,
+        shell,
+        argc,
+        argv,
+        nullptr, null_fd,
+        nullptr, stdout_pipe[W],
+        nullptr, stderr_pipe[W]
+    );
+  #else
+    pid = fork();
+    if (pid < 0)
+        ret = errno;
+    else if (pid == 0) {  // child (only async-signal-safe calls from here)
+        if (
+            dup2(null_fd, STDIN_FILENO) < 0
+            or dup2(stdout_pipe[W], STDOUT_FILENO) < 0
+            or dup2(stderr_pipe[W], STDERR_FILENO) < 0
+        ){
+            _exit(127);
+        }
+
+        char * const *argv_hack;  // see notes in Call_Core() on -Wcast-qual
+        memcpy(&argv_hack, &argv, sizeof(argv_hack));
+
+        if (shell) {
+            const char *sh = getenv("SHELL");
+            if (sh == nullptr)
+                sh = "sh";
+            execlp(sh, sh, "-c", argv[0], cast(char*, nullptr));
+        }
+        else
+            execvp(argv[0], argv_hack);
+
+        _exit(127);  // as a shell reports a command it couldn't run
+    }
+  #endif
+
+    if (ret == 0) {
+        job->pid = pid;
+
+        job->out.fd = stdout_pipe[R];
+        stdout_pipe[R] = -1;
+        job->out.capacity = BUF_SIZE_CHUNK;
+        job->out.data = rebAllocN(char, job->out.capacity);
+
+        job->err.fd = stderr_pipe[R];
+        stderr_pipe[R] = -1;
+        job->err.capacity = BUF_SIZE_CHUNK;
+        job->err.data = rebAllocN(char, job->err.capacity);
+    }
+
+  cleanup:
+
+    if (stdout_pipe[R] != -1)
+        close(stdout_pipe[R]);
+    if (stdout_pipe[W] != -1)  // child has its own copy
+        close(stdout_pipe[W]);
+    if (stderr_pipe[R] != -1)
+        close(stderr_pipe[R]);
+    if (stderr_pipe[W] != -1)
+        close(stderr_pipe[W]);
+
+    int i;
+    for (i = 0; i != argc; ++i)
+        rebFree(m_cast(char*, argv[i]));
+    rebFree(m_cast(char**, argv));
+
+    return ret;
+}
+
+
+// Reap a job whose pipes are both closed, if its process has exited (it
+// usually has, but a process may close its output and keep running).
+//
+static bool Reaped_Pool_Job(struct Reb_Pool_Job *job, int flags, int *ret)
+{
+    int status;
+    pid_t xpid = waitpid(job->pid, &status, flags);
+    if (xpid == 0)
+        return false;  // still running
+
+    if (xpid < 0) {  // e.g. ECHILD if SIGCHLD is ignored
+        if (errno == EINTR)
+            return false;
+        *ret = errno;
+        job->code = -1;
+    }
+    else if (WIFEXITED(status))
+        job->code = WEXITSTATUS(status);
+    else if (WIFSIGNALED(status))
+        job->code = - WTERMSIG(status);
+    else
+        return false;  // stopped or continued, it's not done
+
+    job->pid = -1;
+    return true;
+}
+
+
+//
+//  Call_Pool_Core: C
+//
+// Run the commands of CALL-POOL, starting a new process each time one ends
+// so no more than `limit` run at once.  All of their pipes are polled in
+// one loop, like the loop in Call_Core() does for a single process.
+//
+// !!! The event extension's Reap_Process() would reap any child here (it
+// waits on -1), so jobs are reaped by their own pid instead.  Nothing runs
+// the event loop during the pool, so the two can't take each other's exits.
+//
+REB_R Call_Pool_Core(REBFRM *frame_) {
+    PROCESS_INCLUDE_PARAMS_OF_CALL_POOL_INTERNAL_P;
+
+    REBINT limit = VAL_INT32(ARG(limit));
+    if (limit < 1)
+        fail (PAR(limit));
+
+    // Check everything before anything starts, since failing once processes
+    // are running would leave them to run unattended.
+    //
+    const RELVAL *tail;
+    const RELVAL *commands = VAL_ARRAY_AT(&tail, ARG(commands));
+    REBLEN num_jobs = tail - commands;
+
+    const RELVAL *command;
+    for (command = commands; command != tail; ++command) {
+        if (IS_TEXT(command))
+            continue;
+        if (not IS_BLOCK(command) or VAL_LEN_AT(command) == 0)
+            fail (PAR(commands));
+
+        const RELVAL *arg_tail;
+        const RELVAL *arg = VAL_ARRAY_AT(&arg_tail, command);
+        for (; arg != arg_tail; ++arg)
+            if (not IS_TEXT(arg))  // usermode layer ensures FILE! converted
+                fail (PAR(commands));
+    }
+
+    if (num_jobs == 0)
+        return rebValue("copy []");
+
+    int null_fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    if (null_fd < 0)
+        rebFail_OS (errno);
+
+    struct Reb_Pool_Job *jobs = rebAllocN(struct Reb_Pool_Job, num_jobs);
+    memset(jobs, 0, num_jobs * sizeof(struct Reb_Pool_Job));
+
+    REBLEN max_fds = 2 * MIN(cast(REBLEN, limit), num_jobs);
+    struct pollfd *pfds = rebAllocN(struct pollfd, max_fds);
+    struct Reb_Pool_Buf **bufs = rebAllocN(struct Reb_Pool_Buf*, max_fds);
+
+    int ret = 0;
+    REBLEN next = 0;  // next job to start
+    REBLEN first = 0;  // jobs before this have all been reaped
+    REBINT running = 0;
+
+    while (running > 0 or (ret == 0 and next < num_jobs)) {
+        while (ret == 0 and next < num_jobs and running < limit) {
+            ret = Start_Pool_Job(&jobs[next], &commands[next], null_fd);
+            if (ret != 0)
+                break;  // no more get started, but let running ones finish
+            ++next;
+            ++running;
+        }
+
+        nfds_t nfds = 0;
+        bool lingering = false;  // a job that's closed its pipes but not done
+
+        REBLEN n;
+        for (n = first; n < next; ++n) {
+            struct Reb_Pool_Job *job = &jobs[n];
+            if (job->pid <= 0)
+                continue;
+
+            if (job->out.fd != -1) {
+                pfds[nfds].fd = job->out.fd;
+                pfds[nfds].events = POLLIN;
+                bufs[nfds++] = &job->out;
+            }
+            if (job->err.fd != -1) {
+                pfds[nfds].fd = job->err.fd;
+                pfds[nfds].events = POLLIN;
+                bufs[nfds++] = &job->err;
+            }
+            if (job->out.fd == -1 and job->err.fd == -1) {
+                if (Reaped_Pool_Job(job, WNOHANG, &ret))
+                    --running;
+                else
+                    lingering = true;
+            }
+        }
+
+        while (first < next and jobs[first].pid == -1)
+            ++first;
+
+        if (nfds == 0 and not lingering)
+            continue;  // reaped all there were, start more (or finish)
+
+        if (poll(pfds, nfds, lingering ? 10 : -1) < 0) {
+            if (errno == EINTR)
+                continue;
+
+            // Can't watch the pipes, so there's no way to finish the jobs.
+            //
+            ret = errno;
+            for (n = first; n < next; ++n) {
+                struct Reb_Pool_Job *job = &jobs[n];
+                if (job->pid <= 0)
+                    continue;
+                kill(job->pid, SIGKILL);
+                if (job->out.fd != -1)
+                    close(job->out.fd);
+                if (job->err.fd != -1)
+                    close(job->err.fd);
+                job->out.fd = job->err.fd = -1;
+                while (not Reaped_Pool_Job(job, 0, &ret))
+                    NOOP;
+            }
+            running = 0;
+            break;
+        }
+
+        nfds_t i;
+        for (i = 0; i < nfds; ++i) {
+            if (pfds[i].revents != 0)  // POLLIN, POLLHUP, POLLERR...
+                Read_Pool_Pipe(bufs[i]);
+        }
+    }
+
+    close(null_fd);
+    rebFree(pfds);
+    rebFree(bufs);
+
+    if (ret != 0) {
+        REBLEN n;
+        for (n = 0; n < next; ++n) {
+            rebFree(jobs[n].out.data);
+            rebFree(jobs[n].err.data);
+        }
+        rebFree(jobs);
+        rebFail_OS (ret);
+    }
+
+    REBVAL *results = rebValue("make block!", rebI(3 * num_jobs));
+
+    REBLEN n;
+    for (n = 0; n < num_jobs; ++n) {
+        struct Reb_Pool_Job *job = &jobs[n];
+        REBVAL *out = rebRepossess(job->out.data, job->out.used);
+        REBVAL *err = rebRepossess(job->err.data, job->err.used);
+        rebElide(
+            "append", results, "reduce [",
+                rebI(job->code), rebR(out), rebR(err),
+            "]"
+        );
+    }
+
+    rebFree(jobs);
+    return results;
+}
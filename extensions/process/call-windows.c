@@ -289,6 +289,9 @@ REB_R Call_Core(REBFRM *frame_) {
 
     UNUSED(REF(info));
 
+    if (REF(ports))
+        fail ("CALL/PORTS is not implemented on Windows yet");
+
     char *inbuf = nullptr;
     size_t inbuf_size = 0;
     char *outbuf = nullptr;
@@ -746,3 +749,19 @@ REB_R Call_Core(REBFRM *frame_) {
 
     return Init_Integer(D_OUT, pid);
 }
+
+
+//
+//  Call_Pool_Core: C
+//
+// !!! Would need WaitForMultipleObjects() on the processes and overlapped
+// reads of their pipes, which the Windows CALL doesn't do yet.
+//
+REB_R Call_Pool_Core(REBFRM *frame_) {
+    PROCESS_INCLUDE_PARAMS_OF_CALL_POOL_INTERNAL_P;
+
+    UNUSED(ARG(commands));
+    UNUSED(ARG(limit));
+
+    fail ("CALL-POOL is not implemented on Windows yet");
+}
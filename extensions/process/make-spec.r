@@ -13,7 +13,7 @@ depends: switch system-config/os-base [
         [%process/call-windows.c]
     ]
 ] else [
-    [%process/call-posix.c]
+    [%process/call-posix.c %process/pipe-posix.c]
 ]
 
 includes: copy [
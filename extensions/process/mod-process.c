@@ -90,6 +90,7 @@
 //          [text! binary! file! logic!]
 //      /error "Redirects stderr (false=/dev/null, true=inherit)"
 //          [text! binary! file! logic!]
+//      /ports "Return object with PIPE ports to READ stdout and stderr from"
 //  ]
 //
 REBNATIVE(call_internal_p)
@@ -101,6 +102,46 @@ REBNATIVE(call_internal_p)
 }
 
 
+//
+//  export call-pool-internal*: native [
+//
+//  {Run commands in parallel processes, at most LIMIT at a time}
+//
+//      return: "Exit code, stdout BINARY!, and stderr BINARY! per command"
+//          [block!]
+//      commands "Each a TEXT! (run by the shell) or BLOCK! of TEXT! argv[]"
+//          [block!]
+//      limit "Most processes to run at once"
+//          [integer!]
+//  ]
+//
+REBNATIVE(call_pool_internal_p)
+{
+    return Call_Pool_Core(frame_);
+}
+
+
+//
+//  export get-pipe-actor-handle: native [
+//
+//  {Retrieve handle to the native actor for CALL/PORTS pipes}
+//
+//      return: [handle!]
+//  ]
+//
+REBNATIVE(get_pipe_actor_handle)
+{
+  #if defined(TO_WINDOWS)
+    fail ("PIPE ports are not implemented on Windows yet");
+  #else
+    OS_Register_Device(&Dev_Pipe);
+
+    Make_Port_Actor_Handle(D_OUT, &Pipe_Actor);
+    return D_OUT;
+  #endif
+}
+
+
 //
 //  export get-os-browsers: native [
 //
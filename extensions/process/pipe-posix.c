@@ -0,0 +1,229 @@
+//
+//  File: %pipe-posix.c
+//  Summary: "Ports to read a CALL'd process's output as it runs"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// CALL/PORTS gives back the read ends of the child's stdout and stderr pipes
+// as ports of the `pipe` scheme, instead of gathering all of the output into
+// a TEXT! or BINARY! before returning.  They act like a TCP port that only
+// reads:
+//
+// * READ returns the port right away.  When some output arrives it is added
+//   to the tail of `port/data`, and the port's awake gets a `read` event.
+//
+// * When the child closes its end (usually by exiting), there's a `close`
+//   event and the port is closed.
+//
+// The reading happens in WAIT, which watches the pipe like a socket (see
+// OS_Watch_Request()), so many processes can be run and read at once.
+//
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "sys-core.h"
+
+#include "reb-process.h"
+
+#define PIPE_BUF_SIZE (32 * 1024)  // how much to make room for on each READ
+
+
+static void Close_Pipe_Fd(REBREQ *pipe)
+{
+    struct rebol_devreq *req = Req(pipe);
+
+    OS_Unwatch_Request(pipe);  // before the fd number can be reused
+    close(req->requestee.id);
+    req->requestee.id = -1;
+    req->flags &= ~RRF_OPEN;
+}
+
+
+//
+//  Read_Pipe: C
+//
+// Add what the pipe has to port/data.  Pends (watching the fd) if the child
+// hasn't written anything yet.
+//
+DEVICE_CMD Read_Pipe(REBREQ *pipe)
+{
+    struct rebol_devreq *req = Req(pipe);
+    REBVAL *port = CTX_ARCHETYPE(CTX(MISC(ReqPortCtx, pipe)));
+
+    REBBIN *bin = VAL_BINARY_KNOWN_MUTABLE(req->common.binary);
+    if (SER_AVAIL(bin) < PIPE_BUF_SIZE)
+        Extend_Series(bin, PIPE_BUF_SIZE - SER_AVAIL(bin));
+
+    REBLEN old_len = BIN_LEN(bin);
+    ssize_t result = read(
+        req->requestee.id, BIN_AT(bin, old_len), SER_AVAIL(bin)
+    );
+
+    if (result < 0) {
+        if (errno == EAGAIN or errno == EWOULDBLOCK or errno == EINTR) {
+            OS_Watch_Request(pipe, req->requestee.id, RRF_WANT_READ);
+            return DR_PEND;
+        }
+
+        // As with network ports, an error here can't be raised at the READ
+        // (this runs in the event loop, after the READ returned).
+        //
+        int errnum = errno;
+        Close_Pipe_Fd(pipe);
+        rebElide(
+            "(", port, ")/error:", rebR(rebError_OS(errnum)),
+            "insert system/ports/system make event! [",
+                "type: 'error",
+                "port:", port,
+            "]"
+        );
+        return DR_DONE;
+    }
+
+    OS_Unwatch_Request(pipe);
+
+    if (result == 0) {  // the child closed its end, or exited
+        Close_Pipe_Fd(pipe);
+        rebElide(
+            "insert system/ports/system make event! [",
+                "type: 'close",
+                "port:", port,
+            "]"
+        );
+        return DR_DONE;
+    }
+
+    TERM_BIN_LEN(bin, old_len + result);
+    req->actual = result;
+
+    rebElide(
+        "insert system/ports/system make event! [",
+            "type: 'read",
+            "port:", port,
+        "]"
+    );
+    return DR_DONE;
+}
+
+
+static DEVICE_CMD_CFUNC Dev_Cmds[RDC_MAX] = {
+    0,
+    0,
+    0,  // RDC_OPEN (Make_Pipe_Port() opens them)
+    0,  // RDC_CLOSE (done directly, see Pipe_Actor())
+    Read_Pipe,
+    0,  // RDC_WRITE
+    0
+};
+
+DEFINE_DEV(
+    Dev_Pipe, "Pipe", 1, Dev_Cmds, RDC_MAX, sizeof(struct rebol_devreq)
+);
+
+
+//
+//  Make_Pipe_Port: C
+//
+// Make a `pipe` port that owns the read end `fd` of a pipe.
+//
+REBVAL *Make_Pipe_Port(int fd)
+{
+    int flags = fcntl(fd, F_GETFL);
+    if (flags < 0 or fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+        rebFail_OS (errno);
+
+    REBVAL *port = rebValue("make port! [scheme: 'pipe]");
+
+    REBREQ *pipe = Force_Get_Port_State(port, &Dev_Pipe);
+    struct rebol_devreq *req = Req(pipe);
+    req->requestee.id = fd;
+    req->flags |= RRF_OPEN;
+
+    return port;
+}
+
+
+//
+//  Pipe_Actor: C
+//
+REB_R Pipe_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
+{
+    REBCTX *ctx = VAL_CONTEXT(port);
+    REBVAL *port_data = CTX_VAR(ctx, STD_PORT_DATA);
+
+    REBREQ *pipe = Force_Get_Port_State(port, &Dev_Pipe);
+    struct rebol_devreq *req = Req(pipe);
+
+    switch (VAL_WORD_ID(verb)) {
+      case SYM_REFLECT: {
+        INCLUDE_PARAMS_OF_REFLECT;
+
+        UNUSED(ARG(value));  // covered by `port`
+        if (VAL_WORD_ID(ARG(property)) == SYM_OPEN_Q)
+            return Init_Logic(D_OUT, did (req->flags & RRF_OPEN));
+
+        break; }
+
+      case SYM_READ: {
+        INCLUDE_PARAMS_OF_READ;
+
+        UNUSED(PAR(source));
+        UNUSED(PAR(string));  // handled in dispatcher
+        UNUSED(PAR(lines));  // handled in dispatcher
+
+        if (REF(part) or REF(seek))
+            fail (Error_Bad_Refines_Raw());
+
+        if (not (req->flags & RRF_OPEN))
+            fail (Error_On_Port(SYM_NOT_OPEN, port, -12));
+
+        if (not IS_BINARY(port_data)) {  // output is added to what's there
+            GC_Write_Barrier(CTX_VARLIST(ctx));
+            Init_Binary(port_data, Make_Binary(PIPE_BUF_SIZE));
+        }
+
+        req->common.binary = port_data;
+        req->actual = 0;
+
+        REBVAL *result = OS_DO_DEVICE(pipe, RDC_READ);
+        if (result != nullptr) {  // nullptr means pending
+            if (rebDid("error?", result))
+                rebJumps("fail", result);
+            rebRelease(result);
+        }
+
+        RETURN (port); }
+
+      case SYM_CLOSE: {
+        INCLUDE_PARAMS_OF_CLOSE;
+        UNUSED(PAR(port));
+
+        if (req->flags & RRF_OPEN) {
+            OS_Abort_Device(pipe);  // a pending READ can't finish now
+            Close_Pipe_Fd(pipe);
+        }
+        RETURN (port); }
+
+      default:
+        break;
+    }
+
+    return R_UNHANDLED;
+}
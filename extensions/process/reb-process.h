@@ -59,3 +59,10 @@ inline static void Fail_No_Process(const REBVAL *arg) {
 #define BUF_SIZE_CHUNK 4096
 
 REB_R Call_Core(REBFRM *frame_);
+REB_R Call_Pool_Core(REBFRM *frame_);
+
+#if !defined(TO_WINDOWS)
+    extern REBDEV Dev_Pipe;  // see %pipe-posix.c
+    extern REBVAL *Make_Pipe_Port(int fd);
+    extern REB_R Pipe_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb);
+#endif
@@ -42,6 +42,7 @@ static void update(REBREQ *signal, REBINT len, REBVAL *arg)
     const REBYTE source_uid[] = "source-uid";
 
     Extend_Series(VAL_SERIES_KNOWN_MUTABLE(arg), len);
+    GC_Write_Barrier(VAL_SERIES(arg));  // the objects are new, it may be old
 
     for (i = 0; i < len; i ++) {
         REBCTX *obj = Alloc_Context(REB_OBJECT, 8);
@@ -228,8 +229,10 @@ static REB_R Signal_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         OS_DO_DEVICE_SYNC(signal, RDC_READ);
 
         arg = CTX_VAR(ctx, STD_PORT_DATA);
-        if (!IS_BLOCK(arg))
+        if (!IS_BLOCK(arg)) {
+            GC_Write_Barrier(CTX_VARLIST(ctx));
             Init_Block(arg, Make_Array(len));
+        }
 
         len = req->actual;
 
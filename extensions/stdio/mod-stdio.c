@@ -31,6 +31,7 @@ EXTERN_C REBDEV Dev_StdIO;
 
 
 extern REB_R Console_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb);
+extern void Flush_Stdout(void);
 
 //
 //  get-console-actor-handle: native [
@@ -120,7 +121,7 @@ static void Prin_OS_String(const REBYTE *utf8, REBSIZ size, REBFLGS opts)
         //
         if (size <= 1024)
             req->length = size;
-        else if (not (opts & OPT_ENC_RAW))
+        else if (opts & OPT_ENC_RAW)
             req->length = 1024;
         else {
             // Correct for UTF-8 batching so we don't span an encoded
@@ -212,3 +213,18 @@ REBNATIVE(write_stdout)
 
     return Init_None(D_OUT);
 }
+
+
+//
+//  export flush-stdout: native [
+//
+//  "Write out any standard output that is being held in a buffer"
+//
+//      return: []
+//  ]
+//
+REBNATIVE(flush_stdout)
+{
+    Flush_Stdout();
+    return Init_None(D_OUT);
+}
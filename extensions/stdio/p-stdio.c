@@ -29,6 +29,7 @@
 #include "sys-core.h"
 
 EXTERN_C REBDEV Dev_StdIO;
+extern void Flush_Stdout(void);
 
 #include "readline.h"
 
@@ -385,6 +386,10 @@ REB_R Console_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         //
         return rebValue("copy", data, "elide clear", data); }
 
+      case SYM_FLUSH:  // output isn't through this port, but shares stdio
+        Flush_Stdout();
+        RETURN (port);
+
       case SYM_OPEN:
         Req(req)->flags |= RRF_OPEN;
         RETURN (port);
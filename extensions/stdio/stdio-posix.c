@@ -32,6 +32,7 @@
 //
 #include "sys-core.h"
 
+#include <stdlib.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <unistd.h>
@@ -49,8 +50,72 @@ static int Std_Out = STDOUT_FILENO;
 #endif
 
 
+// Output that isn't going to the smart console is gathered in Out_Buf, so a
+// script that PRINTs a million lines doesn't make a million write() calls.
+// When stdout is a terminal the buffer is written at each newline, so lines
+// show up as they're printed.  Otherwise (a pipe or file) it's written when
+// it fills up.  It is also written before reading stdin (e.g. for a prompt
+// from ASK), by FLUSH-STDOUT, and at exit.
+//
+#define OUT_BUF_SIZE (64 * 1024)
+static REBYTE Out_Buf[OUT_BUF_SIZE];  // static, so usable from atexit()
+static size_t Out_Used = 0;
+static bool Out_Line_Buffered = true;  // set by Open_IO()
+
+
+// Returns an errno, or 0 if all of the data got written.
+//
+static int Write_All(const REBYTE *data, size_t size)
+{
+    while (size > 0) {
+        ssize_t total = write(Std_Out, data, size);
+        if (total < 0) {
+            if (errno == EINTR)
+                continue;
+            return errno;
+        }
+        data += total;
+        size -= total;
+    }
+    return 0;
+}
+
+
+static int Write_Out_Buf(void)
+{
+    size_t used = Out_Used;
+    Out_Used = 0;  // if it fails, don't try to write it again at exit
+    return Write_All(Out_Buf, used);
+}
+
+
+static void Flush_Stdout_At_Exit(void)
+{
+    if (Std_Out >= 0)
+        Write_Out_Buf();  // nowhere to report an error now
+}
+
+
+//
+//  Flush_Stdout: C
+//
+// Write out whatever output is waiting in the buffer.
+//
+void Flush_Stdout(void)
+{
+    if (Std_Out < 0 or Out_Used == 0)
+        return;
+
+    int errnum = Write_Out_Buf();
+    if (errnum != 0)
+        rebFail_OS (errnum);
+}
+
+
 static void Close_Stdio(void)
 {
+    Flush_Stdout_At_Exit();
+
   #if defined(REBOL_SMART_CONSOLE)
     if (Term_IO) {
         Quit_Terminal(Term_IO);
@@ -92,6 +157,11 @@ DEVICE_CMD Open_IO(REBREQ *io)
     }
 
     if (not (req->modes & RDM_NULL)) {
+        Out_Line_Buffered = isatty(Std_Out);
+
+        static bool registered = false;  // in case of exit() without QUIT
+        if (not registered)
+            registered = (atexit(&Flush_Stdout_At_Exit) == 0);
 
       #if defined(REBOL_SMART_CONSOLE)
         if (isatty(Std_Inp))  // is termios-capable (not redirected to a file)
@@ -166,12 +236,26 @@ DEVICE_CMD Write_IO(REBREQ *io)
         else
       #endif
         {
-            long total = write(Std_Out, req->common.data, req->length);
-
-            if (total < 0)
-                rebFail_OS(errno);
-
-            assert(cast(size_t, total) == req->length);
+            const REBYTE *data = req->common.data;
+            size_t size = req->length;
+
+            if (size > OUT_BUF_SIZE - Out_Used) {
+                Flush_Stdout();
+                if (size >= OUT_BUF_SIZE) {  // no point copying it
+                    int errnum = Write_All(data, size);
+                    if (errnum != 0)
+                        rebFail_OS (errnum);
+                    size = 0;
+                }
+            }
+
+            if (size > 0) {
+                memcpy(Out_Buf + Out_Used, data, size);
+                Out_Used += size;
+
+                if (Out_Line_Buffered and memchr(data, '\n', size))
+                    Flush_Stdout();
+            }
         }
         req->actual = req->length;
     }
@@ -215,6 +299,8 @@ DEVICE_CMD Read_IO(REBREQ *io)
 
     req->actual = 0;
 
+    Flush_Stdout();  // e.g. the prompt from ASK has to show before we wait
+
     total = read(Std_Inp, BIN_HEAD(bin), len);  // restarts on signal
     if (total < 0)
         rebFail_OS (errno);
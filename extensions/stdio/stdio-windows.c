@@ -372,6 +372,17 @@ DEVICE_CMD Read_IO(REBREQ *io)
 }
 
 
+//
+//  Flush_Stdout: C
+//
+// !!! Output to a redirected stdout isn't buffered on Windows yet (see the
+// POSIX version), Write_IO() writes each request as it comes.
+//
+void Flush_Stdout(void)
+{
+}
+
+
 /***********************************************************************
 **
 **  Command Dispatch Table (RDC_ enum order)
@@ -90,7 +90,7 @@ int tcc_set_lib_path_i(TCCState *s, const char *path)
 // dispatcher being used, these fields are used by "user natives"
 
 #define IDX_TCC_NATIVE_LINKNAME \
-    IDX_NATIVE_MAX // generated if the native doesn't specify
+    IDX_NATIVE_MAX // BLANK! if generated by COMPILE (see Spell_Linkname())
 
 #define IDX_TCC_NATIVE_STATE \
     IDX_TCC_NATIVE_LINKNAME + 1 // will be a BLANK! until COMPILE happens
@@ -231,11 +231,216 @@ static void Add_API_Symbol_Helper(
 static void cleanup(const REBVAL *val)
 {
     TCCState *state = VAL_HANDLE_POINTER(TCCState, val);
-    assert(state != nullptr);
+    if (state == nullptr)
+        return;  // was deleted early (see Compile_Via_Cache())
     tcc_delete(state);
 }
 
 
+// Allocate a TCC state that is freed by the GC, in case of a fail().  The
+// handle has to be guarded by the caller.
+//
+static TCCState *Make_Managed_State(REBVAL *handle)
+{
+    TCCState *state = tcc_new();
+    if (not state)
+        fail ("TCC failed to create a TCC context");
+
+    // !!! It seems that getting an "invalid object file" error (e.g. by
+    // using a Windows libtcc1.a on Linux) causes a leak.  It may be an error
+    // in usage of the API, or TCC itself may leak in that case.  Review.
+    //
+    Init_Handle_Cdata_Managed(
+        handle,
+        state, // "data" pointer
+        1,  // unused length (can't be 0, reserved for CFUNC)
+        cleanup // called upon GC
+    );
+
+    void* opaque = cast(void*, EMPTY_BLOCK); // can parameterize the error...
+    tcc_set_error_func(state, opaque, &Error_Reporting_Hook);
+
+    return state;
+}
+
+
+// Apply the compiler settings from COMPILE's config to a state.  This has to
+// be done before tcc_set_output_type() (see notes in COMPILE*).
+//
+static void Configure_State(TCCState *state, const REBVAL *config)
+{
+    // Sets options (same syntax as the TCC command line, minus commands like
+    // displaying the version or showing the TCC tool's help)
+    //
+    Process_Block_Helper(tcc_set_options_i, state, config, "options");
+
+    // Add include paths (same as `-I` in the options?)
+    //
+    Process_Block_Helper(tcc_add_include_path, state, config, "include-path");
+
+    // Though it is called `tcc_set_lib_path()`, it says it sets CONFIG_TCCDIR
+    // at runtime of the built code, presumably so libtcc1.a can be found.
+    //
+    // !!! This doesn't seem to help Windows find the libtcc1.a file, so it's
+    // not clear what the call does.  The higher-level COMPILE goes ahead and
+    // sets the runtime path as an ordinary lib directory on Windows for the
+    // moment, since this seems to be a no-op there.  :-/
+    //
+    Process_Text_Helper(tcc_set_lib_path_i, state, config, "runtime-path");
+}
+
+
+// User natives that weren't given a /LINKNAME are named by their position in
+// the COMPILE (not by something like their address), so the same script
+// generates the same source on every run...which lets the cache find it.
+//
+static char *Spell_Linkname(const REBVAL *linkname, REBLEN num)
+{
+    if (IS_BLANK(linkname))
+        return rebSpell("unspaced [{N_}", rebI(num), "]");
+    return rebSpell("ensure text!", linkname);
+}
+
+
+//=//// COMPILE CACHE /////////////////////////////////////////////////////=//
+//
+// Compiling is most of the time COMPILE takes, and a script making user
+// natives would pay it on every run.  If COMPILE is given a `cache-path`,
+// the combined source is compiled to a relocatable object file there, named
+// by a hash of that source, the config (options, include paths...) and the
+// interpreter's version and build.  Later runs add that object file to the
+// in-memory state with tcc_add_file(), so only the linking is done again.
+//
+// Keeping objects instead of DLLs means they are linked just like a fresh
+// compile is: the libRebol symbols are still the ones given by
+// tcc_add_symbol(), which a DLL loaded from disk could not see on Windows.
+//
+// !!! Cache files are never removed (nor the .tmp files of compiles that had
+// errors).  Since all the inputs are in the hash, a stale file just goes
+// unused--it is safe to delete the directory.
+//
+
+static uint64_t Hash_Bytes(uint64_t hash, const char *utf8, size_t size)
+{
+    size_t i;
+    for (i = 0; i < size; ++i) {  // FNV-1a
+        hash ^= cast(unsigned char, utf8[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+
+//
+//  Compile_Via_Cache: C
+//
+// Add the object file for the source in the mold buffer to `state`, compiling
+// it first if it is not in the cache.  Returns false if there is no usable
+// cache, and the source should just be compiled into `state` normally.
+//
+// (The source is not passed as a pointer, since rebSpell("mold" ...) uses the
+// mold buffer too and may move it.)
+//
+static bool Compile_Via_Cache(
+    TCCState *state,
+    const REBVAL *config,
+    REB_MOLD *mo
+){
+    if (rebNot("text? pick", config, "'cache-path"))
+        return false;
+
+    uint64_t hash = Hash_Bytes(
+        14695981039346656037ULL,  // FNV-1a offset basis
+        cs_cast(BIN_AT(mo->series, mo->offset)),
+        STR_SIZE(mo->series) - mo->offset
+    );
+
+    size_t key_size;
+    unsigned char *key = rebBytes(&key_size,
+        "mold reduce [", config, "system/version system/build system/commit]"
+    );
+    hash = Hash_Bytes(hash, cs_cast(key), key_size);
+    rebFree(key);
+
+    char hex[16 + 1];
+    int i;
+    for (i = 15; i >= 0; --i) {
+        hex[i] = "0123456789abcdef"[hash & 0xF];
+        hash >>= 4;
+    }
+    hex[16] = '\0';
+
+    char *path_utf8 = rebSpell(  // cache-path is local, and ends in a slash
+        "unspaced [pick", config, "'cache-path", rebT(hex), "{.o}]"
+    );
+    REBVAL *path = rebValue("local-to-file", rebT(path_utf8));
+
+    if (rebNot("exists?", path)) {
+        //
+        // The object is written under a temporary name and then renamed, so
+        // another process running the same script never sees half a file.
+        // The state's address is just to make the name unique.
+        //
+        REBVAL *temp = rebValue(
+            "local-to-file unspaced [",
+                rebT(path_utf8), "{.} to-hex", rebI(cast(intptr_t, state)),
+                "{.tmp}",
+            "]"
+        );
+
+        if (rebDid("error? trap [write", temp, "#{}]")) {  // can't write
+            rebRelease(temp);
+            rebRelease(path);
+            rebFree(path_utf8);
+            return false;  // compile without the cache
+        }
+
+        DECLARE_LOCAL (obj_handle);
+        TCCState *obj_state = Make_Managed_State(obj_handle);
+        PUSH_GC_GUARD(obj_handle);
+
+        Configure_State(obj_state, config);
+        if (tcc_set_output_type(obj_state, TCC_OUTPUT_OBJ) < 0)
+            fail ("TCC failed to set output to OBJ");
+
+        if (
+            tcc_compile_string(
+                obj_state,
+                cs_cast(BIN_AT(mo->series, mo->offset))
+            ) < 0
+        ){
+            fail ("TCC failed to compile the code");
+        }
+
+        char *temp_utf8 = rebSpell("file-to-local", temp);
+        if (tcc_output_file(obj_state, temp_utf8) < 0)
+            fail ("TCC failed to output the object file to the cache");
+        rebFree(temp_utf8);
+
+        tcc_delete(obj_state);  // don't wait for the GC, states are big
+        SET_HANDLE_CDATA(obj_handle, nullptr);
+        DROP_GC_GUARD(obj_handle);
+
+        // If another process cached the same thing first, the rename may
+        // fail (e.g. on Windows)...but then the file is there anyway.
+        //
+        rebElide(
+            "trap [rename", temp, path, "] then [attempt [delete", temp, "]]"
+        );
+        rebRelease(temp);
+    }
+
+    int status = tcc_add_file(state, path_utf8);
+    rebRelease(path);
+    rebFree(path_utf8);
+
+    if (status < 0)
+        fail ("TCC failed to add the cached object file");
+
+    return true;
+}
+
+
 //
 //  Pending_Native_Dispatcher: C
 //
@@ -349,16 +554,9 @@ REBNATIVE(make_native)
         }
     }
     else {
-        // Auto-generate a linker name based on the numeric value of the
-        // paramlist pointer.  Just "N_" followed by the hexadecimal value.
-
-        intptr_t heapaddr = cast(intptr_t, details);
-        REBVAL *linkname = rebValue(
-            "unspaced [{N_} as text! to-hex", rebI(heapaddr), "]"
-        );
-
-        Copy_Cell(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME), linkname);
-        rebRelease(linkname);
+        // COMPILE generates a linker name like "N_1" (see Spell_Linkname())
+        //
+        Init_Blank(ARR_AT(details, IDX_TCC_NATIVE_LINKNAME));
     }
 
     Init_Blank(ARR_AT(details, IDX_TCC_NATIVE_STATE)); // no TCC_State, yet...
@@ -394,52 +592,19 @@ REBNATIVE(compile_p)
     // natives to be able to execute, as this is where their ACT_DISPATCHER()
     // pointers are located.  The GCC manages it via handle (see cleanup())
     //
-    TCCState *state = tcc_new();
-    if (not state)
-        fail ("TCC failed to create a TCC context");
-
     // We go ahead and put the state into a managed HANDLE!, so that the GC
     // can clean up the memory in the case of a fail().
     //
-    // !!! It seems that getting an "invalid object file" error (e.g. by
-    // using a Windows libtcc1.a on Linux) causes a leak.  It may be an error
-    // in usage of the API, or TCC itself may leak in that case.  Review.
-    //
     DECLARE_LOCAL (handle);
-    Init_Handle_Cdata_Managed(
-        handle,
-        state, // "data" pointer
-        1,  // unused length (can't be 0, reserved for CFUNC)
-        cleanup // called upon GC
-    );
+    TCCState *state = Make_Managed_State(handle);
     PUSH_GC_GUARD(handle);
 
-    void* opaque = cast(void*, EMPTY_BLOCK); // can parameterize the error...
-    tcc_set_error_func(state, opaque, &Error_Reporting_Hook);
-
 
   //=//// SET UP OPTIONS FOR THE TCC STATE FROM CONFIG ////////////////////=//
 
     REBVAL *config = ARG(config);
 
-    // Sets options (same syntax as the TCC command line, minus commands like
-    // displaying the version or showing the TCC tool's help)
-    //
-    Process_Block_Helper(tcc_set_options_i, state, config, "options");
-
-    // Add include paths (same as `-I` in the options?)
-    //
-    Process_Block_Helper(tcc_add_include_path, state, config, "include-path");
-
-    // Though it is called `tcc_set_lib_path()`, it says it sets CONFIG_TCCDIR
-    // at runtime of the built code, presumably so libtcc1.a can be found.
-    //
-    // !!! This doesn't seem to help Windows find the libtcc1.a file, so it's
-    // not clear what the call does.  The higher-level COMPILE goes ahead and
-    // sets the runtime path as an ordinary lib directory on Windows for the
-    // moment, since this seems to be a no-op there.  :-/
-    //
-    Process_Text_Helper(tcc_set_lib_path_i, state, config, "runtime-path");
+    Configure_State(state, config);
 
     // The output_type has to be set *before* you all tcc_output_file() or
     // tcc_relocate(), but has to be set *after* you've configured the
@@ -513,7 +678,10 @@ REBNATIVE(compile_p)
 
                 REBARR *details = ACT_DETAILS(VAL_ACTION(item));
                 RELVAL *source = ARR_AT(details, IDX_NATIVE_BODY);
-                RELVAL *linkname = ARR_AT(details, IDX_TCC_NATIVE_LINKNAME);
+                char *linkname_utf8 = Spell_Linkname(
+                    DETAILS_AT(details, IDX_TCC_NATIVE_LINKNAME),
+                    DSP - dsp_orig
+                );
 
                 // !!! REBFRM is not exported by libRebol, though it could be
                 // opaquely...and there could be some very narrow routines for
@@ -527,7 +695,8 @@ REBNATIVE(compile_p)
                 // https://forum.rebol.info/t/817
                 //
                 Append_Ascii(mo->series, "const REBVAL *");
-                Append_String(mo->series, linkname);
+                Append_Utf8(mo->series, linkname_utf8, strsize(linkname_utf8));
+                rebFree(linkname_utf8);
                 Append_Ascii(mo->series, "(void *frame_)\n{");
 
                 Append_String(mo->series, source);
@@ -565,6 +734,12 @@ REBNATIVE(compile_p)
         }
 
         if (
+            output_type == TCC_OUTPUT_MEMORY
+            and Compile_Via_Cache(state, config, mo)
+        ){
+            // object file from the cache was added to the state
+        }
+        else if (
             tcc_compile_string(
                 state,
                 cs_cast(BIN_AT(mo->series, mo->offset))
@@ -656,15 +831,16 @@ REBNATIVE(compile_p)
         REBARR *details = ACT_DETAILS(action);
         REBVAL *linkname = DETAILS_AT(details, IDX_TCC_NATIVE_LINKNAME);
 
-        char *name_utf8 = rebSpell("ensure text!", linkname);
+        char *name_utf8 = Spell_Linkname(linkname, DSP - dsp_orig);
         void *sym = tcc_get_symbol(state, name_utf8);
-        rebFree(name_utf8);
 
         if (not sym)
             rebJumps ("fail [",
-                "{TCC failed to find symbol:}", linkname,
+                "{TCC failed to find symbol:}", rebT(name_utf8),
             "]");
 
+        rebFree(name_utf8);
+
         // Circumvent ISO C++ forbidding cast between function/data pointers
         //
         REBNAT c_func;
@@ -0,0 +1,52 @@
+REBOL [
+    Title: {TCC Auto-Nativize Test}
+    Description: {
+        NATIVIZE translates simple numeric functions to C and compiles them
+        with TCC.  AUTO-NATIVIZE does that once a function has been called
+        enough times with the same argument types, and goes back to the
+        original function if it gets called with other types.
+    }
+]
+
+sum-squares: func [n [integer!]] [
+    let total: 0
+    count-up i n [total: total + (i * i)]
+    return total
+]
+c-sum-squares: nativize :sum-squares [integer!]
+assert [(sum-squares 100) = c-sum-squares 100]
+
+clamp: func [x [decimal!] lo [decimal!] hi [decimal!]] [
+    if x < lo [return lo]
+    if x > hi [return hi]
+    return x
+]
+c-clamp: nativize :clamp [decimal! decimal! decimal!]
+assert [0.0 = c-clamp -1.5 0.0 1.0]
+assert [0.5 = c-clamp 0.5 0.0 1.0]
+assert [1.0 = c-clamp 2.5 0.0 1.0]
+
+square: func [x [integer!]] [return x * x]
+c-square: nativize :square [integer!]
+e: trap [c-square 9223372036854775807]
+assert [all [error? e, e/id = 'overflow]]  ; same error the interpreter gives
+
+assert [error? trap [nativize func [s [text!]] [return s] [integer!]]]
+
+scale: func [x [integer! decimal!]] [return x * 2]
+tier: auto-nativize/threshold :scale 5
+
+assert [blank? tier/native]
+count-up i 5 [assert [(i * 2) = scale i]]
+assert [action? :tier/native]
+assert [20 = scale 10]
+
+assert [3.0 = scale 1.5]  ; different type, goes back to the original
+assert [1 = tier/deopts]
+assert [blank? tier/native]
+
+count-up i 5 [assert [(i * 2.0) = scale to decimal! i]]
+assert [action? :tier/native]  ; compiled again, for DECIMAL!
+assert [5.0 = scale 2.5]
+
+print "TCC auto-nativize test passed"
@@ -0,0 +1,49 @@
+REBOL [
+    Title: {TCC Compile Cache Test}
+    Description: {
+        COMPILE with a `cache-path` writes an object file for the code it
+        compiles, and a later COMPILE of the same code adds that file to the
+        TCC state instead of compiling again.  Natives that don't give a
+        /LINKNAME get names by their position in the COMPILE, so two natives
+        made from the same source in different runs share an object file.
+    }
+]
+
+cache: join what-dir %tcc-cache-test/
+if exists? cache [
+    for-each file read cache [delete join cache file]
+]
+
+make-adder: func [] [
+    make-native [
+        "Add two integers"
+        a [integer!]
+        b [integer!]
+    ]{
+        return rebInteger(
+            rebUnboxInteger(rebArgR("a")) + rebUnboxInteger(rebArgR("b"))
+        );
+    }
+]
+
+c-add-1: make-adder
+compile/settings [c-add-1] compose [cache-path (cache)]
+
+files: read cache
+assert [1 = length of files]
+assert [%.o = suffix-of first files]
+modified: modified? join cache first files
+
+c-add-2: make-adder
+compile/settings [c-add-2] compose [cache-path (cache)]
+
+assert [files = read cache]  ; same object file was used
+assert [modified = modified? join cache first files]
+
+assert [3 = c-add-1 1 2]
+assert [30 = c-add-2 10 20]
+
+for-each file read cache [delete join cache file]
+delete cache
+
+print "TCC compile cache test passed"
@@ -131,3 +131,84 @@ REBNATIVE(now)
 
     return D_OUT;
 }
+
+
+//
+//  export format-dates: native [
+//
+//  {Format DATE!s as ISO 8601 text, one per line (e.g. to timestamp logs)}
+//
+//      return: [text!]
+//      dates [block!]
+//      /precise "Include microseconds"
+//  ]
+//
+REBNATIVE(format_dates)
+//
+// Mapping a usermode formatter over each date would make several strings for
+// every one.  This writes all of them into the mold buffer, and makes one.
+// Times are given in the date's own zone, with its offset (or Z for UTC).
+{
+    TIME_INCLUDE_PARAMS_OF_FORMAT_DATES;
+
+    REBSPC *specifier = VAL_SPECIFIER(ARG(dates));
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    DECLARE_LOCAL (d);
+
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, ARG(dates));
+    for (; item != tail; ++item) {
+        if (not IS_DATE(item)) {
+            Drop_Mold(mo);
+            fail (Error_Bad_Value_Core(item, specifier));
+        }
+
+        Derelativize(d, item, specifier);
+        int zone = Does_Date_Have_Zone(d) ? VAL_ZONE(d) : NO_DATE_ZONE;
+        Fold_Zone_Into_Date(d);
+
+        Append_Int_Pad(mo->series, VAL_YEAR(d), 4);
+        Append_Codepoint(mo->series, '-');
+        Append_Int_Pad(mo->series, VAL_MONTH(d), 2);
+        Append_Codepoint(mo->series, '-');
+        Append_Int_Pad(mo->series, VAL_DAY(d), 2);
+
+        if (Does_Date_Have_Time(d)) {
+            REB_TIMEF tf;
+            Split_Time(VAL_NANO(d), &tf);
+
+            Append_Codepoint(mo->series, 'T');
+            Append_Int_Pad(mo->series, tf.h, 2);
+            Append_Codepoint(mo->series, ':');
+            Append_Int_Pad(mo->series, tf.m, 2);
+            Append_Codepoint(mo->series, ':');
+            Append_Int_Pad(mo->series, tf.s, 2);
+
+            if (REF(precise)) {
+                Append_Codepoint(mo->series, '.');
+                Append_Int_Pad(mo->series, tf.n / 1000, 6);
+            }
+
+            if (zone == 0)
+                Append_Codepoint(mo->series, 'Z');
+            else if (zone != NO_DATE_ZONE) {
+                if (zone < 0) {
+                    Append_Codepoint(mo->series, '-');
+                    zone = -zone;
+                }
+                else
+                    Append_Codepoint(mo->series, '+');
+                Append_Int_Pad(mo->series, zone / 4, 2);
+                Append_Codepoint(mo->series, ':');
+                Append_Int_Pad(mo->series, (zone & 3) * 15, 2);
+            }
+        }
+
+        Append_Codepoint(mo->series, '\n');
+    }
+
+    return Init_Text(D_OUT, Pop_Molded_String(mo));
+}
@@ -60,6 +60,21 @@
 
 
 
+// Working out the zone takes a localtime() and two mktime()s, and glibc's
+// localtime() may stat() /etc/localtime each time to see if it changed.
+// That's most of the cost of NOW.  But the offset only changes at daylight
+// savings transitions (which are on quarter hours) or if TZ is changed.  So
+// the last answer is reused for the rest of its quarter hour, so long as TZ
+// is the same.
+//
+#define ZONE_CACHE_SECS (15 * 60)
+#define ZONE_CACHE_TZ_MAX 128
+
+static time_t zone_cache_quarter = -1;  // now_secs / ZONE_CACHE_SECS
+static int zone_cache_minutes;
+static char zone_cache_tz[ZONE_CACHE_TZ_MAX];  // TZ at the time, "" if unset
+
+
 //
 //  Get_Timezone: C
 //
@@ -73,11 +88,25 @@
 // !!! This code is currently repeated in the filesystem extension, until a
 // better way of sharing it is accomplished.
 //
-static int Get_Timezone(struct tm *utc_tm_unused)
+static int Get_Timezone(time_t now_secs)
 {
-    time_t now_secs;
-    time(&now_secs); // UNIX seconds (since "epoch")
-    struct tm local_tm = *localtime(&now_secs);
+    const char *tz = getenv("TZ");
+    if (tz == nullptr)
+        tz = "";
+    bool cacheable = (strlen(tz) < ZONE_CACHE_TZ_MAX);
+
+    if (
+        cacheable
+        and now_secs / ZONE_CACHE_SECS == zone_cache_quarter
+        and strcmp(tz, zone_cache_tz) == 0
+    ){
+        return zone_cache_minutes;
+    }
+
+    tzset();  // localtime_r() isn't required to notice a change of TZ
+
+    struct tm local_tm;
+    localtime_r(&now_secs, &local_tm);
 
   #if !defined(HAS_SMART_TIMEZONE)
     //
@@ -99,15 +128,19 @@ static int Get_Timezone(struct tm *utc_tm_unused)
     // Then the time zone can be calculated by diffing it from a mktime()
     // inversion of a suitable local time.
     //
-    // !!! For some reason, R3-Alpha expected the caller to pass in a utc tm
-    // structure pointer but then didn't use it, choosing to make another call
-    // to gmtime().  Review.
-    //
-    UNUSED(utc_tm_unused);
-    time_t now_secs_gm = mktime(gmtime(&now_secs));
+    struct tm utc_tm;
+    gmtime_r(&now_secs, &utc_tm);
+    time_t now_secs_gm = mktime(&utc_tm);
 
     double diff = difftime(mktime(&local_tm), now_secs_gm);
-    return cast(int, diff / 60);
+    int minutes = cast(int, diff / 60);
+
+    if (cacheable) {
+        zone_cache_quarter = now_secs / ZONE_CACHE_SECS;
+        zone_cache_minutes = minutes;
+        strcpy(zone_cache_tz, tz);
+    }
+    return minutes;
 }
 
 
@@ -116,42 +149,42 @@ static int Get_Timezone(struct tm *utc_tm_unused)
 //
 // Get the current system date/time in UTC plus zone offset (mins).
 //
+// clock_gettime() is used instead of gettimeofday(), for nanoseconds.  On
+// Linux it's answered in user space (the vDSO) without a system call.  The
+// DATE! is made directly, instead of running MAKE-DATE-YMDSNZ through the
+// API, since NOW may be called for every line of a log.
+//
 REBVAL *Get_Current_Datetime_Value(void)
 {
-    struct timeval tv;
-    struct timezone * const tz_ptr = NULL; // obsolete
-    if (gettimeofday(&tv, tz_ptr) != 0)
-        rebJumps("fail {gettimeofday() returned 0}");
+    struct timespec ts;
+    if (clock_gettime(CLOCK_REALTIME, &ts) != 0)
+        rebFail_OS (errno);
 
-    // tv.tv_sec is the time in seconds 1 January 1970, 00:00:00 UTC
+    // ts.tv_sec is the time in seconds 1 January 1970, 00:00:00 UTC
     // (epoch-1970).  It does not account for the time zone.  In POSIX, these
     // values are generally passed around as `time_t`...e.g. functions for
     // converting to local time expect that.
     //
-    time_t stime = tv.tv_sec;
+    time_t stime = ts.tv_sec;
 
-    // gmtime() is badly named.  It's utc time.  Note we have to be careful as
-    // it returns a system static buffer, so we have to copy the result
-    // via dereference to avoid calls to localtime() inside Get_Timezone
-    // from corrupting the buffer before it gets used.
-    //
-    // !!! Consider usage of the thread-safe variants, though they are not
-    // available on all older systems.
+    // gmtime() is badly named.  It's utc time.  The thread-safe variant is
+    // used, so a localtime() inside Get_Timezone() can't overwrite it.
     //
-    struct tm utc_tm = *gmtime(&stime);
+    struct tm utc_tm;
+    gmtime_r(&stime, &utc_tm);
 
-    int zone = Get_Timezone(&utc_tm);
+    int zone = Get_Timezone(stime);
 
-    return rebValue("ensure date! (make-date-ymdsnz",
-        rebI(utc_tm.tm_year + 1900),  // year
-        rebI(utc_tm.tm_mon + 1),  // month
-        rebI(utc_tm.tm_mday),  // day
-        rebI(
+    return Init_Date_Ymdnz(
+        Alloc_Value(),
+        utc_tm.tm_year + 1900,
+        utc_tm.tm_mon + 1,
+        utc_tm.tm_mday,
+        SECS_TO_NANO(
             utc_tm.tm_hour * 3600
             + utc_tm.tm_min * 60
             + utc_tm.tm_sec
-        ),  // secs
-        rebI(tv.tv_usec * 1000),  // nano
-        rebI(zone),  // zone
-    ")");
+        ) + ts.tv_nsec,
+        zone
+    );
 }
@@ -78,3 +78,175 @@ REBNATIVE(unregister_vector_hooks)
 
     return Init_None(D_OUT);
 }
+
+
+//
+//  export as-vector: native [
+//
+//  {View the bytes of a BINARY! as the elements of a VECTOR!, without copying}
+//
+//      return: [vector!]
+//      type "Element type, e.g. [integer! 32] or [unsigned integer! 16]"
+//          [block!]
+//      binary "Must be at its head (e.g. from MAP-FILE of a column file)"
+//          [binary!]
+//      /endian "Byte order of the binary, LE or BE (copies if not native)"
+//          [word!]
+//  ]
+//
+REBNATIVE(as_vector)
+//
+// BYTES OF goes the other way, giving the BINARY! a vector is stored in.
+{
+    VECTOR_INCLUDE_PARAMS_OF_AS_VECTOR;
+
+    bool swap = false;
+    if (REF(endian)) {
+        bool little = rebDid(
+            "switch", rebQ(ARG(endian)), "[",
+                "'BE [false] 'LE [true]",
+                "fail {AS-VECTOR/ENDIAN must be BE or LE}",
+            "]"
+        );
+      #ifdef ENDIAN_LITTLE
+        swap = not little;
+      #elif defined(ENDIAN_BIG)
+        swap = little;
+      #else
+        #error "Unsupported CPU endian"
+      #endif
+    }
+
+    return Binary_As_Vector(D_OUT, ARG(type), ARG(binary), swap);
+}
+
+
+//
+//  export sum: native [
+//
+//  {Add up the elements of a vector}
+//
+//      return: "INTEGER! for integer vectors, DECIMAL! for floats"
+//          [integer! decimal!]
+//      vector [vector!]
+//  ]
+//
+REBNATIVE(sum)
+{
+    VECTOR_INCLUDE_PARAMS_OF_SUM;
+
+    return Sum_Vector(D_OUT, ARG(vector));
+}
+
+
+//
+//  export product: native [
+//
+//  {Multiply together the elements of a vector}
+//
+//      return: "INTEGER! for integer vectors, DECIMAL! for floats"
+//          [integer! decimal!]
+//      vector [vector!]
+//  ]
+//
+REBNATIVE(product)
+{
+    VECTOR_INCLUDE_PARAMS_OF_PRODUCT;
+
+    return Product_Vector(D_OUT, ARG(vector));
+}
+
+
+//
+//  export dot: native [
+//
+//  {Sum of the products of corresponding elements of two vectors}
+//
+//      return: "INTEGER! if both vectors are integer, else DECIMAL!"
+//          [integer! decimal!]
+//      vector1 [vector!]
+//      vector2 "Must be the same length"
+//          [vector!]
+//  ]
+//
+REBNATIVE(dot)
+{
+    VECTOR_INCLUDE_PARAMS_OF_DOT;
+
+    return Dot_Vectors(D_OUT, ARG(vector1), ARG(vector2));
+}
+
+
+//
+//  export mean: native [
+//
+//  {Average of the elements of a vector}
+//
+//      return: "Null if the vector is empty"
+//          [<opt> decimal!]
+//      vector [vector!]
+//  ]
+//
+REBNATIVE(mean)
+{
+    VECTOR_INCLUDE_PARAMS_OF_MEAN;
+
+    return Mean_Vector(D_OUT, ARG(vector));
+}
+
+
+//
+//  export variance: native [
+//
+//  {Mean squared distance of the elements of a vector from their mean}
+//
+//      return: "Null if there are too few elements"
+//          [<opt> decimal!]
+//      vector [vector!]
+//      /sample "Estimate for a population the vector is a sample of (n - 1)"
+//  ]
+//
+REBNATIVE(variance)
+{
+    VECTOR_INCLUDE_PARAMS_OF_VARIANCE;
+
+    return Variance_Vector(D_OUT, ARG(vector), did REF(sample));
+}
+
+
+//
+//  export smallest: native [
+//
+//  {Smallest element of a vector (NaNs are skipped)}
+//
+//      return: "Null if the vector is empty"
+//          [<opt> integer! decimal!]
+//      vector [vector!]
+//      /index "Give the 1-based index of the first smallest element instead"
+//  ]
+//
+REBNATIVE(smallest)
+{
+    VECTOR_INCLUDE_PARAMS_OF_SMALLEST;
+
+    return Extreme_Vector(D_OUT, ARG(vector), false, did REF(index));
+}
+
+
+//
+//  export largest: native [
+//
+//  {Largest element of a vector (NaNs are skipped)}
+//
+//      return: "Null if the vector is empty"
+//          [<opt> integer! decimal!]
+//      vector [vector!]
+//      /index "Give the 1-based index of the first largest element instead"
+//  ]
+//
+REBNATIVE(largest)
+{
+    VECTOR_INCLUDE_PARAMS_OF_LARGEST;
+
+    return Extreme_Vector(D_OUT, ARG(vector), true, did REF(index));
+}
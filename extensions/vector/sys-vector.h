@@ -34,6 +34,10 @@
 
 extern REBTYP *EG_Vector_Type;
 
+inline static bool IS_VECTOR(const RELVAL *v) {  // not a quoted vector
+    return IS_CUSTOM(v) and CELL_CUSTOM_TYPE(v) == EG_Vector_Type;
+}
+
 #define VAL_VECTOR_BINARY(v) \
     VAL(VAL_NODE1(v))  // pairing[0]
 
@@ -115,3 +119,24 @@ extern REB_R TO_Vector(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
 extern void MF_Vector(REB_MOLD *mo, REBCEL(const*) v, bool form);
 extern REBTYPE(Vector);
 extern REB_R PD_Vector(REBPVS *pvs, const RELVAL *picker, option(const REBVAL*) setval);
+
+extern REBVAL *Binary_As_Vector(
+    REBVAL *out,
+    const REBVAL *type,
+    const REBVAL *binary,
+    bool swap
+);
+
+// Reductions implemented in %t-vector.c, for the natives in %mod-vector.c
+//
+extern REBVAL *Sum_Vector(REBVAL *out, const REBVAL *vec);
+extern REBVAL *Product_Vector(REBVAL *out, const REBVAL *vec);
+extern REBVAL *Dot_Vectors(REBVAL *out, const REBVAL *a, const REBVAL *b);
+extern REBVAL *Mean_Vector(REBVAL *out, const REBVAL *vec);
+extern REBVAL *Variance_Vector(REBVAL *out, const REBVAL *vec, bool sample);
+extern REBVAL *Extreme_Vector(
+    REBVAL *out,
+    const REBVAL *vec,
+    bool largest,
+    bool index
+);
@@ -25,6 +25,7 @@
 //
 
 #include "sys-core.h"
+#include "sys-int-funcs.h"
 
 #include "sys-vector.h"
 
@@ -34,10 +35,11 @@
 //
 // Ren-C vectors are built on type of BINARY!.  This means that the memory
 // must be read via memcpy() in order to avoid strict aliasing violations.
+// Reading doesn't need the binary to be mutable (e.g. see AS-VECTOR).
 //
 REBVAL *Get_Vector_At(RELVAL *out, REBCEL(const*) vec, REBLEN n)
 {
-    REBYTE *data = VAL_VECTOR_HEAD(vec);
+    const REBYTE *data = VAL_BINARY_AT(VAL_VECTOR_BINARY(vec));
 
     bool integral = VAL_VECTOR_INTEGRAL(vec);
     bool sign = VAL_VECTOR_SIGN(vec);
@@ -47,12 +49,12 @@ REBVAL *Get_Vector_At(RELVAL *out, REBCEL(const*) vec, REBLEN n)
         switch (bitsize) {
           case 32: {
             float f;
-            memcpy(&f, cast(float*, data) + n, sizeof(f));
+            memcpy(&f, cast(const float*, data) + n, sizeof(f));
             return Init_Decimal(out, f); }
 
           case 64: {
             double d;
-            memcpy(&d, cast(double*, data) + n, sizeof(d));
+            memcpy(&d, cast(const double*, data) + n, sizeof(d));
             return Init_Decimal(out, d); }
         }
     }
@@ -61,22 +63,22 @@ REBVAL *Get_Vector_At(RELVAL *out, REBCEL(const*) vec, REBLEN n)
             switch (bitsize) {
               case 8: {
                 int8_t i;
-                memcpy(&i, cast(int8_t*, data) + n, sizeof(i));
+                memcpy(&i, cast(const int8_t*, data) + n, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 16: {
                 int16_t i;
-                memcpy(&i, cast(int16_t*, data) + n, sizeof(i));
+                memcpy(&i, cast(const int16_t*, data) + n, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 32: {
                 int32_t i;
-                memcpy(&i, cast(int32_t*, data) + n, sizeof(i));
+                memcpy(&i, cast(const int32_t*, data) + n, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 64: {
                 int64_t i;
-                memcpy(&i, cast(int64_t*, data) + n, sizeof(i));
+                memcpy(&i, cast(const int64_t*, data) + n, sizeof(i));
                 return Init_Integer(out, i); }
             }
         }
@@ -84,22 +86,22 @@ REBVAL *Get_Vector_At(RELVAL *out, REBCEL(const*) vec, REBLEN n)
             switch (bitsize) {
               case 8: {
                 uint8_t i;
-                memcpy(&i, cast(uint8_t*, data) + n, sizeof(i));
+                memcpy(&i, cast(const uint8_t*, data) + n, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 16: {
                 uint16_t i;
-                memcpy(&i, cast(uint16_t*, data) + n, sizeof(i));
+                memcpy(&i, cast(const uint16_t*, data) + n, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 32: {
                 uint32_t i;
-                memcpy(&i, cast(uint32_t*, data) + n, sizeof(i));
+                memcpy(&i, cast(const uint32_t*, data) + n, sizeof(i));
                 return Init_Integer(out, i); }
 
               case 64: {
                 int64_t i;
-                memcpy(&i, cast(int64_t*, data) + n, sizeof(i));
+                memcpy(&i, cast(const int64_t*, data) + n, sizeof(i));
                 if (i < 0)
                     fail ("64-bit integer out of range for INTEGER!");
 
@@ -112,15 +114,19 @@ REBVAL *Get_Vector_At(RELVAL *out, REBCEL(const*) vec, REBLEN n)
 }
 
 
-static void Set_Vector_At(REBCEL(const*) vec, REBLEN n, const RELVAL *set) {
+// Store a number as the nth element of packed data with the given element
+// type, failing if it is out of range for it.
+//
+static void Set_Vector_Element_Core(
+    REBYTE *data,
+    bool integral,
+    bool sign,
+    REBYTE bitsize,
+    REBLEN n,
+    const RELVAL *set
+){
     assert(IS_INTEGER(set) or IS_DECIMAL(set));  // caller should error
 
-    REBYTE *data = VAL_VECTOR_HEAD(vec);
-
-    bool integral = VAL_VECTOR_INTEGRAL(vec);
-    bool sign = VAL_VECTOR_SIGN(vec);
-    REBYTE bitsize = VAL_VECTOR_BITSIZE(vec);
-
     if (not integral) {
         REBDEC d64;
         if (IS_INTEGER(set))
@@ -229,6 +235,18 @@ static void Set_Vector_At(REBCEL(const*) vec, REBLEN n, const RELVAL *set) {
 }
 
 
+static void Set_Vector_At(REBCEL(const*) vec, REBLEN n, const RELVAL *set) {
+    Set_Vector_Element_Core(
+        VAL_VECTOR_HEAD(vec),
+        VAL_VECTOR_INTEGRAL(vec),
+        VAL_VECTOR_SIGN(vec),
+        VAL_VECTOR_BITSIZE(vec),
+        n,
+        set
+    );
+}
+
+
 void Set_Vector_Row(
     REBCEL(const*) vec,
     const REBVAL *blk   // !!! "can not be BLOCK!?"
@@ -349,6 +367,1069 @@ void Shuffle_Vector(REBVAL *vect, bool secure)
 }
 
 
+//
+//  Random_Fill_Vector: C
+//
+// Integer elements of any width take any bit pattern, so they are filled as
+// bytes.  Floating point elements get values from 0.0 up to (but not) 1.0,
+// using the top bits of each random number as the mantissa.
+//
+void Random_Fill_Vector(REBVAL *vect, REBLEN len)
+{
+    REBYTE *data = VAL_VECTOR_HEAD(vect);
+
+    if (VAL_VECTOR_INTEGRAL(vect)) {
+        Random_Fill_Bytes(data, len * VAL_VECTOR_WIDE(vect));
+        return;
+    }
+
+    REBLEN n;
+    if (VAL_VECTOR_BITSIZE(vect) == 32) {
+        for (n = 0; n < len; ++n) {
+            REBD32 d = (Random_Fast_U64() >> 40) / 16777216.0f;  // 2^24
+            memcpy(cast(REBD32*, data) + n, &d, sizeof(d));
+        }
+    }
+    else {
+        assert(VAL_VECTOR_BITSIZE(vect) == 64);
+        for (n = 0; n < len; ++n) {
+            REBDEC d = (Random_Fast_U64() >> 11) / 9007199254740992.0;  // 2^53
+            memcpy(cast(REBDEC*, data) + n, &d, sizeof(d));
+        }
+    }
+}
+
+
+//
+//  Sort_Vector: C
+//
+// A vector's elements are all numbers of the same kind, so it is sorted by
+// radix without extracting any REBVALs.  Each element is made into a 64-bit
+// key that orders the same when compared as unsigned: signed integers get
+// their sign bit flipped, and so do positive floats (negative floats have
+// all their bits flipped, so larger magnitudes come first).
+//
+void Sort_Vector(REBVAL *vect, bool reverse)
+{
+    REBYTE *data = VAL_VECTOR_HEAD(vect);
+    REBLEN len = VAL_VECTOR_LEN_AT(vect);
+
+    bool integral = VAL_VECTOR_INTEGRAL(vect);
+    bool sign = VAL_VECTOR_SIGN(vect);
+    REBYTE bitsize = VAL_VECTOR_BITSIZE(vect);
+    REBSIZ wide = bitsize / 8;
+
+    const uint64_t high_bit = cast(uint64_t, 1) << 63;
+    uint64_t flip = reverse ? ~cast(uint64_t, 0) : 0;
+
+    uint64_t *keys = TRY_ALLOC_N(uint64_t, len);
+    if (keys == nullptr)
+        fail (Error_No_Memory(sizeof(uint64_t) * len));
+
+    REBLEN n;
+    for (n = 0; n < len; ++n) {
+        REBYTE *at = data + n * wide;
+        uint64_t key;
+        if (not integral) {
+            double d;
+            if (bitsize == 32) {
+                float f;
+                memcpy(&f, at, sizeof(f));
+                d = f;
+            }
+            else
+                memcpy(&d, at, sizeof(d));
+            memcpy(&key, &d, sizeof(key));
+            key = (key & high_bit) ? ~key : (key ^ high_bit);
+        }
+        else if (sign) {
+            int64_t i;
+            switch (bitsize) {
+              case 8: {
+                int8_t i8;
+                memcpy(&i8, at, sizeof(i8));
+                i = i8;
+                break; }
+
+              case 16: {
+                int16_t i16;
+                memcpy(&i16, at, sizeof(i16));
+                i = i16;
+                break; }
+
+              case 32: {
+                int32_t i32;
+                memcpy(&i32, at, sizeof(i32));
+                i = i32;
+                break; }
+
+              default:
+                memcpy(&i, at, sizeof(i));
+                break;
+            }
+            key = cast(uint64_t, i) ^ high_bit;
+        }
+        else {
+            switch (bitsize) {
+              case 8: {
+                uint8_t u8;
+                memcpy(&u8, at, sizeof(u8));
+                key = u8;
+                break; }
+
+              case 16: {
+                uint16_t u16;
+                memcpy(&u16, at, sizeof(u16));
+                key = u16;
+                break; }
+
+              case 32: {
+                uint32_t u32;
+                memcpy(&u32, at, sizeof(u32));
+                key = u32;
+                break; }
+
+              default:
+                memcpy(&key, at, sizeof(key));
+                break;
+            }
+        }
+        keys[n] = key ^ flip;
+    }
+
+    if (not Radix_Sort_U64(keys, nullptr, len)) {
+        FREE_N(uint64_t, len, keys);
+        fail (Error_No_Memory(sizeof(uint64_t) * len * 2));
+    }
+
+    for (n = 0; n < len; ++n) {  // undo the transform to write elements back
+        REBYTE *at = data + n * wide;
+        uint64_t key = keys[n] ^ flip;
+        if (not integral) {
+            key = (key & high_bit) ? (key ^ high_bit) : ~key;
+            double d;
+            memcpy(&d, &key, sizeof(d));
+            if (bitsize == 32) {
+                float f = cast(float, d);
+                memcpy(at, &f, sizeof(f));
+            }
+            else
+                memcpy(at, &d, sizeof(d));
+        }
+        else {
+            if (sign)
+                key ^= high_bit;
+
+            // Truncating the 64-bit key gives back the two's complement bits
+            // of the original signed or unsigned element.
+            //
+            switch (bitsize) {
+              case 8: {
+                uint8_t u8 = cast(uint8_t, key);
+                memcpy(at, &u8, sizeof(u8));
+                break; }
+
+              case 16: {
+                uint16_t u16 = cast(uint16_t, key);
+                memcpy(at, &u16, sizeof(u16));
+                break; }
+
+              case 32: {
+                uint32_t u32 = cast(uint32_t, key);
+                memcpy(at, &u32, sizeof(u32));
+                break; }
+
+              default:
+                memcpy(at, &key, sizeof(key));
+                break;
+            }
+        }
+    }
+
+    FREE_N(uint64_t, len, keys);
+}
+
+
+//=//// ELEMENT-WISE MATH /////////////////////////////////////////////////=//
+//
+// ADD, SUBTRACT, MULTIPLY and DIVIDE of a vector with another vector of the
+// same element type and length, or with a number, make a new vector of that
+// element type.  The packed data is processed directly, with no REBVAL for
+// each element.
+//
+// Compilers with GCC's vector extensions (GCC and Clang) do 16 bytes at a
+// time with SIMD types, which become SSE2/AVX or NEON instructions.  That
+// covers all four operations on floats, and adding and subtracting integers.
+// Multiplying integers needs double width to check for overflow, and there
+// is no SIMD integer divide.  Those go through plain loops, as does any tail
+// that doesn't fill a block, and everything on other compilers.
+//
+// Integer results out of range for the element type are errors, checked for
+// by accumulating flags to test after the loop instead of breaking out of it.
+// Floats follow IEEE, except that dividing by zero is an error as it is with
+// DECIMAL!.
+//
+// !!! Integer vectors divide by truncating toward zero, since the result has
+// the same element type.  INTEGER! division gives a DECIMAL! if inexact, so
+// perhaps DIVIDE of integer vectors should make decimal vectors.
+//
+
+enum Reb_Vector_Math_Status {
+    VECTOR_MATH_OK,
+    VECTOR_MATH_OUT_OF_RANGE,
+    VECTOR_MATH_ZERO_DIVIDE
+};
+
+typedef enum Reb_Vector_Math_Status (VECTOR_KERNEL)(
+    SYMID op,
+    REBYTE *out,
+    const REBYTE *a,
+    const REBYTE *b,
+    REBLEN len
+);
+
+#if defined(__GNUC__) && !defined(__TINYC__)  // includes Clang
+    #define VECTOR_SIMD
+
+    typedef uint8_t Vec_U8 __attribute__((vector_size(16)));
+    typedef uint16_t Vec_U16 __attribute__((vector_size(16)));
+    typedef uint32_t Vec_U32 __attribute__((vector_size(16)));
+    typedef uint64_t Vec_U64 __attribute__((vector_size(16)));
+    typedef float Vec_F32 __attribute__((vector_size(16)));
+    typedef double Vec_F64 __attribute__((vector_size(16)));
+    typedef int32_t Vec_I32 __attribute__((vector_size(16)));
+    typedef int64_t Vec_I64 __attribute__((vector_size(16)));
+
+    // Integer elements are added and subtracted as unsigned, so they wrap
+    // (signed overflow is undefined, even in vector types).  A lane of
+    // `over` gets its top bit set by any result that didn't fit.
+    //
+    // Signed results overflowed if they have a different sign from both
+    // inputs (adding), or from the first input when the inputs differed in
+    // sign (subtracting).  Unsigned results overflowed if adding made them
+    // smaller, or if subtracting was from something smaller.
+    //
+    #define DEFINE_SIMD_INTEGER(name,T,V,sign) \
+    static REBLEN name( \
+        SYMID op, \
+        REBYTE *out, \
+        const REBYTE *a, \
+        const REBYTE *b, \
+        REBLEN len, \
+        bool *bad \
+    ){ \
+        const REBLEN lanes = sizeof(V) / sizeof(T); \
+        V over = {0}; \
+        V x; \
+        V y; \
+        V z; \
+        REBLEN n = 0; \
+        for (; n + lanes <= len; n += lanes) { \
+            memcpy(&x, a + n * sizeof(T), sizeof(V)); \
+            memcpy(&y, b + n * sizeof(T), sizeof(V)); \
+            if (op == SYM_ADD) { \
+                z = x + y; \
+                if (sign) \
+                    over |= (x ^ z) & (y ^ z); \
+                else \
+                    over |= (V)(z < x); \
+            } \
+            else { \
+                z = x - y; \
+                if (sign) \
+                    over |= (x ^ y) & (x ^ z); \
+                else \
+                    over |= (V)(x < y); \
+            } \
+            memcpy(out + n * sizeof(T), &z, sizeof(V)); \
+        } \
+        T lane[sizeof(V) / sizeof(T)]; \
+        memcpy(lane, &over, sizeof(V)); \
+        REBLEN i; \
+        for (i = 0; i < lanes; ++i) \
+            *bad |= (lane[i] >> (sizeof(T) * 8 - 1)) != 0; \
+        return n; \
+    }
+
+    // Floats do all four operations, and note any zero divisor.
+    //
+    #define DEFINE_SIMD_FLOAT(name,T,V,M) \
+    static REBLEN name( \
+        SYMID op, \
+        REBYTE *out, \
+        const REBYTE *a, \
+        const REBYTE *b, \
+        REBLEN len, \
+        bool *zero \
+    ){ \
+        const REBLEN lanes = sizeof(V) / sizeof(T); \
+        const V none = {0}; \
+        M zeros = {0}; \
+        V x; \
+        V y; \
+        V z; \
+        REBLEN n = 0; \
+        for (; n + lanes <= len; n += lanes) { \
+            memcpy(&x, a + n * sizeof(T), sizeof(V)); \
+            memcpy(&y, b + n * sizeof(T), sizeof(V)); \
+            switch (op) { \
+              case SYM_ADD: z = x + y; break; \
+              case SYM_SUBTRACT: z = x - y; break; \
+              case SYM_MULTIPLY: z = x * y; break; \
+              default: \
+                zeros |= (y == none); \
+                z = x / y; \
+                break; \
+            } \
+            memcpy(out + n * sizeof(T), &z, sizeof(V)); \
+        } \
+        REBLEN i; \
+        for (i = 0; i < lanes; ++i) \
+            *zero |= (zeros[i] != 0); \
+        return n; \
+    }
+
+    DEFINE_SIMD_INTEGER(Simd_I8, uint8_t, Vec_U8, true)
+    DEFINE_SIMD_INTEGER(Simd_I16, uint16_t, Vec_U16, true)
+    DEFINE_SIMD_INTEGER(Simd_I32, uint32_t, Vec_U32, true)
+    DEFINE_SIMD_INTEGER(Simd_I64, uint64_t, Vec_U64, true)
+    DEFINE_SIMD_INTEGER(Simd_U8, uint8_t, Vec_U8, false)
+    DEFINE_SIMD_INTEGER(Simd_U16, uint16_t, Vec_U16, false)
+    DEFINE_SIMD_INTEGER(Simd_U32, uint32_t, Vec_U32, false)
+    DEFINE_SIMD_INTEGER(Simd_U64, uint64_t, Vec_U64, false)
+    DEFINE_SIMD_FLOAT(Simd_F32, float, Vec_F32, Vec_I32)
+    DEFINE_SIMD_FLOAT(Simd_F64, double, Vec_F64, Vec_I64)
+
+    #define SIMD_INTEGER(name) \
+        if (op == SYM_ADD or op == SYM_SUBTRACT) \
+            n = name(op, out, a, b, len, &bad);
+
+    #define SIMD_FLOAT(name) \
+        n = name(op, out, a, b, len, &zero);
+#else
+    #define SIMD_INTEGER(name)
+    #define SIMD_FLOAT(name)
+#endif
+
+// The plain loop finishes whatever the SIMD loop (if any) didn't do, with
+// `body` computing z from x and y.
+//
+#define VECTOR_LOOP(T,body) \
+    for (; n < len; ++n) { \
+        T x; \
+        T y; \
+        T z; \
+        memcpy(&x, a + n * sizeof(T), sizeof(T)); \
+        memcpy(&y, b + n * sizeof(T), sizeof(T)); \
+        body; \
+        memcpy(out + n * sizeof(T), &z, sizeof(T)); \
+    }
+
+#define DEFINE_VECTOR_KERNEL(name,T,simd,add,subtract,multiply,divide) \
+static enum Reb_Vector_Math_Status name( \
+    SYMID op, \
+    REBYTE *out, \
+    const REBYTE *a, \
+    const REBYTE *b, \
+    REBLEN len \
+){ \
+    bool bad = false; \
+    bool zero = false; \
+    REBLEN n = 0; \
+    simd \
+    switch (op) { \
+      case SYM_ADD: VECTOR_LOOP(T, add); break; \
+      case SYM_SUBTRACT: VECTOR_LOOP(T, subtract); break; \
+      case SYM_MULTIPLY: VECTOR_LOOP(T, multiply); break; \
+      default: VECTOR_LOOP(T, divide); break; \
+    } \
+    if (zero) \
+        return VECTOR_MATH_ZERO_DIVIDE; \
+    return bad ? VECTOR_MATH_OUT_OF_RANGE : VECTOR_MATH_OK; \
+}
+
+// Elements narrower than 64 bits are computed in 64 bits and range checked.
+//
+#define DEFINE_NARROW_SIGNED_KERNEL(name,T,simd,lo,hi) \
+    DEFINE_VECTOR_KERNEL(name, T, simd, \
+        int64_t r = cast(int64_t, x) + y; \
+            bad |= (r < lo) | (r > hi); \
+            z = cast(T, r), \
+        int64_t r = cast(int64_t, x) - y; \
+            bad |= (r < lo) | (r > hi); \
+            z = cast(T, r), \
+        int64_t r = cast(int64_t, x) * y; \
+            bad |= (r < lo) | (r > hi); \
+            z = cast(T, r), \
+        zero |= (y == 0); \
+            int64_t r = cast(int64_t, x) / (y == 0 ? 1 : y); \
+            bad |= (r > hi); \
+            z = cast(T, r) \
+    )
+
+#define DEFINE_NARROW_UNSIGNED_KERNEL(name,T,simd,hi) \
+    DEFINE_VECTOR_KERNEL(name, T, simd, \
+        uint64_t r = cast(uint64_t, x) + y; \
+            bad |= (r > hi); \
+            z = cast(T, r), \
+        bad |= (x < y); \
+            z = cast(T, x - y), \
+        uint64_t r = cast(uint64_t, x) * y; \
+            bad |= (r > hi); \
+            z = cast(T, r), \
+        zero |= (y == 0); \
+            z = cast(T, x / (y == 0 ? 1 : y)) \
+    )
+
+DEFINE_NARROW_SIGNED_KERNEL(
+    Vector_Math_I8, int8_t, SIMD_INTEGER(Simd_I8), INT8_MIN, INT8_MAX
+)
+DEFINE_NARROW_SIGNED_KERNEL(
+    Vector_Math_I16, int16_t, SIMD_INTEGER(Simd_I16), INT16_MIN, INT16_MAX
+)
+DEFINE_NARROW_SIGNED_KERNEL(
+    Vector_Math_I32, int32_t, SIMD_INTEGER(Simd_I32), INT32_MIN, INT32_MAX
+)
+DEFINE_NARROW_UNSIGNED_KERNEL(
+    Vector_Math_U8, uint8_t, SIMD_INTEGER(Simd_U8), UINT8_MAX
+)
+DEFINE_NARROW_UNSIGNED_KERNEL(
+    Vector_Math_U16, uint16_t, SIMD_INTEGER(Simd_U16), UINT16_MAX
+)
+DEFINE_NARROW_UNSIGNED_KERNEL(
+    Vector_Math_U32, uint32_t, SIMD_INTEGER(Simd_U32), UINT32_MAX
+)
+
+DEFINE_VECTOR_KERNEL(Vector_Math_I64, int64_t, SIMD_INTEGER(Simd_I64),
+    bad |= REB_I64_ADD_OF(x, y, &z),
+    bad |= REB_I64_SUB_OF(x, y, &z),
+    bad |= REB_I64_MUL_OF(x, y, &z),
+    zero |= (y == 0);
+        bad |= (x == INT64_MIN and y == -1);
+        z = (y == 0 or y == -1) \
+            ? cast(int64_t, 0 - cast(uint64_t, x))
+            : x / y
+)
+
+DEFINE_VECTOR_KERNEL(Vector_Math_U64, uint64_t, SIMD_INTEGER(Simd_U64),
+    bad |= REB_U64_ADD_OF(x, y, &z),
+    bad |= (x < y);
+        z = x - y,
+    bad |= REB_U64_MUL_OF(x, y, &z),
+    zero |= (y == 0);
+        z = x / (y == 0 ? 1 : y)
+)
+
+DEFINE_VECTOR_KERNEL(Vector_Math_F32, float, SIMD_FLOAT(Simd_F32),
+    z = x + y,
+    z = x - y,
+    z = x * y,
+    zero |= (y == 0);
+        z = x / y
+)
+
+DEFINE_VECTOR_KERNEL(Vector_Math_F64, double, SIMD_FLOAT(Simd_F64),
+    z = x + y,
+    z = x - y,
+    z = x * y,
+    zero |= (y == 0);
+        z = x / y
+)
+
+
+#define VECTOR_CHUNK_BYTES 1024  // scalar repeated for a vector to work with
+
+
+//
+//  Vector_Math: C
+//
+// `v` must be a vector, and `arg` a vector of the same element type and
+// length or a number.  The result is a new vector.
+//
+REBVAL *Vector_Math(REBVAL *out, SYMID op, const REBVAL *v, const REBVAL *arg)
+{
+    bool integral = VAL_VECTOR_INTEGRAL(v);
+    bool sign = VAL_VECTOR_SIGN(v);
+    REBYTE bitsize = VAL_VECTOR_BITSIZE(v);
+    REBSIZ wide = bitsize / 8;
+    REBLEN len = VAL_VECTOR_LEN_AT(v);
+
+    VECTOR_KERNEL *kernel;
+    if (not integral)
+        kernel = (bitsize == 32) ? &Vector_Math_F32 : &Vector_Math_F64;
+    else switch (bitsize) {
+      case 8: kernel = sign ? &Vector_Math_I8 : &Vector_Math_U8; break;
+      case 16: kernel = sign ? &Vector_Math_I16 : &Vector_Math_U16; break;
+      case 32: kernel = sign ? &Vector_Math_I32 : &Vector_Math_U32; break;
+      default: kernel = sign ? &Vector_Math_I64 : &Vector_Math_U64; break;
+    }
+
+    const REBYTE *a = VAL_BINARY_AT(VAL_VECTOR_BINARY(v));
+    const REBYTE *b;
+
+    // Give the kernel a run of a number as elements at the width of the
+    // vector, to pair up with each chunk of it.
+    //
+    REBYTE splat[VECTOR_CHUNK_BYTES];
+    REBLEN chunk;
+
+    if (IS_VECTOR(arg)) {
+        if (
+            VAL_VECTOR_INTEGRAL(arg) != integral
+            or VAL_VECTOR_SIGN(arg) != sign
+            or VAL_VECTOR_BITSIZE(arg) != bitsize
+        ){
+            fail ("VECTOR! math needs vectors of the same element type");
+        }
+        if (VAL_VECTOR_LEN_AT(arg) != len)
+            fail ("VECTOR! math needs vectors of the same length");
+
+        b = VAL_BINARY_AT(VAL_VECTOR_BINARY(arg));
+        chunk = len;
+    }
+    else if (IS_INTEGER(arg) or IS_DECIMAL(arg)) {
+        if (integral and not IS_INTEGER(arg))
+            fail ("Integer VECTOR! math needs INTEGER! numbers");
+
+        Set_Vector_Element_Core(splat, integral, sign, bitsize, 0, arg);
+        REBSIZ filled;
+        for (filled = wide; filled < VECTOR_CHUNK_BYTES; filled += wide)
+            memcpy(splat + filled, splat, wide);
+
+        b = splat;
+        chunk = VECTOR_CHUNK_BYTES / wide;
+    }
+    else
+        fail ("VECTOR! math needs a VECTOR!, INTEGER! or DECIMAL! argument");
+
+    REBBIN *bin = Make_Binary(len * wide);
+    TERM_BIN_LEN(bin, len * wide);
+    REBYTE *dest = BIN_HEAD(bin);
+
+    enum Reb_Vector_Math_Status status = VECTOR_MATH_OK;
+    REBLEN n;
+    for (n = 0; n < len and status == VECTOR_MATH_OK; n += chunk) {
+        REBLEN count = (len - n < chunk) ? len - n : chunk;
+        status = (*kernel)(op, dest + n * wide, a + n * wide, b, count);
+    }
+
+    if (status != VECTOR_MATH_OK) {
+        Free_Unmanaged_Series(bin);
+        if (status == VECTOR_MATH_ZERO_DIVIDE)
+            fail (Error_Zero_Divide_Raw());
+        fail (Error_Overflow_Raw());
+    }
+
+    return Init_Vector(out, bin, sign, integral, bitsize);
+}
+
+
+//=//// REDUCTIONS ////////////////////////////////////////////////////////=//
+//
+// SUM, PRODUCT, DOT, MEAN, VARIANCE, SMALLEST and LARGEST fold a vector down
+// to one number.  Elements are converted a block at a time into a buffer of
+// int64_t or double, so the folding loops don't switch on the element type
+// and are simple enough for the compiler to unroll and vectorize.
+//
+// Integer vectors add and multiply exactly into an INTEGER!, and it is an
+// error if that overflows.  Floats are added in double precision using
+// pairwise summation: each block is summed with eight accumulators, and the
+// block sums are combined as a binary tree.  Rounding error then grows with
+// log(n) instead of n--most of what Kahan summation would give, without the
+// dependency from each step to the next that keeps Kahan from going fast.
+//
+
+#define VECTOR_BLOCK 256  // elements per buffer (a multiple of 8)
+
+#define FETCH_LOOP(T) \
+    for (i = 0; i < count; ++i) { \
+        T x; \
+        memcpy(&x, data + (n + i) * sizeof(T), sizeof(T)); \
+        buf[i] = x; \
+    }
+
+
+// Get `count` elements of an integer vector starting at the nth.  Unsigned
+// 64-bit elements too big for INTEGER! fail, as they do in Get_Vector_At().
+//
+static void Fetch_Vector_Integers(
+    int64_t *buf,
+    const REBVAL *vec,
+    REBLEN n,
+    REBLEN count
+){
+    assert(VAL_VECTOR_INTEGRAL(vec));
+    const REBYTE *data = VAL_BINARY_AT(VAL_VECTOR_BINARY(vec));
+    bool sign = VAL_VECTOR_SIGN(vec);
+
+    REBLEN i;
+    switch (VAL_VECTOR_BITSIZE(vec)) {
+      case 8:
+        if (sign)
+            FETCH_LOOP(int8_t)
+        else
+            FETCH_LOOP(uint8_t)
+        break;
+
+      case 16:
+        if (sign)
+            FETCH_LOOP(int16_t)
+        else
+            FETCH_LOOP(uint16_t)
+        break;
+
+      case 32:
+        if (sign)
+            FETCH_LOOP(int32_t)
+        else
+            FETCH_LOOP(uint32_t)
+        break;
+
+      default:
+        FETCH_LOOP(int64_t)
+        if (not sign) {
+            for (i = 0; i < count; ++i)
+                if (buf[i] < 0)
+                    fail ("64-bit integer out of range for INTEGER!");
+        }
+        break;
+    }
+}
+
+
+// Get `count` elements of any vector starting at the nth, as doubles.
+//
+static void Fetch_Vector_Decimals(
+    double *buf,
+    const REBVAL *vec,
+    REBLEN n,
+    REBLEN count
+){
+    const REBYTE *data = VAL_BINARY_AT(VAL_VECTOR_BINARY(vec));
+    bool sign = VAL_VECTOR_SIGN(vec);
+
+    REBLEN i;
+    if (not VAL_VECTOR_INTEGRAL(vec)) {
+        if (VAL_VECTOR_BITSIZE(vec) == 32)
+            FETCH_LOOP(float)
+        else
+            FETCH_LOOP(double)
+        return;
+    }
+
+    switch (VAL_VECTOR_BITSIZE(vec)) {
+      case 8:
+        if (sign)
+            FETCH_LOOP(int8_t)
+        else
+            FETCH_LOOP(uint8_t)
+        break;
+
+      case 16:
+        if (sign)
+            FETCH_LOOP(int16_t)
+        else
+            FETCH_LOOP(uint16_t)
+        break;
+
+      case 32:
+        if (sign)
+            FETCH_LOOP(int32_t)
+        else
+            FETCH_LOOP(uint32_t)
+        break;
+
+      default:
+        if (sign)
+            FETCH_LOOP(int64_t)
+        else
+            FETCH_LOOP(uint64_t)
+        break;
+    }
+}
+
+
+// Eight independent sums take the place of one, so additions can overlap
+// (or go in SIMD registers) instead of each waiting on the last.
+//
+static double Sum_Block(const double *x, REBLEN count)
+{
+    double s[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+    REBLEN i = 0;
+    for (; i + 8 <= count; i += 8) {
+        REBLEN j;
+        for (j = 0; j < 8; ++j)
+            s[j] += x[i + j];
+    }
+
+    double total = ((s[0] + s[1]) + (s[2] + s[3]))
+        + ((s[4] + s[5]) + (s[6] + s[7]));
+
+    for (; i < count; ++i)
+        total += x[i];
+    return total;
+}
+
+
+// Block sums are combined like carries in a binary counter, so partial[i]
+// always holds the sum of 2^i blocks.
+//
+struct Reb_Pairwise_Sum {
+    REBLEN blocks;
+    double partial[sizeof(REBLEN) * 8];
+};
+
+static void Add_Block_Sum(struct Reb_Pairwise_Sum *p, double s)
+{
+    REBLEN i;
+    for (i = 0; p->blocks & (cast(REBLEN, 1) << i); ++i)
+        s = p->partial[i] + s;
+    p->partial[i] = s;
+    ++p->blocks;
+}
+
+static double Total_Pairwise_Sum(const struct Reb_Pairwise_Sum *p)
+{
+    double total = 0;
+    REBLEN i;
+    for (i = 0; i < sizeof(REBLEN) * 8; ++i) {
+        if (p->blocks & (cast(REBLEN, 1) << i))
+            total += p->partial[i];
+    }
+    return total;
+}
+
+
+// Sum of the elements (minus `shift` from each, then squared if `squares`)
+//
+static double Sum_Vector_Decimals(
+    const REBVAL *vec,
+    double shift,
+    bool squares
+){
+    struct Reb_Pairwise_Sum p;
+    p.blocks = 0;
+
+    double buf[VECTOR_BLOCK];
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBLEN n;
+    for (n = 0; n < len; n += VECTOR_BLOCK) {
+        REBLEN count = MIN(len - n, VECTOR_BLOCK);
+        Fetch_Vector_Decimals(buf, vec, n, count);
+
+        REBLEN i;
+        if (squares) {
+            for (i = 0; i < count; ++i)
+                buf[i] = (buf[i] - shift) * (buf[i] - shift);
+        }
+        else if (shift != 0) {
+            for (i = 0; i < count; ++i)
+                buf[i] -= shift;
+        }
+        Add_Block_Sum(&p, Sum_Block(buf, count));
+    }
+
+    return Total_Pairwise_Sum(&p);
+}
+
+
+static REBVAL *Init_Finite_Decimal(RELVAL *out, double d) {
+    if (not FINITE(d))
+        fail (Error_Overflow_Raw());
+    return Init_Decimal(out, d);
+}
+
+
+//
+//  Sum_Vector: C
+//
+REBVAL *Sum_Vector(REBVAL *out, const REBVAL *vec)
+{
+    if (not VAL_VECTOR_INTEGRAL(vec))
+        return Init_Finite_Decimal(out, Sum_Vector_Decimals(vec, 0, false));
+
+    // Up to VECTOR_BLOCK elements of 32 bits or less can't overflow an
+    // int64_t, so only the block sums have to be checked for those.
+    //
+    bool wide = (VAL_VECTOR_BITSIZE(vec) == 64);
+
+    int64_t buf[VECTOR_BLOCK];
+    int64_t total = 0;
+    bool overflow = false;
+
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBLEN n;
+    for (n = 0; n < len; n += VECTOR_BLOCK) {
+        REBLEN count = MIN(len - n, VECTOR_BLOCK);
+        Fetch_Vector_Integers(buf, vec, n, count);
+
+        int64_t s = 0;
+        REBLEN i;
+        if (wide) {
+            for (i = 0; i < count; ++i)
+                overflow |= REB_I64_ADD_OF(s, buf[i], &s);
+        }
+        else {
+            for (i = 0; i < count; ++i)
+                s += buf[i];
+        }
+        overflow |= REB_I64_ADD_OF(total, s, &total);
+    }
+
+    if (overflow)
+        fail (Error_Overflow_Raw());
+    return Init_Integer(out, total);
+}
+
+
+//
+//  Product_Vector: C
+//
+REBVAL *Product_Vector(REBVAL *out, const REBVAL *vec)
+{
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBLEN n;
+
+    if (not VAL_VECTOR_INTEGRAL(vec)) {
+        double buf[VECTOR_BLOCK];
+        double total = 1;
+        for (n = 0; n < len; n += VECTOR_BLOCK) {
+            REBLEN count = MIN(len - n, VECTOR_BLOCK);
+            Fetch_Vector_Decimals(buf, vec, n, count);
+
+            REBLEN i;
+            for (i = 0; i < count; ++i)
+                total *= buf[i];
+        }
+        return Init_Finite_Decimal(out, total);
+    }
+
+    // A zero anywhere makes the product zero, even if it overflowed before
+    // the zero was reached.
+    //
+    int64_t buf[VECTOR_BLOCK];
+    int64_t total = 1;
+    bool overflow = false;
+    bool zero = false;
+    for (n = 0; n < len; n += VECTOR_BLOCK) {
+        REBLEN count = MIN(len - n, VECTOR_BLOCK);
+        Fetch_Vector_Integers(buf, vec, n, count);
+
+        REBLEN i;
+        for (i = 0; i < count; ++i) {
+            zero |= (buf[i] == 0);
+            overflow |= REB_I64_MUL_OF(total, buf[i], &total);
+        }
+    }
+
+    if (zero)
+        return Init_Integer(out, 0);
+    if (overflow)
+        fail (Error_Overflow_Raw());
+    return Init_Integer(out, total);
+}
+
+
+//
+//  Dot_Vectors: C
+//
+// Vectors of any element types can be multiplied, the result being INTEGER!
+// if both are integral and DECIMAL! otherwise.
+//
+REBVAL *Dot_Vectors(REBVAL *out, const REBVAL *a, const REBVAL *b)
+{
+    REBLEN len = VAL_VECTOR_LEN_AT(a);
+    if (VAL_VECTOR_LEN_AT(b) != len)
+        fail ("DOT needs vectors of the same length");
+
+    REBLEN n;
+
+    if (VAL_VECTOR_INTEGRAL(a) and VAL_VECTOR_INTEGRAL(b)) {
+        int64_t x[VECTOR_BLOCK];
+        int64_t y[VECTOR_BLOCK];
+        int64_t total = 0;
+        bool overflow = false;
+        for (n = 0; n < len; n += VECTOR_BLOCK) {
+            REBLEN count = MIN(len - n, VECTOR_BLOCK);
+            Fetch_Vector_Integers(x, a, n, count);
+            Fetch_Vector_Integers(y, b, n, count);
+
+            REBLEN i;
+            for (i = 0; i < count; ++i) {
+                int64_t xy;
+                overflow |= REB_I64_MUL_OF(x[i], y[i], &xy);
+                overflow |= REB_I64_ADD_OF(total, xy, &total);
+            }
+        }
+
+        if (overflow)
+            fail (Error_Overflow_Raw());
+        return Init_Integer(out, total);
+    }
+
+    struct Reb_Pairwise_Sum p;
+    p.blocks = 0;
+
+    double x[VECTOR_BLOCK];
+    double y[VECTOR_BLOCK];
+    for (n = 0; n < len; n += VECTOR_BLOCK) {
+        REBLEN count = MIN(len - n, VECTOR_BLOCK);
+        Fetch_Vector_Decimals(x, a, n, count);
+        Fetch_Vector_Decimals(y, b, n, count);
+
+        REBLEN i;
+        for (i = 0; i < count; ++i)
+            x[i] *= y[i];
+        Add_Block_Sum(&p, Sum_Block(x, count));
+    }
+
+    return Init_Finite_Decimal(out, Total_Pairwise_Sum(&p));
+}
+
+
+//
+//  Mean_Vector: C
+//
+// Returns nullptr for an empty vector, which has no mean.
+//
+REBVAL *Mean_Vector(REBVAL *out, const REBVAL *vec)
+{
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    if (len == 0)
+        return nullptr;
+
+    double sum = Sum_Vector_Decimals(vec, 0, false);
+    return Init_Finite_Decimal(out, sum / len);
+}
+
+
+//
+//  Variance_Vector: C
+//
+// The squares are taken from the mean, instead of subtracting the square of
+// the mean from the mean of the squares (which loses all precision when the
+// variance is small next to the mean).  The sum of the deviations corrects
+// for rounding in the mean itself.  `sample` divides by n - 1, not n.
+//
+// Returns nullptr if there are too few elements to have a variance.
+//
+REBVAL *Variance_Vector(REBVAL *out, const REBVAL *vec, bool sample)
+{
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    if (len == 0 or (sample and len == 1))
+        return nullptr;
+
+    double mean = Sum_Vector_Decimals(vec, 0, false) / len;
+    if (not FINITE(mean))
+        fail (Error_Overflow_Raw());
+
+    double squares = Sum_Vector_Decimals(vec, mean, true);
+    double deviations = Sum_Vector_Decimals(vec, mean, false);
+
+    double variance = (squares - deviations * deviations / len)
+        / (sample ? len - 1 : len);
+    if (variance < 0)
+        variance = 0;  // rounding in the correction
+    return Init_Finite_Decimal(out, variance);
+}
+
+
+//
+//  Extreme_Vector: C
+//
+// Find the smallest element (or largest, if `largest`), giving the 1-based
+// index of where it first appears if `index`.  NaN elements are skipped.
+//
+// Returns nullptr if there are no elements (or only NaNs).
+//
+REBVAL *Extreme_Vector(
+    REBVAL *out,
+    const REBVAL *vec,
+    bool largest,
+    bool index
+){
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBLEN where = len;  // len means none found yet
+    REBLEN n;
+
+    // Each block's extreme is found with a plain loop the compiler can turn
+    // into SIMD min/max instructions, and only a block that improves on the
+    // best so far is searched again for the position.
+    //
+    if (VAL_VECTOR_INTEGRAL(vec)) {
+        int64_t buf[VECTOR_BLOCK];
+        int64_t best = 0;
+        for (n = 0; n < len; n += VECTOR_BLOCK) {
+            REBLEN count = MIN(len - n, VECTOR_BLOCK);
+            Fetch_Vector_Integers(buf, vec, n, count);
+
+            int64_t m = buf[0];
+            REBLEN i;
+            if (largest) {
+                for (i = 1; i < count; ++i)
+                    m = (buf[i] > m) ? buf[i] : m;
+            }
+            else {
+                for (i = 1; i < count; ++i)
+                    m = (buf[i] < m) ? buf[i] : m;
+            }
+
+            if (where != len and (largest ? m <= best : m >= best))
+                continue;
+
+            for (i = 0; buf[i] != m; ++i)
+                NOOP;
+            best = m;
+            where = n + i;
+        }
+
+        if (where == len)
+            return nullptr;
+        if (index)
+            return Init_Integer(out, where + 1);
+        return Init_Integer(out, best);
+    }
+
+    double buf[VECTOR_BLOCK];
+    double best = 0;
+    for (n = 0; n < len; n += VECTOR_BLOCK) {
+        REBLEN count = MIN(len - n, VECTOR_BLOCK);
+        Fetch_Vector_Decimals(buf, vec, n, count);
+
+        // Starting from infinity means NaNs are never picked, as any
+        // comparison with a NaN is false.
+        //
+        double m = largest ? -HUGE_VAL : HUGE_VAL;
+        REBLEN i;
+        if (largest) {
+            for (i = 0; i < count; ++i)
+                m = (buf[i] > m) ? buf[i] : m;
+        }
+        else {
+            for (i = 0; i < count; ++i)
+                m = (buf[i] < m) ? buf[i] : m;
+        }
+
+        if (where != len and (largest ? m <= best : m >= best))
+            continue;
+
+        for (i = 0; i < count and buf[i] != m; ++i)
+            NOOP;
+        if (i == count)
+            continue;  // all NaN
+        best = m;
+        where = n + i;
+    }
+
+    if (where == len)
+        return nullptr;
+    if (index)
+        return Init_Integer(out, where + 1);
+    return Init_Decimal(out, best);
+}
+
+
 //
 //  Make_Vector_Spec: C
 //
@@ -417,7 +1498,7 @@ bool Make_Vector_Spec(
         ++item;
     }
 
-    REBYTE len = 1;  // !!! default len to 1...why?
+    REBLEN len = 1;  // !!! default len to 1...why?
     if (item != tail and IS_INTEGER(item)) {
         if (Int32(item) < 0)
             return false;
@@ -469,6 +1550,67 @@ bool Make_Vector_Spec(
 }
 
 
+//
+//  Binary_As_Vector: C
+//
+// Make a vector whose elements are the bytes of a BINARY!, with the element
+// type given like the start of a MAKE VECTOR! spec, e.g. [integer! 32] or
+// [unsigned integer! 16].  Nothing is copied, so a change made through the
+// vector or the binary is seen by both.  A read-only binary (such as one
+// made by MAP-FILE) gives a vector whose elements can't be changed.
+//
+// Vector elements are always in the machine's byte order.  If `swap` then
+// the binary holds the other order, and the vector gets a swapped copy.
+//
+// !!! A CONST binary value doesn't make a const vector, since vectors don't
+// pay attention to CELL_FLAG_CONST yet.
+//
+REBVAL *Binary_As_Vector(
+    REBVAL *out,
+    const REBVAL *type,
+    const REBVAL *binary,
+    bool swap
+){
+    DECLARE_LOCAL (proto);  // one-element vector, just for its element type
+    if (
+        not Make_Vector_Spec(proto, type, VAL_SPECIFIER(type))
+        or VAL_VECTOR_LEN_AT(proto) != 1
+    ){
+        fail (type);
+    }
+
+    if (VAL_INDEX(binary) != 0)
+        fail ("Vectors can only be made from a BINARY! at its head");
+
+    REBBIN *bin = m_cast(REBBIN*, VAL_BINARY(binary));
+    REBSIZ wide = VAL_VECTOR_WIDE(proto);
+    REBSIZ size = BIN_LEN(bin);
+    if (size % wide != 0)
+        fail ("BINARY! length isn't a multiple of the vector element size");
+
+    if (swap and wide != 1) {
+        const REBYTE *src = BIN_HEAD(bin);
+        bin = Make_Binary(size);
+        REBYTE *dest = BIN_HEAD(bin);
+        REBSIZ n;
+        for (n = 0; n < size; n += wide) {
+            REBSIZ i;
+            for (i = 0; i < wide; ++i)
+                dest[n + i] = src[n + wide - 1 - i];
+        }
+        TERM_BIN_LEN(bin, size);
+    }
+
+    return Init_Vector(
+        out,
+        bin,
+        VAL_VECTOR_SIGN(proto),
+        VAL_VECTOR_INTEGRAL(proto),
+        VAL_VECTOR_BITSIZE(proto)
+    );
+}
+
+
 //
 //  TO_Vector: C
 //
@@ -631,6 +1773,9 @@ REBTYPE(Vector)
           case SYM_LENGTH:
             return Init_Integer(D_OUT, VAL_VECTOR_LEN_AT(v));
 
+          case SYM_BYTES:  // the vector's own storage, not a copy
+            return Init_Binary(D_OUT, VAL_BINARY(VAL_VECTOR_BINARY(v)));
+
           default:
             break;
         }
@@ -657,6 +1802,12 @@ REBTYPE(Vector)
             VAL_VECTOR_BITSIZE(v)
         ); }
 
+    case SYM_ADD:
+    case SYM_SUBTRACT:
+    case SYM_MULTIPLY:
+    case SYM_DIVIDE:
+        return Vector_Math(D_OUT, VAL_WORD_ID(verb), v, D_ARG(2));
+
     case SYM_RANDOM: {
         INCLUDE_PARAMS_OF_RANDOM;
         UNUSED(PAR(value));
@@ -669,6 +1820,38 @@ REBTYPE(Vector)
         Shuffle_Vector(v, did REF(secure));
         RETURN (v); }
 
+    case SYM_RANDOM_FILL: {
+        INCLUDE_PARAMS_OF_RANDOM_FILL;
+        UNUSED(PAR(series));
+
+        ENSURE_MUTABLE(VAL_VECTOR_BINARY(v));
+
+        REBLEN len = VAL_VECTOR_LEN_AT(v);
+        if (REF(part)) {
+            REBINT limit = VAL_INT32(ARG(part));
+            if (limit < 0)
+                fail (PAR(part));
+            if (cast(REBLEN, limit) < len)
+                len = limit;
+        }
+        Random_Fill_Vector(v, len);
+        RETURN (v); }
+
+    case SYM_SORT: {
+        INCLUDE_PARAMS_OF_SORT;
+        UNUSED(PAR(series));
+
+        ENSURE_MUTABLE(VAL_VECTOR_BINARY(v));
+
+        if (REF(skip) or REF(compare) or REF(part) or REF(all) or REF(key))
+            fail (Error_Bad_Refines_Raw());
+
+        UNUSED(REF(case));  // elements are numbers
+        UNUSED(REF(stable));  // radix sort is always stable
+
+        Sort_Vector(v, did REF(reverse));
+        RETURN (v); }
+
     default:
         break;
     }
@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+
+#
+# make-pgo.sh
+#
+# Builds a release interpreter with link-time and profile-guided optimization.
+# This takes two builds in the %build/ directory:
+#
+# 1. An instrumented build (`pgo=generate`), which is run on the benchmark
+#    suite in %tests/benchmarks.reb to record which code is hot.
+#
+# 2. The optimized build (`pgo=use`), which starts over from clean objects
+#    and compiles using that profile.
+#
+# Arguments are passed to both runs of make.r (after the config), so e.g.
+# `./make-pgo.sh extensions="[ODBC +]"` works like it does with %make.sh.
+#
+
+set -e
+
+# The utility scripts in %bash/ all expect $repo_dir to be set
+# Note Ren-C conventions always include slashes in directory names
+#
+repo_dir=$(cd `dirname $0` && pwd)/
+
+source ${repo_dir}tools/bash/log.sh
+source ${repo_dir}tools/bash/fetch-prebuilt.sh
+
+r3make=$(fetch_prebuilt)
+if [[ -n $r3make ]]; then
+    echo "Selected prebuilt binary: $r3make"
+else
+    echo "Error: no prebuilt binary available"
+    exit 1
+fi
+
+mkdir -p "${repo_dir}build"
+cd "${repo_dir}build"
+rm -rf pgo-data/  # profiles from a different source tree would mislead
+
+echo "Stage 1: instrumented build"
+"$r3make" ../make.r config=../configs/release-lto.r pgo=generate $@
+
+echo "Stage 2: training run"
+./r3 ../tests/benchmarks.reb --rounds 3
+
+# Clang writes raw profiles, which have to be merged into what -fprofile-use
+# looks for in the directory.  (GCC's .gcda files and MSVC's .pgc files are
+# used as they are.)
+#
+if compgen -G "pgo-data/*.profraw" > /dev/null; then
+    llvm-profdata merge -output=pgo-data/default.profdata pgo-data/*.profraw
+fi
+
+echo "Stage 3: optimized build"
+"$r3make" ../make.r config=../configs/release-lto.r pgo=use $@
@@ -682,6 +682,10 @@ gen-obj: func [
                     ;for make-header. ignoring
                     _
                 ]
+                <no-amalgamate> [
+                    ;for make-amalgamation. ignoring
+                    _
+                ]
                 <no-unreachable> [
                     <msc:/wd4702>
                 ]
@@ -837,6 +841,15 @@ targets: [
             ]
         ]
     ]
+    'bench [
+        rebmake/execution/run make rebmake/solution-class [
+            depends: flatten reduce [
+                vars
+                t-folders
+                bench
+            ]
+        ]
+    ]
     'library [
         rebmake/execution/run make rebmake/solution-class [
             depends: flatten reduce [
@@ -1263,6 +1276,78 @@ append app-config/ldflags switch user-config/static [
 ]
 
 
+; Link-time optimization lets the compiler inline across the .c files, e.g.
+; natives into the evaluator, or Try_Fill_Pool() into the series allocators.
+; (The %sys-xxx.h inline functions are already in every file that uses them.)
+;
+switch user-config/lto [
+    _ 'no 'off 'false #[false] [
+        ; pass
+    ]
+    'yes 'on 'true #[true] [
+        append app-config/cflags [<gnu:-flto> <msc:/GL>]
+        append app-config/ldflags [<gnu:-flto> <msc:/LTCG>]
+    ]
+
+    fail ["LTO must be yes, no or logic! not" (user-config/lto)]
+]
+
+; Profile-guided optimization is a two-build process, with a training run of
+; the instrumented executable in between (see %make-pgo.sh).  Both builds have
+; to be done in the same build directory, since that's where the profile data
+; is kept and MSVC looks for its .pgd file next to the executable.
+;
+; Clang writes raw profiles that have to be merged into %default.profdata
+; (with `llvm-profdata merge`) before they can be used.  When the directory is
+; given to -fprofile-use, that's the filename it looks for.
+;
+pgo-dir: file-to-local make-file [(output-dir) pgo-data /]
+switch user-config/pgo [
+    _ 'no 'off 'false #[false] [
+        ; pass
+    ]
+    'generate [
+        make-dir make-file [(output-dir) pgo-data /]
+        append app-config/cflags reduce [
+            to tag! unspaced ["gnu:-fprofile-generate=" pgo-dir]
+            <msc:/GL>
+        ]
+        append app-config/ldflags reduce [
+            to tag! unspaced ["gnu:-fprofile-generate=" pgo-dir]
+            <msc:/LTCG>
+            <msc:/GENPROFILE>
+        ]
+    ]
+    'use [
+        append app-config/cflags reduce [
+            to tag! unspaced ["gnu:-fprofile-use=" pgo-dir]
+            <msc:/GL>
+        ]
+        append app-config/ldflags reduce [
+            to tag! unspaced ["gnu:-fprofile-use=" pgo-dir]
+            <msc:/LTCG>
+            <msc:/USEPROFILE>
+        ]
+    ]
+
+    fail ["PGO must be no, generate or use, not" (user-config/pgo)]
+]
+
+; Amalgamating compiles the core as one file, %prep/core/rebol-core.c, which
+; %make-amalgamation.r pastes together from the %src/core/ files.  That gets
+; much of the cross-file inlining of LTO with any compiler.  The files marked
+; <no-amalgamate> in %file-base.r are compiled on their own, as usual.
+;
+cfg-amalgamate: switch user-config/amalgamate [
+    _ 'no 'off 'false #[false] [false]
+    'yes 'on 'true #[true] [true]
+
+    fail [
+        "AMALGAMATE must be yes, no or logic! not" (user-config/amalgamate)
+    ]
+]
+
+
 ;add system settings
 add-app-def: adapt specialize :append [series: app-config/definitions] [
     value: replace/all (
@@ -1337,8 +1422,33 @@ libr3-core: make rebmake/object-library-class [
 
     optimization: app-config/optimization
     debug: app-config/debug
-    depends: map-each w file-base/core [
-        gen-obj/dir w make-file [(src-dir) core /]
+    depends: either cfg-amalgamate [
+        ;
+        ; The single file gets the warning switches of all the files in it.
+        ; (#prefer-O2-optimization isn't passed on, as it's meant for only
+        ; a few files and the amalgamation would be all of the core.)
+        ;
+        amalgamated: copy [rebol-core.c]
+        separate: copy []
+        for-each w file-base/core [
+            case [
+                not block? w [continue]
+                find w <no-amalgamate> [append/only separate w]
+            ] else [
+                for-each flag next w [
+                    if not tag? flag [continue]
+                    if <no-make-header> = flag [continue]
+                    if not find amalgamated flag [append amalgamated flag]
+                ]
+            ]
+        ]
+        append map-each w separate [
+            gen-obj/dir w make-file [(src-dir) core /]
+        ] gen-obj/dir amalgamated "prep/core/"
+    ][
+        map-each w file-base/core [
+            gen-obj/dir w make-file [(src-dir) core /]
+        ]
     ]
     append depends map-each w file-base/generated [
         gen-obj/dir w "prep/core/"
@@ -1361,6 +1471,21 @@ main: make libr3-core [
     ]
 ]
 
+; The `r3-bench` executable calls internal routines directly, so it's built
+; like the core (e.g. with %prep/core includes) and not like %main.c
+;
+bench-main: make libr3-core [
+    name: 'bench-main
+
+    definitions: join ["REB_API"] app-config/definitions
+    includes: join app-config/includes %prep/core  ; generator may modify
+    cflags: copy app-config/cflags  ; generator may modify
+
+    depends: reduce [
+        gen-obj/dir file-base/bench make-file [(src-dir) main /]
+    ]
+]
+
 pthread: make rebmake/ext-dynamic-class [
     output: %pthread
     flags: [static]
@@ -1709,6 +1834,10 @@ prep: make rebmake/entry-class [
         ]
 
         keep [{$(REBOL)} make-file [(src-dir) main/prep-main.reb]]
+
+        if cfg-amalgamate [
+            keep [{$(REBOL)} make-file [(tools-dir) make-amalgamation.r]]
+        ]
     ]
     depends: reduce [
         reb-tool
@@ -1765,7 +1894,7 @@ for-each [category entries] file-base [
     switch type of entries [
         word!  ; if bootstrap
         tuple! [  ; if generic-tuple enabled
-            assert [entries = 'main.c]  ; !!! anomaly, ignore it for now
+            assert [find [main.c core-bench.c] entries]  ; !!! anomaly, ignore it
         ]
         block! [
             for-each entry entries [
@@ -1817,6 +1946,25 @@ app: make rebmake/application-class [
     definitions: app-config/definitions
 ]
 
+bench: make rebmake/application-class [
+    name: 'r3-bench-exe
+    output: %r3-bench  ; no suffix
+    depends: compose [
+        (libr3-core)
+        ((ext-objs))
+        ((app-config/libraries))
+        (bench-main)
+    ]
+
+    searches: app-config/searches
+    ldflags: app-config/ldflags
+    cflags: app-config/cflags
+    optimization: app-config/optimization
+    debug: app-config/debug
+    includes: app-config/includes
+    definitions: app-config/definitions
+]
+
 library: make rebmake/dynamic-library-class [
     name: 'libr3
     output: %libr3 ;no suffix
@@ -1934,6 +2082,9 @@ clean: make rebmake/entry-class [
         make rebmake/cmd-delete-class [
             file: join %r3 opt rebmake/target-platform/exe-suffix
         ]
+        make rebmake/cmd-delete-class [
+            file: join %r3-bench opt rebmake/target-platform/exe-suffix
+        ]
         make rebmake/cmd-delete-class [file: %libr3.*]
     ]
 ]
@@ -1967,6 +2118,8 @@ solution: make rebmake/solution-class [
         libr3-core
         main
         app
+        bench-main
+        bench
         library
         dynamic-libs
         ext-dynamic-objs
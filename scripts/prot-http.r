@@ -12,7 +12,7 @@ REBOL [
     Name: http
     Type: module
     File: %prot-http.r
-    Version: 0.1.48
+    Version: 0.1.49
     Purpose: {
         This program defines the HTTP protocol scheme for REBOL 3.
     }
@@ -129,6 +129,22 @@ http-awake: function [return: [logic!] event [event!]] [
             awake make event! [type: 'connect port: http-port]
         ]
         'close [
+            all [
+                state/reused
+                find [doing-request reading-headers] ^state/mode
+            ] then [
+                ; A pooled connection the server closed while it was idle
+                ; can't be told from a good one until it's used.  Nothing of
+                ; the response arrived, so it's safe to try a new connection.
+                ;
+                net-log/C "Idle connection was closed by server, reconnecting"
+                close port
+                port/awake: _
+                state/reused: no
+                state/mode: 'inited
+                state/connection: open-connection http-port
+                return false
+            ]
             res: try switch state/mode [
                 'ready [
                     awake make event! [type: 'close port: http-port]
@@ -145,6 +161,10 @@ http-awake: function [return: [logic!] event [event!]] [
                         http-port/error: make-http-error "Server closed connection"
                         awake make event! [type: 'error port: http-port]
                     ] [
+                        if state/inflater [  ; check compressed data ended
+                            emit-body/finish http-port #{}
+                        ]
+
                         ; set mode to CLOSE so the WAIT loop in 'sync-op can
                         ; be interrupted
                         ;
@@ -228,8 +248,11 @@ do-request: function [
             form spec/host
         ]
         User-Agent: "REBOL"
+        ((if spec/decompress '[Accept-Encoding: "gzip, deflate"]))
     ] spec/headers
     port/state/mode: 'doing-request
+    port/state/chunk: port/state/inflater: _
+    port/state/received: 0
     info/headers: info/response-line: info/response-parsed: port/data:
     info/size: info/date: info/name: blank
     write port/state/connection
@@ -310,6 +333,11 @@ check-response: function [port] [
         if headers/last-modified [
             info/date: try attempt [idate-to-date headers/last-modified]
         ]
+        state/inflater: all [
+            spec/decompress
+            find ["gzip" "deflate"] try select headers 'Content-Encoding
+            inflater/envelope 'detect  ; "deflate" is usually really zlib
+        ]
         remove/part conn/data d2
         state/mode: 'reading-data
         if '(txt) <> last body-of :net-log [ ; net-log is in active state
@@ -375,6 +403,10 @@ check-response: function [port] [
         spec/debug: info
     ]
 
+    ; Only the body of a successful response is decompressed or streamed.
+    ;
+    if info/response-parsed <> 'ok [state/inflater: _]
+
     switch/all info/response-parsed [
         'ok [
             if spec/method = 'HEAD [
@@ -535,8 +567,11 @@ do-redirect: func [
     then [
         spec/path: new-uri/path
         ;we need to reset tcp connection here before doing a redirect
-        close port/state/connection
-        open port/state/connection
+        ;(unless the response left it ready for another request)
+        if not reusable? port [
+            close port/state/connection
+            open port/state/connection
+        ]
         do-request port
         false
     ]
@@ -555,6 +590,32 @@ do-redirect: func [
     ]
 ]
 
+emit-body: function [
+    {Pass a piece of response body on to the SINK, or add it to PORT/DATA}
+
+    return: <none>
+    port [port!]
+    data [binary!]
+    /finish "The body is over (also checks compressed data ended properly)"
+][
+    state: port/state
+    if state/inflater [
+        data: either finish [
+            zstream-step/finish state/inflater data
+        ][
+            zstream-step state/inflater data
+        ]
+    ]
+
+    sink: if state/info/response-parsed = 'ok [:port/spec/sink]
+    case [
+        empty? data []
+        action? :sink [sink data]
+        port? :sink [write sink data]
+        true [append port/data data]
+    ]
+]
+
 check-data: function [
     return: [logic! event!]
     port [port!]
@@ -563,6 +624,14 @@ check-data: function [
     headers: state/info/headers
     conn: state/connection
 
+    ; When streaming, body is handed to EMIT-BODY as it arrives--instead of
+    ; PORT/DATA taking over the connection's buffer when the body is done.
+    ;
+    stream?: did all [
+        state/info/response-parsed = 'ok
+        any [:port/spec/sink, state/inflater]
+    ]
+
     res: false
     awaken-wait-loop: does [
         not res so res: true  ; prevent timeout when reading big data
@@ -572,55 +641,73 @@ check-data: function [
         headers/transfer-encoding = "chunked" [
             data: conn/data
             port/data: default [  ; only clear at request start
-                make binary! length of data
+                make binary! either stream? [0] [length of data]
             ]
-            out: port/data
 
-            loop [parse? data [
-                copy chunk-size: some hex-digits, thru crlfbin
-                mk1: here, to end
-            ]][
-                ; The chunk size is in the byte stream as ASCII chars
-                ; forming a hex string.  DEBASE to get a BINARY! and then
-                ; DEBIN to get an integer.
-                ;
-                ; It's not guaranteed that the chunk size is an even number
-                ; of hex digits!  If it's not, insert a 0, since DEBASE 16
-                ; would reject it otherwise.
-                ;
-                if odd? length of chunk-size [
-                    insert chunk-size #0
-                ]
-                chunk-size: debin [be +] (debase/base as text! chunk-size 16)
-
-                if chunk-size = 0 [
-                    parse mk1 [
-                        crlfbin (trailer: "") to end
-                            |
-                        copy trailer to crlf2bin to end
-                    ] then [
-                        trailer: scan-net-header as binary! trailer
-                        append headers trailer
-                        state/mode: 'ready
-                        res: state/awake make event! [
-                            type: 'custom
-                            port: port
-                            code: 0
-                        ]
-                        clear data
+            ; STATE/CHUNK is how much of the current chunk is still to come,
+            ; or 'CRLF for the line end after it, or BLANK! for a size line.
+            ; Partial chunks are passed on, so a big chunk isn't held whole.
+            ;
+            loop [not empty? data] [
+                case [
+                    integer? state/chunk [
+                        n: min state/chunk length of data
+                        emit-body port copy/part data n
+                        remove/part data n
+                        state/chunk: state/chunk - n
+                        if state/chunk = 0 [state/chunk: 'crlf]
                     ]
-                    break
-                ]
-                else [
-                    parse mk1 [
-                        repeat (chunk-size) skip, mk2: here, crlfbin, to end
-                    ] else [
-                        break
+                    state/chunk = 'crlf [
+                        if (length of data) < 2 [break]
+                        remove/part data 2
+                        state/chunk: _
                     ]
+                    true [
+                        if not parse? data [
+                            copy chunk-size: some hex-digits, thru crlfbin
+                            mk1: here, to end
+                        ][
+                            break  ; size line not all here yet
+                        ]
+
+                        ; The chunk size is in the byte stream as ASCII chars
+                        ; forming a hex string.  DEBASE to get a BINARY! and
+                        ; then DEBIN to get an integer.
+                        ;
+                        ; It's not guaranteed that the chunk size is an even
+                        ; number of hex digits!  If it's not, insert a 0,
+                        ; since DEBASE 16 would reject it otherwise.
+                        ;
+                        if odd? length of chunk-size [
+                            insert chunk-size #0
+                        ]
+                        chunk-size: debin [be +] (
+                            debase/base as text! chunk-size 16
+                        )
+
+                        if chunk-size = 0 [
+                            parse mk1 [
+                                crlfbin (trailer: "") to end
+                                    |
+                                copy trailer to crlf2bin to end
+                            ] then [
+                                trailer: scan-net-header as binary! trailer
+                                append headers trailer
+                                emit-body/finish port #{}
+                                state/mode: 'ready
+                                res: state/awake make event! [
+                                    type: 'custom
+                                    port: port
+                                    code: 0
+                                ]
+                                clear data
+                            ]
+                            break
+                        ]
 
-                    append/part out mk1 ((index of mk2) - (index of mk1))
-                    remove/part data skip mk2 2
-                    empty? data
+                        remove/part data mk1
+                        state/chunk: chunk-size
+                    ]
                 ]
             ]
 
@@ -628,6 +715,27 @@ check-data: function [
                 awaken-wait-loop
             ]
         ]
+        all [stream?, integer? headers/content-length] [
+            port/data: default [make binary! 0]
+            n: min (length of conn/data) (
+                headers/content-length - state/received
+            )
+            emit-body port copy/part conn/data n
+            remove/part conn/data n  ; anything after isn't this response's
+            state/received: state/received + n
+
+            if state/received = headers/content-length [
+                emit-body/finish port #{}
+                state/mode: 'ready
+                res: state/awake make event! [
+                    type: 'custom
+                    port: port
+                    code: 0
+                ]
+            ] else [
+                awaken-wait-loop
+            ]
+        ]
         integer? headers/content-length [
             port/data: conn/data
             if headers/content-length <= length of port/data [
@@ -642,6 +750,12 @@ check-data: function [
                 awaken-wait-loop
             ]
         ]
+        stream? [  ; body ends when the server closes (see HTTP-AWAKE)
+            port/data: default [make binary! 0]
+            emit-body port copy conn/data
+            clear conn/data
+            awaken-wait-loop
+        ]
     ] else [
         port/data: conn/data
         if state/info/response-parsed = 'ok [
@@ -657,6 +771,133 @@ check-data: function [
     return res
 ]
 
+; Connections which finished a response and may be reused, by the key from
+; CONNECTION-KEY.  Each entry is a block of [connection time-released] pairs,
+; oldest first.  Setting MAX-IDLE-PER-HOST to 0 turns pooling off.
+;
+; !!! Only idle connections are limited--there's no cap (or queue) for the
+; ones in use.  TLS sessions are reused along with their connections, but a
+; new connection does a full handshake, as %prot-tls.r can't resume yet.
+;
+idle-connections: make map! []
+max-idle-per-host: 4
+idle-timeout: 0:00:30
+
+connection-key: func [
+    return: [text!]
+    spec [object!]
+][
+    unspaced [spec/scheme "://" spec/host ":" spec/port-id]
+]
+
+reusable?: function [
+    {Could the port's connection be used for another request right now?}
+
+    return: [logic!]
+    port [port!]
+][
+    state: port/state
+    conn: state/connection
+    all [
+        max-idle-per-host > 0
+        state/mode = 'ready  ; response is complete...
+        headers: state/info/headers
+        any [blank? conn/data, empty? conn/data]  ; ...with nothing after it
+        any [
+            not integer? headers/content-length
+            blank? port/data  ; e.g. HEAD
+            all [  ; streamed, see EMIT-BODY
+                state/received > 0
+                state/received = headers/content-length
+            ]
+            headers/content-length >= length of port/data
+        ]
+        open? conn
+        either find state/info/response-line "HTTP/1.0" [
+            "keep-alive" = try select headers 'Connection
+        ][
+            "close" <> try select headers 'Connection
+        ]
+    ]
+]
+
+idle-awake: func [
+    {Awake for a pooled connection: any event means it can't be reused}
+    return: [logic!]
+    event [event!]
+][
+    if open? event/port [close event/port]  ; TAKE-IDLE-CONNECTION drops it
+    false
+]
+
+release-connection: function [
+    {Put a connection which finished its response into the idle pool}
+
+    return: <none>
+    conn [port!]
+    key [text!]
+][
+    conn/awake: :idle-awake
+    conn/locals: _
+    conn/data: _
+
+    idle: any [
+        select idle-connections key
+        put idle-connections key copy []
+    ]
+    append idle reduce [conn now/precise]
+
+    loop [(length of idle) > (2 * max-idle-per-host)] [
+        close take idle  ; oldest
+        take idle  ; its time
+    ]
+]
+
+take-idle-connection: function [
+    {Get an open, unexpired connection from the pool, or null if none}
+
+    return: [<opt> port!]
+    key [text!]
+][
+    idle: select idle-connections key else [return null]
+
+    ; Most recently released is most likely to still be good, and the older
+    ; ones expire first.
+    ;
+    loop [not empty? idle] [
+        released: take/last idle
+        conn: take/last idle
+        all [
+            open? conn
+            idle-timeout > difference now/precise released
+        ] then [
+            return conn
+        ]
+        if open? conn [close conn]
+    ]
+    return null
+]
+
+open-connection: function [
+    {Start opening a new TCP (or TLS) connection for an HTTP(S) port}
+
+    return: [port!]
+    port [port!]
+][
+    conn: make port! compose [
+        scheme: (
+            either port/spec/scheme = 'http [the 'tcp][the 'tls]
+        )
+        host: port/spec/host
+        port-id: port/spec/port-id
+        ref: join-all [tcp:// host ":" port-id]
+    ]
+    conn/awake: :http-awake
+    conn/locals: port
+    open conn
+    return conn
+]
+
 hex-digits: charset "1234567890abcdefABCDEF"
 sys/make-scheme [
     name: 'http
@@ -670,6 +911,15 @@ sys/make-scheme [
         timeout: 15
         debug: _
         follow: 'redirect
+
+        ; SINK is an ACTION! to call with each piece of the body as it comes
+        ; in, or a PORT! to WRITE each piece to (e.g. an open file).  The
+        ; body then isn't held in memory.  DECOMPRESS asks the server for
+        ; gzip or deflate, and inflates it as it arrives.  Both only apply
+        ; to successful (2xx) responses.
+        ;
+        sink: _
+        decompress: _
     ]
 
     info: make system/standard/file-info [
@@ -765,21 +1015,31 @@ sys/make-scheme [
                 ; state object.
 
                 connection: _
+                reused: no  ; connection came from the idle pool
+                chunk: _  ; progress through chunked body, see CHECK-DATA
+                received: 0  ; streamed body bytes, for Content-Length
+                inflater: _  ; INFLATER handle if body is being decompressed
                 close?: no
                 info: make port/scheme/info [type: 'file]
                 awake: ensure [action! blank!] :port/awake
             ]
-            port/state/connection: conn: make port! compose [
-                scheme: (
-                    either port/spec/scheme = 'http [the 'tcp][the 'tls]
-                )
-                host: port/spec/host
-                port-id: port/spec/port-id
-                ref: join-all [tcp:// host ":" port-id]
-            ]
-            conn/awake: :http-awake
-            conn/locals: port
-            open conn
+            if conn: take-idle-connection connection-key port/spec [
+                port/state/connection: conn
+                port/state/reused: yes
+                conn/awake: :http-awake
+                conn/locals: port
+
+                ; An open connection won't send a CONNECT event, but one is
+                ; expected (e.g. to kick off the request in SYNC-OP), so fake
+                ; it and let it take the same path a new connection would.
+                ;
+                insert system/ports/system make event! [
+                    type: 'connect
+                    port: conn
+                ]
+                return port
+            ]
+            port/state/connection: open-connection port
             port
         ]
 
@@ -797,10 +1057,16 @@ sys/make-scheme [
 
         close: func [
             port [port!]
+            <local> conn
         ][
             if port/state [
-                close port/state/connection
-                port/state/connection/awake: _
+                conn: port/state/connection
+                either reusable? port [
+                    release-connection conn connection-key port/spec
+                ][
+                    close conn
+                    conn/awake: _
+                ]
                 port/state: _
             ]
             port
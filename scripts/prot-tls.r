@@ -157,8 +157,11 @@ cipher-suites: compose [
     ; TLS_ECDHE_RSA_WITH_AES_256_CBC_SHA384 (0xc028)  "weak"
     ; TLS_ECDHE_RSA_WITH_AES_128_CBC_SHA256 (0xc027)  "weak"
     ;
-    ; We don't have "GCM" at this time.  However, due to @gchiu's use of
-    ; `schedule.pharmac.govt.nz` we do the suite they have that we can.
+    ; The crypt extension has AEAD-ENCRYPT and AEAD-DECRYPT for 'AES-GCM now,
+    ; but the GCM suites aren't wired in here yet (their records carry an
+    ; explicit nonce and no MAC, unlike what TLS-ENCRYPT-RECORD makes).  Due to
+    ; @gchiu's use of `schedule.pharmac.govt.nz` we do the suite they have
+    ; that we can.
     ; Since it's defined outside the TLS 1.2 spec it can have a different
     ; HMAC and PRF hash, and... it does, it uses SHA384:
     ; https://tools.ietf.org/html/rfc5289
@@ -784,13 +787,7 @@ encrypted-handshake-msg: func [
     ctx [object!]
     unencrypted [binary!]
 ][
-    let encrypted: encrypt-data/type ctx unencrypted #{16}
-    emit ctx [
-        #{16}                         ; protocol type (22=Handshake)
-        ctx/ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
-    ]
+    emit ctx encrypt-record ctx 22 unencrypted  ; 22=Handshake
     append ctx/handshake-messages unencrypted
 ]
 
@@ -800,26 +797,24 @@ application-data: func [
     ctx [object!]
     unencrypted [binary! text!]
 ][
-    let encrypted: encrypt-data ctx to binary! unencrypted
-    emit ctx [
-        #{17}                         ; protocol type (23=Application)
-        ctx/ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
+    ; A record can't hold more than 16K, so bigger data is split up, with
+    ; each record getting its own sequence number.  (DO-COMMANDS increments
+    ; the number after the last one.)
+    ;
+    let data: to binary! unencrypted
+    loop [(length of data) > 16384] [
+        emit ctx encrypt-record ctx 23 copy/part data 16384  ; 23=Application
+        data: skip data 16384
+        ctx/seq-num-w: ctx/seq-num-w + 1
     ]
+    emit ctx encrypt-record ctx 23 data
 ]
 
 
 alert-close-notify: func [
     ctx [object!]
 ][
-    let encrypted: encrypt-data ctx #{0100} ; close notify
-    emit ctx [
-        #{15}                         ; protocol type (21=Alert)
-        ctx/ver-bytes                 ; protocol version
-        to-2bin length of encrypted  ; length of SSL record data
-        encrypted
-    ]
+    emit ctx encrypt-record ctx 21 #{0100}  ; 21=Alert, close notify
 ]
 
 
@@ -857,106 +852,61 @@ finished: func [
 ]
 
 
-encrypt-data: func [
+; The MAC, padding, and AES-CBC of each record (with a random IV in front
+; in TLS 1.1 and up) are done by TLS-ENCRYPT-RECORD and TLS-DECRYPT-RECORD
+; in the crypt extension, with keys set up once per direction:
+; https://tools.ietf.org/html/rfc5246#section-6.2.3.2
+;
+; TLS 1.0 had no per-record IV, but chained the CBC from record to record
+; starting with an IV from the key block.  The record key keeps that chain.
+
+encrypt-record: func [
+    {Make a whole record (header included) of encrypted and MAC'd content}
+
     return: [binary!]
     ctx [object!]
-    content [binary!]
-    /type
-        [binary!] "application data is default"
+    type "Content type (e.g. 23 for application data)"
+        [integer!]
+    content "No more than 16384 bytes"
+        [binary!]
 ][
-    type: default [#{17}]  ; #application
-
-    ; GenericBlockCipher: https://tools.ietf.org/html/rfc5246#section-6.2.3.2
-
-    if ctx/version > 1.0 [
-        ;
-        ; "The Initialization Vector (IV) SHOULD be chosen at random, and
-        ;  MUST be unpredictable.  Note that in versions of TLS prior to 1.1,
-        ;  there was no IV field, and the last ciphertext block of the
-        ;  previous record (the "CBC residue") was used as the IV.  This was
-        ;  changed to prevent the attacks described in [CBCATT].  For block
-        ;  ciphers, the IV length is SecurityParameters.record_iv_length,
-        ;  which is equal to the SecurityParameters.block_size."
-        ;
-        ctx/client-iv: copy #{}
-        repeat ctx/block-size [append ctx/client-iv (random-secure 256) - 1]
-    ]
-
-    ; Message Authentication Code
-    ; https://tools.ietf.org/html/rfc5246#section-6.2.3.1
-    ;
-    let MAC: checksum/method/key join-all [
-        to-8bin ctx/seq-num-w               ; sequence number (64-bit int)
-        type                                ; msg type
-        ctx/ver-bytes                       ; version
-        to-2bin length of content           ; msg content length
-        content                             ; msg content
-    ] ctx/hash-method ctx/client-mac-key
-
-    let data: join-all [content MAC]
-
-    if ctx/block-size [
-        ; add the padding data in CBC mode
-        let padding: ctx/block-size - (
-            remainder (1 + (length of data)) ctx/block-size
-        )
-        let len: 1 + padding
-        append data head of insert/dup make binary! len to-1bin padding len
-    ]
-
-    switch ctx/crypt-method [
-        '^aes [
-            ctx/encrypt-stream: default [
-                aes-key ctx/client-crypt-key ctx/client-iv
-            ]
-            data: aes-stream ctx/encrypt-stream data
-
-            if ctx/version > 1.0 [
-                ; encrypt-stream must be reinitialized each time with the
-                ; new initialization vector.
-                ;
-                ctx/encrypt-stream: _
-            ]
-        ]
-    ] else [
+    if ctx/crypt-method <> '^aes [
         fail ["Unsupported TLS crypt-method:" ctx/crypt-method]
     ]
-
-    ; TLS versions 1.1 and above include the client-iv in plaintext.
-    ;
-    if ctx/version > 1.0 [
-        insert data ctx/client-iv
-        unset in ctx 'client-iv  ; avoid accidental reuse
+    ctx/write-key: default [
+        let iv: if ctx/version = 1.0 [ctx/client-iv] else [_]
+        tls-record-key ctx/hash-method
+            ctx/client-mac-key ctx/client-crypt-key iv
     ]
-
-    return data
+    let version: ctx/ver-bytes
+    let seq: ctx/seq-num-w
+    return tls-encrypt-record ctx/write-key type version seq content
 ]
 
 
-decrypt-data: func [
+decrypt-record: func [
+    {Decrypt a record's fragment, failing if its MAC or padding is wrong}
+
     return: [binary!]
     ctx [object!]
-    data [binary!]
+    type "Content type from the record header"
+        [integer!]
+    fragment [binary!]
 ][
-    switch ctx/crypt-method [
-        '^aes [
-            ctx/decrypt-stream: default [
-                aes-key/decrypt ctx/server-crypt-key ctx/server-iv
-            ]
-            data: aes-stream ctx/decrypt-stream data
-
-            ; TLS 1.1 and above must use a new initialization vector each time
-            ; so the decrypt stream has to get GC'd.
-            ;
-            if ctx/version > 1.0 [
-                ctx/decrypt-stream: _
-            ]
-        ]
-    ] else [
+    if ctx/crypt-method <> '^aes [
         fail ["Unsupported TLS crypt-method:" ctx/crypt-method]
     ]
-
-    return data
+    ctx/read-key: default [
+        let iv: if ctx/version = 1.0 [ctx/server-iv] else [_]
+        tls-record-key/decrypt ctx/hash-method
+            ctx/server-mac-key ctx/server-crypt-key iv
+    ]
+    let version: ctx/ver-bytes
+    let seq: ctx/seq-num-r
+    ctx/seq-num-r: seq + 1
+    return tls-decrypt-record ctx/read-key type version seq fragment else [
+        fail "Bad record MAC"
+    ]
 ]
 
 
@@ -974,8 +924,9 @@ parse-protocol: func [
     ])
 ][
     return make object! [
-        type: select protocol-types data/1 else [
-            fail ["unknown/invalid protocol type:" data/1]
+        code: data/1  ; the content type byte, which the MAC covers
+        type: select protocol-types code else [
+            fail ["unknown/invalid protocol type:" code]
         ]
         version: select bytes-to-version copy/part at data 2 2
         size: debin [be +] copy/part at data 4 2
@@ -1067,34 +1018,14 @@ parse-messages: func [
     let data: proto/messages
 
     if ctx/encrypted? [
-        all [ctx/block-size, ctx/version > 1.0] then [
-            ;
-            ; Grab the server's initialization vector, which will be new for
-            ; each message.
-            ;
-            ctx/server-iv: take/part data ctx/block-size
-        ]
-
-        change data decrypt-data ctx data
-        debug ["decrypting..."]
-
-        if ctx/block-size [
-            ; deal with padding in CBC mode
-            data: copy/part data (
-                ((length of data) - 1) - (last data)
-            )
-            debug ["depadding..."]
-            if ctx/version > 1.0 [
-                unset in ctx 'server-iv  ; avoid reuse in TLS 1.1 and above
-            ]
-        ]
+        data: decrypt-record ctx proto/code data  ; checks MAC, strips it
         debug ["data:" data]
     ]
     debug [ctx/seq-num-r ctx/seq-num-w "READ <--" proto/type]
 
     if proto/type <> #handshake [
         if proto/type = #alert [
-            if proto/messages/1 > 1 [
+            if data/1 > 1 [
                 ; fatal alert level
                 fail [select alert-descriptions data/2 else ["unknown"]]
             ]
@@ -1390,7 +1321,6 @@ parse-messages: func [
                     ]
 
                     <finished> [
-                        ctx/seq-num-r: 0
                         let seed: if ctx/version < 1.2 [
                             join-all [
                                 checksum 'md5 ctx/handshake-messages
@@ -1427,59 +1357,26 @@ parse-messages: func [
 
                 append ctx/handshake-messages copy/part data len + 4
 
-                let skip-amount: either ctx/encrypted? [
-                    let mac: copy/part skip data len + 4 ctx/hash-size
-
-                    let mac-check: checksum/method/key join-all [
-                        to-8bin ctx/seq-num-r   ; 64-bit sequence number
-                        #{16}                   ; msg type
-                        ctx/ver-bytes           ; version
-                        to-2bin len + 4         ; msg content length
-                        copy/part data len + 4
-                    ] ctx/hash-method ctx/server-mac-key
-
-                    if mac <> mac-check [
-                        fail "Bad handshake record MAC"
-                    ]
-
-                    4 + ctx/hash-size
-                ][
-                    4
-                ]
-
-                data: skip data (len + skip-amount)
+                data: skip data (len + 4)
             ]
         ]
 
         <change-cipher-spec> [
             ctx/encrypted?: true
+            ctx/seq-num-r: 0  ; numbering starts over for encrypted records
             append result context [
                 type: 'ccs-message-type
             ]
         ]
 
         #application [
-            append result let msg-obj: context [
+            append result context [
                 type: 'app-data
-                content: copy/part data (length of data) - ctx/hash-size
-            ]
-            let len: length of msg-obj/content
-            let mac: copy/part skip data len ctx/hash-size
-            let mac-check: checksum/method/key join-all [
-                to-8bin ctx/seq-num-r   ; sequence number (64-bit int in R3)
-                #{17}                   ; msg type
-                ctx/ver-bytes           ; version
-                to-2bin len             ; msg content length
-                msg-obj/content         ; content
-            ] ctx/hash-method ctx/server-mac-key
-
-            if mac <> mac-check [
-                fail "Bad application record MAC"
+                content: data  ; DECRYPT-RECORD checked and removed the MAC
             ]
         ]
     ]
 
-    ctx/seq-num-r: ctx/seq-num-r + 1
     return result
 ]
 
@@ -1684,27 +1581,22 @@ tls-read-data: func [
     let data: append ctx/data-buffer port-data
     clear port-data
 
-    ; !!! Why is this making a copy (5 = length of copy...) when just trying
-    ; to test a size?
-    ;
-    loop [5 = length of copy/part data 5] [
-        let len: 5 + debin [be +] copy/part at data 4 2
+    loop [(length of data) >= 5] [  ; enough for a record header
+        let len: 5 + (data/4 * 256) + data/5
 
         debug ["reading bytes:" len]
 
-        let fragment: copy/part data len
-
-        if len > length of fragment [
+        if len > length of data [  ; don't copy it until it's all here
             debug [
                 "incomplete fragment:"
-                "read" length of fragment "of" len "bytes"
+                "read" length of data "of" len "bytes"
             ]
             break
         ]
 
-        debug ["received bytes:" length of fragment, "parsing response..."]
+        debug ["received bytes:" len, "parsing response..."]
 
-        append ctx/resp parse-response ctx fragment
+        append ctx/resp parse-response ctx copy/part data len
 
         data: skip data len
 
@@ -1991,8 +1883,8 @@ sys/make-scheme [
                 ecdh-keypair: _
                 ecdh-pub: _
 
-                encrypt-stream: _
-                decrypt-stream: _
+                write-key: _  ; TLS-RECORD-KEY handles, made when first used
+                read-key: _
 
                 connection: _
             ]
@@ -2031,30 +1923,12 @@ sys/make-scheme [
 
             close port/state/connection
 
-            ; The symmetric ciphers used by TLS are able to encrypt chunks of
-            ; data one at a time.  It keeps the progressive state of the
-            ; encryption process in the -stream variables, which under the
-            ; hood are memory-allocated items stored as a HANDLE!.
-            ;
-            ; Calling the encryption functions with BLANK! as the data to
-            ; input will assume you are done, and will free the handle.
-            ;
-            ; !!! Is there a good reason for not doing this with an ordinary
-            ; OBJECT! containing a BINARY! ?
+            ; The record keys are HANDLE!s whose memory (with the expanded AES
+            ; keys in it) is zeroed and freed when they are GC'd.
             ;
             if port/state/suite [
-                switch port/state/crypt-method [
-                    '^aes [
-                        if port/state/encrypt-stream [
-                            port/state/encrypt-stream: _  ; will be GC'd
-                        ]
-                        if port/state/decrypt-stream [
-                            port/state/decrypt-stream: _  ; will be GC'd
-                        ]
-                    ]
-                ] else [
-                    fail ["Unknown TLS crypt-method" port/state/crypt-method]
-                ]
+                port/state/write-key: _
+                port/state/read-key: _
             ]
 
             debug "TLS/TCP port closed"
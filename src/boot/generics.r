@@ -244,6 +244,15 @@ random: generic [
     /only   {Pick a random value from a series}
 ]
 
+random-fill: generic [
+    {Overwrites with random values from the position to the tail (not secure)}
+    return: [any-value!]
+    series "BINARY! gets random bytes, VECTOR! random elements (modified)"
+        [any-value!]
+    /part "Limits to a given length"
+        [integer!]
+]
+
 odd?: generic [
     {Returns TRUE if the number is odd.}
     number [any-number! char! date! money! time! pair!]
@@ -458,6 +467,11 @@ sort: generic [
         [any-number! any-series!]
     /all "Compare all fields"
     /reverse "Reverse sort order"
+    /stable "Keep the original order of items that compare as equal"
+    /key "Sort by what a function returns for each item (called once each)"
+        [action!]
+    /threads "Use up to this many threads for large natively compared sorts"
+        [integer!]
 ]
 
 ; Port actions:
@@ -490,6 +504,12 @@ close: generic [
     port [port!]  ; !!! See Extend_Generics_Someday() for why LIBRARY! works
 ]
 
+flush: generic [
+    {Write out any data a port is holding on to in a buffer}
+    return: [port!]
+    port [port!]
+]
+
 read: generic [
     {Read from a file, URL, or other port.}
     return: "null on (some) failures (REVIEW as part of port model review)" [
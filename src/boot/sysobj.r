@@ -131,6 +131,7 @@ options: make object! [  ; Options supplied to REBOL during startup
     binary-base: 16    ; Default base for FORMed binary values (64, 16, 2)
     decimal-digits: 15 ; Max number of decimal digits to print.
     module-paths: [%./]
+    scan-cache: _      ; Directory in which LOAD caches scans of source files
     default-suffix: %.reb ; Used by IMPORT if no suffix is provided
     file-types: copy [
         %.reb %.r3 %.r rebol
@@ -312,6 +313,17 @@ standard: make object! [
         ; otherwise the OS will pick an available port and stick with it.)
         ;
         local-id: _
+
+        ; Tuning for throughput vs. latency, taken at OPEN (and inherited by
+        ; connections a listening port accepts).  BLANK! means OS default.
+        ;
+        read-size: _  ; bytes to make room for on each READ without /PART
+        receive-buffer: _  ; SO_RCVBUF, in bytes
+        send-buffer: _  ; SO_SNDBUF, in bytes
+        no-delay: _  ; TCP_NODELAY: send small writes at once, no coalescing
+        keep-alive: _  ; SO_KEEPALIVE: probe idle connections
+        quick-ack: _  ; TCP_QUICKACK: don't delay ACKs (Linux only)
+        reuse-port: _  ; SO_REUSEPORT: let processes share a listening port
     ]
 
     port-spec-serial: make port-spec-head [
@@ -277,7 +277,9 @@ shift
 
 ; Checksum (CHECKSUM-CORE only, others are looked up by string or libRebol)
 crc32
+crc32c
 adler32
+hash64
 
 ; Codec actions
 identify
@@ -372,11 +374,24 @@ library-path
 runtime-path
 options
 
-; envelopes used with INFLATE and DEFLATE
+; envelopes used with INFLATE and DEFLATE, methods of COMPRESS-BYTES
 ;
 zlib
 gzip
 detect
+lz4
+
+; columns of STATS/PROFILE, for sorting the tallies of PROFILER/CALLS
+;
+calls
+inclusive
+exclusive
+allocated
+
+; columns of STATS/ALLOCATIONS, for sorting the sites of PROFILER/MEMORY
+; (ALLOCATED is above)
+;
+live
 
 ; REFLECT needs a SYM_XXX values at the moment, because it uses the dispatcher
 ; Generic_Dispatcher() vs. there being a separate one just for REFLECT.
@@ -35,7 +35,7 @@
 #undef PVAR
 #undef TVAR
 
-#define PVAR
-#define TVAR
+#define PVAR ISOLATE_LOCAL
+#define TVAR ISOLATE_LOCAL
 
 #include "sys-globals.h"
@@ -82,7 +82,7 @@
 
 #include "sys-core.h"
 
-static bool PG_Api_Initialized = false;
+static ISOLATE_LOCAL bool PG_Api_Initialized = false;
 
 
 //
@@ -669,6 +669,150 @@ REBVAL *RL_rebText(const char *utf8)
 }
 
 
+//=//// UTF-16 CONVERSION ///////////////////////////////////////////////////=//
+//
+// Windows APIs take and give UTF-16 ("wide") strings, so on Windows every
+// filename, console line, and clipboard string goes through rebSpellWide()
+// or rebTextWide().  Most of that text is ASCII.  So both directions test a
+// 64-bit word at a time (8 UTF-8 bytes, or 4 wchars) for being all ASCII,
+// and convert such runs without decoding codepoints.
+//
+// This is done with plain integer math, not the SIMD intrinsics used by
+// %sys-seek.h, because those are only enabled for GCC and Clang.  MSVC, the
+// main Windows compiler, doesn't get them.  The widening and narrowing loops
+// are simple enough for compilers to vectorize anyway.
+//
+
+#define UTF8_HIGH_BITS 0x8080808080808080ull  // top bit of each of 8 bytes
+#define WIDE_NON_ASCII_BITS 0xFF80FF80FF80FF80ull  // of each of 4 wchars
+#define WIDE_TOP_BITS 0x8000800080008000ull
+#define WIDE_UNDER_TOP_BITS 0x7FFF7FFF7FFF7FFFull
+
+// Number of bytes in a word whose top bit is set (the others must be 0).
+//
+inline static REBLEN Count_Top_Bits(uint64_t bits)
+  { return ((bits >> 7) * 0x0101010101010101ull) >> 56; }
+
+// How many wchars the UTF-16 form of some valid UTF-8 takes: one for each
+// byte that isn't a continuation byte, plus one more for each leading byte
+// of a 4-byte sequence (those codepoints need a surrogate pair).
+//
+static REBLEN Num_Wide_For_Utf8(const REBYTE *bp, REBSIZ size)
+{
+    REBLEN num_wchars = size;
+    const REBYTE *end = bp + size;
+
+    for (; end - bp >= 8; bp += 8) {
+        uint64_t w;
+        memcpy(&w, bp, 8);
+        if ((w & UTF8_HIGH_BITS) == 0)
+            continue;
+
+        // Continuation bytes are 10xxxxxx and 4-byte leads are 11110xxx.
+        // Shifting left moves bit 6 of each byte to bit 7 (bits shifted in
+        // from the byte below land in bit 0, which is masked out).
+        //
+        uint64_t continuations = w & ~(w << 1) & UTF8_HIGH_BITS;
+        uint64_t fours = w & (w << 1) & (w << 2) & (w << 3) & UTF8_HIGH_BITS;
+        num_wchars -= Count_Top_Bits(continuations);
+        num_wchars += Count_Top_Bits(fours);
+    }
+    for (; bp != end; ++bp) {
+        if ((*bp & 0xC0) == 0x80)
+            --num_wchars;
+        else if (*bp >= 0xF0)
+            ++num_wchars;
+    }
+    return num_wchars;
+}
+
+// Make a string from UTF-16.  Broken surrogate pairs and NUL are errors.
+//
+static REBSTR *Make_String_Wide(const REBWCHAR *wstr, REBLEN num_wchars)
+{
+    STATIC_ASSERT(sizeof(REBWCHAR) == 2);  // for the 4-at-a-time tests
+
+    REBSIZ size = 0;  // first pass gets the size and length to allocate
+    REBLEN len = 0;
+    REBLEN i = 0;
+    while (i < num_wchars) {
+        if (num_wchars - i >= 4) {
+            uint64_t w;
+            memcpy(&w, wstr + i, 8);
+            if (
+                (w & WIDE_NON_ASCII_BITS) == 0
+                and ((w + WIDE_UNDER_TOP_BITS) & WIDE_TOP_BITS)
+                    == WIDE_TOP_BITS  // no zero wchars
+            ){
+                size += 4;
+                len += 4;
+                i += 4;
+                continue;
+            }
+        }
+
+        REBUNI c = wstr[i];
+        if (c == 0)
+            fail (Error_Illegal_Zero_Byte_Raw());
+
+        if (c >= UNI_SUR_HIGH_START and c <= UNI_SUR_LOW_END) {
+            if (
+                c > UNI_SUR_HIGH_END  // low surrogate with no high one
+                or i + 1 == num_wchars
+                or wstr[i + 1] < UNI_SUR_LOW_START
+                or wstr[i + 1] > UNI_SUR_LOW_END
+            ){
+                fail ("Invalid UTF-16 surrogate pair passed to rebTextWide()");
+            }
+            size += 4;
+            i += 2;
+        }
+        else {
+            size += Encoded_Size_For_Codepoint(c);
+            i += 1;
+        }
+        ++len;
+    }
+
+    REBSTR *s = Make_String(size);
+    REBYTE *dp = BIN_HEAD(s);
+
+    i = 0;
+    while (i < num_wchars) {
+        if (num_wchars - i >= 4) {
+            uint64_t w;
+            memcpy(&w, wstr + i, 8);
+            if ((w & WIDE_NON_ASCII_BITS) == 0) {  // zeros were ruled out
+                dp[0] = wstr[i];
+                dp[1] = wstr[i + 1];
+                dp[2] = wstr[i + 2];
+                dp[3] = wstr[i + 3];
+                dp += 4;
+                i += 4;
+                continue;
+            }
+        }
+
+        REBUNI c;
+        if (wstr[i] >= UNI_SUR_HIGH_START and wstr[i] <= UNI_SUR_HIGH_END) {
+            c = Decode_UTF16_Pair(wstr + i);
+            i += 2;
+        }
+        else {
+            c = wstr[i];
+            i += 1;
+        }
+        uint_fast8_t encoded_size = Encoded_Size_For_Codepoint(c);
+        Encode_UTF8_Char(dp, c, encoded_size);
+        dp += encoded_size;
+    }
+    assert(dp == BIN_AT(s, size));
+
+    TERM_STR_LEN_SIZE(s, len, size);
+    return s;
+}
+
+
 //
 //  rebLengthedTextWide: RL_API
 //
@@ -676,13 +820,7 @@ REBVAL *RL_rebLengthedTextWide(const REBWCHAR *wstr, unsigned int num_chars)
 {
     ENTER_API;
 
-    DECLARE_MOLD (mo);
-    Push_Mold(mo);
-
-    for (; num_chars != 0; --num_chars, ++wstr)
-        Append_Codepoint(mo->series, *wstr);
-
-    return Init_Text(Alloc_Value(), Pop_Molded_String(mo));
+    return Init_Text(Alloc_Value(), Make_String_Wide(wstr, num_chars));
 }
 
 
@@ -695,26 +833,11 @@ REBVAL *RL_rebTextWide(const REBWCHAR *wstr)
 {
     ENTER_API;
 
-    DECLARE_MOLD (mo);
-    Push_Mold(mo);
+    REBLEN num_wchars = 0;
+    while (wstr[num_wchars] != 0)
+        ++num_wchars;
 
-    while (*wstr != 0) {
-        if (*wstr >= UNI_SUR_HIGH_START and *wstr <= UNI_SUR_HIGH_END) {
-            if (not (
-                *(wstr + 1) >= UNI_SUR_LOW_START
-                and *(wstr + 1) <= UNI_SUR_LOW_END
-            )){
-                fail ("Invalid UTF-16 surrogate pair passed to rebTextWide()");
-            }
-            Append_Codepoint(mo->series, Decode_UTF16_Pair(wstr));
-            wstr += 2;
-        }
-        else {
-            Append_Codepoint(mo->series, *wstr);
-            ++wstr;
-        }
-    }
-    return Init_Text(Alloc_Value(), Pop_Molded_String(mo));
+    return Init_Text(Alloc_Value(), Make_String_Wide(wstr, num_wchars));
 }
 
 
@@ -1281,47 +1404,52 @@ static unsigned int Spell_Into_Wide(
     if (not ANY_UTF8(v))
         fail ("rebSpell() APIs require UTF-8 types (strings, words, tokens)");
 
-    if (not buf)  // querying for size
-        assert(buf_wchars == 0);
+    REBSIZ size;
+    const REBYTE *bp = VAL_UTF8_SIZE_AT(&size, v);
 
-    unsigned int num_wchars = 0;  // some codepoints need 2 wchars
+    if (not buf) {  // querying for size
+        assert(buf_wchars == 0);
+        return Num_Wide_For_Utf8(bp, size);  // caller needs space for + 1
+    }
 
-    REBCHR(const*) cp = VAL_UTF8_AT(v);
+    const REBYTE *tail = bp + size;
+    const REBYTE *cp = bp;
+    unsigned int i = 0;
+    while (cp != tail and i < buf_wchars) {
+        if (tail - cp >= 8 and buf_wchars - i >= 8) {
+            uint64_t w;
+            memcpy(&w, cp, 8);
+            if ((w & UTF8_HIGH_BITS) == 0) {  // 8 ASCII bytes, just widen
+                REBLEN n;
+                for (n = 0; n < 8; ++n)
+                    buf[i + n] = cp[n];
+                cp += 8;
+                i += 8;
+                continue;
+            }
+        }
 
-    REBUNI c;
-    cp = NEXT_CHR(&c, cp);
+        REBUNI c = *cp;
+        if (c < 0x80)
+            ++cp;
+        else
+            cp = Back_Scan_UTF8_Char_Unchecked(&c, cp) + 1;
 
-    REBLEN i = 0;
-    while (c != '\0' and i < buf_wchars) {
-        if (c <= 0xFFFF) {
-            buf[i] = c;
-            ++i;
-            ++num_wchars;
-        }
+        if (c <= 0xFFFF)
+            buf[i++] = c;
         else {  // !!! Should there be a UCS-2 version that fails here?
             if (i == buf_wchars - 1)
                 break;  // not enough space for surrogate pair
 
             Encode_UTF16_Pair(c, &buf[i]);
             i += 2;
-            num_wchars += 2;
         }
-        cp = NEXT_CHR(&c, cp);
     }
+    buf[i] = 0;
 
-    if (buf)
-        buf[i] = 0;
-
-    while (c != '\0') {  // count residual wchars there was no capacity for
-        if (c <= 0xFFFF)
-            num_wchars += 1;  // fits in one 16-bit wchar
-        else
-            num_wchars += 2;  // requires surrogate pair to represent
-
-        cp = NEXT_CHR(&c, cp);
-    }
-
-    return num_wchars;  // if allocating, caller needs space for num_wchars + 1
+    if (cp == tail)
+        return i;
+    return i + Num_Wide_For_Utf8(cp, tail - cp);  // count what didn't fit
 }
 
 
@@ -1908,6 +2036,236 @@ const void *RL_rebINLINE(const REBVAL *v)
 }
 
 
+//=//// TEMPLATES ///////////////////////////////////////////////////////=//
+//
+// Each call like `rebValue("add", x, "* 2")` scans its UTF-8 fragments
+// again, which is most of the cost of a small API call.  An embedder that
+// makes the same call millions of times can scan it once, marking where the
+// values go with rebSLOT():
+//
+//     REBVAL *tmpl = rebTemplate("add", rebSLOT(), "* 2");
+//     rebUnmanage(tmpl);  // if it is to outlive the current frame
+//
+// Then rebFILL() makes an instruction that splices a copy of the template
+// into any evaluating API, with the values put in the slots in order:
+//
+//     REBVAL *result = rebValue(rebFILL(tmpl, x));
+//     ...
+//     int64_t n = rebUnboxInteger(rebFILL(tmpl, rebI(10)));
+//
+// Filling only copies the template's cells (no scanning, and no binding, as
+// the words were bound when the template was made).  rebFILLQ() quotes the
+// values it puts in the slots, as rebValueQ() quotes its splices.
+//
+// !!! Slots can't be inside nested blocks or groups of a template, as that
+// would need a deep copy on each fill.  Review if a use comes up.
+//
+
+static char PG_Template_Slot;  // address identifies HANDLE!s from rebSLOT()
+
+inline static bool Is_Template_Slot(REBCEL(const*) v) {
+    return CELL_KIND(v) == REB_HANDLE
+        and not Is_Handle_Cfunc(v)
+        and VAL_HANDLE_VOID_POINTER(v) == &PG_Template_Slot;
+}
+
+
+//
+//  rebSLOT: RL_API
+//
+// Marks where a value given to rebFILL() goes in a rebTemplate().
+//
+const void *RL_rebSLOT(void)
+{
+    ENTER_API;
+
+    REBVAL *slot = Init_Handle_Cdata(Alloc_Value(), &PG_Template_Slot, 1);
+    return rebRELEASING(slot);
+}
+
+
+static bool Has_Template_Slot_Deep(const REBARR *a)
+{
+    const RELVAL *tail = ARR_TAIL(a);
+    const RELVAL *v = ARR_HEAD(a);
+    for (; v != tail; ++v) {
+        if (Is_Template_Slot(VAL_UNESCAPED(v)))
+            return true;
+        if (ANY_ARRAY(v) and Has_Template_Slot_Deep(VAL_ARRAY(v)))
+            return true;
+    }
+    return false;
+}
+
+
+//
+//  rebTemplate: RL_API
+//
+// Scan the code once, for filling in with rebFILL().  The result is a frozen
+// BLOCK! that must be rebRelease()'d like any other API value.
+//
+REBVAL *RL_rebTemplate(unsigned char quotes, const void *p, va_list *vaptr)
+{
+    ENTER_API;
+
+    REBDSP dsp_orig = DSP;
+
+    REBFLGS feed_flags = FEED_MASK_DEFAULT | FLAG_QUOTING_BYTE(quotes);
+    DECLARE_VA_FEED (feed, p, vaptr, feed_flags);
+
+    while (NOT_END(feed->value)) {
+        Copy_Cell(DS_PUSH(), SPECIFIC(unwrap(feed->value)));
+        if (Is_Template_Slot(VAL_UNESCAPED(DS_TOP)))
+            Dequotify(DS_TOP);  // rebTemplateQ() quotes values, not slots
+        Fetch_Next_In_Feed(feed);
+    }
+
+    Free_Feed(feed);
+
+    if (DSP == dsp_orig)
+        fail ("rebTemplate() can't be empty");
+
+    REBARR *a = Pop_Stack_Values_Core(dsp_orig, NODE_FLAG_MANAGED);
+
+    const RELVAL *tail = ARR_TAIL(a);
+    const RELVAL *v = ARR_HEAD(a);
+    for (; v != tail; ++v) {
+        if (ANY_ARRAY(v) and Has_Template_Slot_Deep(VAL_ARRAY(v)))
+            fail ("rebSLOT() can't be in a BLOCK! or GROUP! of a template");
+    }
+
+    return Init_Block(Alloc_Value(), Freeze_Array_Shallow(a));
+}
+
+
+// Put a pointer from rebFILL()'s variadic into a slot, following the rules
+// the feed uses for the same pointer (see Detect_Feed_Pointer_Maybe_Fetch()).
+//
+static void Fill_Template_Slot(
+    RELVAL *slot,
+    unsigned char quotes,
+    const void *p
+){
+    if (not p) {
+        if (quotes == 0)
+            Init_Bad_Word(slot, SYM_NULL);  // ~null~, as in a feed
+        else {
+            Init_Nulled(slot);
+            Isotopic_Quotify(slot, quotes);
+        }
+        return;
+    }
+
+    switch (Detect_Rebol_Pointer(p)) {
+      case DETECTED_AS_CELL: {
+        const REBVAL *cell = cast(const REBVAL*, p);
+        assert(not IS_NULLED(cell));  // API must use nullptr
+        Copy_Cell(slot, cell);
+        Isotopic_Quotify(slot, quotes);
+        break; }
+
+      case DETECTED_AS_SERIES: {  // e.g. rebQ() or rebR()
+        REBARR *inst = ARR(m_cast(void*, p));
+        REBVAL *single = SPECIFIC(ARR_SINGLE(inst));
+        switch (SER_FLAVOR(inst)) {
+          case FLAVOR_INSTRUCTION_ADJUST_QUOTING:
+            Copy_Cell(slot, single);
+            Isotopic_Quotify(slot, quotes + inst->misc.quoting_delta);
+            GC_Kill_Series(inst);
+            break;
+
+          case FLAVOR_API:
+            assert(GET_SUBCLASS_FLAG(API, inst, RELEASE));
+            Copy_Cell(slot, single);
+            Isotopic_Quotify(slot, quotes);
+            rebRelease(single);
+            break;
+
+          default:
+            fail ("rebFILL() only takes values, rebQ(), and rebR()");
+        }
+        break; }
+
+      default:
+        fail ("rebFILL() takes values, not source text");
+    }
+}
+
+
+//
+//  rebFILL: RL_API
+//
+// Instruction splicing a copy of a rebTemplate() into the feed, with the
+// values given put into its slots.  There must be a value for every slot.
+//
+const void *RL_rebFILL(
+    unsigned char quotes,
+    const REBVAL *tmpl,
+    const void *p, va_list *vaptr
+){
+    ENTER_API;
+
+    const void* const *packed = nullptr;
+    if (not vaptr) {
+        packed = cast(const void* const*, p);
+        p = *packed++;
+    }
+
+    if (not IS_BLOCK(tmpl) or not Is_Array_Frozen_Shallow(VAL_ARRAY(tmpl)))
+        fail ("rebFILL() needs a template made by rebTemplate()");
+
+    REBARR *a = Copy_Array_At_Extra_Shallow(
+        VAL_ARRAY(tmpl),
+        VAL_INDEX(tmpl),
+        SPECIFIED,
+        0,
+        NODE_FLAG_MANAGED
+    );
+
+    // Go through all of the pointers before any fail(), so rebR() values
+    // are still released if the count is wrong.
+    //
+    bool too_few = false;
+    RELVAL *tail = ARR_TAIL(a);
+    RELVAL *v = ARR_HEAD(a);
+    for (; v != tail; ++v) {
+        if (not Is_Template_Slot(VAL_UNESCAPED(v)))
+            continue;
+
+        if (p and Detect_Rebol_Pointer(p) == DETECTED_AS_END) {
+            too_few = true;
+            break;
+        }
+        Fill_Template_Slot(v, quotes, p);
+        p = vaptr ? va_arg(*vaptr, const void*) : *packed++;
+    }
+
+    bool too_many = false;
+    while (not p or Detect_Rebol_Pointer(p) != DETECTED_AS_END) {
+        DECLARE_LOCAL (extra);
+        Fill_Template_Slot(extra, quotes, p);
+        too_many = true;
+        p = vaptr ? va_arg(*vaptr, const void*) : *packed++;
+    }
+
+    if (vaptr)
+        va_end(*vaptr);
+
+    if (too_few)
+        fail ("rebFILL() given fewer values than the template has slots");
+    if (too_many)
+        fail ("rebFILL() given more values than the template has slots");
+
+    REBARR *inst = Alloc_Singular(
+        FLAG_FLAVOR(INSTRUCTION_SPLICE) | NODE_FLAG_MANAGED
+    );
+    CLEAR_SERIES_FLAG(inst, MANAGED);  // lying avoided manuals tracking
+    Init_Block(ARR_SINGLE(inst), a);
+
+    return cast(REBINS*, inst);
+}
+
+
 //
 //  rebManage: RL_API
 //
@@ -1930,6 +2288,7 @@ REBVAL *RL_rebManage(REBVAL *v)
         fail ("Attempt to rebManage() a handle that's already managed.");
 
     SET_SERIES_FLAG(a, MANAGED);
+    Mark_If_Unswept(a);
     Link_Api_Handle_To_Frame(a, FS_TOP);
 
     return v;
@@ -1998,6 +2357,80 @@ void RL_rebRelease(const REBVAL *v)
 }
 
 
+// A marker with this address as its HANDLE! data starts a scope of handles.
+//
+static char PG_Scope_Marker;
+
+
+//
+//  rebScopeBegin: RL_API
+//
+// Code that makes many API handles in a loop can free them all at once with
+// the matching rebScopeEnd(), instead of calling rebRelease() on each:
+//
+//     REBVAL *scope = rebScopeBegin();
+//     for (i = 0; i < n; ++i) {
+//         REBVAL *item = rebValue("pick", block, rebI(i + 1));
+//         ...  // no need to rebRelease(item)
+//     }
+//     rebScopeEnd(scope);
+//
+// The API handles of a frame are linked with the newest at the head, so the
+// scope is everything ahead of the marker that is returned.  Handles that
+// are rebUnmanage()'d aren't in the list, so they escape the scope.
+//
+REBVAL *RL_rebScopeBegin(void)
+{
+    ENTER_API;
+
+    return Init_Handle_Cdata(Alloc_Value(), &PG_Scope_Marker, 1);
+}
+
+
+//
+//  rebScopeEnd: RL_API
+//
+// Free the API handles from the current frame that were made since the
+// rebScopeBegin() which returned `scope`, and the marker itself.  Scopes
+// nest, but must end in the same frame they began in.
+//
+void RL_rebScopeEnd(REBVAL *scope)
+{
+    ENTER_API;
+
+    if (
+        not Is_Api_Value(scope)
+        or not IS_HANDLE(scope)
+        or Is_Handle_Cfunc(scope)
+        or VAL_HANDLE_VOID_POINTER(scope) != &PG_Scope_Marker
+    ){
+        fail ("rebScopeEnd() needs the value that rebScopeBegin() gave");
+    }
+
+    REBARR *marker = Singular_From_Cell(scope);
+    REBFRM *f = FS_TOP;
+
+    REBNOD *n = f->alloc_value_list;  // check before freeing anything
+    while (n != marker) {
+        if (n == f)
+            fail ("rebScopeEnd() must be called in its rebScopeBegin() frame");
+        n = LINK(ApiNext, ARR(n));
+    }
+
+    n = f->alloc_value_list;
+    while (n != marker) {
+        REBARR *a = ARR(n);
+        n = LINK(ApiNext, a);
+        REFORMAT_CELL_IF_DEBUG(ARR_SINGLE(a));
+        GC_Kill_Series(a);
+    }
+
+    f->alloc_value_list = marker;  // now at the head, so unlinks from frame
+    mutable_MISC(ApiPrev, marker) = f;
+    Free_Value(scope);
+}
+
+
 //
 //  rebZdeflateAlloc: RL_API
 //
@@ -52,7 +52,9 @@
 
 #include "sys-core.h"
 
-#define EVAL_DOSE 10000
+#include <time.h>  // timespec_get() or clock(), for STATS/STARTUP
+
+#define EVAL_DOSE 10000  // starting point, Do_Signals_Throws() adapts it
 
 
 //
@@ -145,6 +147,35 @@ static void Check_Basics(void)
 #endif
 
 
+//
+//  Startup_Clock_Nanoseconds: C
+//
+// Startup time is measured by the wall clock, so that waiting (e.g. on the
+// executable being paged in) is counted too.  C11 defines TIME_UTC when it
+// has timespec_get(), and clock() is the fallback.
+//
+REBI64 Startup_Clock_Nanoseconds(void)
+{
+  #if defined(TIME_UTC)
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return cast(REBI64, ts.tv_sec) * 1000000000 + ts.tv_nsec;
+  #else
+    return cast(REBI64, clock()) * (1000000000 / CLOCKS_PER_SEC);
+  #endif
+}
+
+
+static ISOLATE_LOCAL REBI64 startup_mark;  // clock at end of last stage
+
+static void Note_Startup_Stage(enum Startup_Stages stage)
+{
+    REBI64 now = Startup_Clock_Nanoseconds();
+    PG_Startup_Nanoseconds[stage] = now - startup_mark;
+    startup_mark = now;
+}
+
+
 //
 //  Set_Stack_Limit: C
 //
@@ -542,9 +573,14 @@ void Startup_Task(void)
     Eval_Cycles = 0;
     Eval_Dose = EVAL_DOSE;
     Eval_Count = Eval_Dose;
+    Eval_Dose_Start = Startup_Clock_Nanoseconds();
     Eval_Signals = 0;
     Eval_Sigmask = ALL_BITS;
     Eval_Limit = 0;
+    TG_Profiling = false;
+    TG_Call_Profiling = false;
+    TG_Alloc_Sample_Countdown = INT64_MAX;
+    TG_Alloc_Samples_Live = false;
 
     TG_Ballast = MEM_BALLAST; // or overwritten by debug build below...
     TG_Max_Ballast = MEM_BALLAST;
@@ -712,14 +748,17 @@ REBVAL *Get_Sys_Function_Debug(REBLEN index, const char *name)
 static REBVAL *Startup_Mezzanine(BOOT_BLK *boot)
 {
     Startup_Base(VAL_ARRAY_KNOWN_MUTABLE(&boot->base));
+    Note_Startup_Stage(STARTUP_BASE);
 
     Startup_Sys(VAL_ARRAY_KNOWN_MUTABLE(&boot->sys));
+    Note_Startup_Stage(STARTUP_SYS);
 
     rebElide(
         "bind/only/set", SPECIFIC(&boot->mezz), Lib_Context,   // not BIND/NEW !
         "bind", SPECIFIC(&boot->mezz), Lib_Context,
         "do", SPECIFIC(&boot->mezz)
     );
+    Note_Startup_Stage(STARTUP_MEZZ);
 
     return nullptr;
 }
@@ -757,6 +796,9 @@ void Startup_Core(void)
     Startup_Trash_Debug();
   #endif
 
+    memset(PG_Startup_Nanoseconds, 0, sizeof(PG_Startup_Nanoseconds));
+    startup_mark = Startup_Clock_Nanoseconds();
+
 //=//// INITIALIZE TICK COUNT /////////////////////////////////////////////=//
 
     // The timer tick starts at 1, not 0.  This is because the debug build
@@ -811,6 +853,8 @@ void Startup_Core(void)
     Startup_Pools(0);
     Startup_GC();
 
+    Note_Startup_Stage(STARTUP_POOLS);
+
 //=//// INITIALIZE API ////////////////////////////////////////////////////=//
 
     // The API is one means by which variables can be made whose lifetime is
@@ -822,12 +866,14 @@ void Startup_Core(void)
     Startup_CRC();             // For word hashing
     Set_Random(0);
     Startup_Interning();
-    Startup_Early_Symbols();  // see notes--need before data stack or scan
+    Startup_Builtin_Symbols();  // see notes--need before data stack or scan
 
     Startup_End_Node();
     Startup_Empty_Array();
 
     Startup_Collector();
+    Startup_Parse_Programs();
+    Startup_Set_Operations();
     Startup_Mold(MIN_COMMON / 4);
 
     Startup_Data_Stack(STACK_MIN / 4);
@@ -849,6 +895,8 @@ void Startup_Core(void)
 
     Init_Action_Spec_Tags(); // Note: uses MOLD_BUF, not available until here
 
+    Note_Startup_Stage(STARTUP_SYMBOLS);
+
 //=//// LOAD BOOT BLOCK ///////////////////////////////////////////////////=//
 
     // The %make-boot.r process takes all the various definitions and
@@ -857,6 +905,10 @@ void Startup_Core(void)
     // includes the type list, word list, error message templates, system
     // object, mezzanines, etc.
 
+  #if defined(USE_UNCOMPRESSED_BOOT)  // bigger executable, faster startup
+    const REBYTE *utf8 = Native_Specs;
+    size_t utf8_size = Nat_Uncompressed_Size;
+  #else
     size_t utf8_size;
     const int max = -1;  // trust size in gzip data
     REBYTE *utf8 = Decompress_Alloc_Core(
@@ -866,6 +918,9 @@ void Startup_Core(void)
         max,
         SYM_GZIP
     );
+  #endif
+
+    Note_Startup_Stage(STARTUP_DECOMPRESS);
 
     REBARR *boot_array = Scan_UTF8_Managed(
         Intern_Unsized_Managed("-tmp-boot-"),
@@ -874,7 +929,11 @@ void Startup_Core(void)
     );
     PUSH_GC_GUARD(boot_array); // managed, so must be guarded
 
+    Note_Startup_Stage(STARTUP_SCAN);
+
+  #if !defined(USE_UNCOMPRESSED_BOOT)
     rebFree(utf8); // don't need decompressed text after it's scanned
+  #endif
 
     BOOT_BLK *boot =
         cast(BOOT_BLK*, ARR_HEAD(VAL_ARRAY_KNOWN_MUTABLE(ARR_HEAD(boot_array))));
@@ -976,6 +1035,8 @@ void Startup_Core(void)
     //
     Startup_Stackoverflow();
 
+    Note_Startup_Stage(STARTUP_NATIVES);
+
 //=//// RUN MEZZANINE CODE NOW THAT ERROR HANDLING IS INITIALIZED /////////=//
 
     PG_Boot_Phase = BOOT_MEZZ;
@@ -1074,7 +1135,10 @@ void Shutdown_Core(void)
     const bool shutdown = true; // go ahead and free all managed series
     Recycle_Core(shutdown, NULL);
 
+    Shutdown_Profiler();
     Shutdown_Mold();
+    Shutdown_Set_Operations();
+    Shutdown_Parse_Programs();
     Shutdown_Collector();
     Shutdown_Raw_Print();
     Shutdown_CRC();
@@ -1086,6 +1150,7 @@ void Shutdown_Core(void)
     Shutdown_Interning();
 
     Shutdown_GC();
+    Shutdown_Shared();  // after the last cells pointing into regions are gone
 
     FREE(REB_OPTS, Reb_Opts);
 
@@ -156,14 +156,20 @@ REBVAL *Append_Context(
     option(RELVAL*) any_word,  // allowed to be quoted as well
     option(const REBSYM*) symbol
 ) {
+    // Most callsites pre-expand with Expand_Context(), which breaks away
+    // from a shared keylist.  But some (e.g. BIND/NEW) don't, and now that
+    // objects made from the same spec share keylists (see TG_Keylist_Shapes)
+    // expanding a shared one in place would add the key to all of them.
+    //
+    if (GET_SUBCLASS_FLAG(KEYLIST, CTX_KEYLIST(context), SHARED))
+        Expand_Context_Keylist_Core(context, 1);
+
     REBSER *keylist = CTX_KEYLIST(context);
 
     // Add the key to key list
     //
-    // !!! This doesn't seem to consider the shared flag of the keylist (?)
-    // though the callsites seem to pre-expand with consideration for that.
-    // Review why this is expanding when the callers are expanding.  Should
-    // also check that redundant keys aren't getting added here.
+    // !!! Review why this is expanding when the callers are expanding.
+    // Should also check that redundant keys aren't getting added here.
     //
     EXPAND_SERIES_TAIL(keylist, 1);  // updates the used count
     Init_Key(
@@ -175,8 +181,22 @@ REBVAL *Append_Context(
 
     // Add a slot to the var list
     //
+    GC_Write_Barrier(CTX_VARLIST(context));  // caller will fill in the slot
     EXPAND_SERIES_TAIL(CTX_VARLIST(context), 1);
 
+    ++TG_Word_Cache_Generation;  // keys changed, see %sys-bind.h
+
+    if (GET_SUBCLASS_FLAG(KEYLIST, keylist, INDEXED)) {  // keep index in sync
+        REBLEN *index = cast(REBLEN*, MISC_KEYLIST_INDEX(keylist));
+        REBLEN len = SER_USED(keylist);
+        if (len * 2 > index[0]) {
+            Free_Keylist_Index(keylist);
+            Index_Keylist(keylist);
+        }
+        else
+            Add_Key_To_Index(index, KEY_SYMBOL(SER_LAST(REBKEY, keylist)), len);
+    }
+
     REBVAL *value = Init_Unset(ARR_LAST(CTX_VARLIST(context)));
 
     if (not any_word)
@@ -196,6 +216,307 @@ REBVAL *Append_Context(
 }
 
 
+//=//// KEYLIST SHAPES ////////////////////////////////////////////////////=//
+//
+// Objects made from the same spec (e.g. records made by MAKE OBJECT! in a
+// loop) would otherwise each collect a keylist of their own.  Instead, the
+// keylists of objects that don't derive from another are remembered in
+// TG_Keylist_Shapes, a direct-mapped table hashed from the key symbols.  A
+// new object with the same keys in the same order shares that keylist.
+//
+// Anything put in the table gets KEYLIST_FLAG_SHARED, so that expanding an
+// object using it forks a copy.  It also gets KEYLIST_FLAG_SHAPE, since a
+// keylist that unrelated objects share can't be used to tell derivation.  But adding fields is a transition to some
+// other shape, so Append_To_Context() asks for the shape with the extra keys
+// first.  Records that all get the same fields added thus keep sharing.
+//
+// The table does not keep keylists alive.  It is cleared in each collection
+// (see Forget_Keylist_Shapes()) so it can't hand back a freed keylist.
+//
+// The keylist pointer can then stand in for the object's layout, as it does
+// for the field index cache (see TG_Field_Cache).
+//
+#define KEYLIST_SHAPES_SIZE 256  // must be a power of 2
+
+inline static REBLEN Hash_Shape_Step(REBLEN hash, const REBSYM *symbol)
+  { return (hash * 31) ^ cast(REBLEN, cast(uintptr_t, symbol) >> 4); }
+
+
+// The shape looked for is the keys in `prefix` (if any) followed by the
+// symbols of the words in the data stack from `word` up to DS_TOP.  The hash
+// is given back so the caller can remember a keylist they make on a miss.
+//
+static option(REBSER*) Find_Keylist_Shape(
+    REBLEN *hash_out,
+    option(REBSER*) prefix,
+    STKVAL(*) word
+){
+    REBLEN prefix_len = prefix ? SER_USED(unwrap(prefix)) : 0;
+    REBLEN len = prefix_len + (DS_TOP + 1 - word);
+
+    REBLEN hash = len;
+    if (prefix) {
+        const REBKEY *key = SER_HEAD(REBKEY, unwrap(prefix));
+        REBLEN n;
+        for (n = 0; n < prefix_len; ++n, ++key)
+            hash = Hash_Shape_Step(hash, KEY_SYMBOL(key));
+    }
+    STKVAL(*) w;
+    for (w = word; w != DS_TOP + 1; ++w)
+        hash = Hash_Shape_Step(hash, VAL_WORD_SYMBOL(w));
+
+    *hash_out = hash;
+
+    REBSER *shape = TG_Keylist_Shapes[hash & (KEYLIST_SHAPES_SIZE - 1)];
+    if (not shape or SER_USED(shape) != len)
+        return nullptr;
+
+    const REBKEY *key = SER_HEAD(REBKEY, shape);
+    if (prefix) {
+        const REBKEY *pkey = SER_HEAD(REBKEY, unwrap(prefix));
+        REBLEN n;
+        for (n = 0; n < prefix_len; ++n, ++key, ++pkey) {
+            if (KEY_SYMBOL(key) != KEY_SYMBOL(pkey))
+                return nullptr;
+        }
+    }
+    for (w = word; w != DS_TOP + 1; ++w, ++key) {
+        if (KEY_SYMBOL(key) != VAL_WORD_SYMBOL(w))
+            return nullptr;
+    }
+
+    return shape;
+}
+
+static void Remember_Keylist_Shape(REBSER *keylist, REBLEN hash)
+{
+    assert(LINK(Ancestor, keylist) == keylist);  // shapes don't derive
+    SET_SUBCLASS_FLAG(KEYLIST, keylist, SHARED);
+    SET_SUBCLASS_FLAG(KEYLIST, keylist, SHAPE);
+    TG_Keylist_Shapes[hash & (KEYLIST_SHAPES_SIZE - 1)] = keylist;
+}
+
+
+
+// Sharing a shape still means collecting the keys of the spec each time,
+// with the binder used to weed out duplicates.  So the shape made from a
+// spec is also remembered in TG_Spec_Keylists, a direct-mapped table indexed
+// by the address of the spec's first cell.  A spec block run over and over
+// (e.g. `make object! [a: ... b: ...]` in a loop) then finds its keylist
+// without collecting.
+//
+// There's no modification stamp on arrays, so the spec may have changed
+// since the entry was made.  Before a keylist is reused, the spec's SET-WORD!s
+// are checked against its keys in order--which is much cheaper than the
+// collection it saves, and finds any change that would affect the keys.
+//
+#define SPEC_KEYLISTS_SIZE 256  // must be a power of 2
+
+struct Reb_Spec_Keylist_Entry {
+    const RELVAL *head;  // nullptr if the entry is unused
+    const RELVAL *tail;
+    REBSER *keylist;
+};
+
+static bool Keylist_Matches_Spec(
+    REBSER *keylist,
+    const RELVAL *head,
+    const RELVAL *tail
+){
+    const REBKEY *key = SER_HEAD(REBKEY, keylist);
+    const REBKEY *key_tail = key + SER_USED(keylist);
+
+    const RELVAL *v = head;
+    for (; v != tail; ++v) {
+        REBCEL(const*) cell = VAL_UNESCAPED(v);  // collected as X: from ''X:
+        if (CELL_KIND(cell) != REB_SET_WORD)
+            continue;
+        if (key == key_tail or KEY_SYMBOL(key) != VAL_WORD_SYMBOL(cell))
+            return false;
+        ++key;
+    }
+    return key == key_tail;
+}
+
+inline static struct Reb_Spec_Keylist_Entry *Spec_Keylist_Entry(
+    const RELVAL *head
+){
+    uintptr_t bits = cast(uintptr_t, head) / sizeof(RELVAL);
+    return &TG_Spec_Keylists[bits & (SPEC_KEYLISTS_SIZE - 1)];
+}
+
+
+//
+//  Forget_Keylist_Shapes: C
+//
+// Called by the GC, since the keylists in the tables may be about to be
+// freed (as may the spec arrays, whose cells could then be reused).
+//
+void Forget_Keylist_Shapes(void)
+{
+    REBLEN n;
+    for (n = 0; n < KEYLIST_SHAPES_SIZE; ++n)
+        TG_Keylist_Shapes[n] = nullptr;
+    for (n = 0; n < SPEC_KEYLISTS_SIZE; ++n)
+        TG_Spec_Keylists[n].head = nullptr;
+}
+
+
+//=//// FIELD INDEX CACHE /////////////////////////////////////////////////=//
+//
+// `rec/field` and `rec.field` look up the field in the object's keys each
+// time they run.  But the index a symbol is found at depends only on the
+// keylist, and objects of the same shape share one.  So PD_Context() keeps
+// (keylist, symbol) => index answers in TG_Field_Cache, a direct-mapped table
+// indexed by the address of the picker cell.  Like TG_Word_Cache, that makes
+// it an inline cache for each path in an array run over and over, and field
+// access in a loop over records is a couple of pointer compares and an index.
+//
+// Entries are only good for the TG_Word_Cache_Generation they were made in,
+// which covers freed keylists having their nodes reused.  (Keylists that get
+// new keys only get them at the tail, so a found index would stay good.)
+//
+// Whether the field is hidden is a property of the variable and not the key,
+// so that is checked on every pick.  Misses are not cached.
+//
+#define FIELD_CACHE_SIZE 512  // must be a power of 2
+
+struct Reb_Field_Cache_Entry {
+    const REBSER *keylist;  // nullptr if the entry is unused
+    const REBSYM *symbol;
+    REBLEN generation;
+    REBLEN index;
+};
+
+
+//
+//  Find_Field_In_Object: C
+//
+// Same result as a non-strict Find_Symbol_In_Context() on an OBJECT!, with
+// the answer cached for the `picker` cell (see above).
+//
+REBLEN Find_Field_In_Object(const RELVAL *object, const RELVAL *picker)
+{
+    REBCTX *c = VAL_CONTEXT(object);
+    assert(CTX_TYPE(c) == REB_OBJECT);
+
+    const REBSER *keylist = CTX_KEYLIST(c);
+    const REBSYM *symbol = VAL_WORD_SYMBOL(picker);
+
+    struct Reb_Field_Cache_Entry *entry = &TG_Field_Cache[
+        (cast(uintptr_t, picker) / sizeof(RELVAL)) & (FIELD_CACHE_SIZE - 1)
+    ];
+
+    if (
+        entry->keylist == keylist
+        and entry->symbol == symbol
+        and entry->generation == TG_Word_Cache_Generation
+    ){
+        assert(entry->index <= CTX_LEN(c));
+        if (Is_Param_Hidden(cast_PAR(CTX_VAR(c, entry->index))))
+            return 0;
+        return entry->index;
+    }
+
+    const bool strict = false;
+    REBLEN n = Find_Symbol_In_Context(object, symbol, strict);
+    if (n != 0) {
+        entry->keylist = keylist;
+        entry->symbol = symbol;
+        entry->generation = TG_Word_Cache_Generation;
+        entry->index = n;
+    }
+    return n;
+}
+
+
+//
+//  Prepare_Keylist_For_Derivation: C
+//
+// A derived object has its parent's keylist, or one with the parent's as its
+// ancestor, which is how a METHOD of the parent is known to apply to it.  So
+// the parent's keylist must not be a shape other objects share: if it is,
+// the parent gets a copy of its own.  That keylist is flagged as shared, so
+// expanding the parent forks it instead of extending it in place (and then
+// handing it out as a shape).
+//
+void Prepare_Keylist_For_Derivation(REBCTX *parent)
+{
+    REBSER *keylist = CTX_KEYLIST(parent);
+
+    if (GET_SUBCLASS_FLAG(KEYLIST, keylist, SHAPE)) {
+        REBSER *copy = Copy_Series_At_Len_Extra(
+            keylist,
+            0,
+            SER_USED(keylist),
+            0,
+            SERIES_MASK_KEYLIST | NODE_FLAG_MANAGED
+        );
+        mutable_LINK(Ancestor, copy) = copy;
+        INIT_CTX_KEYLIST_UNIQUE(parent, copy);
+        keylist = copy;
+    }
+
+    SET_SUBCLASS_FLAG(KEYLIST, keylist, SHARED);
+}
+
+
+//
+//  Did_Transition_Keylist_Shape: C
+//
+// Before an object is expanded to add the keys for the words on the data
+// stack from `word` up to DS_TOP, see if that shape is already known.  If so
+// the object switches to that keylist, and only its varlist is expanded (the
+// new variables are unset).
+//
+// If it's not known, false is returned.  The caller expands the object the
+// usual way, then passes the hash to Remember_Transition_Shape().
+//
+bool Did_Transition_Keylist_Shape(
+    REBLEN *hash_out,
+    REBCTX *c,
+    STKVAL(*) word
+){
+    REBSER *keylist = CTX_KEYLIST(c);
+    if (CTX_TYPE(c) != REB_OBJECT or LINK(Ancestor, keylist) != keylist) {
+        *hash_out = 0;
+        return false;
+    }
+
+    REBSER *shape = try_unwrap(Find_Keylist_Shape(hash_out, keylist, word));
+    if (not shape)
+        return false;
+
+    REBARR *varlist = CTX_VARLIST(c);
+    REBLEN num_added = DS_TOP + 1 - word;
+
+    GC_Write_Barrier(varlist);
+    EXPAND_SERIES_TAIL(varlist, num_added);
+    RELVAL *var = ARR_AT(varlist, ARR_LEN(varlist) - num_added);
+    for (; num_added > 0; --num_added, ++var)
+        Init_Unset(var);
+
+    INIT_CTX_KEYLIST_SHARED(c, shape);
+    ++TG_Word_Cache_Generation;  // keys changed, see %sys-bind.h
+    return true;
+}
+
+
+//
+//  Remember_Transition_Shape: C
+//
+// After a Did_Transition_Keylist_Shape() miss, the expanded object's new
+// keylist can be shared by the next object making the same transition.
+//
+void Remember_Transition_Shape(REBCTX *c, REBLEN hash)
+{
+    REBSER *keylist = CTX_KEYLIST(c);
+    if (CTX_TYPE(c) != REB_OBJECT or LINK(Ancestor, keylist) != keylist)
+        return;
+    Remember_Keylist_Shape(keylist, hash);
+}
+
+
 //
 //  Collect_Start: C
 //
@@ -359,10 +680,21 @@ REBSER *Collect_Keylist_Managed(
     // collect buffer than the original keylist) then make a new keylist
     // array, otherwise reuse the original
     //
-    REBSER *keylist;
+    // Otherwise, if asked to, see if a keylist with the same keys has been
+    // made recently (see TG_Keylist_Shapes).
+    //
+    bool share = (not prior) and (flags & COLLECT_SHARE_SHAPE);
+
+    REBSER *keylist = nullptr;
+    REBLEN hash = 0;
     if (prior and CTX_LEN(unwrap(prior)) == num_collected)
         keylist = CTX_KEYLIST(unwrap(prior));
-    else {
+    else if (share)
+        keylist = try_unwrap(Find_Keylist_Shape(
+            &hash, nullptr, DS_AT(cl->dsp_orig) + 1
+        ));
+
+    if (not keylist) {
         keylist = Make_Series(
             num_collected,  // no terminator
             SERIES_MASK_KEYLIST | NODE_FLAG_MANAGED
@@ -374,6 +706,11 @@ REBSER *Collect_Keylist_Managed(
             Init_Key(key, VAL_WORD_SYMBOL(word));
 
         SET_SERIES_USED(keylist, num_collected);  // no terminator
+
+        if (share) {
+            mutable_LINK(Ancestor, keylist) = keylist;
+            Remember_Keylist_Shape(keylist, hash);
+        }
     }
 
     Collect_End(cl);
@@ -532,12 +869,38 @@ REBCTX *Make_Context_Detect_Managed(
     const RELVAL *tail,
     option(REBCTX*) parent
 ) {
-    REBSER *keylist = Collect_Keylist_Managed(
-        head,
-        tail,
-        parent,
-        COLLECT_ONLY_SET_WORDS
-    );
+    REBSER *keylist = nullptr;
+
+    if (parent and CTX_TYPE(unwrap(parent)) != REB_FRAME)
+        Prepare_Keylist_For_Derivation(unwrap(parent));
+
+    struct Reb_Spec_Keylist_Entry *entry = nullptr;
+    if (kind == REB_OBJECT and not parent and head != tail) {
+        entry = Spec_Keylist_Entry(head);
+        if (
+            entry->head == head
+            and entry->tail == tail
+            and Keylist_Matches_Spec(entry->keylist, head, tail)
+        ){
+            keylist = entry->keylist;
+        }
+    }
+
+    if (not keylist) {
+        keylist = Collect_Keylist_Managed(
+            head,
+            tail,
+            parent,
+            COLLECT_ONLY_SET_WORDS
+                | (kind == REB_OBJECT ? COLLECT_SHARE_SHAPE : 0)
+        );
+
+        if (entry and GET_SUBCLASS_FLAG(KEYLIST, keylist, SHARED)) {
+            entry->head = head;  // see TG_Spec_Keylists
+            entry->tail = tail;
+            entry->keylist = keylist;
+        }
+    }
 
     REBLEN len = SER_USED(keylist);
     REBARR *varlist = Make_Array_Core(
@@ -557,7 +920,10 @@ REBCTX *Make_Context_Detect_Managed(
     // obvious what's going on.
     //
     if (not parent) {
-        INIT_CTX_KEYLIST_UNIQUE(context, keylist);
+        if (GET_SUBCLASS_FLAG(KEYLIST, keylist, SHARED))  // a known shape
+            INIT_CTX_KEYLIST_SHARED(context, keylist);
+        else
+            INIT_CTX_KEYLIST_UNIQUE(context, keylist);
         mutable_LINK(Ancestor, keylist) = keylist;
     }
     else {
@@ -694,6 +1060,23 @@ REBARR *Context_To_Array(const RELVAL *context, REBINT mode)
     if (IS_FRAME(context))
         honor_hidden = not IS_FRAME_PHASED(context);
 
+    if (not IS_FRAME(context)) {  // frames may have duplicate keys, phases
+        REBSER *keylist = CTX_KEYLIST(c);
+        if (
+            NOT_SUBCLASS_FLAG(KEYLIST, keylist, INDEXED)
+            and SER_USED(keylist) >= KEYLIST_INDEX_MIN_KEYS
+        ){
+            Index_Keylist(keylist);
+        }
+
+        if (GET_SUBCLASS_FLAG(KEYLIST, keylist, INDEXED)) {
+            REBLEN n = Find_Symbol_In_Index(keylist, symbol, strict);
+            if (n == 0 or Is_Var_Hidden(CTX_VAR(c, n)))
+                return 0;
+            return n;
+        }
+    }
+
     const REBKEY *tail;
     const REBKEY *key = CTX_KEYS(&tail, c);
     const REBVAR *var = CTX_VARS_HEAD(c);
@@ -917,6 +1300,108 @@ void Resolve_Context(
 }
 
 
+//=//// KEYLIST INDEX /////////////////////////////////////////////////////=//
+//
+// A linear scan of the keys is the quickest way to look up a symbol in the
+// typical small object.  But modules and big configuration objects can have
+// thousands of keys, so once a keylist has KEYLIST_INDEX_MIN_KEYS of them a
+// hash index is built for it.  It lives with the keylist (not the varlist),
+// so all the contexts that share a keylist share the index too.
+//
+// The index is an array of REBLEN where [0] is the (power of 2) count of the
+// slots that follow.  Each slot is either 0 or a 1-based key position, and
+// collisions are resolved by linear probing.  Hash_String() is not case
+// sensitive, so synonyms land in the same run of slots and the index serves
+// both strict and non-strict lookups.
+//
+// Append_Context() adds new keys to the index, and rebuilds it when it gets
+// to be half full.  Keylists aren't otherwise changed once they are in use
+// (expanding a shared keylist makes a copy, which starts out unindexed).
+//
+
+#define KEYLIST_INDEX_MIN_KEYS 64
+
+static void Add_Key_To_Index(REBLEN *index, const REBSYM *symbol, REBLEN n)
+{
+    REBLEN mask = index[0] - 1;
+    REBLEN slot = cast(REBLEN, Hash_String(symbol)) & mask;
+    while (index[slot + 1] != 0)
+        slot = (slot + 1) & mask;
+    index[slot + 1] = n;
+}
+
+
+// If the allocation fails the keylist just isn't indexed, and lookups will
+// fall back on scanning.
+//
+static void Index_Keylist(REBSER *keylist)
+{
+    assert(NOT_SUBCLASS_FLAG(KEYLIST, keylist, INDEXED));
+
+    REBLEN len = SER_USED(keylist);
+    REBLEN capacity = 1;
+    while (capacity < len * 4)  // start out 1/4 full, so appends have room
+        capacity <<= 1;
+
+    REBLEN *index = TRY_ALLOC_N(REBLEN, capacity + 1);
+    if (index == nullptr)
+        return;
+
+    memset(index, 0, sizeof(REBLEN) * (capacity + 1));
+    index[0] = capacity;
+
+    const REBKEY *key = SER_HEAD(REBKEY, keylist);
+    REBLEN n;
+    for (n = 1; n <= len; ++n, ++key)
+        Add_Key_To_Index(index, KEY_SYMBOL(key), n);
+
+    MISC_KEYLIST_INDEX(keylist) = index;
+    SET_SUBCLASS_FLAG(KEYLIST, keylist, INDEXED);
+}
+
+
+//
+//  Free_Keylist_Index: C
+//
+// Called by Decay_Series() for indexed keylists, and when the index is to be
+// rebuilt bigger.
+//
+void Free_Keylist_Index(REBSER *keylist)
+{
+    assert(GET_SUBCLASS_FLAG(KEYLIST, keylist, INDEXED));
+
+    REBLEN *index = cast(REBLEN*, MISC_KEYLIST_INDEX(keylist));
+    FREE_N(REBLEN, index[0] + 1, index);
+
+    CLEAR_SUBCLASS_FLAG(KEYLIST, keylist, INDEXED);
+}
+
+
+// Gives the lowest key position matching the symbol, as a scan would.
+//
+static REBLEN Find_Symbol_In_Index(
+    REBSER *keylist,
+    const REBSYM *symbol,
+    bool strict
+){
+    REBLEN *index = cast(REBLEN*, MISC_KEYLIST_INDEX(keylist));
+    REBLEN mask = index[0] - 1;
+    REBLEN slot = cast(REBLEN, Hash_String(symbol)) & mask;
+
+    REBLEN found = 0;
+    REBLEN n;
+    for (; (n = index[slot + 1]) != 0; slot = (slot + 1) & mask) {
+        if (found != 0 and n > found)
+            continue;
+
+        const REBSYM *key_symbol = KEY_SYMBOL(SER_AT(REBKEY, keylist, n - 1));
+        if (strict ? key_symbol == symbol : Are_Synonyms(symbol, key_symbol))
+            found = n;
+    }
+    return found;
+}
+
+
 //
 //  Find_Symbol_In_Context: C
 //
@@ -1014,6 +1499,22 @@ REBVAL *Obj_Value(REBVAL *value, REBLEN index)
 //
 void Startup_Collector(void)
 {
+    // The cache for virtually bound word lookups (see %sys-bind.h) starts
+    // out with all entries unused.
+    //
+    TG_Word_Cache = TRY_ALLOC_N_ZEROFILL(
+        struct Reb_Word_Cache_Entry, WORD_CACHE_SIZE
+    );
+    TG_Word_Cache_Generation = 0;
+
+    TG_Keylist_Shapes = TRY_ALLOC_N_ZEROFILL(REBSER*, KEYLIST_SHAPES_SIZE);
+    TG_Spec_Keylists = TRY_ALLOC_N_ZEROFILL(
+        struct Reb_Spec_Keylist_Entry, SPEC_KEYLISTS_SIZE
+    );
+
+    TG_Field_Cache = TRY_ALLOC_N_ZEROFILL(
+        struct Reb_Field_Cache_Entry, FIELD_CACHE_SIZE
+    );
 }
 
 
@@ -1022,6 +1523,12 @@ void Startup_Collector(void)
 //
 void Shutdown_Collector(void)
 {
+    FREE_N(struct Reb_Word_Cache_Entry, WORD_CACHE_SIZE, TG_Word_Cache);
+    FREE_N(REBSER*, KEYLIST_SHAPES_SIZE, TG_Keylist_Shapes);
+    FREE_N(
+        struct Reb_Spec_Keylist_Entry, SPEC_KEYLISTS_SIZE, TG_Spec_Keylists
+    );
+    FREE_N(struct Reb_Field_Cache_Entry, FIELD_CACHE_SIZE, TG_Field_Cache);
 }
 
 
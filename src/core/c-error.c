@@ -48,6 +48,8 @@ void Snap_State_Core(struct Reb_State *s)
 
     s->saved_sigmask = Eval_Sigmask;
 
+    s->discards_error = false;
+
     // !!! Is this initialization necessary?
     s->error = NULL;
 }
@@ -292,7 +294,13 @@ ATTRIBUTE_NO_RETURN void Fail_Core(const void *p)
     // If this were to be done there would have to be a preallocated array
     // to use for it.
     //
-    if (error != Error_No_Memory(1020)) {  // static global, review
+    // Don't do it if the trap the error goes to will throw the error away,
+    // as it is most of the cost of a failure in code like `attempt [...]`.
+    //
+    if (
+        error != Error_No_Memory(1020)  // static global, review
+        and not (TG_Jump_List and TG_Jump_List->discards_error)
+    ){
         ERROR_VARS *vars = ERR_VARS(error);
         if (IS_NULLED_OR_BLANK(&vars->where))
             Set_Location_Of_Error(error, FS_TOP);
@@ -300,7 +308,7 @@ ATTRIBUTE_NO_RETURN void Fail_Core(const void *p)
 
   #ifdef DEBUG_HAS_PROBE
     if (PG_Probe_Failures) {  // see R3_PROBE_FAILURES environment variable
-        static bool probing = false;
+        static ISOLATE_LOCAL bool probing = false;
 
         if (p == cast(void*, VAL_CONTEXT(Root_Stackoverflow_Error))) {
             printf("PROBE(Stack Overflow): mold in PROBE would recurse\n");
@@ -338,6 +346,8 @@ ATTRIBUTE_NO_RETURN void Fail_Core(const void *p)
     // to C_STACK_OVERFLOWING.  (See notes on the sketchiness in general of
     // the way R3-Alpha handles stack overflows, and alternative plans.)
     //
+    USDT_PROBE1(fail__unwind, error);
+
     REBFRM *f = FS_TOP;
     while (f != TG_Jump_List->frame) {
         if (Is_Action_Frame(f)) {
@@ -969,6 +969,10 @@ REBACT *Make_Action(
             break;
 
           case REB_P_SOFT:
+            SET_ACTION_FLAG(act, SOFT_QUOTES_FIRST);
+            SET_ACTION_FLAG(act, QUOTES_FIRST);
+            break;
+
           case REB_P_MEDIUM:
           case REB_P_HARD:
             SET_ACTION_FLAG(act, QUOTES_FIRST);
@@ -1070,6 +1074,12 @@ void Get_Maybe_Fake_Action_Body(REBVAL *out, const REBVAL *action)
         // to the action.
 
         RELVAL *body = ARR_AT(details, IDX_DETAILS_1);
+        if (
+            ACT_DISPATCHER(a) != &Block_Dispatcher
+            and IS_BLOCK(body) and not IS_RELATIVE(body)
+        ){
+            Relativize_Pending_Body(a);  // FUNC hasn't run yet, copy now
+        }
 
         // The PARAMLIST_HAS_RETURN tricks for definitional return make it
         // seem like a generator authored more code in the action's body...but
@@ -158,6 +158,9 @@ REB_R Do_Port_Action(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
                 assert(!"Bad REB_R in READ workaround for /STRING /LINES");
         }
 
+        if (REF(lines) and IS_BLOCK(D_OUT))
+            return r;  // port gave back lines itself (e.g. an open file)
+
         if ((REF(string) or REF(lines)) and not IS_TEXT(D_OUT)) {
             if (not IS_BINARY(D_OUT))
                 fail ("/STRING or /LINES used on a non-BINARY!/STRING! read");
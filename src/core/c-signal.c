@@ -46,6 +46,16 @@
 
 #include "sys-core.h"
 
+// A fixed count of evaluations between signal checks takes a varying amount
+// of time, depending on whether the steps are `x: x + 1` or calls to natives
+// that do a lot of work.  So the dose is adjusted each time it runs out, to
+// try to make it take about EVAL_SLICE_NS.  That's what paces incremental GC
+// steps and how soon a Ctrl-C is noticed.
+//
+#define EVAL_SLICE_NS 1000000  // one millisecond
+#define EVAL_DOSE_MIN 1000
+#define EVAL_DOSE_MAX 1000000
+
 
 //
 //  Do_Signals_Throws: C
@@ -66,6 +76,18 @@
 // not cleared by the end of this routine, it resets the Eval_Count to 1
 // rather than giving it the full EVAL_DOSE of counts until next call.
 //
+// Building with SIGNALS_AT_CALLS moves the countdown out of the per-step
+// path: it's only decremented when an action is dispatched and when a block
+// or group starts evaluating (e.g. each pass of a loop body).  Any code that
+// runs long enough to matter does one or the other, so asynchronous requests
+// are still noticed...just counted in fewer, coarser "evaluations".
+//
+// A debugger steps by leaving SIG_STEP set, which keeps the Eval_Count at 1
+// so this runs on every evaluator step and calls PG_Step_Hook.  So there's
+// no separate "debug hook" test in the evaluator to pay for when no one is
+// stepping.  (Breakpoints don't need any help from the evaluator, see the
+// debugger extension's SET-BREAKPOINT.)
+//
 // Currently the ability of a signal to THROW comes from the processing of
 // breakpoints.  The RESUME instruction is able to execute code with /DO,
 // and that code may escape from a debug interrupt signal (like Ctrl-C).
@@ -78,10 +100,35 @@ bool Do_Signals_Throws(REBVAL *out)
     // due to the fact that Do_Signals_Throws can be queued to run by setting
     // the Eval_Count to 1 for a specific signal.  Review.
     //
-    Eval_Cycles += Eval_Dose - Eval_Count;
+    REBI64 evals = Eval_Dose - Eval_Count;
+    Eval_Cycles += evals;
+
+    // If no signal cut the dose short, see how long it took and adjust it
+    // toward EVAL_SLICE_NS.  Only go halfway, so one unusually slow or fast
+    // stretch of code doesn't swing it too far.  (The profiler sets its own
+    // dose, so leave that alone.)
+    //
+    REBI64 now = Startup_Clock_Nanoseconds();
+    if (not TG_Profiling and not (Eval_Signals & Eval_Sigmask)) {
+        REBI64 elapsed = now - Eval_Dose_Start;
+        if (elapsed > 0) {
+            REBI64 dose = (
+                Eval_Dose + cast(REBI64, Eval_Dose) * EVAL_SLICE_NS / elapsed
+            ) / 2;
+            if (dose < EVAL_DOSE_MIN)
+                dose = EVAL_DOSE_MIN;
+            else if (dose > EVAL_DOSE_MAX)
+                dose = EVAL_DOSE_MAX;
+            Eval_Dose = cast(uint_fast32_t, dose);
+        }
+    }
+    Eval_Dose_Start = now;
 
     Eval_Count = Eval_Dose;
 
+    if (TG_Profiling)  // see PROFILER, may reset Eval_Dose if it times out
+        Sample_Frame_Stack(evals);
+
     bool thrown = false;
 
     // The signal mask allows the system to disable processing of some
@@ -96,9 +143,21 @@ bool Do_Signals_Throws(REBVAL *out)
 
     // "Be careful of signal loops! EG: do not PRINT from here."
 
-    if (filtered_sigs & SIG_RECYCLE) {
+    // An incremental mark phase (see RECYCLE/INCREMENTAL) takes another step
+    // each time signals are processed, whether the ballast ran out or not.
+    //
+    if (
+        (filtered_sigs & SIG_RECYCLE)
+        or (GC_Marking and (saved_sigmask & SIG_RECYCLE))
+    ){
         CLR_SIGNAL(SIG_RECYCLE);
-        Recycle();
+        GC_Trigger = GC_TRIGGER_BALLAST;  // (or the GC was deferred, see OFF)
+        if (GC_Step_Budget != 0 or GC_Marking)
+            Recycle_Step();
+        else if (GC_Generational)
+            Recycle_Minor();
+        else
+            Recycle();
     }
 
 #ifdef NOT_USED_INVESTIGATE
@@ -116,6 +175,7 @@ bool Do_Signals_Throws(REBVAL *out)
             panic ("Ctrl-C or other HALT signal with no trap to process it");
 
         CLR_SIGNAL(SIG_HALT);
+        CLR_SIGNAL(SIG_STEP);  // don't keep stepping in the top level console
         Eval_Sigmask = saved_sigmask;
 
         Init_Thrown_With_Label(out, NULLED_CELL, NATIVE_VAL(halt));
@@ -143,6 +203,25 @@ bool Do_Signals_Throws(REBVAL *out)
         fail ("BREAKPOINT from SIG_INTERRUPT not currently implemented");
     }
 
+    if (filtered_sigs & SIG_STEP) {
+        //
+        // The signal isn't cleared, so the hook will run on the next step
+        // too.  It may start a debug console (which needs signals like Ctrl-C
+        // to work), so turn the mask back on first.  The hook should clear
+        // SIG_STEP if it does, so the console's own code isn't stepped.
+        //
+        Eval_Sigmask = saved_sigmask;
+
+        if (PG_Step_Hook == nullptr)
+            CLR_SIGNAL(SIG_STEP);
+        else if (PG_Step_Hook(out))
+            return true;
+
+        if (GET_SIGNAL(SIG_STEP))
+            Eval_Count = 1;  // come back here on the next step
+        return false;
+    }
+
     Eval_Sigmask = saved_sigmask;
     return thrown;
 }
@@ -181,6 +181,102 @@ static void Expand_Word_Table(void)
 }
 
 
+//=//// BUILT-IN SYMBOLS ////////////////////////////////////////////////=//
+//
+// The words in %words.r (and the datatypes, generics, and error IDs that get
+// SYMID numbers) are made by Startup_Builtin_Symbols() from a static table of
+// spellings that %make-boot.r generates.  That is quicker than interning them
+// one at a time as the words of the boot block are scanned.
+//
+// They are not put in PG_Symbols_By_Hash.  %make-boot.r also generates a
+// perfect hash of the spellings, so Intern_UTF8_Managed() can find built-in
+// words with one probe.  (Built-in symbols are never GC'd before shutdown, see
+// Mark_Symbol_Series(), so they never need removing from a table.)
+//
+// The hash has to agree with HASH-SPELLING in %make-boot.r.  It goes by the
+// lowercase of each codepoint, so alternate casings of a built-in word probe
+// the same slot.  That slot then acts as the synonym to link new casings to.
+//
+
+static uint32_t Hash_Builtin_Spelling_May_Fail(
+    const REBYTE *utf8,
+    REBSIZ size
+){
+    uint32_t hash = 0;
+
+    for (; size != 0; ++utf8, --size) {
+        REBUNI c = *utf8;
+
+        if (c >= 0x80) {
+            utf8 = Back_Scan_UTF8_Char(&c, utf8, &size);
+            if (utf8 == nullptr)
+                fail (Error_Bad_Utf8_Raw());
+        }
+
+        hash = hash * 31 + LO_CASE(c);  // unsigned, so wraps
+    }
+
+    return hash;
+}
+
+
+// Returns the built-in symbol that the spelling could be a casing of, if any.
+// The caller has to compare the spellings to know.
+//
+static REBSYM *Try_Find_Builtin_Symbol(uint32_t hash)
+{
+    assert(PG_Symbol_Canons != nullptr);
+
+    REBLEN d = Builtin_Symbol_Displacements[
+        hash % NUM_BUILTIN_SYMBOL_BUCKETS
+    ];
+    REBLEN h1 = hash % NUM_BUILTIN_SYMBOL_SLOTS;
+    REBLEN h2 = 1 + (hash / NUM_BUILTIN_SYMBOL_SLOTS)
+        % (NUM_BUILTIN_SYMBOL_SLOTS - 1);
+
+    REBLEN id = Builtin_Symbol_Slots[(d * h2 + h1) % NUM_BUILTIN_SYMBOL_SLOTS];
+    if (id == 0)
+        return nullptr;
+
+    return m_cast(REBSYM*, Canon(cast(SYMID, id)));
+}
+
+
+// A new symbol series, not yet linked to synonyms or in any table.
+//
+static REBBIN *Make_Symbol_Series(const REBYTE *utf8, size_t size)
+{
+    REBBIN *s = BIN(Make_Series(
+        size + 1,  // if small, fits in a REBSER node (w/no data allocation)
+        FLAG_FLAVOR(SYMBOL) | SERIES_FLAG_FIXED_SIZE
+    ));
+
+    // The incoming string isn't always null terminated, e.g. if you are
+    // interning `foo` in `foo: bar + 1` it would be colon-terminated.
+    //
+    memcpy(BIN_HEAD(s), utf8, size);
+    TERM_BIN_LEN(s, size);
+
+    // The UTF-8 series can be aliased with AS to become an ANY-STRING! or a
+    // BINARY!.  If it is, then it should not be modified.
+    //
+    Freeze_Series(s);
+
+    // Symbols use their MISC() to hold binding information.  Long term, it
+    // may become a design that lets multiple binds run at once.  So the slot
+    // could hold an atomic pointer that would "pop out" to a structure.
+    // But for the moment only one bind runs at a time, and it's randomized to
+    // keep its information in high bits or low bits as a poor-man's demo that
+    // there is an infrastructure in place for sharing (start with 2, grow to
+    // N eventually).
+    //
+    s->misc.bind_index.high = 0;
+    s->misc.bind_index.low = 0;
+
+    return s;
+}
+
+
 //
 //  Intern_UTF8_Managed: C
 //
@@ -207,6 +303,21 @@ const REBSYM *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     // actually kept larger than that, but to be on the right side of theory,
     // the table is always checked for expansion needs *before* the search.)
     //
+    // Built-in words take one probe of the perfect hash.  An alternate
+    // casing of one still has to search the table below, since it may have
+    // been interned already.  If not, it's linked to the built-in symbol.
+    //
+    REBSYM *synonym = Try_Find_Builtin_Symbol(
+        Hash_Builtin_Spelling_May_Fail(utf8, size)
+    );
+    if (synonym) {
+        REBINT cmp = Compare_UTF8(STR_HEAD(synonym), utf8, size);
+        if (cmp == 0)
+            return synonym;  // was a case-sensitive match
+        if (cmp < 0)
+            synonym = nullptr;  // just shares the slot, not an alternate casing
+    }
+
     REBLEN num_slots = SER_USED(PG_Symbols_By_Hash);
     if (PG_Num_Symbol_Slots_In_Use > num_slots / 2) {
         Expand_Word_Table();
@@ -227,7 +338,6 @@ const REBSYM *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
     // be skipped to try again) the search uses a comparison that is
     // case-insensitive...but reports if synonyms via > 0 results.
     //
-    REBSYM *synonym = nullptr;
     REBSYM **deleted_slot = nullptr;
     REBSYM* symbol;
     while ((symbol = symbols_by_hash[slot])) {
@@ -262,27 +372,14 @@ const REBSYM *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
 
   new_interning: {
 
-    REBBIN *s = BIN(Make_Series(
-        size + 1,  // if small, fits in a REBSER node (w/no data allocation)
-        FLAG_FLAVOR(SYMBOL) | SERIES_FLAG_FIXED_SIZE
-    ));
-
-    // The incoming string isn't always null terminated, e.g. if you are
-    // interning `foo` in `foo: bar + 1` it would be colon-terminated.
-    //
-    memcpy(BIN_HEAD(s), utf8, size);
-    TERM_BIN_LEN(s, size);
-
-    // The UTF-8 series can be aliased with AS to become an ANY-STRING! or a
-    // BINARY!.  If it is, then it should not be modified.
-    //
-    Freeze_Series(s); 
+    REBBIN *s = Make_Symbol_Series(utf8, size);
 
     if (not synonym) {
         mutable_LINK(Synonym, s) = SYM(s);  // 1-item in circular list
 
         // leave header.bits as 0 for SYM_0 as answer to VAL_WORD_ID()
-        // Startup_Symbols() tags values from %words.r after the fact.
+        // (%words.r words were made by Startup_Builtin_Symbols() already,
+        // so a spelling of one of those would have found a synonym.)
         //
         // Words that aren't in the bootup %words.r list don't have integer
         // IDs defined that can be used in compiled C switch() cases (e.g.
@@ -311,17 +408,6 @@ const REBSYM *Intern_UTF8_Managed(const REBYTE *utf8, size_t size)
         SET_SECOND_UINT16(s->info, ID_OF_SYMBOL(synonym));
     }
 
-    // Symbols use their MISC() to hold binding information.  Long term, it
-    // may become a design that lets multiple binds run at once.  So the slot
-    // could hold an atomic pointer that would "pop out" to a structure.
-    // But for the moment only one bind runs at a time, and it's randomized to
-    // keep its information in high bits or low bits as a poor-man's demo that
-    // there is an infrastructure in place for sharing (start with 2, grow to
-    // N eventually).
-    //
-    s->misc.bind_index.high = 0;
-    s->misc.bind_index.low = 0;
-
     if (deleted_slot) {
         *deleted_slot = SYM(s);  // reuse the deleted slot
       #if !defined(NDEBUG)
@@ -390,6 +476,13 @@ void GC_Kill_Interning(REBSTR *intern)
     assert(intern->misc.bind_index.high == 0);  // shouldn't GC during binds?
     assert(intern->misc.bind_index.low == 0);
 
+    // Built-in symbols aren't in the hash table.  (They're only freed by the
+    // shutdown GC, as Mark_Symbol_Series() keeps them alive otherwise.)
+    //
+    OPT_SYMID id = ID_OF_SYMBOL(intern);
+    if (id != SYM_0 and Canon(cast(SYMID, id)) == intern)
+        return;
+
     REBLEN num_slots = SER_USED(PG_Symbols_By_Hash);
     REBSTR* *symbols_by_hash = SER_HEAD(REBSTR*, PG_Symbols_By_Hash);
 
@@ -433,6 +526,46 @@ void GC_Kill_Interning(REBSTR *intern)
 }
 
 
+//
+//  GC_Kill_Unmarked_Symbols: C
+//
+// A lazy sweep (see RECYCLE/LAZY) leaves dead series in the pools while the
+// evaluator runs.  Dead symbols can't wait for it, since Intern_UTF8_Managed()
+// would find them in the hash table and hand them out again.  So the GC
+// frees them right after marking, with this walk over the table.
+//
+// Killing a symbol only writes DELETED_SYMBOL into its own slot, so the walk
+// can go on in place.  Returns the number of symbols freed.
+//
+REBLEN GC_Kill_Unmarked_Symbols(void)
+{
+    REBLEN count = 0;
+
+    REBLEN num_slots = SER_USED(PG_Symbols_By_Hash);
+    REBSTR* *symbols_by_hash = SER_HEAD(REBSTR*, PG_Symbols_By_Hash);
+
+    REBLEN slot;
+    for (slot = 0; slot < num_slots; ++slot) {
+        REBSTR *symbol = symbols_by_hash[slot];
+        if (symbol == nullptr or symbol == DELETED_SYMBOL)
+            continue;
+
+        if (
+            (symbol->leader.bits & (NODE_FLAG_MANAGED | NODE_FLAG_MARKED))
+            != NODE_FLAG_MANAGED
+        ){
+            continue;  // live, or not up to the GC
+        }
+
+        GC_Kill_Series(symbol);  // calls GC_Kill_Interning()
+        assert(symbols_by_hash[slot] == DELETED_SYMBOL);
+        ++count;
+    }
+
+    return count;
+}
+
+
 //
 //  Startup_Interning: C
 //
@@ -477,122 +610,102 @@ void Startup_Interning(void)
 
 
 //
-//  Startup_Early_Symbols: C
+//  Startup_Builtin_Symbols: C
 //
-// It's very desirable to have `/`, `/foo`, `/foo/`, `/foo/(bar)` etc. be
-// instances of the same datatype of PATH!.  In this scheme, `/` would act
-// like a "root path" and be achieved with `to path! [_ _]`.
+// Makes the symbols for every word that has a SYMID (see BUILT-IN SYMBOLS),
+// and the PG_Symbol_Canons table mapping from SYM_XXX => REBSTR series.  This
+// is used e.g. by Canon(SYM_XXX) to get the string name for a symbol.
 //
-// But with limited ASCII symbols, there is strong demand for `/` to be able
-// to act like division in evaluative contexts, or to be overrideable for
-// other things in a way not too dissimilar from `+`.
+// Symbol series store the ID number in the header's 2nd uint16_t, which can
+// be quickly extracted with VAL_WORD_ID() for C switch statements.  These are
+// the only words that have fixed symbol numbers--others are only managed and
+// compared through their pointers.
+//
+// This has to happen before anything is scanned.  It's very desirable to
+// have `/`, `/foo`, `/foo/`, `/foo/(bar)` etc. be instances of the same
+// datatype of PATH!.  In this scheme, `/` would act like a "root path" and be
+// achieved with `to path! [_ _]`.  But with limited ASCII symbols, there is
+// strong demand for `/` to be able to act like division in evaluative
+// contexts, or to be overrideable for other things similar to `+`.
 //
 // The compromise used is to make `/` be a cell whose VAL_TYPE() is REB_PATH,
 // but whose CELL_KIND() is REB_WORD with the special spelling `-1-SLASH-`.
 // Binding mechanics and evaluator behavior are based on this unusual name.
 // But when inspected by the user, it appears to be a PATH! with 2 blanks.
-//
-// This duality is imperfect, as any routine with semantics like COLLECT-WORDS
-// would have to specifically account for it, or just see an empty path.
-// But it is intended to give some ability to configure the behavior easily.
-//
-// The trick which allows the `/` to be a 2-element PATH! and yet act like a
-// WORD! when used in evaluative contexts requires that word's spelling to be
-// available during scanning.  But scanning is what loads the %words.r symbol
-// list!  Break the Catch-22 by manually interning the symbol used.
+// The scanner needs that spelling to be available.
 //
 // (Same issue applies to the symbol in ~trash~ in release builds, used
 // e.g. by the data stack initialization.  In debug builds NULL is used to
 // detect the errors on reads.)
 //
-void Startup_Early_Symbols(void)
+void Startup_Builtin_Symbols(void)
 {
-    const char *slash1 = "-slash-1-";
+    assert(PG_Symbol_Canons == nullptr);
+    PG_Symbol_Canons = Make_Series(
+        1 + NUM_BUILTIN_SYMBOLS + 1,  // trash for SYM_0, and null terminator
+        FLAG_FLAVOR(COMMONWORDS)
+            | SERIES_FLAG_FIXED_SIZE  // can't ever add more SYM_XXX lookups
+    );
+
+    REBSTR* *canons = SER_HEAD(REBSTR*, PG_Symbol_Canons);
+
+    // All words that not in %words.r will get back VAL_WORD_ID(w) == SYM_0
+    // Hence, SYM_0 cannot be canonized.  Allowing Canon(SYM_0) to return NULL
+    // and try and use that meaningfully is too risky, so it is simply
+    // prohibited to canonize SYM_0, and trash the REBSTR* in the [0] slot.
+    //
+    TRASH_POINTER_IF_DEBUG(canons[SYM_0]);
+
+    REBLEN n;
+    for (n = 1; n <= NUM_BUILTIN_SYMBOLS; ++n) {
+        const char *spelling = Builtin_Symbol_Spellings[n];
+        REBBIN *s = Make_Symbol_Series(cb_cast(spelling), strsize(spelling));
+        mutable_LINK(Synonym, s) = SYM(s);  // no other casings yet
+
+        // Could probably use less than 16 bits, but 8 is insufficient.
+        // (length %words.r > 256)
+        //
+        SET_SECOND_UINT16(s->info, n);
+
+        canons[n] = SYM(Manage_Series(s));
+    }
+    canons[n] = nullptr;  // terminates for Mark_Symbol_Series()
+
+    SET_SERIES_USED(PG_Symbol_Canons, 1 + NUM_BUILTIN_SYMBOLS);
+
     assert(PG_Slash_1_Canon == nullptr);
-    PG_Slash_1_Canon = Intern_UTF8_Managed(cb_cast(slash1), strsize(slash1));
+    PG_Slash_1_Canon = Canon(SYM__SLASH_1_);
 
-    const char *dot1 = "-dot-1-";
     assert(PG_Dot_1_Canon == nullptr);
-    PG_Dot_1_Canon = Intern_UTF8_Managed(cb_cast(dot1), strsize(dot1));
+    PG_Dot_1_Canon = Canon(SYM__DOT_1_);
 
-    const char *trash = "trash";
     assert(PG_Trash_Canon == nullptr);
-    PG_Trash_Canon = Intern_UTF8_Managed(cb_cast(trash), strsize(trash));
+    PG_Trash_Canon = Canon(SYM_TRASH);
 }
 
 
 //
 //  Startup_Symbols: C
 //
-// By this point in the boot, the canon words have already been interned for
-// everything in %words.r.
-//
-// This goes through the name series for %words.r words and tags them with
-// SYM_XXX constants.  This allows the small number to be quickly extracted to
-// use with VAL_WORD_ID() in C switch statements.  These are the only words
-// that have fixed symbol numbers--others are only managed and compared
-// through their pointers.
-//
-// It also creates a table for mapping from SYM_XXX => REBSTR series.  This
-// is used e.g. by Canon(SYM_XXX) to get the string name for a symbol.
+// The symbols were all made by Startup_Builtin_Symbols(), before the boot
+// block was scanned.  So this just checks that the word list in the boot
+// block agrees with the table of spellings %make-boot.r generated for C.
 //
 void Startup_Symbols(REBARR *words)
 {
-    assert(PG_Symbol_Canons == nullptr);
-    PG_Symbol_Canons = Make_Series(
-        1 + ARR_LEN(words),  // 1 + => extra trash at head for SYM_0
-        FLAG_FLAVOR(COMMONWORDS)
-            | SERIES_FLAG_FIXED_SIZE  // can't ever add more SYM_XXX lookups
-    );
-
-    // All words that not in %words.r will get back VAL_WORD_ID(w) == SYM_0
-    // Hence, SYM_0 cannot be canonized.  Allowing Canon(SYM_0) to return NULL
-    // and try and use that meaningfully is too risky, so it is simply
-    // prohibited to canonize SYM_0, and trash the REBSTR* in the [0] slot.
-    //
-    SYMID sym = SYM_0;
-    TRASH_POINTER_IF_DEBUG(
-        *SER_AT(REBSTR*, PG_Symbol_Canons, cast(REBLEN, sym))
-    );
+    if (ARR_LEN(words) != NUM_BUILTIN_SYMBOLS)
+        panic (words);
 
+  #if !defined(NDEBUG)
+    REBLEN n = 0;
     const RELVAL *tail = ARR_TAIL(words);
     const RELVAL *word = ARR_HEAD(words);
     for (; word != tail; ++word) {
         assert(IS_WORD(word));  // real word, not fake (e.g. `/` as -slash-0-)
-        REBSYM *canon = m_cast(REBSYM*, VAL_WORD_SYMBOL(word));
-
-        sym = cast(SYMID, cast(REBLEN, sym) + 1);
-        *SER_AT(REBSTR*, PG_Symbol_Canons, cast(REBLEN, sym)) = canon;
-
-        if (sym == SYM__SLASH_1_)
-            assert(canon == PG_Slash_1_Canon);  // make sure it lined up!
-        else if (sym == SYM__DOT_1_)
-            assert(canon == PG_Dot_1_Canon);
-        else if (sym == SYM_TRASH)
-            assert(canon == PG_Trash_Canon);
-
-        // More code was loaded than just the word list, and it might have
-        // included alternate-case forms of the %words.r words.  Walk any
-        // aliases and make sure they have the header bits too.
-
-        REBSYM *name = canon;
-        do {
-            // Symbol series store symbol number in the header's 2nd uint16_t.
-            // Could probably use less than 16 bits, but 8 is insufficient.
-            // (length %words.r > 256)
-            //
-            assert(SECOND_UINT16(name->info) == 0);
-            SET_SECOND_UINT16(name->info, sym);
-            assert(Same_Nonzero_Symid(ID_OF_SYMBOL(name), sym));
-
-            name = LINK(Synonym, name);
-        } while (name != canon); // circularly linked list, stop on a cycle
+        ++n;
+        assert(VAL_WORD_SYMBOL(word) == Canon(cast(SYMID, n)));
     }
-
-    *SER_AT(REBSTR*, PG_Symbol_Canons, cast(REBLEN, sym)) = NULL; // terminate
-
-    SET_SERIES_USED(PG_Symbol_Canons, 1 + cast(REBLEN, sym));
-    assert(SER_USED(PG_Symbol_Canons) == 1 + ARR_LEN(words));
+  #endif
 
     // Do some sanity checks.  !!! Fairly critical, is debug-only appropriate?
 
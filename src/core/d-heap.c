@@ -0,0 +1,360 @@
+//
+//  File: %d-heap.c
+//  Summary: "Binary heap dumps, for offline analysis of what memory is live"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// STATS can say how much memory is in use, but not what is keeping it alive.
+// DUMP-HEAP runs a full collection with Recycle_Tracing_Heap(), and writes
+// down each node the marking reaches and each reference it follows to get
+// there.  That is the whole live graph, so the retained size of a node (what
+// would be freed if it were not referenced) can be worked out after the
+// fact, along with a path to it from the root set.
+//
+// %scripts/heap-summary.reb does that analysis.  The dump itself is kept to
+// what the GC knows while marking, and is built in malloc() memory, since no
+// series can be made during a collection.
+//
+// The format is a header, then records that each start with a letter.  All
+// integers are unsigned and little-endian, with nodes given by address:
+//
+//     "REBHEAP" 1  u32 sizeof(REBSER)  u32 sizeof(REBVAL)
+//     'F' u8 flavor  u8 length  name  (flavor 255 is a pairing)
+//     'K' u8 kind  u8 length  name  (for the heart in an 'E' record)
+//     'S' u32 id  u32 length  UTF-8  (file of an allocation site)
+//     'N' u64 node  u8 flavor  u64 bytes  u32 file-id  u32 line
+//     'E' u64 from  u64 to  u8 how  (a Reb_Kind or a HEAP_EDGE_XXX)
+//     'R' u8 root  u64 to  (a HEAP_ROOT_XXX)
+//     'Z' u64 lost  (records dropped for lack of memory; always last)
+//
+// A node's 'N' record comes before any record that references it, with the
+// exception of edges into symbols marked in bulk by the GC (which have no
+// 'N' record unless something else reaches them first).  The file and line
+// are those of the code that was running when an array was made, which the
+// system tracks for arrays that have ARRAY_FLAG_HAS_FILE_LINE_UNMASKED.
+//
+
+#include "sys-core.h"
+
+
+#define HEAP_DUMP_VERSION 1
+#define HEAP_DUMP_PAIRING 255  // flavor byte for pairings
+#define HEAP_RECORD_MAX 32  // enough for any record but 'S'
+#define HEAP_SITE_CACHE 64  // power of 2
+
+static REBYTE *heap_dump = nullptr;
+static REBSIZ heap_dump_used = 0;
+static REBSIZ heap_dump_size = 0;
+static REBU64 heap_dump_lost = 0;
+
+// Filenames are written once per dump, unless they are bumped out of this
+// direct-mapped cache by another file.  (The same file under two ids is fine
+// for the reader, it's just a few more bytes.)
+//
+static struct {
+    const REBSTR *file;
+    uint32_t id;
+} heap_sites[HEAP_SITE_CACHE];
+static uint32_t heap_site_count = 0;
+
+
+static void Free_Heap_Dump(void)
+{
+    if (heap_dump_size != 0)
+        FREE_N(REBYTE, heap_dump_size, heap_dump);
+    heap_dump = nullptr;
+    heap_dump_used = 0;
+    heap_dump_size = 0;
+}
+
+
+static REBYTE *Try_Reserve_Heap_Dump(REBSIZ size)
+{
+    if (heap_dump_size - heap_dump_used >= size)
+        return heap_dump + heap_dump_used;
+
+    REBSIZ new_size = heap_dump_size == 0 ? 65536 : heap_dump_size * 2;
+    while (new_size - heap_dump_used < size)
+        new_size *= 2;
+
+    REBYTE *dump = TRY_ALLOC_N(REBYTE, new_size);
+    if (dump == nullptr) {
+        ++heap_dump_lost;
+        return nullptr;
+    }
+    if (heap_dump_size != 0) {
+        memcpy(dump, heap_dump, heap_dump_used);
+        FREE_N(REBYTE, heap_dump_size, heap_dump);
+    }
+    heap_dump = dump;
+    heap_dump_size = new_size;
+    return heap_dump + heap_dump_used;
+}
+
+
+static REBYTE *Dump_U32_LE(REBYTE *bp, uint32_t u) {
+    int i;
+    for (i = 0; i < 4; ++i, u >>= 8)
+        *bp++ = cast(REBYTE, u & 0xFF);
+    return bp;
+}
+
+static REBYTE *Dump_U64_LE(REBYTE *bp, REBU64 u) {
+    int i;
+    for (i = 0; i < 8; ++i, u >>= 8)
+        *bp++ = cast(REBYTE, u & 0xFF);
+    return bp;
+}
+
+#define Put_Node(bp,n) \
+    Dump_U64_LE((bp), cast(uintptr_t, (n)))
+
+
+// 'F' and 'K' records, which give the names for the codes in the dump.
+//
+static void Dump_Heap_Name(REBYTE tag, REBYTE code, const char *name)
+{
+    REBSIZ len = strsize(name);
+    if (len > 255)
+        len = 255;
+
+    REBYTE *bp = Try_Reserve_Heap_Dump(3 + len);
+    if (bp == nullptr)
+        return;
+
+    *bp++ = tag;
+    *bp++ = code;
+    *bp++ = cast(REBYTE, len);
+    memcpy(bp, name, len);
+    heap_dump_used += 3 + len;
+}
+
+
+static const char *Flavor_Name(REBYTE flavor)
+{
+    switch (flavor) {
+      case FLAVOR_ARRAY: return "array";
+      case FLAVOR_VARLIST: return "varlist";
+      case FLAVOR_DETAILS: return "details";
+      case FLAVOR_PAIRLIST: return "pairlist";
+      case FLAVOR_PATCH: return "patch";
+      case FLAVOR_PARTIALS: return "partials";
+      case FLAVOR_LIBRARY: return "library";
+      case FLAVOR_HANDLE: return "handle";
+      case FLAVOR_GOBLIST: return "goblist";
+      case FLAVOR_DATASTACK: return "datastack";
+      case FLAVOR_FEED: return "feed";
+      case FLAVOR_API: return "api";
+      case FLAVOR_INSTRUCTION_ADJUST_QUOTING: return "adjust-quoting";
+      case FLAVOR_INSTRUCTION_SPLICE: return "splice";
+      case FLAVOR_KEYLIST: return "keylist";
+      case FLAVOR_POINTER: return "pointer";
+      case FLAVOR_CANONTABLE: return "canontable";
+      case FLAVOR_COMMONWORDS: return "commonwords";
+      case FLAVOR_NODELIST: return "nodelist";
+      case FLAVOR_SERIESLIST: return "serieslist";
+      case FLAVOR_MOLDSTACK: return "moldstack";
+      case FLAVOR_HASHLIST: return "hashlist";
+      case FLAVOR_BOOKMARKLIST: return "bookmarklist";
+      case FLAVOR_BINARY: return "binary";
+      case FLAVOR_STRING: return "string";
+      case FLAVOR_SYMBOL: return "symbol";
+      default: break;
+    }
+    return nullptr;
+}
+
+
+// Give back the id of an allocation site's file, writing its 'S' record if
+// it isn't in the cache.  Zero if there's no room for the record.
+//
+static uint32_t Heap_Site_Id(const REBSTR *file)
+{
+    REBLEN slot = (cast(uintptr_t, file) >> 4) & (HEAP_SITE_CACHE - 1);
+    if (heap_sites[slot].file == file)
+        return heap_sites[slot].id;
+
+    REBSIZ len = STR_SIZE(file);
+    REBYTE *bp = Try_Reserve_Heap_Dump(9 + len);
+    if (bp == nullptr)
+        return 0;
+
+    uint32_t id = ++heap_site_count;
+    *bp++ = 'S';
+    bp = Dump_U32_LE(bp, id);
+    bp = Dump_U32_LE(bp, len);
+    memcpy(bp, STR_UTF8(file), len);
+    heap_dump_used += 9 + len;
+
+    heap_sites[slot].file = file;
+    heap_sites[slot].id = id;
+    return id;
+}
+
+
+static void Dump_Heap_Node(const void *p)
+{
+    REBYTE flavor;
+    REBU64 bytes;
+    uint32_t file_id = 0;
+    uint32_t line = 0;
+
+    if (*cast(const REBYTE*, p) & NODE_BYTEMASK_0x01_CELL) {
+        flavor = HEAP_DUMP_PAIRING;
+        bytes = 2 * sizeof(REBVAL);
+    }
+    else {
+        const REBSER *s = SER(m_cast(void*, p));
+        flavor = SER_FLAVOR(s);
+        bytes = sizeof(REBSER) + SER_TOTAL_IF_DYNAMIC(s);
+
+        if (
+            not GET_SERIES_FLAG(s, INACCESSIBLE)
+            and IS_SER_ARRAY(s)
+            and Has_File_Line(ARR(m_cast(REBSER*, s)))
+        ){
+            const REBARR *a = ARR(m_cast(REBSER*, s));
+            const REBSTR *file = LINK(Filename, a);
+            if (file) {
+                file_id = Heap_Site_Id(file);
+                line = a->misc.line;
+            }
+        }
+    }
+
+    REBYTE *bp = Try_Reserve_Heap_Dump(HEAP_RECORD_MAX);
+    if (bp == nullptr)
+        return;
+
+    REBYTE *start = bp;
+    *bp++ = 'N';
+    bp = Put_Node(bp, p);
+    *bp++ = flavor;
+    bp = Dump_U64_LE(bp, bytes);
+    bp = Dump_U32_LE(bp, file_id);
+    bp = Dump_U32_LE(bp, line);
+    heap_dump_used += bp - start;
+}
+
+
+//
+//  Trace_Heap_Reference: C
+//
+// Called by the GC during Recycle_Tracing_Heap() for each reference it
+// follows, *before* it checks to see if the node is marked.  So a node that
+// is not marked yet is being reached for the first time, and gets its 'N'
+// record written.  If `from` is null, then `how` is a HEAP_ROOT_XXX.
+//
+void Trace_Heap_Reference(const void *from, const void *to, REBYTE how)
+{
+    REBYTE first = *cast(const REBYTE*, to);
+    if (
+        (first & NODE_BYTEMASK_0x01_CELL)
+        and not (first & NODE_BYTEMASK_0x20_MANAGED)
+    ){
+        return;  // not a pairing, the GC doesn't look into it either
+    }
+
+    if (not (first & NODE_BYTEMASK_0x10_MARKED))
+        Dump_Heap_Node(to);
+
+    REBYTE *bp = Try_Reserve_Heap_Dump(HEAP_RECORD_MAX);
+    if (bp == nullptr)
+        return;
+
+    REBYTE *start = bp;
+    if (from == nullptr) {
+        *bp++ = 'R';
+        *bp++ = how;
+        bp = Put_Node(bp, to);
+    }
+    else {
+        *bp++ = 'E';
+        bp = Put_Node(bp, from);
+        bp = Put_Node(bp, to);
+        *bp++ = how;
+    }
+    heap_dump_used += bp - start;
+}
+
+
+//
+//  dump-heap: native [
+//
+//  {Collect garbage, then give back a dump of all the memory left in use}
+//
+//      return: "Analyze with %scripts/heap-summary.reb"
+//          [binary!]
+//  ]
+//
+REBNATIVE(dump_heap)
+{
+    INCLUDE_PARAMS_OF_DUMP_HEAP;
+
+    Free_Heap_Dump();
+    heap_dump_lost = 0;
+    heap_site_count = 0;
+    memset(heap_sites, 0, sizeof(heap_sites));
+
+    REBYTE *bp = Try_Reserve_Heap_Dump(HEAP_RECORD_MAX);
+    if (bp == nullptr)
+        fail (Error_No_Memory(HEAP_RECORD_MAX));
+
+    REBYTE *start = bp;
+    memcpy(bp, "REBHEAP", 7);
+    bp += 7;
+    *bp++ = HEAP_DUMP_VERSION;
+    bp = Dump_U32_LE(bp, sizeof(REBSER));
+    bp = Dump_U32_LE(bp, sizeof(REBVAL));
+    heap_dump_used += bp - start;
+
+    Dump_Heap_Name('F', HEAP_DUMP_PAIRING, "pairing");
+
+    REBLEN n;
+    for (n = 0; n < FLAVOR_MAX; ++n) {
+        const char *name = Flavor_Name(cast(REBYTE, n));
+        if (name)
+            Dump_Heap_Name('F', cast(REBYTE, n), name);
+    }
+
+    for (n = REB_0 + 1; n < REB_MAX; ++n)
+        Dump_Heap_Name(
+            'K',
+            cast(REBYTE, n),
+            STR_UTF8(Canon(SYM_FROM_KIND(n)))
+        );
+
+    Recycle_Tracing_Heap();
+
+    bp = Try_Reserve_Heap_Dump(9);
+    if (bp == nullptr) {
+        REBSIZ size = heap_dump_size;
+        Free_Heap_Dump();
+        fail (Error_No_Memory(size * 2));
+    }
+    *bp++ = 'Z';
+    Dump_U64_LE(bp, heap_dump_lost);
+    heap_dump_used += 9;
+
+    REBBIN *bin = Make_Binary(heap_dump_used);
+    memcpy(BIN_HEAD(bin), heap_dump, heap_dump_used);
+    TERM_BIN_LEN(bin, heap_dump_used);
+    Free_Heap_Dump();
+
+    return Init_Binary(D_OUT, bin);
+}
@@ -28,16 +28,28 @@
 
 #include "sys-core.h"
 
+#include <time.h>  // time(), for PROFILER/FOR
+
 
 //
 //  stats: native [
 //
 //  {Provides status and statistics information about the interpreter.}
 //
-//      return: [<opt> time! integer! object!]
+//      return: [<opt> time! integer! object! block!]
 //      /show "Print formatted results to console"
-//      /profile "Returns profiler object"
+//      /profile "Block of PROFILER/CALLS tallies, one object per function"
+//          [word!] "Column to sort by: CALLS, INCLUSIVE, EXCLUSIVE, ALLOCATED"
+//      /allocations "Block of PROFILER/MEMORY sites, after a recycle"
+//          [word!] "Column to sort by: ALLOCATED, LIVE"
+//      /counters "Object of series and evaluation counters (debug build)"
 //      /evals "Number of values evaluated by interpreter"
+//      /pools "Block of per-pool allocation figures, including unit caches"
+//      /gc "Counts and wall clock times of minor and major collections"
+//      /pauses "Log of the most recent collections (wall clock), oldest first"
+//      /startup "Times taken by the stages of interpreter startup"
+//      /parse "Hits and misses of PARSE/MEMO's table of subrule results"
+//      /maps "Growths of MAP! hashlists, and zombie records squeezed out"
 //      /pool "Dump all series in pool"
 //          [integer!]
 //  ]
@@ -51,13 +63,157 @@ REBNATIVE(stats)
     if (REF(evals))
         return Init_Integer(D_OUT, num_evals);
 
-    if (REF(profile)) {
+    if (REF(gc)) {
+        DECLARE_LOCAL (minor_time);
+        Init_Time_Nanoseconds(minor_time, GC_Minor_Nanoseconds);
+        DECLARE_LOCAL (major_time);
+        Init_Time_Nanoseconds(major_time, GC_Major_Nanoseconds);
+
+        return rebValue("make object! [",
+            "generational:", rebL(GC_Generational),
+            "minor:", rebI(GC_Minor_Count),
+            "minor-time:", minor_time,
+            "major:", rebI(GC_Major_Count),
+            "major-time:", major_time,
+            "nursery:", rebI(SER_USED(GC_Nursery)),
+            "remembered:", rebI(SER_USED(GC_Remarks)),
+        "]");
+    }
+
+    if (REF(parse)) {
+        return rebValue("make object! [",
+            "memo-hits:", rebI(TG_Parse_Memo_Hits),
+            "memo-misses:", rebI(TG_Parse_Memo_Misses),
+            "memo-size:", rebI(TG_Parse_Memo_Size),
+        "]");
+    }
+
+    if (REF(maps)) {
+        return rebValue("make object! [",
+            "migrations:", rebI(TG_Map_Migrations),
+            "records-migrated:", rebI(TG_Map_Records_Migrated),
+            "compactions:", rebI(TG_Map_Compactions),
+            "zombies-removed:", rebI(TG_Map_Zombies_Removed),
+        "]");
+    }
+
+    if (REF(pauses)) {
+        REBDSP dsp_orig = DSP;
+
+        REBU64 n = GC_Pauses_Logged < GC_PAUSE_LOG_SIZE
+            ? 0
+            : GC_Pauses_Logged - GC_PAUSE_LOG_SIZE;
+        for (; n != GC_Pauses_Logged; ++n) {
+            struct Reb_GC_Pause *p = &GC_Pause_Log[n % GC_PAUSE_LOG_SIZE];
+
+            const char *trigger;
+            switch (p->trigger) {
+              case GC_TRIGGER_REQUEST: trigger = "'request"; break;
+              case GC_TRIGGER_BALLAST: trigger = "'ballast"; break;
+              case GC_TRIGGER_PROMOTION: trigger = "'promotion"; break;
+              case GC_TRIGGER_SHUTDOWN: trigger = "'shutdown"; break;
+              default: panic (nullptr);
+            }
+
+            DECLARE_LOCAL (time);
+            Init_Time_Nanoseconds(time, p->nanoseconds);
+            DECLARE_LOCAL (interval);
+            Init_Time_Nanoseconds(interval, p->interval);
+
+            REBVAL *pause = rebValue("make object! [",
+                "minor:", rebL(p->minor),
+                "trigger:", trigger,
+                "time:", time,
+                "interval:", interval,
+                "allocated:", rebI(p->allocated),
+                "freed:", rebI(p->freed),
+                "live:", rebI(p->live),
+                "swept:", rebI(p->swept),
+            "]");
+            Copy_Cell(DS_PUSH(), pause);
+            rebRelease(pause);
+        }
+
+        return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+    }
+
+    if (REF(startup)) {
+        static const char *names[STARTUP_MAX] = {  // see Startup_Stages
+            "pools",
+            "symbols",
+            "decompress",
+            "scan",
+            "natives",
+            "base",
+            "sys",
+            "mezzanine",
+            "extensions"
+        };
+
+        REBDSP dsp_orig = DSP;
+
+        int stage;
+        for (stage = 0; stage != STARTUP_MAX; ++stage) {
+            Init_Word(DS_PUSH(), Intern_UTF8_Managed(
+                cb_cast(names[stage]), strsize(names[stage])
+            ));
+            Init_Time_Nanoseconds(DS_PUSH(), PG_Startup_Nanoseconds[stage]);
+        }
+
+        return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+    }
+
+    if (REF(pools)) {
+        REBDSP dsp_orig = DSP;
+
+        REBLEN n;
+        for (n = 0; n != SYSTEM_POOL; ++n) {
+            REBPOL *pool = &Mem_Pools[n];
+            REBPCH *cache = &TG_Pool_Caches[n];
+
+            REBLEN segs = 0;
+            REBSEG *seg;
+            for (seg = pool->segs; seg != nullptr; seg = seg->next)
+                ++segs;
+
+            REBLEN used = pool->has - Pool_Units_Free(n);
+
+            REBVAL *pool_stats = rebValue("make object! [",
+                "wide:", rebI(pool->wide),
+                "segments:", rebI(segs),
+                "reclaimed:", rebI(pool->reclaimed),
+                "units:", rebI(pool->has),
+                "used:", rebI(used),
+                "occupancy:", rebI(pool->has == 0 ? 0 : (used * 100) / pool->has),
+                "free:", rebI(pool->free),
+                "cached:", rebI(cache->count),
+                "cache-hits:", rebI(cache->hits),
+                "cache-misses:", rebI(cache->misses),
+                "cache-refills:", rebI(cache->refills),
+                "cache-drains:", rebI(cache->drains),
+            "]");
+            Copy_Cell(DS_PUSH(), pool_stats);
+            rebRelease(pool_stats);
+        }
+
+        return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+    }
+
+    if (REF(profile))
+        return Init_Call_Profile(D_OUT, ARG(profile));
+
+    if (REF(allocations))
+        return Init_Allocation_Profile(D_OUT, ARG(allocations));
+
+    if (REF(counters)) {
       #if defined(DEBUG_COLLECT_STATS)
         return rebValue("make object! [",
             "evals:", rebI(num_evals),
             "series-made:", rebI(PG_Reb_Stats->Series_Made),
             "series-freed:", rebI(PG_Reb_Stats->Series_Freed),
             "series-expanded:", rebI(PG_Reb_Stats->Series_Expanded),
+            "series-expand-copied:",
+                rebI(PG_Reb_Stats->Series_Expand_Copied),
             "series-bytes:", rebI(PG_Reb_Stats->Series_Memory),
             "series-recycled:", rebI(PG_Reb_Stats->Recycle_Series_Total),
             "made-blocks:", rebI(PG_Reb_Stats->Blocks),
@@ -146,3 +302,1388 @@ REBNATIVE(callgrind)
     fail ("This executable wasn't compiled with INCLUDE_CALLGRIND_NATIVE");
   #endif
 }
+
+
+//=//// SAMPLING PROFILER (PROFILER) //////////////////////////////////////=//
+//
+// CALLGRIND only helps when running under valgrind, which is too slow for
+// looking at a real workload.  PROFILER instead has Do_Signals_Throws() run
+// every `profile_every` evaluations (in place of the usual Eval_Dose), and
+// call Sample_Frame_Stack().  That walks down from FS_TOP for the labels of
+// the actions that are running, with the file and line each was called
+// from, and tallies the evaluations since the last sample under that stack.
+//
+// PROFILER 'OFF gives the tallies back in the "collapsed stack" format that
+// flame graph tools read: one stack per line, outermost call first, frames
+// separated by semicolons and the count after a space:
+//
+//     do %work.r:1;process %work.r:10;parse-item %work.r:3 4000
+//
+// Sampling by evaluation count instead of with a timer signal means time
+// spent inside natives isn't seen in proportion to how long it took.  But
+// it needs no platform support, and the frame stack is only ever walked at
+// a point where it's known to be consistent.
+//
+
+#define PROFILE_EVERY_DEFAULT 1000
+#define PROFILE_DEPTH_MAX 256  // frames past this (from the top) are dropped
+#define PROFILE_STACK_MAX 4096  // bytes of collapsed stack kept per sample
+
+struct Reb_Profile_Entry {
+    REBYTE *stack;  // collapsed stack, not terminated (nullptr if unused)
+    REBSIZ size;
+    uint32_t hash;
+    REBI64 evals;
+};
+
+static ISOLATE_LOCAL struct Reb_Profile_Entry *profile_table;  // open address
+static ISOLATE_LOCAL REBLEN profile_table_size;  // power of 2, or 0 if none
+static ISOLATE_LOCAL REBLEN profile_entries;
+static ISOLATE_LOCAL REBI64 profile_lost;  // evaluations not tallied (memory)
+
+static ISOLATE_LOCAL uint_fast32_t profile_saved_dose;  // before PROFILER 'ON
+static ISOLATE_LOCAL time_t profile_deadline;  // end of PROFILER/FOR, or 0
+
+
+static void Free_Profile_Table(void)
+{
+    REBLEN n;
+    for (n = 0; n != profile_table_size; ++n) {
+        struct Reb_Profile_Entry *e = &profile_table[n];
+        if (e->stack)
+            FREE_N(REBYTE, e->size, e->stack);
+    }
+    if (profile_table_size != 0)
+        FREE_N(struct Reb_Profile_Entry, profile_table_size, profile_table);
+
+    profile_table = nullptr;
+    profile_table_size = 0;
+    profile_entries = 0;
+    profile_lost = 0;
+}
+
+
+// Make the table twice as big (or make the first one), rehashing entries.
+//
+static bool Did_Grow_Profile_Table(void)
+{
+    REBLEN new_size = profile_table_size == 0 ? 256 : profile_table_size * 2;
+    struct Reb_Profile_Entry *table = TRY_ALLOC_N(
+        struct Reb_Profile_Entry,
+        new_size
+    );
+    if (table == nullptr)
+        return false;
+    memset(table, 0, sizeof(struct Reb_Profile_Entry) * new_size);
+
+    REBLEN n;
+    for (n = 0; n != profile_table_size; ++n) {
+        struct Reb_Profile_Entry *e = &profile_table[n];
+        if (not e->stack)
+            continue;
+        REBLEN slot = e->hash & (new_size - 1);
+        while (table[slot].stack)
+            slot = (slot + 1) & (new_size - 1);
+        table[slot] = *e;
+    }
+
+    if (profile_table_size != 0)
+        FREE_N(struct Reb_Profile_Entry, profile_table_size, profile_table);
+    profile_table = table;
+    profile_table_size = new_size;
+    return true;
+}
+
+
+static void Tally_Profile_Sample(const REBYTE *stack, REBSIZ size, REBI64 n)
+{
+    if (
+        (profile_entries + 1) * 2 > profile_table_size
+        and not Did_Grow_Profile_Table()
+    ){
+        profile_lost += n;
+        return;
+    }
+
+    uint32_t hash = cast(uint32_t, Hash_Bytes(stack, size));
+    REBLEN slot = hash & (profile_table_size - 1);
+    struct Reb_Profile_Entry *e;
+    for (; (e = &profile_table[slot])->stack; ) {
+        if (
+            e->hash == hash
+            and e->size == size
+            and memcmp(e->stack, stack, size) == 0
+        ){
+            e->evals += n;
+            return;
+        }
+        slot = (slot + 1) & (profile_table_size - 1);
+    }
+
+    REBYTE *copy = TRY_ALLOC_N(REBYTE, size);
+    if (copy == nullptr) {
+        profile_lost += n;
+        return;
+    }
+    memcpy(copy, stack, size);
+
+    e->stack = copy;
+    e->size = size;
+    e->hash = hash;
+    e->evals = n;
+    ++profile_entries;
+}
+
+
+static void Append_Profile_Bytes(
+    REBYTE *buf,
+    REBSIZ *size,
+    const char *utf8
+){
+    for (; *utf8 != '\0' and *size != PROFILE_STACK_MAX; ++utf8)
+        buf[(*size)++] = *utf8;
+}
+
+
+static void Stop_Profiling(void)
+{
+    Eval_Cycles += Eval_Dose - Eval_Count;
+    Eval_Dose = profile_saved_dose;
+    Eval_Count = Eval_Dose;
+    TG_Profiling = false;
+}
+
+
+//
+//  Sample_Frame_Stack: C
+//
+// Called by Do_Signals_Throws() while TG_Profiling, with the number of
+// evaluations since the last call.
+//
+void Sample_Frame_Stack(REBI64 evals)
+{
+    if (profile_deadline != 0 and time(nullptr) >= profile_deadline) {
+        Stop_Profiling();
+        return;
+    }
+
+    REBFRM *frames[PROFILE_DEPTH_MAX];
+    REBLEN depth = 0;
+    bool truncated = false;
+
+    REBFRM *f = FS_TOP;
+    for (; f != FS_BOTTOM; f = f->prior) {
+        if (not Is_Action_Frame(f) or Is_Action_Frame_Fulfilling(f))
+            continue;  // fulfilling frames aren't running yet
+        if (depth == PROFILE_DEPTH_MAX) {
+            truncated = true;
+            break;
+        }
+        frames[depth++] = f;
+    }
+
+    REBYTE buf[PROFILE_STACK_MAX];
+    REBSIZ size = 0;
+
+    if (truncated)
+        Append_Profile_Bytes(buf, &size, "...");
+    else if (depth == 0)
+        Append_Profile_Bytes(buf, &size, "[top]");
+
+    while (depth != 0) {
+        f = frames[--depth];
+        if (size != 0)
+            Append_Profile_Bytes(buf, &size, ";");
+        Append_Profile_Bytes(buf, &size, Frame_Label_Or_Anonymous_UTF8(f));
+
+        const REBSTR *file = FRM_FILE(f);
+        if (file) {
+            Append_Profile_Bytes(buf, &size, " %");
+            Append_Profile_Bytes(buf, &size, STR_UTF8(file));
+            Append_Profile_Bytes(buf, &size, ":");
+
+            char digits[MAX_INT_LEN];  // written backwards
+            int d = 0;
+            int line = FRM_LINE(f);
+            do {
+                digits[d++] = '0' + line % 10;
+                line /= 10;
+            } while (line != 0 and d != MAX_INT_LEN);
+            while (d != 0 and size != PROFILE_STACK_MAX)
+                buf[size++] = digits[--d];
+        }
+    }
+
+    Tally_Profile_Sample(buf, size, evals);
+}
+
+
+//=//// CALL PROFILING (PROFILER/CALLS) ///////////////////////////////////=//
+//
+// Sampling says where evaluations go, but not what each function costs per
+// call.  PROFILER/CALLS 'ON has Process_Action_Maybe_Stale_Throws() call
+// Profile_Action_Begin() before each dispatch, and Drop_Action() then calls
+// Profile_Action_End().  Drop_Action() is also run on frames that fail()
+// unwinds, so calls which don't return normally are still counted.  When
+// the mode is off, the only cost is the test of TG_Call_Profiling.
+//
+// Calls are tallied per action and label, so that `append` and a `my-append`
+// which is the same action are reported separately.  The action and label
+// pointers are only compared and never dereferenced, as the GC may free them
+// while the tallies are kept...the name is copied at the first call.
+//
+// Each running call is on a stack of Reb_Call_Timing, whose time and bytes
+// are added to its caller's `callee_xxx` when it finishes.  So "exclusive"
+// time and allocation leave out what the functions it called took.  The
+// "inclusive" time only counts the outermost of recursive calls, so that a
+// recursion isn't counted once for each level.
+//
+
+struct Reb_Call_Tally {
+    struct Reb_Call_Tally *next;  // in hash chain
+    const REBACT *action;  // only compared (may have been GC'd)
+    const REBSYM *label;  // only compared (may have been GC'd)
+    REBYTE *name;  // copy of label made at first call, not terminated
+    REBSIZ name_size;
+    REBI64 calls;
+    REBI64 inclusive;  // nanoseconds
+    REBI64 exclusive;  // nanoseconds
+    REBI64 allocated;  // bytes, not counting allocations by callees
+    REBLEN running;  // calls on the timing stack (for recursion)
+};
+
+struct Reb_Call_Timing {
+    REBFRM *frame;
+    struct Reb_Call_Tally *tally;
+    REBI64 start;  // nanoseconds
+    REBI64 start_bytes;  // GC_Bytes_Allocated
+    REBI64 callee_time;
+    REBI64 callee_bytes;
+};
+
+static ISOLATE_LOCAL struct Reb_Call_Tally **call_table;  // chained buckets
+static ISOLATE_LOCAL REBLEN call_table_size;  // power of 2, or 0 if none
+static ISOLATE_LOCAL REBLEN call_tallies;
+static ISOLATE_LOCAL REBI64 calls_lost;  // calls not tallied (memory)
+
+static ISOLATE_LOCAL struct Reb_Call_Timing *call_stack;
+static ISOLATE_LOCAL REBLEN call_stack_size;
+static ISOLATE_LOCAL REBLEN call_depth;
+
+static ISOLATE_LOCAL bool call_tallying;  // PROFILER/CALLS (vs. just /PERF)
+
+
+static void Free_Call_Tallies(void)
+{
+    REBLEN n;
+    for (n = 0; n != call_table_size; ++n) {
+        struct Reb_Call_Tally *t = call_table[n];
+        while (t) {
+            struct Reb_Call_Tally *next = t->next;
+            FREE_N(REBYTE, t->name_size, t->name);
+            FREE(struct Reb_Call_Tally, t);
+            t = next;
+        }
+    }
+    if (call_table_size != 0)
+        FREE_N(struct Reb_Call_Tally*, call_table_size, call_table);
+
+    call_table = nullptr;
+    call_table_size = 0;
+    call_tallies = 0;
+    calls_lost = 0;
+}
+
+
+static void Free_Call_Stack(void)
+{
+    if (call_stack_size != 0)
+        FREE_N(struct Reb_Call_Timing, call_stack_size, call_stack);
+
+    call_stack = nullptr;
+    call_stack_size = 0;
+    call_depth = 0;
+}
+
+
+// Calls that are running when PROFILER/CALLS is turned off or on again stay
+// on the timing stack if PROFILER/PERF is logging, but stop being tallied.
+//
+static void Detach_Call_Tallies(void)
+{
+    REBLEN n;
+    for (n = 0; n != call_depth; ++n)
+        call_stack[n].tally = nullptr;
+}
+
+
+inline static REBLEN Call_Tally_Slot(
+    const REBACT *action,
+    const REBSYM *label,
+    REBLEN table_size
+){
+    uintptr_t hash = cast(uintptr_t, action) ^ (cast(uintptr_t, label) >> 3);
+    hash ^= hash >> 7;
+    return cast(REBLEN, hash >> 4) & (table_size - 1);
+}
+
+
+// Make the table twice as big (or make the first one), moving the tallies
+// into their new chains.  They aren't copied, so timings can point at them.
+//
+static bool Did_Grow_Call_Table(void)
+{
+    REBLEN new_size = call_table_size == 0 ? 256 : call_table_size * 2;
+    struct Reb_Call_Tally **table = TRY_ALLOC_N(
+        struct Reb_Call_Tally*,
+        new_size
+    );
+    if (table == nullptr)
+        return false;
+    memset(table, 0, sizeof(struct Reb_Call_Tally*) * new_size);
+
+    REBLEN n;
+    for (n = 0; n != call_table_size; ++n) {
+        struct Reb_Call_Tally *t = call_table[n];
+        while (t) {
+            struct Reb_Call_Tally *next = t->next;
+            REBLEN slot = Call_Tally_Slot(t->action, t->label, new_size);
+            t->next = table[slot];
+            table[slot] = t;
+            t = next;
+        }
+    }
+
+    if (call_table_size != 0)
+        FREE_N(struct Reb_Call_Tally*, call_table_size, call_table);
+    call_table = table;
+    call_table_size = new_size;
+    return true;
+}
+
+
+static struct Reb_Call_Tally *Find_Call_Tally(REBFRM *f)
+{
+    const REBACT *action = f->original;
+    const REBSYM *label = try_unwrap(f->label);
+
+    if (call_table_size != 0) {
+        REBLEN slot = Call_Tally_Slot(action, label, call_table_size);
+        struct Reb_Call_Tally *t = call_table[slot];
+        for (; t; t = t->next) {
+            if (t->action == action and t->label == label)
+                return t;
+        }
+    }
+
+    if (call_tallies >= call_table_size and not Did_Grow_Call_Table())
+        return nullptr;
+
+    struct Reb_Call_Tally *t = TRY_ALLOC(struct Reb_Call_Tally);
+    if (t == nullptr)
+        return nullptr;
+
+    const char *name = Frame_Label_Or_Anonymous_UTF8(f);
+    t->name_size = strsize(name);
+    t->name = TRY_ALLOC_N(REBYTE, t->name_size);
+    if (t->name == nullptr) {
+        FREE(struct Reb_Call_Tally, t);
+        return nullptr;
+    }
+    memcpy(t->name, name, t->name_size);
+
+    t->action = action;
+    t->label = label;
+    t->calls = 0;
+    t->inclusive = 0;
+    t->exclusive = 0;
+    t->allocated = 0;
+    t->running = 0;
+
+    REBLEN slot = Call_Tally_Slot(action, label, call_table_size);
+    t->next = call_table[slot];
+    call_table[slot] = t;
+    ++call_tallies;
+    return t;
+}
+
+
+//=//// PERF LOG (PROFILER/PERF) //////////////////////////////////////////=//
+//
+// Native profilers like `perf` see every Rebol function as the same few C
+// functions (the evaluator, and dispatchers like Func_Dispatcher()).  So
+// PROFILER/PERF 'ON rides on the timing stack of PROFILER/CALLS to log each
+// action's start and end, with the wall clock time in nanoseconds:
+//
+//     + 1634567890123456789 parse-item %work.r:3
+//     - 1634567890123499999
+//
+// The start gives the label and where the action was called from (if known).
+// PROFILER/PERF 'OFF gives the log back as TEXT!, and %scripts/perf-stacks.reb
+// replays it against `perf script` output to put the Rebol functions that
+// were running into the sampled stacks.  The clock is the same one perf
+// uses with `perf record -k realtime`.
+//
+// Since the log is kept in memory until 'OFF, this is for tracing a run of
+// seconds to minutes, not leaving on in production.  If memory runs out,
+// the events that could not be logged are counted on a last `! <n>` line.
+//
+
+static ISOLATE_LOCAL bool perf_logging;
+static ISOLATE_LOCAL REBYTE *perf_log;
+static ISOLATE_LOCAL REBSIZ perf_log_used;
+static ISOLATE_LOCAL REBSIZ perf_log_size;
+static ISOLATE_LOCAL REBI64 perf_log_lost;  // events not logged (memory)
+
+#define PERF_LOG_EVENT_MAX (PROFILE_STACK_MAX + (MAX_INT_LEN * 2) + 8)
+
+
+static void Free_Perf_Log(void)
+{
+    if (perf_log_size != 0)
+        FREE_N(REBYTE, perf_log_size, perf_log);
+
+    perf_log = nullptr;
+    perf_log_used = 0;
+    perf_log_size = 0;
+    perf_log_lost = 0;
+}
+
+
+// Get room for an event of up to PERF_LOG_EVENT_MAX bytes, or nullptr.
+//
+static REBYTE *Try_Reserve_Perf_Log(void)
+{
+    if (perf_log_size - perf_log_used >= PERF_LOG_EVENT_MAX)
+        return perf_log + perf_log_used;
+
+    REBSIZ new_size = perf_log_size == 0 ? 65536 : perf_log_size * 2;
+    REBYTE *log = TRY_ALLOC_N(REBYTE, new_size);
+    if (log == nullptr) {
+        ++perf_log_lost;
+        return nullptr;
+    }
+    if (perf_log_size != 0) {
+        memcpy(log, perf_log, perf_log_used);
+        FREE_N(REBYTE, perf_log_size, perf_log);
+    }
+    perf_log = log;
+    perf_log_size = new_size;
+    return perf_log + perf_log_used;
+}
+
+
+static void Log_Perf_Push(REBFRM *f)
+{
+    REBYTE *bp = Try_Reserve_Perf_Log();
+    if (bp == nullptr)
+        return;
+
+    REBSIZ size = 0;
+    bp[size++] = '+';
+    bp[size++] = ' ';
+    size += Form_Int_Len(
+        bp + size,
+        Startup_Clock_Nanoseconds(),
+        MAX_INT_LEN
+    );
+    bp[size++] = ' ';
+
+    // Label and file share the PROFILE_STACK_MAX room that was reserved.
+    //
+    REBSIZ limit = size + PROFILE_STACK_MAX;
+    const char *cp = Frame_Label_Or_Anonymous_UTF8(f);
+    for (; *cp != '\0' and size != limit; ++cp)
+        bp[size++] = *cp;
+
+    const REBSTR *file = FRM_FILE(f);
+    if (file) {
+        if (size != limit)
+            bp[size++] = ' ';
+        if (size != limit)
+            bp[size++] = '%';
+        for (cp = STR_UTF8(file); *cp != '\0' and size != limit; ++cp)
+            bp[size++] = *cp;
+        bp[size++] = ':';
+        size += Form_Int_Len(bp + size, FRM_LINE(f), MAX_INT_LEN);
+    }
+    bp[size++] = '\n';
+
+    perf_log_used += size;
+}
+
+
+static void Log_Perf_Pop(REBI64 nanoseconds)
+{
+    REBYTE *bp = Try_Reserve_Perf_Log();
+    if (bp == nullptr)
+        return;
+
+    REBSIZ size = 0;
+    bp[size++] = '-';
+    bp[size++] = ' ';
+    size += Form_Int_Len(bp + size, nanoseconds, MAX_INT_LEN);
+    bp[size++] = '\n';
+
+    perf_log_used += size;
+}
+
+
+//
+//  Profile_Action_Begin: C
+//
+// Called while TG_Call_Profiling, right before an action's dispatcher runs.
+//
+void Profile_Action_Begin(REBFRM *f)
+{
+    if (call_depth != 0 and call_stack[call_depth - 1].frame == f)
+        return;  // REDO of a call already being timed
+
+    if (call_depth == call_stack_size) {
+        REBLEN new_size = call_stack_size == 0 ? 64 : call_stack_size * 2;
+        struct Reb_Call_Timing *stack = TRY_ALLOC_N(
+            struct Reb_Call_Timing,
+            new_size
+        );
+        if (stack == nullptr) {
+            ++calls_lost;
+            return;
+        }
+        if (call_stack_size != 0) {
+            memcpy(stack, call_stack, sizeof(*stack) * call_depth);
+            FREE_N(struct Reb_Call_Timing, call_stack_size, call_stack);
+        }
+        call_stack = stack;
+        call_stack_size = new_size;
+    }
+
+    struct Reb_Call_Tally *tally = nullptr;
+    if (call_tallying) {
+        tally = Find_Call_Tally(f);
+        if (tally == nullptr) {
+            ++calls_lost;
+            return;
+        }
+        ++tally->calls;
+        ++tally->running;
+    }
+
+    if (perf_logging)
+        Log_Perf_Push(f);
+
+    struct Reb_Call_Timing *timing = &call_stack[call_depth++];
+    timing->frame = f;
+    timing->tally = tally;
+    timing->callee_time = 0;
+    timing->callee_bytes = 0;
+    timing->start_bytes = GC_Bytes_Allocated;
+    timing->start = Startup_Clock_Nanoseconds();  // last, to not time above
+}
+
+
+//
+//  Profile_Action_End: C
+//
+// Called by Drop_Action() while TG_Call_Profiling.  Frames that were still
+// fulfilling arguments (or started before PROFILER/CALLS or PROFILER/PERF
+// was turned on) aren't on the timing stack, so are ignored.
+//
+void Profile_Action_End(REBFRM *f)
+{
+    REBI64 now = Startup_Clock_Nanoseconds();
+
+    REBLEN depth = call_depth;
+    while (depth != 0 and call_stack[depth - 1].frame != f)
+        --depth;
+    if (depth == 0)
+        return;
+
+    // Timings above f's are for frames dropped without Drop_Action()...they
+    // should not exist, but finishing them here keeps the stack consistent.
+    //
+    while (call_depth != depth - 1) {
+        struct Reb_Call_Timing *timing = &call_stack[--call_depth];
+        struct Reb_Call_Tally *tally = timing->tally;
+
+        REBI64 time = now - timing->start;
+        REBI64 bytes = GC_Bytes_Allocated - timing->start_bytes;
+
+        if (tally) {  // null if only /PERF was on when the call started
+            if (--tally->running == 0)
+                tally->inclusive += time;
+            tally->exclusive += time - timing->callee_time;
+            tally->allocated += bytes - timing->callee_bytes;
+        }
+
+        if (perf_logging)
+            Log_Perf_Pop(now);
+
+        if (call_depth != 0) {
+            call_stack[call_depth - 1].callee_time += time;
+            call_stack[call_depth - 1].callee_bytes += bytes;
+        }
+    }
+}
+
+
+// Callback for reb_qsort_r(), putting tallies in descending order of the
+// REBI64 field whose offset is passed as the thunk (ties go by name).
+//
+static int Compare_Call_Tallies(void *thunk, const void *v1, const void *v2)
+{
+    size_t offset = *cast(size_t*, thunk);
+    const struct Reb_Call_Tally *t1 = *cast(struct Reb_Call_Tally* const*, v1);
+    const struct Reb_Call_Tally *t2 = *cast(struct Reb_Call_Tally* const*, v2);
+
+    REBI64 n1 = *cast(const REBI64*, cast(const REBYTE*, t1) + offset);
+    REBI64 n2 = *cast(const REBI64*, cast(const REBYTE*, t2) + offset);
+    if (n1 != n2)
+        return n1 > n2 ? -1 : 1;
+
+    int diff = memcmp(
+        t1->name,
+        t2->name,
+        MIN(t1->name_size, t2->name_size)
+    );
+    if (diff != 0)
+        return diff;
+    return cast(int, t1->name_size) - cast(int, t2->name_size);
+}
+
+
+//
+//  Init_Call_Profile: C
+//
+// Make the block of objects given back by STATS/PROFILE, one per tally,
+// sorted by `column` (CALLS, INCLUSIVE, EXCLUSIVE, or ALLOCATED).  If any
+// calls could not be tallied for lack of memory, a final object is named
+// [lost] and has only their count.
+//
+REBVAL *Init_Call_Profile(RELVAL *out, const REBVAL *column)
+{
+    size_t offset;
+    switch (VAL_WORD_ID(column)) {
+      case SYM_CALLS:
+        offset = offsetof(struct Reb_Call_Tally, calls);
+        break;
+      case SYM_INCLUSIVE:
+        offset = offsetof(struct Reb_Call_Tally, inclusive);
+        break;
+      case SYM_EXCLUSIVE:
+        offset = offsetof(struct Reb_Call_Tally, exclusive);
+        break;
+      case SYM_ALLOCATED:
+        offset = offsetof(struct Reb_Call_Tally, allocated);
+        break;
+      default:
+        fail (column);
+    }
+
+    REBDSP dsp_orig = DSP;
+
+    // Making the objects runs MAKE, which gets tallied if PROFILER/CALLS is
+    // still on...so a new tally may be added while this runs.
+    //
+    REBLEN count = call_tallies;
+
+    struct Reb_Call_Tally **sorted = nullptr;
+    if (count != 0) {
+        sorted = TRY_ALLOC_N(struct Reb_Call_Tally*, count);
+        if (sorted == nullptr)
+            fail (Error_No_Memory(sizeof(REBVAL*) * count));
+
+        REBLEN i = 0;
+        REBLEN n;
+        for (n = 0; n != call_table_size; ++n) {
+            struct Reb_Call_Tally *t = call_table[n];
+            for (; t; t = t->next)
+                sorted[i++] = t;
+        }
+        assert(i == count);
+
+        reb_qsort_r(
+            sorted,
+            count,
+            sizeof(struct Reb_Call_Tally*),
+            &offset,
+            &Compare_Call_Tallies
+        );
+    }
+
+    REBLEN i;
+    for (i = 0; i != count; ++i) {
+        struct Reb_Call_Tally *t = sorted[i];
+
+        DECLARE_LOCAL (inclusive);
+        Init_Time_Nanoseconds(inclusive, t->inclusive);
+        DECLARE_LOCAL (exclusive);
+        Init_Time_Nanoseconds(exclusive, t->exclusive);
+
+        REBVAL *name = rebSizedText(cs_cast(t->name), t->name_size);
+        REBVAL *tally = rebValue("make object! [",
+            "name:", name,
+            "calls:", rebI(t->calls),
+            "inclusive:", inclusive,
+            "exclusive:", exclusive,
+            "allocated:", rebI(t->allocated),
+        "]");
+        Copy_Cell(DS_PUSH(), tally);
+        rebRelease(tally);
+        rebRelease(name);
+    }
+
+    if (sorted)
+        FREE_N(struct Reb_Call_Tally*, count, sorted);
+
+    if (calls_lost != 0) {
+        REBVAL *lost = rebValue("make object! [",
+            "name: {[lost]}",
+            "calls:", rebI(calls_lost),
+        "]");
+        Copy_Cell(DS_PUSH(), lost);
+        rebRelease(lost);
+    }
+
+    return Init_Block(out, Pop_Stack_Values(dsp_orig));
+}
+
+
+//=//// ALLOCATION SAMPLING (PROFILER/MEMORY) /////////////////////////////=//
+//
+// STATS can say that memory is growing, but not which code is allocating it.
+// PROFILER/MEMORY 'ON has Make_Series() and Alloc_Pairing() take the size of
+// each allocation off of TG_Alloc_Sample_Countdown, and when that goes below
+// zero they call Sample_Allocation().  This records the running function
+// and where it was called from as the allocation "site".  When off, the
+// countdown is INT64_MAX, so the cost is a subtraction and a test.
+//
+// Each sample stands for the bytes counted down since the last one, so
+// sites are credited in proportion to what they allocate, no matter if it
+// is done in a few big series or many small ones.  The distance between
+// samples is jittered around the /EVERY amount, to not fall into step with
+// a loop that allocates the same sizes over and over.
+//
+// The sampled nodes are kept in a table, and GC_Kill_Series() (or the frees
+// of pairings) call Forget_Allocation_Sample() while TG_Alloc_Samples_Live.
+// So a site's "live" bytes are those of its samples which haven't been
+// freed.  STATS/ALLOCATIONS runs a collection first, so that means what
+// survived it.  Like the call tallies, the site's label and file are only
+// compared as pointers, and a name is copied when the site is first seen.
+//
+
+#define ALLOC_SAMPLE_EVERY_DEFAULT (512 * 1024)  // bytes
+
+struct Reb_Alloc_Site {
+    struct Reb_Alloc_Site *next;  // in hash chain
+    const REBSYM *label;  // only compared (may have been GC'd)
+    const REBSTR *file;  // only compared (may have been GC'd)
+    int line;
+    REBYTE *name;  // "label %file:line", not terminated
+    REBSIZ name_size;
+    REBI64 samples;
+    REBI64 allocated;  // estimated bytes
+    REBI64 live;  // estimated bytes of samples not freed yet
+};
+
+struct Reb_Alloc_Sample {
+    const void *node;  // nullptr if slot is empty
+    struct Reb_Alloc_Site *site;
+    REBI64 weight;  // bytes the sample stands for
+};
+
+static ISOLATE_LOCAL struct Reb_Alloc_Site **site_table;  // chained buckets
+static ISOLATE_LOCAL REBLEN site_table_size;  // power of 2, or 0 if none
+static ISOLATE_LOCAL REBLEN alloc_sites;
+
+static ISOLATE_LOCAL struct Reb_Alloc_Sample *sample_table;  // open address
+static ISOLATE_LOCAL REBLEN sample_table_size;  // power of 2, or 0 if none
+static ISOLATE_LOCAL REBLEN alloc_samples;
+
+static ISOLATE_LOCAL bool alloc_sampling;  // PROFILER/MEMORY is on
+static ISOLATE_LOCAL REBI64 alloc_sample_every;
+static ISOLATE_LOCAL REBI64 alloc_bytes_lost;  // sampled bytes not tallied
+static ISOLATE_LOCAL uint32_t alloc_jitter = 2463534242;  // xorshift state
+
+
+static void Free_Alloc_Sites(void)
+{
+    if (sample_table_size != 0)
+        FREE_N(struct Reb_Alloc_Sample, sample_table_size, sample_table);
+    sample_table = nullptr;
+    sample_table_size = 0;
+    alloc_samples = 0;
+    TG_Alloc_Samples_Live = false;
+
+    REBLEN n;
+    for (n = 0; n != site_table_size; ++n) {
+        struct Reb_Alloc_Site *site = site_table[n];
+        while (site) {
+            struct Reb_Alloc_Site *next = site->next;
+            FREE_N(REBYTE, site->name_size, site->name);
+            FREE(struct Reb_Alloc_Site, site);
+            site = next;
+        }
+    }
+    if (site_table_size != 0)
+        FREE_N(struct Reb_Alloc_Site*, site_table_size, site_table);
+    site_table = nullptr;
+    site_table_size = 0;
+    alloc_sites = 0;
+    alloc_bytes_lost = 0;
+}
+
+
+// Bytes to the next sample, uniformly spread from half to one and a half
+// times alloc_sample_every.
+//
+static REBI64 Next_Alloc_Sample_Gap(void)
+{
+    alloc_jitter ^= alloc_jitter << 13;
+    alloc_jitter ^= alloc_jitter >> 17;
+    alloc_jitter ^= alloc_jitter << 5;
+    return alloc_sample_every / 2
+        + cast(REBI64, alloc_jitter % cast(REBU64, alloc_sample_every))
+        + 1;
+}
+
+
+inline static REBLEN Alloc_Site_Slot(
+    const REBSYM *label,
+    const REBSTR *file,
+    int line,
+    REBLEN table_size
+){
+    uintptr_t hash = cast(uintptr_t, label) ^ (cast(uintptr_t, file) >> 3);
+    hash ^= (hash >> 7) ^ cast(uintptr_t, line) * 2654435761u;
+    return cast(REBLEN, hash >> 4) & (table_size - 1);
+}
+
+inline static REBLEN Alloc_Sample_Slot(const void *node, REBLEN table_size) {
+    uintptr_t hash = (cast(uintptr_t, node) >> 4) * 2654435761u;
+    return cast(REBLEN, hash ^ (hash >> 16)) & (table_size - 1);
+}
+
+
+static bool Did_Grow_Site_Table(void)
+{
+    REBLEN new_size = site_table_size == 0 ? 256 : site_table_size * 2;
+    struct Reb_Alloc_Site **table = TRY_ALLOC_N(
+        struct Reb_Alloc_Site*,
+        new_size
+    );
+    if (table == nullptr)
+        return false;
+    memset(table, 0, sizeof(struct Reb_Alloc_Site*) * new_size);
+
+    REBLEN n;
+    for (n = 0; n != site_table_size; ++n) {
+        struct Reb_Alloc_Site *site = site_table[n];
+        while (site) {
+            struct Reb_Alloc_Site *next = site->next;
+            REBLEN slot = Alloc_Site_Slot(
+                site->label, site->file, site->line, new_size
+            );
+            site->next = table[slot];
+            table[slot] = site;
+            site = next;
+        }
+    }
+
+    if (site_table_size != 0)
+        FREE_N(struct Reb_Alloc_Site*, site_table_size, site_table);
+    site_table = table;
+    site_table_size = new_size;
+    return true;
+}
+
+
+// Samples stay at their slot until freed, so they aren't pointed to by
+// anything but the table, and can be moved.
+//
+static bool Did_Grow_Sample_Table(void)
+{
+    REBLEN new_size = sample_table_size == 0 ? 1024 : sample_table_size * 2;
+    struct Reb_Alloc_Sample *table = TRY_ALLOC_N(
+        struct Reb_Alloc_Sample,
+        new_size
+    );
+    if (table == nullptr)
+        return false;
+    memset(table, 0, sizeof(struct Reb_Alloc_Sample) * new_size);
+
+    REBLEN n;
+    for (n = 0; n != sample_table_size; ++n) {
+        struct Reb_Alloc_Sample *sample = &sample_table[n];
+        if (sample->node == nullptr)
+            continue;
+        REBLEN slot = Alloc_Sample_Slot(sample->node, new_size);
+        while (table[slot].node)
+            slot = (slot + 1) & (new_size - 1);
+        table[slot] = *sample;
+    }
+
+    if (sample_table_size != 0)
+        FREE_N(struct Reb_Alloc_Sample, sample_table_size, sample_table);
+    sample_table = table;
+    sample_table_size = new_size;
+    return true;
+}
+
+
+// The site is the innermost running action, with where it was called from.
+// Allocations made outside of any action are all put under "[top]".
+//
+static struct Reb_Alloc_Site *Find_Alloc_Site(void)
+{
+    REBFRM *f = FS_TOP;
+    for (; f != FS_BOTTOM; f = f->prior) {
+        if (Is_Action_Frame(f) and not Is_Action_Frame_Fulfilling(f))
+            break;
+    }
+
+    const REBSYM *label = nullptr;
+    const REBSTR *file = nullptr;
+    int line = 0;
+    const char *utf8 = "[top]";
+    if (f != FS_BOTTOM) {
+        label = try_unwrap(f->label);
+        file = FRM_FILE(f);
+        line = file ? FRM_LINE(f) : 0;
+        utf8 = Frame_Label_Or_Anonymous_UTF8(f);
+    }
+
+    if (site_table_size != 0) {
+        REBLEN slot = Alloc_Site_Slot(label, file, line, site_table_size);
+        struct Reb_Alloc_Site *site = site_table[slot];
+        for (; site; site = site->next) {
+            if (
+                site->label == label
+                and site->file == file
+                and site->line == line
+            ){
+                return site;
+            }
+        }
+    }
+
+    if (alloc_sites >= site_table_size and not Did_Grow_Site_Table())
+        return nullptr;
+
+    REBYTE buf[PROFILE_STACK_MAX];
+    REBSIZ size = 0;
+    Append_Profile_Bytes(buf, &size, utf8);
+    if (file) {
+        Append_Profile_Bytes(buf, &size, " %");
+        Append_Profile_Bytes(buf, &size, STR_UTF8(file));
+        Append_Profile_Bytes(buf, &size, ":");
+
+        REBYTE digits[MAX_INT_LEN + 1];
+        Form_Int_Len(digits, line, MAX_INT_LEN);
+        Append_Profile_Bytes(buf, &size, cs_cast(digits));
+    }
+
+    struct Reb_Alloc_Site *site = TRY_ALLOC(struct Reb_Alloc_Site);
+    if (site == nullptr)
+        return nullptr;
+    site->name = TRY_ALLOC_N(REBYTE, size);
+    if (site->name == nullptr) {
+        FREE(struct Reb_Alloc_Site, site);
+        return nullptr;
+    }
+    memcpy(site->name, buf, size);
+    site->name_size = size;
+
+    site->label = label;
+    site->file = file;
+    site->line = line;
+    site->samples = 0;
+    site->allocated = 0;
+    site->live = 0;
+
+    REBLEN slot = Alloc_Site_Slot(label, file, line, site_table_size);
+    site->next = site_table[slot];
+    site_table[slot] = site;
+    ++alloc_sites;
+    return site;
+}
+
+
+//
+//  Sample_Allocation: C
+//
+// Called when TG_Alloc_Sample_Countdown goes below zero, after the series or
+// pairing `node` of `size` bytes was allocated (but before it is filled in,
+// so it can't be looked at).  No series may be made here.
+//
+void Sample_Allocation(const void *node, REBSIZ size)
+{
+    UNUSED(size);  // already counted down
+
+    if (not alloc_sampling) {  // e.g. allocations before Startup_Profiler()
+        TG_Alloc_Sample_Countdown = INT64_MAX;
+        return;
+    }
+
+    REBI64 weight = 0;
+    do {
+        REBI64 gap = Next_Alloc_Sample_Gap();
+        TG_Alloc_Sample_Countdown += gap;
+        weight += gap;
+    } while (TG_Alloc_Sample_Countdown < 0);
+
+    struct Reb_Alloc_Site *site = Find_Alloc_Site();
+    if (
+        site == nullptr
+        or (
+            (alloc_samples + 1) * 2 > sample_table_size
+            and not Did_Grow_Sample_Table()
+        )
+    ){
+        alloc_bytes_lost += weight;
+        return;
+    }
+
+    ++site->samples;
+    site->allocated += weight;
+    site->live += weight;
+
+    REBLEN slot = Alloc_Sample_Slot(node, sample_table_size);
+    while (sample_table[slot].node)
+        slot = (slot + 1) & (sample_table_size - 1);
+    sample_table[slot].node = node;
+    sample_table[slot].site = site;
+    sample_table[slot].weight = weight;
+    ++alloc_samples;
+
+    TG_Alloc_Samples_Live = true;
+}
+
+
+//
+//  Forget_Allocation_Sample: C
+//
+// Called while TG_Alloc_Samples_Live when a series or pairing is freed, in
+// case it was sampled.  Removal shifts later entries of the probe sequence
+// back, so no "deleted" markers are needed.
+//
+void Forget_Allocation_Sample(const void *node)
+{
+    REBLEN mask = sample_table_size - 1;
+    REBLEN slot = Alloc_Sample_Slot(node, sample_table_size);
+    for (; sample_table[slot].node != node; slot = (slot + 1) & mask) {
+        if (sample_table[slot].node == nullptr)
+            return;  // not sampled
+    }
+
+    sample_table[slot].site->live -= sample_table[slot].weight;
+    --alloc_samples;
+
+    REBLEN hole = slot;
+    while (true) {
+        slot = (slot + 1) & mask;
+        const void *moving = sample_table[slot].node;
+        if (moving == nullptr)
+            break;
+
+        // Move it back if its home slot isn't cyclically in (hole, slot]
+        //
+        REBLEN home = Alloc_Sample_Slot(moving, sample_table_size);
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            sample_table[hole] = sample_table[slot];
+            hole = slot;
+        }
+    }
+    sample_table[hole].node = nullptr;
+}
+
+
+static int Compare_Alloc_Sites(void *thunk, const void *v1, const void *v2)
+{
+    size_t offset = *cast(size_t*, thunk);
+    const struct Reb_Alloc_Site *s1 = *cast(struct Reb_Alloc_Site* const*, v1);
+    const struct Reb_Alloc_Site *s2 = *cast(struct Reb_Alloc_Site* const*, v2);
+
+    REBI64 n1 = *cast(const REBI64*, cast(const REBYTE*, s1) + offset);
+    REBI64 n2 = *cast(const REBI64*, cast(const REBYTE*, s2) + offset);
+    if (n1 != n2)
+        return n1 > n2 ? -1 : 1;
+
+    int diff = memcmp(
+        s1->name,
+        s2->name,
+        MIN(s1->name_size, s2->name_size)
+    );
+    if (diff != 0)
+        return diff;
+    return cast(int, s1->name_size) - cast(int, s2->name_size);
+}
+
+
+//
+//  Init_Allocation_Profile: C
+//
+// Make the block of objects given back by STATS/ALLOCATIONS, one per site,
+// sorted by `column` (ALLOCATED or LIVE).  A collection is run first, so
+// that the live bytes are those that survived it.  If any samples could not
+// be recorded for lack of memory, a final object named [lost] has their
+// bytes.
+//
+REBVAL *Init_Allocation_Profile(RELVAL *out, const REBVAL *column)
+{
+    size_t offset;
+    switch (VAL_WORD_ID(column)) {
+      case SYM_ALLOCATED:
+        offset = offsetof(struct Reb_Alloc_Site, allocated);
+        break;
+      case SYM_LIVE:
+        offset = offsetof(struct Reb_Alloc_Site, live);
+        break;
+      default:
+        fail (column);
+    }
+
+    GC_Trigger = GC_TRIGGER_REQUEST;
+    Recycle();
+    Finish_Lazy_Sweep();
+
+    REBDSP dsp_orig = DSP;
+
+    // Making the objects can allocate, and add sites while this runs
+    //
+    REBLEN count = alloc_sites;
+
+    struct Reb_Alloc_Site **sorted = nullptr;
+    if (count != 0) {
+        sorted = TRY_ALLOC_N(struct Reb_Alloc_Site*, count);
+        if (sorted == nullptr)
+            fail (Error_No_Memory(sizeof(REBVAL*) * count));
+
+        REBLEN i = 0;
+        REBLEN n;
+        for (n = 0; n != site_table_size; ++n) {
+            struct Reb_Alloc_Site *site = site_table[n];
+            for (; site; site = site->next)
+                sorted[i++] = site;
+        }
+        assert(i == count);
+
+        reb_qsort_r(
+            sorted,
+            count,
+            sizeof(struct Reb_Alloc_Site*),
+            &offset,
+            &Compare_Alloc_Sites
+        );
+    }
+
+    REBLEN i;
+    for (i = 0; i != count; ++i) {
+        struct Reb_Alloc_Site *site = sorted[i];
+
+        REBVAL *name = rebSizedText(cs_cast(site->name), site->name_size);
+        REBVAL *tally = rebValue("make object! [",
+            "site:", name,
+            "samples:", rebI(site->samples),
+            "allocated:", rebI(site->allocated),
+            "live:", rebI(site->live),
+        "]");
+        Copy_Cell(DS_PUSH(), tally);
+        rebRelease(tally);
+        rebRelease(name);
+    }
+
+    if (sorted)
+        FREE_N(struct Reb_Alloc_Site*, count, sorted);
+
+    if (alloc_bytes_lost != 0) {
+        REBVAL *lost = rebValue("make object! [",
+            "site: {[lost]}",
+            "allocated:", rebI(alloc_bytes_lost),
+        "]");
+        Copy_Cell(DS_PUSH(), lost);
+        rebRelease(lost);
+    }
+
+    return Init_Block(out, Pop_Stack_Values(dsp_orig));
+}
+
+
+//
+//  profiler: native [
+//
+//  {Sample the running functions, for reading with flame graph tools}
+//
+//      return: "With OFF, the collapsed stack samples (or the /PERF log)"
+//          [<opt> text!]
+//      'instruction "ON (discarding any prior samples) or OFF"
+//          [word!]
+//      /calls "Tally each function's calls and costs instead, see STATS"
+//      /perf "Log calls to match up with `perf` samples (OFF gives the log)"
+//      /memory "Sample allocations by call site instead, see STATS"
+//      /every "Evaluations between samples (default 1000), or bytes if /MEMORY"
+//          [integer!]
+//      /for "Stop sampling on its own after this much (wall clock) time"
+//          [time!]
+//  ]
+//
+REBNATIVE(profiler)
+{
+    INCLUDE_PARAMS_OF_PROFILER;
+
+    if (REF(memory)) {
+        if (REF(for) or REF(calls) or REF(perf))
+            fail (Error_Bad_Refines_Raw());
+
+        switch (VAL_WORD_ID(ARG(instruction))) {
+          case SYM_ON: {
+            REBI64 every = ALLOC_SAMPLE_EVERY_DEFAULT;
+            if (REF(every)) {
+                every = VAL_INT64(ARG(every));
+                if (every <= 0)
+                    fail (PAR(every));
+            }
+
+            Free_Alloc_Sites();
+            alloc_sample_every = every;
+            alloc_sampling = true;
+            TG_Alloc_Sample_Countdown = Next_Alloc_Sample_Gap();
+            break; }
+
+          case SYM_OFF:  // samples kept for STATS/ALLOCATIONS, frees tracked
+            alloc_sampling = false;
+            TG_Alloc_Sample_Countdown = INT64_MAX;
+            break;
+
+          default:
+            fail (PAR(instruction));
+        }
+        return nullptr;
+    }
+
+    if (REF(calls) or REF(perf)) {
+        if (REF(every) or REF(for) or (REF(calls) and REF(perf)))
+            fail (Error_Bad_Refines_Raw());
+
+        bool on;
+        switch (VAL_WORD_ID(ARG(instruction))) {
+          case SYM_ON: on = true; break;
+          case SYM_OFF: on = false; break;
+          default: fail (PAR(instruction));
+        }
+
+        if (REF(calls)) {
+            Detach_Call_Tallies();
+            if (on)
+                Free_Call_Tallies();  // else kept for STATS/PROFILE
+            call_tallying = on;
+        }
+        else if (on) {
+            Free_Perf_Log();
+            perf_logging = true;
+        }
+        else {
+            perf_logging = false;
+
+            DECLARE_MOLD (mo);
+            Push_Mold(mo);
+            if (perf_log_used != 0)
+                Append_Utf8(mo->series, cs_cast(perf_log), perf_log_used);
+            if (perf_log_lost != 0) {
+                Append_Ascii(mo->series, "! ");
+                Append_Int(mo->series, cast(REBINT, perf_log_lost));
+                Append_Codepoint(mo->series, '\n');
+            }
+            Free_Perf_Log();
+            Init_Text(D_OUT, Pop_Molded_String(mo));
+        }
+
+        TG_Call_Profiling = call_tallying or perf_logging;
+        if (not TG_Call_Profiling)
+            Free_Call_Stack();
+
+        if (REF(perf) and not on)
+            return D_OUT;
+        return nullptr;
+    }
+
+    switch (VAL_WORD_ID(ARG(instruction))) {
+      case SYM_ON: {
+        REBLEN every = PROFILE_EVERY_DEFAULT;
+        if (REF(every)) {
+            every = VAL_UINT32(ARG(every));
+            if (every == 0)
+                fail (PAR(every));
+        }
+
+        profile_deadline = 0;
+        if (REF(for)) {
+            REBI64 nano = VAL_NANO(ARG(for));
+            if (nano <= 0)
+                fail (PAR(for));
+            profile_deadline = time(nullptr)
+                + cast(time_t, (nano + SEC_SEC - 1) / SEC_SEC);
+        }
+
+        if (TG_Profiling)
+            Stop_Profiling();
+        Free_Profile_Table();
+
+        Eval_Cycles += Eval_Dose - Eval_Count;
+        profile_saved_dose = Eval_Dose;
+        Eval_Dose = every;
+        Eval_Count = Eval_Dose;
+        TG_Profiling = true;
+        return nullptr; }
+
+      case SYM_OFF: {
+        if (TG_Profiling)
+            Stop_Profiling();
+
+        DECLARE_MOLD (mo);
+        Push_Mold(mo);
+
+        REBLEN n;
+        for (n = 0; n != profile_table_size; ++n) {
+            struct Reb_Profile_Entry *e = &profile_table[n];
+            if (not e->stack)
+                continue;
+            Append_Utf8(mo->series, cs_cast(e->stack), e->size);
+            Append_Codepoint(mo->series, ' ');
+            Append_Int(mo->series, cast(REBINT, e->evals));
+            Append_Codepoint(mo->series, '\n');
+        }
+        if (profile_lost != 0) {
+            Append_Ascii(mo->series, "[lost] ");
+            Append_Int(mo->series, cast(REBINT, profile_lost));
+            Append_Codepoint(mo->series, '\n');
+        }
+
+        Free_Profile_Table();
+        return Init_Text(D_OUT, Pop_Molded_String(mo)); }
+
+      default:
+        fail (PAR(instruction));
+    }
+}
+
+
+//
+//  Shutdown_Profiler: C
+//
+void Shutdown_Profiler(void)
+{
+    if (TG_Profiling)
+        Stop_Profiling();
+    Free_Profile_Table();
+
+    TG_Call_Profiling = false;
+    call_tallying = false;
+    perf_logging = false;
+    Free_Call_Stack();
+    Free_Call_Tallies();
+    Free_Perf_Log();
+
+    alloc_sampling = false;
+    TG_Alloc_Sample_Countdown = INT64_MAX;
+    Free_Alloc_Sites();
+}
@@ -67,11 +67,6 @@
 #endif
 
 
-inline static void Expire_Out_Cell_Unless_Invisible(REBFRM *f) {
-    SET_CELL_FLAG(f->out, OUT_NOTE_STALE);
-}
-
-
 // When arguments are hard quoted or soft-quoted, they don't call into the
 // evaluator to do it.  But they need to use the logic of the evaluator for
 // noticing when to defer enfix:
@@ -760,6 +755,9 @@ bool Process_Action_Maybe_Stale_Throws(REBFRM * const f)
         if (GET_CELL_FLAG(f->param, VAR_MARKED_HIDDEN))
             continue;
 
+        if (Typecheck_Plain_Arg(f->param, f->arg))
+            continue;  // the common case, see notes in %sys-typeset.h
+
         // We can't a-priori typecheck the variadic argument, since the values
         // aren't calculated until the function starts running.  Instead we
         // stamp this instance of the varargs with a way to reach back and
@@ -919,6 +917,11 @@ bool Process_Action_Maybe_Stale_Throws(REBFRM * const f)
 
     f_next_gotten = nullptr;  // arbitrary code changes fetched variables
 
+  #if defined(SIGNALS_AT_CALLS)  // instead of each step, see %c-signal.c
+    if (Poll_Signals_Throws(f->out))
+        goto abort_action;
+  #endif
+
     // Note that the dispatcher may push ACTION! values to the data stack
     // which are used to process the return result after the switch.
     //
@@ -938,10 +941,17 @@ bool Process_Action_Maybe_Stale_Throws(REBFRM * const f)
     if (GET_ACTION_FLAG(phase, IS_NATIVE))
         SER_INFO(f->varlist) |= SERIES_INFO_HOLD;
 
+    if (TG_Call_Profiling)  // PROFILER/CALLS, ended by Drop_Action()
+        Profile_Action_Begin(f);
+
     REBNAT dispatcher = ACT_DISPATCHER(phase);
 
+    USDT_PROBE2(action__entry, f, Frame_Label_Or_Anonymous_UTF8(f));
+
     const REBVAL *r = (*dispatcher)(f);
 
+    USDT_PROBE2(action__return, f, Frame_Label_Or_Anonymous_UTF8(f));
+
     if (r == f->out) {
         //
         // common case; we'll want to clear the UNEVALUATED flag if it's
@@ -1034,6 +1044,49 @@ bool Process_Action_Maybe_Stale_Throws(REBFRM * const f)
                 CLEAR_EVAL_FLAG(f, UNDO_NOTE_STALE);
                 goto typecheck_then_dispatch;
             }
+            else if (
+                VAL_ACTION(label) == NATIVE_ACT(return)
+                and VAL_ACTION_BINDING(label) == CTX(f->varlist)
+            ){
+                // This was issued by RETURN/RUN, with a FRAME! to run in
+                // place of this one (a tail call).  By now the C stack of
+                // the body that ran RETURN is unwound, and the REBFRM is
+                // kept...so deep recursion this way runs in constant space.
+                //
+                // The old varlist goes where it would on Drop_Action(), and
+                // the FRAME!'s varlist is run just as DO of a FRAME! would.
+                //
+                CATCH_THROWN(f->out, f->out);
+                assert(IS_FRAME(f->out));
+
+                REBCTX *c = VAL_CONTEXT(f->out);
+                REBARR *run_varlist = CTX_VARLIST(c);
+                if (GET_SUBCLASS_FLAG(
+                    VARLIST, run_varlist, FRAME_HAS_BEEN_INVOKED
+                )){
+                    fail (Error_Stale_Frame_Raw());  // ran since the RETURN
+                }
+
+                option(const REBSYM*) run_label = VAL_FRAME_LABEL(f->out);
+                REBCTX *run_binding = VAL_FRAME_BINDING(f->out);
+
+                DS_DROP_TO(f->dsp_orig);
+                Drop_Action(f);
+                if (f->varlist) {  // unmanaged, so it can be reused
+                    Conserve_Varlist(f->varlist);
+                    f->varlist = nullptr;
+                }
+
+                f->varlist = run_varlist;
+                f->rootvar = CTX_ROOTVAR(c);
+                INIT_LINK_KEYSOURCE(f->varlist, f);
+                INIT_FRM_BINDING(f, run_binding);
+
+                Begin_Prefix_Action(f, run_label);
+                SET_EVAL_FLAG(f, FULLY_SPECIALIZED);  // nulls are as-is
+                CLEAR_EVAL_FLAG(f, UNDO_NOTE_STALE);
+                goto typecheck_then_dispatch;
+            }
         }
 
         // Stay THROWN and let stack levels above try and catch
@@ -133,11 +133,6 @@
 #endif
 
 
-inline static void Expire_Out_Cell_Unless_Invisible(REBFRM *f) {
-    SET_CELL_FLAG(f->out, OUT_NOTE_STALE);
-}
-
-
 // SET-WORD!, SET-PATH!, SET-GROUP!, and SET-BLOCK! all want to do roughly
 // the same thing as the first step of their evaluation.  They evaluate the
 // right hand side into f->out.
@@ -246,6 +241,173 @@ inline static bool Rightward_Evaluate_Nonvoid_Into_Out_Throws(
 }
 
 
+// Code like `n + 1` or `i < len` is very common, and going through the full
+// action machinery for it means pushing a frame, creating a varlist, type
+// checking two arguments and running a generic dispatch...just to do one
+// machine instruction of work.  So when the enfix operation is one of the
+// basic math or comparison actions, and the left value in f->out and the
+// right hand side are both INTEGER! or DECIMAL!, the result is calculated
+// "intrinsically" without building a frame.
+//
+// This has to give the same answer as running the action would.  So it only
+// takes a right hand side that is a plain INTEGER! or DECIMAL! in the array,
+// or a WORD! looking up to one.  It also doesn't fire if the item after that
+// is a WORD! for any enfix action, to not second guess the deferment logic:
+//
+//     1 + 2 then [...]  ; THEN has DEFERS_LOOKBACK, let the full path do it
+//
+// Actions are recognized by their dispatcher (and verb, for generics), so
+// anything HIJACK'd or ADAPT'd or SPECIALIZE'd goes the normal way.
+//
+// !!! Ticks are not counted for these in DEBUG_COUNT_TICKS, so a tick that
+// is broken on may be shifted when expressions use the intrinsic.
+//
+inline static bool Did_Intrinsic_Enfix_Math(REBFRM *f, REBACT *enfixed)
+{
+    enum Reb_Kind left_kind = cast(enum Reb_Kind, KIND3Q_BYTE_UNCHECKED(f->out));
+    if (left_kind != REB_INTEGER and left_kind != REB_DECIMAL)
+        return false;
+    if (GET_CELL_FLAG(f->out, OUT_NOTE_STALE))
+        return false;
+
+    SYMID sym = SYM_0;  // stays SYM_0 for the comparisons
+    REBNAT dispatcher = ACT_DISPATCHER(enfixed);
+    if (dispatcher == &Generic_Dispatcher) {
+        const REBVAL *verb = DETAILS_AT(ACT_DETAILS(enfixed), 1);
+        sym = VAL_WORD_ID(verb);
+        if (sym != SYM_ADD and sym != SYM_SUBTRACT and sym != SYM_MULTIPLY)
+            return false;
+    }
+    else if (
+        dispatcher != &N_lesser_q
+        and dispatcher != &N_greater_q
+        and dispatcher != &N_equal_q
+    ){
+        return false;
+    }
+
+    // Only array feeds can be peeked ahead in without fetching, and only if
+    // the op word is actually resident at the prior index (e.g. not being
+    // fed from a splice or a pending value).
+    //
+    REBFED *feed = f->feed;
+    if (FEED_IS_VARIADIC(feed) or FEED_PENDING(feed))
+        return false;
+
+    const REBARR *array = FEED_ARRAY(feed);
+    REBIDX index = FEED_INDEX(feed);
+    REBIDX len = cast(REBIDX, ARR_LEN(array));
+    if (index < 1 or index >= len or f_next != ARR_AT(array, index - 1))
+        return false;
+
+    const RELVAL *right = ARR_AT(array, index);
+    switch (KIND3Q_BYTE_UNCHECKED(right)) {
+      case REB_INTEGER:
+      case REB_DECIMAL:
+        break;
+
+      case REB_WORD: {
+        const REBVAL *var = try_unwrap(
+            Lookup_Word(right, FEED_SPECIFIER(feed))
+        );
+        if (not var or (not IS_INTEGER(var) and not IS_DECIMAL(var)))
+            return false;
+        right = var;
+        break; }
+
+      default:
+        return false;
+    }
+
+    if (index + 1 < len) {
+        const RELVAL *after = ARR_AT(array, index + 1);
+        if (
+            KIND3Q_BYTE_UNCHECKED(after) == REB_WORD
+            or (
+                KIND3Q_BYTE_UNCHECKED(after) == REB_PATH
+                and HEART_BYTE(after) == REB_WORD
+            )
+        ){
+            const REBVAL *var = try_unwrap(
+                Lookup_Word(after, FEED_SPECIFIER(feed))
+            );
+            if (
+                var
+                and IS_ACTION(var)
+                and GET_ACTION_FLAG(VAL_ACTION(var), ENFIXED)
+            ){
+                return false;
+            }
+        }
+    }
+    else if (FEED_SPLICE(feed))
+        return false;  // what comes next is in another array
+
+    if (sym == SYM_0) {
+        REBINT diff;
+        if (left_kind == REB_INTEGER and IS_INTEGER(right)) {
+            REBI64 a = VAL_INT64(f->out);
+            REBI64 b = VAL_INT64(right);
+            diff = (a == b) ? 0 : (a > b) ? 1 : -1;
+        }
+        else {  // mixed or decimal, needs the same tolerance as EQUAL?
+            DECLARE_LOCAL (a);
+            DECLARE_LOCAL (b);
+            Copy_Cell(a, f->out);
+            Derelativize(b, right, FEED_SPECIFIER(feed));
+            bool strict = (dispatcher != &N_equal_q);  // see LESSER? notes
+            diff = Compare_Modify_Values(a, b, strict);
+        }
+
+        if (dispatcher == &N_lesser_q)
+            Init_Logic(f->out, diff == -1);
+        else if (dispatcher == &N_greater_q)
+            Init_Logic(f->out, diff == 1);
+        else
+            Init_Logic(f->out, diff == 0);
+    }
+    else if (left_kind == REB_INTEGER and IS_INTEGER(right)) {
+        REBI64 a = VAL_INT64(f->out);
+        REBI64 b = VAL_INT64(right);
+        REBI64 r;
+        bool overflow;
+        if (sym == SYM_ADD)
+            overflow = REB_I64_ADD_OF(a, b, &r);
+        else if (sym == SYM_SUBTRACT)
+            overflow = REB_I64_SUB_OF(a, b, &r);
+        else
+            overflow = REB_I64_MUL_OF(a, b, &r);
+
+        if (overflow)
+            fail (Error_Overflow_Raw());
+        Init_Integer(f->out, r);
+    }
+    else {  // integer mixed with decimal gives a decimal, as in T_Decimal()
+        REBDEC a = left_kind == REB_INTEGER
+            ? cast(REBDEC, VAL_INT64(f->out))
+            : VAL_DECIMAL(f->out);
+        REBDEC b = IS_INTEGER(right)
+            ? cast(REBDEC, VAL_INT64(right))
+            : VAL_DECIMAL(right);
+        REBDEC r;
+        if (sym == SYM_ADD)
+            r = a + b;
+        else if (sym == SYM_SUBTRACT)
+            r = a - b;
+        else
+            r = a * b;
+
+        if (not FINITE(r))
+            fail (Error_Overflow_Raw());
+        Init_Decimal(f->out, r);
+    }
+
+    Fetch_Next_Forget_Lookback(f);  // skip the op word
+    Fetch_Next_Forget_Lookback(f);  // skip the right hand side
+    return true;
+}
+
+
 //
 //  Eval_Maybe_Stale_Throws: C
 //
@@ -355,6 +517,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
 
   //=//// START NEW EXPRESSION ////////////////////////////////////////////=//
 
+  #if !defined(SIGNALS_AT_CALLS)  // else polled by action dispatch, see %c-signal.c
     assert(Eval_Count >= 0);
     if (--Eval_Count == 0) {
         //
@@ -362,9 +525,13 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
         // it may spawn an entire interactive debugging session via
         // breakpoint before it returns.  It may also FAIL and longjmp out.
         //
+        // This is also how a debugger sees every step while stepping (see
+        // SIG_STEP), so there's no hook to test here the rest of the time.
+        //
         if (Do_Signals_Throws(f->out))
             goto return_thrown;
     }
+  #endif
 
     assert(NOT_FEED_FLAG(f->feed, NEXT_ARG_FROM_OUT));
     SET_CELL_FLAG(f->out, OUT_NOTE_STALE);  // out won't act as enfix input
@@ -440,15 +607,10 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
             and not ANY_SET_KIND(kind_current)  // not SET-WORD!, SET-PATH!...
         )
     ){
-        // !!! cache this test?
+        // (A META first parameter isn't quoting, so only SOFT gets here.)
         //
-        const REBPAR *first = First_Unspecialized_Param(nullptr, enfixed);
-        if (
-            VAL_PARAM_CLASS(first) == REB_P_SOFT
-            or VAL_PARAM_CLASS(first) == REB_P_META
-        ){
+        if (GET_ACTION_FLAG(enfixed, SOFT_QUOTES_FIRST))
             goto give_up_backward_quote_priority;  // yield as an exemption
-        }
     }
 
     // Let the <skip> flag allow the right hand side to gracefully decline
@@ -1810,8 +1972,7 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
         if (GET_EVAL_FLAG(f, DIDNT_LEFT_QUOTE_PATH))
             fail (Error_Literal_Left_Path_Raw());
 
-        const REBPAR *first = First_Unspecialized_Param(nullptr, enfixed);
-        if (VAL_PARAM_CLASS(first) == REB_P_SOFT) {
+        if (GET_ACTION_FLAG(enfixed, SOFT_QUOTES_FIRST)) {
             if (GET_FEED_FLAG(f->feed, NO_LOOKAHEAD)) {
                 CLEAR_FEED_FLAG(f->feed, NO_LOOKAHEAD);
                 goto finished;
@@ -1904,7 +2065,11 @@ bool Eval_Maybe_Stale_Throws(REBFRM * const f)
     // An evaluative lookback argument we don't want to defer, e.g. a normal
     // argument or a deferable one which is not being requested in the context
     // of parameter fulfillment.  We want to reuse the f->out value and get it
-    // into the new function's frame.
+    // into the new function's frame...unless it's simple enough math that
+    // we can do it without any frame at all.
+
+    if (Did_Intrinsic_Enfix_Math(f, enfixed))
+        goto lookahead;  // e.g. `x + 1 * 2` needs the `*` to run on x + 1
 
     DECLARE_ACTION_SUBFRAME (subframe, f);
     Push_Frame(f->out, subframe);
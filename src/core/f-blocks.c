@@ -373,6 +373,7 @@ REBARR *Copy_Rerelativized_Array_Deep_Managed(
 //
 RELVAL *Alloc_Tail_Array(REBARR *a)
 {
+    GC_Write_Barrier(a);  // EXPAND_SERIES_TAIL() may not call Expand_Series()
     EXPAND_SERIES_TAIL(a, 1);
     SET_SERIES_LEN(a, ARR_LEN(a));
     RELVAL *last = ARR_LAST(a);
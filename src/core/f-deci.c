@@ -319,6 +319,39 @@ inline static void m_multiply(
     }
 }
 
+/*
+    Multiplies significands a and b of length 3 yielding the "double
+    significand" p; same result as m_multiply (p, 3, a, 3, b);
+    using 128-bit arithmetic where available;
+*/
+inline static void m_multiply_3(
+    uint32_t p[6],
+    const uint32_t a[3],
+    const uint32_t b[3]
+){
+  #if defined(__SIZEOF_INT128__)
+    REBU64 a01 = ((REBU64) a[1] << 32) + a[0];
+    REBU64 b01 = ((REBU64) b[1] << 32) + b[0];
+
+    __uint128_t lo = (__uint128_t) a01 * b01;
+    __uint128_t mid =  /* each term is below 2^96 */
+        (__uint128_t) a01 * b[2] + (__uint128_t) b01 * a[2];
+    __uint128_t hi = (__uint128_t) a[2] * b[2];
+
+    __uint128_t t = (lo >> 64) + (REBU64) mid;
+    __uint128_t u = (t >> 64) + (mid >> 64) + hi;
+
+    p[0] = MASK32(lo);
+    p[1] = MASK32((REBU64) lo >> 32);
+    p[2] = MASK32(t);
+    p[3] = MASK32((REBU64) t >> 32);
+    p[4] = MASK32(u);
+    p[5] = MASK32((REBU64) u >> 32);
+  #else
+    m_multiply (p, 3, a, 3, b);
+  #endif
+}
+
 /*
     Divides significand a by b yielding quotient q;
     returns the remainder;
@@ -993,7 +1026,7 @@ deci deci_multiply(const deci a, const deci b) {
     c.s = (!a.s && b.s) || (a.s && !b.s);
 
     /* multiply sa by sb yielding "double significand" sc */
-    m_multiply (sc, 3, sa, 3, sb);
+    m_multiply_3 (sc, sa, sb);
 
     /* normalize "double significand" sc and round if needed */
     shift = min_shift_right (sc);
@@ -1031,7 +1064,7 @@ inline static void m_divide(
 ){
     uint32_t c[MAX_N + 1], d[MAX_M + 1], e[MAX_M + 1];
     uint32_t bm = b[m - 1];
-    REBU64 cm, dm;
+    REBU64 cm, dm, rm;
     int32_t i, j, k;
 
     if (m <= 1) {
@@ -1045,34 +1078,69 @@ inline static void m_divide(
         return;
     }
 
+  #if defined(__SIZEOF_INT128__)
+    if (m == 2) {  /* the common case, divisors below 2^64 */
+        REBU64 bd = ((REBU64) bm << 32) + b[0];
+        __uint128_t f = a[n - 1], g;  /* bm is nonzero, so f < bd */
+        for (j = n - 2; j >= 0; j--) {
+            f = (f << 32) + (__uint128_t) a[j];
+            g = f / bd;
+            q[j] = (uint32_t) g;
+            f -= g * bd;
+        }
+        r[0] = MASK32(f);
+        r[1] = MASK32((REBU64) f >> 32);
+        return;
+    }
+  #endif
+
     /*
         we shift both the divisor and the dividend to the left
-        to obtain quotients that are off by one at most
+        so the refined estimates below are off by one at most
     */
     /* the most significant bit of b[m - 1] */
     i = 0;
     j = 31;
     while (i < j) {
         k = (i + j + 1) / 2;
-        if ((uint32_t)(1 << k) <= bm) i = k; else j = k - 1;
+        if ((uint32_t)(1u << k) <= bm) i = k; else j = k - 1;
     }
 
-    /* shift the dividend to the left */
-    for (j = 0; j < n; j++) c[j] = a[j] << (31 - i);
-    c[n] = 0;
-    for (j = 0; j < n; j++) c[j + 1] |= a[j] >> (i + 1);
+    /*
+        shift the dividend to the left (in 64 bits, since shifting a
+        32-bit value by i + 1 == 32 when i is 31 is undefined behavior)
+    */
+    c[0] = a[0] << (31 - i);
+    for (j = 1; j < n; j++)
+        c[j] = (uint32_t)((((REBU64) a[j] << 32) + a[j - 1]) >> (i + 1));
+    c[n] = (uint32_t)((REBU64) a[n - 1] >> (i + 1));
 
     /* shift the divisor to the left */
-    for (j = 0; j < m; j++) d[j] = b[j] << (31 - i);
+    d[0] = b[0] << (31 - i);
+    for (j = 1; j < m; j++)
+        d[j] = (uint32_t)((((REBU64) b[j] << 32) + b[j - 1]) >> (i + 1));
     d[m] = 0;
-    for (j = 0; j < m; j++) d[j + 1] |= b[j] >> (i + 1);
 
     dm = (REBU64) d[m - 1];
 
     for (j = n - m; j >= 0; j--) {
         cm = ((REBU64) c[j + m] << 32) + (REBU64) c[j + m - 1];
+        rm = cm % dm;
         cm /= dm;
-        if (cm > 0xffffffffu) cm = 0xffffffffu;
+
+        /*
+            the estimate from the top two digits alone can be two too big;
+            checking it against the next divisor digit fixes one of those
+        */
+        while (
+            cm > 0xffffffffu
+            or cm * d[m - 2] > (rm << 32) + (REBU64) c[j + m - 2]
+        ){
+            cm--;
+            rm += dm;
+            if (rm > 0xffffffffu) break;
+        }
+
         m_multiply_1 (m, e, d, (uint32_t) cm);
         if (m_subtract (m + 1, c + j, c + j, e)) {
             /* the quotient is off by one */
@@ -1084,8 +1152,8 @@ inline static void m_divide(
 
     /* shift the remainder back to the right */
     c[m] = 0;
-    for (j = 0; j < m; j++) r[j] = c[j] >> (31 - i);
-    for (j = 0; j < m; j++) r[j] |= c[j + 1] << (i + 1);
+    for (j = 0; j < m; j++)
+        r[j] = (uint32_t)((((REBU64) c[j + 1] << 32) + c[j]) >> (31 - i));
 }
 
 /* uses double arithmetic */
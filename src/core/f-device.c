@@ -55,12 +55,25 @@ static int Poll_Default(REBDEV *dev)
     for (; req != nullptr; req = BIN(m_cast(REBNOD*, *prior))) {
         assert(Req(req)->command < RDC_MAX);
 
+        // A request the readiness backend is watching would only get the
+        // same "would block" answer again, so skip it until it's ready.  This
+        // keeps thousands of idle sockets from costing a syscall each.
+        //
+        if (
+            (Req(req)->flags & (RRF_WANT_READ | RRF_WANT_WRITE))
+            and not (Req(req)->flags & RRF_READY)
+        ){
+            prior = &node_LINK(ReqNext, req);
+            continue;
+        }
+
         // Call command again:
 
-        Req(req)->flags &= ~RRF_ACTIVE;
+        Req(req)->flags &= ~(RRF_ACTIVE | RRF_READY);
         int result = dev->commands[Req(req)->command](req);
 
         if (result == DR_DONE) { // if done, remove from pending list
+            OS_Unwatch_Request(req);
             *prior = LINK(ReqNext, req);
             mutable_LINK(ReqNext, req) = nullptr;
             Req(req)->flags &= ~RRF_PENDING;
@@ -111,6 +124,8 @@ void Attach_Request(REBNOD **node, REBREQ *req)
 //
 void Detach_Request(REBNOD **node, REBREQ *req)
 {
+    OS_Unwatch_Request(req);  // backend must not be left holding the pointer
+
     REBNOD *r;
 
     for (r = *node; r; r = *node) {
@@ -186,9 +201,14 @@ REBVAL *OS_Do_Device(REBREQ *req)
     // now, preserve that behavior by always running the device code with
     // a trap in effect.
 
+    USDT_PROBE2(device__begin, dev->title, cast(int, Req(req)->command));
+
     REBVAL *error_or_int = rebRescue(cast(REBDNG*, &Dangerous_Command), req);
 
     if (rebDid("error?", error_or_int)) {
+        USDT_PROBE3(device__end, dev->title, cast(int, Req(req)->command), -1);
+
+        OS_Unwatch_Request(req);
         if (dev->pending)
             Detach_Request(&dev->pending, req); // "often a no-op", it said
 
@@ -200,6 +220,13 @@ REBVAL *OS_Do_Device(REBREQ *req)
 
     int result = rebUnboxInteger(rebR(error_or_int));
 
+    USDT_PROBE3(
+        device__end,
+        dev->title,
+        cast(int, Req(req)->command),
+        result == DR_PEND ? 0 : 1
+    );
+
     // If request is pending, attach it to device for polling:
     //
     if (result == DR_PEND) {
@@ -208,6 +235,7 @@ REBVAL *OS_Do_Device(REBREQ *req)
     }
 
     assert(result == DR_DONE);
+    OS_Unwatch_Request(req);
     if (dev->pending)
         Detach_Request(&dev->pending, req); // often a no-op
 
@@ -215,6 +243,67 @@ REBVAL *OS_Do_Device(REBREQ *req)
 }
 
 
+//
+//  OS_Watch_Request: C
+//
+// Called by a device command that is about to return DR_PEND because the
+// OS handle `fd` would block, with `want` as RRF_WANT_READ and/or
+// RRF_WANT_WRITE.  If a readiness backend is installed (see PG_Watch_Hook)
+// the request won't be retried until the handle is ready, and a WAIT will
+// wake up as soon as it is--instead of after its next timer tick.
+//
+// With no backend this does nothing, and the request is retried on every
+// poll as in R3-Alpha.  The request is unwatched automatically when it is
+// detached from the pending list, but a device that closes `fd` while a
+// request is still pending should call OS_Unwatch_Request() first.
+//
+// !!! Windows has no backend yet.  IOCP reports completions rather than
+// readiness, so it fits a device model where reads are posted up front
+// instead of retried...which is not this one.
+//
+void OS_Watch_Request(REBREQ *req, int fd, uint16_t want)
+{
+    struct rebol_devreq *r = Req(req);
+    assert(want != 0 and not (want & ~(RRF_WANT_READ | RRF_WANT_WRITE)));
+
+    if (PG_Watch_Hook == nullptr)
+        return;
+
+    uint16_t old_want = r->flags & (RRF_WANT_READ | RRF_WANT_WRITE);
+    if (old_want != 0 and r->watched != fd)
+        OS_Unwatch_Request(req);  // handle changed (not expected, but safe)
+    else if (old_want == want)
+        return;  // already registered for this
+
+    if (not PG_Watch_Hook(req, fd, want)) {
+        OS_Unwatch_Request(req);
+        return;
+    }
+
+    r->flags &= ~(RRF_WANT_READ | RRF_WANT_WRITE);
+    r->flags |= want;
+    r->watched = fd;
+}
+
+
+//
+//  OS_Unwatch_Request: C
+//
+// Stop watching a request's handle for readiness.  No-op if not watched.
+//
+void OS_Unwatch_Request(REBREQ *req)
+{
+    struct rebol_devreq *r = Req(req);
+    if (not (r->flags & (RRF_WANT_READ | RRF_WANT_WRITE)))
+        return;
+
+    if (PG_Watch_Hook)  // may have already shut down in OS_Quit_Devices()
+        PG_Watch_Hook(req, r->watched, 0);
+
+    r->flags &= ~(RRF_WANT_READ | RRF_WANT_WRITE | RRF_READY);
+}
+
+
 //
 //  OS_Make_Devreq: C
 //
@@ -292,6 +292,23 @@ extern void *REALLOC(void*,size_t);
     }
 #endif
 
+// Ren-C: With USE_THREAD_ISOLATES, interpreters on several threads may use
+// dtoa() at once.  The Bigint freelist and result buffer are made thread-
+// local for that, and private memory is omitted (its pointer is initialized
+// with an address, which can't be done for a thread-local).  This is less
+// work than the MULTIPLE_THREADS mode, which needs locks and thread numbers.
+//
+#if defined(USE_THREAD_ISOLATES)
+    #if defined(_MSC_VER)
+        #define DTOA_THREAD_LOCAL __declspec(thread)
+    #else
+        #define DTOA_THREAD_LOCAL __thread
+    #endif
+    #define Omit_Private_Memory
+#else
+    #define DTOA_THREAD_LOCAL
+#endif
+
 #ifndef Omit_Private_Memory
 #ifndef PRIVATE_MEM
 #define PRIVATE_MEM 2304
@@ -1554,7 +1571,7 @@ ThInfo {
     Bigint *P5s;
     } ThInfo;
 
- static ThInfo TI0;
+ static DTOA_THREAD_LOCAL ThInfo TI0;
 
 #ifdef MULTIPLE_THREADS
  static ThInfo *TI1;
@@ -3016,7 +3033,7 @@ quorem(Bigint *b, Bigint *S)
 
 
 #ifndef MULTIPLE_THREADS
- static char *dtoa_result;
+ static DTOA_THREAD_LOCAL char *dtoa_result;
 #endif
 
  static char *
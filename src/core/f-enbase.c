@@ -166,6 +166,516 @@ static const REBYTE Enbase64[64] =
 };
 
 
+//=//// BASE-64 RUNS //////////////////////////////////////////////////////=//
+//
+// Most base-64 is long stretches of the 64 alphabet characters, broken up by
+// a newline every so often.  So the encoder and decoder hand those stretches
+// to the routines here, which do them a vector at a time where they can:
+//
+// * Encoding uses the method of Wojciech Muła ("Base64 encoding with SIMD
+//   instructions", 2016).  A shuffle spreads each 3 bytes over a 32-bit lane,
+//   multiplies shift the four 6-bit fields into their own bytes, and a
+//   16-entry table (indexed by which range the value is in) gives the amount
+//   to add to make the character.
+//
+// * Decoding is that in reverse (Muła and Lemire, "Faster Base64 Encoding
+//   and Decoding Using AVX2 Instructions", 2018).  Two 16-entry tables for
+//   the low and high nibbles of each character have a bit in common only for
+//   characters that aren't in the alphabet, which makes validation an AND.
+//
+// * NEON has interleaving loads and stores, so 48 bytes are split into the
+//   4 fields of 16 triples at once, and its 64-byte table lookup turns them
+//   straight into characters (and back).
+//
+// Anything that isn't plain alphabet--padding, spaces, newlines, the `}` of
+// a 64#{...} literal, bytes over 127--ends a run.  The callers then handle
+// that one character the same way they always have.  So delimiting and
+// error reporting is unchanged, and only the no-surprises part goes faster.
+//
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define BASE64_AVX2
+#elif defined(__SSSE3__)
+    #include <tmmintrin.h>
+    #define BASE64_SSSE3
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define BASE64_NEON
+#endif
+
+
+#if defined(BASE64_AVX2) || defined(BASE64_SSSE3)
+
+// The 12 bytes at the start of each 16 moved so each 32-bit lane holds 3 of
+// them, as "b1 b0 b2 b1" so the fields can be pulled out with 16-bit math.
+//
+#define B64_ENC_SPREAD \
+    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+#define B64_ENC_SPREAD_4 \
+    5, 4, 6, 5, 8, 7, 9, 8, 11, 10, 12, 11, 14, 13, 15, 14
+
+// What to add to a 6-bit value to get its character, found by the value's
+// range: 0-25 (uppercase), 26-51 (lowercase), 52-61 (digits), 62, and 63.
+//
+#define B64_ENC_SHIFTS \
+    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, \
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, \
+    '/' - 63, 'A', 0, 0
+
+// The nibble tables for decoding.  Only characters outside the alphabet have
+// a bit set in both their low nibble's entry and their high nibble's entry.
+// (Every byte over 127 is caught by the high nibble entry's 0x10.)
+//
+#define B64_DEC_LO_NIBBLES \
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, \
+    0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+#define B64_DEC_HI_NIBBLES \
+    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, \
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+
+// What to add to a valid character for its value, by its high nibble (with
+// '/' taking the entry below its nibble's, since it shares that with '+').
+//
+#define B64_DEC_ROLLS \
+    0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+
+// After the values are merged into 24 bits per 32-bit lane, the bytes are
+// big-endian within each lane and need to be put in order at the front.
+//
+#define B64_DEC_GATHER \
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+
+
+inline static __m128i Enbase64_Vector(__m128i in)  // 12 bytes
+{
+    in = _mm_shuffle_epi8(in, _mm_setr_epi8(B64_ENC_SPREAD));
+    __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    __m128i indices = _mm_or_si128(t1, t3);
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+    __m128i shifts = _mm_setr_epi8(B64_ENC_SHIFTS);
+    return _mm_add_epi8(_mm_shuffle_epi8(shifts, range), indices);
+}
+
+// Gives back false if any of the 16 characters aren't in the alphabet.
+//
+inline static bool Debase64_Vector(REBYTE *dst, __m128i in)  // 12 bytes
+{
+    __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), nibble_mask);
+    __m128i lo_nibbles = _mm_and_si128(in, nibble_mask);
+    __m128i lo = _mm_shuffle_epi8(
+        _mm_setr_epi8(B64_DEC_LO_NIBBLES), lo_nibbles
+    );
+    __m128i hi = _mm_shuffle_epi8(
+        _mm_setr_epi8(B64_DEC_HI_NIBBLES), hi_nibbles
+    );
+    __m128i bad = _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+    if (_mm_movemask_epi8(bad) != 0xFFFF)  // (no PTEST until SSE4.1)
+        return false;
+
+    __m128i slashes = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+    __m128i rolls = _mm_shuffle_epi8(
+        _mm_setr_epi8(B64_DEC_ROLLS), _mm_add_epi8(slashes, hi_nibbles)
+    );
+    __m128i values = _mm_add_epi8(in, rolls);
+
+    __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i merged = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    merged = _mm_shuffle_epi8(merged, _mm_setr_epi8(B64_DEC_GATHER));
+
+    REBYTE buf[16];
+    _mm_storeu_si128(cast(__m128i*, buf), merged);
+    memcpy(dst, buf, 12);
+    return true;
+}
+
+#endif
+
+
+#if defined(BASE64_AVX2)
+
+// The upper lane is loaded from 4 bytes earlier than its 12 bytes, so the
+// 24 bytes can be loaded without reading past them.
+//
+inline static __m256i Enbase64_Vector_256(__m256i in)  // 2 * 12 bytes
+{
+    in = _mm256_shuffle_epi8(
+        in, _mm256_setr_epi8(B64_ENC_SPREAD, B64_ENC_SPREAD_4)
+    );
+    __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+    __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+    __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    __m256i indices = _mm256_or_si256(t1, t3);
+
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    range = _mm256_or_si256(
+        range, _mm256_and_si256(upper, _mm256_set1_epi8(13))
+    );
+    __m256i shifts = _mm256_setr_epi8(B64_ENC_SHIFTS, B64_ENC_SHIFTS);
+    return _mm256_add_epi8(_mm256_shuffle_epi8(shifts, range), indices);
+}
+
+// Gives back false if any of the 32 characters aren't in the alphabet.
+//
+inline static bool Debase64_Vector_256(REBYTE *dst, __m256i in)  // 24 bytes
+{
+    __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    __m256i hi_nibbles = _mm256_and_si256(
+        _mm256_srli_epi32(in, 4), nibble_mask
+    );
+    __m256i lo_nibbles = _mm256_and_si256(in, nibble_mask);
+    __m256i lo = _mm256_shuffle_epi8(
+        _mm256_setr_epi8(B64_DEC_LO_NIBBLES, B64_DEC_LO_NIBBLES),
+        lo_nibbles
+    );
+    __m256i hi = _mm256_shuffle_epi8(
+        _mm256_setr_epi8(B64_DEC_HI_NIBBLES, B64_DEC_HI_NIBBLES),
+        hi_nibbles
+    );
+    if (not _mm256_testz_si256(lo, hi))
+        return false;
+
+    __m256i slashes = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'));
+    __m256i rolls = _mm256_shuffle_epi8(
+        _mm256_setr_epi8(B64_DEC_ROLLS, B64_DEC_ROLLS),
+        _mm256_add_epi8(slashes, hi_nibbles)
+    );
+    __m256i values = _mm256_add_epi8(in, rolls);
+
+    __m256i pairs = _mm256_maddubs_epi16(
+        values, _mm256_set1_epi32(0x01400140)
+    );
+    __m256i merged = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    merged = _mm256_shuffle_epi8(
+        merged, _mm256_setr_epi8(B64_DEC_GATHER, B64_DEC_GATHER)
+    );
+    merged = _mm256_permutevar8x32_epi32(  // 12 bytes of each lane together
+        merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7)
+    );
+
+    REBYTE buf[32];
+    _mm256_storeu_si256(cast(__m256i*, buf), merged);
+    memcpy(dst, buf, 24);
+    return true;
+}
+
+#endif
+
+
+#if defined(BASE64_NEON)
+
+// A 64-byte table (in four registers) for vqtbl4q_u8(), from `Enbase64` or
+// either half of `Debase64`.
+//
+inline static uint8x16x4_t Neon_Table(const REBYTE *bytes) {
+    uint8x16x4_t t;
+    t.val[0] = vld1q_u8(bytes);
+    t.val[1] = vld1q_u8(bytes + 16);
+    t.val[2] = vld1q_u8(bytes + 32);
+    t.val[3] = vld1q_u8(bytes + 48);
+    return t;
+}
+
+#endif
+
+
+// Encode the complete 3-byte groups at the start of `src`, giving back how
+// many bytes of it that was (4 characters are written for every 3 bytes).
+//
+static REBLEN Enbase64_Run(REBYTE *dst, const REBYTE *src, REBLEN len)
+{
+    const REBYTE *start = src;
+
+  #if defined(BASE64_AVX2)
+    for (; len >= 24; len -= 24, src += 24, dst += 32) {
+        __m256i in = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                _mm_loadu_si128(cast(const __m128i*, src))
+            ),
+            _mm_loadu_si128(cast(const __m128i*, src + 8)),
+            1
+        );
+        _mm256_storeu_si256(cast(__m256i*, dst), Enbase64_Vector_256(in));
+    }
+  #endif
+  #if defined(BASE64_AVX2) || defined(BASE64_SSSE3)
+    for (; len >= 16; len -= 12, src += 12, dst += 16) {  // reads 16
+        __m128i in = _mm_loadu_si128(cast(const __m128i*, src));
+        _mm_storeu_si128(cast(__m128i*, dst), Enbase64_Vector(in));
+    }
+  #elif defined(BASE64_NEON)
+    if (len >= 48) {
+        uint8x16x4_t table = Neon_Table(Enbase64);
+        uint8x16_t six_bits = vdupq_n_u8(0x3F);
+        for (; len >= 48; len -= 48, src += 48, dst += 64) {
+            uint8x16x3_t in = vld3q_u8(src);
+            uint8x16x4_t out;
+            out.val[0] = vshrq_n_u8(in.val[0], 2);
+            out.val[1] = vandq_u8(
+                vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)),
+                six_bits
+            );
+            out.val[2] = vandq_u8(
+                vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)),
+                six_bits
+            );
+            out.val[3] = vandq_u8(in.val[2], six_bits);
+            out.val[0] = vqtbl4q_u8(table, out.val[0]);
+            out.val[1] = vqtbl4q_u8(table, out.val[1]);
+            out.val[2] = vqtbl4q_u8(table, out.val[2]);
+            out.val[3] = vqtbl4q_u8(table, out.val[3]);
+            vst4q_u8(dst, out);
+        }
+    }
+  #endif
+
+    for (; len >= 3; len -= 3, src += 3, dst += 4) {
+        dst[0] = Enbase64[src[0] >> 2];
+        dst[1] = Enbase64[((src[0] & 0x3) << 4) + (src[1] >> 4)];
+        dst[2] = Enbase64[((src[1] & 0xF) << 2) + (src[2] >> 6)];
+        dst[3] = Enbase64[src[2] & 0x3F];
+    }
+
+    return src - start;
+}
+
+
+// Decode groups of 4 alphabet characters from the start of `cp`, stopping
+// at the first group with anything else in it.  Gives back how many of the
+// characters were decoded (3 bytes are written for every 4).
+//
+static REBLEN Debase64_Run(REBYTE *dst, const REBYTE *cp, REBLEN len)
+{
+    const REBYTE *start = cp;
+
+  #if defined(BASE64_AVX2)
+    for (; len >= 32; len -= 32, cp += 32, dst += 24) {
+        __m256i in = _mm256_loadu_si256(cast(const __m256i*, cp));
+        if (not Debase64_Vector_256(dst, in))
+            break;  // finish with the shorter loops
+    }
+  #endif
+  #if defined(BASE64_AVX2) || defined(BASE64_SSSE3)
+    for (; len >= 16; len -= 16, cp += 16, dst += 12) {
+        __m128i in = _mm_loadu_si128(cast(const __m128i*, cp));
+        if (not Debase64_Vector(dst, in))
+            break;
+    }
+  #elif defined(BASE64_NEON)
+    if (len >= 64) {
+        uint8x16x4_t lo = Neon_Table(Debase64);
+        uint8x16x4_t hi = Neon_Table(Debase64 + 64);
+        uint8x16_t offset = vdupq_n_u8(64);
+        uint8x16_t pad = vdupq_n_u8('=');
+        for (; len >= 64; len -= 64, cp += 64, dst += 48) {
+            uint8x16x4_t in = vld4q_u8(cp);
+            uint8x16_t flags = vdupq_n_u8(0);  // BIN_SPACE and BIN_ERROR
+            uint8x16_t chars = vdupq_n_u8(0);  // any over 127?
+            REBLEN i;
+            for (i = 0; i < 4; ++i) {  // 64-127 miss `lo`, 0-63 miss `hi`
+                uint8x16_t v = vqtbl4q_u8(lo, in.val[i]);
+                v = vqtbx4q_u8(v, hi, vsubq_u8(in.val[i], offset));
+                flags = vorrq_u8(flags, vorrq_u8(v, vceqq_u8(in.val[i], pad)));
+                chars = vorrq_u8(chars, in.val[i]);
+                in.val[i] = v;
+            }
+            if (vmaxvq_u8(flags) >= BIN_SPACE or vmaxvq_u8(chars) >= 0x80)
+                break;
+            uint8x16x3_t out;
+            out.val[0] = vorrq_u8(
+                vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4)
+            );
+            out.val[1] = vorrq_u8(
+                vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2)
+            );
+            out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+            vst3q_u8(dst, out);
+        }
+    }
+  #endif
+
+    for (; len >= 4; len -= 4, cp += 4, dst += 3) {
+        if (cp[0] > 127 or cp[1] > 127 or cp[2] > 127 or cp[3] > 127)
+            break;
+        REBYTE a = Debase64[cp[0]];
+        REBYTE b = Debase64[cp[1]];
+        REBYTE c = Debase64[cp[2]];
+        REBYTE d = Debase64[cp[3]];
+        if (
+            ((a | b | c | d) & (BIN_SPACE | BIN_ERROR))
+            or cp[0] == '=' or cp[1] == '=' or cp[2] == '=' or cp[3] == '='
+        ){
+            break;
+        }
+        uint32_t accum = (a << 18) | (b << 12) | (c << 6) | d;
+        dst[0] = cast(REBYTE, accum >> 16);
+        dst[1] = cast(REBYTE, accum >> 8);
+        dst[2] = cast(REBYTE, accum);
+    }
+
+    return cp - start;
+}
+
+
+//=//// HEX RUNS //////////////////////////////////////////////////////////=//
+//
+// Hex is how BINARY! molds by default, and how checksums and hashes are
+// usually shown, so it tends to come in long unbroken stretches.  SSE2 (which
+// every x86-64 has) and NEON do 16 bytes at a time:
+//
+// * Encoding splits the bytes into high and low nibbles, turns each nibble
+//   into its digit ('0' + n, plus 7 more to reach 'A' past 9), and then
+//   interleaves the two so each byte's digits come out high nibble first.
+//
+// * Decoding checks that every character is 0-9, A-F, or a-f, and gets the
+//   nibbles the same way in reverse, then merges each pair of them.
+//
+// As with base-64, what isn't a digit (spaces, newlines, the delimiter, an
+// error) ends the run, and the callers' byte-at-a-time code takes over.
+//
+
+#if defined(__SSE2__) || defined(_M_X64)  // MSVC doesn't define __SSE2__
+    #include <emmintrin.h>
+    #define HEX_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define HEX_NEON
+#endif
+
+
+// Write the two uppercase hex digits of each of `len` bytes.
+//
+static void Enhex_Run(REBYTE *dst, const REBYTE *src, REBLEN len)
+{
+  #if defined(HEX_SSE2)
+    __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i zero = _mm_set1_epi8('0');
+    __m128i nine = _mm_set1_epi8(9);
+    __m128i seven = _mm_set1_epi8(7);
+    for (; len >= 16; len -= 16, src += 16, dst += 32) {
+        __m128i in = _mm_loadu_si128(cast(const __m128i*, src));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(in, 4), nibble);
+        __m128i lo = _mm_and_si128(in, nibble);
+        hi = _mm_add_epi8(
+            _mm_add_epi8(hi, zero),
+            _mm_and_si128(_mm_cmpgt_epi8(hi, nine), seven)
+        );
+        lo = _mm_add_epi8(
+            _mm_add_epi8(lo, zero),
+            _mm_and_si128(_mm_cmpgt_epi8(lo, nine), seven)
+        );
+        _mm_storeu_si128(cast(__m128i*, dst), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(cast(__m128i*, dst + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+  #elif defined(HEX_NEON)
+    uint8x16_t digits = vld1q_u8(cb_cast(Hex_Digits));
+    for (; len >= 16; len -= 16, src += 16, dst += 32) {
+        uint8x16_t in = vld1q_u8(src);
+        uint8x16x2_t out;
+        out.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(in, 4));
+        out.val[1] = vqtbl1q_u8(digits, vandq_u8(in, vdupq_n_u8(0x0F)));
+        vst2q_u8(dst, out);
+    }
+  #endif
+
+    for (; len > 0; --len, ++src) {
+        *dst++ = Hex_Digits[*src >> 4];
+        *dst++ = Hex_Digits[*src & 0xF];
+    }
+}
+
+
+// Decode pairs of hex digits from the start of `cp`, stopping at the first
+// pair with anything else in it.  Gives back how many characters that was
+// (one byte is written for every 2).
+//
+static REBLEN Dehex_Run(REBYTE *dst, const REBYTE *cp, REBLEN len)
+{
+    const REBYTE *start = cp;
+
+  #if defined(HEX_SSE2)
+    for (; len >= 16; len -= 16, cp += 16, dst += 8) {
+        __m128i in = _mm_loadu_si128(cast(const __m128i*, cp));
+        __m128i lower = _mm_or_si128(in, _mm_set1_epi8(0x20));  // A-F => a-f
+
+        // Signed compares are fine, since bytes over 127 are negative and
+        // fail both tests.
+        //
+        __m128i digit = _mm_and_si128(
+            _mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)),
+            _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1))
+        );
+        __m128i letter = _mm_and_si128(
+            _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+            _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1))
+        );
+        if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xFFFF)
+            break;  // finish with the pair loop
+
+        __m128i values = _mm_or_si128(
+            _mm_and_si128(digit, _mm_sub_epi8(in, _mm_set1_epi8('0'))),
+            _mm_and_si128(letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)))
+        );
+
+        // Little-endian 16-bit lanes hold the first digit in the low byte.
+        //
+        __m128i pairs = _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 4),
+            _mm_srli_epi16(values, 8)
+        );
+        _mm_storel_epi64(cast(__m128i*, dst), _mm_packus_epi16(pairs, pairs));
+    }
+  #elif defined(HEX_NEON)
+    for (; len >= 32; len -= 32, cp += 32, dst += 16) {
+        uint8x16x2_t in = vld2q_u8(cp);  // first digits, second digits
+        uint8x16_t ok = vdupq_n_u8(0xFF);
+        REBLEN i;
+        for (i = 0; i < 2; ++i) {
+            uint8x16_t digit = vsubq_u8(in.val[i], vdupq_n_u8('0'));
+            uint8x16_t letter = vsubq_u8(
+                vorrq_u8(in.val[i], vdupq_n_u8(0x20)), vdupq_n_u8('a')
+            );
+            uint8x16_t is_digit = vcltq_u8(digit, vdupq_n_u8(10));
+            uint8x16_t is_letter = vcltq_u8(letter, vdupq_n_u8(6));
+            ok = vandq_u8(ok, vorrq_u8(is_digit, is_letter));
+            in.val[i] = vbslq_u8(
+                is_digit, digit, vaddq_u8(letter, vdupq_n_u8(10))
+            );
+        }
+        if (vminvq_u8(ok) == 0)
+            break;
+        vst1q_u8(dst, vorrq_u8(vshlq_n_u8(in.val[0], 4), in.val[1]));
+    }
+  #endif
+
+    for (; len >= 2; len -= 2, cp += 2, ++dst) {
+        REBYTE d[2];
+        REBLEN i;
+        for (i = 0; i < 2; ++i) {
+            REBYTE c = cp[i];
+            if (c >= '0' and c <= '9')
+                d[i] = c - '0';
+            else if ((c | 0x20) >= 'a' and (c | 0x20) <= 'f')
+                d[i] = (c | 0x20) - ('a' - 10);
+            else
+                return cp - start;
+        }
+        *dst = (d[0] << 4) | d[1];
+    }
+
+    return cp - start;
+}
+
+
 //
 //  Decode_Base2: C
 //
@@ -222,8 +732,22 @@ static REBBIN *Decode_Base16(const REBYTE **src, REBLEN len, REBYTE delim)
     REBYTE *bp = BIN_HEAD(bin);
     const REBYTE *cp = *src;
 
+    bool runs = not (  // so runs can't skip past the delimiter
+        (delim >= '0' and delim <= '9')
+        or ((delim | 0x20) >= 'a' and (delim | 0x20) <= 'f')
+    );
+
     for (; len > 0; cp++, len--) {
 
+        if (not (count & 1) and runs) {  // between pairs of digits
+            REBLEN n = Dehex_Run(bp, cp, len);
+            bp += n / 2;
+            cp += n;
+            len -= n;
+            if (len == 0)
+                break;
+        }
+
         if (delim && *cp == delim) break;
 
         REBYTE lex = Lex_Map[*cp];
@@ -263,8 +787,22 @@ static REBBIN *Decode_Base64(const REBYTE **src, REBLEN len, REBYTE delim)
     REBYTE *bp = BIN_HEAD(bin);
     const REBYTE *cp = *src;
 
+    // Runs stop at anything outside the alphabet, so they can't skip past
+    // the delimiter...unless the delimiter is *in* the alphabet.
+    //
+    bool runs = (delim == 0 or delim > 127 or Debase64[delim] >= BIN_SPACE);
+
     for (; len > 0; cp++, len--) {
 
+        if (flip == 0 and runs) {  // on a 4-character boundary
+            REBLEN n = Debase64_Run(bp, cp, len);
+            bp += n / 4 * 3;
+            cp += n;
+            len -= n;
+            if (len == 0)
+                break;
+        }
+
         // Check for terminating delimiter (optional):
         if (delim && *cp == delim) break;
 
@@ -400,23 +938,38 @@ void Form_Base16(REB_MOLD *mo, const REBYTE *src, REBLEN len, bool brk)
     if (len == 0)
         return;
 
-    // !!! This used to predict the length, accounting for hex digits, lines,
-    // and extra syntax ("slop factor"):
+    REBSTR *s = mo->series;
+    REBLEN old_len = STR_LEN(s);
+    REBSIZ old_size = STR_SIZE(s);
+
+    // With `brk`, 64 digits (32 bytes) go on each line, and there is a
+    // newline at the start and end if there's more than one line.
     //
-    //     len * 2 + len / 32 + 32
+    REBYTE *bp = Prep_Mold_Overestimated(
+        mo, len * 2 + (brk ? len / 32 + 2 : 0)
+    );
+    REBYTE *start = bp;
+
+    bool lines = brk and len >= 32;
+    if (lines)
+        *bp++ = LF;
+
+    if (brk) {
+        for (; len >= 32; len -= 32, src += 32) {
+            Enhex_Run(bp, src, 32);
+            bp += 64;
+            *bp++ = LF;
+        }
+    }
 
-    if (brk and len >= 32)
-        Append_Codepoint(mo->series, LF);
+    Enhex_Run(bp, src, len);
+    bp += len * 2;
 
-    REBLEN count;
-    for (count = 1; count <= len; count++) {
-        Form_Hex2(mo, *src++);
-        if (brk and ((count % 32) == 0))
-            Append_Codepoint(mo->series, LF);
-    }
+    if (lines and bp[-1] != LF)
+        *bp++ = LF;
 
-    if (brk and (len >= 32) and *BIN_LAST(mo->series) != LF)
-        Append_Codepoint(mo->series, LF);
+    REBLEN added = bp - start;
+    TERM_STR_LEN_SIZE(s, old_len + added, old_size + added);
 }
 
 
@@ -430,51 +983,51 @@ void Form_Base16(REB_MOLD *mo, const REBYTE *src, REBLEN len, bool brk)
 //
 void Form_Base64(REB_MOLD *mo, const REBYTE *src, REBLEN len, bool brk)
 {
-    // !!! This used to predict the length, accounting for hex digits, lines,
-    // and extra syntax ("slop factor") and preallocate size for that.  Now
-    // it appends one character at a time and relies upon the mold buffer's
-    // natural expansion.  Review if it needs the optimization.
-
     REBSTR *s = mo->series;
+    REBLEN old_len = STR_LEN(s);
+    REBSIZ old_size = STR_SIZE(s);
 
-    REBINT loop = cast(int, len / 3) - 1;
-    if (brk and 4 * loop > 64)
-        Append_Codepoint(s, LF);
-
-    REBINT x;
-    for (x = 0; x <= 3 * loop; x += 3) {
-        Append_Codepoint(s, Enbase64[src[x] >> 2]);
-        Append_Codepoint(
-            s,
-            Enbase64[((src[x] & 0x3) << 4) + (src[x + 1] >> 4)]
-        );
-        Append_Codepoint(
-            s,
-            Enbase64[((src[x + 1] & 0xF) << 2) + (src[x + 2] >> 6)]
-        );
-        Append_Codepoint(s, Enbase64[(src[x + 2] % 0x40)]);
-        if ((x + 3) % 48 == 0 && brk)
-            Append_Codepoint(s, LF);
+    // With `brk`, 64 characters (48 bytes) go on each line, and there is a
+    // newline at the start and end if there's more than one line.
+    //
+    REBLEN triples = len / 3;
+    REBYTE *bp = Prep_Mold_Overestimated(
+        mo, 4 * (triples + 1) + (brk ? triples / 16 + 2 : 0)
+    );
+    REBYTE *start = bp;
+
+    if (brk and triples > 17)
+        *bp++ = LF;
+
+    if (brk) {
+        for (; len >= 48; len -= 48, src += 48) {
+            Enbase64_Run(bp, src, 48);
+            bp += 64;
+            *bp++ = LF;
+        }
     }
 
-    if ((len % 3) != 0) {
-        Append_Codepoint(s, Enbase64[src[x] >> 2]);
+    REBLEN n = Enbase64_Run(bp, src, len);
+    bp += n / 3 * 4;
+    src += n;
+    len -= n;
 
-        if (len - x == 1) {
-            Append_Codepoint(s, Enbase64[((src[x] & 0x3) << 4)]);
-            Append_Codepoint(s, '=');
+    if (len != 0) {
+        *bp++ = Enbase64[src[0] >> 2];
+        if (len == 1) {
+            *bp++ = Enbase64[(src[0] & 0x3) << 4];
+            *bp++ = '=';
         }
         else {
-            Append_Codepoint(
-                s,
-                Enbase64[((src[x] & 0x3) << 4) | (src[x + 1] >> 4)]
-            );
-            Append_Codepoint(s, Enbase64[(src[x + 1] & 0xF) << 2]);
+            *bp++ = Enbase64[((src[0] & 0x3) << 4) | (src[1] >> 4)];
+            *bp++ = Enbase64[(src[1] & 0xF) << 2];
         }
-
-        Append_Codepoint(s, '=');
+        *bp++ = '=';
     }
 
-    if (brk and x > 49 and *BIN_LAST(s) != LF)
-        Append_Codepoint(s, LF);
+    if (brk and 3 * triples > 49 and bp[-1] != LF)
+        *bp++ = LF;
+
+    REBLEN added = bp - start;
+    TERM_STR_LEN_SIZE(s, old_len + added, old_size + added);
 }
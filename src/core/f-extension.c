@@ -117,6 +117,8 @@ REBNATIVE(load_extension)
 {
     INCLUDE_PARAMS_OF_LOAD_EXTENSION;
 
+    REBI64 start = Startup_Clock_Nanoseconds();  // tallied for STATS/STARTUP
+
     DECLARE_LOCAL (lib);
     SET_END(lib);
     PUSH_GC_GUARD(lib);
@@ -316,6 +318,9 @@ REBNATIVE(load_extension)
     DROP_GC_GUARD(path);
     DROP_GC_GUARD(lib);
 
+    PG_Startup_Nanoseconds[STARTUP_EXTENSIONS]
+        += Startup_Clock_Nanoseconds() - start;
+
     // !!! If modules are to be "unloadable", they would need some kind of
     // finalizer to clean up their resources.  There are shutdown actions
     // defined in a couple of extensions, but no protocol by which the
@@ -555,9 +555,15 @@ REBLEN Modify_String_Or_Binary(
         if (IS_NONSYMBOL_STRING(dst_ser)) {
             bookmark = LINK(Bookmarks, dst_ser);
 
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx) {  // only INSERT
-                BMK_INDEX(bookmark) += src_len_total;
-                BMK_OFFSET(bookmark) += src_size_total;
+            if (bookmark) {
+                REBLEN i;
+                for (i = 0; i < SER_USED(bookmark); ++i) {
+                    struct Reb_Bookmark *book = BMK_AT(bookmark, i);
+                    if (book->index > dst_idx) {  // only INSERT
+                        book->index += src_len_total;
+                        book->offset += src_size_total;
+                    }
+                }
             }
             dst_ser->misc.length = dst_len_old + src_len_total;
         }
@@ -681,14 +687,29 @@ REBLEN Modify_String_Or_Binary(
         // CHANGE can do arbitrary changes to what index maps to what offset
         // in the region of interest.  The manipulations here would be
         // complicated--but just assume that the start of the change is as
-        // good a cache as any to be relevant for the next operation.
+        // good a cache as any to be relevant for the next operation.  So
+        // bookmarks after the change are dropped, leaving one at its start.
         //
         if (IS_NONSYMBOL_STRING(dst_ser)) {
             bookmark = LINK(Bookmarks, dst_ser);
 
-            if (bookmark and BMK_INDEX(bookmark) > dst_idx) {
-                BMK_INDEX(bookmark) = dst_idx;
-                BMK_OFFSET(bookmark) = dst_off;
+            if (bookmark) {
+                REBLEN kept = 0;
+                bool dropped = false;
+                REBLEN i;
+                for (i = 0; i < SER_USED(bookmark); ++i) {
+                    struct Reb_Bookmark *book = BMK_AT(bookmark, i);
+                    if (book->index > dst_idx)
+                        dropped = true;
+                    else
+                        *BMK_AT(bookmark, kept++) = *book;
+                }
+                if (dropped) {  // at least one slot was freed up for this
+                    BMK_AT(bookmark, kept)->index = dst_idx;
+                    BMK_AT(bookmark, kept)->offset = dst_off;
+                    ++kept;
+                }
+                SET_SERIES_LEN(bookmark, kept);
             }
             dst_ser->misc.length = dst_len_old + src_len_total - part;
         }
@@ -718,7 +739,14 @@ REBLEN Modify_String_Or_Binary(
 
     if (bookmark) {
         REBSTR *dst_str = STR(dst_ser);
-        if (BMK_INDEX(bookmark) > STR_LEN(dst_str)) {  // past active
+
+        bool past_active = false;
+        REBLEN i;
+        for (i = 0; i < SER_USED(bookmark); ++i)
+            if (BMK_AT(bookmark, i)->index > STR_LEN(dst_str))
+                past_active = true;
+
+        if (past_active) {
             assert(sym == SYM_CHANGE);  // only change removes material
             Free_Bookmarks_Maybe_Null(dst_str);
         }
@@ -727,8 +755,12 @@ REBLEN Modify_String_Or_Binary(
             Check_Bookmarks_Debug(dst_str);
           #endif
 
-            if (STR_LEN(dst_str) < sizeof(REBVAL))  // not kept if small
+            if (
+                STR_LEN(dst_str) < sizeof(REBVAL)  // not kept if small
+                or Is_Definitely_Ascii(dst_str)  // not used if all ASCII
+            ){
                 Free_Bookmarks_Maybe_Null(dst_str);
+            }
         }
     }
 
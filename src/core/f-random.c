@@ -50,7 +50,7 @@
 #define MM ((REBI64)1<<62)                  /* the modulus, 2^62 */
 #define mod_diff(x,y) (((x)-(y))&(MM-1))    /* subtraction mod MM */
 
-static REBI64 ran_x[KK];                    /* the generator state */
+static ISOLATE_LOCAL REBI64 ran_x[KK];      /* the generator state */
 
 void ran_array(REBI64 aa[], int n)
 {
@@ -65,13 +65,81 @@ void ran_array(REBI64 aa[], int n)
 /* after calling Set_Random, get new randoms by, e.g., "x=ran_arr_next()" */
 
 #define QUALITY 1009 /* recommended quality level for high-res use */
-static REBI64 ran_arr_buf[QUALITY];
-static REBI64 ran_arr_dummy=-1, ran_arr_started=-1;
-static REBI64 *ran_arr_ptr=&ran_arr_dummy;  /* the next random number, or -1 */
+static ISOLATE_LOCAL REBI64 ran_arr_buf[QUALITY];
+static ISOLATE_LOCAL REBI64 ran_arr_started=-1;
+
+/* Ren-C: this was initialized to point at a -1 `ran_arr_dummy`, but the
+   address of a thread-local (see ISOLATE_LOCAL) isn't a constant, so
+   nullptr means the generator hasn't been started. */
+static ISOLATE_LOCAL REBI64 *ran_arr_ptr;  /* the next random number, or -1 */
 
 #define TT  70      /* guaranteed separation between streams */
 #define is_odd(x)   ((x)&1)         /* units bit of x */
 
+/*  Ren-C: RANDOM-FILL makes values in bulk, where the quality of Knuth's
+    lagged Fibonacci generator isn't needed and its bookkeeping per number
+    is noticeable.  It uses xoshiro256** (Blackman and Vigna, public domain)
+    with its own state.  That is seeded from the same seed, so RANDOM/SEED
+    makes RANDOM-FILL repeatable too.  Neither is for cryptography--see the
+    Crypt extension's get_random(). */
+
+static ISOLATE_LOCAL REBU64 xoshiro_s[4];
+
+static REBU64 Splitmix64(REBU64 *x)
+{
+    REBU64 z = (*x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static void Seed_Random_Fast(REBI64 seed)
+{
+    REBU64 x = cast(REBU64, seed);
+    int i;
+    for (i = 0; i < 4; ++i)
+        xoshiro_s[i] = Splitmix64(&x);  /* never all zero */
+}
+
+#define rotl64(x,k) (((x) << (k)) | ((x) >> (64 - (k))))
+
+//
+//  Random_Fast_U64: C
+//
+// 64 random bits from xoshiro256**, for RANDOM-FILL.
+//
+REBU64 Random_Fast_U64(void)
+{
+    REBU64 *s = xoshiro_s;
+    if ((s[0] | s[1] | s[2] | s[3]) == 0)
+        Seed_Random_Fast(314159L);  /* the user forgot to initialize */
+
+    REBU64 result = rotl64(s[1] * 5, 7) * 9;
+    REBU64 t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    return result;
+}
+
+//
+//  Random_Fill_Bytes: C
+//
+void Random_Fill_Bytes(REBYTE *bp, REBLEN size)
+{
+    for (; size >= 8; size -= 8, bp += 8) {
+        REBU64 r = Random_Fast_U64();
+        memcpy(bp, &r, 8);
+    }
+    if (size != 0) {
+        REBU64 r = Random_Fast_U64();
+        memcpy(bp, &r, size);
+    }
+}
+
 //
 //  Set_Random: C
 //
@@ -101,12 +169,14 @@ void Set_Random(REBI64 seed)
     for (;j<KK;j++) ran_x[j-LL]=x[j];
     for (j=0;j<10;j++) ran_array(x,KK+KK-1); /* warm things up */
     ran_arr_ptr=&ran_arr_started;
+    Seed_Random_Fast(seed);
 }
 
-#define ran_arr_next() (*ran_arr_ptr>=0? *ran_arr_ptr++: ran_arr_cycle())
+#define ran_arr_next() \
+    (ran_arr_ptr && *ran_arr_ptr>=0? *ran_arr_ptr++: ran_arr_cycle())
 static REBI64 ran_arr_cycle(void)
 {
-    if (ran_arr_ptr==&ran_arr_dummy)
+    if (ran_arr_ptr==nullptr)
         Set_Random(314159L); /* the user forgot to initialize */
     ran_array(ran_arr_buf,QUALITY);
     ran_arr_buf[KK]=-1;
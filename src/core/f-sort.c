@@ -0,0 +1,781 @@
+//
+//  File: %f-sort.c
+//  Summary: "pattern-defeating quicksort and stable merge sort"
+//  Section: functional
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// SORT historically used the BSD qsort() in %f-qsort.c.  That is not stable,
+// and its median-of-three pivoting degrades on inputs that are common in
+// practice (such as sorted data with a few items appended, or long runs of
+// equal items).
+//
+// Sort_Unstable() is Orson Peters's "pattern-defeating quicksort" (pdqsort).
+// It is linear on sorted, reverse-sorted and all-equal inputs, noticing when
+// a partition left the data as it was.  When partitions come out unbalanced
+// it shuffles some items to break up the pattern.  After too many bad
+// partitions it switches to heapsort, so the worst case is O(N log N).
+//
+// Sort_Stable() is a bottom-up merge sort over insertion-sorted runs.  Merges
+// are skipped when the runs are already in order, so sorted input is linear.
+// Reverse-sorted input is detected and reversed in place.
+//
+// The items may be of any size, and are compared through a cmp_t callback
+// just like reb_qsort_r().  These routines only ever *swap* items within the
+// array, and never hold an item in a temporary while calling the comparator.
+// That matters for sorting arrays with a user comparator, as the GC may run
+// during the comparison, and it would not see a cell that had been pulled
+// out of the array.  (The merge sort's scratch space must be GC-visible if
+// the caller needs that.)
+//
+// Comparators are not trusted to be consistent (a user function may give
+// random answers).  All scans are bounds-checked: a bad comparator gives an
+// unspecified order, but never reads or writes outside the array.
+//
+
+#include "sys-core.h"
+
+// Parallel sorting is enabled by USE_PARALLEL_SORT in %systems.r, for the
+// platforms that link with pthreads.  As with parallel GC marking, the debug
+// build's checks in cell access use global state, so it sorts on one thread.
+//
+#if defined(USE_PARALLEL_SORT) && defined(NDEBUG)
+    #define PARALLEL_SORT
+    #include <pthread.h>
+#endif
+
+
+#define SORT_INSERTION_MAX 24  // smaller ranges are insertion sorted
+#define SORT_NINTHER_MIN 128  // larger ranges pick pivot as median of medians
+#define SORT_PARTIAL_LIMIT 8  // moves before giving up on "nearly sorted"
+#define SORT_RUN_LEN 16  // insertion sorted runs that merge sort starts with
+
+
+struct Reb_Sorter {
+    REBYTE *base;
+    REBSIZ es;  // size of an item, in bytes
+    REBLEN words;  // size of an item in uintptr_t units, 0 if not aligned
+    void *thunk;
+    cmp_t *cmp;
+};
+
+#define SORT_ITEM(s,i) \
+    ((s)->base + cast(REBSIZ, (i)) * (s)->es)
+
+
+static void Init_Sorter(
+    struct Reb_Sorter *s,
+    void *base,
+    REBSIZ es,
+    void *thunk,
+    cmp_t *cmp
+){
+    s->base = cast(REBYTE*, base);
+    s->es = es;
+    if (
+        es % sizeof(uintptr_t) == 0
+        and cast(uintptr_t, base) % ALIGN_SIZE == 0
+    ){
+        s->words = es / sizeof(uintptr_t);
+    }
+    else
+        s->words = 0;
+    s->thunk = thunk;
+    s->cmp = cmp;
+}
+
+
+static inline bool Sort_Less(struct Reb_Sorter *s, REBLEN i, REBLEN j)
+  { return s->cmp(s->thunk, SORT_ITEM(s, i), SORT_ITEM(s, j)) < 0; }
+
+
+static void Sort_Swap(struct Reb_Sorter *s, REBLEN i, REBLEN j)
+{
+    if (s->words != 0) {
+        uintptr_t *a = cast(uintptr_t*, SORT_ITEM(s, i));
+        uintptr_t *b = cast(uintptr_t*, SORT_ITEM(s, j));
+        REBLEN n;
+        for (n = 0; n < s->words; ++n) {
+            uintptr_t temp = a[n];
+            a[n] = b[n];
+            b[n] = temp;
+        }
+    }
+    else {
+        REBYTE *a = SORT_ITEM(s, i);
+        REBYTE *b = SORT_ITEM(s, j);
+        REBSIZ n;
+        for (n = 0; n < s->es; ++n) {
+            REBYTE temp = a[n];
+            a[n] = b[n];
+            b[n] = temp;
+        }
+    }
+}
+
+
+static void Sort2(struct Reb_Sorter *s, REBLEN i, REBLEN j)
+{
+    if (Sort_Less(s, j, i))
+        Sort_Swap(s, i, j);
+}
+
+
+static void Sort3(struct Reb_Sorter *s, REBLEN i, REBLEN j, REBLEN k)
+{
+    Sort2(s, i, j);
+    Sort2(s, j, k);
+    Sort2(s, i, j);
+}
+
+
+// Items are only moved past items they are strictly less than, so this is
+// stable (and merge sort depends on that).
+//
+static void Insertion_Sort(struct Reb_Sorter *s, REBLEN lo, REBLEN hi)
+{
+    REBLEN i;
+    for (i = lo + 1; i < hi; ++i) {
+        REBLEN j;
+        for (j = i; j > lo and Sort_Less(s, j, j - 1); --j)
+            Sort_Swap(s, j, j - 1);
+    }
+}
+
+
+// Insertion sort that gives up (returning false) once it has had to move
+// items more than SORT_PARTIAL_LIMIT places in total.
+//
+static bool Partial_Insertion_Sort(struct Reb_Sorter *s, REBLEN lo, REBLEN hi)
+{
+    REBLEN moves = 0;
+    REBLEN i;
+    for (i = lo + 1; i < hi; ++i) {
+        REBLEN j;
+        for (j = i; j > lo and Sort_Less(s, j, j - 1); --j)
+            Sort_Swap(s, j, j - 1);
+
+        moves += i - j;
+        if (moves > SORT_PARTIAL_LIMIT)
+            return false;
+    }
+    return true;
+}
+
+
+static void Sift_Down(struct Reb_Sorter *s, REBLEN lo, REBLEN root, REBLEN n)
+{
+    while (true) {
+        REBLEN child = 2 * root + 1;
+        if (child >= n)
+            return;
+        if (child + 1 < n and Sort_Less(s, lo + child, lo + child + 1))
+            ++child;
+        if (not Sort_Less(s, lo + root, lo + child))
+            return;
+        Sort_Swap(s, lo + root, lo + child);
+        root = child;
+    }
+}
+
+
+static void Heap_Sort(struct Reb_Sorter *s, REBLEN lo, REBLEN hi)
+{
+    REBLEN n = hi - lo;
+    REBLEN i;
+    for (i = n / 2; i-- > 0; )
+        Sift_Down(s, lo, i, n);
+    for (i = n; i-- > 1; ) {
+        Sort_Swap(s, lo, lo + i);
+        Sift_Down(s, lo, 0, i);
+    }
+}
+
+
+// Partition [lo + 1, hi) around the pivot at `lo`, with items equal to the
+// pivot going to the right.  Gives back the pivot's final position, and says
+// if no items had to be swapped (hinting the range may already be sorted).
+//
+static REBLEN Partition_Right(
+    bool *already_partitioned,
+    struct Reb_Sorter *s,
+    REBLEN lo,
+    REBLEN hi
+){
+    REBLEN first = lo + 1;
+    while (first < hi and Sort_Less(s, first, lo))
+        ++first;
+
+    REBLEN last = hi;  // the candidate for swapping is at `last - 1`
+    while (last > first and not Sort_Less(s, last - 1, lo))
+        --last;
+
+    *already_partitioned = (last <= first);
+
+    while (last > first) {  // item at first >= pivot, at last - 1 < pivot
+        Sort_Swap(s, first, last - 1);
+
+        ++first;
+        while (first < hi and Sort_Less(s, first, lo))
+            ++first;
+
+        --last;
+        while (last > first and not Sort_Less(s, last - 1, lo))
+            --last;
+    }
+
+    REBLEN pivot = first - 1;
+    Sort_Swap(s, lo, pivot);
+    return pivot;
+}
+
+
+// Partition [lo + 1, hi) around the pivot at `lo`, with items equal to the
+// pivot going to the left.  This is used when the pivot is equal to the item
+// before the range, so everything to the left of the returned position is
+// the same as the pivot and needs no further sorting.
+//
+static REBLEN Partition_Left(struct Reb_Sorter *s, REBLEN lo, REBLEN hi)
+{
+    REBLEN last = hi;  // the candidate for swapping is at `last - 1`
+    while (last > lo + 1 and Sort_Less(s, lo, last - 1))
+        --last;
+
+    REBLEN first = lo + 1;
+    while (first < last and not Sort_Less(s, lo, first))
+        ++first;
+
+    while (first < last) {  // item at first > pivot, at last - 1 <= pivot
+        Sort_Swap(s, first, last - 1);
+
+        --last;
+        while (last > first and Sort_Less(s, lo, last - 1))
+            --last;
+
+        ++first;
+        while (first < last and not Sort_Less(s, lo, first))
+            ++first;
+    }
+
+    REBLEN pivot = last - 1;
+    Sort_Swap(s, lo, pivot);
+    return pivot;
+}
+
+
+static void Pdq_Sort_Loop(
+    struct Reb_Sorter *s,
+    REBLEN lo,
+    REBLEN hi,
+    REBLEN bad_allowed,
+    bool leftmost  // if not, the item at `lo - 1` is <= all items in range
+){
+    while (true) {
+        REBLEN size = hi - lo;
+        if (size < SORT_INSERTION_MAX) {
+            Insertion_Sort(s, lo, hi);
+            return;
+        }
+
+        REBLEN half = size / 2;  // put the pivot at `lo`
+        if (size > SORT_NINTHER_MIN) {
+            Sort3(s, lo, lo + half, hi - 1);
+            Sort3(s, lo + 1, lo + half - 1, hi - 2);
+            Sort3(s, lo + 2, lo + half + 1, hi - 3);
+            Sort3(s, lo + half - 1, lo + half, lo + half + 1);
+            Sort_Swap(s, lo, lo + half);
+        }
+        else
+            Sort3(s, lo + half, lo, hi - 1);
+
+        if (not leftmost and not Sort_Less(s, lo - 1, lo)) {
+            lo = Partition_Left(s, lo, hi) + 1;  // pivot and left are equal
+            continue;
+        }
+
+        bool already_partitioned;
+        REBLEN pivot = Partition_Right(&already_partitioned, s, lo, hi);
+
+        REBLEN l_size = pivot - lo;
+        REBLEN r_size = hi - (pivot + 1);
+
+        if (l_size < size / 8 or r_size < size / 8) {  // unbalanced
+            if (--bad_allowed == 0) {
+                Heap_Sort(s, lo, hi);
+                return;
+            }
+
+            if (l_size >= SORT_INSERTION_MAX) {
+                REBLEN q = l_size / 4;
+                Sort_Swap(s, lo, lo + q);
+                Sort_Swap(s, pivot - 1, pivot - q);
+                if (l_size > SORT_NINTHER_MIN) {
+                    Sort_Swap(s, lo + 1, lo + q + 1);
+                    Sort_Swap(s, lo + 2, lo + q + 2);
+                    Sort_Swap(s, pivot - 2, pivot - q - 1);
+                    Sort_Swap(s, pivot - 3, pivot - q - 2);
+                }
+            }
+
+            if (r_size >= SORT_INSERTION_MAX) {
+                REBLEN q = r_size / 4;
+                Sort_Swap(s, pivot + 1, pivot + 1 + q);
+                Sort_Swap(s, hi - 1, hi - q);
+                if (r_size > SORT_NINTHER_MIN) {
+                    Sort_Swap(s, pivot + 2, pivot + 2 + q);
+                    Sort_Swap(s, pivot + 3, pivot + 3 + q);
+                    Sort_Swap(s, hi - 2, hi - q - 1);
+                    Sort_Swap(s, hi - 3, hi - q - 2);
+                }
+            }
+        }
+        else if (
+            already_partitioned
+            and Partial_Insertion_Sort(s, lo, pivot)
+            and Partial_Insertion_Sort(s, pivot + 1, hi)
+        ){
+            return;
+        }
+
+        Pdq_Sort_Loop(s, lo, pivot, bad_allowed, leftmost);
+        lo = pivot + 1;
+        leftmost = false;
+    }
+}
+
+
+//
+//  Sort_Unstable: C
+//
+// Sort `n` items of `es` bytes each at `base`, in the manner of qsort_r().
+//
+void Sort_Unstable(
+    void *base,
+    REBLEN n,
+    REBSIZ es,
+    void *thunk,
+    cmp_t *cmp
+){
+    if (n < 2)
+        return;
+
+    struct Reb_Sorter s;
+    Init_Sorter(&s, base, es, thunk, cmp);
+
+    REBLEN bad_allowed = 0;  // floor(log2(n)), as in pdqsort
+    REBLEN len;
+    for (len = n; len > 1; len >>= 1)
+        ++bad_allowed;
+
+    Pdq_Sort_Loop(&s, 0, n, bad_allowed, true);
+}
+
+
+// Merge the sorted ranges [lo, mid) and [mid, hi).  The smaller of the two is
+// copied out to the scratch space, and merged back from the end it leaves
+// free.  Ties go to the left range's item, to keep the merge stable.
+//
+static void Merge_Runs(
+    struct Reb_Sorter *s,
+    REBYTE *scratch,
+    REBLEN lo,
+    REBLEN mid,
+    REBLEN hi
+){
+    REBSIZ es = s->es;
+    REBLEN left = mid - lo;
+    REBLEN right = hi - mid;
+
+    if (left <= right) {
+        memcpy(scratch, SORT_ITEM(s, lo), left * es);
+
+        REBLEN i = 0;  // in scratch
+        REBLEN j = mid;
+        REBLEN k = lo;
+        while (i < left and j < hi) {
+            if (s->cmp(s->thunk, SORT_ITEM(s, j), scratch + i * es) < 0)
+                memcpy(SORT_ITEM(s, k), SORT_ITEM(s, j++), es);
+            else
+                memcpy(SORT_ITEM(s, k), scratch + (i++) * es, es);
+            ++k;
+        }
+        memcpy(SORT_ITEM(s, k), scratch + i * es, (left - i) * es);
+    }
+    else {
+        memcpy(scratch, SORT_ITEM(s, mid), right * es);
+
+        REBLEN i = right;  // in scratch, one past the next item to place
+        REBLEN j = mid;
+        REBLEN k = hi;
+        while (i > 0 and j > lo) {
+            const REBYTE *item = scratch + (i - 1) * es;
+            if (s->cmp(s->thunk, item, SORT_ITEM(s, j - 1)) < 0)
+                memcpy(SORT_ITEM(s, --k), SORT_ITEM(s, --j), es);
+            else
+                memcpy(SORT_ITEM(s, --k), scratch + (--i) * es, es);
+        }
+        memcpy(SORT_ITEM(s, lo), scratch, i * es);
+    }
+}
+
+
+//
+//  Sort_Stable: C
+//
+// Sort `n` items of `es` bytes each at `base`, keeping items that compare as
+// equal in their original order.  The caller provides `scratch` space for at
+// least `n / 2` items.
+//
+void Sort_Stable(
+    void *base,
+    REBLEN n,
+    REBSIZ es,
+    void *scratch,
+    void *thunk,
+    cmp_t *cmp
+){
+    if (n < 2)
+        return;
+
+    struct Reb_Sorter s;
+    Init_Sorter(&s, base, es, thunk, cmp);
+
+    REBLEN i = 1;  // strictly descending input can just be reversed
+    while (i < n and Sort_Less(&s, i, i - 1))
+        ++i;
+    if (i == n) {
+        REBLEN lo = 0;
+        REBLEN hi = n - 1;
+        for (; lo < hi; ++lo, --hi)
+            Sort_Swap(&s, lo, hi);
+        return;
+    }
+
+    REBLEN lo;
+    for (lo = 0; lo < n; lo += SORT_RUN_LEN)
+        Insertion_Sort(&s, lo, MIN(lo + SORT_RUN_LEN, n));
+
+    REBLEN width;
+    for (width = SORT_RUN_LEN; width < n; width *= 2) {
+        for (lo = 0; lo + width < n; lo += 2 * width) {
+            REBLEN mid = lo + width;
+            REBLEN hi = MIN(mid + width, n);
+            if (Sort_Less(&s, mid, mid - 1))  // else runs already in order
+                Merge_Runs(&s, cast(REBYTE*, scratch), lo, mid, hi);
+        }
+    }
+}
+
+
+//=//// RADIX SORT ////////////////////////////////////////////////////////=//
+//
+// Comparison sorts need O(N log N) comparisons, each a function call.  When
+// keys can be mapped to unsigned 64-bit integers that order the same way (as
+// INTEGER!s can by flipping the sign bit, or fixed-width BINARY!s by taking
+// 8 bytes at a time as big-endian numbers), an LSD radix sort does at most
+// eight linear passes instead.  Bytes that are the same in all the keys are
+// noticed in the counting pass, and skipped.
+//
+// The keys are sorted along with an array of indices, so the caller can then
+// move its own records (cells, vector elements...) into the sorted order.
+//
+
+#define RADIX_BYTES 8  // an LSD pass per byte in a uint64_t
+#define RADIX_BUCKETS 256
+
+
+//
+//  Radix_Sort_U64: C
+//
+// Sort `n` keys ascending, applying the same moves to `indices` if it is not
+// nullptr.  This is a stable sort.  Gives back false if the temporary buffers
+// can't be allocated, in which case nothing was changed.
+//
+bool Radix_Sort_U64(uint64_t *keys, REBLEN *indices, REBLEN n)
+{
+    if (n < 2)
+        return true;
+
+    uint64_t *keys_temp = TRY_ALLOC_N(uint64_t, n);
+    if (keys_temp == nullptr)
+        return false;
+
+    REBLEN *indices_temp = nullptr;
+    if (indices) {
+        indices_temp = TRY_ALLOC_N(REBLEN, n);
+        if (indices_temp == nullptr) {
+            FREE_N(uint64_t, n, keys_temp);
+            return false;
+        }
+    }
+
+    REBLEN counts[RADIX_BYTES][RADIX_BUCKETS];
+    memset(counts, 0, sizeof(counts));
+
+    REBLEN i;
+    for (i = 0; i < n; ++i) {
+        uint64_t key = keys[i];
+        REBLEN b;
+        for (b = 0; b < RADIX_BYTES; ++b, key >>= 8)
+            ++counts[b][key & 0xFF];
+    }
+
+    uint64_t *from_keys = keys;
+    uint64_t *to_keys = keys_temp;
+    REBLEN *from_indices = indices;
+    REBLEN *to_indices = indices_temp;
+
+    REBLEN b;
+    for (b = 0; b < RADIX_BYTES; ++b) {
+        REBLEN shift = b * 8;
+        REBLEN *pos = counts[b];
+        if (pos[(from_keys[0] >> shift) & 0xFF] == n)
+            continue;  // all keys have the same byte here, pass is a no-op
+
+        REBLEN sum = 0;
+        REBLEN d;
+        for (d = 0; d < RADIX_BUCKETS; ++d) {  // counts become positions
+            REBLEN count = pos[d];
+            pos[d] = sum;
+            sum += count;
+        }
+
+        for (i = 0; i < n; ++i) {
+            uint64_t key = from_keys[i];
+            REBLEN at = pos[(key >> shift) & 0xFF]++;
+            to_keys[at] = key;
+            if (indices)
+                to_indices[at] = from_indices[i];
+        }
+
+        uint64_t *temp_keys = from_keys;
+        from_keys = to_keys;
+        to_keys = temp_keys;
+
+        REBLEN *temp_indices = from_indices;
+        from_indices = to_indices;
+        to_indices = temp_indices;
+    }
+
+    if (from_keys != keys) {  // odd number of passes were done
+        memcpy(keys, from_keys, sizeof(uint64_t) * n);
+        if (indices)
+            memcpy(indices, from_indices, sizeof(REBLEN) * n);
+    }
+
+    FREE_N(uint64_t, n, keys_temp);
+    if (indices)
+        FREE_N(REBLEN, n, indices_temp);
+    return true;
+}
+
+
+//=//// PARALLEL SORT /////////////////////////////////////////////////////=//
+//
+// SORT/THREADS splits the items into a chunk per thread, which are sorted at
+// the same time (each with Sort_Unstable() or Sort_Stable()).  The sorted
+// chunks are then merged pairwise, each round of merges also being done in
+// parallel, ping-ponging between the array and a scratch buffer.  Merging
+// adjacent runs with ties going to the left keeps a stable sort stable.
+//
+// Only comparators that are pure functions of the bits in the items may be
+// used: they must not allocate, fail(), or run the evaluator.  (So there is
+// no GC during the sort, and it doesn't matter that items are duplicated or
+// absent in the array while they are being merged through the scratch.)
+//
+
+struct Reb_Sort_Job {
+    REBYTE *from;  // chunks being sorted, or runs being merged
+    REBYTE *to;  // where merge results go (for sorts, the scratch space)
+    REBLEN lo;
+    REBLEN mid;  // 0 if the job is to sort [lo, hi) in place
+    REBLEN hi;
+    REBSIZ es;
+    void *thunk;
+    cmp_t *cmp;
+    bool stable;
+};
+
+
+static void Run_Sort_Job(struct Reb_Sort_Job *job)
+{
+    REBSIZ es = job->es;
+
+    if (job->mid == 0) {
+        REBYTE *at = job->from + job->lo * es;
+        REBLEN n = job->hi - job->lo;
+        if (job->stable) {
+            REBYTE *scratch = job->to + job->lo * es;
+            Sort_Stable(at, n, es, scratch, job->thunk, job->cmp);
+        }
+        else
+            Sort_Unstable(at, n, es, job->thunk, job->cmp);
+        return;
+    }
+
+    const REBYTE *left = job->from + job->lo * es;
+    const REBYTE *left_tail = job->from + job->mid * es;
+    const REBYTE *right = left_tail;
+    const REBYTE *right_tail = job->from + job->hi * es;
+    REBYTE *out = job->to + job->lo * es;
+
+    while (left != left_tail and right != right_tail) {
+        if (job->cmp(job->thunk, right, left) < 0) {
+            memcpy(out, right, es);
+            right += es;
+        }
+        else {
+            memcpy(out, left, es);
+            left += es;
+        }
+        out += es;
+    }
+    memcpy(out, left, left_tail - left);
+    out += left_tail - left;
+    memcpy(out, right, right_tail - right);
+}
+
+
+#ifdef PARALLEL_SORT
+
+static void *Sort_Job_Thread(void *job)
+{
+    Run_Sort_Job(cast(struct Reb_Sort_Job*, job));
+    return nullptr;
+}
+
+#endif
+
+
+// Run the jobs, each on its own thread (except the first, which runs on the
+// calling thread).  If a thread can't be started, its job runs here instead.
+//
+static void Run_Sort_Jobs(struct Reb_Sort_Job *jobs, REBLEN num_jobs)
+{
+  #ifdef PARALLEL_SORT
+    pthread_t threads[MAX_SORT_THREADS];
+    bool started[MAX_SORT_THREADS];
+
+    REBLEN i;
+    for (i = 1; i < num_jobs; ++i) {
+        int err = pthread_create(
+            &threads[i], nullptr, &Sort_Job_Thread, &jobs[i]
+        );
+        started[i] = (err == 0);
+    }
+
+    Run_Sort_Job(&jobs[0]);
+
+    for (i = 1; i < num_jobs; ++i) {
+        if (started[i])
+            pthread_join(threads[i], nullptr);
+        else
+            Run_Sort_Job(&jobs[i]);
+    }
+  #else
+    REBLEN i;
+    for (i = 0; i < num_jobs; ++i)
+        Run_Sort_Job(&jobs[i]);
+  #endif
+}
+
+
+//
+//  Sort_Parallel: C
+//
+// Sort `n` items of `es` bytes at `base` using up to `threads` threads.  The
+// `scratch` space must have room for all `n` items.  In builds without
+// PARALLEL_SORT, the same chunking and merging is done on one thread.
+//
+void Sort_Parallel(
+    void *base,
+    REBLEN n,
+    REBSIZ es,
+    void *scratch,
+    void *thunk,
+    cmp_t *cmp,
+    REBLEN threads,
+    bool stable
+){
+    assert(threads >= 1 and threads <= MAX_SORT_THREADS);
+    if (threads > n / 2)
+        threads = n / 2;
+    if (threads < 2) {
+        if (stable)
+            Sort_Stable(base, n, es, scratch, thunk, cmp);
+        else
+            Sort_Unstable(base, n, es, thunk, cmp);
+        return;
+    }
+
+    struct Reb_Sort_Job jobs[MAX_SORT_THREADS];
+    REBLEN bounds[MAX_SORT_THREADS + 1];  // run i is [bounds[i], bounds[i+1])
+
+    REBLEN runs = threads;
+    REBLEN i;
+    for (i = 0; i <= runs; ++i)
+        bounds[i] = cast(REBLEN, (cast(uint64_t, n) * i) / runs);
+
+    for (i = 0; i < runs; ++i) {
+        struct Reb_Sort_Job *job = &jobs[i];
+        job->from = cast(REBYTE*, base);
+        job->to = cast(REBYTE*, scratch);  // merge sort's space, if stable
+        job->lo = bounds[i];
+        job->mid = 0;
+        job->hi = bounds[i + 1];
+        job->es = es;
+        job->thunk = thunk;
+        job->cmp = cmp;
+        job->stable = stable;
+    }
+    Run_Sort_Jobs(jobs, runs);
+
+    REBYTE *from = cast(REBYTE*, base);
+    REBYTE *to = cast(REBYTE*, scratch);
+
+    while (runs > 1) {
+        REBLEN num_jobs = 0;
+        for (i = 0; i + 1 < runs; i += 2) {
+            struct Reb_Sort_Job *job = &jobs[num_jobs++];
+            job->from = from;
+            job->to = to;
+            job->lo = bounds[i];
+            job->mid = bounds[i + 1];
+            job->hi = bounds[i + 2];
+        }
+        Run_Sort_Jobs(jobs, num_jobs);
+
+        if (runs % 2 == 1) {  // odd run out is carried over as-is
+            REBLEN lo = bounds[runs - 1];
+            memcpy(to + lo * es, from + lo * es, (n - lo) * es);
+        }
+
+        REBLEN new_runs = 0;  // every other boundary is merged away
+        for (i = 0; i < runs; i += 2)
+            bounds[new_runs++] = bounds[i];
+        bounds[new_runs] = n;
+        runs = new_runs;
+
+        REBYTE *temp = from;
+        from = to;
+        to = temp;
+    }
+
+    if (from != base)
+        memcpy(base, from, n * es);
+}
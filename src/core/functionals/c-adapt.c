@@ -58,44 +58,56 @@ enum {
 // Each time a function created with ADAPT is executed, this code runs to
 // invoke the "prelude" before passing control to the "adaptee" function.
 //
+// If the adaptee is itself an adaptation (e.g. an ADAPT of an ADAPT, as
+// layered APIs build up) then its prelude is run here too, in a loop, rather
+// than going back through the evaluator to redo the frame once per layer.
+// All the layers have the same interface, so they share the frame as-is.
+// The arguments are then typechecked once, when the final adaptee is run.
+// The dispatcher is checked on each call (not cached at creation time) so a
+// HIJACK of an inner adaptation is still heeded.
+//
 REB_R Adapter_Dispatcher(REBFRM *f)
 {
-    REBARR *details = ACT_DETAILS(FRM_PHASE(f));
-    assert(ARR_LEN(details) == IDX_ADAPTER_MAX);
+    while (true) {
+        REBARR *details = ACT_DETAILS(FRM_PHASE(f));
+        assert(ARR_LEN(details) == IDX_ADAPTER_MAX);
 
-    // The first thing to do is run the prelude code, which may throw.  If it
-    // does throw--including a RETURN--that means the adapted function will
-    // not be run.
-    //
-    // Note that Interpreted_Dispatch...() is what sets the function's RETURN
-    // slot to a returner function that knows what frame to return from.
-    // So simply DO-ing the array wouldn't have that effect.
+        // The first thing to do is run the prelude code, which may throw.  If
+        // it does throw--including a RETURN--that means the adapted function
+        // will not be run.
+        //
+        // Note that Interpreted_Dispatch...() is what sets the function's
+        // RETURN slot to a returner function that knows what frame to return
+        // from.  So simply DO-ing the array wouldn't have that effect.
 
-    REBVAL *discarded = FRM_SPARE(f);
+        REBVAL *discarded = FRM_SPARE(f);
 
-    assert(IDX_ADAPTER_PRELUDE == IDX_DETAILS_1);  // same as interpreted body
+        assert(IDX_ADAPTER_PRELUDE == IDX_DETAILS_1);  // as interpreted body
 
-    bool returned;
-    if (Interpreted_Dispatch_Details_1_Throws(&returned, discarded, f)) {
-        Move_Cell(f->out, discarded);
-        return R_THROWN;
-    }
+        bool returned;
+        if (Interpreted_Dispatch_Details_1_Throws(&returned, discarded, f)) {
+            Move_Cell(f->out, discarded);
+            return R_THROWN;
+        }
 
-    if (returned) {
-        if (IS_ENDISH_NULLED(discarded))
-            return f->out;
-        return Move_Cell(f->out, discarded);
-    }
+        if (returned) {
+            if (IS_ENDISH_NULLED(discarded))
+                return f->out;
+            return Move_Cell(f->out, discarded);
+        }
 
-    // The second thing to do is update the phase and binding to run the
-    // function that is being adapted, and pass it to the evaluator to redo.
+        // The second thing to do is update the phase and binding to run the
+        // function that is being adapted, and pass it to the evaluator to
+        // redo...unless it's another adaptation, whose prelude is run next.
 
-    REBVAL* adaptee = DETAILS_AT(details, IDX_ADAPTER_ADAPTEE);
+        REBVAL* adaptee = DETAILS_AT(details, IDX_ADAPTER_ADAPTEE);
 
-    INIT_FRM_PHASE(f, VAL_ACTION(adaptee));
-    INIT_FRM_BINDING(f, VAL_ACTION_BINDING(adaptee));
+        INIT_FRM_PHASE(f, VAL_ACTION(adaptee));
+        INIT_FRM_BINDING(f, VAL_ACTION_BINDING(adaptee));
 
-    return R_REDO_CHECKED;  // the redo will use the updated phase & binding
+        if (ACT_DISPATCHER(VAL_ACTION(adaptee)) != &Adapter_Dispatcher)
+            return R_REDO_CHECKED;  // the redo uses updated phase & binding
+    }
 }
 
 
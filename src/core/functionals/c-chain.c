@@ -43,6 +43,11 @@ enum {
     IDX_CHAINER_MAX
 };
 
+// How deeply CHAINs inside a CHAIN's pipeline are run by one dispatcher (see
+// Chainer_Dispatcher()).  Deeper ones just get their own frame, as usual.
+//
+#define MAX_FLATTENED_CHAINS 8
+
 
 //
 //  Push_Downshifted_Frame: C
@@ -87,6 +92,48 @@ REBFRM *Push_Downshifted_Frame(REBVAL *out, REBFRM *f) {
 }
 
 
+//
+//  Enter_Nested_Chains: C
+//
+// If the pipeline step at `*chained` is itself a CHAIN, then running it in
+// a frame of its own would just run its steps in turn.  So instead, resume
+// points are noted and the inner pipeline is walked directly, continuing
+// into further-nested chains.  This makes a composition of chains cost the
+// same per call as a single chain with all the steps.
+//
+// The dispatcher is checked for each call, rather than merging pipelines
+// when the chain is made.  That way a HIJACK of an inner chain is heeded.
+// (The pipelines are frozen, and kept alive by the outermost chain's
+// details, so the pointers into them are stable.)
+//
+static void Enter_Nested_Chains(
+    const RELVAL **chained,
+    const RELVAL **chained_tail,
+    const RELVAL **resume,  // MAX_FLATTENED_CHAINS positions to pick up at
+    const RELVAL **resume_tail,
+    REBLEN *depth
+){
+    while (
+        *depth < MAX_FLATTENED_CHAINS
+        and ACT_DISPATCHER(VAL_ACTION(*chained)) == &Chainer_Dispatcher
+    ){
+        REBARR *details = ACT_DETAILS(VAL_ACTION(*chained));
+        const REBARR *pipeline = VAL_ARRAY(
+            ARR_AT(details, IDX_CHAINER_PIPELINE)
+        );
+        if (ARR_LEN(pipeline) == 0)
+            return;
+
+        resume[*depth] = *chained + 1;
+        resume_tail[*depth] = *chained_tail;
+        ++(*depth);
+
+        *chained = ARR_HEAD(pipeline);
+        *chained_tail = ARR_TAIL(pipeline);
+    }
+}
+
+
 //
 //  Chainer_Dispatcher: C
 //
@@ -115,6 +162,11 @@ REBFRM *Push_Downshifted_Frame(REBVAL *out, REBFRM *f) {
 // of the chain leaves the actual chainer frame with no varlist content.  That
 // means debuggers introspecting the stack may see a "stolen" frame state.
 //
+// Steps that are CHAINs themselves are not given frames of their own, their
+// steps are run in this frame instead (see Enter_Nested_Chains()).  If the
+// head of the chain is a chain, its head has the same interface, so the
+// frame that was built is good for it.
+//
 REB_R Chainer_Dispatcher(REBFRM *f)
 {
     REBARR *details = ACT_DETAILS(FRM_PHASE(f));
@@ -124,6 +176,13 @@ REB_R Chainer_Dispatcher(REBFRM *f)
     const RELVAL *chained_tail = ARR_TAIL(pipeline);
     const RELVAL *chained = ARR_HEAD(pipeline);
 
+    const RELVAL *resume[MAX_FLATTENED_CHAINS];
+    const RELVAL *resume_tail[MAX_FLATTENED_CHAINS];
+    REBLEN depth = 0;
+    Enter_Nested_Chains(
+        &chained, &chained_tail, resume, resume_tail, &depth
+    );
+
     Init_Unset(FRM_SPARE(f));
     REBFRM *sub = Push_Downshifted_Frame(FRM_SPARE(f), f);
 
@@ -158,9 +217,18 @@ REB_R Chainer_Dispatcher(REBFRM *f)
         // incompatible with the next chain step.
 
         ++chained;
+        while (chained == chained_tail and depth != 0) {  // end of a nested
+            --depth;
+            chained = resume[depth];
+            chained_tail = resume_tail[depth];
+        }
         if (chained == chained_tail)
             break;
 
+        Enter_Nested_Chains(
+            &chained, &chained_tail, resume, resume_tail, &depth
+        );
+
         Push_Action(sub, VAL_ACTION(chained), VAL_ACTION_BINDING(chained));
 
         // We use the same mechanism as enfix operations do...give the
@@ -83,7 +83,11 @@ void Splice_Block_Into_Feed(REBFED *feed, const REBVAL *splice) {
     // !!! See remarks above about this per-feed hold logic that should be
     // per-splice hold logic.  Pending whole system review of iteration.
     //
-    if (NOT_END(feed->value) and NOT_SERIES_INFO(FEED_ARRAY(feed), HOLD)) {
+    if (
+        NOT_END(feed->value)
+        and NOT_SERIES_INFO(FEED_ARRAY(feed), HOLD)
+        and NOT_SERIES_INFO(FEED_ARRAY(feed), FROZEN_DEEP)  // can't change
+    ){
         SET_SERIES_INFO(m_cast(REBARR*, FEED_ARRAY(feed)), HOLD);
         SET_FEED_FLAG(feed, TOOK_HOLD);
     }
@@ -207,6 +211,18 @@ bool Cache_Predicate_Throws(
         fail ("Predicates must be TUPLE! that starts with BLANK!");
 
     const RELVAL *second = VAL_SEQUENCE_AT(store, predicate, 1);
+    if (IS_WORD(second) and VAL_SEQUENCE_LEN(predicate) == 2) {
+        //
+        // A TYPECHECKER (e.g. `.integer?`) is fetched now, so callers can
+        // use Did_Typecheck_Without_Frame() instead of calling it.
+        //
+        const REBVAL *var = try_unwrap(
+            Lookup_Word(second, VAL_SEQUENCE_SPECIFIER(predicate))
+        );
+        if (var and IS_ACTION(var) and Is_Typechecker(VAL_ACTION(var)))
+            Copy_Cell(predicate, var);
+        return false;
+    }
     if (not IS_GROUP(second))
         return false;
 
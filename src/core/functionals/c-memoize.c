@@ -0,0 +1,571 @@
+//
+//  File: %c-memoize.c
+//  Summary: "Function generator for caching the results of an action"
+//  Section: datatypes
+//  Project: "Ren-C Language Interpreter and Run-time Environment"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the GNU Lesser General Public License (LGPL), Version 3.0.
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// MEMOIZE makes a function with the same interface as the one it's given,
+// which remembers the results of calls and gives them back when it's called
+// again with the same arguments:
+//
+//     >> fib: memoize func [n] [if n < 2 [n] else [(fib n - 1) + (fib n - 2)]]
+//
+//     >> fib 80  ; would take ages without the cache
+//     == 23416728348467685
+//
+// Arguments are matched as by STRICT-EQUAL?, with the lookup and insertion
+// done in C instead of a usermode MAP!.  The number of results kept is
+// bounded (least recently used results are dropped first), and they can
+// be given a time to live.  MEMO-STATS reports on how well the cache does.
+//
+// Like the keys in a MAP!, series arguments are frozen when a result is
+// cached for them, since changing them would make the cache wrong.  Series
+// results are frozen too, as every caller gets the same one.  Arguments
+// with an identity (objects, maps, actions) are looked up by that identity.
+// Calls with arguments that can't be hashed (e.g. BITSET!) just run the
+// action.
+//
+// !!! Actions with output parameters (multiple return values) are not
+// supported, as a cached result would not set the output variables.
+//
+
+#include "sys-core.h"
+
+enum {
+    IDX_MEMOIZER_ACTION = 1,  // The ACTION! whose results are cached
+    IDX_MEMOIZER_ENTRIES,  // BLOCK! of arguments and result for each entry
+    IDX_MEMOIZER_TABLE,  // BINARY! with the Reb_Memo_Table for the entries
+    IDX_MEMOIZER_MAX
+};
+
+#define MEMO_DEFAULT_SIZE 256
+
+#define MEMO_NONE cast(REBLEN, -1)  // no entry, for links and lookups
+
+
+// Each entry in the cache is a run of cells in the entries BLOCK!, with the
+// arguments and then the result.  They're isotopically quoted, so nulls and
+// isotopes can be stored in an array.  The C-side bookkeeping is here:
+//
+struct Reb_Memo_Entry {
+    uint32_t hash;
+    REBLEN next;  // next entry in the same bucket (or the free list)
+    REBLEN newer;  // for least recently used ordering
+    REBLEN older;
+    REBI64 time;  // when the result was cached, if there is a TTL
+};
+
+// The table is kept in a BINARY! in the details, so the GC manages its memory
+// with the action's.  The entries and the hash buckets follow it.
+//
+struct Reb_Memo_Table {
+    REBLEN capacity;  // most entries kept
+    REBLEN num_args;  // arguments in each entry (the result comes after)
+    REBLEN num_buckets;  // a prime, for the modulus of the hash
+    REBLEN count;  // entries in use
+    REBLEN used;  // entries ever filled (the ones past this are untouched)
+    REBLEN free;  // entries emptied by TTL expiry, linked through `next`
+    REBLEN newest;
+    REBLEN oldest;
+
+    REBI64 ttl;  // nanoseconds that a result is good for, 0 if no limit
+
+    REBI64 hits;
+    REBI64 misses;
+    REBI64 evictions;  // entries dropped for being least recently used
+    REBI64 expirations;  // entries dropped for being older than the TTL
+    REBI64 uncached;  // calls with arguments that couldn't be hashed
+};
+
+inline static struct Reb_Memo_Entry *MEMO_ENTRIES(struct Reb_Memo_Table *t)
+  { return cast(struct Reb_Memo_Entry*, t + 1); }
+
+inline static REBLEN *MEMO_BUCKETS(struct Reb_Memo_Table *t)
+  { return cast(REBLEN*, MEMO_ENTRIES(t) + t->capacity); }
+
+inline static RELVAL *MEMO_ENTRY_CELLS(
+    struct Reb_Memo_Table *t,
+    REBARR *entries,
+    REBLEN n
+){
+    return ARR_AT(entries, n * (t->num_args + 1));
+}
+
+
+// RETURN isn't an argument, and hidden parameters (locals, specializations)
+// are the same on every call.
+//
+inline static bool Is_Memo_Param(const REBPAR *param) {
+    if (Is_Param_Hidden(param))
+        return false;
+    return VAL_PARAM_CLASS(param) != REB_P_RETURN;
+}
+
+
+//
+//  Hash_Memo_Args: C
+//
+// Gives false if any of the (isotopically quoted) arguments are of a type
+// that can't be hashed, or compared with Cmp_Value().
+//
+static bool Hash_Memo_Args(
+    uint32_t *hash_out,
+    const RELVAL *args,
+    REBLEN num_args
+){
+    uint32_t hash = num_args;
+
+    REBLEN i;
+    for (i = 0; i < num_args; ++i) {
+        const RELVAL *arg = args + i;
+        uint32_t h;
+        switch (CELL_KIND(VAL_UNESCAPED(arg))) {
+          case REB_NULL:
+            h = VAL_NUM_QUOTES(arg);
+            break;
+
+          case REB_BLANK:
+          case REB_BAD_WORD:
+          case REB_LOGIC:
+          case REB_INTEGER:
+          case REB_DECIMAL:
+          case REB_PERCENT:
+          case REB_MONEY:
+          case REB_PAIR:
+          case REB_TIME:
+          case REB_DATE:
+          case REB_BINARY:
+          case REB_TEXT:
+          case REB_FILE:
+          case REB_EMAIL:
+          case REB_URL:
+          case REB_TAG:
+          case REB_ISSUE:
+          case REB_BLOCK:
+          case REB_GROUP:
+          case REB_PATH:
+          case REB_TUPLE:
+          case REB_WORD:
+          case REB_SET_WORD:
+          case REB_GET_WORD:
+          case REB_META_WORD:
+          case REB_DATATYPE:
+          case REB_ACTION:
+          case REB_OBJECT:
+          case REB_MODULE:
+          case REB_ERROR:
+          case REB_PORT:
+          case REB_MAP:
+            h = Hash_Value(arg);
+            break;
+
+          default:
+            return false;
+        }
+        hash = ((hash << 5) | (hash >> 27)) ^ h;
+    }
+
+    *hash_out = hash;
+    return true;
+}
+
+
+//
+//  Find_Memo_Entry: C
+//
+static REBLEN Find_Memo_Entry(
+    struct Reb_Memo_Table *t,
+    REBARR *entries,
+    uint32_t hash,
+    const RELVAL *args
+){
+    struct Reb_Memo_Entry *e = MEMO_ENTRIES(t);
+
+    REBLEN n = MEMO_BUCKETS(t)[hash % t->num_buckets];
+    for (; n != MEMO_NONE; n = e[n].next) {
+        if (e[n].hash != hash)
+            continue;
+
+        const RELVAL *stored = MEMO_ENTRY_CELLS(t, entries, n);
+        REBLEN i;
+        for (i = 0; i < t->num_args; ++i) {
+            if (Cmp_Value(stored + i, args + i, true) != 0)
+                break;
+        }
+        if (i == t->num_args)
+            return n;
+    }
+    return MEMO_NONE;
+}
+
+
+static void Unlink_Memo_Lru(struct Reb_Memo_Table *t, REBLEN n)
+{
+    struct Reb_Memo_Entry *e = MEMO_ENTRIES(t);
+
+    if (e[n].newer == MEMO_NONE)
+        t->newest = e[n].older;
+    else
+        e[e[n].newer].older = e[n].older;
+
+    if (e[n].older == MEMO_NONE)
+        t->oldest = e[n].newer;
+    else
+        e[e[n].older].newer = e[n].newer;
+}
+
+
+static void Link_Memo_Newest(struct Reb_Memo_Table *t, REBLEN n)
+{
+    struct Reb_Memo_Entry *e = MEMO_ENTRIES(t);
+
+    e[n].newer = MEMO_NONE;
+    e[n].older = t->newest;
+    if (t->newest == MEMO_NONE)
+        t->oldest = n;
+    else
+        e[t->newest].newer = n;
+    t->newest = n;
+}
+
+
+//
+//  Remove_Memo_Entry: C
+//
+// Takes the entry out of its bucket and the LRU order.  The cells are blanked
+// so the GC can free what they referred to.
+//
+static void Remove_Memo_Entry(
+    struct Reb_Memo_Table *t,
+    REBARR *entries,
+    REBLEN n
+){
+    struct Reb_Memo_Entry *e = MEMO_ENTRIES(t);
+
+    REBLEN *link = &MEMO_BUCKETS(t)[e[n].hash % t->num_buckets];
+    while (*link != n)
+        link = &e[*link].next;
+    *link = e[n].next;
+
+    Unlink_Memo_Lru(t, n);
+    --t->count;
+
+    RELVAL *cell = MEMO_ENTRY_CELLS(t, entries, n);
+    REBLEN i;
+    for (i = 0; i <= t->num_args; ++i)
+        Init_Blank(cell + i);
+}
+
+
+//
+//  Cache_Memo_Result: C
+//
+// Store the result for the arguments, making an entry for them if there isn't
+// one already (a recursive call may have made one while the action ran).
+//
+static void Cache_Memo_Result(
+    struct Reb_Memo_Table *t,
+    REBARR *entries,
+    uint32_t hash,
+    const RELVAL *args,
+    const REBVAL *result
+){
+    struct Reb_Memo_Entry *e = MEMO_ENTRIES(t);
+
+    GC_Write_Barrier(entries);  // args and result may be younger than it
+
+    REBLEN n = Find_Memo_Entry(t, entries, hash, args);
+    if (n != MEMO_NONE)
+        Unlink_Memo_Lru(t, n);
+    else {
+        if (t->free != MEMO_NONE) {
+            n = t->free;
+            t->free = e[n].next;
+        }
+        else if (t->used < t->capacity)
+            n = t->used++;
+        else {
+            n = t->oldest;
+            Remove_Memo_Entry(t, entries, n);
+            ++t->evictions;
+        }
+
+        RELVAL *cell = MEMO_ENTRY_CELLS(t, entries, n);
+        REBLEN i;
+        for (i = 0; i < t->num_args; ++i) {
+            Copy_Cell(cell + i, args + i);
+            if (ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(cell + i))))
+                Force_Value_Frozen_Deep_Blame(cell + i, entries);
+        }
+
+        REBLEN *bucket = &MEMO_BUCKETS(t)[hash % t->num_buckets];
+        e[n].hash = hash;
+        e[n].next = *bucket;
+        *bucket = n;
+        ++t->count;
+    }
+
+    RELVAL *stored = MEMO_ENTRY_CELLS(t, entries, n) + t->num_args;
+    Copy_Cell(stored, result);
+    Isotopic_Quote(stored);
+    if (ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(stored))))
+        Force_Value_Frozen_Deep_Blame(stored, entries);
+
+    if (t->ttl != 0)
+        e[n].time = Startup_Clock_Nanoseconds();
+    Link_Memo_Newest(t, n);
+}
+
+
+//
+//  Memoizer_Dispatcher: C
+//
+// The frame was built for the memoized action (same interface), so its
+// arguments are pushed to the data stack and looked up.  If there's no result
+// cached for them, the action is run in a frame of its own (the varlist is
+// moved to it, as with CHAIN) so that the result can be stored after.  The
+// pushed arguments are used then, because the action may change its frame.
+//
+REB_R Memoizer_Dispatcher(REBFRM *f)
+{
+    REBARR *details = ACT_DETAILS(FRM_PHASE(f));
+    assert(ARR_LEN(details) == IDX_MEMOIZER_MAX);
+
+    REBVAL *action = DETAILS_AT(details, IDX_MEMOIZER_ACTION);
+    REBARR *entries = VAL_ARRAY_KNOWN_MUTABLE(
+        DETAILS_AT(details, IDX_MEMOIZER_ENTRIES)
+    );
+    struct Reb_Memo_Table *t = cast(
+        struct Reb_Memo_Table*,
+        BIN_HEAD(VAL_BINARY_KNOWN_MUTABLE(
+            DETAILS_AT(details, IDX_MEMOIZER_TABLE)
+        ))
+    );
+
+    REBDSP dsp_orig = DSP;
+
+    const REBKEY *key_tail;
+    const REBKEY *key = ACT_KEYS(&key_tail, FRM_PHASE(f));
+    const REBPAR *param = ACT_PARAMS_HEAD(FRM_PHASE(f));
+    REBVAL *arg = FRM_ARGS_HEAD(f);
+    for (; key != key_tail; ++key, ++param, ++arg) {
+        if (not Is_Memo_Param(param))
+            continue;
+        Copy_Cell(DS_PUSH(), arg);
+        Isotopic_Quote(DS_TOP);  // data stack can't hold nulls or isotopes
+    }
+    assert(DSP - dsp_orig == t->num_args);
+
+    uint32_t hash;
+    if (not Hash_Memo_Args(&hash, DS_AT(dsp_orig + 1), t->num_args)) {
+        ++t->uncached;
+        DS_DROP_TO(dsp_orig);
+
+        INIT_FRM_PHASE(f, VAL_ACTION(action));
+        INIT_FRM_BINDING(f, VAL_ACTION_BINDING(action));
+        return R_REDO_UNCHECKED;  // same interface, so args are checked
+    }
+
+    REBLEN n = Find_Memo_Entry(t, entries, hash, DS_AT(dsp_orig + 1));
+    if (
+        n != MEMO_NONE
+        and t->ttl != 0
+        and Startup_Clock_Nanoseconds() - MEMO_ENTRIES(t)[n].time > t->ttl
+    ){
+        Remove_Memo_Entry(t, entries, n);
+        MEMO_ENTRIES(t)[n].next = t->free;
+        t->free = n;
+        ++t->expirations;
+        n = MEMO_NONE;
+    }
+
+    if (n != MEMO_NONE) {
+        ++t->hits;
+        Unlink_Memo_Lru(t, n);
+        Link_Memo_Newest(t, n);
+        DS_DROP_TO(dsp_orig);
+
+        Copy_Cell(f->out, MEMO_ENTRY_CELLS(t, entries, n) + t->num_args);
+        Isotopic_Unquote(f->out);
+        return f->out;
+    }
+
+    ++t->misses;
+
+    Init_Unset(FRM_SPARE(f));
+    REBFRM *sub = Push_Downshifted_Frame(FRM_SPARE(f), f);
+
+    INIT_FRM_PHASE(sub, VAL_ACTION(action));
+    INIT_FRM_BINDING(sub, VAL_ACTION_BINDING(action));
+
+    sub->original = VAL_ACTION(action);
+    sub->label = VAL_ACTION_LABEL(action);
+  #if !defined(NDEBUG)
+    sub->label_utf8 = sub->label
+        ? STR_UTF8(unwrap(sub->label))
+        : "(anonymous)";
+  #endif
+
+    assert(STATE_BYTE(sub) == ST_ACTION_DISPATCHING);
+    if (Process_Action_Maybe_Stale_Throws(sub)) {
+        Abort_Frame(sub);
+        DS_DROP_TO(dsp_orig);
+        Move_Cell(f->out, sub->out);  // move from spare
+        return R_THROWN;
+    }
+    Drop_Frame(sub);
+
+    // The data stack may have been reallocated while the action ran, so the
+    // arguments are found again.  They may have been changed, too, if the
+    // action modified a series it was passed...so they're hashed again.
+    //
+    const RELVAL *args = DS_AT(dsp_orig + 1);
+    if (Hash_Memo_Args(&hash, args, t->num_args))
+        Cache_Memo_Result(t, entries, hash, args, FRM_SPARE(f));
+
+    DS_DROP_TO(dsp_orig);
+
+    Copy_Cell(f->out, FRM_SPARE(f));
+    return f->out;
+}
+
+
+//
+//  memoize: native [
+//
+//  {Make an ACTION! that caches the results of another, by its arguments}
+//
+//      return: [action!]
+//      action "Function to cache results of (should not have side effects)"
+//          [action!]
+//      /size "Most results to keep, dropping least recently used (def. 256)"
+//          [integer!]
+//      /ttl "How long a result is kept before the action is run again"
+//          [time!]
+//  ]
+//
+REBNATIVE(memoize)
+{
+    INCLUDE_PARAMS_OF_MEMOIZE;
+
+    REBVAL *action = ARG(action);
+    REBACT *act = VAL_ACTION(action);
+
+    REBI64 size = REF(size) ? VAL_INT64(ARG(size)) : MEMO_DEFAULT_SIZE;
+    if (size < 1 or size > INT32_MAX)
+        fail (PAR(size));
+
+    REBI64 ttl = 0;
+    if (REF(ttl)) {
+        ttl = VAL_NANO(ARG(ttl));
+        if (ttl <= 0)
+            fail (PAR(ttl));
+    }
+
+    REBLEN num_args = 0;
+    const REBKEY *key_tail;
+    const REBKEY *key = ACT_KEYS(&key_tail, act);
+    const REBPAR *param = ACT_PARAMS_HEAD(act);
+    for (; key != key_tail; ++key, ++param) {
+        if (not Is_Memo_Param(param))
+            continue;
+        if (VAL_PARAM_CLASS(param) == REB_P_OUTPUT)
+            fail ("MEMOIZE can't cache actions with output parameters");
+        ++num_args;
+    }
+
+    REBACT *memoized = Make_Action(
+        ACT_SPECIALTY(act),  // same interface as the action
+        &Memoizer_Dispatcher,
+        IDX_MEMOIZER_MAX  // details array capacity
+    );
+
+    REBARR *details = ACT_DETAILS(memoized);
+    Copy_Cell(ARR_AT(details, IDX_MEMOIZER_ACTION), action);
+
+    REBLEN num_cells = cast(REBLEN, size) * (num_args + 1);
+    REBARR *entries = Make_Array(num_cells);
+    REBLEN i;
+    for (i = 0; i < num_cells; ++i)
+        Init_Blank(Alloc_Tail_Array(entries));
+    Init_Block(ARR_AT(details, IDX_MEMOIZER_ENTRIES), entries);
+
+    REBLEN num_buckets = Get_Hash_Prime_May_Fail(cast(REBLEN, size));
+    REBSIZ table_size = sizeof(struct Reb_Memo_Table)
+        + size * sizeof(struct Reb_Memo_Entry)
+        + num_buckets * sizeof(REBLEN);
+
+    REBBIN *bin = Make_Binary(table_size);
+    TERM_BIN_LEN(bin, table_size);
+
+    struct Reb_Memo_Table *t = cast(struct Reb_Memo_Table*, BIN_HEAD(bin));
+    memset(t, 0, sizeof(struct Reb_Memo_Table));
+    t->capacity = cast(REBLEN, size);
+    t->num_args = num_args;
+    t->num_buckets = num_buckets;
+    t->free = MEMO_NONE;
+    t->newest = MEMO_NONE;
+    t->oldest = MEMO_NONE;
+    t->ttl = ttl;
+
+    REBLEN *buckets = MEMO_BUCKETS(t);
+    for (i = 0; i < num_buckets; ++i)
+        buckets[i] = MEMO_NONE;
+
+    Init_Binary(ARR_AT(details, IDX_MEMOIZER_TABLE), bin);
+
+    return Init_Action(D_OUT, memoized, VAL_ACTION_LABEL(action), UNBOUND);
+}
+
+
+//
+//  memo-stats: native [
+//
+//  {Statistics for the cache of an action made by MEMOIZE}
+//
+//      return: "NULL if the action was not made by MEMOIZE"
+//          [<opt> object!]
+//      action [action!]
+//  ]
+//
+REBNATIVE(memo_stats)
+{
+    INCLUDE_PARAMS_OF_MEMO_STATS;
+
+    REBACT *act = VAL_ACTION(ARG(action));
+    if (ACT_DISPATCHER(act) != &Memoizer_Dispatcher)
+        return nullptr;
+
+    REBARR *details = ACT_DETAILS(act);
+    struct Reb_Memo_Table *t = cast(
+        struct Reb_Memo_Table*,
+        BIN_HEAD(VAL_BINARY_KNOWN_MUTABLE(
+            DETAILS_AT(details, IDX_MEMOIZER_TABLE)
+        ))
+    );
+
+    return rebValue("make object! [",
+        "size:", rebI(t->count),
+        "capacity:", rebI(t->capacity),
+        "hits:", rebI(t->hits),
+        "misses:", rebI(t->misses),
+        "evictions:", rebI(t->evictions),
+        "expirations:", rebI(t->expirations),
+        "uncached:", rebI(t->uncached),
+    "]");
+}
@@ -196,6 +196,7 @@ bool Make_Invokable_From_Feed_Throws(REBVAL *out, REBFED *feed)
     // make its nodes, so manual ones don't wind up in the tracking list.
     //
     SET_SERIES_FLAG(varlist, MANAGED); // can't use Manage_Series
+    Mark_If_Unswept(varlist);
 
     Init_Frame(out, CTX(varlist), label);
     return false;
@@ -60,6 +60,13 @@ enum {
 // does is change the phase and binding to match the function this layer was
 // specializing.
 //
+// The arguments need no new typecheck (the hidden slots were checked when
+// the exemplar was made, the rest just now).  So rather than return a
+// R_REDO_UNCHECKED to go back through the evaluator's result handling and
+// dispatch, the new phase's dispatcher is called directly--as the evaluator
+// would, with the varlist held if it is a native.  This makes calling a
+// specialization about as cheap as calling the action it specializes.
+//
 REB_R Specializer_Dispatcher(REBFRM *f)
 {
     REBARR *details = ACT_DETAILS(FRM_PHASE(f));
@@ -67,11 +74,16 @@ REB_R Specializer_Dispatcher(REBFRM *f)
     UNUSED(details);
 
     REBCTX *exemplar = ACT_EXEMPLAR(FRM_PHASE(f));
+    REBACT *phase = CTX_FRAME_ACTION(exemplar);
 
-    INIT_FRM_PHASE(f, CTX_FRAME_ACTION(exemplar));
+    INIT_FRM_PHASE(f, phase);
     INIT_FRM_BINDING(f, CTX_FRAME_BINDING(exemplar));
 
-    return R_REDO_UNCHECKED; // redo uses the updated phase and binding
+    if (GET_ACTION_FLAG(phase, IS_NATIVE))  // see notes in Process_Action()
+        SER_INFO(f->varlist) |= SERIES_INFO_HOLD;
+
+    REBNAT dispatcher = ACT_DISPATCHER(phase);
+    return (*dispatcher)(f);
 }
 
 
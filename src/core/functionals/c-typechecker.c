@@ -65,34 +65,43 @@ REBNATIVE(typecheck_internal_q)
 }
 
 
+// The check both dispatchers make, on the argument in the frame or on a value
+// given directly by Did_Typecheck_Without_Frame().
 //
-//  Datatype_Checker_Dispatcher: C
-//
-// Dispatcher used by TYPECHECKER generator for when argument is a datatype.
-//
-REB_R Datatype_Checker_Dispatcher(REBFRM *f)
+static bool Typechecker_Passes(REBARR *details, const RELVAL *v)
 {
-    REBARR *details = ACT_DETAILS(FRM_PHASE(f));
     assert(ARR_LEN(details) == IDX_TYPECHECKER_MAX);
 
-    REBVAL *datatype = DETAILS_AT(details, IDX_TYPECHECKER_TYPE);
+    REBVAL *type = DETAILS_AT(details, IDX_TYPECHECKER_TYPE);
 
-    if (VAL_TYPE_KIND_OR_CUSTOM(datatype) == REB_CUSTOM) {
-        if (VAL_TYPE(FRM_ARG(f, 2)) != REB_CUSTOM)
-            return Init_False(f->out);
+    if (IS_TYPESET(type))
+        return TYPE_CHECK(type, VAL_TYPE(v));
 
-        REBTYP *typ = VAL_TYPE_CUSTOM(datatype);
-        return Init_Logic(
-            f->out,
-            CELL_CUSTOM_TYPE(FRM_ARG(f, 2)) == typ
-        );
+    if (VAL_TYPE_KIND_OR_CUSTOM(type) == REB_CUSTOM) {
+        if (VAL_TYPE(v) != REB_CUSTOM)
+            return false;
+
+        return CELL_CUSTOM_TYPE(v) == VAL_TYPE_CUSTOM(type);
     }
 
+    // otherwise won't be equal to any custom type
+    //
+    return VAL_TYPE(v) == VAL_TYPE_KIND_OR_CUSTOM(type);
+}
+
+
+//
+//  Datatype_Checker_Dispatcher: C
+//
+// Dispatcher used by TYPECHECKER generator for when argument is a datatype.
+//
+REB_R Datatype_Checker_Dispatcher(REBFRM *f)
+{
     assert(KEY_SYM(ACT_KEY(FRM_PHASE(f), 1)) == SYM_RETURN);  // skip arg 1
 
-    return Init_Logic(  // otherwise won't be equal to any custom type
+    return Init_Logic(
         f->out,
-        VAL_TYPE(FRM_ARG(f, 2)) == VAL_TYPE_KIND_OR_CUSTOM(datatype)
+        Typechecker_Passes(ACT_DETAILS(FRM_PHASE(f)), FRM_ARG(f, 2))
     );
 }
 
@@ -104,15 +113,50 @@ REB_R Datatype_Checker_Dispatcher(REBFRM *f)
 //
 REB_R Typeset_Checker_Dispatcher(REBFRM *f)
 {
-    REBARR *details = ACT_DETAILS(FRM_PHASE(f));
-    assert(ARR_LEN(details) == IDX_TYPECHECKER_MAX);
+    assert(KEY_SYM(ACT_KEY(FRM_PHASE(f), 1)) == SYM_RETURN);  // skip arg 1
 
-    REBVAL *typeset = DETAILS_AT(details, IDX_TYPECHECKER_TYPE);
-    assert(IS_TYPESET(typeset));
+    return Init_Logic(
+        f->out,
+        Typechecker_Passes(ACT_DETAILS(FRM_PHASE(f)), FRM_ARG(f, 2))
+    );
+}
 
-    assert(KEY_SYM(ACT_KEY(FRM_PHASE(f), 1)) == SYM_RETURN);  // skip arg 1
 
-    return Init_Logic(f->out, TYPE_CHECK(typeset, VAL_TYPE(FRM_ARG(f, 2))));
+//
+//  Is_Typechecker: C
+//
+bool Is_Typechecker(REBACT *act)
+{
+    return ACT_DISPATCHER(act) == &Datatype_Checker_Dispatcher
+        or ACT_DISPATCHER(act) == &Typeset_Checker_Dispatcher;
+}
+
+
+//
+//  Did_Typecheck_Without_Frame: C
+//
+// Predicates like `all .integer? [...]` call an action on each value, which
+// means making a frame for each call.  When the action is a TYPECHECKER, the
+// answer can be had without one.  Returns false if `predicate` isn't one (or
+// if the value is an isotope, so calling it will give the usual error).
+//
+bool Did_Typecheck_Without_Frame(
+    bool *passed,
+    const REBVAL *predicate,
+    const RELVAL *v
+){
+    if (not IS_ACTION(predicate))
+        return false;
+
+    REBACT *act = VAL_ACTION(predicate);
+    if (not Is_Typechecker(act))
+        return false;
+
+    if (IS_BAD_WORD(v) and GET_CELL_FLAG(v, ISOTOPE))
+        return false;
+
+    *passed = Typechecker_Passes(ACT_DETAILS(act), v);
+    return true;
 }
 
 
@@ -135,6 +135,8 @@ bool Interpreted_Dispatch_Details_1_Throws(
     REBACT *phase = FRM_PHASE(f);
     REBARR *details = ACT_DETAILS(phase);
     RELVAL *body = ARR_AT(details, IDX_DETAILS_1);  // code to run
+    if (not IS_RELATIVE(body))
+        Relativize_Pending_Body(phase);  // first run, overwrites body cell
     assert(IS_BLOCK(body) and IS_RELATIVE(body) and VAL_INDEX(body) == 0);
 
     if (ACT_HAS_RETURN(phase)) {
@@ -175,6 +177,43 @@ bool Interpreted_Dispatch_Details_1_Throws(
 }
 
 
+//
+//  Relativize_Pending_Body: C
+//
+// Make_Interpreted_Action_May_Fail() leaves a CONST body as-is in the details,
+// instead of making the deep copy with words relative to the action.  This
+// does that work, the first time something needs the relativized body.
+//
+// The source array's file and line are used for the copy.  (An eager copy
+// favors the spec's, so bodies only wait if the spec's is the same or absent.)
+//
+void Relativize_Pending_Body(REBACT *a)
+{
+    REBARR *details = ACT_DETAILS(a);
+    RELVAL *body = ARR_AT(details, IDX_DETAILS_1);
+    assert(IS_BLOCK(body) and not IS_RELATIVE(body));
+
+    REBARR *copy = Copy_And_Bind_Relative_Deep_Managed(
+        SPECIFIC(body),
+        a,
+        TS_WORD
+    );
+
+    const REBARR *original = VAL_ARRAY(body);
+    if (GET_SUBCLASS_FLAG(ARRAY, original, HAS_FILE_LINE_UNMASKED)) {
+        mutable_LINK(Filename, copy) = LINK(Filename, original);
+        copy->misc.line = original->misc.line;
+        SET_SUBCLASS_FLAG(ARRAY, copy, HAS_FILE_LINE_UNMASKED);
+    }
+
+    bool was_const = GET_CELL_FLAG(body, CONST);
+
+    RELVAL *rebound = Init_Relative_Block(body, a, copy);
+    if (was_const)
+        SET_CELL_FLAG(rebound, CONST);
+}
+
+
 //
 //  Unchecked_Dispatcher: C
 //
@@ -412,6 +451,42 @@ REBACT *Make_Interpreted_Action_May_Fail(
         else
             INIT_ACT_DISPATCHER(a, &Unchecked_Dispatcher); // unchecked f->out
 
+        // A CONST body (e.g. a block literal in source) can wait to be
+        // copied and relatively bound until the action first runs (see
+        // Relativize_Pending_Body()).  Generated code that makes many
+        // functions--most of which may never be called--then doesn't pay
+        // for a deep copy of each body up front.
+        //
+        // The array is frozen, so no MUTABLE reference held elsewhere can
+        // change the body before it gets copied.  (Freezing is a walk over
+        // the body without allocations, and is skipped if the array was
+        // already frozen by an earlier FUNC.)  The lazy copy takes its file
+        // and line from the body, so if the spec has a different one the
+        // copy is made now, as usual.
+        //
+        const REBARR *spec_array = VAL_ARRAY(spec);
+        const REBARR *body_array = VAL_ARRAY(body);
+        if (
+            GET_CELL_FLAG(body, CONST)
+            and (
+                NOT_SUBCLASS_FLAG(ARRAY, spec_array, HAS_FILE_LINE_UNMASKED)
+                or (
+                    GET_SUBCLASS_FLAG(
+                        ARRAY, body_array, HAS_FILE_LINE_UNMASKED
+                    )
+                    and spec_array->misc.line == body_array->misc.line
+                    and (
+                        LINK(Filename, spec_array)
+                        == LINK(Filename, body_array)
+                    )
+                )
+            )
+        ){
+            Force_Value_Frozen_Deep(body);
+            Copy_Cell(ARR_AT(ACT_DETAILS(a), IDX_DETAILS_1), body);
+            return a;
+        }
+
         copy = Copy_And_Bind_Relative_Deep_Managed(
             body,  // new copy has locals bound relatively to the new action
             a,
@@ -613,6 +688,7 @@ REBNATIVE(unwind)
 //      value "If no argument is given, result will be ~void~"
 //          [<end> <opt> <meta> any-value!]
 //      /isotope "Relay isotope status of NULL or void return values"
+//      /run "Value is a FRAME! to run in place of this one (a tail call)"
 //  ]
 //
 REBNATIVE(return)
@@ -653,6 +729,33 @@ REBNATIVE(return)
 
     REBVAL *v = ARG(value);
 
+    if (REF(run)) {
+        //
+        // The frame isn't run here, but thrown up to the target frame, which
+        // runs it in its own REBFRM once its caller's stack is unwound (see
+        // the tail call in Process_Action_Maybe_Stale_Throws()).  Check the
+        // frame now, so the error implicates the callsite.  The result isn't
+        // checked against this function's return types, but the frame's.
+        //
+        if (Is_Void(v))
+            fail (PAR(value));
+        Meta_Unquotify(v);
+        if (not IS_FRAME(v))
+            fail (PAR(value));
+
+        if (IS_FRAME_PHASED(v))  // see REDO for restarting a running frame
+            fail ("Use REDO to restart a running FRAME! (not RETURN/RUN)");
+
+        REBCTX *c = VAL_CONTEXT(v);  // checks for INACCESSIBLE
+        if (GET_SUBCLASS_FLAG(VARLIST, CTX_VARLIST(c), FRAME_HAS_BEEN_INVOKED))
+            fail (Error_Stale_Frame_Raw());
+
+        Copy_Cell(D_OUT, NATIVE_VAL(return));
+        INIT_VAL_ACTION_BINDING(D_OUT, f_binding);
+
+        return Init_Thrown_With_Label(D_OUT, v, D_OUT);
+    }
+
     // Defininitional returns are "locals"--there's no argument type check.
     // So TYPESET! bits in the RETURN param are used for legal return types.
     //
@@ -0,0 +1,659 @@
+//
+//  File: %l-cache.c
+//  Summary: "binary cache of scanned source arrays"
+//  Section: lexical
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Loading the same modules every time an interpreter starts means scanning
+// the same UTF-8 over and over.  ENCODE-SCANNED saves the result of a scan in
+// a compact binary form that DECODE-SCANNED can rebuild without going back
+// through the scanner.  SYS-LOAD uses this when system/options/scan-cache
+// names a directory to keep the cache files in.
+//
+// The format is:
+//
+//     "RSC" version-byte  REB_MAX-byte
+//     crc32 of the rest of the cache (4 bytes, little endian)
+//     size of the content (4 bytes, little endian)  LZ4 block of the content
+//
+// ...where the content is:
+//
+//     crc32 of the source (4 bytes, little endian)  source-size  start-line
+//     spelling-count  (spelling-size spelling-utf8)*
+//     array
+//
+// The content is compressed with LZ4 (see %u-compress.c), which decompresses
+// much faster than the cache could be read from disk at its full size.
+//
+// Sizes and counts are unsigned LEB128 "varints".  An array is its length,
+// line number, and a newline-at-tail byte, followed by its items.  Each item
+// is a flags byte (newline-before), its quote level, a kind byte, and then a
+// payload depending on the kind.  Words refer to spellings by their position
+// in the table, so each distinct spelling is interned only once on decode.
+//
+// Only what the scanner commonly produces gets a dedicated encoding.  Other
+// values (paths, tuples, dates, money...) are saved as their molded form and
+// scanned individually when decoding (so that text is NUL-terminated).
+//
+// !!! The kind bytes are the interpreter's own Reb_Kind numbering, which can
+// change between builds.  REB_MAX is checked as a sanity test, but the cache
+// files should be keyed by the build if kept around (SYS-LOAD does so).
+//
+
+#include "sys-core.h"
+
+
+#define SCAN_CACHE_VERSION 2
+#define SCAN_CACHE_HEADER_SIZE 13  // through the uncompressed content size
+
+#define SCAN_CACHE_MOLDED 0xFF  // kind byte for values saved as molded text
+
+#define SCAN_CACHE_FLAG_NEWLINE_BEFORE 0x01
+
+
+
+//=//// ENCODING //////////////////////////////////////////////////////////=//
+
+typedef struct rebol_scan_cache_encoder {
+    REBBIN *bin;  // accumulates the array (the spelling table goes first)
+    struct Reb_Binder binder;  // symbol => 1-based spelling table position
+    REBDSP dsp_orig;  // spellings are pushed as WORD!s above this, in order
+} SCAN_CACHE_ENCODER;
+
+
+static void Put_Bytes(REBBIN *bin, const REBYTE *data, REBSIZ size)
+{
+    REBLEN old_len = BIN_LEN(bin);
+    EXPAND_SERIES_TAIL(bin, size);
+    memcpy(BIN_AT(bin, old_len), data, size);
+    TERM_BIN_LEN(bin, old_len + size);
+}
+
+static void Put_Byte(REBBIN *bin, REBYTE b)
+  { Put_Bytes(bin, &b, 1); }
+
+static void Put_Varint(REBBIN *bin, uint64_t u)
+{
+    REBYTE buf[10];
+    REBLEN n = 0;
+    do {
+        buf[n] = u & 0x7F;
+        u >>= 7;
+        if (u != 0)
+            buf[n] |= 0x80;
+        ++n;
+    } while (u != 0);
+    Put_Bytes(bin, buf, n);
+}
+
+static void Put_U32_LE(REBYTE *bp, uint32_t u)
+{
+    REBLEN i;
+    for (i = 0; i < 4; ++i, u >>= 8)
+        bp[i] = u & 0xFF;
+}
+
+static void Append_U64_LE(REBBIN *bin, uint64_t u)
+{
+    REBYTE buf[8];
+    REBLEN i;
+    for (i = 0; i < 8; ++i, u >>= 8)
+        buf[i] = u & 0xFF;
+    Put_Bytes(bin, buf, 8);
+}
+
+
+static void Encode_Array(
+    SCAN_CACHE_ENCODER *enc,
+    const REBARR *a,
+    REBLEN index
+);
+
+static void Encode_Item(SCAN_CACHE_ENCODER *enc, const RELVAL *item)
+{
+    REBBIN *bin = enc->bin;
+
+    DECLARE_LOCAL (temp);
+    Derelativize(temp, item, SPECIFIED);
+    REBLEN quotes = Dequotify(temp);
+
+    Put_Byte(
+        bin,
+        GET_CELL_FLAG(item, NEWLINE_BEFORE)
+            ? SCAN_CACHE_FLAG_NEWLINE_BEFORE
+            : 0
+    );
+    Put_Varint(bin, quotes);
+
+    REBYTE kind = KIND3Q_BYTE(temp);
+    if (kind != HEART_BYTE(temp))  // e.g. SET-PATH! whose "heart" is a PATH!
+        goto molded;
+
+    if (ANY_WORD_KIND(kind)) {
+        const REBSYM *symbol = VAL_WORD_SYMBOL(temp);
+        REBINT index = Get_Binder_Index_Else_0(&enc->binder, symbol);
+        if (index == 0) {
+            Init_Word(DS_PUSH(), symbol);
+            index = DSP - enc->dsp_orig;
+            Add_Binder_Index(&enc->binder, symbol, index);
+        }
+        Put_Byte(bin, kind);
+        Put_Varint(bin, index - 1);
+        return;
+    }
+
+    if (ANY_ARRAY_KIND(kind)) {
+        Put_Byte(bin, kind);
+        Encode_Array(enc, VAL_ARRAY(temp), VAL_INDEX(temp));
+        return;
+    }
+
+    if (ANY_STRING_KIND(kind) and VAL_INDEX(temp) == 0) {
+        const REBSTR *s = VAL_STRING(temp);
+        Put_Byte(bin, kind);
+        Put_Varint(bin, STR_SIZE(s));
+        Put_Bytes(bin, cb_cast(STR_UTF8(s)), STR_SIZE(s));
+        return;
+    }
+
+    switch (kind) {
+      case REB_NULL:  // only legal quoted, e.g. scanning [''] (checked later)
+      case REB_BLANK:
+      case REB_COMMA:
+        Put_Byte(bin, kind);
+        return;
+
+      case REB_LOGIC:  // scanned from #[true] or #[false]
+        Put_Byte(bin, kind);
+        Put_Byte(bin, VAL_LOGIC(temp) ? 1 : 0);
+        return;
+
+      case REB_INTEGER: {
+        REBI64 i = VAL_INT64(temp);
+        Put_Byte(bin, kind);
+        Put_Varint(  // "zigzag" so small negative numbers stay small
+            bin,
+            (cast(uint64_t, i) << 1) ^ cast(uint64_t, i >> 63)
+        );
+        return; }
+
+      case REB_DECIMAL:
+      case REB_PERCENT: {  // saved exactly (mold may lose digits)
+        REBDEC d = VAL_DECIMAL(temp);
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        Put_Byte(bin, kind);
+        Append_U64_LE(bin, bits);
+        return; }
+
+      default:
+        break;
+    }
+
+  molded: {
+    DECLARE_MOLD (mo);
+    SET_MOLD_FLAG(mo, MOLD_FLAG_ALL);
+    Push_Mold(mo);
+    Mold_Value(mo, temp);
+
+    REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+    Put_Byte(bin, SCAN_CACHE_MOLDED);
+    Put_Varint(bin, size);
+    Put_Bytes(bin, cb_cast(STR_UTF8(mo->series)) + mo->offset, size);
+    Put_Byte(bin, '\0');  // the scanner needs its input NUL-terminated
+
+    Drop_Mold(mo); }
+}
+
+
+static void Encode_Array(
+    SCAN_CACHE_ENCODER *enc,
+    const REBARR *a,
+    REBLEN index
+){
+    Put_Varint(enc->bin, ARR_LEN(a) - index);
+    Put_Varint(enc->bin, Has_File_Line(a) ? a->misc.line : 0);
+    Put_Byte(enc->bin, Has_Newline_At_Tail(a) ? 1 : 0);
+
+    const RELVAL *tail = ARR_TAIL(a);
+    const RELVAL *item = ARR_AT(a, index);
+    for (; item != tail; ++item)
+        Encode_Item(enc, item);
+}
+
+
+//=//// DECODING //////////////////////////////////////////////////////////=//
+//
+// The content checksum is verified before decoding, so a bad cache would be
+// a bug (or a cache from an incompatible build).  Reads are still bounds
+// checked, with failure meaning the cache just won't be used.
+//
+
+typedef struct rebol_scan_cache_reader {
+    const REBYTE *at;
+    const REBYTE *limit;
+    const REBSTR *file;  // for file and line of the rebuilt arrays
+    REBDSP dsp_spellings;  // spellings pushed as WORD!s above this
+    REBLEN num_spellings;
+} SCAN_CACHE_READER;
+
+
+static bool Get_Byte(SCAN_CACHE_READER *r, REBYTE *out)
+{
+    if (r->at == r->limit)
+        return false;
+    *out = *r->at++;
+    return true;
+}
+
+static bool Get_Varint(SCAN_CACHE_READER *r, uint64_t *out)
+{
+    uint64_t u = 0;
+    REBLEN shift = 0;
+    REBYTE b;
+    do {
+        if (shift >= 64 or not Get_Byte(r, &b))
+            return false;
+        u |= cast(uint64_t, b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    *out = u;
+    return true;
+}
+
+static bool Get_Bytes(SCAN_CACHE_READER *r, const REBYTE **out, uint64_t size)
+{
+    if (size > cast(uint64_t, r->limit - r->at))
+        return false;
+    *out = r->at;
+    r->at += size;
+    return true;
+}
+
+static uint32_t Get_U32_LE(const REBYTE *bp)
+{
+    return cast(uint32_t, bp[0])
+        | (cast(uint32_t, bp[1]) << 8)
+        | (cast(uint32_t, bp[2]) << 16)
+        | (cast(uint32_t, bp[3]) << 24);
+}
+
+
+static bool Decode_Array_To_Stack(SCAN_CACHE_READER *r, REBARR **out);
+
+static bool Decode_Item_To_Stack(SCAN_CACHE_READER *r)
+{
+    REBYTE flags;
+    uint64_t quotes;
+    REBYTE kind;
+    if (
+        not Get_Byte(r, &flags)
+        or not Get_Varint(r, &quotes)
+        or not Get_Byte(r, &kind)
+    ){
+        return false;
+    }
+
+    if (kind == SCAN_CACHE_MOLDED) {
+        uint64_t size;
+        const REBYTE *utf8;
+        if (
+            not Get_Varint(r, &size)
+            or not Get_Bytes(r, &utf8, size + 1)
+            or utf8[size] != '\0'
+        ){
+            return false;
+        }
+
+        REBARR *a = Scan_UTF8_Managed(r->file, utf8, size);
+        if (ARR_LEN(a) != 1)
+            return false;
+        Derelativize(DS_PUSH(), ARR_HEAD(a), SPECIFIED);
+    }
+    else if (kind >= REB_MAX)
+        return false;
+    else if (ANY_WORD_KIND(kind)) {
+        uint64_t index;
+        if (not Get_Varint(r, &index) or index >= r->num_spellings)
+            return false;
+        const REBSYM *symbol = VAL_WORD_SYMBOL(
+            DS_AT(r->dsp_spellings + 1 + index)
+        );
+        Init_Any_Word(DS_PUSH(), cast(enum Reb_Kind, kind), symbol);
+    }
+    else if (ANY_ARRAY_KIND(kind)) {
+        REBARR *a;
+        if (not Decode_Array_To_Stack(r, &a))
+            return false;
+        Init_Any_Array(DS_PUSH(), cast(enum Reb_Kind, kind), a);
+    }
+    else if (ANY_STRING_KIND(kind)) {
+        uint64_t size;
+        const REBYTE *utf8;
+        if (not Get_Varint(r, &size) or not Get_Bytes(r, &utf8, size))
+            return false;
+
+        REBSTR *s = Append_UTF8_May_Fail(  // scanned strings may have ^M
+            nullptr, cs_cast(utf8), size, STRMODE_ALL_CODEPOINTS
+        );
+        Init_Any_String(DS_PUSH(), cast(enum Reb_Kind, kind), s);
+    }
+    else switch (kind) {
+      case REB_NULL:
+        if (quotes == 0)  // a bare null can't be in an array
+            return false;
+        Init_Nulled(DS_PUSH());
+        break;
+
+      case REB_BLANK:
+        Init_Blank(DS_PUSH());
+        break;
+
+      case REB_COMMA:
+        Init_Comma(DS_PUSH());
+        break;
+
+      case REB_LOGIC: {
+        REBYTE b;
+        if (not Get_Byte(r, &b))
+            return false;
+        Init_Logic(DS_PUSH(), b != 0);
+        break; }
+
+      case REB_INTEGER: {
+        uint64_t u;
+        if (not Get_Varint(r, &u))
+            return false;
+        Init_Integer(
+            DS_PUSH(),
+            cast(REBI64, (u >> 1) ^ (~(u & 1) + 1))  // undo "zigzag"
+        );
+        break; }
+
+      case REB_DECIMAL:
+      case REB_PERCENT: {
+        const REBYTE *bp;
+        if (not Get_Bytes(r, &bp, 8))
+            return false;
+        uint64_t bits = Get_U32_LE(bp)
+            | (cast(uint64_t, Get_U32_LE(bp + 4)) << 32);
+        REBDEC d;
+        memcpy(&d, &bits, sizeof(d));
+        if (kind == REB_DECIMAL)
+            Init_Decimal(DS_PUSH(), d);
+        else
+            Init_Percent(DS_PUSH(), d);
+        break; }
+
+      default:
+        return false;
+    }
+
+    if (quotes > 0)
+        Quotify(DS_TOP, quotes);
+
+    if (flags & SCAN_CACHE_FLAG_NEWLINE_BEFORE)
+        SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+
+    return true;
+}
+
+
+// Values are pushed to the data stack and popped into an array, the way the
+// scanner does it.  On failure anything pushed is left for the caller to
+// drop (it drops back to before the spellings were pushed).
+//
+static bool Decode_Array_To_Stack(SCAN_CACHE_READER *r, REBARR **out)
+{
+    uint64_t len;
+    uint64_t line;
+    REBYTE newline_at_tail;
+    if (
+        not Get_Varint(r, &len)
+        or not Get_Varint(r, &line)
+        or not Get_Byte(r, &newline_at_tail)
+        or len > cast(uint64_t, r->limit - r->at)  // items are >= 1 byte
+    ){
+        return false;
+    }
+
+    REBDSP dsp_orig = DSP;
+    for (; len > 0; --len) {
+        if (not Decode_Item_To_Stack(r))
+            return false;
+    }
+
+    REBARR *a = Pop_Stack_Values_Core(
+        dsp_orig,
+        NODE_FLAG_MANAGED
+            | (newline_at_tail ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
+    );
+
+    if (line != 0) {
+        a->misc.line = line;
+        mutable_LINK(Filename, a) = r->file;
+        SET_SUBCLASS_FLAG(ARRAY, a, HAS_FILE_LINE_UNMASKED);
+        SET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
+    }
+
+    *out = a;
+    return true;
+}
+
+
+//
+//  encode-scanned: native [
+//
+//  {Save a scanned BLOCK! in a binary form that DECODE-SCANNED rebuilds fast}
+//
+//      return: [binary!]
+//      block "Result of a TRANSCODE of the source (unbound)"
+//          [block!]
+//      source "The UTF-8 that was scanned (checksum is saved for validation)"
+//          [binary! text!]
+//      /line "Line number the scan of the source started at"
+//          [integer!]
+//  ]
+//
+REBNATIVE(encode_scanned)
+{
+    INCLUDE_PARAMS_OF_ENCODE_SCANNED;
+
+    REBSIZ source_size;
+    const REBYTE *source_bytes = VAL_BYTES_AT(&source_size, ARG(source));
+
+    REBINT start_line = REF(line) ? VAL_INT32(ARG(line)) : 1;
+    if (start_line <= 0)
+        fail (PAR(line));
+
+    SCAN_CACHE_ENCODER enc;
+    enc.bin = Make_Binary(source_size / 2);
+    INIT_BINDER(&enc.binder);
+    enc.dsp_orig = DSP;
+
+    Encode_Array(&enc, VAL_ARRAY(ARG(block)), VAL_INDEX(ARG(block)));
+
+    REBLEN num_spellings = DSP - enc.dsp_orig;
+
+    REBBIN *bin = Make_Binary(BIN_LEN(enc.bin) + num_spellings * 8 + 32);
+
+    REBYTE crc_buf[4];
+    Put_U32_LE(crc_buf, Checksum_CRC32(0, source_bytes, source_size));
+    Put_Bytes(bin, crc_buf, 4);
+    Put_Varint(bin, source_size);
+    Put_Varint(bin, start_line);
+
+    Put_Varint(bin, num_spellings);
+    REBDSP dsp;
+    for (dsp = enc.dsp_orig + 1; dsp <= DSP; ++dsp) {
+        const REBSYM *symbol = VAL_WORD_SYMBOL(DS_AT(dsp));
+        Put_Varint(bin, STR_SIZE(symbol));
+        Put_Bytes(bin, cb_cast(STR_UTF8(symbol)), STR_SIZE(symbol));
+        Remove_Binder_Index(&enc.binder, symbol);
+    }
+    DS_DROP_TO(enc.dsp_orig);
+    SHUTDOWN_BINDER(&enc.binder);
+
+    Put_Bytes(bin, BIN_HEAD(enc.bin), BIN_LEN(enc.bin));
+    Free_Unmanaged_Series(enc.bin);
+
+    REBSIZ content_size = BIN_LEN(bin);
+    REBBIN *cache = Make_Binary(
+        SCAN_CACHE_HEADER_SIZE + LZ4_Compress_Bound(content_size)
+    );
+    REBYTE *bp = BIN_HEAD(cache);
+    memcpy(bp, "RSC", 3);
+    bp[3] = SCAN_CACHE_VERSION;
+    bp[4] = REB_MAX;
+    Put_U32_LE(bp + 9, content_size);
+
+    REBSIZ block_size = LZ4_Compress_Block(
+        bp + SCAN_CACHE_HEADER_SIZE,
+        BIN_HEAD(bin),
+        content_size
+    );
+    Free_Unmanaged_Series(bin);
+
+    Put_U32_LE(  // checksum covers the content size as well as the block
+        bp + 5,
+        Checksum_CRC32(0, bp + 9, SCAN_CACHE_HEADER_SIZE - 9 + block_size)
+    );
+    TERM_BIN_LEN(cache, SCAN_CACHE_HEADER_SIZE + block_size);
+
+    return Init_Binary(D_OUT, cache);
+}
+
+
+//
+//  decode-scanned: native [
+//
+//  {Rebuild a BLOCK! saved by ENCODE-SCANNED, if it was made from the source}
+//
+//      return: "NULL if the cache is damaged or for some other source"
+//          [<opt> block!]
+//      cache [binary!]
+//      source "The UTF-8 the cache should have been made from"
+//          [binary! text!]
+//      /file "File to be associated with BLOCK!s and GROUP!s"
+//          [file! url!]
+//      /line "Line number the source is expected to start at"
+//          [integer!]
+//  ]
+//
+REBNATIVE(decode_scanned)
+{
+    INCLUDE_PARAMS_OF_DECODE_SCANNED;
+
+    const REBSTR *file;
+    if (REF(file)) {
+        file = VAL_STRING(ARG(file));
+        Freeze_Series(file);  // see notes in TRANSCODE
+    }
+    else
+        file = ANONYMOUS;
+
+    REBINT start_line = REF(line) ? VAL_INT32(ARG(line)) : 1;
+    if (start_line <= 0)
+        fail (PAR(line));
+
+    REBSIZ size;
+    const REBYTE *bp = VAL_BYTES_AT(&size, ARG(cache));
+    if (
+        size < SCAN_CACHE_HEADER_SIZE
+        or memcmp(bp, "RSC", 3) != 0
+        or bp[3] != SCAN_CACHE_VERSION
+        or bp[4] != REB_MAX
+        or Get_U32_LE(bp + 5) != Checksum_CRC32(0, bp + 9, size - 9)
+    ){
+        return nullptr;
+    }
+
+    // An LZ4 byte can't stand for more than 255 bytes of content, which
+    // catches a bad size before allocating for it.
+    //
+    REBSIZ content_size = Get_U32_LE(bp + 9);
+    if (content_size / 255 > size)
+        return nullptr;
+
+    REBBIN *content = Make_Binary(content_size);
+    if (not LZ4_Decompress_Block(
+        BIN_HEAD(content),
+        content_size,
+        bp + SCAN_CACHE_HEADER_SIZE,
+        size - SCAN_CACHE_HEADER_SIZE
+    )){
+        Free_Unmanaged_Series(content);
+        return nullptr;
+    }
+    TERM_BIN_LEN(content, content_size);
+
+    SCAN_CACHE_READER r;
+    r.at = BIN_HEAD(content);
+    r.limit = BIN_TAIL(content);
+    r.file = file;
+
+    REBSIZ source_size;
+    const REBYTE *source_bytes = VAL_BYTES_AT(&source_size, ARG(source));
+
+    const REBYTE *crc;
+    uint64_t cached_size;
+    uint64_t cached_line;
+    uint64_t num_spellings;
+    if (
+        not Get_Bytes(&r, &crc, 4)
+        or not Get_Varint(&r, &cached_size)
+        or not Get_Varint(&r, &cached_line)
+        or cached_size != source_size
+        or cached_line != cast(uint64_t, start_line)
+        or Get_U32_LE(crc) != Checksum_CRC32(0, source_bytes, source_size)
+        or not Get_Varint(&r, &num_spellings)
+        or num_spellings > cast(uint64_t, r.limit - r.at)
+    ){
+        Free_Unmanaged_Series(content);
+        return nullptr;
+    }
+
+    REBDSP dsp_orig = DSP;
+    r.dsp_spellings = dsp_orig;
+    r.num_spellings = num_spellings;
+
+    REBLEN i;
+    for (i = 0; i < num_spellings; ++i) {
+        uint64_t spelling_size;
+        const REBYTE *utf8;
+        if (
+            not Get_Varint(&r, &spelling_size)
+            or not Get_Bytes(&r, &utf8, spelling_size)
+        ){
+            DS_DROP_TO(dsp_orig);
+            Free_Unmanaged_Series(content);
+            return nullptr;
+        }
+        Init_Word(DS_PUSH(), Intern_UTF8_Managed(utf8, spelling_size));
+    }
+
+    REBARR *a;
+    bool ok = Decode_Array_To_Stack(&r, &a) and r.at == r.limit;
+    DS_DROP_TO(dsp_orig);
+    Free_Unmanaged_Series(content);
+    if (not ok)
+        return nullptr;
+
+    return Init_Block(D_OUT, a);
+}
@@ -0,0 +1,358 @@
+//
+//  File: %l-csv.c
+//  Summary: "native decoder for delimited text (CSV, TSV...)"
+//  Section: lexical
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// DECODE-CSV splits delimited text into a block of rows (each a block of
+// TEXT! fields) or, with /COLUMNS, a block of columns.  Quoting follows RFC
+// 4180: a field in double quotes may hold delimiters, line breaks, and
+// quotes written twice.  Lines may end in CR LF or just LF, and empty lines
+// are skipped.
+//
+// With /INFER, unquoted fields that are numbers become INTEGER! or DECIMAL!,
+// and empty ones BLANK!.  (A quoted field is always TEXT!.)
+//
+// Unquoted fields are found by seeking the next delimiter or line end a
+// vector at a time, and made into TEXT! straight from the input.
+//
+// For files too big to read all at once, asking for the REST output makes
+// the input a chunk of a stream: a last record that isn't finished by a line
+// break is left undecoded, and REST is the position where it starts, to be
+// decoded along with the next chunk.  READ-CSV in %mezz-files.r does this.
+//
+
+#include "sys-core.h"
+
+#include "sys-seek.h"
+
+
+typedef struct {
+    const REBYTE *head;  // for error messages to give a byte offset
+    const REBYTE *end;  // NUL-terminated here
+    REBYTE delimiter;
+    bool infer;
+} CSV_READER;
+
+
+static REBCTX *Error_Bad_Csv(CSV_READER *r, const REBYTE *at)
+{
+    DECLARE_LOCAL (what);
+    Init_Text(what, Make_String_UTF8("CSV"));
+
+    REBSTR *where = Make_String(20);
+    Append_Ascii(where, "at byte ");
+    Append_Int(where, at - r->head);
+    DECLARE_LOCAL (position);
+    Init_Text(position, where);
+
+    return Error_Scan_Invalid_Raw(what, position);
+}
+
+
+#if !defined(SCAN_SCALAR)
+
+static inline ScanBits Csv_Line_Stops(ScanVec v) {
+    return SCAN_BITS(SCAN_OR(
+        SCAN_EQ(v, '\0'),
+        SCAN_OR(SCAN_EQ(v, LF), SCAN_EQ(v, CR))
+    ));
+}
+
+static inline ScanBits Csv_Quote_Stops(ScanVec v)
+  { return SCAN_BITS(SCAN_OR(SCAN_EQ(v, '\0'), SCAN_EQ(v, '"'))); }
+
+#endif
+
+// Find the end of an unquoted field: the delimiter, CR, LF, or NUL.
+//
+static inline const REBYTE *Seek_Csv_Field_End(
+    const REBYTE *cp,
+    REBYTE delimiter
+){
+  #if defined(SCAN_SCALAR)
+    while (not ANY_CR_LF_END(*cp) and *cp != delimiter)
+        ++cp;
+    return cp;
+  #else
+    return Seek_First_Stop_Or_Byte(cp, &Csv_Line_Stops, delimiter);
+  #endif
+}
+
+// Find the next quote (or NUL) in a quoted field.
+//
+static inline const REBYTE *Seek_Csv_Quote(const REBYTE *cp) {
+  #if defined(SCAN_SCALAR)
+    while (*cp != '"' and *cp != '\0')
+        ++cp;
+    return cp;
+  #else
+    return Seek_First_Stop(cp, &Csv_Quote_Stops);
+  #endif
+}
+
+
+inline static bool Is_Csv_Digit(REBYTE b)
+  { return b >= '0' and b <= '9'; }
+
+// For /INFER, a field that is all an integer or decimal number (with an
+// optional sign, and an exponent) is converted.  Number formats that the
+// scanner allows but spreadsheets don't write, like 1'000, are left as text.
+//
+static bool Try_Csv_Number(RELVAL *out, const REBYTE *cp, REBSIZ size)
+{
+    const REBYTE *bp = cp;
+    const REBYTE *end = cp + size;
+
+    if (bp != end and (*bp == '-' or *bp == '+'))
+        ++bp;
+
+    bool integral = true;
+    bool digits = false;
+    for (; bp != end and Is_Csv_Digit(*bp); ++bp)
+        digits = true;
+
+    if (bp != end and *bp == '.') {
+        integral = false;
+        for (++bp; bp != end and Is_Csv_Digit(*bp); ++bp)
+            digits = true;
+    }
+    if (not digits)
+        return false;
+
+    if (bp != end and (*bp == 'e' or *bp == 'E')) {
+        integral = false;
+        ++bp;
+        if (bp != end and (*bp == '-' or *bp == '+'))
+            ++bp;
+        if (bp == end or not Is_Csv_Digit(*bp))
+            return false;
+        while (bp != end and Is_Csv_Digit(*bp))
+            ++bp;
+    }
+    if (bp != end)
+        return false;
+
+    if (integral and Scan_Integer(out, cp, size))
+        return true;
+    return Scan_Decimal(out, cp, size, true) != nullptr;  // or too long
+}
+
+
+// Decode a field starting at `cp` into `out`, returning the position after
+// it (at a delimiter, line end, or the end).  If a quoted field is not
+// closed before the end of the input, nullptr is returned.
+//
+static const REBYTE *Decode_Csv_Field(
+    CSV_READER *r,
+    RELVAL *out,
+    const REBYTE *cp
+){
+    if (*cp != '"') {
+        const REBYTE *stop = Seek_Csv_Field_End(cp, r->delimiter);
+        REBSIZ size = stop - cp;
+        if (r->infer and size == 0)
+            Init_Blank(out);
+        else if (not (r->infer and Try_Csv_Number(out, cp, size)))
+            Init_Text(out, Make_Sized_String_UTF8(cs_cast(cp), size));
+        return stop;
+    }
+
+    ++cp;  // skip opening quote
+    const REBYTE *quote = Seek_Csv_Quote(cp);
+    if (*quote == '"' and quote[1] != '"') {  // no doubled quotes
+        Init_Text(out, Append_UTF8_May_Fail(
+            nullptr, cs_cast(cp), quote - cp, STRMODE_CRLF_TO_LF
+        ));
+        return quote + 1;
+    }
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    while (true) {
+        quote = Seek_Csv_Quote(cp);
+        if (*quote == '\0') {
+            if (quote != r->end)
+                fail (Error_Bad_Csv(r, quote));
+            Drop_Mold(mo);
+            return nullptr;  // unterminated, maybe the rest is in next chunk
+        }
+        if (quote[1] == '"') {  // doubled, include one of them
+            Append_UTF8_May_Fail(
+                mo->series, cs_cast(cp), quote + 1 - cp, STRMODE_CRLF_TO_LF
+            );
+            cp = quote + 2;
+            continue;
+        }
+        Append_UTF8_May_Fail(
+            mo->series, cs_cast(cp), quote - cp, STRMODE_CRLF_TO_LF
+        );
+        break;
+    }
+
+    Init_Text(out, Pop_Molded_String(mo));
+    return quote + 1;
+}
+
+
+//
+//  decode-csv: native [
+//
+//  {Split delimited text (CSV, TSV...) into a block of rows of fields}
+//
+//      return: "Rows as blocks of fields, or a block of columns if /COLUMNS"
+//          [block!]
+//      rest: "<output> Source is a chunk, give back where its unfinished end is"
+//          [<opt> text! binary!]
+//
+//      source "If BINARY!, must be UTF-8"
+//          [text! binary!]
+//      /delimiter "Field separator (default is comma, use tab for TSV)"
+//          [char!]
+//      /infer "Make INTEGER!, DECIMAL! of numeric fields, BLANK! of empty"
+//      /columns "Give back a block of columns (shorter rows get BLANK!s)"
+//  ]
+//
+REBNATIVE(decode_csv)
+{
+    INCLUDE_PARAMS_OF_DECODE_CSV;
+
+    REBVAL *source = ARG(source);
+
+    CSV_READER r;
+    r.delimiter = ',';
+    if (REF(delimiter)) {
+        REBUNI c = VAL_CHAR(ARG(delimiter));
+        if (c == 0 or c >= 0x80 or c == '"' or c == CR or c == LF)
+            fail (PAR(delimiter));
+        r.delimiter = cast(REBYTE, c);
+    }
+    r.infer = REF(infer);
+
+    REBSIZ size;
+    const REBYTE *bp = VAL_BYTES_AT(&size, source);
+    r.head = IS_BINARY(source) ? BIN_HEAD(VAL_BINARY(source)) : bp;
+    r.end = bp + size;
+    assert(*r.end == '\0');  // series are terminated, the seeks rely on it
+
+    bool streaming = REF(rest);
+
+    DECLARE_LOCAL (field);
+    REBDSP dsp_orig = DSP;
+    REBLEN num_rows = 0;
+    REBLEN num_columns = 0;  // of the first row, for /COLUMNS
+
+    const REBYTE *cp = bp;
+    while (cp != r.end) {
+        if (*cp == LF) {  // empty line
+            ++cp;
+            continue;
+        }
+        if (*cp == CR and cp[1] == LF) {
+            cp += 2;
+            continue;
+        }
+
+        const REBYTE *record = cp;
+        REBDSP dsp_row = DSP;
+        bool finished = false;  // ended by a line break
+
+        while (true) {
+            cp = Decode_Csv_Field(&r, field, cp);
+            if (not cp)
+                break;  // quoted field not closed
+            Move_Cell(DS_PUSH(), field);
+
+            if (*cp == r.delimiter) {
+                ++cp;
+                continue;
+            }
+            if (*cp == LF) {
+                ++cp;
+                finished = true;
+                break;
+            }
+            if (*cp == CR and cp[1] == LF) {
+                cp += 2;
+                finished = true;
+                break;
+            }
+            if (cp == r.end)
+                break;
+
+            fail (Error_Bad_Csv(&r, cp));  // e.g. after the closing quote
+        }
+
+        if (not finished and streaming) {  // last record may be incomplete
+            DS_DROP_TO(dsp_row);
+            cp = record;
+            break;
+        }
+        if (not cp)
+            fail (Error_Bad_Csv(&r, record));  // unclosed quote
+
+        if (REF(columns)) {
+            REBLEN n = DSP - dsp_row;
+            if (num_rows == 0)
+                num_columns = n;
+            else if (n > num_columns)
+                fail (Error_Bad_Csv(&r, record));  // longer than first row
+            for (; n < num_columns; ++n)
+                Init_Blank(DS_PUSH());
+        }
+        else {
+            REBARR *row = Pop_Stack_Values(dsp_row);
+            Init_Block(DS_PUSH(), row);
+            SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+        }
+        ++num_rows;
+    }
+
+    if (REF(columns)) {
+        REBARR *columns = Make_Array(num_columns);
+        REBLEN c;
+        for (c = 0; c < num_columns; ++c) {
+            REBARR *column = Make_Array(num_rows);
+            REBDSP dsp = dsp_orig + 1 + c;
+            for (; dsp <= DSP; dsp += num_columns)
+                Copy_Cell(Alloc_Tail_Array(column), DS_AT(dsp));
+            Init_Block(Alloc_Tail_Array(columns), column);
+        }
+        DS_DROP_TO(dsp_orig);
+        Init_Block(D_OUT, columns);
+    }
+    else
+        Init_Block(
+            D_OUT,
+            Pop_Stack_Values_Core(dsp_orig, ARRAY_FLAG_NEWLINE_AT_TAIL)
+        );
+
+    if (streaming and not Is_Blackhole(ARG(rest))) {
+        REBVAL *var = Sink_Word_May_Fail(ARG(rest), SPECIFIED);
+        Copy_Cell(var, source);
+
+        if (IS_BINARY(var))
+            VAL_INDEX_UNBOUNDED(var) += cp - bp;
+        else
+            VAL_INDEX_RAW(var) += Num_Codepoints_For_Bytes(bp, cp);
+    }
+
+    return D_OUT;
+}
@@ -0,0 +1,705 @@
+//
+//  File: %l-json.c
+//  Summary: "native JSON encoder and decoder (JSON codec)"
+//  Section: lexical
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// DECODE-JSON builds values directly from JSON text, without going through
+// PARSE rules or the scanner:
+//
+//     JSON            Rebol
+//     ----            -----
+//     object          MAP! (with TEXT! keys, case-sensitive)
+//     array           BLOCK!
+//     string          TEXT!
+//     number          INTEGER!, or DECIMAL! if it has a fraction or exponent
+//                     (or doesn't fit in 64 bits)
+//     true, false     LOGIC!
+//     null            BLANK!
+//
+// ENCODE-JSON goes the other way, also accepting OBJECT!s, any string or
+// word type as a JSON string, and a few scalars (DATE!, TIME!, TUPLE!...)
+// as their FORM in a string.
+//
+// They are registered as the `json` codec (see %sys-codec.r), so that:
+//
+//     data: load %data.json
+//     save %data.json data
+//
+// Most of the bytes in typical JSON are inside strings, and most strings are
+// plain ASCII without escapes.  Those runs are found with Seek_First_Stop()
+// from %sys-seek.h, a vector at a time, and copied in one go.  A string with
+// no escapes or non-ASCII at all is made directly from the input, without
+// going through the mold buffer.
+//
+// For large inputs that are sequences of JSON values (e.g. "JSON Lines" log
+// files, or a stream of concatenated documents), the NEXT output decodes
+// just one value and gives back the position after it, as TRANSCODE does.
+//
+
+#include "sys-core.h"
+
+#include "sys-seek.h"
+
+
+typedef struct {
+    const REBYTE *head;  // for error messages to give a byte offset
+    const REBYTE *at;
+    const REBYTE *end;  // NUL-terminated here (and no sooner, if valid)
+} JSON_READER;
+
+
+static REBCTX *Error_Bad_Json(JSON_READER *r)
+{
+    DECLARE_LOCAL (what);
+    Init_Text(what, Make_String_UTF8("JSON"));
+
+    REBSTR *where = Make_String(20);
+    if (r->at >= r->end)
+        Append_Ascii(where, "at end");
+    else {
+        Append_Ascii(where, "at byte ");
+        Append_Int(where, r->at - r->head);
+    }
+    DECLARE_LOCAL (position);
+    Init_Text(position, where);
+
+    return Error_Scan_Invalid_Raw(what, position);
+}
+
+
+inline static const REBYTE *Skip_Json_Space(const REBYTE *cp) {
+    while (*cp == ' ' or *cp == LF or *cp == CR or *cp == '\t')
+        ++cp;
+    return cp;
+}
+
+
+#if !defined(SCAN_SCALAR)
+
+// NUL and control characters (which are errors unless they are the end),
+// bytes of multi-byte UTF-8 sequences, and the quote and backslash.  This is
+// the same set for decoding and encoding, and the bytes in between can be
+// copied as-is either way.
+//
+static inline ScanBits Json_String_Stops(ScanVec v) {
+    return SCAN_BITS(SCAN_OR(
+        SCAN_CTRL_OR_HIGH(v),
+        SCAN_OR(SCAN_EQ(v, '"'), SCAN_EQ(v, '\\'))
+    ));
+}
+
+#endif
+
+// Find the first byte at or after `cp` which is not printable ASCII, or is
+// a quote or backslash.  `cp` must be NUL-terminated.
+//
+static inline const REBYTE *Seek_Json_String_Special(const REBYTE *cp) {
+  #if defined(SCAN_SCALAR)
+    while (*cp >= 0x20 and *cp < 0x80 and *cp != '"' and *cp != '\\')
+        ++cp;
+    return cp;
+  #else
+    return Seek_First_Stop(cp, &Json_String_Stops);
+  #endif
+}
+
+
+//=//// DECODING //////////////////////////////////////////////////////////=//
+
+// Four hex digits of a \u escape, or -1 if they aren't.
+//
+static REBINT Take_Json_Hex4(JSON_READER *r)
+{
+    REBINT n = 0;
+    REBLEN i;
+    for (i = 0; i < 4; ++i) {
+        REBYTE b = r->at[i];  // stops at NUL, so won't read past the end
+        n <<= 4;
+        if (b >= '0' and b <= '9')
+            n += b - '0';
+        else if (b >= 'a' and b <= 'f')
+            n += b - 'a' + 10;
+        else if (b >= 'A' and b <= 'F')
+            n += b - 'A' + 10;
+        else
+            return -1;
+    }
+    r->at += 4;
+    return n;
+}
+
+
+static void Decode_Json_String(JSON_READER *r, RELVAL *out)
+{
+    assert(*r->at == '"');
+    const REBYTE *cp = r->at + 1;
+
+    const REBYTE *special = Seek_Json_String_Special(cp);
+    if (*special == '"') {  // all plain ASCII, no need for the mold buffer
+        Init_Text(out, Append_Ascii_Len(nullptr, cs_cast(cp), special - cp));
+        r->at = special + 1;
+        return;
+    }
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    while (true) {
+        special = Seek_Json_String_Special(cp);
+        if (special != cp) {
+            Append_Ascii_Len(mo->series, cs_cast(cp), special - cp);
+            cp = special;
+        }
+
+        REBUNI c = *cp;
+        if (c == '"')
+            break;
+
+        if (c >= 0x80) {
+            if (not (cp = Back_Scan_UTF8_Char(&c, cp, nullptr))) {
+                r->at = special;
+                fail (Error_Bad_Json(r));
+            }
+            ++cp;  // Back_Scan advances one less than the full encoding
+            Append_Codepoint(mo->series, c);
+            continue;
+        }
+
+        if (c != '\\') {  // raw control characters aren't legal, nor the end
+            r->at = cp;
+            fail (Error_Bad_Json(r));
+        }
+
+        r->at = cp;
+        switch (cp[1]) {
+          case '"': c = '"'; break;
+          case '\\': c = '\\'; break;
+          case '/': c = '/'; break;
+          case 'b': c = BS; break;
+          case 'f': c = '\f'; break;
+          case 'n': c = LF; break;
+          case 'r': c = CR; break;
+          case 't': c = '\t'; break;
+
+          case 'u': {
+            r->at = cp + 2;
+            REBINT hex = Take_Json_Hex4(r);
+            if (hex < 0)
+                fail (Error_Bad_Json(r));
+            c = hex;
+
+            if (c >= UNI_SUR_HIGH_START and c <= UNI_SUR_HIGH_END) {
+                if (r->at[0] != '\\' or r->at[1] != 'u')
+                    fail (Error_Bad_Json(r));
+                r->at += 2;
+                REBINT low = Take_Json_Hex4(r);
+                if (
+                    low < 0
+                    or cast(REBUNI, low) < UNI_SUR_LOW_START
+                    or cast(REBUNI, low) > UNI_SUR_LOW_END
+                ){
+                    fail (Error_Bad_Json(r));
+                }
+                c = 0x10000
+                    + ((c - UNI_SUR_HIGH_START) << 10)
+                    + (low - UNI_SUR_LOW_START);
+            }
+            else if (c >= UNI_SUR_LOW_START and c <= UNI_SUR_LOW_END)
+                fail (Error_Bad_Json(r));  // low surrogate without a high one
+            else if (c == 0)
+                fail (Error_Illegal_Zero_Byte_Raw());  // can't be in TEXT!
+
+            Append_Codepoint(mo->series, c);
+            cp = r->at;
+            continue; }
+
+          default:
+            fail (Error_Bad_Json(r));
+        }
+
+        Append_Codepoint(mo->series, c);
+        cp += 2;
+    }
+
+    Init_Text(out, Pop_Molded_String(mo));
+    r->at = cp + 1;
+}
+
+
+static void Decode_Json_Number(JSON_READER *r, RELVAL *out)
+{
+    const REBYTE *cp = r->at;
+    bool negative = (*cp == '-');
+    if (negative)
+        ++cp;
+
+    // Gather the digits of an integer as it goes, in case that's what it is.
+    // 18 digits can't overflow, more are left to Scan_Integer().
+    //
+    uint64_t u = 0;
+    const REBYTE *digits = cp;
+    if (*cp == '0')
+        ++cp;
+    else if (*cp >= '1' and *cp <= '9') {
+        do {
+            u = u * 10 + (*cp - '0');
+            ++cp;
+        } while (*cp >= '0' and *cp <= '9');
+    }
+    else
+        fail (Error_Bad_Json(r));
+
+    bool integral = true;
+    REBLEN num_digits = cp - digits;
+
+    if (*cp == '.') {
+        integral = false;
+        ++cp;
+        if (not (*cp >= '0' and *cp <= '9')) {
+            r->at = cp;
+            fail (Error_Bad_Json(r));
+        }
+        while (*cp >= '0' and *cp <= '9')
+            ++cp;
+    }
+
+    if (*cp == 'e' or *cp == 'E') {
+        integral = false;
+        ++cp;
+        if (*cp == '+' or *cp == '-')
+            ++cp;
+        if (not (*cp >= '0' and *cp <= '9')) {
+            r->at = cp;
+            fail (Error_Bad_Json(r));
+        }
+        while (*cp >= '0' and *cp <= '9')
+            ++cp;
+    }
+
+    REBLEN len = cp - r->at;
+
+    if (integral and num_digits <= 18)
+        Init_Integer(out, negative ? -cast(REBI64, u) : cast(REBI64, u));
+    else if (not (integral and Scan_Integer(out, r->at, len))) {
+        if (not Scan_Decimal(out, r->at, len, true))  // e.g. too long
+            fail (Error_Bad_Json(r));
+    }
+
+    r->at = cp;
+}
+
+
+static void Decode_Json_Value(JSON_READER *r, RELVAL *out)
+{
+    if (C_STACK_OVERFLOWING(&r))
+        Fail_Stack_Overflow();
+
+    r->at = Skip_Json_Space(r->at);
+
+    switch (*r->at) {
+      case '"':
+        Decode_Json_String(r, out);
+        return;
+
+      case '[': {
+        r->at = Skip_Json_Space(r->at + 1);
+        REBDSP dsp_orig = DSP;
+        if (*r->at != ']') {
+            DECLARE_LOCAL (item);
+            while (true) {
+                Decode_Json_Value(r, item);
+                Move_Cell(DS_PUSH(), item);  // decoding may expand the stack
+
+                r->at = Skip_Json_Space(r->at);
+                if (*r->at == ']')
+                    break;
+                if (*r->at != ',')
+                    fail (Error_Bad_Json(r));
+                ++r->at;
+            }
+        }
+        ++r->at;
+        Init_Block(out, Pop_Stack_Values(dsp_orig));
+        return; }
+
+      case '{': {
+        r->at = Skip_Json_Space(r->at + 1);
+        REBDSP dsp_orig = DSP;
+        if (*r->at != '}') {
+            DECLARE_LOCAL (item);
+            while (true) {
+                r->at = Skip_Json_Space(r->at);
+                if (*r->at != '"')
+                    fail (Error_Bad_Json(r));
+                Decode_Json_String(r, item);
+                Move_Cell(DS_PUSH(), item);
+
+                r->at = Skip_Json_Space(r->at);
+                if (*r->at != ':')
+                    fail (Error_Bad_Json(r));
+                ++r->at;
+
+                Decode_Json_Value(r, item);
+                Move_Cell(DS_PUSH(), item);
+
+                r->at = Skip_Json_Space(r->at);
+                if (*r->at == '}')
+                    break;
+                if (*r->at != ',')
+                    fail (Error_Bad_Json(r));
+                ++r->at;
+            }
+        }
+        ++r->at;
+
+        // Keys are compared case-sensitively, and a repeated key replaces
+        // the earlier value (as most JSON decoders do).
+        //
+        REBMAP *map = Make_Map((DSP - dsp_orig) / 2);
+        REBDSP dsp;
+        for (dsp = dsp_orig + 1; dsp < DSP; dsp += 2)
+            Find_Map_Entry(
+                map, DS_AT(dsp), SPECIFIED, DS_AT(dsp + 1), SPECIFIED, true
+            );
+        DS_DROP_TO(dsp_orig);
+        Init_Map(out, map);
+        return; }
+
+      case 't':
+        if (strncmp(cs_cast(r->at), "true", 4) != 0)
+            break;
+        r->at += 4;
+        Init_True(out);
+        return;
+
+      case 'f':
+        if (strncmp(cs_cast(r->at), "false", 5) != 0)
+            break;
+        r->at += 5;
+        Init_False(out);
+        return;
+
+      case 'n':
+        if (strncmp(cs_cast(r->at), "null", 4) != 0)
+            break;
+        r->at += 4;
+        Init_Blank(out);
+        return;
+
+      case '-':
+      case '0': case '1': case '2': case '3': case '4':
+      case '5': case '6': case '7': case '8': case '9':
+        Decode_Json_Number(r, out);
+        return;
+
+      default:
+        break;
+    }
+
+    fail (Error_Bad_Json(r));
+}
+
+
+//
+//  decode-json: native [
+//
+//  {Convert JSON to BLOCK!, MAP!, TEXT!, INTEGER!, DECIMAL!, LOGIC!, BLANK!}
+//
+//      return: "Decoded value (null if NEXT was requested and at end)"
+//          [<opt> blank! logic! integer! decimal! text! block! map!]
+//      next: "<output> Decode one value and give back the next position"
+//          [<opt> text! binary!]
+//
+//      source "JSON text (if BINARY!, must be UTF-8)"
+//          [text! binary!]
+//  ]
+//
+REBNATIVE(decode_json)
+{
+    INCLUDE_PARAMS_OF_DECODE_JSON;
+
+    REBVAL *source = ARG(source);
+
+    REBSIZ size;
+    const REBYTE *bp = VAL_BYTES_AT(&size, source);
+
+    JSON_READER r;
+    r.head = IS_BINARY(source) ? BIN_HEAD(VAL_BINARY(source)) : bp;
+    r.at = bp;
+    r.end = bp + size;
+    assert(*r.end == '\0');  // series are terminated, the seeks rely on it
+
+    r.at = Skip_Json_Space(r.at);
+    if (REF(next) and r.at == r.end)
+        Init_Nulled(D_OUT);  // nothing left in the stream
+    else {
+        Decode_Json_Value(&r, D_OUT);
+        r.at = Skip_Json_Space(r.at);
+        if (r.at != r.end and not REF(next))
+            fail (Error_Bad_Json(&r));  // extra content after the value
+    }
+
+    if (REF(next) and not Is_Blackhole(ARG(next))) {
+        REBVAL *var = Sink_Word_May_Fail(ARG(next), SPECIFIED);
+        Copy_Cell(var, source);
+
+        if (IS_BINARY(var))
+            VAL_INDEX_UNBOUNDED(var) += r.at - bp;
+        else
+            VAL_INDEX_RAW(var) += Num_Codepoints_For_Bytes(bp, r.at);
+    }
+
+    return D_OUT;
+}
+
+
+//=//// ENCODING //////////////////////////////////////////////////////////=//
+
+// Append UTF-8 as a JSON string, quoted and escaped.  Non-ASCII codepoints
+// are left as UTF-8.  If `terminated` the seek can be used, since it needs a
+// NUL at `utf8 + size` (series data has one, ISSUE!s held in cells don't).
+//
+static void Encode_Json_String(
+    REB_MOLD *mo,
+    const REBYTE *utf8,
+    REBSIZ size,
+    bool terminated
+){
+    const REBYTE *cp = utf8;
+    const REBYTE *end = utf8 + size;
+
+    Append_Codepoint(mo->series, '"');
+    while (cp != end) {
+        const REBYTE *special;
+        if (terminated)
+            special = Seek_Json_String_Special(cp);
+        else {
+            special = cp;
+            while (
+                special != end and *special >= 0x20 and *special < 0x80
+                and *special != '"' and *special != '\\'
+            ){
+                ++special;
+            }
+        }
+        if (special != cp) {
+            Append_Ascii_Len(mo->series, cs_cast(cp), special - cp);
+            cp = special;
+            continue;  // may be at the end
+        }
+
+        REBUNI c = *cp;
+        if (c >= 0x80) {
+            cp = Back_Scan_UTF8_Char_Unchecked(&c, cp);
+            ++cp;
+            Append_Codepoint(mo->series, c);
+            continue;
+        }
+
+        ++cp;
+        switch (c) {
+          case '"': Append_Ascii(mo->series, "\\\""); break;
+          case '\\': Append_Ascii(mo->series, "\\\\"); break;
+          case BS: Append_Ascii(mo->series, "\\b"); break;
+          case '\f': Append_Ascii(mo->series, "\\f"); break;
+          case LF: Append_Ascii(mo->series, "\\n"); break;
+          case CR: Append_Ascii(mo->series, "\\r"); break;
+          case '\t': Append_Ascii(mo->series, "\\t"); break;
+
+          default: {
+            assert(c < 0x20);
+            char buf[7];
+            snprintf(buf, sizeof(buf), "\\u%04X", cast(unsigned int, c));
+            Append_Ascii(mo->series, buf); }
+        }
+    }
+    Append_Codepoint(mo->series, '"');
+}
+
+
+static void Encode_Json_Text(REB_MOLD *mo, REBCEL(const*) v)
+{
+    REBSIZ size;
+    REBCHR(const*) utf8 = VAL_UTF8_SIZE_AT(&size, v);
+    Encode_Json_String(
+        mo, cast(const REBYTE*, utf8), size, CELL_HEART(v) != REB_BYTES
+    );
+}
+
+
+inline static bool Is_Json_Stringlike(enum Reb_Kind kind)
+  { return ANY_STRING_KIND(kind) or ANY_WORD_KIND(kind) or kind == REB_ISSUE; }
+
+
+static void Encode_Json_Value(
+    REB_MOLD *mo,
+    const RELVAL *v,
+    REBSPC *specifier
+){
+    if (C_STACK_OVERFLOWING(&v))  // e.g. a block that contains itself
+        Fail_Stack_Overflow();
+
+    enum Reb_Kind kind = VAL_TYPE(v);
+    if (Is_Json_Stringlike(kind)) {
+        Encode_Json_Text(mo, v);
+        return;
+    }
+
+    switch (kind) {
+      case REB_BLANK:
+        Append_Ascii(mo->series, "null");
+        break;
+
+      case REB_LOGIC:
+        Append_Ascii(mo->series, VAL_LOGIC(v) ? "true" : "false");
+        break;
+
+      case REB_INTEGER:
+        Mold_Value(mo, v);
+        break;
+
+      case REB_DECIMAL:
+      case REB_PERCENT: {
+        if (not FINITE(VAL_DECIMAL(v)))
+            fail (Error_Bad_Value_Core(v, specifier));  // no NaN in JSON
+
+        REBSTR *s = mo->series;
+        REBLEN len = STR_LEN(s);
+        REBSIZ size = STR_SIZE(s);
+        REBYTE *bp = Prep_Mold_Overestimated(mo, MAX_NUMCHR);
+        REBINT n = Emit_Decimal(bp, VAL_DECIMAL(v), 0, '.', MAX_DIGITS);
+        TERM_STR_LEN_SIZE(s, len + n, size + n);
+        break; }
+
+      case REB_DATE:
+      case REB_TIME:
+      case REB_TUPLE:
+      case REB_MONEY:
+      case REB_PAIR:  // FORMs of these have no quotes or backslashes
+        Append_Codepoint(mo->series, '"');
+        Form_Value(mo, v);
+        Append_Codepoint(mo->series, '"');
+        break;
+
+      case REB_BLOCK: {
+        Append_Codepoint(mo->series, '[');
+        const RELVAL *tail;
+        const RELVAL *item = VAL_ARRAY_AT(&tail, v);
+        REBSPC *derived = Derive_Specifier(specifier, v);
+        bool first = true;
+        for (; item != tail; ++item) {
+            if (not first)
+                Append_Codepoint(mo->series, ',');
+            first = false;
+            Encode_Json_Value(mo, item, derived);
+        }
+        Append_Codepoint(mo->series, ']');
+        break; }
+
+      case REB_MAP: {
+        Append_Codepoint(mo->series, '{');
+        const REBARR *pairlist = MAP_PAIRLIST(VAL_MAP(v));
+        const RELVAL *tail = ARR_TAIL(pairlist);
+        const RELVAL *pair = ARR_HEAD(pairlist);
+        bool first = true;
+        for (; pair != tail; pair += 2) {
+            if (IS_NULLED(pair + 1))  // removed, see Length_Map()
+                continue;
+
+            if (not first)
+                Append_Codepoint(mo->series, ',');
+            first = false;
+
+            enum Reb_Kind key_kind = VAL_TYPE(pair);
+            if (Is_Json_Stringlike(key_kind))
+                Encode_Json_Text(mo, pair);
+            else if (key_kind == REB_INTEGER) {  // JSON keys must be strings
+                Append_Codepoint(mo->series, '"');
+                Mold_Value(mo, pair);
+                Append_Codepoint(mo->series, '"');
+            }
+            else
+                fail (Error_Bad_Value_Core(pair, SPECIFIED));
+
+            Append_Codepoint(mo->series, ':');
+            Encode_Json_Value(mo, pair + 1, SPECIFIED);
+        }
+        Append_Codepoint(mo->series, '}');
+        break; }
+
+      case REB_OBJECT: {
+        Append_Codepoint(mo->series, '{');
+        REBCTX *c = VAL_CONTEXT(v);
+        REBLEN len = CTX_LEN(c);
+        bool first = true;
+        REBLEN n;
+        for (n = 1; n <= len; ++n) {
+            if (Is_Var_Hidden(CTX_VAR(c, n)))
+                continue;
+
+            if (not first)
+                Append_Codepoint(mo->series, ',');
+            first = false;
+
+            const REBSTR *spelling = KEY_SYMBOL(CTX_KEY(c, n));
+            Encode_Json_String(
+                mo, cb_cast(STR_UTF8(spelling)), STR_SIZE(spelling), true
+            );
+            Append_Codepoint(mo->series, ':');
+
+            const REBVAL *var = CTX_VAR(c, n);
+            if (IS_NULLED(var))
+                Append_Ascii(mo->series, "null");
+            else
+                Encode_Json_Value(mo, var, SPECIFIED);
+        }
+        Append_Codepoint(mo->series, '}');
+        break; }
+
+      default:
+        fail (Error_Bad_Value_Core(v, specifier));
+    }
+}
+
+
+//
+//  encode-json: native [
+//
+//  {Convert a value to JSON text (see DECODE-JSON for how types map)}
+//
+//      return: [text!]
+//      value "Can't contain ACTION!, PORT! and the like"
+//          [<opt> any-value!]
+//  ]
+//
+REBNATIVE(encode_json)
+{
+    INCLUDE_PARAMS_OF_ENCODE_JSON;
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    if (IS_NULLED(ARG(value)))
+        Append_Ascii(mo->series, "null");
+    else
+        Encode_Json_Value(mo, ARG(value), SPECIFIED);
+
+    return Init_Text(D_OUT, Pop_Molded_String(mo));
+}
@@ -0,0 +1,928 @@
+//
+//  File: %l-rebin.c
+//  Summary: "compact binary serialization of values (REBIN codec)"
+//  Section: lexical
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// SAVE of data as molded text means LOAD has to scan all of it back.  The
+// REBIN format is for data that's only exchanged between programs (caches,
+// messages between processes): ENCODE-REBIN writes a value in a compact
+// binary form, and DECODE-REBIN rebuilds it without the scanner.  They are
+// registered as the `rebin` codec (see %sys-codec.r), so that:
+//
+//     save %data.rebin value
+//     value: load %data.rebin
+//
+// The format is:
+//
+//     "RBN" version-byte
+//     spelling-count  (spelling-size spelling-utf8)*
+//     item
+//
+// Sizes and counts are unsigned LEB128 "varints" (as in %l-cache.c).  An item
+// is a flags byte (newline-before, isotope), its quote level, a tag byte,
+// and a payload depending on the tag.  Words, BAD-WORD!s and object keys
+// refer to spellings by their position in the table.
+//
+// Series, objects and maps get a number in the order they are first written.
+// If one is reached again (shared, or a cycle) only its number is written,
+// so it is the same series after decoding.  A series payload is a varint of
+// 0 followed by its content from the head, or that number plus 1 for a
+// repeat...either way followed by the index of the reference.
+//
+// Types that are usually just a few bytes as text (DATE!, PAIR!, TUPLE!,
+// PATH!, BITSET!...) are saved as their MOLD/ALL and scanned individually.
+// Values that can't be saved at all (ACTION!, PORT!, HANDLE!...) are errors.
+// Words come back unbound, as LOAD would give them.
+//
+// The tags are not the interpreter's Reb_Kind numbers, which may change
+// between builds; new tags only go at the end of Rebin_Kinds[].
+//
+// !!! Strings and binaries are copied out of the buffer when decoding.  An
+// aligned layout that could be used in place from a mapped file would need
+// series whose data isn't owned, which only BINARY_FLAG_MAPPED binaries have.
+//
+
+#include "sys-core.h"
+
+#include "datatypes/sys-money.h"
+
+
+#define REBIN_VERSION 1
+
+#define REBIN_TAG_MOLDED 0xFF  // MOLD/ALL of the value, scanned on decode
+
+#define REBIN_FLAG_NEWLINE_BEFORE 0x01
+#define REBIN_FLAG_ISOTOPE 0x02
+
+static const REBYTE Rebin_Kinds[] = {
+    REB_NULL,  // only in objects, or quoted
+    REB_BLANK,
+    REB_LOGIC,
+    REB_INTEGER,
+    REB_DECIMAL,
+    REB_PERCENT,
+    REB_MONEY,
+    REB_TIME,
+    REB_ISSUE,
+    REB_COMMA,
+    REB_BAD_WORD,
+    REB_WORD,
+    REB_SET_WORD,
+    REB_GET_WORD,
+    REB_META_WORD,
+    REB_TEXT,
+    REB_FILE,
+    REB_EMAIL,
+    REB_URL,
+    REB_TAG,
+    REB_BINARY,
+    REB_BLOCK,
+    REB_SET_BLOCK,
+    REB_GET_BLOCK,
+    REB_META_BLOCK,
+    REB_GROUP,
+    REB_SET_GROUP,
+    REB_GET_GROUP,
+    REB_META_GROUP,
+    REB_OBJECT,
+    REB_MAP
+};
+
+#define NUM_REBIN_KINDS \
+    (sizeof(Rebin_Kinds) / sizeof(Rebin_Kinds[0]))
+
+
+
+//=//// ENCODING //////////////////////////////////////////////////////////=//
+
+// Series (and contexts, and maps) already written, by node address.  It's
+// a hash table with open addressing, of twice the capacity needed or more.
+//
+struct Reb_Rebin_Seen {
+    const void *node;
+    REBLEN number;
+};
+
+typedef struct rebol_rebin_encoder {
+    REBBIN *bin;  // accumulates the item (the spelling table goes first)
+    struct Reb_Binder binder;  // symbol => 1-based spelling table position
+    REBDSP dsp_orig;  // spellings are pushed as WORD!s above this, in order
+    struct Reb_Rebin_Seen *seen;
+    REBLEN seen_capacity;  // power of 2
+    REBLEN num_seen;
+    enum Reb_Kind unsupported;  // REB_0, or first kind that couldn't be saved
+} REBIN_ENCODER;
+
+
+static void Emit_Bytes(REBIN_ENCODER *enc, const REBYTE *data, REBSIZ size)
+{
+    REBLEN old_len = BIN_LEN(enc->bin);
+    EXPAND_SERIES_TAIL(enc->bin, size);
+    memcpy(BIN_AT(enc->bin, old_len), data, size);
+    TERM_BIN_LEN(enc->bin, old_len + size);
+}
+
+static void Emit_Byte(REBIN_ENCODER *enc, REBYTE b)
+  { Emit_Bytes(enc, &b, 1); }
+
+static void Emit_Varint(REBIN_ENCODER *enc, uint64_t u)
+{
+    REBYTE buf[10];
+    REBLEN n = 0;
+    do {
+        buf[n] = u & 0x7F;
+        u >>= 7;
+        if (u != 0)
+            buf[n] |= 0x80;
+        ++n;
+    } while (u != 0);
+    Emit_Bytes(enc, buf, n);
+}
+
+static void Emit_U64_LE(REBIN_ENCODER *enc, uint64_t u)
+{
+    REBYTE buf[8];
+    REBLEN i;
+    for (i = 0; i < 8; ++i, u >>= 8)
+        buf[i] = u & 0xFF;
+    Emit_Bytes(enc, buf, 8);
+}
+
+static void Emit_Spelling(REBIN_ENCODER *enc, const REBSYM *symbol)
+{
+    REBINT index = Get_Binder_Index_Else_0(&enc->binder, symbol);
+    if (index == 0) {
+        Init_Word(DS_PUSH(), symbol);
+        index = DSP - enc->dsp_orig;
+        Add_Binder_Index(&enc->binder, symbol, index);
+    }
+    Emit_Varint(enc, index - 1);
+}
+
+
+// Write the number of `node` plus 1 if it was seen before, and give back
+// true.  Else number it and write 0, and give back false (the caller then
+// writes its content).
+//
+static bool Emit_Seen(REBIN_ENCODER *enc, const void *node)
+{
+    REBLEN mask = enc->seen_capacity - 1;
+    REBLEN slot = cast(REBLEN, cast(uintptr_t, node) >> 4) & mask;
+    for (; enc->seen[slot].node; slot = (slot + 1) & mask) {
+        if (enc->seen[slot].node == node) {
+            Emit_Varint(enc, enc->seen[slot].number + 1);
+            return true;
+        }
+    }
+
+    enc->seen[slot].node = node;
+    enc->seen[slot].number = enc->num_seen++;
+    Emit_Varint(enc, 0);
+
+    if (enc->num_seen * 2 > enc->seen_capacity) {  // keep it half empty
+        struct Reb_Rebin_Seen *old = enc->seen;
+        REBLEN old_capacity = enc->seen_capacity;
+
+        enc->seen_capacity *= 2;
+        enc->seen = TRY_ALLOC_N_ZEROFILL(
+            struct Reb_Rebin_Seen, enc->seen_capacity
+        );
+        if (not enc->seen)
+            fail (Error_No_Memory(enc->seen_capacity * sizeof(*old)));
+        mask = enc->seen_capacity - 1;
+
+        REBLEN i;
+        for (i = 0; i < old_capacity; ++i) {
+            if (not old[i].node)
+                continue;
+            slot = cast(REBLEN, cast(uintptr_t, old[i].node) >> 4) & mask;
+            while (enc->seen[slot].node)
+                slot = (slot + 1) & mask;
+            enc->seen[slot] = old[i];
+        }
+        FREE_N(struct Reb_Rebin_Seen, old_capacity, old);
+    }
+    return false;
+}
+
+
+static void Encode_Rebin_Item(
+    REBIN_ENCODER *enc,
+    const RELVAL *item,
+    REBSPC *specifier
+);
+
+static void Encode_Rebin_Array(
+    REBIN_ENCODER *enc,
+    const REBARR *a,
+    REBSPC *specifier
+){
+    if (Emit_Seen(enc, a))
+        return;
+
+    Emit_Varint(enc, ARR_LEN(a));
+    Emit_Byte(enc, Has_Newline_At_Tail(a) ? 1 : 0);
+
+    const RELVAL *tail = ARR_TAIL(a);
+    const RELVAL *item = ARR_HEAD(a);
+    for (; item != tail; ++item)
+        Encode_Rebin_Item(enc, item, specifier);
+}
+
+static void Encode_Rebin_Item(
+    REBIN_ENCODER *enc,
+    const RELVAL *item,
+    REBSPC *specifier
+){
+    if (enc->unsupported != REB_0)
+        return;
+
+    DECLARE_LOCAL (temp);
+    Derelativize(temp, item, specifier);
+    REBLEN quotes = Dequotify(temp);
+
+    REBYTE flags = 0;
+    if (GET_CELL_FLAG(item, NEWLINE_BEFORE))
+        flags |= REBIN_FLAG_NEWLINE_BEFORE;
+    if (GET_CELL_FLAG(temp, ISOTOPE))
+        flags |= REBIN_FLAG_ISOTOPE;
+
+    Emit_Byte(enc, flags);
+    Emit_Varint(enc, quotes);
+
+    enum Reb_Kind kind = VAL_TYPE(temp);
+    REBYTE tag = REBIN_TAG_MOLDED;
+    if (KIND3Q_BYTE(temp) == HEART_BYTE(temp)) {  // e.g. not a SET-PATH!
+        REBLEN i;
+        for (i = 0; i < NUM_REBIN_KINDS; ++i) {
+            if (Rebin_Kinds[i] == kind) {
+                tag = i;
+                break;
+            }
+        }
+    }
+
+    switch (kind) {
+      case REB_ACTION:
+      case REB_FRAME:
+      case REB_PORT:
+      case REB_MODULE:
+      case REB_ERROR:
+      case REB_HANDLE:
+      case REB_VARARGS:
+      case REB_EVENT:
+      case REB_CUSTOM:
+        enc->unsupported = kind;
+        return;
+
+      default:
+        break;
+    }
+
+    if (tag == REBIN_TAG_MOLDED)
+        goto molded;
+
+    Emit_Byte(enc, tag);
+
+    if (ANY_WORD_KIND(kind)) {
+        Emit_Spelling(enc, VAL_WORD_SYMBOL(temp));
+        return;
+    }
+
+    if (ANY_ARRAY_KIND(kind)) {
+        Encode_Rebin_Array(enc, VAL_ARRAY(temp), VAL_SPECIFIER(temp));
+        Emit_Varint(enc, VAL_INDEX(temp));
+        return;
+    }
+
+    if (ANY_STRING_KIND(kind) or kind == REB_BINARY) {
+        const REBSER *s = VAL_SERIES(temp);
+        if (not Emit_Seen(enc, s)) {
+            Emit_Varint(enc, SER_USED(s));
+            Emit_Bytes(enc, SER_DATA(s), SER_USED(s));
+        }
+        Emit_Varint(enc, VAL_INDEX(temp));
+        return;
+    }
+
+    switch (kind) {
+      case REB_NULL:
+      case REB_BLANK:
+      case REB_COMMA:
+        break;
+
+      case REB_LOGIC:
+        Emit_Byte(enc, VAL_LOGIC(temp) ? 1 : 0);
+        break;
+
+      case REB_INTEGER: {
+        REBI64 i = VAL_INT64(temp);
+        Emit_Varint(  // "zigzag" so small negative numbers stay small
+            enc,
+            (cast(uint64_t, i) << 1) ^ cast(uint64_t, i >> 63)
+        );
+        break; }
+
+      case REB_DECIMAL:
+      case REB_PERCENT: {  // saved exactly (mold may lose digits)
+        REBDEC d = VAL_DECIMAL(temp);
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        Emit_U64_LE(enc, bits);
+        break; }
+
+      case REB_MONEY: {
+        REBYTE buf[12];
+        deci_to_binary(buf, VAL_MONEY_AMOUNT(temp));
+        Emit_Bytes(enc, buf, 12);
+        break; }
+
+      case REB_TIME:
+        Emit_U64_LE(enc, cast(uint64_t, VAL_NANO(temp)));
+        break;
+
+      case REB_ISSUE: {
+        REBSIZ size;
+        REBCHR(const*) utf8 = VAL_UTF8_SIZE_AT(&size, temp);
+        Emit_Varint(enc, size);
+        Emit_Bytes(enc, utf8, size);
+        break; }
+
+      case REB_BAD_WORD:
+        Emit_Spelling(enc, VAL_BAD_WORD_LABEL(temp));
+        break;
+
+      case REB_OBJECT: {
+        REBCTX *c = VAL_CONTEXT(temp);
+        if (Emit_Seen(enc, CTX_VARLIST(c)))
+            break;
+        REBLEN len = CTX_LEN(c);
+        Emit_Varint(enc, len);
+        REBLEN n;
+        for (n = 1; n <= len; ++n) {
+            Emit_Spelling(enc, KEY_SYMBOL(CTX_KEY(c, n)));
+            Encode_Rebin_Item(enc, CTX_VAR(c, n), SPECIFIED);
+        }
+        break; }
+
+      case REB_MAP: {
+        const REBARR *pairlist = MAP_PAIRLIST(VAL_MAP(temp));
+        if (Emit_Seen(enc, pairlist))
+            break;
+        Emit_Varint(enc, Length_Map(VAL_MAP(temp)));
+        const RELVAL *tail = ARR_TAIL(pairlist);
+        const RELVAL *pair = ARR_HEAD(pairlist);
+        for (; pair != tail; pair += 2) {
+            if (IS_NULLED(pair + 1))  // removed, see Length_Map()
+                continue;
+            Encode_Rebin_Item(enc, pair, SPECIFIED);
+            Encode_Rebin_Item(enc, pair + 1, SPECIFIED);
+        }
+        break; }
+
+      default:
+        assert(false);
+    }
+    return;
+
+  molded: {
+    DECLARE_MOLD (mo);
+    SET_MOLD_FLAG(mo, MOLD_FLAG_ALL);
+    Push_Mold(mo);
+    Mold_Value(mo, temp);
+
+    REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+    Emit_Byte(enc, REBIN_TAG_MOLDED);
+    Emit_Varint(enc, size);
+    Emit_Bytes(enc, cb_cast(STR_UTF8(mo->series)) + mo->offset, size);
+    Emit_Byte(enc, '\0');  // the scanner needs its input NUL-terminated
+
+    Drop_Mold(mo); }
+}
+
+
+//
+//  encode-rebin: native [
+//
+//  {Save a value in the compact binary REBIN format (see DECODE-REBIN)}
+//
+//      return: [binary!]
+//      value "Can't contain ACTION!, PORT!, HANDLE! and the like"
+//          [any-value!]
+//  ]
+//
+REBNATIVE(encode_rebin)
+{
+    INCLUDE_PARAMS_OF_ENCODE_REBIN;
+
+    REBIN_ENCODER enc;
+    enc.bin = Make_Binary(256);
+    INIT_BINDER(&enc.binder);
+    enc.dsp_orig = DSP;
+    enc.seen_capacity = 64;
+    enc.seen = TRY_ALLOC_N_ZEROFILL(struct Reb_Rebin_Seen, enc.seen_capacity);
+    if (not enc.seen)
+        fail (Error_No_Memory(enc.seen_capacity * sizeof(*enc.seen)));
+    enc.num_seen = 0;
+    enc.unsupported = REB_0;
+
+    Encode_Rebin_Item(&enc, ARG(value), SPECIFIED);
+
+    FREE_N(struct Reb_Rebin_Seen, enc.seen_capacity, enc.seen);
+
+    REBLEN num_spellings = DSP - enc.dsp_orig;
+    REBBIN *item = enc.bin;
+
+    enc.bin = Make_Binary(BIN_LEN(item) + num_spellings * 8 + 16);
+    Emit_Bytes(&enc, cb_cast("RBN"), 3);
+    Emit_Byte(&enc, REBIN_VERSION);
+    Emit_Varint(&enc, num_spellings);
+
+    REBDSP dsp;
+    for (dsp = enc.dsp_orig + 1; dsp <= DSP; ++dsp) {
+        const REBSYM *symbol = VAL_WORD_SYMBOL(DS_AT(dsp));
+        Emit_Varint(&enc, STR_SIZE(symbol));
+        Emit_Bytes(&enc, cb_cast(STR_UTF8(symbol)), STR_SIZE(symbol));
+        Remove_Binder_Index(&enc.binder, symbol);
+    }
+    DS_DROP_TO(enc.dsp_orig);
+    SHUTDOWN_BINDER(&enc.binder);
+
+    if (enc.unsupported != REB_0) {  // binder had to be cleaned up first
+        Free_Unmanaged_Series(item);
+        Free_Unmanaged_Series(enc.bin);
+        fail (Error_Invalid_Type(enc.unsupported));
+    }
+
+    Emit_Bytes(&enc, BIN_HEAD(item), BIN_LEN(item));
+    Free_Unmanaged_Series(item);
+
+    return Init_Binary(D_OUT, enc.bin);
+}
+
+
+//=//// DECODING //////////////////////////////////////////////////////////=//
+//
+// Reads are bounds checked, and anything that doesn't make sense gives back
+// false (the native fails).  The series made so far are kept on the data
+// stack, above the spellings, so that repeats can find them.
+//
+
+typedef struct rebol_rebin_reader {
+    const REBYTE *at;
+    const REBYTE *limit;
+    REBDSP dsp_spellings;  // spellings pushed as WORD!s above this
+    REBLEN num_spellings;
+    REBDSP dsp_seen;  // series pushed in the order they were numbered
+} REBIN_READER;
+
+
+static bool Take_Byte(REBIN_READER *r, REBYTE *out)
+{
+    if (r->at == r->limit)
+        return false;
+    *out = *r->at++;
+    return true;
+}
+
+static bool Take_Varint(REBIN_READER *r, uint64_t *out)
+{
+    uint64_t u = 0;
+    REBLEN shift = 0;
+    REBYTE b;
+    do {
+        if (shift >= 64 or not Take_Byte(r, &b))
+            return false;
+        u |= cast(uint64_t, b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+    *out = u;
+    return true;
+}
+
+static bool Take_Bytes(REBIN_READER *r, const REBYTE **out, uint64_t size)
+{
+    if (size > cast(uint64_t, r->limit - r->at))
+        return false;
+    *out = r->at;
+    r->at += size;
+    return true;
+}
+
+static bool Take_U64_LE(REBIN_READER *r, uint64_t *out)
+{
+    const REBYTE *bp;
+    if (not Take_Bytes(r, &bp, 8))
+        return false;
+    uint64_t u = 0;
+    REBLEN i;
+    for (i = 8; i > 0; --i)
+        u = (u << 8) | bp[i - 1];
+    *out = u;
+    return true;
+}
+
+static bool Take_Spelling(REBIN_READER *r, const REBSYM **out)
+{
+    uint64_t index;
+    if (not Take_Varint(r, &index) or index >= r->num_spellings)
+        return false;
+    *out = VAL_WORD_SYMBOL(DS_AT(r->dsp_spellings + 1 + index));
+    return true;
+}
+
+
+// A repeat gives back the earlier cell in `*seen`.  New content is for the
+// caller to read, after it pushes its series (in the same order as the
+// encoder numbered them).
+//
+static bool Take_Seen(REBIN_READER *r, const REBVAL **seen, enum Reb_Kind kind)
+{
+    uint64_t number;
+    if (not Take_Varint(r, &number))
+        return false;
+
+    if (number == 0) {
+        *seen = nullptr;
+        return true;
+    }
+
+    if (number > cast(uint64_t, DSP - r->dsp_seen))
+        return false;
+
+    *seen = DS_AT(r->dsp_seen + number);
+    return VAL_TYPE(*seen) == kind;
+}
+
+
+static bool Decode_Rebin_Item(REBIN_READER *r, RELVAL *out)
+{
+    REBYTE flags;
+    uint64_t quotes;
+    REBYTE tag;
+    if (
+        not Take_Byte(r, &flags)
+        or not Take_Varint(r, &quotes)
+        or not Take_Byte(r, &tag)
+    ){
+        return false;
+    }
+
+    if (tag == REBIN_TAG_MOLDED) {
+        uint64_t size;
+        const REBYTE *utf8;
+        if (
+            not Take_Varint(r, &size)
+            or not Take_Bytes(r, &utf8, size + 1)
+            or utf8[size] != '\0'
+        ){
+            return false;
+        }
+
+        REBARR *a = Scan_UTF8_Managed(ANONYMOUS, utf8, size);
+        if (ARR_LEN(a) != 1)
+            return false;
+        Derelativize(out, ARR_HEAD(a), SPECIFIED);
+        goto finished;
+    }
+
+    if (tag >= NUM_REBIN_KINDS)
+        return false;
+
+  blockscope {
+    enum Reb_Kind kind = cast(enum Reb_Kind, Rebin_Kinds[tag]);
+
+    if (ANY_WORD_KIND(kind)) {
+        const REBSYM *symbol;
+        if (not Take_Spelling(r, &symbol))
+            return false;
+        Init_Any_Word(out, kind, symbol);
+        goto finished;
+    }
+
+    if (ANY_ARRAY_KIND(kind)) {
+        const REBVAL *seen;
+        if (not Take_Seen(r, &seen, REB_BLOCK))
+            return false;
+
+        REBARR *a;
+        if (seen)
+            a = VAL_ARRAY_KNOWN_MUTABLE(seen);
+        else {
+            uint64_t len;
+            REBYTE newline_at_tail;
+            if (
+                not Take_Varint(r, &len)
+                or not Take_Byte(r, &newline_at_tail)
+                or len > cast(uint64_t, r->limit - r->at)  // items >= 3 bytes
+            ){
+                return false;
+            }
+
+            // The array is made before its items are, in case an item is
+            // a repeat of the array itself.
+            //
+            a = Make_Array_Core(
+                len,
+                newline_at_tail ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0
+            );
+            Init_Block(DS_PUSH(), a);
+
+            for (; len > 0; --len) {  // capacity was made, so no reallocation
+                RELVAL *slot = Init_Blank(Alloc_Tail_Array(a));
+                if (not Decode_Rebin_Item(r, slot))
+                    return false;
+            }
+        }
+
+        uint64_t index;  // may be past the tail if array is still being made
+        if (not Take_Varint(r, &index) or (not seen and index > ARR_LEN(a)))
+            return false;
+        Init_Any_Array_At(out, kind, a, index);
+        goto finished;
+    }
+
+    if (ANY_STRING_KIND(kind) or kind == REB_BINARY) {
+        enum Reb_Kind seen_kind = (kind == REB_BINARY) ? REB_BINARY : REB_TEXT;
+
+        const REBVAL *seen;
+        if (not Take_Seen(r, &seen, seen_kind))
+            return false;
+
+        REBSER *s;
+        if (seen)
+            s = VAL_SERIES_KNOWN_MUTABLE(seen);
+        else {
+            uint64_t size;
+            const REBYTE *data;
+            if (not Take_Varint(r, &size) or not Take_Bytes(r, &data, size))
+                return false;
+
+            if (kind == REB_BINARY) {
+                s = Make_Binary(size);
+                memcpy(BIN_HEAD(s), data, size);
+                TERM_BIN_LEN(BIN(s), size);
+                Init_Binary(DS_PUSH(), BIN(s));
+            }
+            else {
+                s = Append_UTF8_May_Fail(
+                    nullptr, cs_cast(data), size, STRMODE_ALL_CODEPOINTS
+                );
+                Init_Text(DS_PUSH(), STR(s));
+            }
+        }
+
+        uint64_t index;
+        if (not Take_Varint(r, &index))
+            return false;
+        if (index > (kind == REB_BINARY ? SER_USED(s) : STR_LEN(STR(s))))
+            return false;
+        if (kind == REB_BINARY)
+            Init_Binary_At(out, BIN(s), index);
+        else
+            Init_Any_String_At(out, kind, STR(s), index);
+        goto finished;
+    }
+
+    switch (kind) {
+      case REB_NULL:
+        Init_Nulled(out);
+        break;
+
+      case REB_BLANK:
+        Init_Blank(out);
+        break;
+
+      case REB_COMMA:
+        Init_Comma(out);
+        break;
+
+      case REB_LOGIC: {
+        REBYTE b;
+        if (not Take_Byte(r, &b))
+            return false;
+        Init_Logic(out, b != 0);
+        break; }
+
+      case REB_INTEGER: {
+        uint64_t u;
+        if (not Take_Varint(r, &u))
+            return false;
+        Init_Integer(out, cast(REBI64, (u >> 1) ^ (~(u & 1) + 1)));
+        break; }
+
+      case REB_DECIMAL:
+      case REB_PERCENT: {
+        uint64_t bits;
+        if (not Take_U64_LE(r, &bits))
+            return false;
+        REBDEC d;
+        memcpy(&d, &bits, sizeof(d));
+        if (kind == REB_DECIMAL)
+            Init_Decimal(out, d);
+        else
+            Init_Percent(out, d);
+        break; }
+
+      case REB_MONEY: {
+        const REBYTE *bp;
+        if (not Take_Bytes(r, &bp, 12))
+            return false;
+        Init_Money(out, binary_to_deci(bp));
+        break; }
+
+      case REB_TIME: {
+        uint64_t nano;
+        if (not Take_U64_LE(r, &nano))
+            return false;
+        Init_Time_Nanoseconds(out, cast(REBI64, nano));
+        break; }
+
+      case REB_ISSUE: {
+        uint64_t size;
+        const REBYTE *utf8;
+        if (not Take_Varint(r, &size) or not Take_Bytes(r, &utf8, size))
+            return false;
+        REBLEN len;
+        if (Seek_Invalid_Utf8(&len, utf8, utf8 + size) != utf8 + size)
+            return false;
+        Init_Issue_Utf8(out, utf8, size, len);
+        break; }
+
+      case REB_BAD_WORD: {
+        const REBSYM *label;
+        if (not Take_Spelling(r, &label))
+            return false;
+        Init_Bad_Word_Core(
+            out,
+            label,
+            (flags & REBIN_FLAG_ISOTOPE) ? CELL_FLAG_ISOTOPE : CELL_MASK_NONE
+        );
+        break; }
+
+      case REB_OBJECT: {
+        const REBVAL *seen;
+        if (not Take_Seen(r, &seen, REB_OBJECT))
+            return false;
+        if (seen) {
+            Copy_Cell(out, seen);
+            break;
+        }
+
+        uint64_t len;
+        if (
+            not Take_Varint(r, &len)
+            or len > cast(uint64_t, r->limit - r->at)
+        ){
+            return false;
+        }
+
+        REBCTX *c = Alloc_Context(REB_OBJECT, len);
+        Init_Object(DS_PUSH(), c);
+        for (; len > 0; --len) {
+            const REBSYM *symbol;
+            if (not Take_Spelling(r, &symbol))
+                return false;
+            REBVAR *var = Append_Context(c, nullptr, symbol);
+            if (not Decode_Rebin_Item(r, var))
+                return false;
+        }
+        Init_Object(out, c);
+        break; }
+
+      case REB_MAP: {
+        const REBVAL *seen;
+        if (not Take_Seen(r, &seen, REB_MAP))
+            return false;
+        if (seen) {
+            Copy_Cell(out, seen);
+            break;
+        }
+
+        uint64_t len;
+        if (
+            not Take_Varint(r, &len)
+            or len > cast(uint64_t, r->limit - r->at)
+        ){
+            return false;
+        }
+
+        REBMAP *map = Make_Map(len);
+        Init_Map(DS_PUSH(), map);
+
+        DECLARE_LOCAL (key);
+        DECLARE_LOCAL (value);
+        for (; len > 0; --len) {
+            if (
+                not Decode_Rebin_Item(r, key)
+                or not Decode_Rebin_Item(r, value)
+                or IS_NULLED(key)
+                or IS_NULLED(value)
+            ){
+                return false;
+            }
+            Find_Map_Entry(map, key, SPECIFIED, value, SPECIFIED, true);
+        }
+        Init_Map(out, map);
+        break; }
+
+      default:
+        return false;
+    }
+  }
+
+  finished:
+    if (flags & REBIN_FLAG_ISOTOPE and not IS_BAD_WORD(out))
+        return false;
+
+    if (quotes > 0)
+        Quotify(out, quotes);
+
+    if (flags & REBIN_FLAG_NEWLINE_BEFORE)
+        SET_CELL_FLAG(out, NEWLINE_BEFORE);
+
+    return true;
+}
+
+
+//
+//  decode-rebin: native [
+//
+//  {Rebuild a value saved with ENCODE-REBIN}
+//
+//      return: [<opt> any-value!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(decode_rebin)
+{
+    INCLUDE_PARAMS_OF_DECODE_REBIN;
+
+    REBSIZ size;
+    const REBYTE *bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+    if (size < 4 or memcmp(bp, "RBN", 3) != 0)
+        fail ("Data is not in REBIN format");
+    if (bp[3] != REBIN_VERSION)
+        fail ("Data is from an unknown version of the REBIN format");
+
+    REBIN_READER r;
+    r.at = bp + 4;
+    r.limit = bp + size;
+    r.dsp_spellings = DSP;
+
+    uint64_t num_spellings;
+    if (
+        not Take_Varint(&r, &num_spellings)
+        or num_spellings > cast(uint64_t, r.limit - r.at)
+    ){
+        goto damaged;
+    }
+
+    for (r.num_spellings = 0; r.num_spellings < num_spellings;) {
+        uint64_t spelling_size;
+        const REBYTE *utf8;
+        if (
+            not Take_Varint(&r, &spelling_size)
+            or not Take_Bytes(&r, &utf8, spelling_size)
+        ){
+            goto damaged;
+        }
+        const REBSYM *symbol = Intern_UTF8_Managed(utf8, spelling_size);
+        if (not symbol)
+            goto damaged;
+        Init_Word(DS_PUSH(), symbol);
+        ++r.num_spellings;
+    }
+
+    r.dsp_seen = DSP;
+
+    if (not Decode_Rebin_Item(&r, D_OUT) or r.at != r.limit)
+        goto damaged;
+
+    DS_DROP_TO(r.dsp_spellings);
+
+    if (GET_CELL_FLAG(D_OUT, NEWLINE_BEFORE))
+        CLEAR_CELL_FLAG(D_OUT, NEWLINE_BEFORE);
+    return D_OUT;
+
+  damaged:
+    DS_DROP_TO(r.dsp_spellings);
+    fail ("REBIN data is damaged or truncated");
+}
@@ -39,6 +39,8 @@
 
 #include "sys-core.h"
 
+#include "sys-seek.h"
+
 static inline bool Is_Dot_Or_Slash(char c)
   { return c == '/' or c == '.'; }
 
@@ -293,6 +295,90 @@ const REBYTE Lower_Case[256] =
 #endif
 
 
+//=//// BULK BYTE SEEKING /////////////////////////////////////////////////=//
+//
+// On large inputs, much of the scanner's time goes to long runs of bytes that
+// need no individual attention: the bodies of comments, the plain ASCII in
+// string literals, indentation.  These helpers find the end of such a run a
+// vector at a time using Seek_First_Stop() from %sys-seek.h, or a byte at a
+// time if the platform has no vector support.
+//
+
+#if !defined(SCAN_SCALAR)
+
+static inline ScanBits Line_End_Stops(ScanVec v) {
+    return SCAN_BITS(SCAN_OR(
+        SCAN_EQ(v, '\0'),
+        SCAN_OR(SCAN_EQ(v, LF), SCAN_EQ(v, CR))
+    ));
+}
+
+static inline ScanBits Non_Space_Stops(ScanVec v)
+  { return SCAN_BITS(SCAN_EQ(v, ' ')) ^ SCAN_ALL_BITS; }
+
+static inline ScanBits String_Special_Stops(ScanVec v) {
+    return SCAN_BITS(SCAN_OR(
+        SCAN_OR(
+            SCAN_OR(SCAN_EQ(v, '\0'), SCAN_HIGH(v)),
+            SCAN_OR(SCAN_EQ(v, LF), SCAN_EQ(v, CR))
+        ),
+        SCAN_OR(
+            SCAN_OR(SCAN_EQ(v, '"'), SCAN_EQ(v, '^')),
+            SCAN_OR(SCAN_EQ(v, '{'), SCAN_EQ(v, '}'))
+        )
+    ));
+}
+
+#endif
+
+
+// Find the first NUL, CR, or LF at or after `cp`.
+//
+static inline const REBYTE *Seek_Line_End(const REBYTE *cp) {
+  #if defined(SCAN_SCALAR)
+    while (not ANY_CR_LF_END(*cp))
+        ++cp;
+    return cp;
+  #else
+    return Seek_First_Stop(cp, &Line_End_Stops);
+  #endif
+}
+
+// Find the first byte at or after `cp` which is not a space.  (Only 0x20 is
+// LEX_DELIMIT_SPACE, tabs are not considered whitespace by the scanner.)
+//
+static inline const REBYTE *Skip_Lex_Spaces(const REBYTE *cp) {
+    if (not IS_LEX_SPACE(*cp))  // most common case, avoid setting up a load
+        return cp;
+  #if defined(SCAN_SCALAR)
+    while (IS_LEX_SPACE(*cp))
+        ++cp;
+    return cp;
+  #else
+    return Seek_First_Stop(cp + 1, &Non_Space_Stops);
+  #endif
+}
+
+// Find the first byte at or after `cp` which Scan_Quote_Push_Mold() needs to
+// look at individually: NUL, CR, LF, a quote or brace that might terminate or
+// nest, the `^` escape, or the start of a multi-byte UTF-8 sequence.  All the
+// bytes before it are printable ASCII and can be appended to a mold en masse.
+//
+static inline const REBYTE *Seek_String_Special(const REBYTE *cp) {
+  #if defined(SCAN_SCALAR)
+    while (
+        *cp < 0x80 and not ANY_CR_LF_END(*cp)
+        and *cp != '"' and *cp != '^' and *cp != '{' and *cp != '}'
+    ){
+        ++cp;
+    }
+    return cp;
+  #else
+    return Seek_First_Stop(cp, &String_Special_Stops);
+  #endif
+}
+
+
 //
 //  Scan_UTF8_Char_Escapable: C
 //
@@ -424,6 +510,13 @@ static const REBYTE *Scan_Quote_Push_Mold(
     REBINT nest = 0;
     REBLEN lines = 0;
     while (*src != term or nest > 0) {
+        const REBYTE *special = Seek_String_Special(src);
+        if (special != src) {  // run of plain ASCII, can't hold `term`
+            Append_Ascii_Len(mo->series, cs_cast(src), special - src);
+            src = special;
+            continue;
+        }
+
         REBUNI c = *src;
 
         switch (c) {
@@ -825,8 +918,7 @@ static LEXFLAGS Prescan_Token(SCAN_STATE *ss)
     const REBYTE *cp = ss->begin;
     LEXFLAGS flags = 0;  // flags for all LEX_SPECIALs seen after ss->begin[0]
 
-    while (IS_LEX_SPACE(*cp))  // skip whitespace (if any)
-        ++cp;
+    cp = Skip_Lex_Spaces(cp);  // skip whitespace (if any)
     ss->begin = cp;  // don't count leading whitespace as part of token
 
     while (true) {
@@ -1253,8 +1345,7 @@ static enum Reb_Token Locate_Token_May_Push_Mold(
 
       case LEX_CLASS_SPECIAL:
         if (GET_LEX_VALUE(*cp) == LEX_SPECIAL_SEMICOLON) {  // begin comment
-            while (not ANY_CR_LF_END(*cp))
-                ++cp;
+            cp = Seek_Line_End(cp);
             if (*cp == '\0')
                 return TOKEN_END;  // `load ";"` is [] with no newline on tail
             if (*cp == LF)
@@ -1776,8 +1867,7 @@ static REBINT Scan_Head(SCAN_STATE *ss)
     REBLEN count = ss->line;
 
     while (true) {
-        while (IS_LEX_SPACE(*cp))  // skip white space
-            ++cp;
+        cp = Skip_Lex_Spaces(cp);  // skip white space
 
         switch (*cp) {
           case '[':
@@ -1812,8 +1902,7 @@ static REBINT Scan_Head(SCAN_STATE *ss)
                 rebol = bracket = nullptr;
 
           skipline:
-            while (not ANY_CR_LF_END(*cp))
-                ++cp;
+            cp = Seek_Line_End(cp);
             if (*cp == CR and cp[1] == LF)
                 ++cp;
             if (*cp != '\0')
@@ -2223,9 +2312,19 @@ REBVAL *Scan_To_Stack(SCAN_LEVEL *level) {
         Init_Char_May_Fail(DS_PUSH(), uni);
         break; }
 
-      case TOKEN_STRING:  // UTF-8 pre-scanned above, and put in MOLD_BUF
-        Init_Text(DS_PUSH(), Pop_Molded_String(mo));
-        break;
+      case TOKEN_STRING: {  // UTF-8 pre-scanned above, and put in MOLD_BUF
+        REBSTR *s = Pop_Molded_String(mo);
+        if (level->opts & SCAN_FLAG_DEDUP) {
+            Freeze_Series(s);
+            const REBSTR *pooled = Pool_String(s);
+            if (pooled != s) {
+                Free_Unmanaged_Series(s);  // same as one already loaded
+                Init_Text(DS_PUSH(), pooled);
+                break;
+            }
+        }
+        Init_Text(DS_PUSH(), s);
+        break; }
 
       case TOKEN_BINARY:
         if (ep != Scan_Binary(DS_PUSH(), bp, len))
@@ -2616,10 +2715,12 @@ REBVAL *Scan_To_Stack(SCAN_LEVEL *level) {
             and IS_SER_ARRAY(SER(VAL_NODE1(DS_TOP)))
         ){
             REBARR *a = ARR(VAL_NODE1(DS_TOP));
-            a->misc.line = ss->line;
-            mutable_LINK(Filename, a) = ss->file;
-            SET_SUBCLASS_FLAG(ARRAY, a, HAS_FILE_LINE_UNMASKED);
-            SET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
+            if (not (level->opts & SCAN_FLAG_NO_FILE_LINE)) {
+                a->misc.line = ss->line;
+                mutable_LINK(Filename, a) = ss->file;
+                SET_SUBCLASS_FLAG(ARRAY, a, HAS_FILE_LINE_UNMASKED);
+                SET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
+            }
 
             // !!! Does this mean anything for paths?  The initial code
             // had it, but it was exploratory and predates the ideas that
@@ -2856,10 +2957,12 @@ static REBARR *Scan_Child_Array(SCAN_LEVEL *parent, REBYTE mode)
 
     // Tag array with line where the beginning bracket/group/etc. was found
     //
-    a->misc.line = ss->line;
-    mutable_LINK(Filename, a) = ss->file;
-    SET_SUBCLASS_FLAG(ARRAY, a, HAS_FILE_LINE_UNMASKED);
-    SET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
+    if (not (child.opts & SCAN_FLAG_NO_FILE_LINE)) {
+        a->misc.line = ss->line;
+        mutable_LINK(Filename, a) = ss->file;
+        SET_SUBCLASS_FLAG(ARRAY, a, HAS_FILE_LINE_UNMASKED);
+        SET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
+    }
 
     --ss->depth;
     return a;
@@ -2871,6 +2974,16 @@ static REBARR *Scan_Child_Array(SCAN_LEVEL *parent, REBYTE mode)
 //
 // Scan source code. Scan state initialized. No header required.
 //
+// !!! Large sources could be scanned in parallel, by splitting at top-level
+// boundaries (a pre-pass would have to track strings, including `{...}`
+// nesting and `^` escapes, brackets, and comments, counting LF along the way
+// to seed each piece's starting line).  But what the scanner relies on can't
+// be used off the main thread: words are interned in the one symbol table,
+// series come from the shared pools, the values are pushed to the data stack,
+// strings are accumulated in the mold buffer, and errors are raised with
+// fail() which jumps to the main thread's trap.  All of that would need
+// per-thread equivalents first.
+//
 REBARR *Scan_UTF8_Managed(const REBSTR *file, const REBYTE *utf8, REBSIZ size)
 {
     SCAN_STATE ss;
@@ -2878,6 +2991,8 @@ REBARR *Scan_UTF8_Managed(const REBSTR *file, const REBYTE *utf8, REBSIZ size)
     const REBLIN start_line = 1;
     Init_Scan_Level(&level, &ss, file, start_line, utf8, size);
 
+    USDT_PROBE2(scan__begin, utf8, size);
+
     REBDSP dsp_orig = DSP;
     Scan_To_Stack(&level);
 
@@ -2887,6 +3002,8 @@ REBARR *Scan_UTF8_Managed(const REBSTR *file, const REBYTE *utf8, REBSIZ size)
             | (level.newline_pending ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
     );
 
+    USDT_PROBE2(scan__end, utf8, ARR_LEN(a));
+
     a->misc.line = ss.line;
     mutable_LINK(Filename, a) = ss.file;
     SET_SUBCLASS_FLAG(ARRAY, a, HAS_FILE_LINE_UNMASKED);
@@ -2966,6 +3083,8 @@ void Shutdown_Scanner(void)
 //          [file! url!]
 //      /line "Line number for start of scan, word variable will be updated"
 //          [integer! any-word!]
+//      /untracked "Don't record file and line in arrays (e.g. for data)"
+//      /dedup "Freeze strings, and have equal ones share a series (see DEDUP)"
 //  ]
 //
 REBNATIVE(transcode)
@@ -2983,6 +3102,12 @@ REBNATIVE(transcode)
 // as it was fairly useless...taking items out of blocks but then would wind
 // up failing when it hit the closing brace on successive calls.  A more
 // coherent notion of continuable scanner state is required.
+//
+// /UNTRACKED doesn't stamp the file and line on each array.  Those are only
+// used for errors and backtraces in code that runs, so data loads don't
+// need them...and the arrays then have no LINK node for the GC to mark.
+// Scan errors still give the line, as it's counted either way.  (Newline
+// flags on cells are kept, since MOLD uses them to lay out the data.)
 {
     INCLUDE_PARAMS_OF_TRANSCODE;
 
@@ -3034,12 +3159,18 @@ REBNATIVE(transcode)
 
     if (REF(next))
         level.opts |= SCAN_FLAG_NEXT;
+    if (REF(untracked))
+        level.opts |= SCAN_FLAG_NO_FILE_LINE;
+    if (REF(dedup))
+        level.opts |= SCAN_FLAG_DEDUP;
 
     // If the source data bytes are "1" then the scanner will push INTEGER! 1
     // if the source data is "[1]" then the scanner will push BLOCK! [1]
     //
     // Return a block of the results, so [1] and [[1]] in those cases.
     //
+    USDT_PROBE2(scan__begin, bp, size);
+
     REBDSP dsp_orig = DSP;
     if (REF(relax)) {
         bool failed = Scan_To_Stack_Relaxed_Failed(&level);
@@ -3058,6 +3189,8 @@ REBNATIVE(transcode)
     else
         Scan_To_Stack(&level);
 
+    USDT_PROBE2(scan__end, bp, DSP - dsp_orig);
+
     if (REF(next)) {
         if (DSP == dsp_orig)
             Init_Nulled(D_OUT);
@@ -3073,9 +3206,11 @@ REBNATIVE(transcode)
             NODE_FLAG_MANAGED
                 | (level.newline_pending ? ARRAY_FLAG_NEWLINE_AT_TAIL : 0)
         );
-        a->misc.line = ss.line;
-        mutable_LINK(Filename, a) = ss.file;
-        a->leader.bits |= ARRAY_MASK_HAS_FILE_LINE;
+        if (not REF(untracked)) {
+            a->misc.line = ss.line;
+            mutable_LINK(Filename, a) = ss.file;
+            a->leader.bits |= ARRAY_MASK_HAS_FILE_LINE;
+        }
 
         Init_Block(D_OUT, a);
     }
@@ -590,6 +590,15 @@ const REBYTE *Scan_Decimal(
 
     const REBYTE *bp = cp;
 
+    // Alongside the copy for strtod(), gather the digits as an integer for
+    // Try_Decimal_From_Digits().  That only works for up to 19 significant
+    // digits, which is all most numbers have.
+    //
+    uint64_t digits = 0;
+    REBLEN num_digits = 0;  // leading zeros don't count
+    int exp10 = 0;
+    bool negative = (*cp == '-');
+
     if (*cp == '+' || *cp == '-')
         *ep++ = *cp++;
 
@@ -597,6 +606,13 @@ const REBYTE *Scan_Decimal(
 
     while (IS_LEX_NUMBER(*cp) || *cp == '\'') {
         if (*cp != '\'') {
+            if (num_digits < 19) {
+                digits = digits * 10 + (*cp - '0');
+                if (digits != 0)
+                    ++num_digits;
+            }
+            else
+                ++num_digits;  // too many, just count them
             *ep++ = *cp++;
             digit_present = true;
         }
@@ -611,6 +627,14 @@ const REBYTE *Scan_Decimal(
 
     while (IS_LEX_NUMBER(*cp) || *cp == '\'') {
         if (*cp != '\'') {
+            if (num_digits < 19) {
+                digits = digits * 10 + (*cp - '0');
+                if (digits != 0)
+                    ++num_digits;
+                --exp10;
+            }
+            else if (*cp != '0')
+                ++num_digits;  // trailing zeros after the point don't matter
             *ep++ = *cp++;
             digit_present = true;
         }
@@ -625,16 +649,23 @@ const REBYTE *Scan_Decimal(
         *ep++ = *cp++;
         digit_present = false;
 
+        bool exp_negative = (*cp == '-');
+        int exp = 0;
+
         if (*cp == '-' || *cp == '+')
             *ep++ = *cp++;
 
         while (IS_LEX_NUMBER(*cp)) {
+            if (exp < 100000)  // far past any double, but can't overflow
+                exp = exp * 10 + (*cp - '0');
             *ep++ = *cp++;
             digit_present = true;
         }
 
         if (not digit_present)
             return_NULL;
+
+        exp10 += exp_negative ? -exp : exp;
     }
 
     if (*cp == '%') {
@@ -651,8 +682,15 @@ const REBYTE *Scan_Decimal(
 
     RESET_VAL_HEADER(out, REB_DECIMAL, CELL_MASK_NONE);
 
-    char *se;
-    VAL_DECIMAL(out) = strtod(s_cast(buf), &se);
+    if (
+        num_digits > 19
+        or not Try_Decimal_From_Digits(
+            &VAL_DECIMAL(out), digits, exp10, negative
+        )
+    ){
+        char *se;
+        VAL_DECIMAL(out) = strtod(s_cast(buf), &se);
+    }
 
     // !!! TBD: need check for NaN, and INF
 
@@ -59,11 +59,43 @@
 // nodes used for other purposes.  Review in light of any new garbage collect
 // approaches used.
 //
+// RECYCLE/INCREMENTAL trades some throughput for shorter pauses, by spreading
+// the propagation of marks over evaluation steps (see Recycle_Step()).  The
+// series written to in the meantime are caught by a write barrier, and are
+// rescanned together with the root set and all marked varlists before the
+// sweep.  The sweep itself (and the walk of all nodes in Mark_Root_Series())
+// is still done all at once.
+//
+// RECYCLE/GENERATIONAL adds "minor" collections, which only mark and sweep
+// the arrays, strings and binaries made since the last collection--the
+// GC_Nursery.  Old series are assumed live, and aren't looked inside of
+// unless they are in the root set or the "remembered set" (old series that
+// were written since the last collection, caught by the same write barrier
+// the incremental mode uses).  Varlists are written in too many places to
+// count on the barrier, so both modes rescan them all (see
+// Rescan_Varlists()).  Survivors of a minor collection are promoted to the
+// old generation.  Once enough of them have been promoted, the next
+// collection is a "major" one of the whole heap (see Recycle_Minor()).
+//
+// RECYCLE/THREADS lets the propagation of marks in a full collection be done
+// by several threads, which steal queued arrays from each other when they
+// run out (see Propagate_GC_Marks_Parallel()).
+//
 
 #include "sys-core.h"
 
 #include "sys-int-funcs.h"
 
+// Parallel marking is enabled by USE_PARALLEL_MARKING in %systems.r, for the
+// platforms that link with pthreads.  The debug build's checks in marking
+// (like `in_mark` below) use global state, so it always marks on one thread.
+//
+#if defined(USE_PARALLEL_MARKING) && defined(NDEBUG)
+    #define PARALLEL_MARKING
+    #include <pthread.h>
+    #include <sched.h>  // sched_yield()
+#endif
+
 
 // The reason the LINK() and MISC() macros are so weird is because regardless
 // of who assigns the fields, the GC wants to be able to mark them.  So the
@@ -103,14 +135,229 @@ static void Mark_Devices_Deep(void);
 
 
 #ifndef NDEBUG
-    static bool in_mark = false; // needs to be per-GC thread
+    static ISOLATE_LOCAL bool in_mark = false; // needs to be per-GC thread
 #endif
 
+// When Recycle_Step() starts an incremental cycle, the root set is marked
+// with propagation deferred, so that the propagating can be spread out.
+//
+static ISOLATE_LOCAL bool deferring_propagation = false;  // per-GC thread
+
+// During a minor collection, Queue_Mark_Node_Deep() stops at old series, and
+// no marks may be left on them (only the nursery is swept, which is where
+// marks get cleared).
+//
+static ISOLATE_LOCAL bool minor_collection = false;  // per-GC thread
+
+// A major collection is forced once the series promoted since the last one
+// add up to half of what was live after it.
+//
+static ISOLATE_LOCAL REBLEN promoted_since_major = 0;
+static ISOLATE_LOCAL REBLEN live_after_major = 0;
+
 #define ASSERT_NO_GC_MARKS_PENDING() \
-    assert(SER_USED(GC_Mark_Stack) == 0)
+    assert(deferring_propagation or SER_USED(GC_Mark_Stack) == 0)
+
+// While Recycle_Tracing_Heap() runs, each reference followed by the marking
+// is passed to Trace_Heap_Reference().  What it is being followed *from* is
+// kept here, since Queue_Mark_Node_Deep() is only told where it leads.  (A
+// null trace_from means the reference is part of the root set.)
+//
+static ISOLATE_LOCAL bool heap_tracing = false;
+static ISOLATE_LOCAL const void *trace_from = nullptr;
+static ISOLATE_LOCAL REBYTE trace_how = 0;  // heart or HEAP_EDGE_XXX
+static ISOLATE_LOCAL REBYTE trace_root = 0;  // HEAP_ROOT_XXX
+
+
+#define MAX_GC_MARK_THREADS 64
+
+#ifdef PARALLEL_MARKING
+    //
+    // Each marking thread has its own stack of arrays queued for scanning,
+    // in place of GC_Mark_Stack.  These are not series, because growing a
+    // series goes through the (single-threaded) memory pools.  The owner
+    // takes the lock to push and pop, and other threads take it to steal.
+    //
+    struct Reb_Mark_Worker {
+        pthread_mutex_t lock;
+        REBARR **stack;
+        REBLEN used;
+        REBLEN rest;
+        pthread_t thread;
+    };
+
+    static struct Reb_Mark_Worker mark_workers[MAX_GC_MARK_THREADS];
+    static REBLEN num_mark_workers_made = 0;  // locks are kept between GCs
+
+    // Queue_Mark_Node_Deep() pushes to this thread's worker if it is set.
+    //
+    static __thread struct Reb_Mark_Worker *mark_worker = nullptr;
+
+    static void Push_Mark_Worker(struct Reb_Mark_Worker *w, REBARR *a)
+    {
+        pthread_mutex_lock(&w->lock);
+        if (w->used == w->rest) {
+            REBLEN rest = w->rest == 0 ? 256 : w->rest * 2;
+            REBARR **stack = cast(REBARR**,
+                realloc(w->stack, sizeof(REBARR*) * rest)
+            );
+            if (stack == nullptr)
+                panic ("Out of memory growing a GC mark thread's stack");
+            w->stack = stack;
+            w->rest = rest;
+        }
+        w->stack[w->used++] = a;
+        pthread_mutex_unlock(&w->lock);
+    }
+#endif
+
+
+// The time that collections take is tallied up for STATS/GC.  This is the
+// wall clock time the program was held up, so it's the same clock as for
+// STATS/STARTUP.  (Processor time from clock() would add up the time of all
+// the threads doing USE_PARALLEL_MARKING, overstating the pause.)
+//
+static REBI64 GC_Clock_Nanoseconds(void)
+{
+    return Startup_Clock_Nanoseconds();
+}
+
+
+// Bytes in use are what has been taken from the raw allocator, less the
+// free units sitting in the pools.
+//
+static REBI64 Heap_Bytes_In_Use(void)
+{
+    REBI64 free_bytes = 0;
+    REBLEN pool_id;
+    for (pool_id = 0; pool_id != SYSTEM_POOL; ++pool_id)
+        free_bytes += cast(REBI64, Pool_Units_Free(pool_id))
+            * Mem_Pools[pool_id].wide;
+
+    return cast(REBI64, PG_Mem_Usage) - free_bytes;
+}
+
+
+static ISOLATE_LOCAL REBI64 last_pause_end = 0;  // GC_Clock_Nanoseconds()
+static ISOLATE_LOCAL REBI64 last_ballast = MEM_BALLAST;  // GC_Ballast reset
+
+
+// Start filling in the GC_Pause_Log entry for a collection.  Until it is
+// finished by End_GC_Pause(), the `nanoseconds` are when it began, and the
+// `freed` bytes are the bytes that were in use then.
+//
+static void Begin_GC_Pause(struct Reb_GC_Pause *pause, bool minor)
+{
+    pause->nanoseconds = GC_Clock_Nanoseconds();
+    pause->interval = pause->nanoseconds - last_pause_end;
+    if (pause->interval < 0)
+        pause->interval = 0;  // wall clock was set back (see End_GC_Pause())
+    pause->allocated = last_ballast - GC_Ballast;
+    pause->freed = Heap_Bytes_In_Use();
+    pause->live = 0;
+    pause->swept = 0;
+    pause->trigger = GC_Trigger;
+    pause->minor = minor;
+
+    USDT_PROBE2(gc__begin, minor, cast(int, GC_Trigger));
+}
+
+
+// RECYCLE/ADAPTIVE puts the next collection off until the program allocates
+// GC_Adaptive_Percent of what is live, instead of a fixed TG_Ballast (which
+// is still used as the minimum).  If allocation is fast enough that this
+// would spend more than a tenth of the time collecting, the ballast is made
+// bigger to space collections out...up to 4 times as big.
+//
+static void Reset_GC_Ballast(const struct Reb_GC_Pause *pause)
+{
+    REBI64 ballast = TG_Ballast;
+
+    if (GC_Adaptive_Percent != 0) {
+        REBI64 goal = pause->live / 100 * GC_Adaptive_Percent;
+
+        if (pause->interval > 0 and pause->nanoseconds * 10 > pause->interval) {
+            //
+            // At the rate seen over the last interval, this is the ballast
+            // to have 9 times as much time running as collecting.
+            //
+            double rate = cast(double, pause->allocated) / pause->interval;
+            REBI64 wanted = cast(REBI64, rate * 9 * pause->nanoseconds);
+            if (wanted > goal * 4)
+                wanted = goal * 4;
+            if (wanted > goal)
+                goal = wanted;
+        }
+
+        if (goal > ballast)
+            ballast = goal;
+    }
+
+    if (ballast > INT32_MAX)
+        ballast = INT32_MAX;  // GC_Ballast is a REBINT
+
+    GC_Ballast = cast(REBINT, ballast);
+    last_ballast = ballast;
+}
+
+
+// Finish the entry started by Begin_GC_Pause() and put it in GC_Pause_Log.
+// Unless shutting down, the GC_Ballast is then reset for the next collection.
+//
+static void End_GC_Pause(
+    struct Reb_GC_Pause *pause,
+    REBLEN swept,
+    bool shutdown
+){
+    // Pause times are wall clock time, so a collection done by several mark
+    // threads counts only for the time the program was stopped.  But the
+    // clock isn't necessarily monotonic, so a time it set back is taken as 0.
+    //
+    REBI64 now = GC_Clock_Nanoseconds();
+    pause->nanoseconds = now - pause->nanoseconds;
+    if (pause->nanoseconds < 0)
+        pause->nanoseconds = 0;
+    pause->live = Heap_Bytes_In_Use();
+    pause->freed = pause->freed - pause->live;
+    pause->swept = swept;
+
+    GC_Pause_Log[GC_Pauses_Logged % GC_PAUSE_LOG_SIZE] = *pause;
+    ++GC_Pauses_Logged;
+
+    last_pause_end = now;
+    GC_Trigger = GC_TRIGGER_REQUEST;
+
+    USDT_PROBE3(gc__end, pause->minor, swept, pause->nanoseconds);
+
+    if (not shutdown)
+        Reset_GC_Ballast(pause);
+}
 
 
 static void Queue_Mark_Opt_Value_Deep(const RELVAL *v);
+static void Queue_Mark_Node_Deep(void *p);
+
+// Mark a node reached from a slot of a series stub or cell.  This only goes
+// out of its way when the heap is being traced, to say where it came from.
+//
+inline static void Queue_Mark_Edge_Deep(
+    const void *from,
+    REBYTE how,
+    void *p
+){
+    if (not heap_tracing) {
+        Queue_Mark_Node_Deep(p);
+        return;
+    }
+
+    const void *outer_from = trace_from;
+    REBYTE outer_how = trace_how;
+    trace_from = from;
+    trace_how = how;
+    Queue_Mark_Node_Deep(p);
+    trace_from = outer_from;
+    trace_how = outer_how;
+}
 
 inline static void Queue_Mark_Opt_End_Cell_Deep(const RELVAL *v) {
     if (KIND3Q_BYTE_UNCHECKED(v) != REB_0_END)  // faster than NOT_END()
@@ -147,10 +394,20 @@ static void Queue_Mark_Pairing_Deep(REBVAL *paired)
     in_mark = false;  // would assert about the recursion otherwise
   #endif
 
+    const void *outer_from = trace_from;
+    trace_from = paired;  // (only looked at if heap_tracing)
+
     Queue_Mark_Opt_Value_Deep(paired);
     Queue_Mark_Opt_Value_Deep(PAIRING_KEY(paired));
 
-    paired->header.bits |= NODE_FLAG_MARKED;
+    trace_from = outer_from;
+
+    // Pairings are never young, and a mark here would outlive a minor
+    // collection.  Their cells are filled in before they are managed, so
+    // scanning them whenever they are reached is enough.
+    //
+    if (not minor_collection)
+        paired->header.bits |= NODE_FLAG_MARKED;
 
   #if !defined(NDEBUG)
     in_mark = was_in_mark;
@@ -169,6 +426,13 @@ static void Queue_Mark_Pairing_Deep(REBVAL *paired)
 //
 static void Queue_Mark_Node_Deep(void *p)
 {
+    if (heap_tracing)  // before the test for a mark, so every edge is seen
+        Trace_Heap_Reference(
+            trace_from,
+            p,
+            trace_from ? trace_how : trace_root
+        );
+
     REBYTE first = *cast(const REBYTE*, p);
     if (first & NODE_BYTEMASK_0x10_MARKED)
         return;  // may not be finished marking yet, but has been queued
@@ -185,6 +449,9 @@ static void Queue_Mark_Node_Deep(void *p)
     }
 
     REBSER *s = SER(p);
+    if (minor_collection and not (s->leader.bits & SERIES_FLAG_GC_YOUNG))
+        return;  // old series are taken to be live (see Recycle_Minor())
+
     if (GET_SERIES_FLAG(s, INACCESSIBLE)) {
         //
         // !!! All inaccessible nodes should be collapsed and canonized into
@@ -231,25 +498,30 @@ static void Queue_Mark_Node_Deep(void *p)
                 goto skip_mark_rebfrm_link;
 
         REBSER *link = SER(node_LINK(Node, s));
-        Queue_Mark_Node_Deep(link);
+        Queue_Mark_Edge_Deep(s, HEAP_EDGE_LINK, link);
 
         // Keylist series need to be marked.
         //
         // !!! Review efficiency, this may need a separate flag for "has
         // pointers that need marking", such lists are used elsewhere.
         //
-        if (IS_KEYLIST(link)) {
+        // (Symbols are never young, so a minor collection skips this.)
+        //
+        if (IS_KEYLIST(link) and not minor_collection) {
             REBKEY *tail = SER_TAIL(REBKEY, link);
             REBKEY *key = SER_HEAD(REBKEY, link);
-            for (; key != tail; ++key)
+            for (; key != tail; ++key) {
+                if (heap_tracing)
+                    Trace_Heap_Reference(link, KEY_SYMBOL(key), HEAP_EDGE_KEY);
                 m_cast(REBSYM*, KEY_SYMBOL(key))->leader.bits
                     |= NODE_FLAG_MARKED;
+            }
         }
     }
 
   skip_mark_rebfrm_link:
     if (GET_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK) and node_MISC(Node, s))
-        Queue_Mark_Node_Deep(node_MISC(Node, s));
+        Queue_Mark_Edge_Deep(s, HEAP_EDGE_MISC, node_MISC(Node, s));
 
   //=//// MARK INODE (if not using slot for `info`) ///////////////////////=//
 
@@ -260,7 +532,7 @@ static void Queue_Mark_Node_Deep(void *p)
             if (IS_POINTER_TRASH_DEBUG(inode))
                 panic (s);
           #endif
-            Queue_Mark_Node_Deep(inode);
+            Queue_Mark_Edge_Deep(s, HEAP_EDGE_INODE, inode);
         }
     }
 
@@ -279,7 +551,7 @@ static void Queue_Mark_Node_Deep(void *p)
                 if (IS_POINTER_TRASH_DEBUG(bonus))
                     panic (a);
               #endif
-                Queue_Mark_Node_Deep(bonus);
+                Queue_Mark_Edge_Deep(a, HEAP_EDGE_BONUS, bonus);
             }
         }
 
@@ -296,6 +568,13 @@ static void Queue_Mark_Node_Deep(void *p)
         // !!! Should this use a "bumping a NULL at the end" technique to
         // grow, like the data stack?
         //
+      #ifdef PARALLEL_MARKING
+        if (mark_worker) {
+            Push_Mark_Worker(mark_worker, a);
+            return;
+        }
+      #endif
+
         if (SER_FULL(GC_Mark_Stack))
             Extend_Series(GC_Mark_Stack, 8);
         *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack)) = a;
@@ -329,37 +608,50 @@ static void Queue_Mark_Opt_Value_Deep(const RELVAL *v)
         REBSER *binding = BINDING(v);
         if (binding != UNBOUND)
             if (NODE_BYTE(binding) & NODE_BYTEMASK_0x20_MANAGED)
-                Queue_Mark_Node_Deep(binding);
+                Queue_Mark_Edge_Deep(trace_from, heart, binding);
     }
 
     if (GET_CELL_FLAG(v, FIRST_IS_NODE) and VAL_NODE1(v))
-        Queue_Mark_Node_Deep(VAL_NODE1(v));
+        Queue_Mark_Edge_Deep(trace_from, heart, VAL_NODE1(v));
 
     if (GET_CELL_FLAG(v, SECOND_IS_NODE) and VAL_NODE2(v))
-        Queue_Mark_Node_Deep(VAL_NODE2(v));
+        Queue_Mark_Edge_Deep(trace_from, heart, VAL_NODE2(v));
 
   #if !defined(NDEBUG)
     in_mark = false;
-    Assert_Cell_Marked_Correctly(v);
+    if (not minor_collection)  // old nodes are left unmarked
+        Assert_Cell_Marked_Correctly(v);
   #endif
 }
 
 
 //
-//  Propagate_All_GC_Marks: C
+//  Propagate_GC_Marks: C
 //
 // The Mark Stack is a series containing series pointers.  They have already
 // had their SERIES_FLAG_MARK set to prevent being added to the stack multiple
 // times, but the items they can reach are not necessarily marked yet.
 //
 // Processing continues until all reachable items from the mark stack are
-// known to be marked.
+// known to be marked, or until `budget` cells have been scanned.  (Only the
+// incremental steps pass a budget other than UNLIMITED.  An array is always
+// scanned in full once it is taken off the stack, so a step can overshoot.)
 //
-static void Propagate_All_GC_Marks(void)
+// Returns true if the mark stack was emptied.
+//
+static bool Propagate_GC_Marks(REBLEN budget)
 {
     assert(not in_mark);
 
+    const void *outer_from = trace_from;
+    REBLEN scanned = 0;
+
     while (SER_USED(GC_Mark_Stack) != 0) {
+        if (scanned >= budget) {
+            trace_from = outer_from;
+            return false;
+        }
+
         SET_SERIES_USED(GC_Mark_Stack, SER_USED(GC_Mark_Stack) - 1);  // safe
 
         // Data pointer may change in response to an expansion during
@@ -374,13 +666,22 @@ static void Propagate_All_GC_Marks(void)
             *SER_AT(REBARR*, GC_Mark_Stack, SER_USED(GC_Mark_Stack))
         );
 
+        // Between incremental steps, a queued array may be freed (it is
+        // nulled out of the stack by Unlist_Marked_Series()) or decayed.
+        //
+        if (a == nullptr or GET_SERIES_FLAG(a, INACCESSIBLE))
+            continue;
+
         // We should have marked this series at queueing time to keep it from
         // being doubly added before the queue had a chance to be processed
          //
         assert(a->leader.bits & NODE_FLAG_MARKED);
 
+        trace_from = a;  // (only looked at if heap_tracing)
+
         RELVAL *v = ARR_HEAD(a);
         const RELVAL *tail = ARR_TAIL(a);
+        scanned += cast(REBLEN, tail - v);
         for (; v != tail; ++v) {
             Queue_Mark_Opt_Value_Deep(v);
 
@@ -407,9 +708,228 @@ static void Propagate_All_GC_Marks(void)
         }
 
       #if !defined(NDEBUG)
-        Assert_Array_Marked_Correctly(a);
+        if (not minor_collection)
+            Assert_Array_Marked_Correctly(a);
       #endif
     }
+
+    trace_from = outer_from;
+    return true;
+}
+
+
+//
+//  Propagate_All_GC_Marks: C
+//
+static void Propagate_All_GC_Marks(void)
+{
+    if (deferring_propagation)
+        return;  // Recycle_Step() is just marking the root set
+
+    bool emptied = Propagate_GC_Marks(UNLIMITED);
+    assert(emptied);
+    UNUSED(emptied);
+}
+
+
+#ifdef PARALLEL_MARKING
+
+static pthread_mutex_t idle_lock = PTHREAD_MUTEX_INITIALIZER;
+static REBLEN num_marking;  // workers in the current collection
+static REBLEN num_idle;  // how many of those ran out of work
+static bool marking_done;  // all of them ran out at the same time
+
+
+static REBARR *Pop_Mark_Worker(struct Reb_Mark_Worker *w)
+{
+    REBARR *a = nullptr;
+    pthread_mutex_lock(&w->lock);
+    if (w->used != 0)
+        a = w->stack[--w->used];
+    pthread_mutex_unlock(&w->lock);
+    return a;
+}
+
+
+// Take up to half of the oldest entries off some other worker's stack.  (The
+// bottom of a stack is nearer the roots, so it tends to lead to more work.)
+//
+static bool Did_Steal_Marks(struct Reb_Mark_Worker *w)
+{
+    REBARR *loot[256];
+
+    REBLEN me = cast(REBLEN, w - mark_workers);
+    REBLEN i;
+    for (i = 1; i < num_marking; ++i) {
+        struct Reb_Mark_Worker *victim = &mark_workers[(me + i) % num_marking];
+
+        pthread_mutex_lock(&victim->lock);
+        REBLEN take = (victim->used + 1) / 2;
+        if (take > 256)
+            take = 256;
+        if (take != 0) {
+            memcpy(loot, victim->stack, sizeof(REBARR*) * take);
+            memmove(
+                victim->stack,
+                victim->stack + take,
+                sizeof(REBARR*) * (victim->used - take)
+            );
+            victim->used -= take;
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (take != 0) {
+            REBLEN n;
+            for (n = 0; n < take; ++n)
+                Push_Mark_Worker(w, loot[n]);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+static bool Any_Marks_To_Steal(void)
+{
+    REBLEN i;
+    for (i = 0; i < num_marking; ++i) {
+        pthread_mutex_lock(&mark_workers[i].lock);
+        bool any = (mark_workers[i].used != 0);
+        pthread_mutex_unlock(&mark_workers[i].lock);
+        if (any)
+            return true;
+    }
+    return false;
+}
+
+
+// A worker is done only when every worker is idle at once.  Nothing is ever
+// on the stack of an idle worker, so that means no marking is left to do.
+//
+static void Run_Mark_Worker(struct Reb_Mark_Worker *w)
+{
+    mark_worker = w;
+
+    while (true) {
+        REBARR *a;
+        while ((a = Pop_Mark_Worker(w)) != nullptr) {
+            RELVAL *v = ARR_HEAD(a);
+            const RELVAL *tail = ARR_TAIL(a);
+            for (; v != tail; ++v)
+                Queue_Mark_Opt_Value_Deep(v);
+        }
+
+        if (Did_Steal_Marks(w))
+            continue;
+
+        pthread_mutex_lock(&idle_lock);
+        if (++num_idle == num_marking)
+            marking_done = true;
+        pthread_mutex_unlock(&idle_lock);
+
+        while (true) {
+            pthread_mutex_lock(&idle_lock);
+            bool done = marking_done;
+            if (not done and Any_Marks_To_Steal())
+                --num_idle;  // back to work
+            else if (not done) {
+                pthread_mutex_unlock(&idle_lock);
+                sched_yield();
+                continue;
+            }
+            pthread_mutex_unlock(&idle_lock);
+
+            if (done)
+                goto finished;
+            break;
+        }
+    }
+
+  finished:
+    mark_worker = nullptr;
+}
+
+
+static void *Mark_Thread(void *p)
+{
+    Run_Mark_Worker(cast(struct Reb_Mark_Worker*, p));
+    return nullptr;
+}
+
+
+//
+//  Propagate_GC_Marks_Parallel: C
+//
+// Used by a full collection when RECYCLE/THREADS asked for more than one
+// thread.  The root set is marked with propagation deferred (as when an
+// incremental cycle starts), and the arrays that got queued are dealt out
+// to the workers.  The calling thread is one of them.
+//
+// Setting a mark isn't atomic, so two threads may both queue an array they
+// each found unmarked.  That just means the array gets scanned twice: no
+// other bits of a node are changed during marking.
+//
+static void Propagate_GC_Marks_Parallel(REBLEN threads)
+{
+    assert(threads > 1 and threads <= MAX_GC_MARK_THREADS);
+
+    for (; num_mark_workers_made < threads; ++num_mark_workers_made) {
+        struct Reb_Mark_Worker *w = &mark_workers[num_mark_workers_made];
+        pthread_mutex_init(&w->lock, nullptr);
+        w->stack = nullptr;
+        w->used = 0;
+        w->rest = 0;
+    }
+
+    num_marking = threads;
+    num_idle = 0;
+    marking_done = false;
+
+    // Workers that start before the roots are dealt out just go idle until
+    // they see something to steal.  If not all of them could be started, it
+    // has to be known before any roots are given to the ones that weren't.
+    //
+    REBLEN started = 1;
+    for (; started < threads; ++started) {
+        struct Reb_Mark_Worker *w = &mark_workers[started];
+        if (0 != pthread_create(&w->thread, nullptr, &Mark_Thread, w))
+            break;
+    }
+
+    pthread_mutex_lock(&idle_lock);
+    num_marking = started;
+    pthread_mutex_unlock(&idle_lock);
+
+    REBARR **ap = SER_HEAD(REBARR*, GC_Mark_Stack);
+    REBLEN n;
+    for (n = 0; n < SER_USED(GC_Mark_Stack); ++n, ++ap)
+        Push_Mark_Worker(&mark_workers[n % started], *ap);
+    SET_SERIES_USED(GC_Mark_Stack, 0);
+
+    Run_Mark_Worker(&mark_workers[0]);
+
+    REBLEN i;
+    for (i = 1; i < started; ++i)
+        pthread_join(mark_workers[i].thread, nullptr);
+}
+
+#endif
+
+
+//
+//  Set_GC_Mark_Threads: C
+//
+// RECYCLE/THREADS.  Returns false if the number is out of range.  (It is
+// accepted in builds that can't mark in parallel, but has no effect.)
+//
+bool Set_GC_Mark_Threads(REBINT threads)
+{
+    if (threads < 1 or threads > MAX_GC_MARK_THREADS)
+        return false;
+
+    GC_Mark_Threads = threads;
+    return true;
 }
 
 
@@ -496,6 +1016,21 @@ void Reify_Va_To_Array_In_Frame(
 }
 
 
+// The root set holds some series directly, instead of through cells.  If one
+// of those is old, a minor collection still has to scan what it holds (e.g.
+// natives write the ARG() cells of their varlists without a write barrier).
+// But a mark would be left on it, so it goes into the remembered set to be
+// scanned and unmarked by Mark_Remembered_Series().
+//
+static void Queue_Mark_Root_Series_Deep(REBSER *s)
+{
+    if (minor_collection and not (s->leader.bits & SERIES_FLAG_GC_YOUNG))
+        Remember_Series(s);
+    else
+        Queue_Mark_Node_Deep(s);
+}
+
+
 //
 //  Mark_Root_Series: C
 //
@@ -525,8 +1060,19 @@ static void Mark_Root_Series(void)
             // optimally...see the sweep code for an example.
             //
             REBYTE nodebyte = *unit;
-            if (nodebyte & NODE_BYTEMASK_0x40_FREE)
+
+            // Nearly every unit is free (e.g. released API handles) or a
+            // managed series that isn't a root, which something else will
+            // mark.  Rule those out with one test of the byte already read.
+            //
+            if (
+                not (nodebyte & NODE_BYTEMASK_0x02_ROOT)
+                and (nodebyte & (
+                    NODE_BYTEMASK_0x40_FREE | NODE_BYTEMASK_0x20_MANAGED
+                ))
+            ){
                 continue;
+            }
 
             assert(nodebyte & NODE_BYTEMASK_0x80_NODE);
 
@@ -537,11 +1083,16 @@ static void Mark_Root_Series(void)
                 //
                 REBARR *a = ARR(cast(void*, unit));
 
-                assert(not (a->leader.bits & NODE_FLAG_MARKED));
+                // (an incremental cycle marked the root set when it started)
+                //
+                assert(GC_Marking or not (a->leader.bits & NODE_FLAG_MARKED));
 
                 if (not (a->leader.bits & NODE_FLAG_MANAGED)) {
                     // if it's not managed, don't mark it (don't have to?)
                 }
+                else if (minor_collection) {
+                    // only the nursery is swept, which API handles aren't in
+                }
                 else  // Note that Mark_Frame_Stack_Deep() will mark the owner
                     a->leader.bits |= NODE_FLAG_MARKED;
 
@@ -646,11 +1197,17 @@ static void Mark_Data_Stack(void)
 //
 static void Mark_Symbol_Series(void)
 {
+    if (minor_collection)
+        return;  // symbols are never young
+
     REBSTR **canon = SER_HEAD(REBSTR*, PG_Symbol_Canons);
     assert(IS_POINTER_TRASH_DEBUG(*canon)); // SYM_0 for all non-builtin words
     ++canon;
-    for (; *canon != nullptr; ++canon)
+    for (; *canon != nullptr; ++canon) {
+        if (heap_tracing)
+            Trace_Heap_Reference(nullptr, *canon, HEAP_ROOT_SYMBOLS);
         (*canon)->leader.bits |= NODE_FLAG_MARKED;
+    }
 
     ASSERT_NO_GC_MARKS_PENDING(); // doesn't ues any queueing
 }
@@ -696,8 +1253,11 @@ static void Mark_Guarded_Nodes(void)
             //
             Queue_Mark_Opt_End_Cell_Deep(cast(REBVAL*, node));
         }
-        else  // a series
-            Queue_Mark_Node_Deep(node);
+        else {  // a series
+            if (GC_Marking)  // guarded series are often written directly
+                SER(node)->leader.bits &= ~NODE_FLAG_MARKED;
+            Queue_Mark_Root_Series_Deep(SER(node));
+        }
 
         Propagate_All_GC_Marks();
     }
@@ -797,7 +1357,13 @@ static void Mark_Frame_Stack_Deep(void)
             // partial parameter traversal.
             //
             assert(not Is_Action_Frame_Fulfilling(f));
-            Queue_Mark_Node_Deep(f->varlist);  // may not pass CTX() test
+
+            // Running natives write their ARG() cells directly, so an
+            // incremental cycle has to rescan the varlist each time.
+            //
+            if (GC_Marking)
+                f->varlist->leader.bits &= ~NODE_FLAG_MARKED;
+            Queue_Mark_Root_Series_Deep(f->varlist);  // may not pass CTX()
             goto propagate_and_continue;
         }
 
@@ -862,120 +1428,133 @@ static void Mark_Frame_Stack_Deep(void)
 
 
 //
-//  Sweep_Series: C
+//  Sweep_Series_Segment: C
 //
-// Scans all series nodes (REBSER structs) in all segments that are part of
-// the SER_POOL.  If a series had its lifetime management delegated to the
-// garbage collector with Manage_Series(), then if it didn't get "marked" as
-// live during the marking phase then free it.
+// Scans all series nodes (REBSER structs) in one segment of the SER_POOL.
+// If a series had its lifetime management delegated to the garbage collector
+// with Manage_Series(), then if it didn't get "marked" as live during the
+// marking phase then free it.
 //
-static REBLEN Sweep_Series(void)
+// A lazy sweep took the pool's free list away when it started (see
+// Start_Lazy_Sweep()), so the units that were already free get put back.
+//
+static REBLEN Sweep_Series_Segment(REBSEG *seg, bool lazy)
 {
     REBLEN count = 0;
 
-    REBSEG *seg = Mem_Pools[SER_POOL].segs;
-    for (; seg != nullptr; seg = seg->next) {
-        REBLEN n = Mem_Pools[SER_POOL].num_units;
-
-        // We use a generic byte pointer (unsigned char*) to dodge the rules
-        // for strict aliasing, as the pool may contain pairs of REBVAL from
-        // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
-        // first byte node masks are defined and explained in %sys-rebnod.h
-        //
-        // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
-        // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
-        // nodes only--see loop lower down for the pairing pool enumeration.
-
-        REBYTE *unit = cast(REBYTE*, seg + 1);
+    REBLEN n = Mem_Pools[SER_POOL].num_units;
 
-        for (; n > 0; --n, unit += sizeof(REBSER)) {
-            switch (*unit >> 4) {
-              case 0:
-              case 1:  // 0x1
-              case 2:  // 0x2
-              case 3:  // 0x2 + 0x1
-              case 4:  // 0x4
-              case 5:  // 0x4 + 0x1
-              case 6:  // 0x4 + 0x2
-              case 7:  // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (unit);
+    // We use a generic byte pointer (unsigned char*) to dodge the rules
+    // for strict aliasing, as the pool may contain pairs of REBVAL from
+    // Alloc_Pairing(), or a REBSER from Alloc_Series_Node().  The shared
+    // first byte node masks are defined and explained in %sys-rebnod.h
+    //
+    // NOTE: If you are using a build with UNUSUAL_REBVAL_SIZE such as
+    // DEBUG_TRACK_EXTEND_CELLS, then this will be processing the REBSER
+    // nodes only--see Sweep_Pairings() for the pairing pool enumeration.
+
+    REBYTE *unit = cast(REBYTE*, seg + 1);
+
+    for (; n > 0; --n, unit += sizeof(REBSER)) {
+        switch (*unit >> 4) {
+          case 0:
+          case 1:  // 0x1
+          case 2:  // 0x2
+          case 3:  // 0x2 + 0x1
+          case 4:  // 0x4
+          case 5:  // 0x4 + 0x1
+          case 6:  // 0x4 + 0x2
+          case 7:  // 0x4 + 0x2 + 0x1
+            //
+            // NODE_FLAG_NODE (0x8) is clear.  This signature is
+            // reserved for UTF-8 strings (corresponding to valid ASCII
+            // values in the first byte).
+            //
+            panic (unit);
 
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+        // v-- Everything below here has NODE_FLAG_NODE set (0x8)
 
-              case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                // !!! Are there actually legitimate reasons to do this with
-                // arrays, where the creator knows the cells do not need
-                // GC protection?  Should finding an array in this state be
-                // considered a problem (e.g. the GC ran when you thought it
-                // couldn't run yet, hence would be able to free the array?)
-                //
-                break;
+          case 8:
+            // 0x8: unmanaged and unmarked, e.g. a series that was made
+            // with Make_Series() and hasn't been managed.  It doesn't
+            // participate in the GC.  Leave it as is.
+            //
+            // !!! Are there actually legitimate reasons to do this with
+            // arrays, where the creator knows the cells do not need
+            // GC protection?  Should finding an array in this state be
+            // considered a problem (e.g. the GC ran when you thought it
+            // couldn't run yet, hence would be able to free the array?)
+            //
+            break;
 
-              case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (unit);
+          case 9:
+            // 0x8 + 0x1: marked but not managed, this can't happen,
+            // because the marking itself asserts nodes are managed.
+            //
+            panic (unit);
 
-              case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (*unit & NODE_BYTEMASK_0x01_CELL) {
-                    assert(not (*unit & NODE_BYTEMASK_0x02_ROOT));
-                    Free_Node(SER_POOL, NOD(unit));  // Free_Pairing manual
-                }
-                else {
-                    REBSER *s = cast(REBSER*, unit);
-                    GC_Kill_Series(s);
-                }
-                ++count;
-                break;
+          case 10:
+            // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+            //
+            // !!! It would be nice if we could have NODE_FLAG_CELL here
+            // as part of the switch, but see its definition for why it
+            // is at position 8 from left and not an earlier bit.
+            //
+            if (*unit & NODE_BYTEMASK_0x01_CELL) {
+                assert(not (*unit & NODE_BYTEMASK_0x02_ROOT));
+                if (TG_Alloc_Samples_Live)
+                    Forget_Allocation_Sample(unit);
+                Free_Node(SER_POOL, NOD(unit));  // Free_Pairing manual
+            }
+            else {
+                REBSER *s = cast(REBSER*, unit);
+                GC_Kill_Series(s);
+            }
+            ++count;
+            break;
 
-              case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                *unit &= ~NODE_BYTEMASK_0x10_MARKED;
-                break;
+          case 11:
+            // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+            // Don't GC it, just clear the mark.
+            //
+            *unit &= ~NODE_BYTEMASK_0x10_MARKED;
+            break;
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
+        // v-- Everything below this line has the two leftmost bits set
+        // in the header.  In the *general* case this could be a valid
+        // first byte of a multi-byte sequence in UTF-8...so only the
+        // special bit pattern of the free case uses this.
 
-              case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(*unit == FREED_SERIES_BYTE);
-                break;
+          case 12:
+            // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+            //
+            assert(*unit == FREED_SERIES_BYTE);
+            if (lazy)
+                Free_Node(SER_POOL, NOD(unit));
+            break;
 
-              case 13:
-              case 14:
-              case 15:
-                panic (unit);  // 0x8 + 0x4 + ... reserved for UTF-8
-            }
+          case 13:
+          case 14:
+          case 15:
+            panic (unit);  // 0x8 + 0x4 + ... reserved for UTF-8
         }
     }
 
-    // For efficiency of memory use, REBSER is nominally defined as
-    // 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
-    // that might make the cells a size greater than REBSER size require
-    // doing pairings in a different pool.
-    //
+    return count;
+}
+
+
+// For efficiency of memory use, REBSER is nominally defined as
+// 2*sizeof(REBVAL), and so pairs can use the same nodes.  But features
+// that might make the cells a size greater than REBSER size require
+// doing pairings in a different pool.  That pool is always swept at once.
+//
+static REBLEN Sweep_Pairings(void)
+{
+    REBLEN count = 0;
+
   #ifdef UNUSUAL_REBVAL_SIZE
+    REBSEG *seg;
     for (seg = Mem_Pools[PAR_POOL].segs; seg != NULL; seg = seg->next) {
         REBVAL *v = cast(REBVAL*, seg + 1);
         REBLEN n = Mem_Pools[PAR_POOL].num_units;
@@ -992,6 +1571,8 @@ static REBLEN Sweep_Series(void)
                 if (v->header.bits & NODE_FLAG_MARKED)
                     v->header.bits &= ~NODE_FLAG_MARKED;
                 else {
+                    if (TG_Alloc_Samples_Live)
+                        Forget_Allocation_Sample(v);
                     Free_Node(PAR_POOL, NOD(v));  // Free_Pairing is for manuals
                     ++count;
                 }
@@ -1004,27 +1585,261 @@ static REBLEN Sweep_Series(void)
 }
 
 
-#if !defined(NDEBUG)
-
 //
-//  Fill_Sweeplist: C
+//  Sweep_Series: C
 //
-REBLEN Fill_Sweeplist(REBSER *sweeplist)
+// Sweep every segment of the SER_POOL (and the PAR_POOL, if separate).
+//
+static REBLEN Sweep_Series(void)
 {
-    assert(SER_WIDE(sweeplist) == sizeof(REBNOD*));
-    assert(SER_USED(sweeplist) == 0);
-
     REBLEN count = 0;
 
-    REBSEG *seg;
-    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
-        REBYTE *unit = cast(REBYTE*, seg + 1);
-        REBLEN n = Mem_Pools[SER_POOL].num_units;
-        for (; n > 0; --n, unit += sizeof(REBSER)) {
-            switch (*unit >> 4) {
-              case 9: {  // 0x8 + 0x1
-                REBSER *s = SER(cast(void*, unit));
-                ASSERT_SERIES_MANAGED(s);
+    REBSEG *seg = Mem_Pools[SER_POOL].segs;
+    for (; seg != nullptr; seg = seg->next)
+        count += Sweep_Series_Segment(seg, false);
+
+    return count + Sweep_Pairings();
+}
+
+
+// The sweep may have left whole pool segments free.  Hand those back so a
+// peak in usage doesn't pin that memory for the rest of the process.
+//
+static void Reclaim_After_Sweep(void)
+{
+    REBLEN pool_id;
+    for (pool_id = 0; pool_id != SYSTEM_POOL; ++pool_id)
+        Reclaim_Pool_Segments(pool_id);
+
+    live_after_major = Mem_Pools[SER_POOL].has - Pool_Units_Free(SER_POOL);
+}
+
+
+//=//// LAZY SWEEPING (RECYCLE/LAZY) //////////////////////////////////////=//
+//
+// Sweeping visits every unit of the SER_POOL, which in a big heap is a good
+// part of the pause.  With GC_Lazy_Sweep on, a collection leaves the pool's
+// segments to be swept as the evaluator needs nodes: Try_Refill_Pool_Cache()
+// calls Sweep_Series_Lazily() when the SER_POOL's free list runs dry, which
+// sweeps segments until some units come free.  (A background thread was not
+// used for this, because the pools are not safe to share between threads.)
+//
+// For this to work, nothing the evaluator does may put a new series into a
+// segment that hasn't been swept yet--the sweep would free it, since it
+// wasn't marked.  So:
+//
+// * The free list is taken away from the pool when the sweep starts, and the
+//   sweep puts the units it finds free back onto it.
+//
+// * A unit in an unswept segment that is freed by Free_Node() is left alone
+//   (see Is_Node_Unswept()), for the sweep to find.
+//
+// * New segments from Try_Fill_Pool() go on the front of the chain, and are
+//   not in the unswept_segs array.
+//
+// Dead series are still in the pool until their segment is swept, so weak
+// references must not hand them out.  Unmarked symbols are freed at once by
+// GC_Kill_Unmarked_Symbols(), and Make_Patch_Core() checks variants with
+// Is_Series_Doomed().  Any other collection (or shutdown) finishes a lazy
+// sweep before it starts marking.
+//
+
+static ISOLATE_LOCAL REBSEG **unswept_segs = nullptr;  // in address order
+static ISOLATE_LOCAL REBLEN num_unswept_segs = 0;
+static ISOLATE_LOCAL REBLEN unswept_index = 0;  // segments before are swept
+static ISOLATE_LOCAL bool sweeping_lazily = false;  // reentry guard
+
+
+// Set up a lazy sweep of the SER_POOL in place of Sweep_Series().  Returns
+// the number of nodes freed in the pause (symbols and separate pairings).
+//
+static REBLEN Start_Lazy_Sweep(void)
+{
+    assert(not GC_Sweeping);
+
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+
+    REBLEN num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        ++num_segs;
+
+    REBSEG **segs = TRY_ALLOC_N(REBSEG*, num_segs);
+    if (num_segs == 0 or not segs) {
+        if (segs)
+            FREE_N(REBSEG*, num_segs, segs);
+        REBLEN count = Sweep_Series();  // just sweep it all now
+        Reclaim_After_Sweep();
+        return count;
+    }
+
+    REBLEN count = GC_Kill_Unmarked_Symbols() + Sweep_Pairings();
+
+    REBLEN i = 0;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next, ++i)
+        segs[i] = seg;
+    reb_qsort_r(
+        segs, num_segs, sizeof(REBSEG*), nullptr, &Compare_Segment_Addresses
+    );
+
+    Drain_Pool_Cache(SER_POOL, 0);
+    pool->first = nullptr;
+    pool->last = nullptr;
+    pool->free = 0;
+
+    unswept_segs = segs;
+    num_unswept_segs = num_segs;
+    unswept_index = 0;
+    GC_Sweeping = true;
+
+    return count;
+}
+
+
+// Sweep the next unswept segment.  When it was the last, the sweep is over.
+//
+static REBLEN Sweep_Next_Segment(void)
+{
+    assert(GC_Sweeping and unswept_index < num_unswept_segs);
+
+    REBSEG *seg = unswept_segs[unswept_index];
+    ++unswept_index;  // Free_Node() must now list the units it gets from seg
+
+    REBLEN count = Sweep_Series_Segment(seg, true);
+
+    if (unswept_index == num_unswept_segs) {
+        FREE_N(REBSEG*, num_unswept_segs, unswept_segs);
+        unswept_segs = nullptr;
+        num_unswept_segs = 0;
+        unswept_index = 0;
+        GC_Sweeping = false;
+
+        Reclaim_After_Sweep();
+    }
+
+    return count;
+}
+
+
+//
+//  Sweep_Series_Lazily: C
+//
+// Called by Try_Refill_Pool_Cache() when the SER_POOL has no free units and
+// GC_Sweeping is set.  Sweeps segments until units are free or the sweep is
+// over.  Returns the number of nodes freed.
+//
+REBLEN Sweep_Series_Lazily(void)
+{
+    if (sweeping_lazily)
+        return 0;  // e.g. a HANDLE! cleaner allocating, let the pool grow
+
+    sweeping_lazily = true;
+
+    REBPOL *pool = &Mem_Pools[SER_POOL];
+    REBPCH *cache = &TG_Pool_Caches[SER_POOL];
+
+    REBLEN count = 0;
+    while (GC_Sweeping) {
+        count += Sweep_Next_Segment();
+        if (pool->first or cache->first)
+            break;
+    }
+
+    sweeping_lazily = false;
+    return count;
+}
+
+
+//
+//  Finish_Lazy_Sweep: C
+//
+// Sweep whatever segments a lazy sweep has left.  Returns the number of
+// nodes freed.
+//
+REBLEN Finish_Lazy_Sweep(void)
+{
+    assert(not sweeping_lazily);
+
+    REBLEN count = 0;
+    while (GC_Sweeping)
+        count += Sweep_Next_Segment();
+
+    return count;
+}
+
+
+//
+//  Is_Node_Unswept: C
+//
+// Whether a SER_POOL unit is in a segment that a lazy sweep has yet to visit.
+//
+bool Is_Node_Unswept(const void *p)
+{
+    assert(GC_Sweeping);
+
+    uintptr_t addr = cast(uintptr_t, p);
+
+    REBLEN lo = unswept_index;
+    REBLEN hi = num_unswept_segs;
+    while (lo < hi) {
+        REBLEN mid = lo + (hi - lo) / 2;
+        uintptr_t start = cast(uintptr_t, unswept_segs[mid]);
+        if (addr < start)
+            hi = mid;
+        else if (addr >= start + unswept_segs[mid]->size)
+            lo = mid + 1;
+        else
+            return true;
+    }
+    return false;
+}
+
+
+//
+//  Is_Series_Doomed: C
+//
+// While a lazy sweep is underway, a managed series without a mark is dead if
+// it is in a segment that is still to be swept.  (In a swept segment, that's
+// just what a live series looks like.)  Code that finds series by way of a
+// weak reference must not hand out doomed ones.
+//
+bool Is_Series_Doomed(const REBSER *s)
+{
+    if (not GC_Sweeping)
+        return false;
+
+    if (
+        (s->leader.bits & (NODE_FLAG_MANAGED | NODE_FLAG_MARKED))
+        != NODE_FLAG_MANAGED
+    ){
+        return false;
+    }
+
+    return Is_Node_Unswept(s);
+}
+
+
+#if !defined(NDEBUG)
+
+//
+//  Fill_Sweeplist: C
+//
+REBLEN Fill_Sweeplist(REBSER *sweeplist)
+{
+    assert(SER_WIDE(sweeplist) == sizeof(REBNOD*));
+    assert(SER_USED(sweeplist) == 0);
+
+    REBLEN count = 0;
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg != NULL; seg = seg->next) {
+        REBYTE *unit = cast(REBYTE*, seg + 1);
+        REBLEN n = Mem_Pools[SER_POOL].num_units;
+        for (; n > 0; --n, unit += sizeof(REBSER)) {
+            switch (*unit >> 4) {
+              case 9: {  // 0x8 + 0x1
+                REBSER *s = SER(cast(void*, unit));
+                ASSERT_SERIES_MANAGED(s);
                 if (s->leader.bits & NODE_FLAG_MARKED)
                     s->leader.bits &= ~NODE_FLAG_MARKED;
                 else {
@@ -1061,6 +1876,381 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
 #endif
 
 
+// Mark everything that is live by being on a stack, or an API handle, or
+// otherwise held by the system instead of by being referenced from a cell.
+//
+static void Mark_Root_Set(bool shutdown)
+{
+    trace_root = HEAP_ROOT_MANUALS;
+    Mark_Root_Series();
+
+    if (shutdown)
+        return;
+
+    trace_root = HEAP_ROOT_NATIVES;
+    Mark_Natives();
+    Mark_Symbol_Series();
+
+    trace_root = HEAP_ROOT_DATA_STACK;
+    Mark_Data_Stack();
+
+    trace_root = HEAP_ROOT_GUARDED;
+    Mark_Guarded_Nodes();
+
+    trace_root = HEAP_ROOT_FRAMES;
+    Mark_Frame_Stack_Deep();
+}
+
+
+// Rescan the series that went on the GC_Remarks list during an incremental
+// mark phase.  Their mark is dropped so Queue_Mark_Node_Deep() will process
+// them as if reaching them for the first time.
+//
+static void Remark_Listed_Series(void)
+{
+    assert(GC_Marking);
+
+    REBLEN n;
+    for (n = 0; n < SER_USED(GC_Remarks); ++n) {
+        REBSER *s = *SER_AT(REBSER*, GC_Remarks, n);
+        if (s == nullptr)
+            continue;  // freed while listed, see Unlist_Marked_Series()
+
+        s->leader.bits &= ~(NODE_FLAG_MARKED | SERIES_FLAG_GC_REMARK);
+        Queue_Mark_Node_Deep(s);
+        Propagate_All_GC_Marks();
+    }
+
+    SET_SERIES_USED(GC_Remarks, 0);
+}
+
+
+// Contexts are written through CTX_VAR() in many places--natives, port
+// actors, extensions--and not every one of those writes is known to call
+// GC_Write_Barrier().  So varlists aren't left to the barrier: a minor
+// collection scans all of them (they're never young, see Nurse_Series()),
+// and the end of an incremental mark rescans all the ones it has marked.
+// This costs a walk of the SER_POOL, which Mark_Root_Series() does anyway.
+//
+static void Rescan_Varlists(void)
+{
+    assert(minor_collection or GC_Marking);
+
+    REBSEG *seg;
+    for (seg = Mem_Pools[SER_POOL].segs; seg; seg = seg->next) {
+        REBYTE *unit = cast(REBYTE*, seg + 1);
+        REBLEN n = Mem_Pools[SER_POOL].num_units;
+        for (; n > 0; --n, unit += sizeof(REBSER)) {
+            REBYTE nodebyte = *unit;
+            if (
+                (nodebyte & (
+                    NODE_BYTEMASK_0x40_FREE
+                    | NODE_BYTEMASK_0x20_MANAGED
+                    | NODE_BYTEMASK_0x01_CELL
+                )) != NODE_BYTEMASK_0x20_MANAGED
+            ){
+                continue;
+            }
+
+            REBSER *s = SER(cast(void*, unit));
+            if (not IS_SER_ARRAY(s) or not IS_VARLIST(ARR(s)))
+                continue;
+
+            if (minor_collection)
+                Remember_Series(s);
+            else if (s->leader.bits & NODE_FLAG_MARKED)
+                Remark_Series(s);
+        }
+    }
+}
+
+
+// A major collection has no use for the remembered set, since it looks into
+// every live series anyway.  Take the series off of the list.
+//
+static void Forget_Listed_Series(void)
+{
+    assert(not GC_Marking);
+
+    REBLEN n;
+    for (n = 0; n < SER_USED(GC_Remarks); ++n) {
+        REBSER *s = *SER_AT(REBSER*, GC_Remarks, n);
+        if (s != nullptr)
+            s->leader.bits &= ~SERIES_FLAG_GC_REMARK;
+    }
+
+    SET_SERIES_USED(GC_Remarks, 0);
+}
+
+
+// Scan the remembered set for a minor collection.  Each series is passed off
+// as young just long enough for Queue_Mark_Node_Deep() to look inside it, and
+// its mark is taken off once its contents have been propagated.  (Anything
+// that reaches it in the meantime sees an old series, and stops.)
+//
+static void Mark_Remembered_Series(void)
+{
+    assert(minor_collection);
+
+    REBLEN n;
+    for (n = 0; n < SER_USED(GC_Remarks); ++n) {
+        REBSER *s = *SER_AT(REBSER*, GC_Remarks, n);
+        if (s == nullptr)
+            continue;  // freed while listed, see Unlist_Marked_Series()
+
+        assert(not (s->leader.bits & SERIES_FLAG_GC_YOUNG));
+        s->leader.bits |= SERIES_FLAG_GC_YOUNG;
+        Queue_Mark_Node_Deep(s);
+        s->leader.bits &= ~SERIES_FLAG_GC_YOUNG;
+
+        Propagate_All_GC_Marks();
+
+        s->leader.bits &= ~(NODE_FLAG_MARKED | SERIES_FLAG_GC_REMARK);
+    }
+
+    SET_SERIES_USED(GC_Remarks, 0);
+}
+
+
+// The sweep of a minor collection, which only visits the nursery.  Series in
+// it that were marked are promoted to the old generation, and the rest freed.
+//
+static REBLEN Sweep_Nursery(void)
+{
+    REBLEN count = 0;
+
+    REBSER **sp = SER_HEAD(REBSER*, GC_Nursery);
+    REBLEN n = SER_USED(GC_Nursery);
+    for (; n > 0; --n, ++sp) {
+        REBSER *s = *sp;
+        if (s == nullptr)
+            continue;  // freed outside of the GC, see Unlist_Young_Series()
+
+        assert(s->leader.bits & NODE_FLAG_MANAGED);
+        s->leader.bits &= ~SERIES_FLAG_GC_YOUNG;
+
+        if (s->leader.bits & NODE_FLAG_MARKED) {
+            s->leader.bits &= ~NODE_FLAG_MARKED;
+            ++promoted_since_major;
+        }
+        else {
+            GC_Kill_Series(s);
+            ++count;
+        }
+    }
+
+    SET_SERIES_USED(GC_Nursery, 0);
+    return count;
+}
+
+
+// A major collection makes everything in the nursery old, whether it is
+// going to be swept or not.
+//
+static void Promote_Nursery(void)
+{
+    REBSER **sp = SER_HEAD(REBSER*, GC_Nursery);
+    REBLEN n = SER_USED(GC_Nursery);
+    for (; n > 0; --n, ++sp) {
+        if (*sp != nullptr)
+            (*sp)->leader.bits &= ~SERIES_FLAG_GC_YOUNG;
+    }
+
+    SET_SERIES_USED(GC_Nursery, 0);
+}
+
+
+//
+//  Remark_Series: C
+//
+// While GC_Marking, this is called on series that are written after the mark
+// phase may have scanned them (see GC_Write_Barrier()), and on series that
+// become managed.  The series is marked so the sweep will spare it, and put
+// on the GC_Remarks list so that Recycle_Core() scans it before sweeping.
+//
+void Remark_Series(REBSER *s)
+{
+    assert(GC_Marking);
+
+    if (s->leader.bits & SERIES_FLAG_GC_REMARK)
+        return;  // already listed
+
+    s->leader.bits |= (NODE_FLAG_MARKED | SERIES_FLAG_GC_REMARK);
+
+    if (SER_FULL(GC_Remarks))
+        Extend_Series(GC_Remarks, 8);
+    *SER_AT(REBSER*, GC_Remarks, SER_USED(GC_Remarks)) = s;
+    SET_SERIES_USED(GC_Remarks, SER_USED(GC_Remarks) + 1);
+}
+
+
+//
+//  Remark_Pairing: C
+//
+// Pairings are filled in before they are managed (see Manage_Pairing()), so
+// one that becomes managed while GC_Marking can just be marked on the spot.
+//
+void Remark_Pairing(REBVAL *paired)
+{
+    assert(GC_Marking);
+    Queue_Mark_Pairing_Deep(paired);
+}
+
+
+//
+//  Nurse_Series: C
+//
+// Called on series that become managed while GC_Generational.  Arrays,
+// strings and binaries are put in the GC_Nursery.  Other managed series
+// (varlists, keylists, action details, symbols...) start out old, but their
+// contents are written without a write barrier while they are being made.
+// So they go in the remembered set, to be scanned by the next minor GC.
+//
+void Nurse_Series(REBSER *s)
+{
+    assert(GC_Generational);
+
+    switch (SER_FLAVOR(s)) {
+      case FLAVOR_ARRAY:
+      case FLAVOR_BINARY:
+      case FLAVOR_STRING:
+        break;
+
+      default:
+        Remember_Series(s);
+        return;
+    }
+
+    s->leader.bits |= SERIES_FLAG_GC_YOUNG;
+
+    if (SER_FULL(GC_Nursery))
+        Extend_Series(GC_Nursery, 8);
+    *SER_AT(REBSER*, GC_Nursery, SER_USED(GC_Nursery)) = s;
+    SET_SERIES_USED(GC_Nursery, SER_USED(GC_Nursery) + 1);
+}
+
+
+//
+//  Remember_Series: C
+//
+// Put an old series in the remembered set, so that the next minor collection
+// will scan its contents (see GC_Write_Barrier()).  Unlike Remark_Series(),
+// this doesn't mark the series.
+//
+void Remember_Series(REBSER *s)
+{
+    if (s->leader.bits & SERIES_FLAG_GC_REMARK)
+        return;  // already listed
+
+    s->leader.bits |= SERIES_FLAG_GC_REMARK;
+
+    if (SER_FULL(GC_Remarks))
+        Extend_Series(GC_Remarks, 8);
+    *SER_AT(REBSER*, GC_Remarks, SER_USED(GC_Remarks)) = s;
+    SET_SERIES_USED(GC_Remarks, SER_USED(GC_Remarks) + 1);
+}
+
+
+//
+//  Unlist_Young_Series: C
+//
+// A young series that is freed by something besides a sweep has to be taken
+// out of the GC_Nursery.  (This is not believed to happen, as managed series
+// are normally only freed by the GC.)
+//
+void Unlist_Young_Series(REBSER *s)
+{
+    s->leader.bits &= ~SERIES_FLAG_GC_YOUNG;
+
+    REBSER **sp = SER_HEAD(REBSER*, GC_Nursery);
+    REBLEN n = SER_USED(GC_Nursery);
+    for (; n > 0; --n, ++sp) {
+        if (*sp == s) {
+            *sp = nullptr;
+            return;
+        }
+    }
+}
+
+
+//
+//  Unlist_Marked_Series: C
+//
+// A marked series that is freed while GC_Marking (e.g. by GC_Kill_Series()
+// because it failed allocation) may still be on the mark stack or on the
+// GC_Remarks list.  Null it out there so the mark phase won't touch it.
+// (A series in the remembered set is taken off of GC_Remarks the same way.)
+//
+void Unlist_Marked_Series(REBSER *s)
+{
+    REBARR **ap = SER_HEAD(REBARR*, GC_Mark_Stack);
+    REBLEN n = SER_USED(GC_Mark_Stack);
+    for (; n > 0; --n, ++ap) {
+        if (cast(REBSER*, *ap) == s)
+            *ap = nullptr;
+    }
+
+    if (not (s->leader.bits & SERIES_FLAG_GC_REMARK))
+        return;
+
+    REBSER **sp = SER_HEAD(REBSER*, GC_Remarks);
+    n = SER_USED(GC_Remarks);
+    for (; n > 0; --n, ++sp) {
+        if (*sp == s)
+            *sp = nullptr;
+    }
+}
+
+
+//
+//  Recycle_Step: C
+//
+// Signal processing calls this instead of Recycle() once RECYCLE/INCREMENTAL
+// has set a GC_Step_Budget.  The first call marks the root set without doing
+// any propagation, and then each call propagates marks through at most that
+// many cells.  When the mark stack runs dry, Recycle_Core() finishes the
+// cycle with a stop-the-world remark (of the roots, the series the write
+// barrier listed, and every varlist), and then sweeps.
+//
+// If allocation gets a whole ballast beyond the point where a collection
+// was due, the cycle is finished right away to keep the heap from running
+// ahead of the marking.
+//
+// Returns the number of nodes swept if a cycle was finished, otherwise 0.
+//
+REBLEN Recycle_Step(void)
+{
+    assert(GC_Step_Budget != 0 or GC_Marking);
+
+    if (GC_Disabled) {
+        if (not GC_Marking)
+            SET_SIGNAL(SIG_RECYCLE);  // same as Recycle_Core() would do
+        return 0;
+    }
+
+    if (not GC_Marking) {
+        ASSERT_NO_GC_MARKS_PENDING();
+        Finish_Lazy_Sweep();
+        Forget_Listed_Series();  // any remembered set is of no use to it
+
+        GC_Marking = true;  // Alloc_Series_Node() etc. must remark from here
+
+        deferring_propagation = true;
+        Mark_Root_Set(false);
+        deferring_propagation = false;
+
+        return 0;
+    }
+
+    if (GC_Step_Budget != 0 and GC_Ballast > -TG_Ballast) {
+        if (not Propagate_GC_Marks(GC_Step_Budget))
+            return 0;
+    }
+
+    return Recycle_Core(false, nullptr);
+}
+
+
 //
 //  Recycle_Core: C
 //
@@ -1093,6 +2283,16 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     assert(IS_END(&TG_Thrown_Label_Debug));
   #endif
 
+    // The shutdown marking and the /VERBOSE sweeplist need a clean slate,
+    // so an incremental cycle that is underway gets finished first.
+    //
+    if (GC_Marking and (shutdown or sweeplist != nullptr)) {
+        bool disabled = GC_Disabled;
+        GC_Disabled = false;
+        Recycle_Core(false, nullptr);
+        GC_Disabled = disabled;
+    }
+
     // If disabled by RECYCLE/OFF, exit now but set the pending flag.  (If
     // shutdown, ignore so recycling runs and can be checked for balance.)
     //
@@ -1101,27 +2301,50 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         return 0;
     }
 
+    Finish_Lazy_Sweep();  // marking needs the marks of the last cycle gone
+
   #if !defined(NDEBUG)
     GC_Recycling = true;
   #endif
 
-    ASSERT_NO_GC_MARKS_PENDING();
+    if (shutdown)
+        GC_Trigger = GC_TRIGGER_SHUTDOWN;
+
+    struct Reb_GC_Pause pause;
+    Begin_GC_Pause(&pause, false);
+
+    ++TG_Word_Cache_Generation;  // nodes of freed patches may get reused
+    ++TG_Hash_Cache_Generation;  // nodes of freed strings may get reused
+    Forget_Parse_Memos();  // ...as may nodes of freed rule blocks
+    Forget_Keylist_Shapes();  // the table doesn't keep keylists alive
+
+    if (not GC_Marking) {  // else Recycle_Step() has a mark phase in progress
+        ASSERT_NO_GC_MARKS_PENDING();
+        Forget_Listed_Series();
+    }
+
+    if (shutdown)
+        GC_Generational = false;  // shouldn't make a new nursery after this
 
   #if defined(DEBUG_COLLECT_STATS)
     PG_Reb_Stats->Recycle_Counter++;
-    PG_Reb_Stats->Recycle_Series = Mem_Pools[SER_POOL].free;
+    PG_Reb_Stats->Recycle_Series = Pool_Units_Free(SER_POOL);
     PG_Reb_Stats->Mark_Count = 0;
   #endif
 
-    // The TG_Reuse list consists of entries which could grow to arbitrary
-    // length, and which aren't being tracked anywhere.  Cull them during GC
+    // The TG_Reuse lists consist of entries which could be arbitrarily big,
+    // and which aren't being tracked anywhere.  Cull them during GC
     // in case the stack at one point got very deep and isn't going to use
     // them again, and the memory needs reclaiming.
     //
-    while (TG_Reuse) {
-        REBARR *varlist = TG_Reuse;
-        TG_Reuse = LINK(ReuseNext, TG_Reuse);
-        GC_Kill_Series(varlist); // no track for Free_Unmanaged_Series()
+    REBLEN n;
+    for (n = 0; n < VARLIST_REUSE_BUCKETS; ++n) {
+        while (TG_Reuse[n]) {
+            REBARR *varlist = TG_Reuse[n];
+            TG_Reuse[n] = LINK(ReuseNext, TG_Reuse[n]);
+            GC_Kill_Series(varlist); // no track for Free_Unmanaged_Series()
+        }
+        TG_Reuse_Count[n] = 0;
     }
 
     // MARKING PHASE: the "root set" from which we determine the liveness
@@ -1130,23 +2353,38 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // (In particular because that is when API series whose lifetimes
     // are bound to frames will be freed, if the frame is expired.)
     //
-    Mark_Root_Series();
-
-    if (not shutdown) {
-        Mark_Natives();
-        Mark_Symbol_Series();
-
-        Mark_Data_Stack();
-
-        Mark_Guarded_Nodes();
+    // If this is finishing an incremental cycle, then the root set is marked
+    // again (stacks and API handles aren't covered by the write barrier) and
+    // the series that were written or managed since it started are rescanned.
+    //
+  #ifdef PARALLEL_MARKING
+    if (GC_Mark_Threads > 1 and not GC_Marking and not shutdown) {
+        deferring_propagation = true;
+        Mark_Root_Set(false);
+        deferring_propagation = false;
 
-        Mark_Frame_Stack_Deep();
+        Propagate_GC_Marks_Parallel(GC_Mark_Threads);
+    }
+    else
+  #endif
+        Mark_Root_Set(shutdown);
 
+    if (not shutdown) {
         Propagate_All_GC_Marks();
 
+        if (GC_Marking) {
+            Rescan_Varlists();
+            Remark_Listed_Series();
+        }
+
+        trace_root = HEAP_ROOT_DEVICES;
         Mark_Devices_Deep();
     }
 
+    GC_Marking = false;
+
+    Promote_Nursery();  // (would-be survivors of a minor GC are old anyway)
+
     // SWEEPING PHASE
 
     ASSERT_NO_GC_MARKS_PENDING();
@@ -1160,13 +2398,21 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         count += Fill_Sweeplist(sweeplist);
     #endif
     }
-    else
+    else if (GC_Lazy_Sweep and not shutdown)
+        count += Start_Lazy_Sweep();  // does Reclaim_After_Sweep() when done
+    else {
         count += Sweep_Series();
+        if (not shutdown)  // (Shutdown_Pools() is going to free everything)
+            Reclaim_After_Sweep();
+    }
+
+    if (not shutdown and sweeplist == NULL)
+        promoted_since_major = 0;
 
   #if defined(DEBUG_COLLECT_STATS)
     // Compute new stats:
     PG_Reb_Stats->Recycle_Series
-        = Mem_Pools[SER_POOL].free - PG_Reb_Stats->Recycle_Series;
+        = Pool_Units_Free(SER_POOL) - PG_Reb_Stats->Recycle_Series;
     PG_Reb_Stats->Recycle_Series_Total += PG_Reb_Stats->Recycle_Series;
     PG_Reb_Stats->Recycle_Prior_Eval = Eval_Cycles;
   #endif
@@ -1182,8 +2428,12 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // Reverted to the R3-Alpha state, accommodating a comment "do not adjust
     // task variables or boot strings in shutdown when they are being freed."
     //
-    if (not shutdown)
-        GC_Ballast = TG_Ballast;
+    // (End_GC_Pause() resets it to TG_Ballast, or by RECYCLE/ADAPTIVE rules.)
+    //
+    End_GC_Pause(&pause, count, shutdown);
+
+    ++GC_Major_Count;
+    GC_Major_Nanoseconds += pause.nanoseconds;
 
     ASSERT_NO_GC_MARKS_PENDING();
 
@@ -1208,6 +2458,134 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
 }
 
 
+//
+//  Recycle_Minor: C
+//
+// Signal processing calls this instead of Recycle() once RECYCLE/GENERATIONAL
+// is on.  Only the series in the GC_Nursery are collected, and those which
+// survive are promoted to the old generation.  Marking starts from the root
+// set and the remembered set, and doesn't go into old series--so the work
+// is in proportion to the young series and the recently written old ones.
+// (The walk over all nodes in Mark_Root_Series() is still done, though.)
+//
+// Once the series promoted since the last major collection add up to half of
+// what that collection left live, this runs a major collection instead.
+//
+// Returns the number of nodes swept.
+//
+REBLEN Recycle_Minor(void)
+{
+    assert(GC_Generational and not GC_Marking);
+
+    if (GC_Disabled) {
+        SET_SIGNAL(SIG_RECYCLE);  // same as Recycle_Core() would do
+        return 0;
+    }
+
+    Finish_Lazy_Sweep();  // also brings live_after_major up to date
+
+    if (promoted_since_major >= live_after_major / 2) {
+        GC_Trigger = GC_TRIGGER_PROMOTION;
+        return Recycle();
+    }
+
+  #if !defined(NDEBUG)
+    if (GC_Recycling) {
+        printf("Recycle re-entry; should only happen in debug scenarios.\n");
+        SET_SIGNAL(SIG_RECYCLE);
+        return 0;
+    }
+    GC_Recycling = true;
+  #endif
+
+    assert(IS_END(&TG_Thrown_Arg));  // see notes in Recycle_Core()
+    ASSERT_NO_GC_MARKS_PENDING();
+
+    struct Reb_GC_Pause pause;
+    Begin_GC_Pause(&pause, true);
+
+    ++TG_Word_Cache_Generation;  // nodes of freed patches may get reused
+    ++TG_Hash_Cache_Generation;  // nodes of freed strings may get reused
+    Forget_Parse_Memos();  // ...as may nodes of freed rule blocks
+    Forget_Keylist_Shapes();  // the table doesn't keep keylists alive
+
+    // Old series found in the root set are put in the remembered set, so
+    // it has to be scanned after everything else.
+    //
+    minor_collection = true;
+    Mark_Root_Set(false);
+    Mark_Devices_Deep();
+    Rescan_Varlists();
+    Mark_Remembered_Series();
+    minor_collection = false;
+
+    ASSERT_NO_GC_MARKS_PENDING();
+
+    REBLEN count = Sweep_Nursery();
+
+    End_GC_Pause(&pause, count, false);  // resets GC_Ballast
+
+    ++GC_Minor_Count;
+    GC_Minor_Nanoseconds += pause.nanoseconds;
+
+  #if !defined(NDEBUG)
+    GC_Recycling = false;
+
+    if (Reb_Opts->watch_recycle) {
+        printf("RECYCLE (minor): %u nodes\n", cast(unsigned int, count));
+        fflush(stdout);
+    }
+  #endif
+
+    return count;
+}
+
+
+//
+//  Recycle_Tracing_Heap: C
+//
+// A full collection which gives Trace_Heap_Reference() every reference that
+// the marking follows, for DUMP-HEAP.  Only one thread can mark while this
+// is done, and an incremental cycle that is underway gets finished first (as
+// the series it marked already wouldn't be looked into again).
+//
+REBLEN Recycle_Tracing_Heap(void)
+{
+    bool disabled = GC_Disabled;
+    GC_Disabled = false;
+
+    if (GC_Marking)
+        Recycle_Core(false, nullptr);
+
+    REBLEN threads = GC_Mark_Threads;
+    GC_Mark_Threads = 1;
+
+    heap_tracing = true;
+    trace_from = nullptr;
+    GC_Trigger = GC_TRIGGER_REQUEST;
+    REBLEN count = Recycle_Core(false, nullptr);
+    heap_tracing = false;
+
+    GC_Mark_Threads = threads;
+    GC_Disabled = disabled;
+    return count;
+}
+
+
+//
+//  Set_GC_Generational: C
+//
+// Turn minor collections on or off (RECYCLE/GENERATIONAL).  Either way, the
+// nursery is promoted: while minor collections are off, the write barrier
+// isn't keeping up the remembered set, so nothing can be left young.
+//
+void Set_GC_Generational(bool on)
+{
+    Promote_Nursery();
+    GC_Generational = on;
+}
+
+
 //
 //  Recycle: C
 //
@@ -1291,6 +2669,7 @@ void Startup_GC(void)
     assert(not GC_Recycling);
 
     GC_Ballast = MEM_BALLAST;
+    GC_Bytes_Allocated = 0;
 
     // Temporary series and values protected from GC. Holds node pointers.
     //
@@ -1300,6 +2679,34 @@ void Startup_GC(void)
     // nested structures don't cause the C stack to overflow.
     //
     GC_Mark_Stack = Make_Series(100, FLAG_FLAVOR(NODELIST));
+
+    // Stop-the-world collection is the default, see RECYCLE/INCREMENTAL
+    //
+    GC_Step_Budget = 0;
+    GC_Marking = false;
+    GC_Remarks = Make_Series(15, FLAG_FLAVOR(NODELIST));
+
+    // ...as is collecting the whole heap every time, see RECYCLE/GENERATIONAL
+    //
+    GC_Generational = false;
+    GC_Nursery = Make_Series(15, FLAG_FLAVOR(NODELIST));
+
+    GC_Mark_Threads = 1;
+
+    // ...and sweeping all of the SER_POOL in the pause, see RECYCLE/LAZY
+    //
+    GC_Lazy_Sweep = false;
+    GC_Sweeping = false;
+
+    GC_Minor_Count = 0;
+    GC_Major_Count = 0;
+    GC_Minor_Nanoseconds = 0;
+    GC_Major_Nanoseconds = 0;
+
+    GC_Trigger = GC_TRIGGER_REQUEST;
+    GC_Pause_Log = TRY_ALLOC_N_ZEROFILL(struct Reb_GC_Pause, GC_PAUSE_LOG_SIZE);
+    GC_Pauses_Logged = 0;
+    GC_Adaptive_Percent = 0;  // fixed ballast, see RECYCLE/ADAPTIVE
 }
 
 
@@ -1308,8 +2715,15 @@ void Startup_GC(void)
 //
 void Shutdown_GC(void)
 {
+    assert(not GC_Marking);  // shutdown Recycle_Core() finishes any cycle
+    assert(not GC_Sweeping);
+
     Free_Unmanaged_Series(GC_Guarded);
     Free_Unmanaged_Series(GC_Mark_Stack);
+    Free_Unmanaged_Series(GC_Remarks);
+    Free_Unmanaged_Series(GC_Nursery);
+
+    FREE_N(struct Reb_GC_Pause, GC_PAUSE_LOG_SIZE, GC_Pause_Log);
 }
 
 
@@ -1337,7 +2751,7 @@ static void Mark_Devices_Deep(void)
         // REBREQ is a REBSER node and has those fields in LINK()/MISC() with
         // SERIES_FLAG_LINK_NODE_NEEDS_MARK/SERIES_FLAG_MISC_NODE_NEEDS_MARK
         //
-        Queue_Mark_Node_Deep(req);
+        Queue_Mark_Root_Series_Deep(SER(req));
     }
 
     Propagate_All_GC_Marks();
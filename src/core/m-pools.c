@@ -59,9 +59,26 @@
 // R3_ALWAYS_MALLOC to 1.
 //
 
+// mremap() is Linux-specific, and MAP_ANONYMOUS is not in the strict C99
+// headers either, so the GNU extensions have to be asked for before any
+// system header gets included (see also HAS_POSIX_SIGNAL in %reb-config.h)
+//
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
 #include "sys-core.h"
 #include "sys-int-funcs.h"
 
+#ifdef TO_LINUX
+    #include <sys/mman.h>
+    #define HAS_MEM_MAP  // mmap(), madvise() and mremap() are available
+#endif
+
+#if !defined(NDEBUG)
+    THREAD_LOCAL bool Pool_Thread_Debug = false;  // see ASSERT_POOL_THREAD()
+#endif
+
 
 //
 //  Try_Alloc_Mem: C
@@ -171,6 +188,113 @@ void Free_Mem(void *mem, size_t size)
 }
 
 
+//
+//  Try_Map_Mem: C
+//
+// Get a block of whole MEM_MAP_GRANULEs directly from the OS for the page-
+// mapped allocator (see notes on PAGE-MAPPED ALLOCATIONS in %mem-pools.h).
+// As with Try_Alloc_Mem(), the block counts against PG_Mem_Usage, and the
+// caller has to remember its size in order to free it with Unmap_Mem().
+//
+void *Try_Map_Mem(size_t size)
+{
+    assert(size != 0 and size % MEM_MAP_GRANULE == 0);
+
+  #ifdef HAS_MEM_MAP
+    void *p = MAP_FAILED;
+
+  #ifdef MAP_HUGETLB
+    if (PG_Mem_Map == MEM_MAP_HUGETLB)  // fails unless pages were reserved
+        p = mmap(
+            nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0
+        );
+  #endif
+
+    if (p == MAP_FAILED) {
+        //
+        // Transparent huge pages can only back extents which are aligned to
+        // the huge page size, while mmap() only promises ordinary page
+        // alignment.  So map one granule extra, and trim off the ends.
+        //
+        char *raw = cast(char*, mmap(
+            nullptr, size + MEM_MAP_GRANULE, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+        ));
+        if (raw == MAP_FAILED)
+            return nullptr;
+
+        uintptr_t lead = MEM_MAP_ROUND(cast(uintptr_t, raw))
+            - cast(uintptr_t, raw);
+        if (lead != 0)
+            munmap(raw, lead);
+        munmap(raw + lead + size, MEM_MAP_GRANULE - lead);
+
+        p = raw + lead;
+
+      #ifdef MADV_HUGEPAGE
+        madvise(p, size, MADV_HUGEPAGE);  // only advice, failing is harmless
+      #endif
+    }
+
+    PG_Mem_Usage += size;
+    return p;
+  #else
+    return Try_Alloc_Mem(size);  // PG_Mem_Map is never set without mmap()
+  #endif
+}
+
+
+//
+//  Unmap_Mem: C
+//
+// Give back a block that was gotten from Try_Map_Mem() (or Try_Remap_Mem()).
+//
+void Unmap_Mem(void *mem, size_t size)
+{
+    assert(size % MEM_MAP_GRANULE == 0);
+
+  #ifdef HAS_MEM_MAP
+    if (munmap(mem, size) != 0)
+        panic ("munmap() failed on a page-mapped memory block");
+    PG_Mem_Usage -= size;
+  #else
+    Free_Mem(mem, size);
+  #endif
+}
+
+
+//
+//  Try_Remap_Mem: C
+//
+// Resize a block gotten from Try_Map_Mem().  mremap() can extend the mapping
+// where it is, or move it by rewriting page tables instead of copying the
+// bytes.  (A moved block may lose its huge page alignment, which costs TLB
+// entries but not correctness.)  Returns nullptr if the block can't be
+// resized this way, in which case it is left as it was.
+//
+void *Try_Remap_Mem(void *mem, size_t old_size, size_t new_size)
+{
+    assert(old_size % MEM_MAP_GRANULE == 0);
+    assert(new_size % MEM_MAP_GRANULE == 0);
+
+  #if defined(HAS_MEM_MAP) && defined(MREMAP_MAYMOVE)
+    void *p = mremap(mem, old_size, new_size, MREMAP_MAYMOVE);
+    if (p == MAP_FAILED)
+        return nullptr;  // e.g. older kernels can't remap MAP_HUGETLB
+
+    PG_Mem_Usage -= old_size;
+    PG_Mem_Usage += new_size;
+    return p;
+  #else
+    UNUSED(mem);
+    UNUSED(old_size);
+    UNUSED(new_size);
+    return nullptr;
+  #endif
+}
+
+
 /***********************************************************************
 **
 **  MEMORY POOLS
@@ -232,11 +356,35 @@ const REBPOOLSPEC Mem_Pool_Spec[MAX_POOLS] =
 };
 
 
+// Pool segments are page-mapped when they are big enough (which they are
+// made to be by Startup_Pools() when the mapped allocator is on).
+//
+static REBSEG *Try_Alloc_Segment(size_t size)
+{
+    if (Is_Mem_Mapped(size))
+        return cast(REBSEG*, Try_Map_Mem(MEM_MAP_ROUND(size)));
+    return cast(REBSEG*, TRY_ALLOC_N(char, size));
+}
+
+static void Free_Segment(REBSEG *seg)
+{
+    if (Is_Mem_Mapped(seg->size))
+        Unmap_Mem(seg, MEM_MAP_ROUND(seg->size));
+    else
+        FREE_N(char, seg->size, cast(char*, seg));
+}
+
+
 //
 //  Startup_Pools: C
 //
 // Initialize memory pool array.
 //
+// If R3_HUGE_PAGES is set in the environment, the segment of each pool is
+// grown to fill whole MEM_MAP_GRANULEs so it can be page-mapped (see notes
+// in %mem-pools.h).  This happens after `scale` has been applied, so scaling
+// still gets pools that are that many granules big.
+//
 void Startup_Pools(REBINT scale)
 {
   #ifdef DEBUG_ENABLE_ALWAYS_MALLOC
@@ -255,6 +403,24 @@ void Startup_Pools(REBINT scale)
     }
   #endif
 
+    PG_Mem_Map = MEM_MAP_NONE;
+
+  #ifdef HAS_MEM_MAP
+    const char *env_huge_pages = getenv("R3_HUGE_PAGES");
+    if (env_huge_pages) {
+        int mode = atoi(env_huge_pages);
+        if (mode == 1)
+            PG_Mem_Map = MEM_MAP_TRANSPARENT;
+        else if (mode >= 2)
+            PG_Mem_Map = MEM_MAP_HUGETLB;
+    }
+  #endif
+
+  #ifdef DEBUG_ENABLE_ALWAYS_MALLOC
+    if (PG_Always_Malloc)
+        PG_Mem_Map = MEM_MAP_NONE;  // let Valgrind/ASAN see every allocation
+  #endif
+
     REBINT unscale = 1;
     if (scale == 0)
         scale = 1;
@@ -285,10 +451,29 @@ void Startup_Pools(REBINT scale)
 
         Mem_Pools[n].num_units = (Mem_Pool_Spec[n].num_units * scale) / unscale;
         if (Mem_Pools[n].num_units < 2) Mem_Pools[n].num_units = 2;
+
+        if (PG_Mem_Map != MEM_MAP_NONE and n != SYSTEM_POOL) {
+            size_t seg_size = MEM_MAP_ROUND(
+                Mem_Pools[n].wide * Mem_Pools[n].num_units + sizeof(REBSEG)
+            );
+            Mem_Pools[n].num_units =
+                (seg_size - sizeof(REBSEG)) / Mem_Pools[n].wide;
+        }
+
         Mem_Pools[n].free = 0;
         Mem_Pools[n].has = 0;
+        Mem_Pools[n].reclaimed = 0;
     }
 
+    // The unit caches start out empty, so the first allocation from each
+    // pool will be a miss that takes a batch from the pool (see %mem-pools.h)
+    //
+    TG_Pool_Caches = TRY_ALLOC_N_ZEROFILL(REBPCH, MAX_POOLS);
+
+  #if !defined(NDEBUG)
+    Pool_Thread_Debug = true;  // only this thread may use the pools
+  #endif
+
     // For pool lookup. Maps size to pool index. (See Find_Pool below)
     PG_Pool_Map = TRY_ALLOC_N(REBYTE, (4 * MEM_BIG_SIZE) + 1);
 
@@ -377,19 +562,21 @@ void Shutdown_Pools(void)
 
     REBLEN pool_num;
     for (pool_num = 0; pool_num < MAX_POOLS; pool_num++) {
-        REBPOL *pool = &Mem_Pools[pool_num];
-        REBLEN mem_size = pool->wide * pool->num_units + sizeof(REBSEG);
-
-        REBSEG *seg = pool->segs;
+        REBSEG *seg = Mem_Pools[pool_num].segs;
         while (seg) {
             REBSEG *next;
             next = seg->next;
-            FREE_N(char, mem_size, cast(char*, seg));
+            Free_Segment(seg);
             seg = next;
         }
     }
 
     FREE_N(REBPOL, MAX_POOLS, Mem_Pools);
+    FREE_N(REBPCH, MAX_POOLS, TG_Pool_Caches);  // units were in the segments
+
+  #if !defined(NDEBUG)
+    Pool_Thread_Debug = false;
+  #endif
 
     FREE_N(REBYTE, (4 * MEM_BIG_SIZE) + 1, PG_Pool_Map);
 
@@ -437,7 +624,7 @@ bool Try_Fill_Pool(REBPOL *pool)
     REBLEN num_units = pool->num_units;
     REBLEN mem_size = pool->wide * num_units + sizeof(REBSEG);
 
-    REBSEG *seg = cast(REBSEG*, TRY_ALLOC_N(char, mem_size));
+    REBSEG *seg = Try_Alloc_Segment(mem_size);
     if (seg == nullptr)
         return false;
 
@@ -477,6 +664,253 @@ bool Try_Fill_Pool(REBPOL *pool)
 }
 
 
+//
+//  Try_Refill_Pool_Cache: C
+//
+// Called by Try_Alloc_Node() when the unit cache for a pool is empty.
+// Moves up to POOL_CACHE_BATCH units off the front of the pool's free list
+// into the cache, filling the pool with a new segment first if necessary.
+// (An empty SER_POOL gets some of a lazy sweep done before it is filled.)
+//
+bool Try_Refill_Pool_Cache(REBLEN pool_id)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    REBPCH *cache = &TG_Pool_Caches[pool_id];
+    assert(cache->first == nullptr and cache->count == 0);
+
+    if (not pool->first and pool_id == SER_POOL and GC_Sweeping) {
+        Sweep_Series_Lazily();  // see RECYCLE/LAZY
+        if (cache->first)
+            return true;  // release build Free_Node() puts frees in the cache
+    }
+
+    if (not pool->first) {  // pool has run out of nodes
+        if (not Try_Fill_Pool(pool))  // attempt to refill it
+            return false;
+    }
+
+    REBPLU *unit = pool->first;
+    REBLEN n = 1;
+    while (n < POOL_CACHE_BATCH and unit->next_if_free) {
+        unit = unit->next_if_free;
+        ++n;
+    }
+
+    cache->first = pool->first;
+    cache->count = n;
+    ++cache->refills;
+
+    pool->first = unit->next_if_free;
+    if (unit == pool->last)
+        pool->last = nullptr;
+    unit->next_if_free = nullptr;
+
+    pool->free -= n;
+    return true;
+}
+
+
+//
+//  Drain_Pool_Cache: C
+//
+// Give all but `keep` units in a pool's unit cache back to the pool.  This is
+// done in a batch when the cache overflows, and with keep of 0 when code
+// needs the pool's free list to be authoritative.
+//
+void Drain_Pool_Cache(REBLEN pool_id, REBLEN keep)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+    REBPCH *cache = &TG_Pool_Caches[pool_id];
+
+    if (cache->count <= keep)
+        return;
+
+    REBLEN n = cache->count - keep;
+    REBPLU *head = cache->first;
+    REBPLU *tail = head;
+    REBLEN i;
+    for (i = 1; i < n; ++i)
+        tail = tail->next_if_free;
+
+    cache->first = tail->next_if_free;
+    cache->count = keep;
+    ++cache->drains;
+
+    tail->next_if_free = pool->first;  // most recently freed go out first
+    pool->first = head;
+    if (not pool->last)
+        pool->last = tail;
+
+    pool->free += n;
+}
+
+
+//
+//  Compare_Segment_Addresses: C
+//
+// Callback for reb_qsort_r(), ordering an array of REBSEG* by address.
+//
+int Compare_Segment_Addresses(
+    void *thunk,
+    const void *v1,
+    const void *v2
+){
+    UNUSED(thunk);
+    uintptr_t a = cast(uintptr_t, *cast(REBSEG* const*, v1));
+    uintptr_t b = cast(uintptr_t, *cast(REBSEG* const*, v2));
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+
+// Binary search of an address-ordered segment array for one containing unit.
+//
+static REBLEN Find_Segment_Index(
+    REBSEG **segs,
+    REBLEN num_segs,
+    const REBPLU *unit
+){
+    REBLEN lo = 0;
+    REBLEN hi = num_segs;
+    while (lo < hi) {
+        REBLEN mid = lo + (hi - lo) / 2;
+        uintptr_t start = cast(uintptr_t, segs[mid]);
+        if (cast(uintptr_t, unit) < start)
+            hi = mid;
+        else if (cast(uintptr_t, unit) >= start + segs[mid]->size)
+            lo = mid + 1;
+        else
+            return mid;
+    }
+    panic (unit);  // every free unit must live in one of the pool's segments
+}
+
+
+//
+//  Reclaim_Pool_Segments: C
+//
+// Pools only ever grew in R3-Alpha: Try_Fill_Pool() added segments, and they
+// were not given back until Shutdown_Pools().  So a process that hit a peak
+// once would keep that memory for the remainder of its run.
+//
+// This finds segments whose units are all on the free list and frees them.
+// One completely free segment is kept per pool, so that a program whose
+// usage hovers around a segment boundary doesn't thrash allocating and
+// freeing the same segment.  Returns the number of segments released.
+//
+// It is run after the sweep in Recycle_Core(), when freed series have been
+// returned to their pools.  The work is proportional to the free units.
+//
+REBLEN Reclaim_Pool_Segments(REBLEN pool_id)
+{
+    REBPOL *pool = &Mem_Pools[pool_id];
+
+    // Cheap early out: unless there are at least two segments' worth of free
+    // units, there can't be a free segment beyond the one that is kept.
+    //
+    if (Pool_Units_Free(pool_id) < 2 * pool->num_units)
+        return 0;
+
+    REBLEN num_segs = 0;
+    REBSEG *seg;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next)
+        ++num_segs;
+
+    REBSEG **segs = TRY_ALLOC_N(REBSEG*, num_segs);
+    if (not segs)
+        return 0;  // reclaiming is an optimization, fine to skip it
+    REBLEN *free_counts = TRY_ALLOC_N(REBLEN, num_segs);
+    if (not free_counts) {
+        FREE_N(REBSEG*, num_segs, segs);
+        return 0;
+    }
+
+    REBLEN i = 0;
+    for (seg = pool->segs; seg != nullptr; seg = seg->next, ++i) {
+        segs[i] = seg;
+        free_counts[i] = 0;
+    }
+    reb_qsort_r(
+        segs, num_segs, sizeof(REBSEG*), nullptr, &Compare_Segment_Addresses
+    );
+
+    // Units cached for this thread have to be on the pool's list so they can
+    // be unlinked if their segment is freed.
+    //
+    Drain_Pool_Cache(pool_id, 0);
+
+    REBPLU *unit;
+    for (unit = pool->first; unit != nullptr; unit = unit->next_if_free)
+        ++free_counts[Find_Segment_Index(segs, num_segs, unit)];
+
+    // Decide which segments to free, signaled with UNLIMITED in the count.
+    //
+    REBLEN num_reclaim = 0;
+    bool kept_one = false;
+    for (i = 0; i < num_segs; ++i) {
+        REBLEN units = (segs[i]->size - sizeof(REBSEG)) / pool->wide;
+        if (free_counts[i] != units)
+            continue;
+        if (not kept_one) {
+            kept_one = true;
+            continue;
+        }
+        free_counts[i] = UNLIMITED;
+        ++num_reclaim;
+    }
+
+    if (num_reclaim != 0) {
+        //
+        // Rebuild the free list without any units from reclaimed segments.
+        //
+        REBPLU **link = &pool->first;
+        pool->last = nullptr;
+        for (unit = pool->first; unit != nullptr; unit = unit->next_if_free) {
+            if (free_counts[Find_Segment_Index(segs, num_segs, unit)]
+                == UNLIMITED
+            ){
+                --pool->free;
+                continue;
+            }
+            *link = unit;
+            link = &unit->next_if_free;
+            pool->last = unit;
+        }
+        *link = nullptr;
+
+        // Unlink the segments from the pool's chain.  (They can't be freed
+        // until the searches of the `segs` array are finished.)
+        //
+        REBSEG *doomed = nullptr;
+        REBSEG **seg_link = &pool->segs;
+        while ((seg = *seg_link) != nullptr) {
+            REBLEN index = Find_Segment_Index(
+                segs, num_segs, cast(REBPLU*, seg + 1)
+            );
+            if (free_counts[index] != UNLIMITED) {
+                seg_link = &seg->next;
+                continue;
+            }
+            *seg_link = seg->next;
+            seg->next = doomed;
+            doomed = seg;
+        }
+
+        while (doomed) {
+            seg = doomed;
+            doomed = seg->next;
+            pool->has -= (seg->size - sizeof(REBSEG)) / pool->wide;
+            ++pool->reclaimed;
+            Free_Segment(seg);
+        }
+    }
+
+    FREE_N(REBLEN, num_segs, free_counts);
+    FREE_N(REBSEG*, num_segs, segs);
+
+    return num_reclaim;
+}
+
+
 #if defined(DEBUG_FANCY_PANIC)
 
 //
@@ -582,6 +1016,9 @@ REBVAL *Alloc_Pairing(void) {
     REBVAL *key = PAIRING_KEY(paired);
     Prep_Cell(key);
 
+    if ((TG_Alloc_Sample_Countdown -= 2 * sizeof(REBVAL)) < 0)
+        Sample_Allocation(paired, 2 * sizeof(REBVAL));
+
     return paired;
 }
 
@@ -594,6 +1031,11 @@ REBVAL *Alloc_Pairing(void) {
 //
 void Manage_Pairing(REBVAL *paired) {
     SET_CELL_FLAG(paired, MANAGED);
+
+    if (GC_Marking)
+        Remark_Pairing(paired);  // incremental mark phase hasn't seen it
+    if (PAR_POOL == SER_POOL)
+        Mark_If_Unswept(paired);  // lazy sweep is only of the SER_POOL
 }
 
 
@@ -617,6 +1059,8 @@ void Unmanage_Pairing(REBVAL *paired) {
 //
 void Free_Pairing(REBVAL *paired) {
     assert(NOT_CELL_FLAG(paired, MANAGED));
+    if (TG_Alloc_Samples_Live)
+        Forget_Allocation_Sample(paired);
     Free_Node(SER_POOL, paired);
 
   #if defined(DEBUG_COUNT_TICKS)
@@ -644,8 +1088,9 @@ void Free_Pairing(REBVAL *paired) {
 //
 void Free_Unbiased_Series_Data(char *unbiased, REBLEN total)
 {
+    ASSERT_POOL_THREAD();
+
     REBLEN pool_num = FIND_POOL(total);
-    REBPOL *pool;
 
     if (pool_num < SYSTEM_POOL) {
         //
@@ -658,21 +1103,82 @@ void Free_Unbiased_Series_Data(char *unbiased, REBLEN total)
 
         assert(Mem_Pools[pool_num].wide >= total);
 
-        pool = &Mem_Pools[pool_num];
+        mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
+
+      #ifdef NDEBUG
+        REBPCH *cache = &TG_Pool_Caches[pool_num];
+        unit->next_if_free = cache->first;
+        cache->first = unit;
+        if (++cache->count > POOL_CACHE_MAX)
+            Drain_Pool_Cache(pool_num, POOL_CACHE_BATCH);
+      #else
+        REBPOL *pool = &Mem_Pools[pool_num];
         unit->next_if_free = pool->first;
         pool->first = unit;
+        if (not pool->last)
+            pool->last = unit;
         pool->free++;
-
-        mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
+      #endif
     }
     else {
-        FREE_N(char, total, unbiased);
+        if (Is_Mem_Mapped(total)) {
+            total = MEM_MAP_ROUND(total);  // SER_TOTAL() may round down
+            Unmap_Mem(unbiased, total);
+        }
+        else
+            FREE_N(char, total, unbiased);
         Mem_Pools[SYSTEM_POOL].has -= total;
         Mem_Pools[SYSTEM_POOL].free++;
     }
 }
 
 
+// Grow the data of a page-mapped series to hold `capacity` units by asking
+// the OS to remap its pages, keeping the contents and the bias as they were.
+// Returns false if that is not possible, with the series left untouched (so
+// the caller can fall back on allocating new data and copying).
+//
+// Arrays are not remapped, since the cells opened up would need preparing.
+//
+static bool Did_Series_Data_Remap(REBSER *s, REBLEN capacity)
+{
+    assert(IS_SER_DYNAMIC(s));
+
+    if (IS_SER_ARRAY(s))
+        return false;
+
+    size_t total = SER_TOTAL(s);
+    if (not Is_Mem_Mapped(total))
+        return false;
+
+    REBYTE wide = SER_WIDE(s);
+    if (cast(REBU64, capacity) * wide > INT32_MAX)
+        return false;  // let Did_Series_Data_Alloc() report it "too big"
+
+    REBLEN bias = SER_BIAS(s);
+    size_t size_old = MEM_MAP_ROUND(total);
+    size_t size_new = MEM_MAP_ROUND((cast(size_t, capacity) + bias) * wide);
+    if (size_new <= size_old)
+        return false;
+
+    char *unbiased = s->content.dynamic.data - (wide * bias);
+    char *p = cast(char*, Try_Remap_Mem(unbiased, size_old, size_new));
+    if (not p)
+        return false;
+
+    s->content.dynamic.data = p + (wide * bias);
+    s->content.dynamic.rest = size_new / wide - bias;
+
+    Mem_Pools[SYSTEM_POOL].has += size_new - size_old;
+
+    GC_Bytes_Allocated += size_new - size_old;
+    if ((GC_Ballast -= cast(REBINT, size_new - size_old)) <= 0)
+        SET_SIGNAL(SIG_RECYCLE);
+
+    return true;
+}
+
+
 //
 //  Expand_Series: C
 //
@@ -718,6 +1224,7 @@ void Free_Unbiased_Series_Data(char *unbiased, REBLEN total)
 void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
 {
     ASSERT_SERIES_TERM_IF_NEEDED(s);
+    USDT_PROBE3(series__expand, s, index, delta);
 
     assert(index <= SER_USED(s));
     if (delta & 0x80000000)
@@ -726,6 +1233,11 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     if (delta == 0)
         return;
 
+    if (GET_SERIES_INFO(s, SHARED))
+        Unshare_Series(s);  // copy-on-write, see Copy_Binary_Shared_At_Len()
+
+    GC_Write_Barrier(s);  // expanding is for writing, e.g. Append_Context()
+
     REBLEN used_old = SER_USED(s);
 
     REBYTE wide = SER_WIDE(s);
@@ -766,6 +1278,22 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     REBLEN extra = delta * wide;
     REBLEN size = SER_USED(s) * wide;
 
+    // Taking from the head of a series only adds to its bias, so the space
+    // there may be enough for what's needed at the tail.  Slide the data
+    // back if so, but only if there's at least as much bias as data...so
+    // the memmove is paid for by the takes that made the bias, keeping a
+    // series used as a queue O(1) amortized at both ends.
+    //
+    if (
+        was_dynamic
+        and IS_SER_BIASED(s)
+        and (size + extra + wide) > SER_REST(s) * wide
+        and (size + extra + wide) <= SER_TOTAL(s)
+        and SER_BIAS(s) >= used_old
+    ){
+        Unbias_Series(s, true);
+    }
+
     // + wide for terminator
     if ((size + extra + wide) <= SER_REST(s) * SER_WIDE(s)) {
         //
@@ -826,9 +1354,13 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     }
   #endif
 
-    // Have we recently expanded the same series?
+    // Leave slack for growth in proportion to the size, so a series that
+    // is built up by many appends is only copied O(1) times per unit, no
+    // matter how few units each append adds.  If the same series was
+    // expanded recently, expect more growth and double its size.  (Clients
+    // who know the size a series will grow to can use Reserve_Series().)
 
-    REBLEN x = 1;
+    REBLEN x = (used_old + delta) / 2 + 1;
     REBLEN n_available = 0;
     REBLEN n_found;
     for (n_found = 0; n_found < MAX_EXPAND_LIST; n_found++) {
@@ -867,6 +1399,27 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
         data_old = cast(char*, &content_old);
     }
 
+    // Big page-mapped data can be grown without copying, in which case only
+    // the part after the expansion point has to be slid along.
+    //
+    if (was_dynamic and Did_Series_Data_Remap(s, used_old + delta + x)) {
+        if (n_found >= MAX_EXPAND_LIST)
+            Prior_Expand[n_available] = s;
+
+        memmove(
+            s->content.dynamic.data + start + extra,
+            s->content.dynamic.data + start,
+            size - start
+        );
+        s->content.dynamic.used = used_old + delta;
+
+      #if defined(DEBUG_COLLECT_STATS)
+        PG_Reb_Stats->Series_Expanded++;
+      #endif
+
+        return;
+    }
+
     // The new series will *always* be dynamic, because it would not be
     // expanding if a fixed size allocation was sufficient.
 
@@ -897,6 +1450,10 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     );
     s->content.dynamic.used = used_old + delta;
 
+  #if defined(DEBUG_COLLECT_STATS)
+    PG_Reb_Stats->Series_Expand_Copied += size;
+  #endif
+
     if (was_dynamic) {
         //
         // We have to de-bias the data pointer before we can free it.
@@ -909,7 +1466,7 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     PG_Reb_Stats->Series_Expanded++;
   #endif
 
-    assert(NOT_SERIES_FLAG(s, MARKED));
+    assert(GC_Marking or GC_Sweeping or NOT_SERIES_FLAG(s, MARKED));
 }
 
 
@@ -934,6 +1491,11 @@ void Swap_Series_Content(REBSER* a, REBSER* b)
     assert(IS_SER_ARRAY(a) == IS_SER_ARRAY(b));
     assert(SER_WIDE(a) == SER_WIDE(b));
 
+    if (GET_SERIES_INFO(a, SHARED))  // LINK(Sharer) can't be swapped
+        Unshare_Series(a);
+    if (GET_SERIES_INFO(b, SHARED))
+        Unshare_Series(b);
+
     // There are bits in the ->info and ->header which pertain to the content,
     // which includes whether the series is dynamic or if the data lives in
     // the node itself, the width (right 8 bits), etc.
@@ -956,6 +1518,71 @@ void Swap_Series_Content(REBSER* a, REBSER* b)
 }
 
 
+//
+//  Unlink_Shared_Series: C
+//
+// Take a series out of the ring of series sharing its data.  If that leaves
+// just one series in the ring, then that series owns the data again.  (This
+// does not change the content of the series, see Unshare_Series().)
+//
+// A mapped binary never owns its data, so the last one stays in a ring of
+// its own (see BINARY_FLAG_MAPPED).
+//
+void Unlink_Shared_Series(REBSER *s)
+{
+    assert(GET_SERIES_INFO(s, SHARED));
+
+    REBBIN *prior = BIN(s);
+    while (LINK(Sharer, prior) != s)
+        prior = LINK(Sharer, prior);
+    mutable_LINK(Sharer, prior) = LINK(Sharer, s);
+
+    if (
+        LINK(Sharer, prior) == prior  // last one left
+        and (prior == s or NOT_SUBCLASS_FLAG(BINARY, prior, MAPPED))
+    ){
+        mutable_LINK(Sharer, prior) = nullptr;
+        CLEAR_SERIES_INFO(prior, SHARED);
+    }
+
+    mutable_LINK(Sharer, s) = nullptr;
+    CLEAR_SERIES_INFO(s, SHARED);
+}
+
+
+//
+//  Unshare_Series: C
+//
+// Give a series that was sharing its data with copies an allocation of its
+// own, holding the same bytes.  This is the "copy" in copy-on-write, and is
+// done by FAIL_IF_READ_ONLY_SER() and the routines that resize series.  The
+// other series in the ring keep the original allocation.
+//
+void Unshare_Series(REBSER *s)
+{
+    assert(SER_FLAVOR(s) == FLAVOR_BINARY and IS_SER_DYNAMIC(s));
+
+    union Reb_Series_Content content_old = s->content;
+    REBLEN used = SER_USED(s);
+
+    if (not Did_Series_Data_Alloc(s, used + 1)) {  // + 1 for terminator
+        s->content = content_old;  // still shared, and still consistent
+        fail (Error_No_Memory(used + 1));
+    }
+
+    memcpy(s->content.dynamic.data, content_old.dynamic.data, used + 1);
+    s->content.dynamic.used = used;
+
+    Unlink_Shared_Series(s);
+
+    if (GET_SUBCLASS_FLAG(BINARY, s, MAPPED)) {  // no longer uses the mapping
+        CLEAR_SUBCLASS_FLAG(BINARY, s, MAPPED);
+        CLEAR_SERIES_FLAG(s, MISC_NODE_NEEDS_MARK);
+        mutable_MISC(Mapping, s) = nullptr;
+    }
+}
+
+
 //
 //  swap-contents: native [
 //      {Low-level operation for swapping the underlying data for two series.}
@@ -1009,6 +1636,9 @@ void Remake_Series(REBSER *s, REBLEN units, REBFLGS flags)
 
     assert(NOT_SERIES_FLAG(s, FIXED_SIZE));
 
+    if (GET_SERIES_INFO(s, SHARED))
+        Unshare_Series(s);  // old data is freed below, so it can't be shared
+
     bool was_dynamic = IS_SER_DYNAMIC(s);
 
     REBINT bias_old;
@@ -1033,20 +1663,29 @@ void Remake_Series(REBSER *s, REBLEN units, REBFLGS flags)
 
     s->leader.bits |= flags;
 
+    // Growing big page-mapped data that is being preserved can be done by
+    // remapping it, in which case the content is already where it belongs.
+    //
+    bool remapped = (
+        preserve and was_dynamic and Did_Series_Data_Remap(s, units + 1)
+    );
+
     // !!! Currently the remake won't make a series that fits in the size of
     // a REBSER.  All series code needs a general audit, so that should be one
     // of the things considered.
 
-    SET_SERIES_FLAG(s, DYNAMIC);
-    if (not Did_Series_Data_Alloc(s, units + 1)) {
-        // Put series back how it was (there may be extant references)
-        s->content.dynamic.data = cast(char*, data_old);
+    if (not remapped) {
+        SET_SERIES_FLAG(s, DYNAMIC);
+        if (not Did_Series_Data_Alloc(s, units + 1)) {
+            // Put series back how it was (there may be extant references)
+            s->content.dynamic.data = cast(char*, data_old);
 
-        fail (Error_No_Memory((units + 1) * wide));
+            fail (Error_No_Memory((units + 1) * wide));
+        }
+        assert(IS_SER_DYNAMIC(s));
+        if (IS_SER_ARRAY(s))
+            Prep_Array(ARR(s), 0); // capacity doesn't matter, it will prep
     }
-    assert(IS_SER_DYNAMIC(s));
-    if (IS_SER_ARRAY(s))
-        Prep_Array(ARR(s), 0); // capacity doesn't matter, it will prep
 
     if (preserve) {
         // Preserve as much data as possible (if it was requested, some
@@ -1054,11 +1693,12 @@ void Remake_Series(REBSER *s, REBLEN units, REBFLGS flags)
         // more selectively)
 
         s->content.dynamic.used = MIN(used_old, units);
-        memcpy(
-            s->content.dynamic.data,
-            data_old,
-            s->content.dynamic.used * wide
-        );
+        if (not remapped)
+            memcpy(
+                s->content.dynamic.data,
+                data_old,
+                s->content.dynamic.used * wide
+            );
     } else
         s->content.dynamic.used = 0;
 
@@ -1069,7 +1709,7 @@ void Remake_Series(REBSER *s, REBLEN units, REBFLGS flags)
     }
   #endif
 
-    if (was_dynamic)
+    if (was_dynamic and not remapped)
         Free_Unbiased_Series_Data(data_old - (wide * bias_old), size_old);
 }
 
@@ -1081,15 +1721,29 @@ void Decay_Series(REBSER *s)
 {
     assert(NOT_SERIES_FLAG(s, INACCESSIBLE));
 
+    bool owns_data = true;
+
     switch (SER_FLAVOR(s)) {
       case FLAVOR_STRING:
         Free_Bookmarks_Maybe_Null(STR(s));
+        if (GET_SUBCLASS_FLAG(STRING, s, POOLED))
+            Unpool_String(STR(s));  // see %s-pool.c
         break;
 
       case FLAVOR_SYMBOL:
         GC_Kill_Interning(STR(s));  // special handling can adjust canons
         break;
 
+      case FLAVOR_ARRAY:
+        if (GET_SUBCLASS_FLAG(ARRAY, s, HASH_INDEXED))
+            Free_Array_Hash_Index(ARR(s));  // see "ARRAY HASH INDEX"
+        break;
+
+      case FLAVOR_KEYLIST:
+        if (GET_SUBCLASS_FLAG(KEYLIST, s, INDEXED))
+            Free_Keylist_Index(s);  // see "KEYLIST INDEX" in %c-context.c
+        break;
+
       case FLAVOR_PATCH: {
         //
         // Remove patch from circularly linked list of variants.
@@ -1102,6 +1756,13 @@ void Decay_Series(REBSER *s)
         mutable_MISC(Variant, temp) = MISC(Variant, s);
         break; }
 
+      case FLAVOR_BINARY:
+        if (GET_SERIES_INFO(s, SHARED)) {  // other copies still use the data
+            Unlink_Shared_Series(s);
+            owns_data = false;
+        }
+        break;
+
       case FLAVOR_HANDLE: {
         RELVAL *v = ARR_SINGLE(ARR(s));
         assert(CELL_KIND_UNCHECKED(v) == REB_HANDLE);
@@ -1124,7 +1785,7 @@ void Decay_Series(REBSER *s)
         if (Prior_Expand[n] == s) Prior_Expand[n] = 0;
     }
 
-    if (IS_SER_DYNAMIC(s)) {
+    if (IS_SER_DYNAMIC(s) and owns_data) {
         REBYTE wide = SER_WIDE(s);
         REBLEN bias = SER_BIAS(s);
         REBLEN total = (bias + SER_REST(s)) * wide;
@@ -1180,9 +1841,30 @@ void GC_Kill_Series(REBSER *s)
     //
     TOUCH_SERIES_IF_DEBUG(s);
 
+    if (TG_Alloc_Samples_Live)  // PROFILER/MEMORY may have sampled it
+        Forget_Allocation_Sample(s);
+
     if (NOT_SERIES_FLAG(s, INACCESSIBLE))
         Decay_Series(s);
 
+    // API handles are marked by the root set and never queued, but other
+    // marked series could be pending in an incremental mark phase.  Any
+    // series could be in the remembered set of the generational GC.
+    //
+    if (
+        (s->leader.bits & SERIES_FLAG_GC_REMARK)
+        or (
+            GC_Marking
+            and (s->leader.bits & NODE_FLAG_MARKED)
+            and not (s->leader.bits & NODE_FLAG_ROOT)
+        )
+    ){
+        Unlist_Marked_Series(s);
+    }
+
+    if (s->leader.bits & SERIES_FLAG_GC_YOUNG)  // (sweeps clear it first)
+        Unlist_Young_Series(s);
+
   #if !defined(NDEBUG)
     FREETRASH_POINTER_IF_DEBUG(s->info.node);
     // The spot LINK occupies will be used by Free_Node() to link the freelist
@@ -1276,6 +1958,51 @@ void Assert_Pointer_Detection_Working(void)
 }
 
 
+//
+//  Check_Free_Units_Debug: C
+//
+// Walk a list of free units linked through `next_if_free` (either a pool's
+// free list or the unit cache in front of that pool), making sure each
+// one is marked free and lives in exactly one of the pool's segments.
+//
+REBLEN Check_Free_Units_Debug(REBLEN pool_num, REBPLU *unit)
+{
+    REBLEN count = 0;
+
+    for (; unit != nullptr; unit = unit->next_if_free) {
+        assert(*cast(const REBYTE*, unit) & NODE_BYTEMASK_0x40_FREE);
+
+        ++count;
+
+        bool found = false;
+        REBSEG *seg = Mem_Pools[pool_num].segs;
+        for (; seg != NULL; seg = seg->next) {
+            if (
+                cast(uintptr_t, unit) > cast(uintptr_t, seg)
+                and (
+                    cast(uintptr_t, unit)
+                    < cast(uintptr_t, seg) + cast(uintptr_t, seg->size)
+                )
+            ){
+                if (found) {
+                    printf("unit belongs to more than one segment\n");
+                    panic (unit);
+                }
+
+                found = true;
+            }
+        }
+
+        if (not found) {
+            printf("unit does not belong to one of the pool's segments\n");
+            panic (unit);
+        }
+    }
+
+    return count;
+}
+
+
 //
 //  Check_Memory_Debug: C
 //
@@ -1323,43 +2050,21 @@ REBLEN Check_Memory_Debug(void)
 
     REBLEN pool_num;
     for (pool_num = 0; pool_num != SYSTEM_POOL; pool_num++) {
-        REBLEN pool_free_nodes = 0;
-
-        REBPLU *unit = Mem_Pools[pool_num].first;
-        for (; unit != nullptr; unit = unit->next_if_free) {
-            assert(*cast(const REBYTE*, unit) & NODE_BYTEMASK_0x40_FREE);
-
-            ++pool_free_nodes;
-
-            bool found = false;
-            seg = Mem_Pools[pool_num].segs;
-            for (; seg != NULL; seg = seg->next) {
-                if (
-                    cast(uintptr_t, unit) > cast(uintptr_t, seg)
-                    and (
-                        cast(uintptr_t, unit)
-                        < cast(uintptr_t, seg) + cast(uintptr_t, seg->size)
-                    )
-                ){
-                    if (found) {
-                        printf("unit belongs to more than one segment\n");
-                        panic (unit);
-                    }
-
-                    found = true;
-                }
-            }
-
-            if (not found) {
-                printf("unit does not belong to one of the pool's segments\n");
-                panic (unit);
-            }
-        }
-
+        REBLEN pool_free_nodes = Check_Free_Units_Debug(
+            pool_num,
+            Mem_Pools[pool_num].first
+        );
         if (Mem_Pools[pool_num].free != pool_free_nodes)
             panic ("actual free unit count does not agree with pool header");
 
-        total_free_nodes += pool_free_nodes;
+        REBLEN cached_nodes = Check_Free_Units_Debug(
+            pool_num,
+            TG_Pool_Caches[pool_num].first
+        );
+        if (TG_Pool_Caches[pool_num].count != cached_nodes)
+            panic ("actual cached unit count does not agree with cache");
+
+        total_free_nodes += pool_free_nodes + cached_nodes;
     }
 
     return total_free_nodes;
@@ -1454,7 +2159,7 @@ void Dump_Pools(void)
         for (seg = Mem_Pools[n].segs; seg; seg = seg->next, segs++)
             size += seg->size;
 
-        REBLEN used = Mem_Pools[n].has - Mem_Pools[n].free;
+        REBLEN used = Mem_Pools[n].has - Pool_Units_Free(n);
         printf(
             "Pool[%-2d] %5dB %-5d/%-5d:%-4d (%3d%%) ",
             cast(int, n),
@@ -1466,7 +2171,12 @@ void Dump_Pools(void)
                 Mem_Pools[n].has != 0 ? ((used * 100) / Mem_Pools[n].has) : 0
             )
         );
-        printf("%-2d segs, %-7d total\n", cast(int, segs), cast(int, size));
+        printf(
+            "%-2d segs (%d reclaimed), %-7d total\n",
+            cast(int, segs),
+            cast(int, Mem_Pools[n].reclaimed),
+            cast(int, size)
+        );
 
         tused += used * Mem_Pools[n].wide;
         total += size;
@@ -1553,7 +2263,7 @@ REBU64 Inspect_Series(bool show)
     REBU64 fre_size = 0;
     REBINT pool_num;
     for (pool_num = 0; pool_num != SYSTEM_POOL; pool_num++) {
-        fre_size += Mem_Pools[pool_num].free * Mem_Pools[pool_num].wide;
+        fre_size += Pool_Units_Free(pool_num) * Mem_Pools[pool_num].wide;
     }
 
     if (show) {
@@ -1587,6 +2297,33 @@ REBU64 Inspect_Series(bool show)
         );
         printf("  %lu free headers\n", cast(unsigned long, fre));
         printf("  %lu bytes node-space\n", cast(unsigned long, fre_size));
+
+        // Fragmentation: a pool whose occupancy is low while it holds many
+        // segments is one Reclaim_Pool_Segments() can't help (live units are
+        // scattered across the segments).
+        //
+        printf("Pool Occupancy:\n");
+        for (pool_num = 0; pool_num != SYSTEM_POOL; pool_num++) {
+            REBPOL *pool = &Mem_Pools[pool_num];
+            if (pool->has == 0)
+                continue;
+
+            REBLEN pool_segs = 0;
+            for (seg = pool->segs; seg; seg = seg->next)
+                ++pool_segs;
+
+            REBLEN used = pool->has - Pool_Units_Free(pool_num);
+            printf(
+                "  Pool[%-2d] %5dB %3d%% of %-6d units in %-3d segs"
+                " (%d reclaimed)\n",
+                cast(int, pool_num),
+                cast(int, pool->wide),
+                cast(int, (used * 100) / pool->has),
+                cast(int, pool->has),
+                cast(int, pool_segs),
+                cast(int, pool->reclaimed)
+            );
+        }
         printf("\n");
     }
 
@@ -40,6 +40,37 @@ void Extend_Series(REBSER *s, REBLEN delta)
 }
 
 
+//
+//  Reserve_Series: C
+//
+// Make sure a series has the capacity for `amount` more units beyond its
+// tail, so that many appends up to that size won't reallocate.  Since the
+// size is known, this allocates exactly that (instead of growing with the
+// slack that Expand_Series() leaves for series of unknown ultimate size).
+//
+void Reserve_Series(REBSER *s, REBLEN amount)
+{
+    REBLEN used = SER_USED(s);
+    if (amount & 0x80000000)
+        fail (Error_Index_Out_Of_Range_Raw());  // 2GB max, as expansions
+
+    if (SER_REST(s) > used + amount)  // also needs room for the terminator
+        return;
+
+    if (GET_SERIES_FLAG(s, FIXED_SIZE))
+        fail (Error_Locked_Series_Raw());
+
+    REBLEN len = IS_NONSYMBOL_STRING(s) ? STR_LEN(STR(s)) : 0;
+
+    Remake_Series(s, used + amount, NODE_FLAG_NODE);  // preserve the data
+
+    if (IS_NONSYMBOL_STRING(s))
+        TERM_STR_LEN_SIZE(STR(s), len, used);
+    else
+        TERM_SERIES_IF_NECESSARY(s);
+}
+
+
 //
 //  Copy_Series_Core: C
 //
@@ -134,6 +165,119 @@ REBSER *Copy_Series_At_Len_Extra(
 }
 
 
+// Below this size a COPY of a BINARY! just copies the bytes, as that is about
+// as cheap as making the ring of sharers (and unsharing them later).
+//
+#define SHARE_BINARY_MIN 4096
+
+
+//
+//  Copy_Binary_Shared_At_Len: C
+//
+// COPY of a BINARY! is often made just to be read, or to be changed later
+// in some small way...while copying a big one costs time and memory up
+// front.  So when a big copy runs to the tail of the source, this makes a
+// series that points into the source's data allocation instead of copying
+// it.  Both go in a ring of sharers (see SERIES_INFO_SHARED), and the first
+// of them to be written to makes its own copy at that time.
+//
+// Only COPY uses this: internal clients of Copy_Binary_At_Len() may write
+// into the result without the mutability checks that do the unsharing.
+//
+REBSER *Copy_Binary_Shared_At_Len(REBSER *s, REBLEN index, REBLEN len)
+{
+    if (
+        SER_FLAVOR(s) != FLAVOR_BINARY  // e.g. string aliased AS BINARY!
+        or not IS_SER_DYNAMIC(s)
+        or len < SHARE_BINARY_MIN
+        or index + len != SER_USED(s)  // copy needs terminator at its tail
+        or SER_BIAS(s) + index > 0xffff  // 16-bit bias locates allocation
+        or (
+            (s->leader.bits & (  // LINK() or MISC() used for something else
+                SERIES_FLAG_LINK_NODE_NEEDS_MARK
+                | SERIES_FLAG_MISC_NODE_NEEDS_MARK
+            ))
+            and NOT_SUBCLASS_FLAG(BINARY, s, MAPPED)  // copy shares MISC()
+        )
+    ){
+        return Copy_Binary_At_Len(s, index, len);
+    }
+
+    REBFLGS mapped = 0;
+    if (GET_SUBCLASS_FLAG(BINARY, s, MAPPED))
+        mapped = BINARY_FLAG_MAPPED | SERIES_FLAG_MISC_NODE_NEEDS_MARK;
+
+    REBSER *copy = Make_Series(0, FLAG_FLAVOR(BINARY) | mapped);
+    if (mapped)
+        mutable_MISC(Mapping, copy) = MISC(Mapping, s);
+    assert(not IS_SER_DYNAMIC(copy));
+    SET_SERIES_FLAG(copy, DYNAMIC);
+    copy->content.dynamic.data = s->content.dynamic.data + index;
+    copy->content.dynamic.used = len;
+    copy->content.dynamic.rest = SER_REST(s) - index;
+    copy->content.dynamic.bonus.bias = 0;
+    SER_SET_BIAS(copy, SER_BIAS(s) + index);
+    assert(SER_TOTAL(copy) == SER_TOTAL(s));
+
+    if (GET_SERIES_INFO(s, SHARED))
+        mutable_LINK(Sharer, copy) = LINK(Sharer, s);
+    else {
+        mutable_LINK(Sharer, copy) = BIN(s);
+        SET_SERIES_INFO(s, SHARED);
+    }
+    mutable_LINK(Sharer, s) = BIN(copy);
+    SET_SERIES_INFO(copy, SHARED);
+
+    ASSERT_SERIES_TERM_IF_NEEDED(copy);
+    return copy;
+}
+
+
+//
+//  Make_Binary_Mapped: C
+//
+// Make a BINARY! for `len` bytes of memory owned by `mapping`, a managed
+// HANDLE! whose cleaner frees that memory (see BINARY_FLAG_MAPPED).  This is
+// how an extension can expose e.g. a file it has mapped with mmap() without
+// copying it into series memory.  The byte after the data must be readable
+// and '\0', as a terminator.
+//
+// The binary is frozen, since writes would not be seen by others using the
+// same memory.  COPY of it shares the mapping, as COPY of any big binary
+// shares its data, and a copy gets bytes of its own when it's written to.
+//
+REBBIN *Make_Binary_Mapped(
+    const REBVAL *mapping,
+    const REBYTE *data,
+    REBLEN len
+){
+    assert(IS_HANDLE(mapping) and data[len] == '\0');
+    REBARR *singular = VAL_HANDLE_SINGULAR(mapping);
+    assert(GET_SERIES_FLAG(singular, MANAGED));
+
+    REBSER *s = Make_Series(
+        0,
+        FLAG_FLAVOR(BINARY)
+            | BINARY_FLAG_MAPPED
+            | SERIES_FLAG_MISC_NODE_NEEDS_MARK
+    );
+    mutable_MISC(Mapping, s) = singular;
+
+    assert(not IS_SER_DYNAMIC(s));
+    SET_SERIES_FLAG(s, DYNAMIC);
+    s->content.dynamic.data = m_cast(char*, cast(const char*, data));
+    s->content.dynamic.used = len;
+    s->content.dynamic.rest = len + 1;
+    s->content.dynamic.bonus.bias = 0;
+
+    mutable_LINK(Sharer, s) = BIN(s);  // a ring of one
+    SET_SERIES_INFO(s, SHARED);
+    Freeze_Series(s);
+
+    return BIN(s);
+}
+
+
 //
 //  Remove_Series_Units: C
 //
@@ -145,6 +289,9 @@ void Remove_Series_Units(REBSER *s, REBSIZ offset, REBLEN quantity)
     if (quantity == 0)
         return;
 
+    if (GET_SERIES_INFO(s, SHARED))
+        Unshare_Series(s);  // copy-on-write, see Copy_Binary_Shared_At_Len()
+
     bool is_dynamic = IS_SER_DYNAMIC(s);
     REBLEN used_old = SER_USED(s);
 
@@ -187,14 +334,14 @@ void Remove_Series_Units(REBSER *s, REBSIZ offset, REBLEN quantity)
                 );
             }
             else {
+                // The data isn't slid back to the head of the allocation
+                // here, only if the tail needs the room (see Expand_Series())
+                // That way a series used as a queue--appending at the tail
+                // and taking from the head--doesn't memmove on every take.
+                //
                 SER_SET_BIAS(s, bias);
                 s->content.dynamic.rest -= quantity;
                 s->content.dynamic.data += SER_WIDE(s) * quantity;
-                if ((start = SER_BIAS(s)) != 0) {
-                    // If more than half biased:
-                    if (start >= MAX_SERIES_BIAS or start > SER_REST(s))
-                        Unbias_Series(s, true);
-                }
             }
         }
         TERM_SERIES_IF_NECESSARY(s);  // !!! Review doing more elegantly
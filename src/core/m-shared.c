@@ -0,0 +1,405 @@
+//
+//  File: %m-shared.c
+//  Summary: "frozen series that interpreters on all threads can share"
+//  Section: memory
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// FREEZE/DEEP makes a value that will never change, but its series still
+// belong to the interpreter that made them: they're in its memory pools, and
+// its GC frees them.  SHARE copies a frozen value into a "shared region" of
+// malloc() memory instead, which no interpreter's GC sweeps.  Interpreters
+// on other threads of a USE_THREAD_ISOLATES build can then be given the
+// value (e.g. by SEND-CHANNEL) and read it in place, so a big lookup table
+// doesn't need a copy for each worker.
+//
+// * A shared series is permanently NODE_FLAG_MARKED.  So marking stops at it
+//   with the test Queue_Mark_Node_Deep() already makes for a series that it
+//   has seen, and no GC ever writes to it.
+//
+// * Since no GC looks inside a shared series, it can only hold what doesn't
+//   need one: scalars, and more shared series.  That rules out words (their
+//   symbols belong to an interpreter), contexts, actions, maps and handles.
+//   Text, binaries, and arrays of them are fine.
+//
+// * Nothing else writes to a shared series either.  It's frozen, evaluating
+//   or looping over it takes no HOLD (frozen series don't need one), and
+//   STR_AT() doesn't give it bookmarks.
+//
+// * Regions are reference counted.  Each isolate that gets a value from one
+//   holds a reference until the isolate shuts down.  (It can't let go sooner,
+//   because its GC doesn't look to see if it still has cells pointing into
+//   the region.)  So SHARE is for data made once and read a lot, not for
+//   calling in a loop.
+//
+// Each series is malloc()'d along with its data, after a header pointing
+// back to its region--so a cell can be traced to the region to reference.
+//
+
+#include "sys-core.h"
+
+
+#if defined(USE_THREAD_ISOLATES)
+    #define FETCH_ADD(lvalue,n) \
+        __atomic_fetch_add(&(lvalue), (n), __ATOMIC_ACQ_REL)
+#else
+    #define FETCH_ADD(lvalue,n) \
+        (((lvalue) += (n)) - (n))
+#endif
+
+struct Reb_Shared_Region {
+    intptr_t refcount;  // isolates holding it, plus messages carrying it
+    REBLEN num_blocks;
+    REBLEN capacity;
+    void **blocks;  // malloc()'d, each a Reb_Shared_Header + stub + data
+};
+
+union Reb_Shared_Header {
+    struct Reb_Shared_Region *region;
+    REBI64 align;  // keeps the stub after it 64-bit aligned
+};
+
+static ISOLATE_LOCAL struct Reb_Shared_Region **Held_Regions;
+static ISOLATE_LOCAL REBLEN Num_Held;
+static ISOLATE_LOCAL REBLEN Held_Capacity;
+
+
+inline static struct Reb_Shared_Region *Shared_Region_Of(const REBSER *s) {
+    assert(GET_SERIES_FLAG(s, SHARED_HEAP));
+    return (cast(const union Reb_Shared_Header*, s) - 1)->region;
+}
+
+
+static void Free_Region(struct Reb_Shared_Region *r)
+{
+    REBLEN n;
+    for (n = 0; n < r->num_blocks; ++n)
+        free(r->blocks[n]);
+    free(r->blocks);
+    free(r);
+}
+
+
+// Returns nullptr if out of memory.  The region frees the allocation either
+// way, so the caller just needs to give up.
+//
+static REBSER *Make_Shared_Series(
+    struct Reb_Shared_Region *r,
+    REBFLGS flags,
+    REBLEN capacity
+){
+    if (r->num_blocks == r->capacity) {
+        REBLEN new_capacity = r->capacity == 0 ? 16 : r->capacity * 2;
+        void **blocks = cast(void**,
+            realloc(r->blocks, new_capacity * sizeof(void*))
+        );
+        if (blocks == nullptr)
+            return nullptr;
+        r->blocks = blocks;
+        r->capacity = new_capacity;
+    }
+
+    size_t wide = Wide_For_Flavor(
+        cast(enum Reb_Series_Flavor, FLAVOR_BYTE(flags))
+    );
+    union Reb_Shared_Header *h = cast(union Reb_Shared_Header*, malloc(
+        sizeof(union Reb_Shared_Header) + sizeof(REBSER) + capacity * wide
+    ));
+    if (h == nullptr)
+        return nullptr;
+    r->blocks[r->num_blocks++] = h;
+    h->region = r;
+
+    REBSER *s = cast(REBSER*, h + 1);
+    s->leader.bits = NODE_FLAG_NODE | NODE_FLAG_MANAGED | NODE_FLAG_MARKED
+        | SERIES_FLAG_DYNAMIC | SERIES_FLAG_FIXED_SIZE
+        | SERIES_FLAG_SHARED_HEAP
+        | flags;
+    s->link.any.node = nullptr;  // no file and line, no bookmarks
+    s->misc.any.node = nullptr;
+    s->content.dynamic.data = cast(char*, s + 1);
+    s->content.dynamic.used = 0;
+    s->content.dynamic.rest = capacity;
+    s->content.dynamic.bonus.bias = 0;
+    SER_INFO(s) = SERIES_INFO_MASK_NONE;  // frozen when it's filled in
+
+    TOUCH_SERIES_IF_DEBUG(s);
+    return s;
+}
+
+
+// Returns the first cell reachable from `v` that can't be shared, or nullptr
+// if all of them can.  Arrays being checked are colored black, so an array
+// that contains itself is found (and blames the cell that refers to it).
+//
+static const RELVAL *Find_Unshareable(const RELVAL *v)
+{
+    enum Reb_Kind heart = cast(enum Reb_Kind, HEART_BYTE(v));
+
+    if (GET_CELL_FLAG(v, SECOND_IS_NODE) and VAL_NODE2(v) != nullptr)
+        return v;
+
+    if (NOT_CELL_FLAG(v, FIRST_IS_NODE) or VAL_NODE1(v) == nullptr) {
+        if (Is_Bindable(v) and BINDING(v) != UNBOUND)
+            return v;
+        return nullptr;  // payloads that live in the cell
+    }
+
+    const REBNOD *node = VAL_NODE1(v);
+    if (Is_Node_Cell(node))
+        return v;  // pairings, e.g. a deeply quoted value
+
+    const REBSER *s = SER(node);
+    if (ANY_STRING_KIND(heart))
+        return IS_NONSYMBOL_STRING(s) ? nullptr : v;
+    if (heart == REB_BINARY)
+        return SER_FLAVOR(s) == FLAVOR_BINARY ? nullptr : v;
+    if (not ANY_ARRAY_KIND(heart) or SER_FLAVOR(s) != FLAVOR_ARRAY)
+        return v;  // words, contexts, actions, maps, handles...
+
+    if (Is_Series_Black(s))
+        return v;  // array contains itself
+    Flip_Series_To_Black(s);
+
+    const RELVAL *found = nullptr;
+    const RELVAL *tail = ARR_TAIL(ARR(s));
+    const RELVAL *item = ARR_HEAD(ARR(s));
+    for (; item != tail; ++item) {
+        found = Find_Unshareable(item);
+        if (found)
+            break;
+    }
+
+    Flip_Series_To_White(s);
+    return found;
+}
+
+
+// Copy `v` into the prepped cell `out`, with its series copied into `r`.
+// Returns false if out of memory.  (Find_Unshareable() has already been
+// run, so there's nothing else that can go wrong.)
+//
+static bool Share_Cell(
+    struct Reb_Shared_Region *r,
+    RELVAL *out,
+    const RELVAL *v
+){
+    Copy_Cell_Core(out, v, CELL_MASK_COPY);
+
+    if (NOT_CELL_FLAG(v, FIRST_IS_NODE) or VAL_NODE1(v) == nullptr)
+        return true;
+
+    const REBSER *s = SER(VAL_NODE1(v));
+    REBSER *copy;
+
+    if (IS_SER_ARRAY(s)) {
+        REBLEN len = ARR_LEN(ARR(s));
+        copy = Make_Shared_Series(
+            r,
+            FLAG_FLAVOR(ARRAY) | (s->leader.bits & ARRAY_FLAG_NEWLINE_AT_TAIL),
+            len + 1  // room for a terminator, in case of DEBUG_TERM_ARRAYS
+        );
+        if (copy == nullptr)
+            return false;
+
+        const RELVAL *item = ARR_HEAD(ARR(s));
+        RELVAL *dest = cast(RELVAL*, SER_DATA(copy));
+        REBLEN n;
+        for (n = 0; n < len; ++n, ++item, ++dest) {
+            Prep_Cell(dest);
+            if (not Share_Cell(r, dest, item))
+                return false;  // caller frees the region
+        }
+        Prep_Cell(dest);
+        SET_SERIES_LEN(copy, len);
+
+        mutable_BINDING(out) = UNBOUND;  // no words, so nothing to bind
+    }
+    else {
+        REBSIZ size = SER_USED(s);
+        copy = Make_Shared_Series(
+            r,
+            FLAG_FLAVOR_BYTE(SER_FLAVOR(s)),
+            size + 1  // room for the '\0' terminator
+        );
+        if (copy == nullptr)
+            return false;
+
+        memcpy(SER_DATA(copy), SER_DATA(s), size);
+        if (IS_NONSYMBOL_STRING(s))
+            TERM_STR_LEN_SIZE(STR(copy), STR_LEN(STR(s)), size);
+        else
+            TERM_BIN_LEN(BIN(copy), size);
+    }
+
+    SER_INFO(copy) = SERIES_INFO_FROZEN_DEEP;
+    INIT_VAL_NODE1(out, copy);
+    return true;
+}
+
+
+static void Hold_Region(struct Reb_Shared_Region *r)
+{
+    if (Num_Held == Held_Capacity) {
+        REBLEN new_capacity = Held_Capacity == 0 ? 8 : Held_Capacity * 2;
+        struct Reb_Shared_Region **held = cast(struct Reb_Shared_Region**,
+            realloc(Held_Regions, new_capacity * sizeof(*held))
+        );
+        if (held == nullptr) {
+            Release_Shared_Region(r);
+            fail (Error_No_Memory(new_capacity * sizeof(*held)));
+        }
+        Held_Regions = held;
+        Held_Capacity = new_capacity;
+    }
+    Held_Regions[Num_Held++] = r;
+}
+
+
+//
+//  Is_Value_Shared: C
+//
+// Is the value's series in a shared region?  (See SHARE)
+//
+bool Is_Value_Shared(const RELVAL *v)
+{
+    if (NOT_CELL_FLAG(v, FIRST_IS_NODE) or VAL_NODE1(v) == nullptr)
+        return false;
+
+    const REBNOD *node = VAL_NODE1(v);
+    if (Is_Node_Cell(node))
+        return false;
+
+    const REBSER *s = SER(node);
+    enum Reb_Series_Flavor flavor = SER_FLAVOR(s);
+    if (
+        flavor != FLAVOR_ARRAY
+        and flavor != FLAVOR_STRING
+        and flavor != FLAVOR_BINARY
+    ){
+        return false;  // SERIES_FLAG_SHARED_HEAP means other things to these
+    }
+    return GET_SERIES_FLAG(s, SHARED_HEAP);
+}
+
+
+//
+//  Share_Value: C
+//
+// Copy a deeply frozen value's series into a new shared region, which this
+// isolate holds.  Values with no series, or that are shared already, come
+// back as they are.
+//
+REBVAL *Share_Value(REBVAL *out, const REBVAL *v)
+{
+    if (Is_Value_Shared(v))
+        return Copy_Cell(out, v);
+
+    if (not Is_Value_Frozen_Deep(v))
+        fail ("SHARE needs a value frozen deeply, e.g. by FREEZE/DEEP");
+
+    const RELVAL *bad = Find_Unshareable(v);
+    if (bad)
+        fail (Error_Bad_Value_Core(bad, SPECIFIED));
+
+    if (NOT_CELL_FLAG(v, FIRST_IS_NODE) or VAL_NODE1(v) == nullptr)
+        return Copy_Cell(out, v);
+
+    struct Reb_Shared_Region *r = cast(struct Reb_Shared_Region*,
+        malloc(sizeof(struct Reb_Shared_Region))
+    );
+    if (r == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Shared_Region)));
+    r->refcount = 1;
+    r->num_blocks = 0;
+    r->capacity = 0;
+    r->blocks = nullptr;
+
+    DECLARE_LOCAL (temp);
+    if (not Share_Cell(r, temp, v)) {
+        Free_Region(r);
+        fail (Error_No_Memory(0));
+    }
+
+    Hold_Region(r);
+    return Copy_Cell(out, temp);
+}
+
+
+//
+//  Acquire_Shared_Region: C
+//
+// Take a reference on the region a shared value is in, e.g. for a message
+// that carries the value to another isolate.  See Adopt_Shared_Region().
+//
+struct Reb_Shared_Region *Acquire_Shared_Region(const RELVAL *v)
+{
+    assert(Is_Value_Shared(v));
+    struct Reb_Shared_Region *r = Shared_Region_Of(SER(VAL_NODE1(v)));
+    FETCH_ADD(r->refcount, 1);
+    return r;
+}
+
+
+//
+//  Adopt_Shared_Region: C
+//
+// Make a reference from Acquire_Shared_Region() this isolate's to hold, so
+// the region stays alive for as long as this isolate does.
+//
+void Adopt_Shared_Region(struct Reb_Shared_Region *r)
+{
+    REBLEN n;
+    for (n = 0; n < Num_Held; ++n) {
+        if (Held_Regions[n] == r) {
+            Release_Shared_Region(r);  // already holding one
+            return;
+        }
+    }
+    Hold_Region(r);
+}
+
+
+//
+//  Release_Shared_Region: C
+//
+// Whichever isolate lets go of the last reference frees the region.
+//
+void Release_Shared_Region(struct Reb_Shared_Region *r)
+{
+    if (FETCH_ADD(r->refcount, -1) == 1)
+        Free_Region(r);
+}
+
+
+//
+//  Shutdown_Shared: C
+//
+// Let go of the regions this isolate holds.  There are no cells left to
+// point into them after the GC's shutdown.
+//
+void Shutdown_Shared(void)
+{
+    REBLEN n;
+    for (n = 0; n < Num_Held; ++n)
+        Release_Shared_Region(Held_Regions[n]);
+    free(Held_Regions);
+    Held_Regions = nullptr;
+    Num_Held = 0;
+    Held_Capacity = 0;
+}
@@ -264,10 +264,25 @@ void Expand_Data_Stack_May_Fail(REBLEN amount)
         == cast(int, len_old)
     );
 
+    // Grow by at least the size the stack already is.  DS_PUSH() asks for a
+    // small fixed amount, and growing by that much each time a deep REDUCE
+    // or COLLECT kept pushing would copy the whole stack again and again.
+    // Doubling makes the copying O(1) amortized per push.  (Big stacks are
+    // page-mapped if R3_HUGE_PAGES is set, and grown with no copy at all;
+    // see Did_Series_Data_Remap().)
+    //
+    REBLEN rest = SER_REST(DS_Array);
+    if (amount < len_old) {
+        if (rest + len_old < STACK_LIMIT)
+            amount = len_old;
+        else if (rest + amount < STACK_LIMIT)
+            amount = STACK_LIMIT - rest - 1;  // as much as the limit allows
+    }
+
     // If adding in the requested amount would overflow the stack limit, then
     // give a data stack overflow error.
     //
-    if (SER_REST(DS_Array) + amount >= STACK_LIMIT) {
+    if (rest + amount >= STACK_LIMIT) {
         //
         // Because the stack pointer was incremented and hit the END marker
         // before the expansion, we have to decrement it if failing.
@@ -250,6 +250,13 @@ inline static bool Single_Test_Throws(
         DECLARE_LOCAL (arg_specified);
         Derelativize(arg_specified, arg, arg_specifier);
         Dequotify(arg_specified);  // e.g. '':refinement? wants unquoted
+
+        if (Did_Typecheck_Without_Frame(
+            &matched, SPECIFIC(test), arg_specified
+        )){
+            goto return_matched;
+        }
+
         PUSH_GC_GUARD(arg_specified);
 
         DECLARE_LOCAL (temp);  // test is in `out`
@@ -647,18 +654,22 @@ REBNATIVE(all)
             }
         }
         else {
-            DECLARE_LOCAL (temp);  // D_SPARE and D_OUT both in use
-            if (RunQ_Throws(
-                temp,
-                true,
-                rebINLINE(predicate),
-                NULLIFY_NULLED(D_SPARE),
-                rebEND
-            )){
-                return R_THROWN;
+            bool passed;
+            if (not Did_Typecheck_Without_Frame(&passed, predicate, D_SPARE)) {
+                DECLARE_LOCAL (temp);  // D_SPARE and D_OUT both in use
+                if (RunQ_Throws(
+                    temp,
+                    true,
+                    rebINLINE(predicate),
+                    NULLIFY_NULLED(D_SPARE),
+                    rebEND
+                )){
+                    return R_THROWN;
+                }
+                passed = IS_TRUTHY(temp);
             }
 
-            if (IS_FALSEY(temp)) {
+            if (not passed) {
                 Abort_Frame(f);
                 return nullptr;
             }
@@ -731,17 +742,21 @@ REBNATIVE(any)
             }
         }
         else {
-            if (RunQ_Throws(
-                D_SPARE,
-                true,
-                rebINLINE(predicate),
-                NULLIFY_NULLED(D_OUT),
-                rebEND
-            )){
-                return R_THROWN;
+            bool passed;
+            if (not Did_Typecheck_Without_Frame(&passed, predicate, D_OUT)) {
+                if (RunQ_Throws(
+                    D_SPARE,
+                    true,
+                    rebINLINE(predicate),
+                    NULLIFY_NULLED(D_OUT),
+                    rebEND
+                )){
+                    return R_THROWN;
+                }
+                passed = IS_TRUTHY(D_SPARE);
             }
 
-            if (IS_TRUTHY(D_SPARE)) {
+            if (passed) {
                 //
                 // Don't let ANY return something falsey, but using an isotope
                 // makes `any .not [null] then [<run>]` work
@@ -815,7 +830,7 @@ REBNATIVE(case)
         if (IS_NULLED(predicate)) {
             matched = IS_TRUTHY(D_OUT);
         }
-        else {
+        else if (not Did_Typecheck_Without_Frame(&matched, predicate, D_OUT)) {
             DECLARE_LOCAL (temp);
             if (RunQ_Throws(
                 temp,
@@ -1178,7 +1193,10 @@ REBNATIVE(default)
                 return D_OUT;  // count it as "already set"
         }
         else {
-            if (rebDid(rebINLINE(predicate), rebQ(D_OUT)))
+            bool passed;
+            if (not Did_Typecheck_Without_Frame(&passed, predicate, D_OUT))
+                passed = rebDid(rebINLINE(predicate), rebQ(D_OUT));
+            if (passed)
                 return D_OUT;
         }
     }
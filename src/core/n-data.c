@@ -963,6 +963,33 @@ REBNATIVE(free)
 }
 
 
+//
+//  reserve: native [
+//
+//  {Make room to append to a series without it having to be reallocated}
+//
+//      return: [any-series!]
+//      series [any-series!]
+//      amount "Number of items (bytes for strings) to hold beyond the tail"
+//          [integer!]
+//  ]
+//
+REBNATIVE(reserve)
+{
+    INCLUDE_PARAMS_OF_RESERVE;
+
+    REBVAL *v = ARG(series);
+
+    REBINT amount = VAL_INT32(ARG(amount));
+    if (amount < 0)
+        fail (PAR(amount));
+
+    Reserve_Series(VAL_SERIES_ENSURE_MUTABLE(v), amount);
+
+    RETURN (v);
+}
+
+
 //
 //  free?: native [
 //
@@ -1052,30 +1079,30 @@ bool Try_As_String(
                 if (GET_CELL_FLAG(v, CONST))
                     fail (Error_Alias_Constrains_Raw());
 
-            bool all_ascii = true;
-            REBLEN num_codepoints = 0;
+            const REBYTE *head = BIN_HEAD(bin);
+            const REBYTE *tail = head + BIN_LEN(bin);
 
-            index = 0;
+            REBLEN num_codepoints;
+            const REBYTE *bad = Seek_Invalid_Utf8(&num_codepoints, head, tail);
 
-            REBSIZ bytes_left = BIN_LEN(bin);
-            const REBYTE *bp = BIN_HEAD(bin);
-            for (; bytes_left > 0; --bytes_left, ++bp) {
-                if (bp < at_ptr)
-                    ++index;
+            const REBYTE *special = head;  // errors come in order of position
+            while ((special = Seek_Nul_Or_Cr(special, bad)) != bad) {
+                Validate_Ascii_Byte(special, strmode, head);
+                ++special;
+            }
 
-                REBUNI c = *bp;
-                if (c < 0x80)
-                    Validate_Ascii_Byte(bp, strmode, BIN_HEAD(bin));
-                else {
-                    bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
-                    if (bp == NULL)  // !!! Should Back_Scan() fail?
-                        fail (Error_Bad_Utf8_Raw());
+            if (bad != tail)
+                fail (Error_Bad_Utf8_Raw());
 
-                    all_ascii = false;
-                }
+            index = 0;  // codepoints that start before the position
+            const REBYTE *bp = head;
+            for (; bp < at_ptr; ++bp)
+                if (not Is_Continuation_Byte_If_Utf8(*bp))
+                    ++index;
+
+            if (GET_SERIES_INFO(bin, SHARED))  // LINK() becomes bookmarks
+                Unshare_Series(m_cast(REBBIN*, bin));
 
-                ++num_codepoints;
-            }
             mutable_SER_FLAVOR(bin) = FLAVOR_STRING;
             str = STR(bin);
 
@@ -1087,8 +1114,6 @@ bool Try_As_String(
             mutable_LINK(Bookmarks, m_cast(REBBIN*, bin)) = nullptr;
 
             // !!! TBD: cache index/offset
-
-            UNUSED(all_ascii);  // TBD: maintain cache
         }
         else {
             // !!! It's a string series, but or mapping acceleration is
@@ -1427,6 +1452,9 @@ REBNATIVE(as)
                 // Constrain the input in the way it would be if we were doing
                 // the more efficient reuse.
                 //
+                if (GET_SERIES_INFO(bin, SHARED))  // LINK() is for strings
+                    Unshare_Series(m_cast(REBBIN*, bin));
+
                 mutable_SER_FLAVOR(bin) = FLAVOR_STRING;
                 Freeze_Series(bin);
             }
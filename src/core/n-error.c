@@ -79,6 +79,42 @@ REBNATIVE(trap)
 }
 
 
+//
+//  attempt: native [
+//
+//  {Tries to evaluate a block and returns result or NULL on error.}
+//
+//      return: "NULL on error"
+//          [<opt> any-value!]
+//      code [block! action!]
+//  ]
+//
+REBNATIVE(attempt)
+//
+// Since the error is thrown away, this uses its own PUSH_TRAP instead of
+// rebRescue(), so it can tell fail() not to fill in the WHERE and NEAR.
+{
+    INCLUDE_PARAMS_OF_ATTEMPT;
+
+    struct Reb_State jump;
+    PUSH_TRAP_SO_FAIL_CAN_JUMP_BACK_HERE(&jump);
+
+    if (jump.error)  // the code failed, and the trap has been dropped
+        return nullptr;
+
+    jump.discards_error = true;
+
+    bool threw = Do_Branch_Throws(D_OUT, ARG(code));  // NULL => ~null~
+
+    DROP_TRAP_SAME_STACKLEVEL_AS_PUSH(&jump);
+
+    if (threw)
+        return R_THROWN;
+
+    return D_OUT;
+}
+
+
 static REBVAL *Entrap_Dangerous(REBFRM *frame_) {
     INCLUDE_PARAMS_OF_ENTRAP;
 
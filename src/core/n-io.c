@@ -61,8 +61,8 @@ REBNATIVE(form)
 //
 //  "Converts a value to a REBOL-readable string."
 //
-//      return: "NULL if input is NULL"
-//          [<opt> text!]
+//      return: "NULL if input is NULL, the sink if /SINK"
+//          [<opt> text! port! action!]
 //      truncated: "<output> Whether the mold was truncated"
 //          [logic!]
 //
@@ -73,6 +73,8 @@ REBNATIVE(form)
 //      /flat "No indentation"
 //      /limit "Limit to a certain length"
 //          [integer!]
+//      /sink "WRITE output to a port (or pass to an action) in BINARY! pieces"
+//          [port! action!]
 //  ]
 //
 REBNATIVE(mold)
@@ -93,6 +95,11 @@ REBNATIVE(mold)
         SET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT);
         mo->limit = Int32(ARG(limit));
     }
+    if (REF(sink)) {
+        if (REF(limit))
+            fail (Error_Bad_Refines_Raw());  // truncation happens at the end
+        mo->sink = ARG(sink);
+    }
 
     Push_Mold(mo);
 
@@ -101,6 +108,19 @@ REBNATIVE(mold)
 
     Mold_Value(mo, v);
 
+    if (REF(sink)) {  // Flush_Mold() leaves whatever is under its threshold
+        REBVAL *rest = Init_Binary(Alloc_Value(), Pop_Molded_Binary(mo));
+        if (IS_ACTION(ARG(sink)))
+            rebElide(rebQ(ARG(sink)), rebR(rest));
+        else
+            rebElide("write", ARG(sink), rebR(rest));
+
+        if (REF(truncated))
+            rebElide(NATIVE_VAL(set), rebQ(REF(truncated)), rebL(false));
+
+        RETURN (ARG(sink));
+    }
+
     REBSTR *popped = Pop_Molded_String(mo);  // sets MOLD_FLAG_TRUNCATED
 
     if (REF(truncated))
@@ -383,6 +383,113 @@ struct Loop_Each_State {
     REBLEN data_len;  // length of the data
 };
 
+// Run the body once the variables are set, and fold its result into the
+// output according to the mode.  Sets `broke` (and nulls the output) on a
+// BREAK, and returns true only for a throw that isn't BREAK or CONTINUE.
+//
+static bool Loop_Each_Body_Throws(
+    struct Loop_Each_State *les,
+    bool *broke,
+    bool *no_falseys
+){
+    if (Do_Branch_Throws(les->out, les->body)) {
+        if (not Catching_Break_Or_Continue(les->out, broke))
+            return true;  // non-loop-related throw
+
+        if (*broke) {
+            Init_Nulled(les->out);
+            return false;
+        }
+    }
+
+    switch (les->mode) {
+      case LOOP_FOR_EACH:
+        break;
+
+      case LOOP_EVERY:
+        *no_falseys = *no_falseys and IS_TRUTHY(les->out);
+        break;
+
+      case LOOP_MAP_EACH:
+      case LOOP_MAP_EACH_SPLICED:
+        if (IS_NULLED(les->out) or Is_Isotope(les->out, SYM_NULL))
+            Init_Isotope(les->out, SYM_NULL);  // null signals break
+        else if (
+            IS_BAD_WORD(les->out)
+            and GET_CELL_FLAG(les->out, ISOTOPE)
+        ){
+            fail (les->out);
+        }
+        else if (
+            les->mode == LOOP_MAP_EACH_SPLICED
+            and IS_BLOCK(les->out)
+        ){
+            const RELVAL *tail;
+            const RELVAL *v = VAL_ARRAY_AT(&tail, les->out);
+            for (; v != tail; ++v)
+                Derelativize(DS_PUSH(), v, VAL_SPECIFIER(les->out));
+        }
+        else {
+            Copy_Cell(DS_PUSH(), les->out);  // non nulls added to result
+        }
+        break;
+    }
+
+    return false;
+}
+
+
+// The overwhelmingly common case is one variable over a BLOCK! or a string,
+// e.g. `for-each item block [...]`.  Loop_Each_Core() handles that through
+// its general machinery, asking which type the data is and finding the real
+// variable for each step, and strings go through STR_AT() on each index.
+//
+// Here the variable is found once.  That's legal since it's not a reused
+// word (`for-each 'x ...`), so it lives in the context of fabricated vars,
+// which is locked at fixed size.  Strings are walked by pointer, as the
+// HOLD on the series means its data can't move or change while looping.
+//
+static REB_R Loop_Each_Single_Core(struct Loop_Each_State *les) {
+    bool broke = false;
+    bool no_falseys = true;
+
+    REBVAL *var = Real_Var_From_Pseudo(CTX_VAR(les->pseudo_vars_ctx, 1));
+
+    if (ANY_ARRAY(les->data)) {
+        const REBARR *a = ARR(les->data_ser);
+        for (; les->data_idx != les->data_len; ++les->data_idx) {
+            if (var)
+                Derelativize(var, ARR_AT(a, les->data_idx), les->specifier);
+
+            if (Loop_Each_Body_Throws(les, &broke, &no_falseys))
+                return R_THROWN;
+            if (broke)
+                return nullptr;
+        }
+    }
+    else {
+        assert(ANY_STRING(les->data));
+        REBCHR(const*) cp = STR_AT(STR(les->data_ser), les->data_idx);
+        for (; les->data_idx != les->data_len; ++les->data_idx) {
+            REBUNI c;
+            cp = NEXT_CHR(&c, cp);
+            if (var)
+                Init_Char_Unchecked(var, c);
+
+            if (Loop_Each_Body_Throws(les, &broke, &no_falseys))
+                return R_THROWN;
+            if (broke)
+                return nullptr;
+        }
+    }
+
+    if (les->mode == LOOP_EVERY and not no_falseys)
+        Init_Logic(les->out, false);
+
+    return nullptr;  // result is in les->out, see Loop_Each_Core()
+}
+
+
 // Isolation of central logic for FOR-EACH, MAP-EACH, and EVERY so that it
 // can be rebRescue()'d in case of failure (to remove SERIES_INFO_HOLD, etc.)
 //
@@ -569,49 +676,11 @@ static REB_R Loop_Each_Core(struct Loop_Each_State *les) {
             }
         }
 
-        if (Do_Branch_Throws(les->out, les->body)) {
-            if (not Catching_Break_Or_Continue(les->out, &broke))
-                return R_THROWN;  // non-loop-related throw
-
-            if (broke) {
-                Init_Nulled(les->out);
-                return nullptr;
-            }
-        }
-
-        switch (les->mode) {
-          case LOOP_FOR_EACH:
-            break;
-
-          case LOOP_EVERY:
-            no_falseys = no_falseys and IS_TRUTHY(les->out);
-            break;
-
-          case LOOP_MAP_EACH:
-          case LOOP_MAP_EACH_SPLICED:
-            if (IS_NULLED(les->out) or Is_Isotope(les->out, SYM_NULL))
-                Init_Isotope(les->out, SYM_NULL);  // null signals break
-            else if (
-                IS_BAD_WORD(les->out)
-                and GET_CELL_FLAG(les->out, ISOTOPE)
-            ){
-                fail (les->out);
-            }
-            else if (
-                les->mode == LOOP_MAP_EACH_SPLICED
-                and IS_BLOCK(les->out)
-            ){
-                const RELVAL *tail;
-                const RELVAL *v = VAL_ARRAY_AT(&tail, les->out);
-                for (; v != tail; ++v)
-                    Derelativize(DS_PUSH(), v, VAL_SPECIFIER(les->out));
-            }
-            else {
-                Copy_Cell(DS_PUSH(), les->out);  // non nulls added to result
-            }
-            break;
-        }
-    } while (more_data and not broke);
+        if (Loop_Each_Body_Throws(les, &broke, &no_falseys))
+            return R_THROWN;  // non-loop-related throw
+        if (broke)
+            return nullptr;
+    } while (more_data);
 
   finished:;
 
@@ -709,7 +778,8 @@ static REB_R Loop_Each(REBFRM *frame_, LOOP_MODE mode)
 
         // HOLD so length can't change
 
-        took_hold = NOT_SERIES_INFO(les.data_ser, HOLD);
+        took_hold = NOT_SERIES_INFO(les.data_ser, HOLD)
+            and NOT_SERIES_INFO(les.data_ser, FROZEN_DEEP);  // can't change
         if (took_hold)
             SET_SERIES_INFO(m_cast(REBSER*, les.data_ser), HOLD);
 
@@ -723,7 +793,18 @@ static REB_R Loop_Each(REBFRM *frame_, LOOP_MODE mode)
     // If there is a fail() and we took a SERIES_INFO_HOLD, that hold needs
     // to be released.  For this reason, the code has to trap errors.
 
-    r = rebRescue(cast(REBDNG*, &Loop_Each_Core), &les);
+    if (
+        CTX_LEN(les.pseudo_vars_ctx) == 1
+        and (IS_BLOCK(les.data) or IS_GROUP(les.data) or ANY_STRING(les.data))
+        and (
+            NOT_CELL_FLAG(CTX_VAR(les.pseudo_vars_ctx, 1), BIND_NOTE_REUSE)
+            or IS_BLANK(CTX_VAR(les.pseudo_vars_ctx, 1))  // var is nullptr
+        )
+    ){
+        r = rebRescue(cast(REBDNG*, &Loop_Each_Single_Core), &les);
+    }
+    else
+        r = rebRescue(cast(REBDNG*, &Loop_Each_Core), &les);
 
     //=//// CLEANUPS THAT NEED TO BE DONE DESPITE ERROR, THROW, ETC. //////=//
 
@@ -1525,6 +1606,13 @@ REBNATIVE(remove_each)
 //  ]
 //
 REBNATIVE(map_each)
+//
+// !!! A /PARALLEL option to split the data across threads has been asked
+// for.  But bodies are run by the evaluator, which keeps per-interpreter
+// state (the data stack, frame stack, GC and node pools) in plain globals
+// with no locking.  Until there's a way to run isolated interpreters on
+// worker threads, only native work with no evaluation--like the native
+// comparisons of SORT/THREADS--can be spread over cores.
 {
     INCLUDE_PARAMS_OF_MAP_EACH;
     UNUSED(PAR(vars));
@@ -1705,7 +1793,10 @@ REBNATIVE(until)
                 return D_OUT;  // body evaluated truthily, return value
         }
         else {
-            if (rebDid(rebINLINE(predicate), rebQ(D_OUT)))
+            bool passed;
+            if (not Did_Typecheck_Without_Frame(&passed, predicate, D_OUT))
+                passed = rebDid(rebINLINE(predicate), rebQ(D_OUT));
+            if (passed)
                 return D_OUT;
         }
 
@@ -568,3 +568,40 @@ REBNATIVE(freeze)
 
     RETURN (ARG(value));
 }
+
+
+//
+//  share: native [
+//
+//  {Copy a frozen value into memory that interpreters on all threads can read}
+//
+//      return: [any-value!]
+//      value "Must be frozen deeply, with no words, contexts, or actions"
+//          [any-value!]
+//  ]
+//
+REBNATIVE(share)
+//
+// See %m-shared.c
+{
+    INCLUDE_PARAMS_OF_SHARE;
+
+    return Share_Value(D_OUT, ARG(value));
+}
+
+
+//
+//  shared?: native [
+//
+//  {Determine if a value's series was made by SHARE}
+//
+//      return: [logic!]
+//      value [any-value!]
+//  ]
+//
+REBNATIVE(shared_q)
+{
+    INCLUDE_PARAMS_OF_SHARED_Q;
+
+    return Init_Logic(D_OUT, Is_Value_Shared(ARG(value)));
+}
@@ -62,7 +62,17 @@ REBNATIVE(reduce)
         return D_OUT;  // let caller worry about whether to error on nulls
     }
 
-    REBDSP dsp_orig = DSP;
+    // Each step consumes at least one item of the input, so the input's
+    // length bounds the number of results.  Allocating that up front and
+    // writing in place saves pushing everything to the data stack only to
+    // copy it all off again at the end.  The array stays unmanaged while it
+    // fills, so the GC treats it as a root and a fail() will free it.
+    //
+    REBFLGS flags = ARRAY_MASK_HAS_FILE_LINE;
+    if (GET_SUBCLASS_FLAG(ARRAY, VAL_ARRAY(v), NEWLINE_AT_TAIL))
+        flags |= ARRAY_FLAG_NEWLINE_AT_TAIL;
+
+    REBARR *a = Make_Array_Core(VAL_LEN_AT(v), flags);
 
     DECLARE_FEED_AT (feed, v);
     DECLARE_FRAME (f, feed, EVAL_MASK_DEFAULT | EVAL_FLAG_ALLOCATED_FEED);
@@ -75,8 +85,8 @@ REBNATIVE(reduce)
             : GET_CELL_FLAG(f_value, NEWLINE_BEFORE);
 
         if (Eval_Step_Throws(D_OUT, f)) {
-            DS_DROP_TO(dsp_orig);
             Abort_Frame(f);
+            Free_Unmanaged_Series(a);
             return R_THROWN;
         }
 
@@ -108,25 +118,17 @@ REBNATIVE(reduce)
         // https://forum.rebol.info/t/what-should-do-do/1426
         //
         if (not IS_NULLED(D_OUT)) {
-            Copy_Cell(DS_PUSH(), D_OUT);
-            if (IS_BAD_WORD(DS_TOP))
-                CLEAR_CELL_FLAG(DS_TOP, ISOTOPE);  // must be block-safe
+            RELVAL *dest = Copy_Cell(Alloc_Tail_Array(a), D_OUT);
+            if (IS_BAD_WORD(dest))
+                CLEAR_CELL_FLAG(dest, ISOTOPE);  // must be block-safe
             if (line)
-                SET_CELL_FLAG(DS_TOP, NEWLINE_BEFORE);
+                SET_CELL_FLAG(dest, NEWLINE_BEFORE);
         }
     } while (NOT_END(f_value));
 
-    Drop_Frame_Unbalanced(f);  // Drop_Frame() asserts on accumulation
-
-    REBFLGS pop_flags = NODE_FLAG_MANAGED | ARRAY_MASK_HAS_FILE_LINE;
-    if (GET_SUBCLASS_FLAG(ARRAY, VAL_ARRAY(v), NEWLINE_AT_TAIL))
-        pop_flags |= ARRAY_FLAG_NEWLINE_AT_TAIL;
+    Drop_Frame(f);
 
-    return Init_Any_Array(
-        D_OUT,
-        VAL_TYPE(v),
-        Pop_Stack_Values_Core(dsp_orig, pop_flags)
-    );
+    return Init_Any_Array(D_OUT, VAL_TYPE(v), a);
 }
 
 
@@ -147,6 +149,41 @@ bool Match_For_Compose(const RELVAL *group, const REBVAL *label) {
 }
 
 
+// Quick check, with no evaluation and nothing pushed, of whether a nested
+// array has a GROUP! anywhere in it that COMPOSE/DEEP might substitute.  If
+// not, the array goes in the result as-is, without walking it with a frame
+// and pushing all its items only to drop them again.  Big templates are
+// mostly literal, so this keeps recomposing them from being dominated by
+// the parts that never change.  Sequences (which may be compressed) and
+// anything else unclear get a "yes", leaving them to the full walk.
+//
+static bool Might_Compose_Deep(const RELVAL *array, const REBVAL *label)
+{
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, array);
+    for (; item != tail; ++item) {
+        REBCEL(const*) cell = VAL_UNESCAPED(item);
+        enum Reb_Kind heart = CELL_HEART(cell);
+        if (not ANY_ARRAY_KIND(heart))
+            continue;
+
+        if (ANY_SEQUENCE_KIND(CELL_KIND(cell)))
+            return true;
+
+        if (ANY_GROUP_KIND(heart)) {
+            if (IS_NULLED(label) or Match_For_Compose(item, label))
+                return true;
+            if (Is_Any_Doubled_Group(item))  // inner group might match
+                return true;
+        }
+
+        if (Might_Compose_Deep(cast(const RELVAL*, cell), label))
+            return true;
+    }
+    return false;
+}
+
+
 //
 //  Compose_To_Stack_Core: C
 //
@@ -363,6 +400,14 @@ REB_R Compose_To_Stack_Core(
         else if (deep) {
             // compose/deep [does [(1 + 2)] nested] => [does [3] nested]
 
+            if (
+                not ANY_SEQUENCE_KIND(CELL_KIND(cell))
+                and not Might_Compose_Deep(cast(const RELVAL*, cell), label)
+            ){
+                Derelativize(DS_PUSH(), f_value, specifier);  // no copy
+                continue;
+            }
+
             REBDSP dsp_deep = DSP;
             REB_R r = Compose_To_Stack_Core(
                 out,
@@ -47,6 +47,219 @@
 #include "sys-core.h"
 
 
+//=//// SET OPERATION TABLE ///////////////////////////////////////////////=//
+//
+// R3-Alpha ran set operations on arrays through Find_Key_Hashed(), with a
+// hashlist of the second series, plus a hashlist and a buffer array for the
+// result that was then copied out at its final size.  Strings and binaries
+// did a FIND in the other series and in the result for each element, so they
+// were quadratic.
+//
+// Here a single open-addressed table serves both to check membership in the
+// other series and to filter out duplicates, as each entry is tagged with
+// what is known about its key.  Slots hold the full hash, so a probe rarely
+// calls Cmp_Value() on anything but the match.  Codepoints of strings and
+// bytes of binaries (without /SKIP) are the hash themselves, with no key cell.
+//
+// The slots are kept for the next operation (in TG_Set_Slots) unless the
+// table was grown past SET_TABLE_KEEP, so small operations don't allocate and
+// big ones don't hold onto their memory.
+//
+
+#define SET_TABLE_KEEP 4096
+
+enum Reb_Set_Tag {
+    SET_TAG_EMPTY = 0,
+    SET_TAG_OTHER,  // key is in the other series (which is being checked)
+    SET_TAG_OUTPUT,  // key has been put in the result
+    SET_TAG_SHARED  // key is in both series, and won't be in the result
+};
+
+struct Reb_Set_Slot {
+    const RELVAL *key;  // nullptr if hash is the codepoint or byte itself
+    uint32_t hash;
+    uint32_t tag;  // enum Reb_Set_Tag
+};
+
+struct Reb_Set_Table {
+    struct Reb_Set_Slot *slots;
+    REBLEN mask;  // number of slots (a power of 2) minus one
+    REBLEN shift;  // to take the top bits of a 32-bit multiplied-out hash
+};
+
+
+static void Init_Set_Table(struct Reb_Set_Table *t, REBLEN count)
+{
+    REBLEN bits = 4;
+    while ((cast(REBLEN, 1) << bits) < count * 2) {  // at most half-full
+        ++bits;
+        if (bits == 32) {
+            DECLARE_LOCAL (temp);
+            Init_Integer(temp, count);
+            fail (Error_Size_Limit_Raw(temp));
+        }
+    }
+    REBLEN num_slots = cast(REBLEN, 1) << bits;
+
+    if (num_slots > TG_Set_Slots_Capacity) {
+        if (TG_Set_Slots)
+            FREE_N(struct Reb_Set_Slot, TG_Set_Slots_Capacity, TG_Set_Slots);
+        TG_Set_Slots_Capacity = 0;
+        TG_Set_Slots = TRY_ALLOC_N(struct Reb_Set_Slot, num_slots);
+        if (TG_Set_Slots == nullptr)
+            fail (Error_No_Memory(sizeof(struct Reb_Set_Slot) * num_slots));
+        TG_Set_Slots_Capacity = num_slots;
+    }
+    memset(TG_Set_Slots, 0, sizeof(struct Reb_Set_Slot) * num_slots);
+
+    t->slots = TG_Set_Slots;
+    t->mask = num_slots - 1;
+    t->shift = 32 - bits;
+}
+
+
+static void Release_Set_Table(struct Reb_Set_Table *t)
+{
+    t->slots = nullptr;
+    if (TG_Set_Slots_Capacity > SET_TABLE_KEEP) {
+        FREE_N(struct Reb_Set_Slot, TG_Set_Slots_Capacity, TG_Set_Slots);
+        TG_Set_Slots = nullptr;
+        TG_Set_Slots_Capacity = 0;
+    }
+}
+
+
+// Gives back the slot with a key equal to the one given, or the empty slot
+// where it would go.  The key and hash are written in an empty slot, but it
+// stays empty until the caller tags it.
+//
+static struct Reb_Set_Slot *Seek_Set_Slot(
+    struct Reb_Set_Table *t,
+    const RELVAL *key,  // nullptr if hash is the key
+    uint32_t hash,
+    bool cased
+){
+    REBLEN i = (hash * 0x9E3779B1u) >> t->shift;  // Fibonacci hashing
+    while (true) {
+        struct Reb_Set_Slot *slot = &t->slots[i];
+        if (slot->tag == SET_TAG_EMPTY) {
+            slot->key = key;
+            slot->hash = hash;
+            return slot;
+        }
+        if (
+            slot->hash == hash
+            and (key == nullptr or 0 == Cmp_Value(slot->key, key, cased))
+        ){
+            return slot;
+        }
+        i = (i + 1) & t->mask;
+    }
+}
+
+
+// Whether an element of the series being iterated goes in the result.  The
+// first pass is over the first series, and the second pass is over the other
+// series for UNION and DIFFERENCE.  Any series being checked has had all its
+// keys put in the table with SET_TAG_OTHER before the first pass.
+//
+static bool Is_Set_Element_Kept(
+    struct Reb_Set_Slot *slot,
+    REBFLGS flags,
+    bool first_pass
+){
+    switch (slot->tag) {
+      case SET_TAG_EMPTY:
+        if (
+            first_pass
+            and (flags & SOP_FLAG_CHECK)
+            and not (flags & SOP_FLAG_INVERT)
+        ){
+            return false;  // INTERSECT of something not in the other series
+        }
+        slot->tag = SET_TAG_OUTPUT;
+        return true;
+
+      case SET_TAG_OTHER:
+        if (not first_pass or not (flags & SOP_FLAG_INVERT)) {
+            slot->tag = SET_TAG_OUTPUT;  // INTERSECT, or DIFFERENCE's 2nd pass
+            return true;
+        }
+        if (flags & SOP_FLAG_BOTH)
+            slot->tag = SET_TAG_SHARED;  // DIFFERENCE skips it in 2nd pass
+        return false;  // EXCLUDE
+
+      default:
+        return false;  // already in the result, or shared
+    }
+}
+
+
+// Records of the array at the position of `v` must be of the /SKIP size.
+//
+static REBLEN Set_Array_Records(const REBVAL *v, REBLEN skip)
+{
+    REBLEN len = VAL_LEN_AT(v);
+    if (len % skip != 0) {
+        //
+        // In the current philosophy, the semantics of what to do with things
+        // like `intersect/skip [1 2 3] [7] 2` is too shaky to deal with, so
+        // an error is reported if it does not work out evenly.
+        //
+        fail (Error_Block_Skip_Wrong_Raw());
+    }
+    return len / skip;
+}
+
+
+static void Tag_Array_Keys_Other(
+    struct Reb_Set_Table *t,
+    const REBVAL *v,
+    bool cased,
+    REBLEN skip
+){
+    const RELVAL *tail;
+    const RELVAL *item = VAL_ARRAY_AT(&tail, v);
+    for (; item != tail; item += skip) {
+        struct Reb_Set_Slot *slot = Seek_Set_Slot(
+            t, item, Hash_Value(item), cased
+        );
+        if (slot->tag == SET_TAG_EMPTY)
+            slot->tag = SET_TAG_OTHER;
+    }
+}
+
+
+static void Tag_Codepoints_Other(
+    struct Reb_Set_Table *t,
+    const REBVAL *v,
+    bool cased
+){
+    if (IS_BINARY(v)) {
+        REBSIZ size;
+        const REBYTE *bp = VAL_BINARY_SIZE_AT(&size, v);
+        for (; size != 0; ++bp, --size) {
+            struct Reb_Set_Slot *slot = Seek_Set_Slot(t, nullptr, *bp, true);
+            if (slot->tag == SET_TAG_EMPTY)
+                slot->tag = SET_TAG_OTHER;
+        }
+        return;
+    }
+
+    REBLEN len = VAL_LEN_AT(v);
+    REBCHR(const*) cp = VAL_STRING_AT(v);
+    for (; len != 0; --len) {
+        REBUNI c;
+        cp = NEXT_CHR(&c, cp);
+        struct Reb_Set_Slot *slot = Seek_Set_Slot(
+            t, nullptr, cased ? c : LO_CASE(c), true
+        );
+        if (slot->tag == SET_TAG_EMPTY)
+            slot->tag = SET_TAG_OTHER;
+    }
+}
+
+
 //
 //  Make_Set_Operation_Series: C
 //
@@ -107,74 +320,119 @@ REBSER *Make_Set_Operation_Series(
     REBSER *out_ser;
 
     if (ANY_ARRAY(val1)) {
-        REBSER *hser = 0;   // hash table for series
-        REBSER *hret;       // hash table for return series
+        REBLEN records = Set_Array_Records(val1, skip);
+        if (val2 and (flags & (SOP_FLAG_CHECK | SOP_FLAG_BOTH)))
+            records += Set_Array_Records(val2, skip);
 
-        // The buffer used for building the return series.  This creates
-        // a new buffer every time, but reusing one might be slightly more
-        // efficient.
-        //
-        REBSER *buffer = Make_Array(i);
-        hret = Make_Hash_Series(i);   // allocated
+        struct Reb_Set_Table table;
+        Init_Set_Table(&table, records);
+
+        if (flags & SOP_FLAG_CHECK)
+            Tag_Array_Keys_Other(&table, val2, cased, skip);
 
-        // Optimization note: !!
-        // This code could be optimized for small blocks by not hashing them
-        // and extending Find_Key to FIND on the value itself w/o the hash.
+        REBARR *a = Make_Array(i);
 
         do {
             // Note: val1 and val2 swapped 2nd pass!
             //
-            const REBARR *array1 = VAL_ARRAY(val1);
+            REBSPC *specifier = VAL_SPECIFIER(val1);
+            const RELVAL *tail;
+            const RELVAL *item = VAL_ARRAY_AT(&tail, val1);
+            for (; item != tail; item += skip) {
+                struct Reb_Set_Slot *slot = Seek_Set_Slot(
+                    &table, item, Hash_Value(item), cased
+                );
+                if (not Is_Set_Element_Kept(slot, flags, first_pass))
+                    continue;
+
+                REBLEN n;
+                for (n = 0; n < skip; ++n)
+                    Derelativize(Alloc_Tail_Array(a), item + n, specifier);
+            }
 
-            // Check what is in series1 but not in series2
-            //
-            if (flags & SOP_FLAG_CHECK)
-                hser = Hash_Block(val2, skip, cased);
+            if (not first_pass)
+                break;
+            first_pass = false;
 
-            // Iterate over first series
+            if ((flags & SOP_FLAG_BOTH) == 0)
+                break;  // don't need to iterate over second series
+
+            const REBVAL *temp = val1;
+            val1 = val2;
+            val2 = temp;
+        } while (true);
+
+        Release_Set_Table(&table);
+
+        // The array was allocated for the biggest possible result.  Only pay
+        // for copying it out at its used size if that wastes a lot.
+        //
+        if (ARR_LEN(a) < i / 2) {
+            out_ser = Copy_Array_Shallow(a, SPECIFIED);
+            Free_Unmanaged_Series(a);
+        }
+        else
+            out_ser = a;
+    }
+    else if (skip == 1) {
+        //
+        // Strings and binaries without /SKIP are sets of codepoints or bytes,
+        // which are their own hashes.  Caseless, codepoints are lowercased
+        // (as FIND would compare them).
+        //
+        REBLEN count = VAL_LEN_AT(val1);
+        if (val2 and (flags & (SOP_FLAG_CHECK | SOP_FLAG_BOTH)))
+            count += VAL_LEN_AT(val2);
+
+        struct Reb_Set_Table table;
+        Init_Set_Table(&table, count);
+
+        if (flags & SOP_FLAG_CHECK)
+            Tag_Codepoints_Other(&table, val2, cased);
+
+        bool is_binary = IS_BINARY(val1);
+
+        DECLARE_MOLD (mo);
+        REBBIN *buf = BYTE_BUF;
+        REBLEN buf_start_len = BIN_LEN(buf);
+
+        if (is_binary)
+            EXPAND_SERIES_TAIL(buf, i);  // ask for at least `i` capacity
+        else {
+            SET_MOLD_FLAG(mo, MOLD_FLAG_RESERVE);
+            mo->reserve = i;
+            Push_Mold(mo);
+        }
+        REBLEN buf_at = buf_start_len;
+
+        do {
+            // Note: val1 and val2 swapped 2nd pass!
             //
-            i = VAL_INDEX(val1);
-            for (; i < ARR_LEN(array1); i += skip) {
-                const RELVAL *item = ARR_AT(array1, i);
-                if (flags & SOP_FLAG_CHECK) {
-                    h = Find_Key_Hashed(
-                        m_cast(REBARR*, VAL_ARRAY(val2)),  // mode 1 unchanged
-                        hser,
-                        item,
-                        VAL_SPECIFIER(val1),
-                        skip,
-                        cased,
-                        1  // won't modify the input array
+            if (is_binary) {
+                REBSIZ size;
+                const REBYTE *bp = VAL_BINARY_SIZE_AT(&size, val1);
+                for (; size != 0; ++bp, --size) {
+                    struct Reb_Set_Slot *slot = Seek_Set_Slot(
+                        &table, nullptr, *bp, true
                     );
-                    h = (h >= 0);
-                    if (flags & SOP_FLAG_INVERT) h = !h;
+                    if (Is_Set_Element_Kept(slot, flags, first_pass))
+                        *BIN_AT(buf, buf_at++) = *bp;
                 }
-                if (h) {
-                    Find_Key_Hashed(
-                        ARR(buffer),
-                        hret,
-                        item,
-                        VAL_SPECIFIER(val1),
-                        skip,
-                        cased,
-                        2
+            }
+            else {
+                REBLEN len = VAL_LEN_AT(val1);
+                REBCHR(const*) cp = VAL_STRING_AT(val1);
+                for (; len != 0; --len) {
+                    REBUNI c;
+                    cp = NEXT_CHR(&c, cp);
+                    struct Reb_Set_Slot *slot = Seek_Set_Slot(
+                        &table, nullptr, cased ? c : LO_CASE(c), true
                     );
+                    if (Is_Set_Element_Kept(slot, flags, first_pass))
+                        Append_Codepoint(mo->series, c);
                 }
             }
 
-            if (i != ARR_LEN(array1)) {
-                //
-                // In the current philosophy, the semantics of what to do
-                // with things like `intersect/skip [1 2 3] [7] 2` is too
-                // shaky to deal with, so an error is reported if it does
-                // not work out evenly to the skip size.
-                //
-                fail (Error_Block_Skip_Wrong_Raw());
-            }
-
-            if (flags & SOP_FLAG_CHECK)
-                Free_Unmanaged_Series(hser);
-
             if (not first_pass)
                 break;
             first_pass = false;
@@ -187,14 +445,19 @@ REBSER *Make_Set_Operation_Series(
             val2 = temp;
         } while (true);
 
-        if (hret)
-            Free_Unmanaged_Series(hret);
+        Release_Set_Table(&table);
 
-        // The buffer may have been allocated too large, so copy it at the
-        // used capacity size
-        //
-        out_ser = Copy_Array_Shallow(ARR(buffer), SPECIFIED);
-        Free_Unmanaged_Series(ARR(buffer));
+        if (is_binary) {
+            REBLEN out_len = buf_at - buf_start_len;
+            REBBIN *out_bin = Make_Binary(out_len);
+            memcpy(BIN_HEAD(out_bin), BIN_AT(buf, buf_start_len), out_len);
+            TERM_BIN_LEN(out_bin, out_len);
+            out_ser = out_bin;
+
+            TERM_BIN_LEN(buf, buf_start_len);
+        }
+        else
+            out_ser = Pop_Molded_String(mo);
     }
     else if (ANY_STRING(val1)) {
         DECLARE_MOLD (mo);
@@ -361,3 +624,85 @@ REBSER *Make_Set_Operation_Series(
 
     return out_ser;
 }
+
+
+//
+//  deduplicate: native [
+//
+//  {Removes duplicates from an array in place, keeping the first of each}
+//
+//      return: [any-array!]
+//      series "Modified at and after its position"
+//          [any-array!]
+//      /case "Use case-sensitive comparison"
+//      /skip "Treat the series as records of fixed size"
+//          [integer!]
+//  ]
+//
+REBNATIVE(deduplicate)
+//
+// Gives the same contents as UNIQUE would, without making a new array.
+{
+    INCLUDE_PARAMS_OF_DEDUPLICATE;
+
+    REBVAL *series = ARG(series);
+    REBARR *a = VAL_ARRAY_ENSURE_MUTABLE(series);
+    bool cased = did REF(case);
+    REBLEN skip = REF(skip) ? Int32s(ARG(skip), 1) : 1;
+
+    struct Reb_Set_Table table;
+    Init_Set_Table(&table, Set_Array_Records(series, skip));
+
+    // Records that are kept go down to the `dest` position, and their slot
+    // in the table is repointed there (a later record may overwrite where
+    // they were).
+    //
+    const RELVAL *tail;
+    RELVAL *src = VAL_ARRAY_AT_ENSURE_MUTABLE(&tail, series);
+    RELVAL *dest = src;
+    for (; src != tail; src += skip) {
+        struct Reb_Set_Slot *slot = Seek_Set_Slot(
+            &table, src, Hash_Value(src), cased
+        );
+        if (slot->tag != SET_TAG_EMPTY)
+            continue;  // a duplicate
+
+        slot->tag = SET_TAG_OUTPUT;
+        if (dest != src) {
+            REBLEN n;
+            for (n = 0; n < skip; ++n)
+                Copy_Cell(dest + n, src + n);
+        }
+        slot->key = dest;
+        dest += skip;
+    }
+
+    Release_Set_Table(&table);
+
+    SET_SERIES_LEN(a, dest - ARR_HEAD(a));
+    TERM_SERIES_IF_NECESSARY(a);
+
+    RETURN (series);
+}
+
+
+//
+//  Startup_Set_Operations: C
+//
+void Startup_Set_Operations(void)
+{
+    TG_Set_Slots = nullptr;  // allocated by first set operation on a series
+    TG_Set_Slots_Capacity = 0;
+}
+
+
+//
+//  Shutdown_Set_Operations: C
+//
+void Shutdown_Set_Operations(void)
+{
+    if (TG_Set_Slots)
+        FREE_N(struct Reb_Set_Slot, TG_Set_Slots_Capacity, TG_Set_Slots);
+    TG_Set_Slots = nullptr;
+    TG_Set_Slots_Capacity = 0;
+}
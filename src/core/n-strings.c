@@ -37,6 +37,8 @@
 //      delimiter [<opt> blank! char! text!]
 //      line "Will be copied if already a text value"
 //          [<blank> text! block! issue!]
+//      /into "Append to this string instead of making a new one (returned)"
+//          [text!]
 //  ]
 //
 REBNATIVE(delimit)
@@ -44,6 +46,30 @@ REBNATIVE(delimit)
     INCLUDE_PARAMS_OF_DELIMIT;
 
     REBVAL *line = ARG(line);
+
+    if (REF(into)) {
+        REBSTR *into = VAL_STRING_ENSURE_MUTABLE(ARG(into));
+
+        if (IS_BLOCK(line)) {
+            if (Form_Reduce_Throws(
+                D_OUT,
+                VAL_ARRAY(line),
+                VAL_INDEX(line),
+                VAL_SPECIFIER(line),
+                ARG(delimiter),
+                into
+            )){
+                return R_THROWN;
+            }
+            if (IS_NULLED(D_OUT))
+                return nullptr;
+        }
+        else
+            Append_String_Limit(into, line, UNLIMITED);
+
+        RETURN (ARG(into));
+    }
+
     if (IS_TEXT(line) or IS_ISSUE(line))
         return rebValue("copy", line);  // !!! Review performance
 
@@ -54,7 +80,8 @@ REBNATIVE(delimit)
         VAL_ARRAY(line),
         VAL_INDEX(line),
         VAL_SPECIFIER(line),
-        ARG(delimiter)
+        ARG(delimiter),
+        nullptr
     )){
         return R_THROWN;
     }
@@ -73,14 +100,18 @@ REBNATIVE(delimit)
 //      value [binary! text!]
 //      /base "The base to convert from: 64, 16, or 2 (defaults to 64)"
 //          [integer!]
+//      /part "Length of value to decode (decodes in place, without a COPY)"
+//          [any-value!]
 //  ]
 //
 REBNATIVE(debase)
 {
     INCLUDE_PARAMS_OF_DEBASE;
 
+    REBLEN len = Part_Len_May_Modify_Index(ARG(value), ARG(part));
+
     REBSIZ size;
-    const REBYTE *bp = VAL_BYTES_AT(&size, ARG(value));
+    const REBYTE *bp = VAL_BYTES_LIMIT_AT(&size, ARG(value), len);
 
     REBINT base = 64;
     if (REF(base))
@@ -145,6 +176,38 @@ REBNATIVE(enbase)
 }
 
 
+// The details of what ASCII characters must be percent encoded are contained
+// in RFC 3896, but a summary is here:
+//
+// https://stackoverflow.com/a/7109208/
+//
+// Everything but: A-Z a-z 0-9 - . _ ~ : / ? # [ ] @ ! $ & ' ( ) * + , ; =
+//
+// Lex_Map[] doesn't have a bit for this in particular, and sorting it out
+// from the lex classes took a switch() per character.  So ENHEX looks up
+// each byte here instead, 1 meaning it is left as is.
+//
+static const REBYTE Enhex_As_Is[128] =
+{
+    /* 00 */    0, 0, 0, 0, 0, 0, 0, 0,  // control characters
+    /* 08 */    0, 0, 0, 0, 0, 0, 0, 0,
+    /* 10 */    0, 0, 0, 0, 0, 0, 0, 0,
+    /* 18 */    0, 0, 0, 0, 0, 0, 0, 0,
+    /* 20 */    0, 1, 0, 1, 1, 0, 1, 1,  //   ! " # $ % & '
+    /* 28 */    1, 1, 1, 1, 1, 1, 1, 1,  // ( ) * + , - . /
+    /* 30 */    1, 1, 1, 1, 1, 1, 1, 1,  // 0 1 2 3 4 5 6 7
+    /* 38 */    1, 1, 1, 1, 0, 1, 0, 1,  // 8 9 : ; < = > ?
+    /* 40 */    1, 1, 1, 1, 1, 1, 1, 1,  // @ A B C D E F G
+    /* 48 */    1, 1, 1, 1, 1, 1, 1, 1,  // H I J K L M N O
+    /* 50 */    1, 1, 1, 1, 1, 1, 1, 1,  // P Q R S T U V W
+    /* 58 */    1, 1, 1, 1, 0, 1, 0, 1,  // X Y Z [ \ ] ^ _
+    /* 60 */    0, 1, 1, 1, 1, 1, 1, 1,  // ` a b c d e f g
+    /* 68 */    1, 1, 1, 1, 1, 1, 1, 1,  // h i j k l m n o
+    /* 70 */    1, 1, 1, 1, 1, 1, 1, 1,  // p q r s t u v w
+    /* 78 */    1, 1, 1, 0, 0, 0, 1, 0   // x y z { | } ~ DEL
+};
+
+
 //
 //  enhex: native [
 //
@@ -160,150 +223,87 @@ REBNATIVE(enhex)
 {
     INCLUDE_PARAMS_OF_ENHEX;
 
-    // The details of what ASCII characters must be percent encoded
-    // are contained in RFC 3896, but a summary is here:
-    //
-    // https://stackoverflow.com/a/7109208/
-    //
-    // Everything but: A-Z a-z 0-9 - . _ ~ : / ? # [ ] @ ! $ & ' ( ) * + , ; =
-    //
   #if !defined(NDEBUG)
     const char *no_encode =
         "ABCDEFGHIJKLKMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789" \
             "-._~:/?#[]@!$&'()*+,;=";
   #endif
 
+    // Percent encoding is of the UTF-8 bytes, so there's no need to decode
+    // the codepoints: every byte of a non-ASCII character *must* be encoded,
+    // and the output is all ASCII.
+    //
+    REBSIZ size;
+    const REBYTE *bp = VAL_UTF8_SIZE_AT(&size, ARG(string));
+
     DECLARE_MOLD (mo);
     Push_Mold (mo);
 
-    REBLEN len;
-    REBCHR(const*) cp = VAL_UTF8_LEN_SIZE_AT(&len, nullptr, ARG(string));
-
-    REBUNI c;
-    cp = NEXT_CHR(&c, cp);
-
-    REBLEN i;
-    for (i = 0; i < len; cp = NEXT_CHR(&c, cp), ++i) {
-        //
-        // !!! Length 4 should be legal here, but a warning in an older GCC
-        // is complaining that Encode_UTF8_Char reaches out of array bounds
-        // when it does not appear to.  Possibly related to this:
-        //
-        // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=43949
-        //
-        REBYTE encoded[6];
-        REBLEN encoded_size;
+    REBSTR *s = mo->series;
+    REBLEN old_len = STR_LEN(s);
+    REBSIZ old_size = STR_SIZE(s);
 
-        if (c >= 0x80) {  // all non-ASCII characters *must* be percent encoded
-            encoded_size = Encoded_Size_For_Codepoint(c);
-            Encode_UTF8_Char(encoded, c, encoded_size);
-        }
-        else {
-            // "Everything else must be url-encoded".  Rebol's LEX_MAP does
-            // not have a bit for this in particular, though maybe it could
-            // be retooled to help more with this.  For now just use it to
-            // speed things up a little.
-
-            encoded[0] = cast(REBYTE, c);
-            encoded_size = 1;
-
-            switch (GET_LEX_CLASS(c)) {
-              case LEX_CLASS_DELIMIT:
-                switch (GET_LEX_VALUE(c)) {
-                  case LEX_DELIMIT_LEFT_PAREN:
-                  case LEX_DELIMIT_RIGHT_PAREN:
-                  case LEX_DELIMIT_LEFT_BRACKET:
-                  case LEX_DELIMIT_RIGHT_BRACKET:
-                  case LEX_DELIMIT_SLASH:
-                  case LEX_DELIMIT_PERIOD:
-                  case LEX_DELIMIT_TILDE:
-                  case LEX_DELIMIT_COMMA:
-                    goto leave_as_is;
-
-                  case LEX_DELIMIT_SPACE:  // includes control characters
-                  case LEX_DELIMIT_END:  // 00 null terminator
-                  case LEX_DELIMIT_LINEFEED:
-                  case LEX_DELIMIT_RETURN:  // e.g. ^M
-                  case LEX_DELIMIT_LEFT_BRACE:
-                  case LEX_DELIMIT_RIGHT_BRACE:
-                  case LEX_DELIMIT_DOUBLE_QUOTE:
-                    goto needs_encoding;
-
-                  case LEX_DELIMIT_UTF8_ERROR:  // not for c < 0x80
-                  default:
-                    panic ("Internal LEX_DELIMIT table error");
-                }
-                goto leave_as_is;
-
-              case LEX_CLASS_SPECIAL:
-                switch (GET_LEX_VALUE(c)) {
-                  case LEX_SPECIAL_AT:
-                  case LEX_SPECIAL_COLON:
-                  case LEX_SPECIAL_APOSTROPHE:
-                  case LEX_SPECIAL_PLUS:
-                  case LEX_SPECIAL_MINUS:
-                  case LEX_SPECIAL_BLANK:
-                  case LEX_SPECIAL_POUND:
-                  case LEX_SPECIAL_DOLLAR:
-                  case LEX_SPECIAL_SEMICOLON:
-                    goto leave_as_is;
-
-                  case LEX_SPECIAL_WORD:
-                    assert(false);  // only occurs in use w/Prescan_Token()
-                    goto leave_as_is;
-
-                  default:
-                    goto needs_encoding;
-                }
-                goto leave_as_is;
-
-              case LEX_CLASS_WORD:
-                if (
-                    (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z')
-                    or c == '?' or c == '!' or c == '&'
-                    or c == '*' or c == '='
-                ){
-                    goto leave_as_is;  // this is all that's leftover
-                }
-                goto needs_encoding;
+    REBYTE *dp = Prep_Mold_Overestimated(mo, size * 3);  // worst case: %XX
+    REBYTE *start = dp;
 
-              case LEX_CLASS_NUMBER:
-                goto leave_as_is;  // 0-9 needs no encoding.
-            }
+    for (; size > 0; --size, ++bp) {
+        REBYTE b = *bp;
 
-        leave_as_is:;
+        if (b < 0x80 and Enhex_As_Is[b]) {
           #if !defined(NDEBUG)
-            assert(strchr(no_encode, c) != NULL);
+            assert(strchr(no_encode, b) != NULL);
           #endif
-            Append_Codepoint(mo->series, c);
+            *dp++ = b;
             continue;
         }
 
-    needs_encoding:;
       #if !defined(NDEBUG)
-        if (c < 0x80)
-           assert(strchr(no_encode, c) == NULL);
+        if (b < 0x80)
+           assert(strchr(no_encode, b) == NULL);
       #endif
 
-        REBLEN n;
-        for (n = 0; n != encoded_size; ++n) {
-            Append_Codepoint(mo->series, '%');
-
-            // Use uppercase hex digits, per RFC 3896 2.1, which is also
-            // consistent with JavaScript's encodeURIComponent()
-            //
-            // https://tools.ietf.org/html/rfc3986#section-2.1
-            //
-            Append_Codepoint(mo->series, Hex_Digits[(encoded[n] & 0xf0) >> 4]);
-            Append_Codepoint(mo->series, Hex_Digits[encoded[n] & 0xf]);
-        }
+        // Use uppercase hex digits, per RFC 3896 2.1, which is also
+        // consistent with JavaScript's encodeURIComponent()
+        //
+        // https://tools.ietf.org/html/rfc3986#section-2.1
+        //
+        *dp++ = '%';
+        *dp++ = Hex_Digits[(b & 0xf0) >> 4];
+        *dp++ = Hex_Digits[b & 0xf];
     }
 
+    REBLEN added = dp - start;  // all ASCII, so length is the same as size
+    TERM_STR_LEN_SIZE(s, old_len + added, old_size + added);
+
     Init_Any_String(D_OUT, VAL_TYPE(ARG(string)), Pop_Molded_String(mo));
     return D_OUT;
 }
 
 
+// Check that the bytes at `bp` that came from %XX start with a codepoint,
+// giving back the position after it.
+//
+static const REBYTE *Dehex_Check_Codepoint(const REBYTE *bp, REBSIZ size)
+{
+    if (*bp < 0x80) {
+        //
+        // !!! Should you be able to give a BINARY! to be dehexed and then
+        // get a BINARY! back that permits internal zero chars?  This
+        // would not be guaranteeing UTF-8 compatibility.  Seems dodgy.
+        //
+        if (*bp == '\0')
+            fail (Error_Illegal_Zero_Byte_Raw());
+        return bp + 1;
+    }
+
+    REBUNI decoded;
+    bp = Back_Scan_UTF8_Char(&decoded, bp, &size);
+    if (bp == nullptr)
+        fail ("Bad UTF-8 sequence in %XX of dehex");
+    return bp + 1;  // Back_Scan gives back the last byte of the codepoint
+}
+
+
 //
 //  dehex: native [
 //
@@ -319,46 +319,66 @@ REBNATIVE(dehex)
 {
     INCLUDE_PARAMS_OF_DEHEX;
 
+    REBLEN len;
+    REBSIZ size;
+    const REBYTE *bp = VAL_UTF8_LEN_SIZE_AT(&len, &size, ARG(string));
+    const REBYTE *ep = bp + size;
+
     DECLARE_MOLD (mo);
     Push_Mold(mo);
 
-    // RFC 3986 says the encoding/decoding must use UTF-8.  This temporary
-    // buffer is used to hold up to 4 bytes (and a terminator) that need
-    // UTF-8 decoding--the maximum one UTF-8 encoded codepoint may have.
-    //
-    REBYTE scan[5];
-    REBSIZ scan_size = 0;
+    REBSTR *s = mo->series;
+    REBLEN old_len = STR_LEN(s);
+    REBSIZ old_size = STR_SIZE(s);
 
-    REBLEN len;
-    REBCHR(const*) cp = VAL_UTF8_LEN_SIZE_AT(&len, nullptr, ARG(string));
+    // Each %XX is 3 bytes in and 1 byte out, so the output is never bigger.
+    // Its length is that of the input, less 3 for each %XX, plus however
+    // many codepoints they decode to.
+    //
+    REBYTE *dp = Prep_Mold_Overestimated(mo, size);
+    REBYTE *start = dp;
+    REBLEN num_escapes = 0;
+    REBLEN num_decoded = 0;
 
-    REBUNI c;
-    cp = NEXT_CHR(&c, cp);
+    while (bp != ep) {
+        //
+        // What isn't %XX is copied as is.  It came from a string, so it's
+        // already valid UTF-8 and already counted in the input's length.
+        //
+        const REBYTE *percent = cast(const REBYTE*,
+            memchr(bp, '%', ep - bp)
+        );
+        if (not percent)
+            percent = ep;
+        memcpy(dp, bp, percent - bp);
+        dp += percent - bp;
+        bp = percent;
+
+        // RFC 3986 says the encoding/decoding must use UTF-8.  Up to 4
+        // bytes--the most one codepoint may have--are decoded before being
+        // checked, so errors are noticed in the same order as when this
+        // went codepoint by codepoint.
+        //
+        const REBYTE *check = dp;
 
-    REBLEN i;
-    for (i = 0; i < len;) {
-        if (c != '%')
-            Append_Codepoint(mo->series, c);
-        else {
-            if (i + 2 >= len)
+        for (; bp != ep and *bp == '%'; bp += 3, ++num_escapes) {
+            if (
+                ep - bp < 3  // fewer than 2 bytes, or 1 multi-byte character
+                or (
+                    bp[1] >= 0x80
+                    and ep - bp <= 2 + trailingBytesForUTF8[bp[1]]
+                )
+            ){
                fail ("Percent decode has less than two codepoints after %");
-
-            cp = NEXT_CHR(&c, cp);
-            ++i;
-            if (c > UINT8_MAX)
-                c = '\0'; // LEX_DELIMIT, will cause error below
-            REBYTE lex1 = Lex_Map[cast(REBYTE, c)];
-
-            cp = NEXT_CHR(&c, cp);
-            ++i;
-            if (c > UINT8_MAX)
-                c = '\0'; // LEX_DELIMIT, will cause error below
-            REBYTE lex2 = Lex_Map[cast(REBYTE, c)];
+            }
 
             // If class LEX_WORD or LEX_NUMBER, there is a value contained in
             // the mask which is the value of that "digit".  So A-F and
-            // a-f can quickly get their numeric values.
+            // a-f can quickly get their numeric values.  (Bytes of non-ASCII
+            // characters are never LEX_NUMBER, nor LEX_WORD with a value.)
             //
+            REBYTE lex1 = Lex_Map[bp[1]];
+            REBYTE lex2 = Lex_Map[bp[2]];
             REBYTE d1 = lex1 & LEX_VALUE;
             REBYTE d2 = lex2 & LEX_VALUE;
 
@@ -369,66 +389,25 @@ REBNATIVE(dehex)
                 fail ("Percent must be followed by 2 hex digits, e.g. %XX");
             }
 
-            // !!! We might optimize here for ASCII codepoints, but would
-            // need to consider it a "flushing point" for the scan buffer,
-            // in order to not gloss over incomplete UTF-8 sequences.
-            //
-            REBYTE b = (d1 << 4) + d2;
-            scan[scan_size++] = b;
-        }
-
-        cp = NEXT_CHR(&c, cp); // c may be '\0', guaranteed if `i == len`
-        ++i;
+            *dp++ = (d1 << 4) + d2;
 
-        // If our scanning buffer is full (and hence should contain at *least*
-        // one full codepoint) or there are no more UTF-8 bytes coming (due
-        // to end of string or the next input not a %XX pattern), then try
-        // to decode what we've got.
-        //
-        if (scan_size > 0 and (c != '%' or scan_size == 4)) {
-            assert(i != len or c == '\0');
-
-          decode_codepoint:
-            scan[scan_size] = '\0';
-            const REBYTE *next; // goto would cross initialization
-            REBUNI decoded;
-            if (scan[0] < 0x80) {
-                decoded = scan[0];
-                next = &scan[0]; // last byte is only byte (see Back_Scan)
-            }
-            else {
-                next = Back_Scan_UTF8_Char(&decoded, scan, &scan_size);
-                if (next == NULL)
-                    fail ("Bad UTF-8 sequence in %XX of dehex");
+            if (dp - check == 4) {
+                check = Dehex_Check_Codepoint(check, 4);
+                ++num_decoded;
             }
-
-            // !!! Should you be able to give a BINARY! to be dehexed and then
-            // get a BINARY! back that permits internal zero chars?  This
-            // would not be guaranteeing UTF-8 compatibility.  Seems dodgy.
-            //
-            if (decoded == '\0')
-                fail (Error_Illegal_Zero_Byte_Raw());
-
-            Append_Codepoint(mo->series, decoded);
-            --scan_size; // one less (see why it's called "Back_Scan")
-
-            // Slide any residual UTF-8 data to the head of the buffer
-            //
-            REBLEN n;
-            for (n = 0; n < scan_size; ++n) {
-                ++next; // pre-increment (see why it's called "Back_Scan")
-                scan[n] = *next;
-            }
-
-            // If we still have bytes left in the buffer and no more bytes
-            // are coming, this is the last chance to decode those bytes,
-            // keep going.
-            //
-            if (scan_size != 0 and c != '%')
-                goto decode_codepoint;
         }
+
+        for (; check != dp; ++num_decoded)  // no more %XX, bytes must finish
+            check = Dehex_Check_Codepoint(check, dp - check);
     }
 
+    assert(len >= 3 * num_escapes);
+    TERM_STR_LEN_SIZE(
+        s,
+        old_len + len - 3 * num_escapes + num_decoded,
+        old_size + (dp - start)
+    );
+
     Init_Any_String(D_OUT, VAL_TYPE(ARG(string)), Pop_Molded_String(mo));
     return D_OUT;
 }
@@ -919,15 +898,305 @@ REBNATIVE(invalid_utf8_q)
 
     const REBYTE *end = utf8 + size;
 
-    REBLEN trail;
-    for (; utf8 != end; utf8 += trail) {
-        trail = trailingBytesForUTF8[*utf8] + 1;
-        if (utf8 + trail > end or not isLegalUTF8(utf8, trail)) {
-            Copy_Cell(D_OUT, arg);
-            VAL_INDEX_RAW(D_OUT) = utf8 - BIN_HEAD(VAL_BINARY(arg));
-            return D_OUT;
+    REBLEN num_codepoints;
+    const REBYTE *bad = Seek_Invalid_Utf8(&num_codepoints, utf8, end);
+    if (bad == end)
+        return nullptr;  // no invalid byte found
+
+    Copy_Cell(D_OUT, arg);
+    VAL_INDEX_RAW(D_OUT) = bad - BIN_HEAD(VAL_BINARY(arg));
+    return D_OUT;
+}
+
+
+// A match of a pattern in a string or binary.  The index and length are in
+// units of the searched series (codepoints or bytes), the offset and size are
+// in bytes from its head.  (A caseless match in text may not be the same size
+// as the pattern.)
+//
+struct Reb_Binstr_Match {
+    REBLEN index;
+    REBLEN len;
+    REBSIZ offset;
+    REBSIZ size;
+};
+
+#define BINSTR_MATCHES_HEAD(matches) \
+    cast(struct Reb_Binstr_Match*, BIN_HEAD(matches))
+
+
+// Find up to `max` matches of `pattern` in `binstr`, from its index to its
+// tail, into an unmanaged buffer.  The search resumes after each match, so
+// they don't overlap.  The pattern must not be empty.
+//
+static REBBIN *Find_Binstr_Matches(
+    REBLEN *count_out,
+    const REBVAL *binstr,
+    const REBVAL *pattern,
+    REBFLGS flags,
+    REBLEN max
+){
+    const REBLEN wide = sizeof(struct Reb_Binstr_Match);
+
+    bool is_str = not IS_BINARY(binstr);
+    const REBYTE *head = is_str
+        ? STR_HEAD(VAL_STRING(binstr))
+        : BIN_HEAD(VAL_BINARY(binstr));
+    REBLEN len_head = VAL_LEN_HEAD(binstr);
+
+    REBLEN limit;
+    if (IS_BINARY(pattern))
+        limit = VAL_LEN_AT(pattern);
+    else
+        VAL_UTF8_LEN_SIZE_AT(&limit, nullptr, pattern);
+    assert(limit != 0);
+
+    REBBIN *matches = Make_Binary(wide * 8);
+    REBLEN count = 0;
+
+    DECLARE_LOCAL (pos);
+    Copy_Cell(pos, binstr);
+
+    while (count < max) {
+        struct Reb_Binstr_Match m;
+        m.index = Find_Binstr_In_Binstr(
+            &m.len, pos, len_head, pattern, limit, flags, 1
+        );
+        if (m.index == NOT_FOUND)
+            break;
+
+        if (is_str) {  // seek in codepoints, via the string's bookmarks
+            VAL_INDEX_UNBOUNDED(pos) = m.index;
+            m.offset = VAL_STRING_AT(pos) - head;
+            VAL_INDEX_UNBOUNDED(pos) = m.index + m.len;
+            m.size = VAL_STRING_AT(pos) - head - m.offset;
+        }
+        else {
+            VAL_INDEX_UNBOUNDED(pos) = m.index + m.len;
+            m.offset = m.index;
+            m.size = m.len;
+        }
+
+        EXPAND_SERIES_TAIL(matches, wide);
+        memcpy(BIN_AT(matches, count * wide), &m, wide);
+        ++count;
+    }
+
+    *count_out = count;
+    return matches;
+}
+
+
+//
+//  replace*: native [
+//
+//  {Replace a pattern in a string or binary, in one pass (see REPLACE)}
+//
+//      return: "Target, or just past the last replacement if /TAIL"
+//          [any-string! binary!]
+//      target "Modified"
+//          [any-string! binary!]
+//      pattern "Must not be empty, can only be BINARY! if target is"
+//          [any-string! binary!]
+//      replacement "Can only be BINARY! if target is"
+//          [any-string! binary! issue!]
+//      /all "Replace all occurrences"
+//      /case "Case-sensitive replacement"
+//      /tail "Return target after the last replacement position"
+//  ]
+//
+REBNATIVE(replace_p)
+//
+// The REPLACE mezzanine uses this when it can.  Doing it with FIND and
+// CHANGE moves the rest of the target for each match, so REPLACE/ALL on big
+// text took time proportional to the size times the number of matches.
+// This finds all the matches first, so the result can be made in a buffer
+// of just the right size with one copy of each piece.  That's then swapped
+// in as the target's data.
+{
+    INCLUDE_PARAMS_OF_REPLACE_P;
+
+    REBVAL *target = ARG(target);
+    REBVAL *pattern = ARG(pattern);
+    REBVAL *replacement = ARG(replacement);
+
+    bool is_str = not IS_BINARY(target);
+    if (is_str and IS_BINARY(pattern))
+        fail (PAR(pattern));
+    if (is_str and IS_BINARY(replacement))
+        fail (PAR(replacement));
+
+    REBSER *s = VAL_SERIES_ENSURE_MUTABLE(target);
+
+    if (VAL_LEN_AT(pattern) == 0)
+        fail (Error_Bad_Value(pattern));
+
+    REBLEN count;
+    REBBIN *matches = Find_Binstr_Matches(
+        &count,
+        target,
+        pattern,
+        REF(case) ? AM_FIND_CASE : 0,
+        REF(all) ? UNLIMITED : 1
+    );
+
+    if (count == 0) {
+        Free_Unmanaged_Series(matches);
+        RETURN (target);
+    }
+
+    REBLEN repl_len;
+    REBSIZ repl_size;
+    const REBYTE *repl;
+    if (IS_BINARY(replacement)) {
+        repl = VAL_BINARY_SIZE_AT(&repl_size, replacement);
+        repl_len = repl_size;
+    }
+    else
+        repl = VAL_UTF8_LEN_SIZE_AT(&repl_len, &repl_size, replacement);
+
+    const struct Reb_Binstr_Match *m = BINSTR_MATCHES_HEAD(matches);
+
+    REBLEN matched_len = 0;
+    REBSIZ matched_size = 0;
+    REBLEN i;
+    for (i = 0; i < count; ++i) {
+        matched_len += m[i].len;
+        matched_size += m[i].size;
+    }
+
+    REBLEN new_len = VAL_LEN_HEAD(target) - matched_len + count * repl_len;
+    REBSIZ old_size = SER_USED(s);
+    REBSIZ new_size = old_size - matched_size + count * repl_size;
+
+    REBSER *copy = is_str ? Make_String(new_size) : Make_Binary(new_size);
+
+    const REBYTE *src = BIN_HEAD(s);
+    REBYTE *dest = BIN_HEAD(copy);
+    REBSIZ offset = 0;
+    for (i = 0; i < count; ++i) {
+        memcpy(dest, src + offset, m[i].offset - offset);
+        dest += m[i].offset - offset;
+        memcpy(dest, repl, repl_size);
+        dest += repl_size;
+        offset = m[i].offset + m[i].size;
+    }
+    memcpy(dest, src + offset, old_size - offset);
+
+    if (is_str)
+        TERM_STR_LEN_SIZE(STR(copy), new_len, new_size);
+    else
+        TERM_BIN_LEN(BIN(copy), new_size);
+
+    // Every match ends at or before the last one's end, so that is where
+    // the last replacement ends, adjusted by all the length changes.
+    //
+    REBLEN tail = m[count - 1].index + m[count - 1].len
+        - matched_len + count * repl_len;
+
+    Free_Unmanaged_Series(matches);
+
+    Swap_Series_Content(copy, s);  // keep the identity of the target
+    Free_Unmanaged_Series(copy);  // now frees the target's old data
+
+    if (REF(tail))
+        VAL_INDEX_UNBOUNDED(target) = tail;
+
+    RETURN (target);
+}
+
+
+//
+//  split*: native [
+//
+//  {Split a string at each delimiter, in one pass (see SPLIT)}
+//
+//      return: "Pieces, including an empty one after a delimiter at the tail"
+//          [block!]
+//      series [any-string!]
+//      delimiter "Matched caselessly, as PARSE would (text must not be empty)"
+//          [text! issue! bitset!]
+//  ]
+//
+REBNATIVE(split_p)
+//
+// The SPLIT mezzanine uses this for string series split on a TEXT!, CHAR!
+// or BITSET! delimiter, instead of copying the pieces out with PARSE.
+{
+    INCLUDE_PARAMS_OF_SPLIT_P;
+
+    REBVAL *series = ARG(series);
+    REBVAL *delimiter = ARG(delimiter);
+
+    enum Reb_Kind kind = VAL_TYPE(series);
+    const REBYTE *head = STR_HEAD(VAL_STRING(series));
+    REBLEN len_head = VAL_LEN_HEAD(series);
+
+    REBDSP dsp_orig = DSP;
+
+    if (VAL_INDEX(series) >= len_head)  // empty input gives no pieces
+        return Init_Block(D_OUT, Make_Array(0));
+
+    REBLEN count;
+    REBBIN *matches;
+    if (IS_BITSET(delimiter)) {  // one codepoint per match, just test each
+        const REBLEN wide = sizeof(struct Reb_Binstr_Match);
+        const REBBIN *bset = VAL_BITSET(delimiter);
+
+        matches = Make_Binary(wide * 8);
+        count = 0;
+
+        struct Reb_Binstr_Match m;
+        m.index = VAL_INDEX(series);
+        m.len = 1;
+        REBCHR(const*) cp = VAL_STRING_AT(series);
+        for (; m.index < len_head; ++m.index) {
+            REBUNI c;
+            REBCHR(const*) next = NEXT_CHR(&c, cp);
+            if (Check_Bit(bset, c, true)) {
+                m.offset = cp - head;
+                m.size = next - cp;
+                EXPAND_SERIES_TAIL(matches, wide);
+                memcpy(BIN_AT(matches, count * wide), &m, wide);
+                ++count;
+            }
+            cp = next;
         }
     }
+    else {
+        REBLEN limit;
+        VAL_UTF8_LEN_SIZE_AT(&limit, nullptr, delimiter);
+        if (limit == 0)
+            fail (Error_Bad_Value(delimiter));
+
+        matches = Find_Binstr_Matches(
+            &count, series, delimiter, 0, UNLIMITED
+        );
+    }
+
+    const struct Reb_Binstr_Match *m = BINSTR_MATCHES_HEAD(matches);
+
+    REBLEN index = VAL_INDEX(series);
+    REBSIZ offset = VAL_STRING_AT(series) - head;
+    REBLEN i;
+    for (i = 0; i <= count; ++i) {  // one more piece than delimiters
+        REBLEN piece_end = (i == count) ? len_head : m[i].index;
+        REBSIZ piece_size = (i == count)
+            ? STR_SIZE(VAL_STRING(series)) - offset
+            : m[i].offset - offset;
+
+        REBSTR *piece = Make_String(piece_size);
+        memcpy(STR_HEAD(piece), head + offset, piece_size);
+        TERM_STR_LEN_SIZE(piece, piece_end - index, piece_size);
+        Init_Any_String(DS_PUSH(), kind, piece);
+
+        if (i != count) {
+            index = m[i].index + m[i].len;
+            offset = m[i].offset + m[i].size;
+        }
+    }
+
+    Free_Unmanaged_Series(matches);
 
-    return nullptr;  // no invalid byte found
+    return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
 }
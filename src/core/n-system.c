@@ -105,6 +105,16 @@ REBNATIVE(exit_rebol)
 //      /ballast "Trigger for auto-recycle (memory used)"
 //          [integer!]
 //      /torture "Constant recycle (for internal debugging)"
+//      /incremental "Spread marking over evaluation, N cells per step (0=off)"
+//          [integer!]
+//      /generational "Do minor collections of short-lived series when able"
+//          [logic!]
+//      /threads "Number of threads to mark with in full collections"
+//          [integer!]
+//      /lazy "Sweep series nodes as they are needed, after marking"
+//          [logic!]
+//      /adaptive "Trigger at percent of live heap, more if allocating fast"
+//          [integer!]
 //      /watch "Monitor recycling (debug only)"
 //      /verbose "Dump information about series being recycled (debug only)"
 //  ]
@@ -133,6 +143,22 @@ REBNATIVE(recycle)
         TG_Ballast = 0;
     }
 
+    if (REF(incremental))  // any cycle in progress is finished by Recycle()
+        GC_Step_Budget = VAL_UINT32(ARG(incremental));
+
+    if (REF(generational))  // this recycle is a major one anyway
+        Set_GC_Generational(VAL_LOGIC(ARG(generational)));
+
+    if (REF(threads))
+        if (not Set_GC_Mark_Threads(VAL_INT32(ARG(threads))))
+            fail (PAR(threads));
+
+    if (REF(lazy))
+        GC_Lazy_Sweep = VAL_LOGIC(ARG(lazy));
+
+    if (REF(adaptive))  // 0 goes back to the fixed /BALLAST
+        GC_Adaptive_Percent = VAL_UINT32(ARG(adaptive));
+
     if (GC_Disabled)
         return nullptr; // don't give misleading "0", since no recycle ran
 
@@ -160,7 +186,9 @@ REBNATIVE(recycle)
       #endif
     }
     else {
+        GC_Trigger = GC_TRIGGER_REQUEST;
         count = Recycle();
+        count += Finish_Lazy_Sweep();  // report all of the nodes recycled
     }
 
     if (REF(watch)) {
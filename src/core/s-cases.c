@@ -898,6 +898,188 @@ static const REBUNI Char_Cases[] = {
 };
 
 
+//=//// ASCII RUNS ////////////////////////////////////////////////////////=//
+//
+// Most text is ASCII, where changing case or comparing caselessly is just a
+// matter of flipping or ignoring the 0x20 bit on letters.  These routines
+// do that for runs of ASCII a vector at a time when SSE2, AVX2, or (64-bit)
+// NEON are available, stopping at the first non-ASCII byte so the caller can
+// handle that codepoint through the Unicode tables.
+//
+// (The Lower_Cases and Upper_Cases tables only map A-Z and a-z to each other
+// in the ASCII range, so treating ASCII by bit twiddling gives the same
+// answers as LO_CASE() and UP_CASE() would.)
+//
+
+#if !defined(__GNUC__)  // uses __builtin_ctz() (clang defines __GNUC__ too)
+    #define CASE_SCALAR
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+
+    #define CASE_CHUNK 32
+    #define CASE_BIT_WIDTH 1  // mask bits per byte
+    typedef __m256i CaseVec;
+    typedef uint32_t CaseBits;
+    #define CASE_ALL_BITS 0xFFFFFFFFu
+
+    #define CASE_LOAD(p)    _mm256_loadu_si256(cast(const __m256i*, (p)))
+    #define CASE_STORE(p,v) _mm256_storeu_si256(cast(__m256i*, (p)), (v))
+    #define CASE_SPLAT(c)   _mm256_set1_epi8(cast(char, (c)))
+    #define CASE_EQ(v,w)    _mm256_cmpeq_epi8((v), (w))
+    #define CASE_GT(v,w)    _mm256_cmpgt_epi8((v), (w))  // signed
+    #define CASE_OR(a,b)    _mm256_or_si256((a), (b))
+    #define CASE_AND(a,b)   _mm256_and_si256((a), (b))
+    #define CASE_XOR(a,b)   _mm256_xor_si256((a), (b))
+    #define CASE_BITS(v)    cast(CaseBits, _mm256_movemask_epi8(v))
+    #define CASE_HIGH_BITS(v)  CASE_BITS(v)  // movemask takes the top bits
+    #define CASE_CTZ(bits)  __builtin_ctz(bits)
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+
+    #define CASE_CHUNK 16
+    #define CASE_BIT_WIDTH 1
+    typedef __m128i CaseVec;
+    typedef uint32_t CaseBits;  // only low 16 bits used
+    #define CASE_ALL_BITS 0xFFFFu
+
+    #define CASE_LOAD(p)    _mm_loadu_si128(cast(const __m128i*, (p)))
+    #define CASE_STORE(p,v) _mm_storeu_si128(cast(__m128i*, (p)), (v))
+    #define CASE_SPLAT(c)   _mm_set1_epi8(cast(char, (c)))
+    #define CASE_EQ(v,w)    _mm_cmpeq_epi8((v), (w))
+    #define CASE_GT(v,w)    _mm_cmpgt_epi8((v), (w))  // signed
+    #define CASE_OR(a,b)    _mm_or_si128((a), (b))
+    #define CASE_AND(a,b)   _mm_and_si128((a), (b))
+    #define CASE_XOR(a,b)   _mm_xor_si128((a), (b))
+    #define CASE_BITS(v)    cast(CaseBits, _mm_movemask_epi8(v))
+    #define CASE_HIGH_BITS(v)  CASE_BITS(v)
+    #define CASE_CTZ(bits)  __builtin_ctz(bits)
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+
+    // NEON has no "movemask", but narrowing each 16-bit lane of a compare
+    // result by 4 bits gives a 64-bit mask with a nibble per byte.
+    //
+    #define CASE_CHUNK 16
+    #define CASE_BIT_WIDTH 4
+    typedef uint8x16_t CaseVec;
+    typedef uint64_t CaseBits;
+    #define CASE_ALL_BITS 0xFFFFFFFFFFFFFFFFull
+
+    #define CASE_LOAD(p)    vld1q_u8(p)
+    #define CASE_STORE(p,v) vst1q_u8((p), (v))
+    #define CASE_SPLAT(c)   vdupq_n_u8(c)
+    #define CASE_EQ(v,w)    vceqq_u8((v), (w))
+    #define CASE_GT(v,w)    vcgtq_u8((v), (w))  // unsigned (only on ASCII)
+    #define CASE_OR(a,b)    vorrq_u8((a), (b))
+    #define CASE_AND(a,b)   vandq_u8((a), (b))
+    #define CASE_XOR(a,b)   veorq_u8((a), (b))
+    #define CASE_BITS(v) \
+        vget_lane_u64(vreinterpret_u64_u8( \
+            vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0)
+    #define CASE_HIGH_BITS(v)  CASE_BITS(vcgeq_u8((v), vdupq_n_u8(0x80)))
+    #define CASE_CTZ(bits)  __builtin_ctzll(bits)
+#else
+    #define CASE_SCALAR
+#endif
+
+
+#if !defined(CASE_SCALAR)
+
+// Gives 0x20 in the bytes of `v` that are letters between `first` and `last`
+// and 0 elsewhere.  Only meaningful for the ASCII bytes in `v` (bytes 0x80
+// and up are negative to the signed x86 compares, and are never in range).
+//
+static inline CaseVec Case_Bits_In_Range(CaseVec v, char first, char last) {
+    return CASE_AND(
+        CASE_AND(
+            CASE_GT(v, CASE_SPLAT(first - 1)),
+            CASE_GT(CASE_SPLAT(last + 1), v)
+        ),
+        CASE_SPLAT(0x20)
+    );
+}
+
+#endif
+
+
+//
+//  Change_Case_Ascii: C
+//
+// Uppercase or lowercase the bytes from `bp` up to the first one that is not
+// ASCII, or to `end`.  Returns where it stopped.
+//
+REBYTE *Change_Case_Ascii(REBYTE *bp, const REBYTE *end, bool upper)
+{
+    char first = upper ? 'a' : 'A';
+    char last = upper ? 'z' : 'Z';
+
+  #if !defined(CASE_SCALAR)
+    for (; end - bp >= CASE_CHUNK; bp += CASE_CHUNK) {
+        CaseVec v = CASE_LOAD(bp);
+        if (CASE_HIGH_BITS(v) != 0)
+            break;  // finish with the byte loop
+        CASE_STORE(bp, CASE_XOR(v, Case_Bits_In_Range(v, first, last)));
+    }
+  #endif
+
+    for (; bp != end and *bp < 0x80; ++bp) {
+        if (*bp >= first and *bp <= last)
+            *bp ^= 0x20;
+    }
+    return bp;
+}
+
+
+//
+//  Ascii_Match_Len: C
+//
+// Count how many of the first `limit` bytes at `a` and `b` are ASCII and
+// equal (or equal caselessly, if not `strict`).  Hence the count stops at
+// the first mismatch or at the first byte that's not ASCII in either one.
+//
+REBLEN Ascii_Match_Len(
+    const REBYTE *a,
+    const REBYTE *b,
+    REBLEN limit,
+    bool strict
+){
+    REBLEN n = 0;
+
+  #if !defined(CASE_SCALAR)
+    for (; limit - n >= CASE_CHUNK; n += CASE_CHUNK) {
+        CaseVec va = CASE_LOAD(a + n);
+        CaseVec vb = CASE_LOAD(b + n);
+        if (not strict) {  // fold to lowercase
+            va = CASE_OR(va, Case_Bits_In_Range(va, 'A', 'Z'));
+            vb = CASE_OR(vb, Case_Bits_In_Range(vb, 'A', 'Z'));
+        }
+        CaseBits stops = (CASE_BITS(CASE_EQ(va, vb)) ^ CASE_ALL_BITS)
+            | CASE_HIGH_BITS(CASE_OR(va, vb));
+        if (stops != 0)
+            return n + CASE_CTZ(stops) / CASE_BIT_WIDTH;
+    }
+  #endif
+
+    for (; n != limit; ++n) {
+        REBYTE ca = a[n];
+        REBYTE cb = b[n];
+        if ((ca | cb) >= 0x80)
+            break;
+        if (ca != cb) {
+            if (strict)
+                break;
+            if (ca >= 'A' and ca <= 'Z')
+                ca |= 0x20;
+            if (cb >= 'A' and cb <= 'Z')
+                cb |= 0x20;
+            if (ca != cb)
+                break;
+        }
+    }
+    return n;
+}
+
+
 //
 //  Init_Char_Cases: C
 //
@@ -933,6 +1115,15 @@ void Init_Char_Cases(void)
         if (Lower_Cases[up[1]] == up[1])
             Lower_Cases[up[0]] = up[1];
     }
+
+    // A few non-ASCII characters lowercase to ASCII ones (e.g. KELVIN SIGN
+    // to `k`).  Caseless searches that only compare bytes have to know that.
+    //
+    memset(Ascii_Unicode_Folds, 0, sizeof(Ascii_Unicode_Folds));
+    for (n = 0x80; n < UNICODE_CASES; n++) {
+        if (Lower_Cases[n] < 0x80)
+            Ascii_Unicode_Folds[Lower_Cases[n]] = true;
+    }
 }
 
 
@@ -26,45 +26,224 @@
 
 #include "datatypes/sys-money.h" // !!! Needed for hash (should be a method?)
 
+#include <time.h>  // clock(), for the hash seed
+
 #include "sys-zlib.h" // re-use CRC code from zlib
 const z_crc_t *crc32_table; // pointer to the zlib CRC32 table
 
 
+//=//// FAST HASHING ////////////////////////////////////////////////////=//
+//
+// Hashes of strings and binaries for maps, sets, and the symbol table were
+// once CRC-32, computed a byte at a time (four table lookups per codepoint
+// for strings).  They are now a multiply-and-mix hash in the style of wyhash
+// (by Wang Yi).  Data is taken 16 bytes at a time as two 64-bit words, which
+// are XORed with a key and the running state, multiplied out to 128 bits,
+// and the two halves folded together.  The length goes into the final mix.
+//
+// The key and initial state come from PG_Hash_Seed, picked at random at
+// startup.  So someone who can choose the keys of a map (e.g. from network
+// input) can't work out ahead of time a set of strings that all land in
+// the same hash chain.  It also means hashes are only good in the process
+// that made them--they must never be saved.  (The HASH64 method of CHECKSUM
+// uses a fixed seed of 0 to be repeatable, but can change between versions.)
+//
+// Caseless hashes are the hash of the UTF-8 of each codepoint run through
+// LO_CASE().  The "hasher" is incremental so that can be done without a
+// buffer for the lowercased string.  Runs of ASCII are folded 8 bytes at a
+// time as 64-bit words.
+//
+
+#define HASH_SECRET_0 0x2d358dccaa6c78a5ull
+#define HASH_SECRET_1 0x8bb84b93962eacc9ull
+#define HASH_SECRET_2 0x4b33a62ed433d4a3ull
+#define HASH_SECRET_3 0x4d5a2da51de1aa47ull
+
+struct Reb_Hasher {
+    uint64_t key;  // XORed into the first word of each block
+    uint64_t state;
+    uint64_t total;  // bytes hashed so far
+    REBYTE buf[16];  // partial block
+    REBLEN buffered;
+};
+
+
+// Multiply to 128 bits, and fold the high half into the low one.
+//
+inline static uint64_t Hash_Mix(uint64_t a, uint64_t b) {
+  #if defined(__SIZEOF_INT128__)
+    __uint128_t r = cast(__uint128_t, a) * b;
+    return cast(uint64_t, r) ^ cast(uint64_t, r >> 64);
+  #else
+    uint64_t a_hi = a >> 32;
+    uint64_t a_lo = cast(uint32_t, a);
+    uint64_t b_hi = b >> 32;
+    uint64_t b_lo = cast(uint32_t, b);
+
+    uint64_t hi_hi = a_hi * b_hi;
+    uint64_t hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi;
+    uint64_t lo_lo = a_lo * b_lo;
+
+    uint64_t mid = (lo_lo >> 32)
+        + cast(uint32_t, hi_lo) + cast(uint32_t, lo_hi);
+    uint64_t lo = (mid << 32) | cast(uint32_t, lo_lo);
+    uint64_t hi = hi_hi + (hi_lo >> 32) + (lo_hi >> 32) + (mid >> 32);
+    return lo ^ hi;
+  #endif
+}
+
+// Read as little-endian so HASH64 checksums are the same on all platforms
+// (compilers turn this into a single load on little-endian machines).
+//
+inline static uint64_t Hash_Read_64(const REBYTE *p) {
+    return cast(uint64_t, p[0])
+        | (cast(uint64_t, p[1]) << 8)
+        | (cast(uint64_t, p[2]) << 16)
+        | (cast(uint64_t, p[3]) << 24)
+        | (cast(uint64_t, p[4]) << 32)
+        | (cast(uint64_t, p[5]) << 40)
+        | (cast(uint64_t, p[6]) << 48)
+        | (cast(uint64_t, p[7]) << 56);
+}
+
+inline static void Init_Hasher(struct Reb_Hasher *h, uint64_t seed) {
+    h->key = Hash_Mix(seed ^ HASH_SECRET_0, HASH_SECRET_1);
+    h->state = Hash_Mix(seed ^ HASH_SECRET_2, HASH_SECRET_3);
+    h->total = 0;
+    h->buffered = 0;
+}
+
+inline static void Hash_Block(struct Reb_Hasher *h, const REBYTE *p) {
+    h->state = Hash_Mix(
+        Hash_Read_64(p) ^ h->key,
+        Hash_Read_64(p + 8) ^ h->state
+    );
+}
+
+static void Hash_Feed(struct Reb_Hasher *h, const REBYTE *p, REBSIZ size)
+{
+    h->total += size;
+
+    if (h->buffered != 0) {
+        REBSIZ fill = MIN(size, 16 - h->buffered);
+        memcpy(h->buf + h->buffered, p, fill);
+        h->buffered += fill;
+        p += fill;
+        size -= fill;
+        if (h->buffered < 16)
+            return;
+        Hash_Block(h, h->buf);
+        h->buffered = 0;
+    }
+
+    for (; size >= 16; size -= 16, p += 16)
+        Hash_Block(h, p);
+
+    memcpy(h->buf, p, size);
+    h->buffered = size;
+}
+
+inline static void Hash_Feed_Byte(struct Reb_Hasher *h, REBYTE b) {
+    ++h->total;
+    h->buf[h->buffered] = b;
+    if (++h->buffered == 16) {
+        Hash_Block(h, h->buf);
+        h->buffered = 0;
+    }
+}
+
+static uint64_t Finish_Hasher(struct Reb_Hasher *h)
+{
+    memset(h->buf + h->buffered, 0, 16 - h->buffered);  // last block padded
+    uint64_t a = Hash_Read_64(h->buf) ^ h->key;
+    uint64_t b = Hash_Read_64(h->buf + 8) ^ h->state;
+    return Hash_Mix(Hash_Mix(a, b) ^ h->total ^ HASH_SECRET_0, HASH_SECRET_1);
+}
+
+inline static uint32_t Fold_Hash_32(uint64_t hash)
+  { return cast(uint32_t, hash ^ (hash >> 32)); }
+
+
+// Lowercases the 8 ASCII bytes of `w` (in each byte, sets 0x20 if the byte
+// is 'A' to 'Z').  Only correct if all the bytes are below 0x80.
 //
-//  Hash_UTF8: C
+inline static uint64_t Fold_Ascii_64(uint64_t w) {
+    const uint64_t ones = 0x0101010101010101ull;
+    uint64_t ge_A = w + (0x80 - 'A') * ones;
+    uint64_t gt_Z = w + (0x7F - 'Z') * ones;
+    return w | (((ge_A & ~gt_Z) & (0x80 * ones)) >> 2);
+}
+
+// Takes 16 bytes of ASCII (checked for) at once in the caseless hashes.
+//
+inline static bool Hash_Feed_Ascii_16(struct Reb_Hasher *h, const REBYTE *p)
+{
+    uint64_t w1 = Hash_Read_64(p);
+    uint64_t w2 = Hash_Read_64(p + 8);
+    if ((w1 | w2) & 0x8080808080808080ull)
+        return false;
+
+    REBYTE folded[16];
+    w1 = Fold_Ascii_64(w1);
+    w2 = Fold_Ascii_64(w2);
+
+    REBLEN i;
+    for (i = 0; i < 8; ++i) {
+        folded[i] = cast(REBYTE, w1 >> (i * 8));
+        folded[i + 8] = cast(REBYTE, w2 >> (i * 8));
+    }
+    Hash_Feed(h, folded, 16);
+    return true;
+}
+
+inline static void Hash_Feed_Codepoint(struct Reb_Hasher *h, REBUNI c) {
+    c = LO_CASE(c);
+    if (c < 0x80) {
+        Hash_Feed_Byte(h, cast(REBYTE, c));
+        return;
+    }
+    REBYTE encoded[4];
+    uint_fast8_t size = Encoded_Size_For_Codepoint(c);
+    Encode_UTF8_Char(encoded, c, size);
+    Hash_Feed(h, encoded, size);
+}
+
+
+//
+//  Hash_Scan_UTF8_Caseless_May_Fail: C
 //
 // Return a case-insensitive hash value for UTF-8 data that has not previously
 // been validated, with the size in bytes.
 //
 // See also: Hash_UTF8_Caseless(), which works with already validated UTF-8
-// bytes and takes a length in codepoints instead of a byte size.
+// bytes and takes a length in codepoints instead of a byte size.  The two
+// must give the same answers.
 //
 uint32_t Hash_Scan_UTF8_Caseless_May_Fail(const REBYTE *utf8, REBSIZ size)
 {
-    uint32_t crc = 0x00000000;
+    struct Reb_Hasher h;
+    Init_Hasher(&h, PG_Hash_Seed);
+
+    while (size != 0) {
+        if (size >= 16 and Hash_Feed_Ascii_16(&h, utf8)) {
+            utf8 += 16;
+            size -= 16;
+            continue;
+        }
 
-    for (; size != 0; ++utf8, --size) {
         REBUNI c = *utf8;
-
         if (c >= 0x80) {
             utf8 = Back_Scan_UTF8_Char(&c, utf8, &size);
             if (utf8 == nullptr)
                 fail (Error_Bad_Utf8_Raw());
         }
-
-        c = LO_CASE(c);
-
-        // !!! This takes into account all 4 bytes of the lowercase codepoint
-        // for the CRC calculation.  In ASCII strings this will involve a lot
-        // of zeros.  Review if there's a better way.
-        //
-        crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 8)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 16)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 24)) & 0xff];
+        Hash_Feed_Codepoint(&h, c);
+        ++utf8;
+        --size;
     }
 
-    return ~crc;
+    return Fold_Hash_32(Finish_Hasher(&h));
 }
 
 
@@ -78,26 +257,92 @@ uint32_t Hash_Scan_UTF8_Caseless_May_Fail(const REBYTE *utf8, REBSIZ size)
 // UTF8 and a byte count instead.
 //
 uint32_t Hash_UTF8_Caseless(REBCHR(const*) cp, REBLEN len) {
-    uint32_t crc = 0x00000000;
+    struct Reb_Hasher h;
+    Init_Hasher(&h, PG_Hash_Seed);
+
+    while (len != 0) {  // 16 codepoints left means at least 16 bytes left
+        if (len >= 16 and Hash_Feed_Ascii_16(&h, cast(const REBYTE*, cp))) {
+            cp = cast(REBCHR(const*), cast(const REBYTE*, cp) + 16);
+            len -= 16;
+            continue;
+        }
 
-    REBLEN n;
-    for (n = 0; n < len; n++) {
         REBUNI c;
         cp = NEXT_CHR(&c, cp);
+        Hash_Feed_Codepoint(&h, c);
+        --len;
+    }
 
-        c = LO_CASE(c);
+    return Fold_Hash_32(Finish_Hasher(&h));
+}
 
-        // !!! This takes into account all 4 bytes of the lowercase codepoint
-        // for the CRC calculation.  In ASCII strings this will involve a lot
-        // of zeros.  Review if there's a better way.
-        //
-        crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 8)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 16)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 24)) & 0xff];
-    }
 
-    return ~crc;
+//=//// HASH CACHE ////////////////////////////////////////////////////////=//
+//
+// Hashing a TEXT! or BINARY! means going over all of its data, which is the
+// whole cost of a map lookup or rehash when keys are long.  Series that are
+// frozen can't change, so their hashes are remembered in a small direct-mapped
+// cache, keyed by the series node and the index hashed from.  Keys stored in
+// MAP!s are always frozen, as are LOCKed series.
+//
+// There's no modification stamp on series to check, so mutable series aren't
+// cached.  And since a freed series node gets reused for new data, the cache
+// is only used for managed series (freed only by the GC), and entries are
+// made stale by bumping TG_Hash_Cache_Generation on each GC.
+//
+#define HASH_CACHE_SIZE 1024  // must be a power of 2
+#define HASH_CACHE_MIN_SIZE 32  // shorter data hashes faster than a lookup
+
+struct Reb_Hash_Cache_Entry {
+    const REBSER *series;  // nullptr if the entry is unused
+    REBLEN index;
+    REBLEN generation;
+    bool caseless;  // hashes of strings, vs bytewise hashes of binaries
+    uint32_t hash;
+};
+
+
+// Gives the cache entry to use for the series and index, or nullptr if its
+// hash shouldn't be cached.  The entry is a hit if Is_Hash_Cache_Hit().
+//
+static struct Reb_Hash_Cache_Entry *Hash_Cache_Entry(
+    const REBSER *s,
+    REBLEN index,
+    REBSIZ size
+){
+    if (size < HASH_CACHE_MIN_SIZE)
+        return nullptr;
+    if (NOT_SERIES_FLAG(s, MANAGED) or not Is_Series_Frozen(s))
+        return nullptr;
+
+    uintptr_t bits = cast(uintptr_t, s) / sizeof(REBSER);
+    return &TG_Hash_Cache[(bits ^ index) & (HASH_CACHE_SIZE - 1)];
+}
+
+inline static bool Is_Hash_Cache_Hit(
+    const struct Reb_Hash_Cache_Entry *entry,
+    const REBSER *s,
+    REBLEN index,
+    bool caseless
+){
+    return entry->series == s
+        and entry->index == index
+        and entry->generation == TG_Hash_Cache_Generation
+        and entry->caseless == caseless;
+}
+
+static void Cache_Hash(
+    struct Reb_Hash_Cache_Entry *entry,
+    const REBSER *s,
+    REBLEN index,
+    bool caseless,
+    uint32_t hash
+){
+    entry->series = s;
+    entry->index = index;
+    entry->generation = TG_Hash_Cache_Generation;
+    entry->caseless = caseless;
+    entry->hash = hash;
 }
 
 
@@ -180,7 +425,19 @@ uint32_t Hash_Value(const RELVAL *v)
       case REB_BINARY: {
         REBSIZ size;
         const REBYTE *data = VAL_BINARY_SIZE_AT(&size, cell);
+
+        const REBSER *s = VAL_SERIES(cell);
+        REBLEN index = VAL_INDEX(cell);
+        struct Reb_Hash_Cache_Entry *entry = Hash_Cache_Entry(s, index, size);
+        if (entry and Is_Hash_Cache_Hit(entry, s, index, false)) {
+            hash = entry->hash;
+            assert(hash == cast(uint32_t, Hash_Bytes(data, size)));
+            break;
+        }
+
         hash = Hash_Bytes(data, size);
+        if (entry)
+            Cache_Hash(entry, s, index, false, hash);
         break; }
 
       case REB_TEXT:
@@ -189,9 +446,27 @@ uint32_t Hash_Value(const RELVAL *v)
       case REB_URL:
       case REB_TAG:
       case REB_ISSUE: {  // ISSUE! heart may be REB_BYTES, VAL_UTF8_X handles
+        REBLEN len;
         REBSIZ size;
-        REBCHR(const*) utf8 = VAL_UTF8_SIZE_AT(&size, cell);
-        hash = Hash_UTF8_Caseless(utf8, size);
+        REBCHR(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, &size, cell);
+
+        if (CELL_HEART(cell) == REB_BYTES) {  // data in cell, nothing to cache
+            hash = Hash_UTF8_Caseless(utf8, len);
+            break;
+        }
+
+        const REBSER *s = VAL_SERIES(cell);
+        REBLEN index = VAL_INDEX(cell);
+        struct Reb_Hash_Cache_Entry *entry = Hash_Cache_Entry(s, index, size);
+        if (entry and Is_Hash_Cache_Hit(entry, s, index, true)) {
+            hash = entry->hash;
+            assert(hash == Hash_UTF8_Caseless(utf8, len));
+            break;
+        }
+
+        hash = Hash_UTF8_Caseless(utf8, len);
+        if (entry)
+            Cache_Hash(entry, s, index, true, hash);
         break; }
 
       case REB_TUPLE:
@@ -359,14 +634,43 @@ uint32_t Hash_Value(const RELVAL *v)
 REBSER *Make_Hash_Series(REBLEN len)
 {
     REBLEN n = Get_Hash_Prime_May_Fail(len * 2);  // best when 2X # of keys
-    REBSER *ser = Make_Series(n + 1, FLAG_FLAVOR(HASHLIST));
+    REBSER *ser = Make_Series(Hash_Series_Capacity(n), FLAG_FLAVOR(HASHLIST));
     Clear_Series(ser);
     SET_SERIES_LEN(ser, n);
+    ser->misc.zombies = 0;  // only maintained for MAP! (see %sys-map.h)
 
     return ser;
 }
 
 
+//
+//  Copy_Hash_Series: C
+//
+// Copy_Series_Core() would only copy the slots, not the control bytes that
+// come after them (see HASHLIST_CONTROLS()).
+//
+REBSER *Copy_Hash_Series(REBSER *hashlist, REBFLGS flags)
+{
+    REBLEN n = SER_USED(hashlist);
+    REBSER *copy = Make_Series(
+        Hash_Series_Capacity(n),
+        FLAG_FLAVOR(HASHLIST) | flags
+    );
+    Clear_Series(copy);
+    SET_SERIES_LEN(copy, n);
+
+    memcpy(
+        SER_HEAD(REBLEN, copy),
+        SER_HEAD(REBLEN, hashlist),
+        n * sizeof(REBLEN)
+    );
+    memcpy(HASHLIST_CONTROLS(copy), HASHLIST_CONTROLS(hashlist), n);
+    copy->misc.zombies = hashlist->misc.zombies;
+
+    return copy;
+}
+
+
 //
 //  Init_Map: C
 //
@@ -459,6 +763,426 @@ REBSER *Hash_Block(const REBVAL *block, REBLEN skip, bool cased)
 }
 
 
+//=//// CRC-32, CRC-32C, AND ADLER-32 ////////////////////////////////////=//
+//
+// zlib's crc32_z() and adler32_z() go through the data with table lookups
+// and byte loops.  CPU instructions for these checksums make them run about
+// as fast as memory can be read, so Checksum_CRC32(), Checksum_CRC32C() and
+// Checksum_Adler32() use them when Startup_CRC() finds the CPU has them:
+//
+// * x86: CRC-32 by "folding" 64 bytes at a time with carry-less multiplies
+//   (PCLMULQDQ), per Intel's paper "Fast CRC Computation for Generic
+//   Polynomials Using PCLMULQDQ Instruction".  CRC-32C with the SSE4.2 CRC32
+//   instruction.  Adler-32 32 bytes at a time with SSSE3, using PSADBW for
+//   the plain sum and PMADDUBSW to weight the bytes for the running sum.
+//
+// * ARM64: CRC-32 and CRC-32C with the ARMv8 CRC32 instructions, and
+//   Adler-32 with NEON.
+//
+// They get the same answers as the portable code, so the choice doesn't
+// matter to anything but speed.  (zlib itself still uses its own crc32()
+// internally for gzip, since %u-zlib.c is generated from zlib's sources.)
+//
+// !!! Detecting the CPU at runtime is only done for GCC and Clang on x86.
+// MSVC builds and ARM64 builds not targeting ARMv8 CRC get the portable
+// code (or NEON, which every ARM64 has).
+//
+
+#if (defined(__x86_64__) || defined(__i386__)) \
+        && (defined(__GNUC__) || defined(__clang__))
+    #define CHECKSUM_X86
+    #include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #define CHECKSUM_ARM64
+    #include <arm_neon.h>
+    #if defined(__ARM_FEATURE_CRC32)
+        #include <arm_acle.h>
+    #endif
+#endif
+
+#define ADLER_BASE 65521  // largest prime below 2^16
+#define ADLER_NMAX 5552  // most bytes before the sums could overflow 32 bits
+
+typedef uint32_t (Checksum_Fn)(uint32_t crc, const REBYTE *data, REBSIZ size);
+
+static uint32_t Crc32c_Table[256];
+
+
+static uint32_t Crc32_Portable(uint32_t crc, const REBYTE *data, REBSIZ size)
+{
+    return crc32_z(crc, data, size);
+}
+
+static uint32_t Crc32c_Portable(uint32_t crc, const REBYTE *data, REBSIZ size)
+{
+    crc = ~crc;
+    for (; size != 0; --size, ++data)
+        crc = Crc32c_Table[(crc ^ *data) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static uint32_t Adler32_Portable(
+    uint32_t adler,
+    const REBYTE *data,
+    REBSIZ size
+){
+    return adler32_z(adler, data, size);
+}
+
+
+// Finish up an Adler-32 a byte at a time (after the vector loop)
+//
+static uint32_t Adler32_Tail(
+    uint32_t s1,
+    uint32_t s2,
+    const REBYTE *data,
+    REBSIZ size
+){
+    while (size != 0) {
+        REBSIZ n = size < ADLER_NMAX ? size : ADLER_NMAX;
+        size -= n;
+        for (; n != 0; --n, ++data) {
+            s1 += *data;
+            s2 += s1;
+        }
+        s1 %= ADLER_BASE;
+        s2 %= ADLER_BASE;
+    }
+    return (s2 << 16) | s1;
+}
+
+
+#if defined(CHECKSUM_X86)
+
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t Crc32_Pclmul(uint32_t crc, const REBYTE *data, REBSIZ size)
+{
+    if (size < 64)
+        return crc32_z(crc, data, size);
+
+    // Constants for the bit-reflected CRC-32 polynomial from the paper:
+    // x^(4*128+64) and x^(4*128) mod P to fold 512 bits, the same for 128
+    // bits, x^64 mod P for the last 64, and then P and mu for the Barrett
+    // reduction to 32 bits.
+    //
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i low32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_loadu_si128(cast(const __m128i*, data));
+    __m128i x2 = _mm_loadu_si128(cast(const __m128i*, data + 16));
+    __m128i x3 = _mm_loadu_si128(cast(const __m128i*, data + 32));
+    __m128i x4 = _mm_loadu_si128(cast(const __m128i*, data + 48));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(~crc));
+    data += 64;
+    size -= 64;
+
+    while (size >= 64) {  // fold 4 x 128 bits into the next 64 bytes
+        __m128i y1 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        __m128i y2 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        __m128i y3 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        __m128i y4 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, y1),
+            _mm_loadu_si128(cast(const __m128i*, data)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, y2),
+            _mm_loadu_si128(cast(const __m128i*, data + 16)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, y3),
+            _mm_loadu_si128(cast(const __m128i*, data + 32)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, y4),
+            _mm_loadu_si128(cast(const __m128i*, data + 48)));
+        data += 64;
+        size -= 64;
+    }
+
+    // Fold the four down to one 128 bits, then take 16 bytes at a time
+
+    __m128i y;
+    y = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), y);
+    y = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), y);
+    y = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), y);
+
+    while (size >= 16) {
+        y = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, y),
+            _mm_loadu_si128(cast(const __m128i*, data)));
+        data += 16;
+        size -= 16;
+    }
+
+    // Fold 128 bits to 64, then Barrett reduce to 32
+
+    y = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), y);
+    y = _mm_srli_si128(x1, 4);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, low32), k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, y);
+
+    y = _mm_clmulepi64_si128(_mm_and_si128(x1, low32), poly, 0x10);
+    y = _mm_clmulepi64_si128(_mm_and_si128(y, low32), poly, 0x00);
+    x1 = _mm_xor_si128(x1, y);
+
+    crc = ~cast(uint32_t, _mm_extract_epi32(x1, 1));
+    return crc32_z(crc, data, size);  // less than 16 bytes left
+}
+
+__attribute__((target("sse4.2")))
+static uint32_t Crc32c_Sse42(uint32_t crc, const REBYTE *data, REBSIZ size)
+{
+    crc = ~crc;
+  #if defined(__x86_64__)
+    uint64_t crc64 = crc;
+    for (; size >= 8; size -= 8, data += 8) {
+        uint64_t u;
+        memcpy(&u, data, 8);  // unaligned
+        crc64 = _mm_crc32_u64(crc64, u);
+    }
+    crc = cast(uint32_t, crc64);
+  #else
+    for (; size >= 4; size -= 4, data += 4) {
+        uint32_t u;
+        memcpy(&u, data, 4);
+        crc = _mm_crc32_u32(crc, u);
+    }
+  #endif
+    for (; size != 0; --size, ++data)
+        crc = _mm_crc32_u8(crc, *data);
+    return ~crc;
+}
+
+__attribute__((target("ssse3")))
+static uint32_t Adler32_Ssse3(uint32_t adler, const REBYTE *data, REBSIZ size)
+{
+    uint32_t s1 = adler & 0xFFFF;
+    uint32_t s2 = adler >> 16;
+
+    // Each 32 bytes adds their sum to s1, and to s2 adds 32 times s1 from
+    // before them plus the bytes weighted 32, 31, ... 1.  The sums are
+    // reduced every NMAX bytes, as in zlib.
+    //
+    const __m128i weights_hi = _mm_setr_epi8(
+        32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17
+    );
+    const __m128i weights_lo = _mm_setr_epi8(
+        16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+    );
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i zero = _mm_setzero_si128();
+
+    REBSIZ blocks = size / 32;
+    size -= blocks * 32;
+
+    while (blocks != 0) {
+        REBSIZ n = blocks < ADLER_NMAX / 32 ? blocks : ADLER_NMAX / 32;
+        blocks -= n;
+
+        __m128i v_prior = _mm_cvtsi32_si128(s1 * n);  // s1 sums, before
+        __m128i v_s1 = zero;
+        __m128i v_s2 = _mm_cvtsi32_si128(s2);
+
+        for (; n != 0; --n, data += 32) {
+            __m128i a = _mm_loadu_si128(cast(const __m128i*, data));
+            __m128i b = _mm_loadu_si128(cast(const __m128i*, data + 16));
+
+            v_prior = _mm_add_epi32(v_prior, v_s1);
+
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(a, zero));
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(b, zero));
+
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(
+                _mm_maddubs_epi16(a, weights_hi), ones
+            ));
+            v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(
+                _mm_maddubs_epi16(b, weights_lo), ones
+            ));
+        }
+
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_prior, 5));
+
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, 0xB1));
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, 0x4E));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, 0xB1));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, 0x4E));
+
+        s1 = (s1 + cast(uint32_t, _mm_cvtsi128_si32(v_s1))) % ADLER_BASE;
+        s2 = cast(uint32_t, _mm_cvtsi128_si32(v_s2)) % ADLER_BASE;
+    }
+
+    return Adler32_Tail(s1, s2, data, size);
+}
+
+#elif defined(CHECKSUM_ARM64)
+
+#if defined(__ARM_FEATURE_CRC32)
+
+static uint32_t Crc32_Arm(uint32_t crc, const REBYTE *data, REBSIZ size)
+{
+    crc = ~crc;
+    for (; size >= 8; size -= 8, data += 8) {
+        uint64_t u;
+        memcpy(&u, data, 8);  // unaligned
+        crc = __crc32d(crc, u);
+    }
+    for (; size != 0; --size, ++data)
+        crc = __crc32b(crc, *data);
+    return ~crc;
+}
+
+static uint32_t Crc32c_Arm(uint32_t crc, const REBYTE *data, REBSIZ size)
+{
+    crc = ~crc;
+    for (; size >= 8; size -= 8, data += 8) {
+        uint64_t u;
+        memcpy(&u, data, 8);
+        crc = __crc32cd(crc, u);
+    }
+    for (; size != 0; --size, ++data)
+        crc = __crc32cb(crc, *data);
+    return ~crc;
+}
+
+#endif
+
+static uint32_t Adler32_Neon(uint32_t adler, const REBYTE *data, REBSIZ size)
+{
+    uint32_t s1 = adler & 0xFFFF;
+    uint32_t s2 = adler >> 16;
+
+    // Same scheme as the SSSE3 version: 32 bytes at a time, with the byte
+    // sums kept in 16-bit lanes per column and weighted at the end of each
+    // NMAX run of bytes.
+    //
+    static const uint16_t weights[32] = {
+        32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+        16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+    };
+
+    REBSIZ blocks = size / 32;
+    size -= blocks * 32;
+
+    while (blocks != 0) {
+        REBSIZ n = blocks < ADLER_NMAX / 32 ? blocks : ADLER_NMAX / 32;
+        blocks -= n;
+
+        uint32x4_t v_prior = vdupq_n_u32(0);
+        uint32x4_t v_s1 = vdupq_n_u32(0);
+        uint16x8_t col_0 = vdupq_n_u16(0);  // column sums of the bytes
+        uint16x8_t col_1 = vdupq_n_u16(0);
+        uint16x8_t col_2 = vdupq_n_u16(0);
+        uint16x8_t col_3 = vdupq_n_u16(0);
+
+        uint32_t s1_before = s1 * n;
+
+        for (; n != 0; --n, data += 32) {
+            uint8x16_t a = vld1q_u8(data);
+            uint8x16_t b = vld1q_u8(data + 16);
+
+            v_prior = vaddq_u32(v_prior, v_s1);
+            v_s1 = vpadalq_u16(v_s1, vpadalq_u8(vpaddlq_u8(a), b));
+
+            col_0 = vaddw_u8(col_0, vget_low_u8(a));
+            col_1 = vaddw_u8(col_1, vget_high_u8(a));
+            col_2 = vaddw_u8(col_2, vget_low_u8(b));
+            col_3 = vaddw_u8(col_3, vget_high_u8(b));
+        }
+
+        uint32x4_t v_s2 = vshlq_n_u32(v_prior, 5);
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col_0), vld1_u16(weights + 0));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col_0), vld1_u16(weights + 4));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col_1), vld1_u16(weights + 8));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col_1), vld1_u16(weights + 12));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col_2), vld1_u16(weights + 16));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col_2), vld1_u16(weights + 20));
+        v_s2 = vmlal_u16(v_s2, vget_low_u16(col_3), vld1_u16(weights + 24));
+        v_s2 = vmlal_u16(v_s2, vget_high_u16(col_3), vld1_u16(weights + 28));
+
+        s2 = (s2 + (s1_before << 5) + vaddvq_u32(v_s2)) % ADLER_BASE;
+        s1 = (s1 + vaddvq_u32(v_s1)) % ADLER_BASE;
+    }
+
+    return Adler32_Tail(s1, s2, data, size);
+}
+
+#endif
+
+
+static Checksum_Fn *Crc32_Fn = &Crc32_Portable;
+static Checksum_Fn *Crc32c_Fn = &Crc32c_Portable;
+static Checksum_Fn *Adler32_Fn = &Adler32_Portable;
+
+
+// Build the CRC-32C table, and pick the fastest versions this CPU can run.
+//
+static void Startup_Checksums(void)
+{
+    uint32_t i;
+    for (i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        int k;
+        for (k = 0; k < 8; ++k)
+            c = (c & 1) ? (c >> 1) ^ 0x82F63B78 : c >> 1;  // reflected poly
+        Crc32c_Table[i] = c;
+    }
+
+  #if defined(CHECKSUM_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("pclmul") and __builtin_cpu_supports("sse4.1"))
+        Crc32_Fn = &Crc32_Pclmul;
+    if (__builtin_cpu_supports("sse4.2"))
+        Crc32c_Fn = &Crc32c_Sse42;
+    if (__builtin_cpu_supports("ssse3"))
+        Adler32_Fn = &Adler32_Ssse3;
+  #elif defined(CHECKSUM_ARM64)
+    #if defined(__ARM_FEATURE_CRC32)
+      Crc32_Fn = &Crc32_Arm;
+      Crc32c_Fn = &Crc32c_Arm;
+    #endif
+    Adler32_Fn = &Adler32_Neon;
+  #endif
+}
+
+
+//
+//  Checksum_CRC32: C
+//
+// The CRC-32 of gzip, zip, and PNG.  Like zlib's crc32_z(), pass 0 as the
+// `crc` to start, or the CRC of the data before to continue it.
+//
+uint32_t Checksum_CRC32(uint32_t crc, const REBYTE *data, REBSIZ size)
+  { return (*Crc32_Fn)(crc, data, size); }
+
+
+//
+//  Checksum_CRC32C: C
+//
+// The Castagnoli CRC-32 of iSCSI, ext4, SCTP and others (better at finding
+// errors than CRC-32, with the same size).  Pass 0 as the `crc` to start.
+//
+uint32_t Checksum_CRC32C(uint32_t crc, const REBYTE *data, REBSIZ size)
+  { return (*Crc32c_Fn)(crc, data, size); }
+
+
+//
+//  Checksum_Adler32: C
+//
+// The Adler-32 of the zlib envelope.  Pass 1 as the `adler` to start.
+//
+uint32_t Checksum_Adler32(uint32_t adler, const REBYTE *data, REBSIZ size)
+  { return (*Adler32_Fn)(adler, data, size); }
+
+
 //
 //  Compute_IPC: C
 //
@@ -494,13 +1218,21 @@ REBINT Compute_IPC(const REBYTE *data, REBSIZ size)
 // Return a 32-bit hash value for the bytes.
 //
 REBINT Hash_Bytes(const REBYTE *data, REBLEN len) {
-    uint32_t crc = 0x00000000;
+    return cast(REBINT, Fold_Hash_32(Hash64_Bytes(data, len, PG_Hash_Seed)));
+}
 
-    REBLEN n;
-    for (n = 0; n != len; ++n)
-        crc = (crc >> 8) ^ crc32_table[(crc ^ data[n]) & 0xff];
 
-    return cast(REBINT, ~crc);
+//
+//  Hash64_Bytes: C
+//
+// The full 64-bit hash of the bytes, with the given seed (see Hash_Bytes()
+// for the seed used internally).
+//
+uint64_t Hash64_Bytes(const REBYTE *data, REBSIZ size, uint64_t seed) {
+    struct Reb_Hasher h;
+    Init_Hasher(&h, seed);
+    Hash_Feed(&h, data, size);
+    return Finish_Hasher(&h);
 }
 
 
@@ -514,6 +1246,34 @@ void Startup_CRC(void)
     // table is precompiled-in.
     //
     crc32_table = get_crc_table();
+
+    Startup_Checksums();
+
+    // The hash seed should be hard to guess from outside.  There's no
+    // portable source of randomness in C, so mix the clock with addresses
+    // (which vary from run to run on systems with address randomization).
+    //
+    REBYTE entropy[24];
+    REBI64 nanoseconds = Startup_Clock_Nanoseconds();
+    uintptr_t stack = cast(uintptr_t, &nanoseconds);
+    uintptr_t data = cast(uintptr_t, &PG_Hash_Seed);
+    memset(entropy, 0, sizeof(entropy));
+    memcpy(entropy, &nanoseconds, sizeof(nanoseconds));
+    memcpy(entropy + 8, &stack, sizeof(stack));
+    memcpy(entropy + 16, &data, sizeof(data));
+    PG_Hash_Seed = Hash64_Bytes(
+        entropy, sizeof(entropy), cast(uint64_t, clock())
+    );
+
+    TG_Hash_Cache = TRY_ALLOC_N_ZEROFILL(
+        struct Reb_Hash_Cache_Entry, HASH_CACHE_SIZE
+    );
+    TG_Hash_Cache_Generation = 0;
+
+    TG_Map_Migrations = 0;  // counters for STATS/MAPS, see %t-map.c
+    TG_Map_Records_Migrated = 0;
+    TG_Map_Compactions = 0;
+    TG_Map_Zombies_Removed = 0;
 }
 
 
@@ -524,4 +1284,6 @@ void Shutdown_CRC(void)
 {
     // Zlib's DYNAMIC_CRC_TABLE uses a global array, that is not malloc()'d,
     // so nothing to free.
+
+    FREE_N(struct Reb_Hash_Cache_Entry, HASH_CACHE_SIZE, TG_Hash_Cache);
 }
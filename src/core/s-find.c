@@ -97,6 +97,16 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBSIZ l2)
     REBSIZ l1 = strsize(s1);
     REBINT result = 0;
 
+    // Spellings are often the same, so skip whatever exactly matches in the
+    // ASCII runs up front.  (Only exact matches, as they don't affect the
+    // `result` for the non-case match.)
+    //
+    REBLEN same = Ascii_Match_Len(s1, s2, MIN(l1, l2), true);
+    s1 += same;
+    s2 += same;
+    l1 -= same;
+    l2 -= same;
+
     for (; l1 > 0 && l2 > 0; s1++, s2++, l1--, l2--) {
         c1 = *s1;
         c2 = *s2;
@@ -124,6 +134,300 @@ REBINT Compare_UTF8(const REBYTE *s1, const REBYTE *s2, REBSIZ l2)
 }
 
 
+//=//// BYTEWISE SUBSTRING SEARCH //////////////////////////////////////////=//
+//
+// Most searches are forward scans for a pattern whose matches can be decided
+// byte-for-byte, and those don't need Find_Binstr_In_Binstr()'s general loop
+// that decodes and compares a codepoint at a time:
+//
+// * Case-sensitive, since a valid UTF-8 pattern can only match valid UTF-8
+//   at a codepoint boundary.  (This is also true when a BINARY! is searched
+//   for a string, where the general loop decodes the binary as UTF-8.)
+//
+// * Caseless, when the pattern is ASCII and has no characters that some
+//   non-ASCII character lowercases to (see Ascii_Unicode_Folds).  Then the
+//   only caseless equivalences are the ASCII letters, and any byte >= 0x80
+//   in the searched data is a mismatch.
+//
+// Short patterns are found by testing the first and last byte of the pattern
+// at many positions at once, with SSE2, AVX2, or (64-bit) NEON when they are
+// available, like the scanner does.  Only positions where both bytes agree
+// get compared in full.  Long patterns use Boyer-Moore-Horspool, since they
+// get to skip over most of the data.
+//
+
+#define FIND_HORSPOOL_MIN 32  // patterns at least this long use Horspool
+
+#if !defined(__GNUC__)  // uses __builtin_ctz() (clang defines __GNUC__ too)
+    #define FIND_SCALAR
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+
+    #define FIND_CHUNK 32
+    #define FIND_BIT_WIDTH 1  // mask bits per byte
+    typedef __m256i FindVec;
+    typedef uint32_t FindBits;
+
+    #define FIND_LOAD(p)    _mm256_loadu_si256(cast(const __m256i*, (p)))
+    #define FIND_SPLAT(c)   _mm256_set1_epi8(cast(char, c))
+    #define FIND_EQ(v,w)    _mm256_cmpeq_epi8((v), (w))
+    #define FIND_OR(a,b)    _mm256_or_si256((a), (b))
+    #define FIND_AND(a,b)   _mm256_and_si256((a), (b))
+    #define FIND_BITS(v)    cast(FindBits, _mm256_movemask_epi8(v))
+    #define FIND_CTZ(bits)  __builtin_ctz(bits)
+    #define FIND_ALL_BITS   0xFFFFFFFFu
+
+    #define FIND_SHUFFLE  // has 16-entry byte table lookups
+    #define FIND_ZERO       _mm256_setzero_si256()
+    #define FIND_TABLE(p) \
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(cast(const __m128i*, (p))))
+    #define FIND_LOOKUP16(table,idx)  _mm256_shuffle_epi8((table), (idx))
+    #define FIND_HIGH_NIBBLES(v) \
+        _mm256_and_si256(_mm256_srli_epi16((v), 4), FIND_SPLAT(0x0F))
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+
+    #define FIND_CHUNK 16
+    #define FIND_BIT_WIDTH 1
+    typedef __m128i FindVec;
+    typedef uint32_t FindBits;  // only low 16 bits used
+
+    #define FIND_LOAD(p)    _mm_loadu_si128(cast(const __m128i*, (p)))
+    #define FIND_SPLAT(c)   _mm_set1_epi8(cast(char, c))
+    #define FIND_EQ(v,w)    _mm_cmpeq_epi8((v), (w))
+    #define FIND_OR(a,b)    _mm_or_si128((a), (b))
+    #define FIND_AND(a,b)   _mm_and_si128((a), (b))
+    #define FIND_BITS(v)    cast(FindBits, _mm_movemask_epi8(v))
+    #define FIND_CTZ(bits)  __builtin_ctz(bits)
+    #define FIND_ALL_BITS   0xFFFFu
+
+  #if defined(__SSSE3__)
+    #include <tmmintrin.h>
+
+    #define FIND_SHUFFLE
+    #define FIND_ZERO       _mm_setzero_si128()
+    #define FIND_TABLE(p)   _mm_loadu_si128(cast(const __m128i*, (p)))
+    #define FIND_LOOKUP16(table,idx)  _mm_shuffle_epi8((table), (idx))
+    #define FIND_HIGH_NIBBLES(v) \
+        _mm_and_si128(_mm_srli_epi16((v), 4), FIND_SPLAT(0x0F))
+  #endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+
+    // As in the scanner, narrowing the compare result gives a nibble per byte
+    // in place of a "movemask".
+    //
+    #define FIND_CHUNK 16
+    #define FIND_BIT_WIDTH 4
+    typedef uint8x16_t FindVec;
+    typedef uint64_t FindBits;
+
+    #define FIND_LOAD(p)    vld1q_u8(p)
+    #define FIND_SPLAT(c)   vdupq_n_u8(c)
+    #define FIND_EQ(v,w)    vceqq_u8((v), (w))
+    #define FIND_OR(a,b)    vorrq_u8((a), (b))
+    #define FIND_AND(a,b)   vandq_u8((a), (b))
+    #define FIND_BITS(v) \
+        vget_lane_u64(vreinterpret_u64_u8( \
+            vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0)
+    #define FIND_CTZ(bits)  __builtin_ctzll(bits)
+    #define FIND_ALL_BITS   0xFFFFFFFFFFFFFFFFull
+
+    #define FIND_SHUFFLE
+    #define FIND_ZERO       vdupq_n_u8(0)
+    #define FIND_TABLE(p)   vld1q_u8(p)
+    #define FIND_LOOKUP16(table,idx)  vqtbl1q_u8((table), (idx))
+    #define FIND_HIGH_NIBBLES(v)  vshrq_n_u8((v), 4)
+#else
+    #define FIND_SCALAR
+#endif
+
+
+inline static REBYTE Fold_Ascii(REBYTE b)
+  { return (b >= 'A' and b <= 'Z') ? b + ('a' - 'A') : b; }
+
+inline static REBYTE Other_Case_Ascii(REBYTE b) {
+    if (b >= 'A' and b <= 'Z')
+        return b + ('a' - 'A');
+    if (b >= 'a' and b <= 'z')
+        return b - ('a' - 'A');
+    return b;
+}
+
+
+// Caseless comparison is as Compare_Ascii_Uncased() does it, except that the
+// data may have non-ASCII bytes (which can't match the ASCII pattern).
+//
+static bool Bytes_Match(
+    const REBYTE *cp,
+    const REBYTE *pattern,
+    REBSIZ size,
+    bool caseless
+){
+    if (not caseless)
+        return memcmp(cp, pattern, size) == 0;
+
+    REBSIZ n;
+    for (n = 0; n != size; ++n) {
+        if (Fold_Ascii(cp[n]) != Fold_Ascii(pattern[n]))
+            return false;
+    }
+    return true;
+}
+
+
+// `last` is the last position in the data where a match could start.
+//
+static const REBYTE *Find_Bytes_Filtered(
+    const REBYTE *cp,
+    const REBYTE *last,
+    const REBYTE *pattern,
+    REBSIZ size,
+    bool caseless
+){
+    REBYTE first1 = pattern[0];
+    REBYTE first2 = caseless ? Other_Case_Ascii(first1) : first1;
+
+  #if !defined(FIND_SCALAR)
+    REBYTE last1 = pattern[size - 1];
+    REBYTE last2 = caseless ? Other_Case_Ascii(last1) : last1;
+
+    FindVec f1 = FIND_SPLAT(first1);
+    FindVec f2 = FIND_SPLAT(first2);
+    FindVec l1 = FIND_SPLAT(last1);
+    FindVec l2 = FIND_SPLAT(last2);
+
+    // Loading the chunk that ends at the last byte a match could use is the
+    // furthest the loads go, so they never read outside of the data.
+    //
+    for (; last - cp >= FIND_CHUNK - 1; cp += FIND_CHUNK) {
+        FindVec heads = FIND_LOAD(cp);
+        FindVec tails = FIND_LOAD(cp + size - 1);
+        FindBits bits = FIND_BITS(FIND_AND(
+            FIND_OR(FIND_EQ(heads, f1), FIND_EQ(heads, f2)),
+            FIND_OR(FIND_EQ(tails, l1), FIND_EQ(tails, l2))
+        ));
+        while (bits != 0) {
+            REBLEN i = FIND_CTZ(bits) / FIND_BIT_WIDTH;
+            if (Bytes_Match(cp + i, pattern, size, caseless))
+                return cp + i;
+            bits &= ~(
+                ((cast(FindBits, 1) << FIND_BIT_WIDTH) - 1)
+                    << (i * FIND_BIT_WIDTH)
+            );
+        }
+    }
+  #endif
+
+    for (; cp <= last; ++cp) {
+        if (
+            (*cp == first1 or *cp == first2)
+            and Bytes_Match(cp, pattern, size, caseless)
+        ){
+            return cp;
+        }
+    }
+    return nullptr;
+}
+
+
+static const REBYTE *Find_Bytes_Horspool(
+    const REBYTE *cp,
+    const REBYTE *last,
+    const REBYTE *pattern,
+    REBSIZ size,
+    bool caseless
+){
+    REBSIZ shift[256];  // how far to move when the byte under the tail is...
+
+    REBLEN b;
+    for (b = 0; b != 256; ++b)
+        shift[b] = size;
+
+    REBSIZ n;
+    for (n = 0; n != size - 1; ++n) {
+        shift[pattern[n]] = size - 1 - n;
+        if (caseless)
+            shift[Other_Case_Ascii(pattern[n])] = size - 1 - n;
+    }
+
+    REBYTE tail = Fold_Ascii(pattern[size - 1]);
+    while (cp <= last) {
+        REBYTE t = cp[size - 1];
+        if (
+            (t == pattern[size - 1] or (caseless and Fold_Ascii(t) == tail))
+            and Bytes_Match(cp, pattern, size - 1, caseless)
+        ){
+            return cp;
+        }
+        if (cast(REBSIZ, last - cp) < shift[t])
+            break;
+        cp += shift[t];
+    }
+    return nullptr;
+}
+
+
+// Give back if caseless searching for the pattern can be done bytewise.
+//
+static bool Is_Pattern_Ascii_Foldable(const REBYTE *pattern, REBSIZ size)
+{
+    REBSIZ n;
+    for (n = 0; n != size; ++n) {
+        if (pattern[n] >= 0x80 or Ascii_Unicode_Folds[Fold_Ascii(pattern[n])])
+            return false;
+    }
+    return true;
+}
+
+
+// Search forward from the binstr1 position to its tail.  Results are as
+// Find_Binstr_In_Binstr() would give.
+//
+static REBLEN Find_Bytes_In_Binstr(
+    REBLEN *len_out,
+    REBCEL(const*) binstr1,
+    const REBYTE *pattern,
+    REBSIZ size,
+    REBLEN window1,
+    bool caseless
+){
+    bool is_1_str = (CELL_KIND(binstr1) != REB_BINARY);
+
+    const REBYTE *cp;
+    REBSIZ size_at;
+    if (is_1_str)
+        cp = VAL_UTF8_SIZE_AT(&size_at, binstr1);
+    else
+        cp = VAL_BINARY_SIZE_AT(&size_at, binstr1);
+
+    if (size_at < size)
+        return NOT_FOUND;
+
+    const REBYTE *last = cp + (size_at - size);
+    const REBYTE *found;
+    if (size >= FIND_HORSPOOL_MIN)
+        found = Find_Bytes_Horspool(cp, last, pattern, size, caseless);
+    else
+        found = Find_Bytes_Filtered(cp, last, pattern, size, caseless);
+
+    if (not found)
+        return NOT_FOUND;
+
+    *len_out = window1;
+
+    REBLEN index1 = VAL_INDEX(binstr1);
+    if (not is_1_str)
+        return index1 + cast(REBLEN, found - cp);
+
+    const REBSTR *str1 = VAL_STRING(binstr1);
+    if (Is_Definitely_Ascii(str1))  // bytes are codepoints
+        return index1 + cast(REBLEN, found - cp);
+
+    return index1 + Num_Codepoints_For_Bytes(cp, found);
+}
+
+
 //
 //  Find_Binstr_In_Binstr: C
 //
@@ -190,6 +494,25 @@ REBLEN Find_Binstr_In_Binstr(
     //
     REBLEN window1 = is_1_str ? len2 : size2;
 
+    // A forward FIND with no /PART or /MATCH (e.g. from PARSE's TO and THRU)
+    // can usually be done bytewise, which is much faster.
+    //
+    if (
+        skip1 == 1
+        and not (flags & AM_FIND_MATCH)
+        and (
+            CELL_KIND(binstr1) == REB_BINARY
+            or ANY_STRING_KIND(CELL_KIND(binstr1))  // not ISSUE! or words
+        )
+        and end1_unsigned == VAL_LEN_HEAD(binstr1)
+    ){
+        bool caseless_bytes = is_2_str and not (flags & AM_FIND_CASE);
+        if (not caseless_bytes or Is_Pattern_Ascii_Foldable(head2, size2))
+            return Find_Bytes_In_Binstr(
+                len_out, binstr1, head2, size2, window1, caseless_bytes
+            );
+    }
+
     // Signed quantities allow stepping outside of bounds (e.g. large /SKIP)
     // and still comparing...but incoming parameters should not be negative.
     //
@@ -405,6 +728,182 @@ REBLEN Find_Binstr_In_Binstr(
     return NOT_FOUND;
 }
 
+// Bitsets can hold any codepoint, and FIND's test of a character is done by
+// Check_Bit(), which folds case through the Unicode tables and heeds the
+// negated flag on every call.  When scanning forward over a lot of data, it
+// pays to first work out the answer for every byte value:
+//
+// * For BINARY!, that is the full answer.  (Note that caseless FIND on a
+//   BINARY! folds bytes as if they were Latin-1 codepoints, and that's kept.)
+//
+// * For strings, only ASCII bytes are answered by the table.  All bytes from
+//   0x80 up are marked, so scanning stops on them and the codepoint they
+//   start is checked with Check_Bit().
+//
+// With 16-entry table lookups in vectors ("shuffles"), a byte can be tested
+// for being in an arbitrary set of 256 by splitting it into nibbles.  The low
+// nibble picks a byte whose bits say which high nibbles are in the set for
+// it, and the high nibble picks which of those bits to test.  It takes two
+// such pairs of lookups, one for the high nibbles 0-7 and one for 8-F.
+//
+// This isn't cached on the bitset.  It's cheap enough to build compared to
+// a scan that it's worth doing (see FIND_BITSET_TABLE_MIN), and the bitset
+// series has no spare slot to keep it in if it had to be kept up to date.
+//
+#define FIND_BITSET_TABLE_MIN 64  // units of search before building tables
+
+struct Reb_Byte_Class {
+    bool has[256];
+    REBYTE low_0_7[16];  // by low nibble: bits for high nibbles 0-7 in set
+    REBYTE low_8_F[16];  // by low nibble: bits for high nibbles 8-F in set
+};
+
+static const REBYTE High_Bits_0_7[16] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const REBYTE High_Bits_8_F[16] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+};
+
+
+// Gives the same answers as Check_Bit(bset, b, uncase) for each byte `b`,
+// except that for strings the non-ASCII bytes are all in the class.
+//
+static void Init_Byte_Class(
+    struct Reb_Byte_Class *bc,
+    const REBBIN *bset,
+    bool uncase,
+    bool is_str
+){
+    const REBYTE *bits = BIN_HEAD(bset);
+    REBLEN size = BIN_LEN(bset);
+    bool negated = BITS_NOT(bset);
+
+    REBLEN n;
+    for (n = 0; n < 256; ++n) {
+        bool has;
+        if (n >= 0x80) {
+            if (is_str)
+                has = true;  // stop to decode the codepoint
+            else if (uncase)
+                has = Check_Bit(bset, n, true);  // Latin-1 case folding
+            else {
+                has = (n >> 3) < size
+                    and (bits[n >> 3] & (1 << (7 - (n & 7))));
+                has = (has != negated);
+            }
+        }
+        else {
+            REBLEN other = uncase ? Other_Case_Ascii(cast(REBYTE, n)) : n;
+            has = (
+                ((n >> 3) < size and (bits[n >> 3] & (1 << (7 - (n & 7)))))
+                or ((other >> 3) < size
+                    and (bits[other >> 3] & (1 << (7 - (other & 7)))))
+            );
+            has = (has != negated);
+        }
+        bc->has[n] = has;
+    }
+
+    memset(bc->low_0_7, 0, sizeof(bc->low_0_7));
+    memset(bc->low_8_F, 0, sizeof(bc->low_8_F));
+    for (n = 0; n < 256; ++n) {
+        if (not bc->has[n])
+            continue;
+        if (n < 0x80)
+            bc->low_0_7[n & 0x0F] |= 1 << (n >> 4);
+        else
+            bc->low_8_F[n & 0x0F] |= 1 << ((n >> 4) - 8);
+    }
+}
+
+
+// Gives the first byte in [cp, tail) that is in the class, or `tail`.
+//
+static const REBYTE *Seek_Byte_Class(
+    const struct Reb_Byte_Class *bc,
+    const REBYTE *cp,
+    const REBYTE *tail
+){
+  #if defined(FIND_SHUFFLE)
+    FindVec low_0_7 = FIND_TABLE(bc->low_0_7);
+    FindVec low_8_F = FIND_TABLE(bc->low_8_F);
+    FindVec high_0_7 = FIND_TABLE(High_Bits_0_7);
+    FindVec high_8_F = FIND_TABLE(High_Bits_8_F);
+
+    for (; tail - cp >= FIND_CHUNK; cp += FIND_CHUNK) {
+        FindVec v = FIND_LOAD(cp);
+        FindVec low = FIND_AND(v, FIND_SPLAT(0x0F));
+        FindVec high = FIND_HIGH_NIBBLES(v);
+        FindVec in = FIND_OR(
+            FIND_AND(
+                FIND_LOOKUP16(low_0_7, low), FIND_LOOKUP16(high_0_7, high)
+            ),
+            FIND_AND(
+                FIND_LOOKUP16(low_8_F, low), FIND_LOOKUP16(high_8_F, high)
+            )
+        );
+        FindBits bits = FIND_BITS(FIND_EQ(in, FIND_ZERO)) ^ FIND_ALL_BITS;
+        if (bits != 0)
+            return cp + FIND_CTZ(bits) / FIND_BIT_WIDTH;
+    }
+  #endif
+
+    for (; cp != tail; ++cp) {
+        if (bc->has[*cp])
+            break;
+    }
+    return cp;
+}
+
+
+// Forward search with a skip of 1, for Find_Bitset_In_Binstr().
+//
+static REBLEN Find_Bitset_Forward(
+    REBCEL(const*) binstr,
+    REBLEN end,
+    const REBBIN *bset,
+    bool uncase
+){
+    REBLEN index = VAL_INDEX(binstr);
+
+    struct Reb_Byte_Class bc;
+
+    if (CELL_KIND(binstr) == REB_BINARY) {
+        Init_Byte_Class(&bc, bset, uncase, false);
+
+        const REBYTE *head = BIN_HEAD(VAL_BINARY(binstr));
+        const REBYTE *cp = Seek_Byte_Class(&bc, head + index, head + end);
+        if (cp == head + end)
+            return NOT_FOUND;
+        return cp - head;
+    }
+
+    Init_Byte_Class(&bc, bset, uncase, true);
+
+    const REBYTE *cp = cast(const REBYTE*, VAL_STRING_AT(binstr));
+    const REBYTE *tail = cast(const REBYTE*, VAL_STRING_TAIL(binstr));
+
+    while (index < end) {
+        const REBYTE *stop = Seek_Byte_Class(&bc, cp, tail);
+        index += stop - cp;  // skipped bytes were all ASCII codepoints
+        if (index >= end)
+            break;
+
+        if (*stop < 0x80)
+            return index;  // table has the answer for ASCII
+
+        REBUNI c;
+        cp = cast(const REBYTE*, NEXT_CHR(&c, cast(REBCHR(const*), stop)));
+        if (Check_Bit(bset, c, uncase))
+            return index;
+        ++index;
+    }
+
+    return NOT_FOUND;
+}
+
 
 //
 //  Find_Bitset_In_Binstr: C
@@ -440,6 +939,17 @@ REBLEN Find_Bitset_In_Binstr(
 
     bool uncase = not (flags & AM_FIND_CASE); // case insensitive
 
+    if (
+        skip == 1
+        and not (flags & AM_FIND_MATCH)
+        and index + FIND_BITSET_TABLE_MIN <= end
+    ){
+        REBLEN found = Find_Bitset_Forward(binstr, end, bset, uncase);
+        if (found != NOT_FOUND)
+            *len_out = 1;  // see note below on length always being 1
+        return found;
+    }
+
     bool is_str = (CELL_KIND(binstr) != REB_BINARY);
 
     const REBYTE *cp1 = is_str ? VAL_STRING_AT(binstr) : VAL_BINARY_AT(binstr);
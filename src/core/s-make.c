@@ -292,70 +292,77 @@ REBSTR *Append_UTF8_May_Fail(
     // * It's needed to know how many characters (length) are in the series,
     //   not just how many bytes.  The higher level concept of "length" gets
     //   stored in the series MISC() field.
-    // * In the future, some operations will be accelerated by knowing that
-    //   a string only contains ASCII codepoints.
+    // * Bulk validation and copying is much faster than doing it one
+    //   codepoint at a time, so the data is checked in a first pass that
+    //   raises any errors before `dst` is touched.
 
     const REBYTE *bp = cb_cast(utf8);
+    const REBYTE *end = bp + size;
 
-    DECLARE_MOLD (mo); // !!! REVIEW: don't need intermediate if no CRLF_TO_LF
-    Push_Mold(mo);
+    REBLEN num_codepoints;
+    const REBYTE *bad = Seek_Invalid_Utf8(&num_codepoints, bp, end);
 
-    bool all_ascii = true;
-    REBLEN num_codepoints = 0;
-
-    REBSIZ bytes_left = size; // see remarks on Back_Scan_UTF8_Char's 3rd arg
-    for (; bytes_left > 0; --bytes_left, ++bp) {
-        REBUNI c = *bp;
-        if (c >= 0x80) {
-            bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
-            if (bp == NULL)
-                fail (Error_Bad_Utf8_Raw()); // !!! Should Back_Scan() fail?
-
-            all_ascii = false;
-        }
-        else if (Should_Skip_Ascii_Byte_May_Fail(
-            bp,
-            strmode,
-            cast(const REBYTE*, utf8)
-        )){
-            continue;
-        }
-
-        ++num_codepoints;
-        Append_Codepoint(mo->series, c);
+    // Errors are raised for whichever problem comes first in the data, so
+    // the NUL and CR bytes before any invalid sequence are screened before
+    // complaining about it.  CRs that the mode drops are counted.
+    //
+    REBLEN num_skips = 0;
+    const REBYTE *special = bp;
+    while ((special = Seek_Nul_Or_Cr(special, bad)) != bad) {
+        if (Should_Skip_Ascii_Byte_May_Fail(special, strmode, bp))
+            ++num_skips;
+        ++special;
     }
 
-    UNUSED(all_ascii);
+    if (bad != end)
+        fail (Error_Bad_Utf8_Raw());  // !!! Report the position?
 
-    // !!! The implicit nature of this is probably not the best way of
-    // handling things, but... if the series we were supposed to be appending
-    // to was the mold buffer, that's what we just did.  Consider making this
-    // a specific call for Mold_Utf8() or similar.
-    //
-    if (dst == mo->series)
-        return dst;
+    REBSIZ old_size;
+    REBLEN old_len;
 
-    if (not dst)
-        return Pop_Molded_String(mo);
+    if (not dst) {
+        dst = Make_String(size - num_skips);
+        old_size = 0;
+        old_len = 0;
+    }
+    else {
+        old_size = STR_SIZE(dst);
+        old_len = STR_LEN(dst);
 
-    REBLEN old_len = STR_LEN(dst);
-    REBSIZ old_size = STR_SIZE(dst);
+        // The data could be from `dst` itself, which may move when expanded.
+        //
+        const REBYTE *head = BIN_HEAD(dst);
+        if (bp >= head and bp <= head + old_size) {
+            REBSIZ offset = bp - head;
+            EXPAND_SERIES_TAIL(dst, size - num_skips);
+            bp = BIN_AT(dst, offset);
+            end = bp + size;
+        }
+        else
+            EXPAND_SERIES_TAIL(dst, size - num_skips);
+    }
 
-    EXPAND_SERIES_TAIL(dst, size);
-    memcpy(
-        BIN_AT(dst, old_size),
-        BIN_AT(mo->series, mo->offset),
-        STR_SIZE(mo->series) - mo->offset
-    );
+    REBYTE *dest = BIN_AT(dst, old_size);
+    if (num_skips == 0)
+        memmove(dest, bp, size);  // may overlap if appending to itself
+    else {
+        while (true) {  // copy runs between the CRs to be dropped
+            special = Seek_Nul_Or_Cr(bp, end);
+            memmove(dest, bp, special - bp);
+            dest += special - bp;
+            if (special == end)
+                break;
+            if (not Should_Skip_Ascii_Byte_May_Fail(special, strmode, bp))
+                *dest++ = *special;  // e.g. CR that isn't before an LF
+            bp = special + 1;
+        }
+    }
 
     TERM_STR_LEN_SIZE(
         dst,
-        old_len + num_codepoints,
-        old_size + STR_SIZE(mo->series) - mo->offset
+        old_len + num_codepoints - num_skips,
+        old_size + size - num_skips
     );
-
-    Drop_Mold(mo);
-
     return dst;
 }
 
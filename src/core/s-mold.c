@@ -91,9 +91,12 @@
 // techniques might use an invalid UTF-8 character as an end-of-buffer signal
 // and notice it during writes, how END markers are used by the data stack.
 //
+// After writing, the caller must set the actual length and size with
+// TERM_STR_LEN_SIZE().
+//
 REBYTE *Prep_Mold_Overestimated(REB_MOLD *mo, REBLEN num_bytes)
 {
-    REBLEN tail = STR_LEN(mo->series);
+    REBSIZ tail = STR_SIZE(mo->series);
     EXPAND_SERIES_TAIL(mo->series, num_bytes);  // terminates at guess
     return BIN_AT(mo->series, tail);
 }
@@ -286,6 +289,7 @@ void Mold_Array_At(
         first_item = false;
 
         Mold_Value(mo, item);
+        Flush_Mold(mo);
 
         ++item;
         if (item == item_tail)
@@ -335,6 +339,7 @@ void Form_Array_At(
                 item = wval;
         }
         Mold_Or_Form_Value(mo, item, wval == nullptr);
+        Flush_Mold(mo);
         n++;
         if (GET_MOLD_FLAG(mo, MOLD_FLAG_LINES)) {
             Append_Codepoint(mo->series, LF);
@@ -491,6 +496,144 @@ REBSTR *Copy_Mold_Or_Form_Cell(REBCEL(const*) cell, REBFLGS opts, bool form)
 }
 
 
+// The fast path of Form_Reduce_Throws() is for blocks whose items need no
+// evaluation: TEXT! and ISSUE! literals, BLANK!s, and WORD!s whose variables
+// hold TEXT! or ISSUE!.  (A word that looks up to an action could be enfix,
+// so anything else means the block has to be evaluated.)  The item's cell to
+// form is given back, or nullptr if the fast path can't be used.
+//
+static const RELVAL *Literal_Form_Item(const RELVAL *item, REBSPC *specifier)
+{
+    enum Reb_Kind kind = VAL_TYPE(item);
+    if (kind == REB_TEXT or kind == REB_ISSUE or kind == REB_BLANK)
+        return item;
+
+    if (kind != REB_WORD)
+        return nullptr;
+
+    const REBVAL *var = try_unwrap(Lookup_Word(item, specifier));
+    if (var and (IS_TEXT(var) or IS_ISSUE(var)))
+        return var;
+    return nullptr;
+}
+
+
+// Form a block of literals (see Literal_Form_Item()) with the same rules as
+// the evaluating path, but in two passes: the first sizes the result, and
+// the second copies the UTF-8 into it.  So the result (or the INTO string)
+// is expanded once, and the mold buffer isn't used.
+//
+static bool Did_Form_Literals(
+    REBVAL *out,
+    option(REBSTR*) into,
+    const REBARR *array,
+    REBLEN index,
+    REBSPC *specifier,
+    const REBVAL *delimiter
+){
+    REBLEN delimiter_len = 0;
+    REBSIZ delimiter_size = 0;
+    if (not IS_NULLED(delimiter))
+        VAL_UTF8_LEN_SIZE_AT(&delimiter_len, &delimiter_size, delimiter);
+
+    REBLEN len = 0;
+    REBSIZ size = 0;
+    bool pending = false;
+    bool nothing = true;
+
+    const RELVAL *tail = ARR_TAIL(array);
+    const RELVAL *item = ARR_AT(array, index);
+    for (; item != tail; ++item) {
+        const RELVAL *v = Literal_Form_Item(item, specifier);
+        if (not v)
+            return false;
+
+        nothing = false;
+        if (IS_BLANK(v)) {  // only literal BLANK! gets here, it's a space
+            len += 1;
+            size += 1;
+            pending = false;
+            continue;
+        }
+
+        REBLEN v_len;
+        REBSIZ v_size;
+        VAL_UTF8_LEN_SIZE_AT(&v_len, &v_size, v);
+        len += v_len;
+        size += v_size;
+
+        if (IS_ISSUE(v))
+            pending = false;
+        else if (not IS_NULLED(delimiter)) {
+            if (pending) {
+                len += delimiter_len;
+                size += delimiter_size;
+            }
+            pending = true;
+        }
+    }
+
+    if (nothing) {
+        Init_Nulled(out);
+        return true;
+    }
+
+    REBSTR *s;
+    REBLEN old_len;
+    REBSIZ old_size;
+    if (into) {
+        s = unwrap(into);
+        old_len = STR_LEN(s);
+        old_size = STR_SIZE(s);
+        Expand_Series(s, old_size, size);  // series USED changes too
+    }
+    else {
+        s = Make_String(size);
+        old_len = 0;
+        old_size = 0;
+    }
+
+    // Pointers into the items are gotten after the expansion, as one of them
+    // may be the INTO string.  (Its size was taken before, so only what it
+    // had then is copied.)
+    //
+    REBYTE *dest = BIN_AT(s, old_size);
+    pending = false;
+    for (item = ARR_AT(array, index); item != tail; ++item) {
+        const RELVAL *v = Literal_Form_Item(item, specifier);
+        if (IS_BLANK(v)) {
+            *dest++ = ' ';
+            pending = false;
+            continue;
+        }
+
+        if (not IS_ISSUE(v) and not IS_NULLED(delimiter)) {
+            if (pending) {
+                memcpy(dest, VAL_UTF8_AT(delimiter), delimiter_size);
+                dest += delimiter_size;
+            }
+            pending = true;
+        }
+        else if (IS_ISSUE(v))
+            pending = false;
+
+        REBSIZ v_size;
+        REBCHR(const*) utf8 = VAL_UTF8_SIZE_AT(&v_size, v);
+        memcpy(dest, utf8, v_size);
+        dest += v_size;
+    }
+    assert(dest == BIN_AT(s, old_size + size));
+
+    TERM_STR_LEN_SIZE(s, old_len + len, old_size + size);
+
+    if (into)
+        Init_Blank(out);  // caller gives back the INTO string
+    else
+        Init_Text(out, s);
+    return true;
+}
+
+
 //
 //  Form_Reduce_Throws: C
 //
@@ -505,17 +648,24 @@ REBSTR *Copy_Mold_Or_Form_Cell(REBCEL(const*) cell, REBFLGS opts, bool form)
 //
 // Note only the last interstitial is considered a candidate for delimiting.
 //
+// If INTO is given, the result is appended to it instead of being made as a
+// new TEXT!, and `out` is set to BLANK! (or NULL if there was nothing).
+//
 bool Form_Reduce_Throws(
     REBVAL *out,
     const REBARR *array,
     REBLEN index,
     REBSPC *specifier,
-    const REBVAL *delimiter
+    const REBVAL *delimiter,
+    option(REBSTR*) into
 ){
     assert(
         IS_NULLED(delimiter) or IS_CHAR(delimiter) or IS_TEXT(delimiter)
     );
 
+    if (Did_Form_Literals(out, into, array, index, specifier, delimiter))
+        return false;
+
     DECLARE_MOLD (mo);
     Push_Mold(mo);
 
@@ -580,8 +730,22 @@ bool Form_Reduce_Throws(
         }
     } while (NOT_END(f->feed->value));
 
-    if (nothing)
+    if (nothing) {
+        Drop_Mold(mo);
         Init_Nulled(out);
+    }
+    else if (into) {
+        REBSTR *s = unwrap(into);
+        REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+        REBLEN len = STR_LEN(mo->series) - mo->index;
+        REBLEN old_len = STR_LEN(s);
+        REBSIZ old_size = STR_SIZE(s);
+        Expand_Series(s, old_size, size);  // series USED changes too
+        memcpy(BIN_AT(s, old_size), BIN_AT(mo->series, mo->offset), size);
+        TERM_STR_LEN_SIZE(s, old_len + len, old_size + size);
+        Drop_Mold(mo);
+        Init_Blank(out);
+    }
     else
         Init_Text(out, Pop_Molded_String(mo));
 
@@ -711,6 +875,48 @@ void Throttle_Mold(REB_MOLD *mo) {
 }
 
 
+//
+//  Flush_Mold: C
+//
+// A mold with a sink does not build up all of its output in the mold buffer.
+// Once there are more than MAX_COMMON bytes since the Push_Mold(), they are
+// handed to the sink as a BINARY!: a PORT! gets them via WRITE, an ACTION!
+// is called with them.  So memory use is bounded by the biggest single item
+// in the arrays being molded, not by the size of the whole output.
+//
+// This is only called between the items of an array, since code in the mold
+// hooks may remember positions in the buffer (or look back at what was just
+// output).  The last codepoint is kept for the sake of lookbacks, such as
+// MF_Comma() turning a trailing space into a comma.
+//
+void Flush_Mold(REB_MOLD *mo)
+{
+    if (mo->sink == nullptr)
+        return;
+
+    REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+    if (size <= MAX_COMMON)
+        return;
+
+    REBYTE *head = BIN_AT(mo->series, mo->offset);
+    REBSIZ keep = 1;
+    while (keep < size and Is_Continuation_Byte_If_Utf8(head[size - keep]))
+        ++keep;
+
+    REBBIN *bin = Make_Binary(size - keep);
+    memcpy(BIN_HEAD(bin), head, size - keep);
+    TERM_BIN_LEN(bin, size - keep);
+
+    memmove(head, head + size - keep, keep);
+    TERM_STR_LEN_SIZE(mo->series, mo->index + 1, mo->offset + keep);
+
+    if (IS_ACTION(mo->sink))
+        rebElide(rebQ(mo->sink), rebR(Init_Binary(Alloc_Value(), bin)));
+    else
+        rebElide("write", mo->sink, rebR(Init_Binary(Alloc_Value(), bin)));
+}
+
+
 //
 //  Pop_Molded_String: C
 //
@@ -733,6 +939,25 @@ REBSTR *Pop_Molded_String(REB_MOLD *mo)
     REBSIZ size = STR_SIZE(mo->series) - mo->offset;
     REBLEN len = STR_LEN(mo->series) - mo->index;
 
+    // A big mold that started at the head of the buffer has it to itself, so
+    // the buffer can give its data allocation to the result instead of it
+    // being copied.  The buffer starts over with a small allocation.  The
+    // Push_Mold() backed the buffer off to near empty, so the slack riding
+    // along with the result is just from expansions during this mold.
+    //
+    if (
+        mo->offset == 0
+        and size > MAX_COMMON
+        and SER_REST(mo->series) <= 2 * (size + 1)
+    ){
+        REBSTR *popped = Make_String_Core(MIN_COMMON, SERIES_FLAG_DYNAMIC);
+        Swap_Series_Content(popped, mo->series);  // length, bookmarks too
+        assert(STR_LEN(popped) == len and STR_SIZE(popped) == size);
+
+        mo->series = nullptr;  // indicates mold is not currently pushed
+        return popped;
+    }
+
     REBSTR *popped = Make_String(size);
     memcpy(BIN_HEAD(popped), BIN_AT(mo->series, mo->offset), size);
     TERM_STR_LEN_SIZE(popped, len, size);
@@ -173,33 +173,29 @@ void Change_Case(
     // be possible, only contractions (is that true?)  Review when UTF-8
     // Everywhere is more mature to the point this is worth worrying about.
     //
+    // Runs of ASCII are changed in bulk.  Each byte of such a run is a
+    // codepoint, and there are at least `len` bytes for `len` codepoints, so
+    // the run can't go past the end of the part.
+    //
     REBCHR(*) up = VAL_STRING_AT_ENSURE_MUTABLE(val);
     REBCHR(*) dp;
-    if (upper) {
-        REBLEN n;
-        for (n = 0; n < len; n++) {
-            dp = up;
-
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            if (c < UNICODE_CASES) {
-                dp = WRITE_CHR(dp, UP_CASE(c));
-                assert(dp == up); // !!! not all case changes same byte size?
-            }
-        }
-    }
-    else {
-        REBLEN n;
-        for (n = 0; n < len; n++) {
-            dp = up;
-
-            REBUNI c;
-            up = NEXT_CHR(&c, up);
-            if (c < UNICODE_CASES) {
-                dp = WRITE_CHR(dp, LO_CASE(c));
-                assert(dp == up); // !!! not all case changes same byte size?
-            }
+    while (len > 0) {
+        REBYTE *ascii = cast(REBYTE*, up);
+        REBYTE *stop = Change_Case_Ascii(ascii, ascii + len, upper);
+        len -= stop - ascii;
+        up = cast(REBCHR(*), stop);
+        if (len == 0)
+            break;
+
+        dp = up;
+
+        REBUNI c;
+        up = NEXT_CHR(&c, up);
+        if (c < UNICODE_CASES) {
+            dp = WRITE_CHR(dp, upper ? UP_CASE(c) : LO_CASE(c));
+            assert(dp == up); // !!! not all case changes same byte size?
         }
+        --len;
     }
 }
 
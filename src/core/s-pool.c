@@ -0,0 +1,285 @@
+//
+//  File: %s-pool.c
+//  Summary: "Sharing one series among equal frozen strings"
+//  Section: strings
+//  Project: "Ren-C Language Interpreter and Run-time Environment"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the GNU Lesser General Public License (LGPL), Version 3.0.
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Loaded data often has the same short strings over and over (country codes,
+// status values, the names of categories...) with each TEXT! in a series of
+// its own.  A frozen string can't change, so any number of values can share
+// one series for it instead.  Pool_String() gives back the series to use for
+// a frozen string, from a table of the frozen strings pooled so far.
+//
+// Pooling is opt-in, since it means the strings have to be frozen.  It is
+// done by DEDUP, TRANSCODE/DEDUP, and by the ODBC extension if asked.
+//
+// The table doesn't keep the strings alive.  Pooled strings have
+// STRING_FLAG_POOLED, so that Decay_Series() knows to take them out of the
+// table when they are freed.  The table is open-addressed, and entries after
+// the removed one are moved back, so there are no tombstones.  When nothing
+// is pooled the table is freed.
+//
+// Symbols are already interned, and long strings are rarely equal (while
+// costing more to hash and compare), so neither is pooled.
+//
+
+#include "sys-core.h"
+
+#define POOLED_STRING_MAX_SIZE 256  // bytes, longer strings aren't pooled
+
+struct Reb_Pooled_String {
+    const REBSTR *str;  // nullptr if the slot is empty
+    uint32_t hash;
+};
+
+
+static REBLEN Pooled_String_Home(uint32_t hash)
+  { return hash & (TG_Pooled_String_Capacity - 1); }
+
+
+static bool Is_Pooled_String_Equal(
+    const REBSTR *pooled,
+    const REBYTE *utf8,
+    REBSIZ size
+){
+    return STR_SIZE(pooled) == size
+        and memcmp(STR_HEAD(pooled), utf8, size) == 0;
+}
+
+
+// Double the table (or make the first one).  If the allocation fails, the
+// table is left as it was.
+//
+static bool Did_Grow_Pooled_Strings(void)
+{
+    REBLEN old_capacity = TG_Pooled_String_Capacity;
+    struct Reb_Pooled_String *old_pool = TG_Pooled_Strings;
+
+    REBLEN capacity = old_capacity == 0 ? 64 : old_capacity * 2;
+    struct Reb_Pooled_String *pool = TRY_ALLOC_N_ZEROFILL(
+        struct Reb_Pooled_String, capacity
+    );
+    if (pool == nullptr)
+        return false;
+
+    TG_Pooled_Strings = pool;
+    TG_Pooled_String_Capacity = capacity;
+
+    REBLEN mask = capacity - 1;
+    REBLEN n;
+    for (n = 0; n < old_capacity; ++n) {
+        if (not old_pool[n].str)
+            continue;
+        REBLEN slot = Pooled_String_Home(old_pool[n].hash);
+        while (pool[slot].str)
+            slot = (slot + 1) & mask;
+        pool[slot] = old_pool[n];
+    }
+    if (old_capacity != 0)
+        FREE_N(struct Reb_Pooled_String, old_capacity, old_pool);
+
+    return true;
+}
+
+
+//
+//  Pool_String: C
+//
+// Give back the pooled string with the same content as the frozen string
+// `s`, pooling `s` itself (and managing it) if there isn't one yet.  If `s`
+// can't be pooled it is given back as it is.
+//
+// A caller that gets back a different string than it gave can free its own
+// if it was unmanaged (as the scanner does with the strings it makes).
+//
+const REBSTR *Pool_String(const REBSTR *s)
+{
+    assert(Is_Series_Frozen(s));
+
+    if (not IS_NONSYMBOL_STRING(s) or GET_SERIES_FLAG(s, SHARED_HEAP))
+        return s;
+    if (GET_SUBCLASS_FLAG(STRING, s, POOLED))
+        return s;
+
+    REBSIZ size = STR_SIZE(s);
+    if (size > POOLED_STRING_MAX_SIZE)
+        return s;
+
+    if ((TG_Num_Pooled_Strings + 1) * 2 > TG_Pooled_String_Capacity) {
+        if (
+            not Did_Grow_Pooled_Strings()
+            and TG_Num_Pooled_Strings + 1 >= TG_Pooled_String_Capacity
+        ){
+            return s;  // full, and keep an empty slot so lookups can stop
+        }
+    }
+
+    const REBYTE *utf8 = STR_HEAD(s);
+    uint32_t hash = cast(uint32_t, Hash_Bytes(utf8, size));
+
+    REBLEN mask = TG_Pooled_String_Capacity - 1;
+    REBLEN slot = Pooled_String_Home(hash);
+    for (; TG_Pooled_Strings[slot].str; slot = (slot + 1) & mask) {
+        struct Reb_Pooled_String *entry = &TG_Pooled_Strings[slot];
+        if (
+            entry->hash == hash
+            and Is_Pooled_String_Equal(entry->str, utf8, size)
+        ){
+            return entry->str;
+        }
+    }
+
+    Force_Series_Managed(m_cast(REBSTR*, s));
+    SET_SUBCLASS_FLAG(STRING, m_cast(REBSTR*, s), POOLED);
+
+    TG_Pooled_Strings[slot].str = s;
+    TG_Pooled_Strings[slot].hash = hash;
+    ++TG_Num_Pooled_Strings;
+
+    return s;
+}
+
+
+//
+//  Unpool_String: C
+//
+// Called by Decay_Series() for strings with STRING_FLAG_POOLED.
+//
+void Unpool_String(REBSTR *s)
+{
+    CLEAR_SUBCLASS_FLAG(STRING, s, POOLED);
+
+    if (TG_Pooled_String_Capacity == 0)
+        return;
+
+    uint32_t hash = cast(uint32_t, Hash_Bytes(STR_HEAD(s), STR_SIZE(s)));
+
+    REBLEN mask = TG_Pooled_String_Capacity - 1;
+    REBLEN slot = Pooled_String_Home(hash);
+    while (TG_Pooled_Strings[slot].str != s) {
+        if (not TG_Pooled_Strings[slot].str)
+            return;  // e.g. flag was copied along with others, no entry
+        slot = (slot + 1) & mask;
+    }
+
+    REBLEN hole = slot;
+    REBLEN n = slot;
+    while (true) {
+        n = (n + 1) & mask;
+        if (not TG_Pooled_Strings[n].str)
+            break;
+
+        REBLEN home = Pooled_String_Home(TG_Pooled_Strings[n].hash);
+        bool stays = (hole <= n)
+            ? (hole < home and home <= n)
+            : (hole < home or home <= n);
+        if (stays)
+            continue;
+
+        TG_Pooled_Strings[hole] = TG_Pooled_Strings[n];
+        hole = n;
+    }
+    TG_Pooled_Strings[hole].str = nullptr;
+
+    if (--TG_Num_Pooled_Strings == 0) {
+        FREE_N(
+            struct Reb_Pooled_String,
+            TG_Pooled_String_Capacity,
+            TG_Pooled_Strings
+        );
+        TG_Pooled_Strings = nullptr;
+        TG_Pooled_String_Capacity = 0;
+    }
+}
+
+
+//
+//  Dedup_String_Value: C
+//
+// Freeze the string of an ANY-STRING! value and make it use the pooled one.
+// The value's position in the string is kept.
+//
+void Dedup_String_Value(RELVAL *v)
+{
+    assert(ANY_STRING(v));
+
+    const REBSTR *s = VAL_STRING(v);
+    if (not IS_NONSYMBOL_STRING(s) or GET_SERIES_FLAG(s, SHARED_HEAP))
+        return;
+
+    Freeze_Series(s);
+    const REBSTR *pooled = Pool_String(s);
+    if (pooled != s)
+        INIT_VAL_NODE1(v, pooled);
+}
+
+
+// Dedup the strings in an array and the arrays in it.  Arrays that are read
+// only are left alone.  Arrays are colored black as they are visited, so
+// that cycles end--the caller must Uncolor() when done.
+//
+static void Dedup_Array_Deep(REBARR *a)
+{
+    if (Is_Series_Black(a) or Is_Series_Read_Only(a))
+        return;
+
+    Flip_Series_To_Black(a);
+    GC_Write_Barrier(a);  // strings in it may be changed to older ones
+
+    RELVAL *tail = ARR_TAIL(a);
+    RELVAL *v = ARR_HEAD(a);
+    for (; v != tail; ++v) {
+        if (ANY_STRING(v))
+            Dedup_String_Value(v);
+        else if (ANY_ARRAY(v))
+            Dedup_Array_Deep(m_cast(REBARR*, VAL_ARRAY(v)));
+    }
+}
+
+
+//
+//  dedup: native [
+//
+//  {LOCK strings, and have equal ones share one series to save memory}
+//
+//      return: "Same value, changed in place if an array"
+//          [any-string! any-array!]
+//      value "Strings in arrays (and in arrays in those) are all done"
+//          [any-string! any-array!]
+//  ]
+//
+REBNATIVE(dedup)
+//
+// `dedup "abc"` gives back a frozen "abc" that is the same series as the
+// last "abc" that was deduplicated, if that is still alive.  For data that
+// has a lot of repeated strings (e.g. rows of records), the copies can then
+// be freed by the GC.
+{
+    INCLUDE_PARAMS_OF_DEDUP;
+
+    REBVAL *v = ARG(value);
+
+    if (ANY_STRING(v))
+        Dedup_String_Value(v);
+    else {
+        Dedup_Array_Deep(VAL_ARRAY_ENSURE_MUTABLE(v));
+        Uncolor(v);
+    }
+
+    RETURN (v);
+}
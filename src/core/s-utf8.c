@@ -0,0 +1,406 @@
+//
+//  File: %s-utf8.c
+//  Summary: "bulk UTF-8 validation and codepoint counting"
+//  Section: strings
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Data coming from files, the network, or the API as BINARY! has to be
+// checked for being legal UTF-8 before it can become a string.  Doing that
+// with Back_Scan_UTF8_Char() is fine for the odd non-ASCII character, but
+// when megabytes arrive at once the per-byte decoding adds up.
+//
+// The routines here validate and count codepoints a vector at a time:
+//
+// * With AVX2 or SSSE3, multi-byte sequences are checked using the "lookup"
+//   method of Keiser and Lemire ("Validating UTF-8 In Less Than One
+//   Instruction Per Byte", 2020).  Each byte's high nibble and its
+//   predecessor's nibbles index 16-entry tables of error classes, which are
+//   ANDed together so that only the combinations in an actual error survive.
+//
+// * With only SSE2 or (64-bit) NEON, runs of ASCII are skipped a vector at
+//   a time, and the rest is checked a sequence at a time.
+//
+// Either way the scalar check with isLegalUTF8() is the final word.  When a
+// vector says there's an error somewhere in it, the scalar code rescans it
+// to find which byte to report.  So vector code only needs to find *that*
+// there's a problem, which keeps it simple.
+//
+// Unlike the scanner, these may be given data that's not NUL-terminated, so
+// they only do unaligned loads that are fully in bounds.
+//
+
+#include "sys-core.h"
+
+
+#if !defined(__GNUC__)  // uses __builtin_ctz() (clang defines __GNUC__ too)
+    #define UTF8_SCALAR
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+
+    #define UTF8_CHUNK 32
+    #define UTF8_LOOKUP  // vector validation of multi-byte sequences
+    typedef __m256i Utf8Vec;
+
+    #define UTF8_LOAD(p)    _mm256_loadu_si256(cast(const __m256i*, (p)))
+    #define UTF8_ZERO       _mm256_setzero_si256()
+    #define UTF8_SPLAT(c)   _mm256_set1_epi8(cast(char, (c)))
+    #define UTF8_EQ(v,w)    _mm256_cmpeq_epi8((v), (w))
+    #define UTF8_OR(a,b)    _mm256_or_si256((a), (b))
+    #define UTF8_AND(a,b)   _mm256_and_si256((a), (b))
+    #define UTF8_XOR(a,b)   _mm256_xor_si256((a), (b))
+    #define UTF8_SUBS(a,b)  _mm256_subs_epu8((a), (b))
+    #define UTF8_LT(a,b)    _mm256_cmpgt_epi8((b), (a))  // signed
+    #define UTF8_HIGH_NIBBLES(v) \
+        _mm256_and_si256(_mm256_srli_epi16((v), 4), UTF8_SPLAT(0x0F))
+    #define UTF8_LOW_NIBBLES(v) \
+        _mm256_and_si256((v), UTF8_SPLAT(0x0F))
+    #define UTF8_LOOKUP16(table,idx)  _mm256_shuffle_epi8((table), (idx))
+    #define UTF8_TABLE(...) \
+        _mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)  // same in both lanes
+    #define UTF8_BITS(v)    cast(uint32_t, _mm256_movemask_epi8(v))
+    #define UTF8_ALL_BITS   0xFFFFFFFFu
+
+    // Shift `v` so each byte sees the one N before it, pulling the bytes at
+    // the end of `prev` in at the start.
+    //
+    #define UTF8_PREV(v,prev,n) \
+        _mm256_alignr_epi8( \
+            (v), _mm256_permute2x128_si256((prev), (v), 0x21), 16 - (n) \
+        )
+#elif defined(__SSSE3__)
+    #include <tmmintrin.h>
+
+    #define UTF8_CHUNK 16
+    #define UTF8_LOOKUP
+    typedef __m128i Utf8Vec;
+
+    #define UTF8_LOAD(p)    _mm_loadu_si128(cast(const __m128i*, (p)))
+    #define UTF8_ZERO       _mm_setzero_si128()
+    #define UTF8_SPLAT(c)   _mm_set1_epi8(cast(char, (c)))
+    #define UTF8_EQ(v,w)    _mm_cmpeq_epi8((v), (w))
+    #define UTF8_OR(a,b)    _mm_or_si128((a), (b))
+    #define UTF8_AND(a,b)   _mm_and_si128((a), (b))
+    #define UTF8_XOR(a,b)   _mm_xor_si128((a), (b))
+    #define UTF8_SUBS(a,b)  _mm_subs_epu8((a), (b))
+    #define UTF8_LT(a,b)    _mm_cmplt_epi8((a), (b))  // signed
+    #define UTF8_HIGH_NIBBLES(v) \
+        _mm_and_si128(_mm_srli_epi16((v), 4), UTF8_SPLAT(0x0F))
+    #define UTF8_LOW_NIBBLES(v) \
+        _mm_and_si128((v), UTF8_SPLAT(0x0F))
+    #define UTF8_LOOKUP16(table,idx)  _mm_shuffle_epi8((table), (idx))
+    #define UTF8_TABLE(...) \
+        _mm_setr_epi8(__VA_ARGS__)
+    #define UTF8_BITS(v)    cast(uint32_t, _mm_movemask_epi8(v))
+    #define UTF8_ALL_BITS   0xFFFFu
+
+    #define UTF8_PREV(v,prev,n) \
+        _mm_alignr_epi8((v), (prev), 16 - (n))
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+
+    #define UTF8_CHUNK 16
+    typedef __m128i Utf8Vec;
+
+    #define UTF8_LOAD(p)    _mm_loadu_si128(cast(const __m128i*, (p)))
+    #define UTF8_SPLAT(c)   _mm_set1_epi8(cast(char, (c)))
+    #define UTF8_EQ(v,w)    _mm_cmpeq_epi8((v), (w))
+    #define UTF8_OR(a,b)    _mm_or_si128((a), (b))
+    #define UTF8_BITS(v)    cast(uint32_t, _mm_movemask_epi8(v))
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+
+    // !!! NEON has the table lookups needed for the vector validation too,
+    // but only the ASCII run skipping is done here for now.
+    //
+    #define UTF8_CHUNK 16
+    #define UTF8_NEON
+    typedef uint8x16_t Utf8Vec;
+
+    #define UTF8_LOAD(p)    vld1q_u8(p)
+    #define UTF8_SPLAT(c)   vdupq_n_u8(c)
+    #define UTF8_EQ(v,w)    vceqq_u8((v), (w))
+    #define UTF8_OR(a,b)    vorrq_u8((a), (b))
+#else
+    #define UTF8_SCALAR
+#endif
+
+
+#if !defined(UTF8_SCALAR)
+
+// True if any of the bytes in `v` is 0x80 or above.
+//
+static inline bool Any_High_Bytes(Utf8Vec v) {
+  #if defined(UTF8_NEON)
+    return vmaxvq_u8(v) >= 0x80;
+  #else
+    return UTF8_BITS(v) != 0;  // movemask collects the high bits
+  #endif
+}
+
+// True if any of the bytes in `v` is a NUL or CR.
+//
+static inline bool Any_Nul_Or_Cr(Utf8Vec v) {
+    Utf8Vec hits = UTF8_OR(
+        UTF8_EQ(v, UTF8_SPLAT('\0')),
+        UTF8_EQ(v, UTF8_SPLAT(CR))
+    );
+  #if defined(UTF8_NEON)
+    return vmaxvq_u8(hits) != 0;
+  #else
+    return UTF8_BITS(hits) != 0;
+  #endif
+}
+
+#endif
+
+
+#if defined(UTF8_LOOKUP)
+
+// Error classes for the lookup tables.  A pair of bytes is in error if the
+// class survives the AND of what the first byte's high nibble, the first
+// byte's low nibble, and the second byte's high nibble each allow.
+//
+#define TOO_SHORT       (1 << 0)  // 11______ 0_______ or 11______ 11______
+#define TOO_LONG        (1 << 1)  // 0_______ 10______
+#define OVERLONG_3      (1 << 2)  // 11100000 100_____
+#define TOO_LARGE       (1 << 3)  // 11110100 1001____ (and above)
+#define SURROGATE       (1 << 4)  // 11101101 101_____
+#define OVERLONG_2      (1 << 5)  // 1100000_ 10______
+#define TOO_LARGE_1000  (1 << 6)  // 11110101 1000____ (and above)
+#define OVERLONG_4      (1 << 6)  // 11110000 1000____
+#define TWO_CONTS       (1 << 7)  // 10______ 10______ (unless expected)
+
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)  // low nibble is irrelevant
+
+// Gives a vector that is nonzero in any byte that's in an error, for the
+// sequences ending in `v` (which may have begun at the end of `prev`).  An
+// incomplete sequence at the end of `v` isn't an error yet; it's caught as
+// TOO_SHORT by the next call, or by the scalar code finishing up the tail.
+//
+static inline Utf8Vec Utf8_Errors(Utf8Vec v, Utf8Vec prev) {
+    Utf8Vec prev1 = UTF8_PREV(v, prev, 1);
+
+    Utf8Vec byte_1_high = UTF8_LOOKUP16(UTF8_TABLE(
+        // 0_______ ________ <ASCII in byte 1>
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+        // 10______ ________ <continuation in byte 1>
+        TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+        // 1100____ ________ <two byte lead in byte 1>
+        TOO_SHORT | OVERLONG_2,
+        // 1101____ ________ <two byte lead in byte 1>
+        TOO_SHORT,
+        // 1110____ ________ <three byte lead in byte 1>
+        TOO_SHORT | OVERLONG_3 | SURROGATE,
+        // 1111____ ________ <four+ byte lead in byte 1>
+        TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+    ), UTF8_HIGH_NIBBLES(prev1));
+
+    Utf8Vec byte_1_low = UTF8_LOOKUP16(UTF8_TABLE(
+        // ____0000 ________
+        CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+        // ____0001 ________
+        CARRY | OVERLONG_2,
+        // ____001_ ________
+        CARRY,
+        CARRY,
+        // ____0100 ________
+        CARRY | TOO_LARGE,
+        // ____0101 ________
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        // ____011_ ________
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        // ____1___ ________
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        // ____1101 ________
+        CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+        CARRY | TOO_LARGE | TOO_LARGE_1000,
+        CARRY | TOO_LARGE | TOO_LARGE_1000
+    ), UTF8_LOW_NIBBLES(prev1));
+
+    Utf8Vec byte_2_high = UTF8_LOOKUP16(UTF8_TABLE(
+        // ________ 0_______ <ASCII in byte 2>
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+        // ________ 1000____
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000
+            | OVERLONG_4,
+        // ________ 1001____
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+        // ________ 101_____
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+        TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+        // ________ 11______
+        TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+    ), UTF8_HIGH_NIBBLES(v));
+
+    Utf8Vec special = UTF8_AND(UTF8_AND(byte_1_high, byte_1_low), byte_2_high);
+
+    // A continuation byte two or three back from a 3 or 4 byte lead is what
+    // TWO_CONTS should *not* flag.  Saturating subtraction leaves the high
+    // bit set only in the positions that follow such leads, and XOR'ing it
+    // with `special` flags both unexpected pairs and missing continuations.
+    //
+    Utf8Vec is_third = UTF8_SUBS(UTF8_PREV(v, prev, 2), UTF8_SPLAT(0xE0 - 0x80));
+    Utf8Vec is_fourth = UTF8_SUBS(UTF8_PREV(v, prev, 3), UTF8_SPLAT(0xF0 - 0x80));
+    Utf8Vec must_23 = UTF8_AND(UTF8_OR(is_third, is_fourth), UTF8_SPLAT(0x80));
+
+    return UTF8_XOR(must_23, special);
+}
+
+#undef TOO_SHORT
+#undef TOO_LONG
+#undef OVERLONG_3
+#undef TOO_LARGE
+#undef SURROGATE
+#undef OVERLONG_2
+#undef TOO_LARGE_1000
+#undef OVERLONG_4
+#undef TWO_CONTS
+#undef CARRY
+
+static inline bool Any_Nonzero_Bytes(Utf8Vec v)
+  { return UTF8_BITS(UTF8_EQ(v, UTF8_ZERO)) != UTF8_ALL_BITS; }
+
+// Number of bytes in `v` that are not continuation bytes (0x80 to 0xBF).
+//
+static inline REBLEN Utf8_Leads(Utf8Vec v) {
+    Utf8Vec conts = UTF8_LT(v, UTF8_SPLAT(0xC0));  // signed, so 0x80-0xBF
+    return UTF8_CHUNK - __builtin_popcount(UTF8_BITS(conts));
+}
+
+#endif
+
+
+//
+//  Skip_Ascii_Utf8: C
+//
+// Give back the first byte at or after `bp` that isn't ASCII, or `end`.
+//
+const REBYTE *Skip_Ascii_Utf8(const REBYTE *bp, const REBYTE *end)
+{
+  #if !defined(UTF8_SCALAR)
+    for (; end - bp >= UTF8_CHUNK; bp += UTF8_CHUNK)
+        if (Any_High_Bytes(UTF8_LOAD(bp)))
+            break;  // finish with the byte loop
+  #endif
+
+    while (bp != end and *bp < 0x80)
+        ++bp;
+    return bp;
+}
+
+
+//
+//  Seek_Nul_Or_Cr: C
+//
+// Give back the first NUL or CR byte at or after `bp`, or `end`.  Those are
+// the bytes strings may not be able to take verbatim from valid UTF-8 data.
+//
+const REBYTE *Seek_Nul_Or_Cr(const REBYTE *bp, const REBYTE *end)
+{
+  #if !defined(UTF8_SCALAR)
+    for (; end - bp >= UTF8_CHUNK; bp += UTF8_CHUNK)
+        if (Any_Nul_Or_Cr(UTF8_LOAD(bp)))
+            break;
+  #endif
+
+    while (bp != end and *bp != '\0' and *bp != CR)
+        ++bp;
+    return bp;
+}
+
+
+//
+//  Seek_Invalid_Utf8: C
+//
+// Validate the UTF-8 from `bp` up to `end`.  Gives back a pointer to the
+// start of the first ill-formed sequence, or `end` if there wasn't one.  The
+// number of codepoints in the data before that point is written to `count`.
+//
+// What counts as ill-formed is the same as isLegalUTF8(): overlong forms,
+// surrogates, codepoints over 0x10FFFF, and stray or missing continuation
+// bytes.  A sequence that's cut off by `end` is also ill-formed.  NUL and
+// CR bytes are legal UTF-8, and callers must screen them if they need to.
+//
+const REBYTE *Seek_Invalid_Utf8(
+    REBLEN *count,
+    const REBYTE *bp,
+    const REBYTE *end
+){
+    const REBYTE *start = bp;
+    REBLEN num_codepoints = 0;
+
+  #if defined(UTF8_LOOKUP)
+    if (end - bp >= UTF8_CHUNK) {
+        Utf8Vec prev = UTF8_ZERO;  // as if preceded by ASCII
+        bool prev_ascii = true;
+        for (; end - bp >= UTF8_CHUNK; bp += UTF8_CHUNK) {
+            Utf8Vec v = UTF8_LOAD(bp);
+            bool ascii = not Any_High_Bytes(v);
+            if (ascii and prev_ascii)  // nothing can be wrong, skip lookups
+                num_codepoints += UTF8_CHUNK;
+            else {
+                if (Any_Nonzero_Bytes(Utf8_Errors(v, prev)))
+                    break;  // let the scalar code find where
+                num_codepoints += Utf8_Leads(v);
+            }
+            prev = v;
+            prev_ascii = ascii;
+        }
+
+        // The scalar code has to start at a codepoint boundary, so back up
+        // to the lead of any sequence that `bp` is in the middle of.  That
+        // lead was counted already, so it's uncounted.
+        //
+        const REBYTE *lead = bp;
+        while (lead != start and bp - lead < 3 and (lead[-1] & 0xC0) == 0x80)
+            --lead;
+        if (lead != start and lead[-1] >= 0xC0) {
+            --lead;
+            --num_codepoints;
+        }
+        bp = lead;
+    }
+  #endif
+
+    while (bp != end) {
+        if (*bp < 0x80) {
+            const REBYTE *run = Skip_Ascii_Utf8(bp + 1, end);
+            num_codepoints += run - bp;
+            bp = run;
+            continue;
+        }
+
+        REBLEN trail = trailingBytesForUTF8[*bp] + 1;
+        if (cast(REBLEN, end - bp) < trail or not isLegalUTF8(bp, trail))
+            break;
+
+        bp += trail;
+        ++num_codepoints;
+    }
+
+    *count = num_codepoints;
+    return bp;
+}
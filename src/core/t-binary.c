@@ -159,6 +159,7 @@ static REBBIN *MAKE_TO_Binary_Common(const REBVAL *arg)
         fail ("TUPLE! did not consist entirely of INTEGER! values 0-255"); }
 
     case REB_BITSET:
+        Densify_Bitset(VAL_BITSET(arg));
         return Copy_Bytes(BIN_HEAD(VAL_BINARY(arg)), VAL_LEN_HEAD(arg));
 
     case REB_MONEY: {
@@ -250,16 +251,16 @@ REB_R TO_Binary(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg)
 }
 
 
-enum COMPARE_CHR_FLAGS {
-    CC_FLAG_CASE = 1 << 0, // Case sensitive sort
-    CC_FLAG_REVERSE = 1 << 1 // Reverse sort order
+enum COMPARE_BYTE_FLAGS {
+    CB_FLAG_CASE = 1 << 0, // Case sensitive sort
+    CB_FLAG_REVERSE = 1 << 1 // Reverse sort order
 };
 
 
 //
 //  Compare_Byte: C
 //
-// This function is called by qsort_r, on behalf of the string sort
+// This function is called by Sort_Unstable() or Sort_Stable(), for the sort
 // function.  The `thunk` is an argument passed through from the caller
 // and given to us by the sort routine, which tells us about the string
 // and the kind of sort that was requested.
@@ -271,7 +272,7 @@ static int Compare_Byte(void *thunk, const void *v1, const void *v2)
     REBYTE b1 = *cast(const REBYTE*, v1);
     REBYTE b2 = *cast(const REBYTE*, v2);
 
-    if (*flags & CC_FLAG_REVERSE)
+    if (*flags & CB_FLAG_REVERSE)
         return b2 - b1;
     else
         return b1 - b2;
@@ -603,10 +604,14 @@ REBTYPE(Binary)
 
         REBINT len = Part_Len_May_Modify_Index(v, ARG(part));
 
-        return Init_Any_Series(
+        return Init_Any_Series(  // shares data of big binaries until written
             D_OUT,
             REB_BINARY,
-            Copy_Binary_At_Len(VAL_SERIES(v), VAL_INDEX(v), len)
+            Copy_Binary_Shared_At_Len(
+                m_cast(REBSER*, VAL_SERIES(v)),  // may join ring of sharers
+                VAL_INDEX(v),
+                len
+            )
         ); }
 
     //-- Bitwise:
@@ -807,7 +812,7 @@ REBTYPE(Binary)
             // Ignored...all BINARY! sorts are case-sensitive.
         }
 
-        if (REF(compare))
+        if (REF(compare) or REF(key))
             fail (Error_Bad_Refines_Raw());  // !!! not in R3-Alpha
 
         REBFLGS thunk = 0;
@@ -836,15 +841,22 @@ REBTYPE(Binary)
         }
 
         if (did REF(reverse))
-            thunk |= CC_FLAG_REVERSE;
-
-        reb_qsort_r(
-            data_at,
-            len,
-            size,
-            &thunk,
-            Compare_Byte
-        );
+            thunk |= CB_FLAG_REVERSE;
+
+        if (REF(stable)) {
+            REBBIN *scratch = Make_Binary((len / 2) * size);  // merge space
+            Sort_Stable(
+                data_at,
+                len,
+                size,
+                BIN_HEAD(scratch),
+                &thunk,
+                Compare_Byte
+            );
+            Free_Unmanaged_Series(scratch);
+        }
+        else
+            Sort_Unstable(data_at, len, size, &thunk, Compare_Byte);
         return D_OUT; }
 
       case SYM_RANDOM: {
@@ -882,6 +894,24 @@ REBTYPE(Binary)
         }
         RETURN (v); }
 
+      case SYM_RANDOM_FILL: {
+        INCLUDE_PARAMS_OF_RANDOM_FILL;
+        UNUSED(PAR(series));
+
+        REBBIN *bin = VAL_BINARY_ENSURE_MUTABLE(v);
+
+        REBINT len = tail - index;
+        if (REF(part)) {
+            REBINT limit = VAL_INT32(ARG(part));
+            if (limit < 0)
+                fail (PAR(part));
+            if (limit < len)
+                len = limit;
+        }
+        if (len > 0)
+            Random_Fill_Bytes(BIN_AT(bin, index), len);
+        RETURN (v); }
+
       default:
         break;
     }
@@ -1004,6 +1034,8 @@ REBNATIVE(enbin)
 //          [block!]
 //      binary "Decoded (defaults length of binary for number of bytes)"
 //          [binary!]
+//      /part "Length of binary to decode (decodes in place, without a COPY)"
+//          [any-value!]
 //  ]
 //
 REBNATIVE(debin)
@@ -1014,8 +1046,10 @@ REBNATIVE(debin)
 {
     INCLUDE_PARAMS_OF_DEBIN;
 
+    REBLEN len = Part_Len_May_Modify_Index(ARG(binary), ARG(part));
+
     REBSIZ bin_size;
-    const REBYTE *bin_data = VAL_BINARY_SIZE_AT(&bin_size, ARG(binary));
+    const REBYTE *bin_data = VAL_BYTES_LIMIT_AT(&bin_size, ARG(binary), len);
 
     REBVAL* settings = rebValue("compose", ARG(settings));
 
@@ -36,6 +36,9 @@
 //
 REBINT CT_Bitset(REBCEL(const*) a, REBCEL(const*) b, bool strict)
 {
+    Densify_Bitset(m_cast(REBBIN*, VAL_BITSET(a)));
+    Densify_Bitset(m_cast(REBBIN*, VAL_BITSET(b)));
+
     DECLARE_LOCAL (atemp);
     DECLARE_LOCAL (btemp);
     Init_Binary(atemp, VAL_BITSET(a));
@@ -54,14 +57,37 @@ REBINT CT_Bitset(REBCEL(const*) a, REBCEL(const*) b, bool strict)
 REBBIN *Make_Bitset(REBLEN num_bits)
 {
     REBLEN num_bytes = (num_bits + 7) / 8;
-    REBBIN *bin = Make_Binary(num_bytes);
+    REBBIN *bin = Make_Binary_Core(
+        num_bytes,
+        SERIES_FLAG_LINK_NODE_NEEDS_MARK  // LINK(BitRanges)
+    );
     Clear_Series(bin);
     TERM_BIN_LEN(bin, num_bytes);
     INIT_BITS_NOT(bin, false);
+    mutable_LINK(BitRanges, bin) = nullptr;
     return bin;
 }
 
 
+//
+//  Copy_Bitset: C
+//
+REBBIN *Copy_Bitset(const REBBIN *bset, REBFLGS flags)
+{
+    REBBIN *copy = BIN(Copy_Series_Core(
+        bset,
+        SERIES_FLAG_LINK_NODE_NEEDS_MARK | flags
+    ));
+    INIT_BITS_NOT(copy, BITS_NOT(bset));
+
+    REBBIN *ranges = LINK(BitRanges, bset);
+    if (ranges)
+        ranges = BIN(Copy_Series_Core(ranges, NODE_FLAG_MANAGED));
+    mutable_LINK(BitRanges, copy) = ranges;
+    return copy;
+}
+
+
 //
 //  MF_Bitset: C
 //
@@ -72,6 +98,7 @@ void MF_Bitset(REB_MOLD *mo, REBCEL(const*) v, bool form)
     Pre_Mold(mo, v); // #[bitset! or make bitset!
 
     const REBBIN *s = VAL_BITSET(v);
+    Densify_Bitset(m_cast(REBBIN*, s));
 
     if (BITS_NOT(s))
         Append_Ascii(mo->series, "[not bits ");
@@ -104,6 +131,12 @@ REB_R MAKE_Bitset(
     if (len == NOT_FOUND)
         fail (arg);
 
+    // An INTEGER! asks for a size.  Otherwise, high bits will go in ranges
+    // and the binary only has to be big enough for the low ones.
+    //
+    if (not IS_INTEGER(arg) and not IS_BINARY(arg) and len > BITSET_DENSE_MAX)
+        len = 0;
+
     REBBIN *bin = Make_Bitset(len);
     Manage_Series(bin);
     Init_Bitset(out, bin);
@@ -193,6 +226,44 @@ REBLEN Find_Max_Bit(const RELVAL *val)
 }
 
 
+// Binary search for the first range that ends at or after bit `n` (which is
+// `count` if there is none).
+//
+static REBLEN Find_Bit_Range(
+    const struct Reb_Bit_Range *r,
+    REBLEN count,
+    REBLEN n
+){
+    REBLEN lo = 0;
+    REBLEN hi = count;
+    while (lo < hi) {
+        REBLEN mid = lo + (hi - lo) / 2;
+        if (r[mid].hi < n)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
+inline static bool Check_Bit_Exact(const REBBIN *bset, REBLEN n)
+{
+    REBLEN i = n >> 3;
+    if (i < BIN_LEN(bset))
+        return did (BIN_HEAD(bset)[i] & (1 << (7 - (n & 7))));
+
+    REBBIN *ranges = LINK(BitRanges, bset);
+    if (not ranges)
+        return false;
+
+    struct Reb_Bit_Range *r = BIT_RANGES_HEAD(ranges);
+    REBLEN count = BIT_RANGES_LEN(ranges);
+    REBLEN k = Find_Bit_Range(r, count, n);
+    return k < count and r[k].lo <= n;
+}
+
+
 //
 //  Check_Bit: C
 //
@@ -201,29 +272,13 @@ REBLEN Find_Max_Bit(const RELVAL *val)
 //
 bool Check_Bit(const REBBIN *bset, REBLEN c, bool uncased)
 {
-    REBLEN i, n = c;
-    REBLEN tail = BIN_LEN(bset);
-    bool flag = false;
-
-    if (uncased) {
-        if (n >= UNICODE_CASES)
-            uncased = false; // no need to check
-        else
-            n = LO_CASE(c);
-    }
-
-    // Check lowercase char:
-retry:
-    i = n >> 3;
-    if (i < tail)
-        flag = did (BIN_HEAD(bset)[i] & (1 << (7 - (n & 7))));
-
-    // Check uppercase if needed:
-    if (uncased && !flag) {
-        n = UP_CASE(c);
-        uncased = false;
-        goto retry;
+    bool flag;
+    if (uncased and c < UNICODE_CASES) {
+        flag = Check_Bit_Exact(bset, LO_CASE(c))
+            or Check_Bit_Exact(bset, UP_CASE(c));
     }
+    else
+        flag = Check_Bit_Exact(bset, c);
 
     if (BITS_NOT(bset))
         return not flag;
@@ -232,12 +287,93 @@ retry:
 }
 
 
+// Replace `removed` ranges at index `at` with `added` ranges from `add`.
 //
-//  Set_Bit: C
+static void Splice_Bit_Ranges(
+    REBBIN *ranges,
+    REBLEN at,
+    REBLEN removed,
+    const struct Reb_Bit_Range *add,
+    REBLEN added
+){
+    const REBLEN wide = sizeof(struct Reb_Bit_Range);
+    REBLEN count = BIT_RANGES_LEN(ranges);
+
+    if (added > removed)
+        Expand_Series(ranges, (at + removed) * wide, (added - removed) * wide);
+    else if (added < removed) {
+        memmove(
+            BIN_AT(ranges, (at + added) * wide),
+            BIN_AT(ranges, (at + removed) * wide),
+            (count - at - removed) * wide
+        );
+        TERM_BIN_LEN(ranges, (count - removed + added) * wide);
+    }
+    memcpy(BIN_AT(ranges, at * wide), add, added * wide);
+}
+
+
+// Set or clear bits lo..hi in the ranges (see BITSET_DENSE_MAX), merging
+// ranges that come to overlap or touch.
 //
-// Set/clear a single bit. Expand if needed.
+static void Set_Bit_Ranges(REBBIN *bset, REBLEN lo, REBLEN hi, bool set)
+{
+    REBBIN *ranges = LINK(BitRanges, bset);
+    if (not ranges) {
+        if (not set)
+            return;
+        ranges = Make_Binary_Core(
+            4 * sizeof(struct Reb_Bit_Range),
+            NODE_FLAG_MANAGED
+        );
+        TERM_BIN_LEN(ranges, 0);
+        mutable_LINK(BitRanges, bset) = ranges;
+        GC_Write_Barrier(bset);
+    }
+
+    struct Reb_Bit_Range *r = BIT_RANGES_HEAD(ranges);
+    REBLEN count = BIT_RANGES_LEN(ranges);
+
+    struct Reb_Bit_Range pieces[2];
+    REBLEN num_pieces = 0;
+    REBLEN k;
+    REBLEN j;
+
+    if (set) {  // absorb ranges overlapping or adjacent to lo..hi
+        k = Find_Bit_Range(r, count, lo == 0 ? 0 : lo - 1);
+        pieces[0].lo = lo;
+        pieces[0].hi = hi;
+        for (j = k; j < count and r[j].lo <= hi + 1; ++j) {
+            if (r[j].lo < pieces[0].lo)
+                pieces[0].lo = r[j].lo;
+            if (r[j].hi > pieces[0].hi)
+                pieces[0].hi = r[j].hi;
+        }
+        num_pieces = 1;
+    }
+    else {  // keep the parts of overlapping ranges outside of lo..hi
+        k = Find_Bit_Range(r, count, lo);
+        for (j = k; j < count and r[j].lo <= hi; ++j)
+            NOOP;
+        if (j > k and r[k].lo < lo) {
+            pieces[num_pieces].lo = r[k].lo;
+            pieces[num_pieces].hi = lo - 1;
+            ++num_pieces;
+        }
+        if (j > k and r[j - 1].hi > hi) {
+            pieces[num_pieces].lo = hi + 1;
+            pieces[num_pieces].hi = r[j - 1].hi;
+            ++num_pieces;
+        }
+    }
+
+    Splice_Bit_Ranges(ranges, k, j - k, pieces, num_pieces);
+}
+
+
+// Set/clear a bit in the binary, expanding it if needed.
 //
-void Set_Bit(REBBIN *bset, REBLEN n, bool set)
+static void Set_Bit_Dense(REBBIN *bset, REBLEN n, bool set)
 {
     REBLEN i = n >> 3;
     REBLEN tail = BIN_LEN(bset);
@@ -259,6 +395,70 @@ void Set_Bit(REBBIN *bset, REBLEN n, bool set)
 }
 
 
+//
+//  Set_Bit_Range: C
+//
+// Set/clear bits lo..hi inclusive.  Those that fit in the binary (or in it
+// expanded up to BITSET_DENSE_MAX) go there, the rest go into ranges.
+//
+void Set_Bit_Range(REBBIN *bset, REBLEN lo, REBLEN hi, bool set)
+{
+    REBLEN dense_max = BIN_LEN(bset) * 8;
+    if (dense_max < BITSET_DENSE_MAX)
+        dense_max = BITSET_DENSE_MAX;
+
+    for (; lo <= hi and lo < dense_max; ++lo)
+        Set_Bit_Dense(bset, lo, set);
+
+    if (lo <= hi)
+        Set_Bit_Ranges(bset, lo, hi, set);
+}
+
+
+//
+//  Set_Bit: C
+//
+// Set/clear a single bit. Expand if needed.
+//
+void Set_Bit(REBBIN *bset, REBLEN n, bool set)
+{
+    if (n >= BITSET_DENSE_MAX and (n >> 3) >= BIN_LEN(bset))
+        Set_Bit_Ranges(bset, n, n, set);
+    else
+        Set_Bit_Dense(bset, n, set);
+}
+
+
+//
+//  Densify_Bitset: C
+//
+// Move any bits kept as ranges (see BITSET_DENSE_MAX) into the binary, for
+// operations that work on the bytes.
+//
+void Densify_Bitset(REBBIN *bset)
+{
+    REBBIN *ranges = LINK(BitRanges, bset);
+    if (not ranges)
+        return;
+
+    mutable_LINK(BitRanges, bset) = nullptr;
+
+    struct Reb_Bit_Range *r = BIT_RANGES_HEAD(ranges);
+    REBLEN count = BIT_RANGES_LEN(ranges);
+    if (count == 0)
+        return;
+
+    Set_Bit_Dense(bset, r[count - 1].hi, true);  // expand just once
+
+    REBLEN k;
+    for (k = 0; k < count; ++k) {
+        REBLEN n;
+        for (n = r[k].lo; n <= r[k].hi; ++n)
+            BIN_HEAD(bset)[n >> 3] |= 1 << (7 - (n & 7));
+    }
+}
+
+
 //
 //  Set_Bits: C
 //
@@ -332,9 +532,7 @@ bool Set_Bits(REBBIN *bset, const RELVAL *val, bool set)
                     REBLEN n = VAL_CHAR(item);
                     if (n < c)
                         fail (Error_Index_Out_Of_Range_Raw());
-                    do {
-                        Set_Bit(bset, c, set);
-                    } while (c++ < n); // post-increment: test before overflow
+                    Set_Bit_Range(bset, c, n, set);
                 }
                 else
                     fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(val)));
@@ -358,8 +556,7 @@ bool Set_Bits(REBBIN *bset, const RELVAL *val, bool set)
                     n = Int32s(SPECIFIC(item), 0);
                     if (n < c)
                         fail (Error_Index_Out_Of_Range_Raw());
-                    for (; c <= n; c++)
-                        Set_Bit(bset, c, set);
+                    Set_Bit_Range(bset, c, n, set);
                 }
                 else
                     fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(val)));
@@ -388,6 +585,8 @@ bool Set_Bits(REBBIN *bset, const RELVAL *val, bool set)
             REBSIZ n;
             const REBYTE *at = VAL_BINARY_SIZE_AT(&n, item);
 
+            Densify_Bitset(bset);  // bytes are overwritten from the head
+
             REBUNI c = BIN_LEN(bset);
             if (n >= c) {
                 Expand_Series(bset, c, (n - c));
@@ -584,11 +783,16 @@ REBTYPE(Bitset)
         SYMID property = VAL_WORD_ID(ARG(property));
         switch (property) {
           case SYM_LENGTH:
+            Densify_Bitset(m_cast(REBBIN*, VAL_BITSET(v)));
             return Init_Integer(v, BIN_LEN(VAL_BITSET(v)) * 8);
 
           case SYM_TAIL_Q:
             // Necessary to make EMPTY? work:
-            return Init_Logic(D_OUT, BIN_LEN(VAL_BITSET(v)) == 0);
+            return Init_Logic(
+                D_OUT,
+                BIN_LEN(VAL_BITSET(v)) == 0
+                    and not LINK(BitRanges, VAL_BITSET(v))
+            );
 
           default:
             break;
@@ -613,7 +817,7 @@ REBTYPE(Bitset)
         return Init_True(D_OUT); }
 
       case SYM_COMPLEMENT: {
-        REBBIN *copy = BIN(Copy_Series_Core(VAL_BITSET(v), NODE_FLAG_MANAGED));
+        REBBIN *copy = Copy_Bitset(VAL_BITSET(v), NODE_FLAG_MANAGED);
         INIT_BITS_NOT(copy, not BITS_NOT(VAL_BITSET(v)));
         return Init_Bitset(D_OUT, copy); }
 
@@ -656,14 +860,14 @@ REBTYPE(Bitset)
         if (REF(part) or REF(deep) or REF(types))
             fail (Error_Bad_Refines_Raw());
 
-        REBBIN *copy = BIN(Copy_Series_Core(VAL_BITSET(v), NODE_FLAG_MANAGED));
-        INIT_BITS_NOT(copy, BITS_NOT(VAL_BITSET(v)));
+        REBBIN *copy = Copy_Bitset(VAL_BITSET(v), NODE_FLAG_MANAGED);
         return Init_Bitset(D_OUT, copy); }
 
       case SYM_CLEAR: {
         REBBIN *bin = VAL_BITSET_ENSURE_MUTABLE(v);
         INIT_BITS_NOT(bin, false);
         Clear_Series(bin);
+        mutable_LINK(BitRanges, bin) = nullptr;
         RETURN (v); }
 
       case SYM_INTERSECT:
@@ -674,6 +878,7 @@ REBTYPE(Bitset)
         if (IS_BITSET(arg)) {
             if (BITS_NOT(VAL_BITSET(arg)))  // !!! see #2365
                 fail ("Bitset negation not handled by set operations");
+            Densify_Bitset(m_cast(REBBIN*, VAL_BITSET(arg)));
             Init_Binary(arg, VAL_BITSET(arg));
         }
         else if (not IS_BINARY(arg))
@@ -682,6 +887,7 @@ REBTYPE(Bitset)
         if (BITS_NOT(VAL_BITSET(v)))  // !!! see #2365
             fail ("Bitset negation not handled by set operations");
 
+        Densify_Bitset(m_cast(REBBIN*, VAL_BITSET(v)));
         Init_Binary(v, VAL_BITSET(v));
 
         // !!! Until the replacement implementation with Roaring Bitmaps, the
@@ -715,6 +921,11 @@ REBTYPE(Bitset)
         REBBIN *bits = VAL_BINARY_KNOWN_MUTABLE(processed);
         rebRelease(processed);
 
+        if (GET_SERIES_INFO(bits, SHARED))  // LINK(Sharer) is in use
+            Unshare_Series(bits);
+        SET_SERIES_FLAG(bits, LINK_NODE_NEEDS_MARK);
+        mutable_LINK(BitRanges, bits) = nullptr;  // operands were densified
+
         INIT_BITS_NOT(bits, false);
         Trim_Tail_Zeros(bits);
         return Init_Bitset(D_OUT, bits); }
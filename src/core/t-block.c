@@ -363,6 +363,323 @@ REB_R TO_Array(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg) {
 }
 
 
+//=//// ARRAY HASH INDEX //////////////////////////////////////////////////=//
+//
+// FIND and SELECT scan, which is the quickest way for the typical small
+// block.  But blocks used as constant lookup tables can be big, so once a
+// deep-frozen array of ARRAY_INDEX_MIN_LEN or more items has been searched
+// twice, a hash index is built for it.  The array can't change, so the index
+// is good for as long as the array lives, and Decay_Series() frees it.
+//
+// Plain arrays have no spare slot to point to an index from, so the indexes
+// are kept in a side table keyed by the array pointer (open addressing, with
+// linear probing).  ARRAY_FLAG_HASH_INDEXED says an array has an entry, which
+// has a null index after the first search.
+//
+// Each index chains the positions of items with the same hash in ascending
+// order, so the first candidate that compares equal is the first match, as
+// a scan would find.  Only some kinds of item are in the index, and only a
+// target of one of those kinds uses it (items of other kinds can't be equal
+// to those targets, as Cmp_Value() doesn't equate different kinds):
+//
+// * Words are hashed caselessly by spelling alone, since FIND of a word will
+//   match any kind of word spelled the same.
+//
+// * Other kinds use Hash_Value(), as MAP! does, if it agrees with Cmp_Value()
+//   for them.  (Arrays hash by length and contexts by identity, so not.)
+//
+// * All numbers are comparable, and DECIMAL! equality is approximate, so
+//   only an INTEGER! target uses the index, if there are no other numbers.
+//
+// The index is an array of REBLEN: [0] is the (power of 2) count of bucket
+// heads, [1] the array length, [2] nonzero if there are non-INTEGER! numbers.
+// Then come the heads and the chain links, as 1-based positions (0 ends).
+//
+
+#define ARRAY_INDEX_MIN_LEN 32
+
+#define IDX_ARRAY_INDEX_HEADS 3
+
+static bool Try_Get_Index_Hash(uint32_t *hash, const RELVAL *v)
+{
+    REBCEL(const*) cell = VAL_UNESCAPED(v);
+    enum Reb_Kind kind = CELL_KIND(cell);
+
+    if (ANY_WORD_KIND(kind)) {
+        *hash = Hash_String(VAL_WORD_SYMBOL(cell));
+        return true;
+    }
+
+    switch (kind) {
+      case REB_BLANK:
+      case REB_LOGIC:
+      case REB_INTEGER:
+      case REB_DECIMAL:
+      case REB_PERCENT:
+      case REB_MONEY:
+      case REB_BINARY:
+      case REB_TEXT:
+      case REB_FILE:
+      case REB_EMAIL:
+      case REB_URL:
+      case REB_TAG:
+      case REB_ISSUE:
+        *hash = Hash_Value(v);
+        return true;
+
+      default:
+        return false;
+    }
+}
+
+
+static REBLEN Array_Index_Home(const REBARR *a)
+  { return (cast(uintptr_t, a) >> 4) & (TG_Array_Index_Capacity - 1); }
+
+
+// Slot the array is in, or the empty slot where it would go.
+//
+static REBLEN Array_Index_Slot(const REBARR *a)
+{
+    REBLEN mask = TG_Array_Index_Capacity - 1;
+    REBLEN slot = Array_Index_Home(a);
+    while (TG_Indexed_Arrays[slot] and TG_Indexed_Arrays[slot] != a)
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+
+// Add an entry for the array with no index yet.  If the table can't be
+// grown, the array just isn't flagged, and it will be scanned.
+//
+static void Add_Array_Index_Entry(const REBARR *a)
+{
+    if ((TG_Num_Array_Indexes + 1) * 2 > TG_Array_Index_Capacity) {
+        REBLEN old_capacity = TG_Array_Index_Capacity;
+        const REBARR **old_arrays = TG_Indexed_Arrays;
+        REBLEN **old_indexes = TG_Array_Indexes;
+
+        REBLEN capacity = old_capacity == 0 ? 16 : old_capacity * 2;
+        const REBARR **arrays = TRY_ALLOC_N(const REBARR*, capacity);
+        REBLEN **indexes = TRY_ALLOC_N(REBLEN*, capacity);
+        if (arrays == nullptr or indexes == nullptr) {
+            if (arrays)
+                FREE_N(const REBARR*, capacity, arrays);
+            if (indexes)
+                FREE_N(REBLEN*, capacity, indexes);
+            return;
+        }
+        memset(arrays, 0, sizeof(const REBARR*) * capacity);
+
+        TG_Indexed_Arrays = arrays;
+        TG_Array_Indexes = indexes;
+        TG_Array_Index_Capacity = capacity;
+
+        REBLEN n;
+        for (n = 0; n < old_capacity; ++n) {
+            if (not old_arrays[n])
+                continue;
+            REBLEN slot = Array_Index_Slot(old_arrays[n]);
+            TG_Indexed_Arrays[slot] = old_arrays[n];
+            TG_Array_Indexes[slot] = old_indexes[n];
+        }
+        if (old_capacity != 0) {
+            FREE_N(const REBARR*, old_capacity, old_arrays);
+            FREE_N(REBLEN*, old_capacity, old_indexes);
+        }
+    }
+
+    REBLEN slot = Array_Index_Slot(a);
+    assert(TG_Indexed_Arrays[slot] == nullptr);
+    TG_Indexed_Arrays[slot] = a;
+    TG_Array_Indexes[slot] = nullptr;
+    ++TG_Num_Array_Indexes;
+
+    SET_SUBCLASS_FLAG(ARRAY, m_cast(REBARR*, a), HASH_INDEXED);
+}
+
+
+// If the allocation fails, the array just isn't indexed (yet).
+//
+static REBLEN *Make_Array_Index(const REBARR *a)
+{
+    REBLEN len = ARR_LEN(a);
+    REBLEN num_heads = 1;
+    while (num_heads < len)
+        num_heads <<= 1;
+
+    REBLEN total = IDX_ARRAY_INDEX_HEADS + num_heads + len;
+    REBLEN *index = TRY_ALLOC_N(REBLEN, total);
+    if (index == nullptr)
+        return nullptr;
+    memset(index, 0, sizeof(REBLEN) * total);
+
+    index[0] = num_heads;
+    index[1] = len;
+
+    REBLEN *heads = index + IDX_ARRAY_INDEX_HEADS;
+    REBLEN *links = heads + num_heads;
+
+    REBLEN n;
+    for (n = len; n != 0; --n) {  // backwards, so chains are in order
+        const RELVAL *item = ARR_AT(a, n - 1);
+
+        enum Reb_Kind kind = CELL_KIND(VAL_UNESCAPED(item));
+        if (kind == REB_DECIMAL or kind == REB_PERCENT or kind == REB_MONEY)
+            index[2] = 1;
+
+        uint32_t hash;
+        if (not Try_Get_Index_Hash(&hash, item))
+            continue;
+
+        REBLEN *head = &heads[hash & (num_heads - 1)];
+        links[n - 1] = *head;
+        *head = n;
+    }
+
+    return index;
+}
+
+
+//
+//  Free_Array_Hash_Index: C
+//
+// Called by Decay_Series() for arrays with ARRAY_FLAG_HASH_INDEXED.  Entries
+// after it in the table are moved back, so lookups don't need tombstones.
+//
+void Free_Array_Hash_Index(REBARR *a)
+{
+    CLEAR_SUBCLASS_FLAG(ARRAY, a, HASH_INDEXED);
+
+    if (TG_Array_Index_Capacity == 0)
+        return;
+
+    REBLEN slot = Array_Index_Slot(a);
+    if (TG_Indexed_Arrays[slot] != a)
+        return;  // e.g. flag was copied along with others, no entry
+
+    REBLEN *index = TG_Array_Indexes[slot];
+    if (index)
+        FREE_N(REBLEN, IDX_ARRAY_INDEX_HEADS + index[0] + index[1], index);
+
+    REBLEN mask = TG_Array_Index_Capacity - 1;
+    REBLEN hole = slot;
+    REBLEN n = slot;
+    while (true) {
+        n = (n + 1) & mask;
+        if (not TG_Indexed_Arrays[n])
+            break;
+
+        REBLEN home = Array_Index_Home(TG_Indexed_Arrays[n]);
+        bool stays = (hole <= n)
+            ? (hole < home and home <= n)
+            : (hole < home or home <= n);
+        if (stays)
+            continue;
+
+        TG_Indexed_Arrays[hole] = TG_Indexed_Arrays[n];
+        TG_Array_Indexes[hole] = TG_Array_Indexes[n];
+        hole = n;
+    }
+    TG_Indexed_Arrays[hole] = nullptr;
+    TG_Array_Indexes[hole] = nullptr;
+
+    if (--TG_Num_Array_Indexes == 0) {
+        FREE_N(const REBARR*, TG_Array_Index_Capacity, TG_Indexed_Arrays);
+        FREE_N(REBLEN*, TG_Array_Index_Capacity, TG_Array_Indexes);
+        TG_Indexed_Arrays = nullptr;
+        TG_Array_Indexes = nullptr;
+        TG_Array_Index_Capacity = 0;
+    }
+}
+
+
+// Gives back false if the index can't be used for this search (or isn't
+// built yet), so the caller should scan.  Otherwise `*found` is the first
+// position from `index` to before `end` (stepping by `skip`) that matches.
+//
+static bool Did_Find_In_Array_Index(
+    REBLEN *found,
+    const REBARR *array,
+    REBLEN index,
+    REBLEN end,
+    const RELVAL *target,
+    REBFLGS flags,
+    REBLEN skip
+){
+    enum Reb_Kind target_kind = CELL_KIND(VAL_UNESCAPED(target));
+    bool number = (target_kind == REB_INTEGER);
+    if (not number and ANY_NUMBER_KIND(target_kind))
+        return false;  // approximate equality with DECIMAL! etc.
+
+    uint32_t hash;
+    if (not Try_Get_Index_Hash(&hash, target))
+        return false;
+
+    if (NOT_SUBCLASS_FLAG(ARRAY, array, HASH_INDEXED)) {
+        Add_Array_Index_Entry(array);  // will build index if searched again
+        return false;
+    }
+
+    REBLEN slot = Array_Index_Slot(array);
+    if (TG_Indexed_Arrays[slot] != array)
+        return false;  // flag was copied along with others, no entry
+
+    REBLEN *idx = TG_Array_Indexes[slot];
+    if (not idx) {
+        idx = TG_Array_Indexes[slot] = Make_Array_Index(array);
+        if (not idx)
+            return false;
+    }
+    assert(idx[1] == ARR_LEN(array));
+
+    if (number and idx[2])
+        return false;  // INTEGER! could match DECIMAL! etc., scan
+
+    REBLEN num_heads = idx[0];
+    const REBLEN *heads = idx + IDX_ARRAY_INDEX_HEADS;
+    const REBLEN *links = heads + num_heads;
+
+    bool word = ANY_WORD(target);
+    const REBSYM *symbol = word ? VAL_WORD_SYMBOL(target) : nullptr;
+
+    REBLEN n = heads[hash & (num_heads - 1)];
+    for (; n != 0; n = links[n - 1]) {
+        REBLEN i = n - 1;
+        if (i < index)
+            continue;
+        if (i >= end)
+            break;
+        if ((i - index) % skip != 0)
+            continue;
+
+        const RELVAL *item = ARR_AT(array, i);
+        if (word) {  // same matching as the scan for a word
+            if (not ANY_WORD(item))
+                continue;
+            if (flags & AM_FIND_CASE) {
+                if (
+                    VAL_WORD_SYMBOL(item) != symbol
+                    or VAL_TYPE(item) != VAL_TYPE(target)
+                ){
+                    continue;
+                }
+            }
+            else if (not Are_Synonyms(VAL_WORD_SYMBOL(item), symbol))
+                continue;
+        }
+        else if (0 != Cmp_Value(item, target, did (flags & AM_FIND_CASE)))
+            continue;
+
+        *found = i;
+        return true;
+    }
+
+    *found = NOT_FOUND;
+    return true;
+}
+
+
 //
 //  Find_In_Array: C
 //
@@ -386,6 +703,22 @@ REBLEN Find_In_Array(
         return index_unsigned;
     }
 
+    if (
+        skip > 0
+        and not (flags & AM_FIND_MATCH)
+        and (flags & AM_FIND_ONLY or not ANY_ARRAY(target))
+        and ARR_LEN(array) >= ARRAY_INDEX_MIN_LEN
+        and SER_FLAVOR(array) == FLAVOR_ARRAY
+        and GET_SERIES_INFO(array, FROZEN_DEEP)
+    ){
+        REBLEN found;
+        if (Did_Find_In_Array_Index(
+            &found, array, index_unsigned, end_unsigned, target, flags, skip
+        )){
+            return found;
+        }
+    }
+
     REBINT index = index_unsigned;  // skip can be negative, tested >= 0
     REBINT end = end_unsigned;
 
@@ -539,6 +872,46 @@ static int Compare_Val(void *arg, const void *v1, const void *v2)
 }
 
 
+// The comparators below are used in place of Compare_Val() when all the keys
+// being sorted are the same type, so no dispatch through Cmp_Value() is
+// needed.  They must give the same answers it would.
+
+static int Compare_Integer_Vals(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+
+    REBI64 i1 = VAL_INT64(cast(const RELVAL*, v1) + flags->offset);
+    REBI64 i2 = VAL_INT64(cast(const RELVAL*, v2) + flags->offset);
+    if (flags->reverse)
+        return (i2 > i1) - (i2 < i1);
+    return (i1 > i2) - (i1 < i2);
+}
+
+static int Compare_Decimal_Vals(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+
+    REBDEC d1 = VAL_DECIMAL(cast(const RELVAL*, v1) + flags->offset);
+    REBDEC d2 = VAL_DECIMAL(cast(const RELVAL*, v2) + flags->offset);
+    if (Eq_Decimal(d1, d2))  // not exact, see Cmp_Value()
+        return 0;
+    if (flags->reverse)
+        return d2 < d1 ? -1 : 1;
+    return d1 < d2 ? -1 : 1;
+}
+
+static int Compare_Text_Vals(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+
+    REBCEL(const*) s1 = VAL_UNESCAPED(cast(const RELVAL*, v1) + flags->offset);
+    REBCEL(const*) s2 = VAL_UNESCAPED(cast(const RELVAL*, v2) + flags->offset);
+    if (flags->reverse)
+        return CT_String(s2, s1, flags->cased);
+    return CT_String(s1, s2, flags->cased);
+}
+
+
 //
 //  Compare_Val_Custom: C
 //
@@ -585,6 +958,343 @@ static int Compare_Val_Custom(void *arg, const void *v1, const void *v2)
 }
 
 
+// Pick the comparator to use for SORT of `num` records of `skip` cells each,
+// which is a specialized one if all the keys are INTEGER!, DECIMAL! or TEXT!.
+//
+static cmp_t *Sort_Comparator(
+    struct sort_flags *flags,
+    const RELVAL *head,
+    REBLEN num,
+    REBLEN skip
+){
+    if (flags->comparator != nullptr)
+        return &Compare_Val_Custom;
+
+    enum Reb_Kind kind = VAL_TYPE(head + flags->offset);
+    if (kind != REB_INTEGER and kind != REB_DECIMAL and kind != REB_TEXT)
+        return &Compare_Val;
+
+    const RELVAL *key = head + flags->offset;
+    REBLEN n;
+    for (n = 0; n < num; ++n, key += skip) {
+        if (VAL_TYPE(key) != kind)
+            return &Compare_Val;
+    }
+
+    if (kind == REB_INTEGER)
+        return &Compare_Integer_Vals;
+    if (kind == REB_DECIMAL)
+        return &Compare_Decimal_Vals;
+    return &Compare_Text_Vals;
+}
+
+
+// Sorting beneath this many records is faster with a comparison sort than
+// paying for the radix sort's counting pass and buffers.
+//
+#define SORT_RADIX_MIN 256
+
+
+// Sort the `indices` of records by their INTEGER! or BINARY! keys, via the
+// `keys` buffer.  Gives back false if the radix sort couldn't allocate.
+//
+static bool Radix_Sort_Record_Keys(
+    uint64_t *keys,
+    REBLEN *indices,
+    const RELVAL *head,
+    REBLEN num,
+    REBLEN skip,
+    struct sort_flags *flags,
+    REBSIZ width  // 0 if keys are INTEGER!
+){
+    uint64_t flip = flags->reverse ? ~cast(uint64_t, 0) : 0;
+    REBLEN n;
+
+    if (IS_INTEGER(head + flags->offset)) {
+        const RELVAL *key = head + flags->offset;
+        for (n = 0; n < num; ++n, key += skip) {  // sign flip orders unsigned
+            uint64_t u = cast(uint64_t, VAL_INT64(key));
+            keys[n] = (u ^ (cast(uint64_t, 1) << 63)) ^ flip;
+        }
+        return Radix_Sort_U64(keys, indices, num);
+    }
+
+    // Binaries compare like big-endian numbers, so sort by the last 8 bytes
+    // first (padded out with zero bytes), then by the 8 before that...
+    //
+    REBSIZ chunk = (width + 7) / 8;
+    while (chunk-- != 0) {
+        for (n = 0; n < num; ++n) {
+            const REBYTE *bp = VAL_BINARY_AT(
+                head + indices[n] * skip + flags->offset
+            );
+            uint64_t u = 0;
+            REBSIZ i;
+            for (i = chunk * 8; i < chunk * 8 + 8; ++i)
+                u = (u << 8) | (i < width ? bp[i] : 0);
+            keys[n] = u ^ flip;
+        }
+        if (not Radix_Sort_U64(keys, indices, num))
+            return false;
+    }
+    return true;
+}
+
+
+// SORT with no /COMPARE function of records whose keys are all INTEGER!, or
+// all BINARY! of the same length, is done as a radix sort of the keys.  The
+// records are then moved into sorted order through a scratch buffer.  (The
+// radix sort is stable, so this serves SORT/STABLE too.)  Gives back false
+// if the keys aren't eligible, or memory for the buffers wasn't available.
+//
+static bool Try_Radix_Sort_Array(
+    RELVAL *head,
+    REBLEN num,
+    REBLEN skip,
+    struct sort_flags *flags
+){
+    if (flags->comparator != nullptr or num < SORT_RADIX_MIN)
+        return false;
+
+    const RELVAL *key = head + flags->offset;
+    enum Reb_Kind kind = VAL_TYPE(key);
+    REBSIZ width = 0;
+    if (kind == REB_BINARY)
+        VAL_BINARY_SIZE_AT(&width, key);
+    else if (kind != REB_INTEGER)
+        return false;
+
+    REBLEN n;
+    for (n = 0; n < num; ++n, key += skip) {
+        if (VAL_TYPE(key) != kind)
+            return false;
+        if (kind == REB_BINARY) {
+            REBSIZ size;
+            VAL_BINARY_SIZE_AT(&size, key);
+            if (size != width)
+                return false;
+        }
+    }
+
+    REBSIZ record_size = sizeof(REBVAL) * skip;
+    uint64_t *keys = TRY_ALLOC_N(uint64_t, num);
+    REBLEN *indices = TRY_ALLOC_N(REBLEN, num);
+    REBYTE *records = TRY_ALLOC_N(REBYTE, num * record_size);
+
+    bool sorted = false;
+    if (keys and indices and records) {
+        for (n = 0; n < num; ++n)
+            indices[n] = n;
+
+        if (Radix_Sort_Record_Keys(
+            keys, indices, head, num, skip, flags, width
+        )){
+            for (n = 0; n < num; ++n)  // array untouched until records move
+                memcpy(
+                    records + n * record_size,
+                    head + indices[n] * skip,
+                    record_size
+                );
+            memcpy(head, records, num * record_size);
+            sorted = true;
+        }
+    }
+
+    if (keys)
+        FREE_N(uint64_t, num, keys);
+    if (indices)
+        FREE_N(REBLEN, num, indices);
+    if (records)
+        FREE_N(REBYTE, num * record_size, records);
+    return sorted;
+}
+
+
+// Sorts on threads are only worth it for big arrays.  See Sort_Parallel().
+//
+#define SORT_PARALLEL_MIN 100000
+
+
+// A comparator can only be used on other threads if it doesn't allocate,
+// fail() or run the evaluator.  The DECIMAL! and TEXT! comparators qualify,
+// except that the position in a non-ASCII string may be looked up through
+// bookmarks that are cached in (and so written to) the string.
+//
+static bool Can_Sort_On_Threads(
+    cmp_t *cmp_fn,
+    const RELVAL *head,
+    REBLEN num,
+    REBLEN skip,
+    REBLEN offset
+){
+    if (cmp_fn == &Compare_Decimal_Vals or cmp_fn == &Compare_Integer_Vals)
+        return true;
+    if (cmp_fn != &Compare_Text_Vals)
+        return false;
+
+    const RELVAL *key = head + offset;
+    REBLEN n;
+    for (n = 0; n < num; ++n, key += skip) {
+        if (not Is_Definitely_Ascii(VAL_STRING(key)))
+            return false;
+    }
+    return true;
+}
+
+
+//
+//  Sort_Records: C
+//
+// Sort `num` records of `skip` cells at `head`, using a radix sort if the
+// keys allow it, else pdqsort (or the merge sort if `stable`).  Big arrays
+// whose keys are compared natively can be sorted on several threads.
+//
+static void Sort_Records(
+    RELVAL *head,
+    REBLEN num,
+    REBLEN skip,
+    struct sort_flags *flags,
+    bool stable,
+    REBLEN threads
+){
+    if (Try_Radix_Sort_Array(head, num, skip, flags))
+        return;
+
+    cmp_t *cmp_fn = Sort_Comparator(flags, head, num, skip);
+
+    if (
+        threads > 1
+        and num >= SORT_PARALLEL_MIN
+        and Can_Sort_On_Threads(cmp_fn, head, num, skip, flags->offset)
+    ){
+        REBSIZ size = sizeof(REBVAL) * skip * num;
+        REBYTE *scratch = TRY_ALLOC_N(REBYTE, size);  // not GC-visible, but
+        if (scratch) {  // ...no GC can happen with these comparators
+            Sort_Parallel(
+                head,
+                num,
+                sizeof(REBVAL) * skip,
+                scratch,
+                flags,
+                cmp_fn,
+                threads,
+                stable
+            );
+            FREE_N(REBYTE, size, scratch);
+            return;
+        }
+    }
+
+    if (not stable) {
+        Sort_Unstable(head, num, sizeof(REBVAL) * skip, flags, cmp_fn);
+        return;
+    }
+
+    // The merge sort moves records out to the scratch array while it runs,
+    // and a /COMPARE function could trigger a GC...so the scratch is an array
+    // of valid cells that is guarded.
+    //
+    REBLEN scratch_len = (num / 2) * skip;
+    REBARR *scratch = Make_Array(scratch_len);
+    REBLEN n;
+    for (n = 0; n < scratch_len; ++n)
+        Init_Blank(Alloc_Tail_Array(scratch));
+    PUSH_GC_GUARD(scratch);
+
+    Sort_Stable(
+        head,
+        num,
+        sizeof(REBVAL) * skip,
+        ARR_HEAD(scratch),
+        flags,
+        cmp_fn
+    );
+
+    DROP_GC_GUARD(scratch);
+    Free_Unmanaged_Series(scratch);
+}
+
+
+//
+//  Sort_Records_By_Key: C
+//
+// SORT/KEY runs the key function once per record (on the item the sort would
+// otherwise compare), instead of O(N log N) times from inside comparisons.
+// The keys are put in an array paired with the record's index, so sorting
+// that array is an ordinary native sort (and can use the radix sort, or a
+// /COMPARE function that will be given the keys).  Then the records are put
+// in the order the indices ended up in.
+//
+static void Sort_Records_By_Key(
+    const REBVAL *array,  // at the position of the first record
+    REBLEN num,
+    REBLEN skip,
+    struct sort_flags *flags,
+    const REBVAL *keyer,
+    bool stable,
+    REBLEN threads
+){
+    const REBARR *arr = VAL_ARRAY(array);
+    REBLEN index = VAL_INDEX(array);
+    REBLEN len_head = ARR_LEN(arr);
+
+    REBARR *decorated = Make_Array(num * 2);
+    PUSH_GC_GUARD(decorated);
+
+    DECLARE_LOCAL (item);
+    DECLARE_LOCAL (key);
+
+    REBLEN n;
+    for (n = 0; n < num; ++n) {
+        //
+        // The key function could modify the array, so positions are checked
+        // and fetched again each time.
+        //
+        if (ARR_LEN(arr) != len_head)
+            fail ("Array was modified by SORT/KEY function");
+
+        const RELVAL *at = ARR_AT(arr, index + n * skip + flags->offset);
+        Derelativize(item, at, VAL_SPECIFIER(array));
+
+        const bool fully = true;  // error if not all arguments consumed
+        if (RunQ_Throws(key, fully, rebU(keyer), item, rebEND))
+            fail (Error_No_Catch_For_Throw(key));
+
+        if (IS_NULLED(key))
+            fail ("SORT/KEY function returned NULL");
+
+        Copy_Cell(Alloc_Tail_Array(decorated), key);
+        Init_Integer(Alloc_Tail_Array(decorated), n);
+    }
+
+    if (ARR_LEN(arr) != len_head)
+        fail ("Array was modified by SORT/KEY function");
+
+    struct sort_flags key_flags = *flags;
+    key_flags.offset = 0;
+    Sort_Records(ARR_HEAD(decorated), num, 2, &key_flags, stable, threads);
+
+    RELVAL *head = ARR_AT(m_cast(REBARR*, arr), index);
+    REBSIZ record_size = sizeof(REBVAL) * skip;
+    REBYTE *records = TRY_ALLOC_N(REBYTE, num * record_size);
+    if (records == nullptr)
+        fail (Error_No_Memory(num * record_size));
+
+    const RELVAL *pair = ARR_HEAD(decorated);
+    for (n = 0; n < num; ++n, pair += 2)
+        memcpy(
+            records + n * record_size,
+            head + VAL_INT32(pair + 1) * skip,
+            record_size
+        );
+    memcpy(head, records, num * record_size);
+    FREE_N(REBYTE, num * record_size, records);
+
+    DROP_GC_GUARD(decorated);
+    Free_Unmanaged_Series(decorated);
+}
+
+
 //
 //  Shuffle_Array: C
 //
@@ -1199,14 +1909,26 @@ REBTYPE(Array)
                 fail (Error_Out_Of_Range(ARG(skip)));
         }
 
-        reb_qsort_r(
-            ARR_AT(arr, index),
-            len / skip,
-            sizeof(REBVAL) * skip,
-            &flags,
-            flags.comparator != nullptr ? &Compare_Val_Custom : &Compare_Val
-        );
+        REBLEN num = len / skip;
 
+        REBLEN threads = 1;
+        if (REF(threads)) {
+            REBINT n = VAL_INT32(ARG(threads));
+            if (n < 1 or n > MAX_SORT_THREADS)
+                fail (PAR(threads));
+            threads = n;
+        }
+
+        if (REF(key)) {
+            Sort_Records_By_Key(
+                array, num, skip, &flags, ARG(key), did REF(stable), threads
+            );
+            return D_OUT;
+        }
+
+        Sort_Records(
+            ARR_AT(arr, index), num, skip, &flags, did REF(stable), threads
+        );
         return D_OUT; }
 
       case SYM_RANDOM: {
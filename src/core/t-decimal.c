@@ -424,15 +424,19 @@ void MF_Decimal(REB_MOLD *mo, REBCEL(const*) v, bool form)
 {
     UNUSED(form);
 
-    REBYTE buf[60];
-    REBINT len = Emit_Decimal(
-        buf,
+    REBSTR *s = mo->series;
+    REBLEN len = STR_LEN(s);
+    REBSIZ size = STR_SIZE(s);
+
+    REBYTE *bp = Prep_Mold_Overestimated(mo, MAX_NUMCHR);
+    REBINT n = Emit_Decimal(
+        bp,
         VAL_DECIMAL(v),
         0, // e.g. not DEC_MOLD_PERCENT
         GET_MOLD_FLAG(mo, MOLD_FLAG_COMMA_PT) ? ',' : '.',
         mo->digits
     );
-    Append_Ascii_Len(mo->series, s_cast(buf), len);
+    TERM_STR_LEN_SIZE(s, len + n, size + n);
 }
 
 
@@ -445,15 +449,19 @@ void MF_Percent(REB_MOLD *mo, REBCEL(const*) v, bool form)
 {
     UNUSED(form);
 
-    REBYTE buf[60];
-    REBINT len = Emit_Decimal(
-        buf,
+    REBSTR *s = mo->series;
+    REBLEN len = STR_LEN(s);
+    REBSIZ size = STR_SIZE(s);
+
+    REBYTE *bp = Prep_Mold_Overestimated(mo, MAX_NUMCHR);
+    REBINT n = Emit_Decimal(
+        bp,
         VAL_DECIMAL(v),
         DEC_MOLD_PERCENT,
         GET_MOLD_FLAG(mo, MOLD_FLAG_COMMA_PT) ? ',' : '.',
         mo->digits
     );
-    Append_Ascii_Len(mo->series, s_cast(buf), len);
+    TERM_STR_LEN_SIZE(s, len + n, size + n);
 }
 
 
@@ -243,9 +243,13 @@ void MF_Integer(REB_MOLD *mo, REBCEL(const*) v, bool form)
 {
     UNUSED(form);
 
-    REBYTE buf[60];
-    REBINT len = Emit_Integer(buf, VAL_INT64(v));
-    Append_Ascii_Len(mo->series, s_cast(buf), len);
+    REBSTR *s = mo->series;
+    REBLEN len = STR_LEN(s);
+    REBSIZ size = STR_SIZE(s);
+
+    REBYTE *bp = Prep_Mold_Overestimated(mo, MAX_INT_LEN + 1);
+    REBINT n = Emit_Integer(bp, VAL_INT64(v));
+    TERM_STR_LEN_SIZE(s, len + n, size + n);
 }
 
 
@@ -52,6 +52,7 @@ REBMAP *Make_Map(REBLEN capacity)
 {
     REBARR *pairlist = Make_Array_Core(capacity * 2, SERIES_MASK_PAIRLIST);
     mutable_LINK(Hashlist, pairlist) = Make_Hash_Series(capacity);
+    SET_SUBCLASS_FLAG(PAIRLIST, pairlist, SYMBOL_KEYS);  // no keys yet
 
     return MAP(pairlist);
 }
@@ -119,9 +120,21 @@ REBINT Find_Key_Hashed(
     //
     REBINT synonym_slot = -1; // no synonyms seen yet...
 
+    // Keys that are equal (even just caselessly) have the same hash, so a
+    // key whose control byte has a different fragment of it can be skipped
+    // without looking at it in the array.
+    //
+    REBYTE *controls = HASHLIST_CONTROLS(hashlist);
+    REBYTE fragment = Hash_Fragment(hash);
+
     REBLEN n;
     while ((n = indexes[slot]) != 0) {
-        RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
+        REBYTE control = controls[slot];
+        RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key (no deref yet)
+
+        if ((control & ~HASH_ZOMBIE_HINT) != fragment)
+            goto check_zombie;
+
         if (0 == Cmp_Value(k, key, true)) {
             if (strict)
                 return slot; // don't need to check synonyms, stop looking
@@ -139,8 +152,14 @@ REBINT Find_Key_Hashed(
             }
         }
 
-        if (wide > 1 && IS_NULLED(k + 1) && zombie_slot == -1)
+      check_zombie:
+
+        if (
+            (control & HASH_ZOMBIE_HINT)
+            and wide > 1 and zombie_slot == -1 and IS_NULLED(k + 1)
+        ){
             zombie_slot = slot;
+        }
 
         slot += skip;
         if (slot >= used)
@@ -152,15 +171,17 @@ REBINT Find_Key_Hashed(
         return synonym_slot; // there weren't other spellings of the same key
     }
 
-    if (zombie_slot != -1) { // zombie encountered; overwrite with new key
-        assert(mode == 0);
+    if (zombie_slot != -1 and mode == 0) {  // overwrite zombie with new key
         slot = zombie_slot;
         Derelativize(
             ARR_AT(array, (indexes[slot] - 1) * wide),
             key,
             specifier
         );
+        controls[slot] = fragment | HASH_ZOMBIE_HINT;  // value still null
     }
+    else
+        controls[slot] = fragment;  // caller may fill the empty slot
 
     if (mode > 1) { // append new value to the target series
         const RELVAL *src = key;
@@ -175,49 +196,203 @@ REBINT Find_Key_Hashed(
 }
 
 
+//
+//  Find_Symbol_Hashed: C
+//
+// Version of Find_Key_Hashed() for maps whose keys are all unquoted words,
+// looking up a key that is also an unquoted word.  (See the SYMBOL_KEYS flag
+// in %sys-map.h.)  Since spellings are interned, two words are the same key
+// when they are of the same type and have the same symbol pointer.  For a
+// caseless match, the symbols only have to be on the same ring of synonyms.
+// This skips all the dispatch Cmp_Value() does to get to Compare_Spellings().
+//
+// The hash still has to come from the spelling, because it has to agree for
+// all the synonyms--and which of those is the canon can change if it's GC'd.
+//
+// Modes are 0 and 1, as in Find_Key_Hashed().
+//
+static REBINT Find_Symbol_Hashed(
+    REBARR *pairlist,
+    REBSER *hashlist,
+    const RELVAL *key,
+    REBSPC *specifier,
+    bool strict,
+    REBYTE mode
+){
+    assert(mode <= 1);
+
+    enum Reb_Kind kind = VAL_TYPE(key);
+    assert(ANY_WORD_KIND(kind));
+    const REBSYM *symbol = VAL_WORD_SYMBOL(key);
+
+    REBLEN used = SER_USED(hashlist);
+    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
+
+    uint32_t hash = Hash_String(symbol);  // what Hash_Value() gives for words
+    REBLEN slot = hash % used;
+    REBLEN skip = hash % (used - 1) + 1;
+
+    REBYTE *controls = HASHLIST_CONTROLS(hashlist);
+    REBYTE fragment = Hash_Fragment(hash);
+
+    REBINT zombie_slot = -1;
+    REBINT synonym_slot = -1;
+
+    REBLEN n;
+    while ((n = indexes[slot]) != 0) {
+        REBYTE control = controls[slot];
+        RELVAL *k = ARR_AT(pairlist, (n - 1) * 2);
+
+        if ((control & ~HASH_ZOMBIE_HINT) != fragment or VAL_TYPE(k) != kind)
+            goto check_zombie;
+
+        if (VAL_WORD_SYMBOL(k) == symbol) {
+            if (strict)
+                return slot;
+            goto found_synonym;
+        }
+
+        if (not strict and Are_Synonyms(VAL_WORD_SYMBOL(k), symbol)) {
+
+          found_synonym:;
+
+            if (synonym_slot != -1)
+                fail (Error_Conflicting_Key(key, specifier));
+            synonym_slot = slot;
+        }
+
+      check_zombie:
+
+        if (
+            (control & HASH_ZOMBIE_HINT)
+            and zombie_slot == -1 and IS_NULLED(k + 1)
+        ){
+            zombie_slot = slot;
+        }
+
+        slot += skip;
+        if (slot >= used)
+            slot -= used;
+    }
+
+    if (synonym_slot != -1)
+        return synonym_slot;
+
+    if (mode == 1)
+        return -1;
+
+    if (zombie_slot != -1) {
+        slot = zombie_slot;
+        Derelativize(
+            ARR_AT(pairlist, (indexes[slot] - 1) * 2),
+            key,
+            specifier
+        );
+        controls[slot] = fragment | HASH_ZOMBIE_HINT;  // value still null
+    }
+    else
+        controls[slot] = fragment;  // caller may fill the empty slot
+
+    return slot;
+}
+
+
+//
+//  Find_Map_Key: C
+//
+static REBINT Find_Map_Key(
+    REBARR *pairlist,
+    REBSER *hashlist,
+    const RELVAL *key,
+    REBSPC *specifier,
+    bool strict,
+    REBYTE mode
+){
+    if (GET_SUBCLASS_FLAG(PAIRLIST, pairlist, SYMBOL_KEYS))
+        return Find_Symbol_Hashed(
+            pairlist, hashlist, key, specifier, strict, mode
+        );
+
+    const REBLEN wide = 2;
+    return Find_Key_Hashed(
+        pairlist, hashlist, key, specifier, wide, strict, mode
+    );
+}
+
+
+//
+//  Insert_Record_Hashed: C
+//
+// Put a record number in the first empty slot on the probe sequence for its
+// key.  This is for rebuilding hashlists from records known to be distinct,
+// so no comparisons against the keys in the other slots are needed.
+//
+static void Insert_Record_Hashed(
+    REBSER *hashlist,
+    const RELVAL *key,  // !!! assumes ++key finds the value
+    REBLEN n
+){
+    REBLEN used = SER_USED(hashlist);
+    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
+
+    uint32_t hash = Hash_Value(key);
+    REBLEN slot = hash % used;
+    REBLEN skip = hash % (used - 1) + 1;
+
+    while (indexes[slot] != 0) {
+        slot += skip;
+        if (slot >= used)
+            slot -= used;
+    }
+
+    indexes[slot] = n;
+
+    REBYTE control = Hash_Fragment(hash);
+    if (IS_NULLED(key + 1))
+        control |= HASH_ZOMBIE_HINT;
+    HASHLIST_CONTROLS(hashlist)[slot] = control;
+}
+
+
 //
 //  Rehash_Map: C
 //
-// Recompute the entire hash table for a map. Table must be large enough.
+// Recompute the entire hash table for a map, squeezing "zombies" (records
+// with null values) out of the pairlist.  Table must be large enough, and
+// cleared.  Order of the remaining records is preserved.
 //
 static void Rehash_Map(REBMAP *map)
 {
     REBSER *hashlist = MAP_HASHLIST(map);
+    assert(not Is_Hashlist_Migrating(hashlist));
 
-    if (!hashlist) return;
-
-    REBLEN *hashes = SER_HEAD(REBLEN, hashlist);
     REBARR *pairlist = MAP_PAIRLIST(map);
+    REBLEN records = ARR_LEN(pairlist) / 2;
 
-    REBVAL *key = SPECIFIC(ARR_HEAD(pairlist));
-    REBLEN n;
+    const RELVAL *tail = ARR_TAIL(pairlist);
+    REBVAL *src = SPECIFIC(ARR_HEAD(pairlist));
+    REBVAL *dest = src;
+    REBLEN n = 0;
 
-    for (n = 0; n < ARR_LEN(pairlist); n += 2, key += 2) {
-        const bool cased = true; // cased=true is always fine
+    for (; src != tail; src += 2) {
+        if (IS_NULLED(src + 1))
+            continue;  // zombie, drop it
 
-        if (IS_NULLED(key + 1)) {
-            //
-            // It's a "zombie", move last key to overwrite it
-            //
-            Copy_Cell(
-                key, SPECIFIC(ARR_AT(pairlist, ARR_LEN(pairlist) - 2))
-            );
-            Copy_Cell(
-                &key[1], SPECIFIC(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))
-            );
-            SET_SERIES_LEN(pairlist, ARR_LEN(pairlist) - 2);
+        if (dest != src) {
+            Copy_Cell(dest, src);
+            Copy_Cell(dest + 1, src + 1);
         }
+        ++n;
+        Insert_Record_Hashed(hashlist, dest, n);
+        dest += 2;
+    }
 
-        REBLEN hash = Find_Key_Hashed(
-            pairlist, hashlist, key, SPECIFIED, 2, cased, 0
-        );
-        hashes[hash] = n / 2 + 1;
+    SET_SERIES_LEN(pairlist, n * 2);
+    hashlist->misc.zombies = 0;
 
-        // discard zombies at end of pairlist
-        //
-        while (IS_NULLED(ARR_AT(pairlist, ARR_LEN(pairlist) - 1))) {
-            SET_SERIES_LEN(pairlist, ARR_LEN(pairlist) - 2);
-        }
+    if (n != records) {
+        ++TG_Map_Compactions;
+        TG_Map_Zombies_Removed += records - n;
     }
 }
 
@@ -234,7 +409,7 @@ void Expand_Hash(REBSER *ser)
     REBINT prime = Get_Hash_Prime_May_Fail(SER_USED(ser) + 1);
     Remake_Series(
         ser,
-        prime + 1,
+        Hash_Series_Capacity(prime),
         SERIES_FLAG_POWER_OF_2  // not(NODE_FLAG_NODE) => don't keep data
     );
 
@@ -243,6 +418,105 @@ void Expand_Hash(REBSER *ser)
 }
 
 
+// Records moved from the old hashlist to the new one on each map operation
+// while a map is growing.  Growth won't be needed again until at least as
+// many records are added as the map had when it started, so any step of 1
+// or more is enough to finish first (extra helps maps that are mostly read).
+//
+#define MAP_MIGRATE_STEP 4
+
+
+//
+//  Migrate_Map_Records: C
+//
+// Index up to `limit` records in the hashlist of a growing map which were
+// only indexed in the hashlist it grew from.  This ends the growth if there
+// are none left, letting the GC have the old hashlist.
+//
+static void Migrate_Map_Records(REBMAP *map, REBLEN limit)
+{
+    REBSER *hashlist = MAP_HASHLIST(map);
+    REBSER *old = LINK(Old_Hashlist, hashlist);
+    REBARR *pairlist = MAP_PAIRLIST(map);
+
+    for (; limit != 0 and old->misc.unmigrated != 0; --limit) {
+        REBLEN n = old->misc.unmigrated--;
+        Insert_Record_Hashed(hashlist, ARR_AT(pairlist, (n - 1) * 2), n);
+        ++TG_Map_Records_Migrated;
+    }
+
+    if (old->misc.unmigrated == 0) {
+        node_LINK(Old_Hashlist, hashlist) = nullptr;
+        CLEAR_SERIES_FLAG(hashlist, LINK_NODE_NEEDS_MARK);
+    }
+}
+
+
+//
+//  Finish_Map_Migration: C
+//
+// Operations that treat the hashlist as a whole (like COPY) want it to be
+// indexing all the records.
+//
+static void Finish_Map_Migration(REBMAP *map)
+{
+    if (Is_Hashlist_Migrating(MAP_HASHLIST(map)))
+        Migrate_Map_Records(map, ARR_LEN(MAP_PAIRLIST(map)) / 2);
+}
+
+
+//
+//  Grow_Map: C
+//
+// Called when the pairlist has more records than a quarter of the slots in
+// the hashlist.  If a quarter or more of the records are zombies, it's
+// better to squeeze them out and rebuild the hashlist at the same size.
+//
+// Otherwise a bigger hashlist is made.  A managed map swaps it in and then
+// migrates to it a few records per operation, so that the operation which
+// crosses the threshold doesn't pause for as long as rehashing the whole map
+// would take.  Unmanaged maps (such as ones MAKE MAP! is still filling) are
+// just rehashed all at once, as they aren't being handed out yet.
+//
+static void Grow_Map(REBMAP *map)
+{
+    Finish_Map_Migration(map);  // started growing again before done, rare
+
+    REBARR *pairlist = MAP_PAIRLIST(map);
+    REBSER *hashlist = MAP_HASHLIST(map);
+    REBLEN records = ARR_LEN(pairlist) / 2;
+
+    if (hashlist->misc.zombies * 4 >= records) {
+        REBLEN used = SER_USED(hashlist);
+        Clear_Series(hashlist);
+        SET_SERIES_LEN(hashlist, used);
+        Rehash_Map(map);
+        return;
+    }
+
+    if (NOT_SERIES_FLAG(pairlist, MANAGED)) {
+        Expand_Hash(hashlist);
+        Rehash_Map(map);
+        return;
+    }
+
+    assert(GET_SERIES_FLAG(hashlist, MANAGED));  // Init_Map() does both
+
+    REBSER *bigger = Make_Hash_Series((SER_USED(hashlist) + 2) / 2);
+    bigger->misc.zombies = hashlist->misc.zombies;
+    Manage_Series(bigger);
+
+    mutable_LINK(Old_Hashlist, bigger) = hashlist;
+    SET_SERIES_FLAG(bigger, LINK_NODE_NEEDS_MARK);
+    hashlist->misc.unmigrated = records;  // zombie count no longer needed
+
+    mutable_LINK(Hashlist, pairlist) = bigger;
+    GC_Write_Barrier(pairlist);
+
+    ++TG_Map_Migrations;
+}
+
+
 //
 //  Find_Map_Entry: C
 //
@@ -261,25 +535,72 @@ REBLEN Find_Map_Entry(
 ) {
     assert(not IS_NULLED(key));
 
-    REBSER *hashlist = MAP_HASHLIST(map); // can be null
     REBARR *pairlist = MAP_PAIRLIST(map);
 
-    assert(hashlist);
+    assert(MAP_HASHLIST(map));
 
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_USED(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
-        Rehash_Map(map);
+    // A key that isn't an unquoted word takes the map out of symbol-keyed
+    // mode...unless it can't be equal to a word even caselessly (quoted
+    // words are equal to plain ones then), and it's not being added.
+    //
+    if (
+        GET_SUBCLASS_FLAG(PAIRLIST, pairlist, SYMBOL_KEYS)
+        and not ANY_WORD_KIND(VAL_TYPE(key))
+    ){
+        if (
+            not ANY_WORD_KIND(CELL_KIND(VAL_UNESCAPED(key)))
+            and (val == nullptr or IS_NULLED(val))
+        ){
+            return 0;
+        }
+        CLEAR_SUBCLASS_FLAG(PAIRLIST, pairlist, SYMBOL_KEYS);
     }
 
-    const REBLEN wide = 2;
-    const REBYTE mode = 0; // just search for key, don't add it
-    REBLEN slot = Find_Key_Hashed(
-        pairlist, hashlist, key, key_specifier, wide, strict, mode
-    );
+    // Get hash table, expand it if needed:
+    if (ARR_LEN(pairlist) > SER_USED(MAP_HASHLIST(map)) / 2)
+        Grow_Map(map);
+    else if (Is_Hashlist_Migrating(MAP_HASHLIST(map)))
+        Migrate_Map_Records(map, MAP_MIGRATE_STEP);
 
+    REBSER *hashlist = MAP_HASHLIST(map);  // may have been changed by growth
     REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
-    REBLEN n = indexes[slot];
+
+    REBLEN n = 0;
+    REBYTE *control = nullptr;  // of the slot indexing the record, for hints
+    REBINT slot = -1;  // slot to fill if not found
+
+    REBINT old_slot = -1;
+    if (Is_Hashlist_Migrating(hashlist)) {
+        //
+        // Records that haven't (all) been moved over yet are indexed by the
+        // old hashlist, which is searched without reusing zombies...since
+        // new keys must only go in the new hashlist.  Records added since
+        // the growth started are only in the new one.
+        //
+        REBSER *old = LINK(Old_Hashlist, hashlist);
+        old_slot = Find_Map_Key(pairlist, old, key, key_specifier, strict, 1);
+        if (old_slot != -1) {
+            n = SER_HEAD(REBLEN, old)[old_slot];
+            control = &HASHLIST_CONTROLS(old)[old_slot];
+
+            if (not strict) {  // a synonym may be only in the new hashlist
+                REBINT new_slot = Find_Map_Key(
+                    pairlist, hashlist, key, key_specifier, strict, 1
+                );
+                if (new_slot != -1 and indexes[new_slot] != n)
+                    fail (Error_Conflicting_Key(key, key_specifier));
+            }
+        }
+    }
+
+    if (old_slot == -1) {
+        const REBYTE mode = 0; // just search for key, don't add it
+        slot = Find_Map_Key(
+            pairlist, hashlist, key, key_specifier, strict, mode
+        );
+        n = indexes[slot];
+        control = &HASHLIST_CONTROLS(hashlist)[slot];
+    }
 
     // n==0 or pairlist[(n-1)*]=~key
 
@@ -295,11 +616,24 @@ REBLEN Find_Map_Entry(
 
     // Must set the value:
     if (n) {  // re-set it:
-        Derelativize(
-            ARR_AT(pairlist, ((n - 1) * 2) + 1),
-            val,
-            val_specifier
-        );
+        RELVAL *v = ARR_AT(pairlist, ((n - 1) * 2) + 1);
+        bool was_zombie = IS_NULLED(v);
+        Derelativize(v, val, val_specifier);
+
+        // Setting to null leaves a "zombie" that Find_Key_Hashed() may reuse
+        // (the hint may be left stale in one hashlist while growing, but that
+        // only means a zombie gets checked for or reused less eagerly)
+        //
+        if (IS_NULLED(val)) {
+            *control |= HASH_ZOMBIE_HINT;
+            if (not was_zombie)
+                ++hashlist->misc.zombies;
+        }
+        else {
+            *control &= ~HASH_ZOMBIE_HINT;
+            if (was_zombie)
+                --hashlist->misc.zombies;
+        }
         return n;
     }
 
@@ -308,6 +642,7 @@ REBLEN Find_Map_Entry(
     // Create new entry.  Note that it does not copy underlying series (e.g.
     // the data of a string), which is why the immutability test is necessary
     //
+    assert(slot != -1);
     Append_Value_Core(pairlist, key, key_specifier);
     Append_Value_Core(pairlist, val, val_specifier);
 
@@ -440,6 +775,8 @@ REB_R MAKE_Map(
 
 
 inline static REBMAP *Copy_Map(const REBMAP *map, REBU64 types) {
+    Finish_Map_Migration(m_cast(REBMAP*, map));  // doesn't change contents
+
     REBARR *copy = Copy_Array_Shallow_Flags(
         MAP_PAIRLIST(map),
         SPECIFIED,
@@ -450,12 +787,13 @@ inline static REBMAP *Copy_Map(const REBMAP *map, REBU64 types) {
     // a literal copy of the hashlist can still be used, as a start (needs
     // its own copy so new map's hashes will reflect its own mutations)
     //
-    REBSER *hashlist = Copy_Series_Core(
+    REBSER *hashlist = Copy_Hash_Series(
         MAP_HASHLIST(map),
-        SERIES_FLAGS_NONE | FLAG_FLAVOR(HASHLIST)
-            // ^-- !!! No NODE_FLAG_MANAGED?
+        SERIES_FLAGS_NONE  // !!! No NODE_FLAG_MANAGED?
     );
     mutable_LINK(Hashlist, copy) = hashlist;
+    if (GET_SUBCLASS_FLAG(PAIRLIST, MAP_PAIRLIST(map), SYMBOL_KEYS))
+        SET_SUBCLASS_FLAG(PAIRLIST, copy, SYMBOL_KEYS);
 
     if (types == 0)
         return MAP(copy); // no types have deep copy requested, shallow is OK
@@ -785,11 +1123,18 @@ REBTYPE(Map)
         REBMAP *m = VAL_MAP_ENSURE_MUTABLE(map);
 
         Reset_Array(MAP_PAIRLIST(m));
+        SET_SUBCLASS_FLAG(PAIRLIST, MAP_PAIRLIST(m), SYMBOL_KEYS);
 
         // !!! Review: should the space for the hashlist be reclaimed?  This
         // clears all the indices but doesn't scale back the size.
         //
-        Clear_Series(MAP_HASHLIST(m));
+        REBSER *hashlist = MAP_HASHLIST(m);
+        Clear_Series(hashlist);
+        hashlist->misc.zombies = 0;
+        if (Is_Hashlist_Migrating(hashlist)) {  // old one has nothing to keep
+            node_LINK(Old_Hashlist, hashlist) = nullptr;
+            CLEAR_SERIES_FLAG(hashlist, LINK_NODE_NEEDS_MARK);
+        }
 
         return Init_Map(D_OUT, m); }
 
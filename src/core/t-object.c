@@ -95,11 +95,20 @@ static void Append_To_Context(REBVAL *context, REBVAL *arg)
 
   blockscope {  // Append new words to obj
     REBLEN num_added = Collector_Index_If_Pushed(&collector) - first_new_index;
-    Expand_Context(c, num_added);
-
     STKVAL(*) new_word = DS_AT(collector.dsp_orig) + first_new_index;
-    for (; new_word != DS_TOP + 1; ++new_word)
-        Append_Context(c, nullptr, VAL_WORD_SYMBOL(new_word));
+
+    REBLEN hash;
+    if (
+        num_added != 0
+        and not Did_Transition_Keylist_Shape(&hash, c, new_word)
+    ){
+        Expand_Context(c, num_added);
+
+        for (; new_word != DS_TOP + 1; ++new_word)
+            Append_Context(c, nullptr, VAL_WORD_SYMBOL(new_word));
+
+        Remember_Transition_Shape(c, hash);
+    }
   }
 
   blockscope {  // Set new values to obj words
@@ -405,9 +414,18 @@ REB_R PD_Context(
     // See if the binding of the word is already to the context (so there's
     // no need to go hunting).  'x
     //
+    // Otherwise objects use the field index cache, which is good for all
+    // objects of the same shape (see TG_Field_Cache).  That helps `rec/field`
+    // in a loop that goes over many records.
+    //
     REBLEN n;
     if (BINDING(picker) == c)
         n = VAL_WORD_INDEX(picker);
+    else if (CTX_TYPE(c) == REB_OBJECT) {
+        n = Find_Field_In_Object(pvs->out, picker);
+        if (n == 0)
+            return R_UNHANDLED;
+    }
     else {
         const bool strict = false;
         n = Find_Symbol_In_Context(pvs->out, VAL_WORD_SYMBOL(picker), strict);
@@ -565,6 +583,9 @@ REBCTX *Copy_Context_Extra_Managed(
 
     REBCTX *copy = CTX(varlist); // now a well-formed context
 
+    if (CTX_TYPE(original) != REB_FRAME)
+        Prepare_Keylist_For_Derivation(original);
+
     if (extra == 0)
         INIT_CTX_KEYLIST_SHARED(copy, CTX_KEYLIST(original));  // ->link field
     else {
@@ -65,6 +65,19 @@ REBINT CT_String(REBCEL(const*) a, REBCEL(const*) b, bool strict)
     REBLEN len = MIN(l1, l2);
 
     for (; len > 0; len--) {
+        //
+        // Skip over what's the same in any ASCII run.  Each byte in such a
+        // run is a codepoint, and both have at least `len` bytes left.
+        //
+        REBLEN same = Ascii_Match_Len(
+            cast(const REBYTE*, cp1), cast(const REBYTE*, cp2), len, strict
+        );
+        if (same == len)
+            break;
+        cp1 = cast(REBCHR(const*), cast(const REBYTE*, cp1) + same);
+        cp2 = cast(REBCHR(const*), cast(const REBYTE*, cp2) + same);
+        len -= same;
+
         REBUNI c1;
         REBUNI c2;
 
@@ -346,7 +359,7 @@ enum COMPARE_CHR_FLAGS {
 //
 //  Compare_Chr: C
 //
-// This function is called by qsort_r, on behalf of the string sort
+// This function is called by Sort_Unstable() or Sort_Stable(), for the sort
 // function.  The `thunk` is an argument passed through from the caller
 // and given to us by the sort routine, which tells us about the string
 // and the kind of sort that was requested.
@@ -1105,7 +1118,7 @@ REBTYPE(String)
         // the codepoints were known to be ASCII range in the memory of
         // interest, maybe common case.
 
-        if (REF(compare))
+        if (REF(compare) or REF(key))
             fail (Error_Bad_Refines_Raw());  // !!! not in R3-Alpha
 
         Copy_Cell(D_OUT, v);  // before index modification
@@ -1135,13 +1148,20 @@ REBTYPE(String)
         if (REF(reverse))
             thunk |= CC_FLAG_REVERSE;
 
-        reb_qsort_r(
-            data_at,
-            len,
-            size * sizeof(REBYTE),  // only ASCII for now
-            &thunk,
-            Compare_Chr
-        );
+        if (REF(stable)) {
+            REBBIN *scratch = Make_Binary((len / 2) * size);  // merge space
+            Sort_Stable(
+                data_at,
+                len,
+                size,  // only ASCII for now
+                BIN_HEAD(scratch),
+                &thunk,
+                Compare_Chr
+            );
+            Free_Unmanaged_Series(scratch);
+        }
+        else
+            Sort_Unstable(data_at, len, size, &thunk, Compare_Chr);
         return D_OUT; }
 
       case SYM_RANDOM: {
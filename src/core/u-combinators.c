@@ -0,0 +1,325 @@
+//
+//  File: %u-combinators.c
+//  Summary: "native implementations of leaf UPARSE combinators"
+//  Section: utility
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// UPARSE in %src/mezz/uparse.reb is built from "combinators", which are
+// functions that take an INPUT position and a STATE frame and either give
+// back a NULL for no match, or a result and a REMAINDER position.  All of
+// them are written in usermode, which makes the dialect easy to extend but
+// means that even matching a single TEXT! literal runs a FIND/MATCH along
+// with a CASE and several SET and RETURN calls through the evaluator.
+//
+// The leaf combinators--the ones that match literal TEXT!, ISSUE!, BINARY!
+// and BITSET! values--are by far the most frequently called, as every other
+// combinator eventually bottoms out in one of them.  The natives here are
+// drop-in replacements that follow the same protocol (same parameter names,
+// same return convention, same output for the remainder) so that UPARSE can
+// ENCLOSE them with the same hook used for usermode COMBINATOR functions.
+//
+// Combinators that run other parsers (OPT, SOME, WHILE, BLOCK! sequencing
+// and alternation, COLLECT...) are not here.  Those must go back through
+// the evaluator to call the parsers they were given, so a native version
+// would save little of the overhead.
+//
+// The semantics must match the usermode versions exactly, including quirks
+// inherited from FIND (e.g. ISSUE! being caseless on strings unless /CASE).
+//
+
+#include "sys-core.h"
+
+
+//
+//  Is_Uparse_Case: C
+//
+// The STATE passed to combinators is the UPARSE* frame, so the /CASE setting
+// is looked up as a field of it (like `state.case` would in usermode).
+//
+static bool Is_Uparse_Case(const REBVAL *state)
+{
+    REBVAL *var = Select_Symbol_In_Context(state, Canon(SYM_CASE));
+    return var and IS_TRUTHY(var);
+}
+
+
+//
+//  Match_Literal_Array_Item: C
+//
+// On array input the literal is compared with lax equality to the item at
+// the input position, like `input.1 = value`.  The *item* is the result for
+// all the literal combinators in this case (not the rule).
+//
+static bool Match_Literal_Array_Item(
+    REBVAL *out,
+    REBVAL *remainder,
+    const REBVAL *input,
+    const REBVAL *value
+){
+    const RELVAL *tail;
+    const RELVAL *at = VAL_ARRAY_AT(&tail, input);
+    if (at == tail)
+        return false;  // `input.1` is null, which never equals the value
+
+    Derelativize(out, at, VAL_SPECIFIER(input));
+
+    DECLARE_LOCAL (item);  // Compare_Modify_Values() may coerce its cells
+    Copy_Cell(item, out);
+    DECLARE_LOCAL (rule);
+    Copy_Cell(rule, value);
+
+    bool strict = false;
+    if (Compare_Modify_Values(item, rule, strict) != 0)
+        return false;
+
+    Copy_Cell(remainder, input);
+    ++VAL_INDEX_RAW(remainder);
+    return true;
+}
+
+
+//
+//  Match_Literal_Binstr: C
+//
+// On string or binary input the combinators do a FIND/MATCH at the input
+// position, giving back the input advanced past the match.  The not-found
+// tests mirror those of the string and binary FIND, which differ on what
+// they do for an empty pattern at the tail.
+//
+static bool Match_Literal_Binstr(
+    REBVAL *remainder,
+    const REBVAL *input,
+    const REBVAL *pattern,
+    REBFLGS flags
+){
+    REBLEN tail = VAL_LEN_HEAD(input);
+
+    REBLEN len;
+    REBLEN ret = Find_Value_In_Binstr(
+        &len, input, tail, pattern, flags | AM_FIND_MATCH, 1
+    );
+
+    if (IS_BINARY(input)) {
+        if (ret >= tail)
+            return false;
+    }
+    else {
+        if (ret == NOT_FOUND)
+            return false;
+        assert(ret <= tail);
+    }
+
+    Init_Any_Series_At(remainder, VAL_TYPE(input), VAL_SERIES(input), ret + len);
+    return true;
+}
+
+
+// All the natives share their first few parameters with what COMBINATOR
+// generates for usermode combinators, so that COMBINATORIZE can fill them.
+// The remainder is written through the WORD! given for the output, if any.
+//
+static REB_R Finish_Combinator(
+    REBFRM *frame_,
+    const REBVAL *remainder_var,
+    const REBVAL *remainder
+){
+    if (not IS_NULLED(remainder_var))
+        Copy_Cell(Sink_Word_May_Fail(remainder_var, SPECIFIED), remainder);
+    return D_OUT;
+}
+
+
+//
+//  text-combinator: native [
+//
+//  {Native TEXT! combinator for UPARSE}
+//
+//      return: "The rule series matched against (not input value)"
+//          [<opt> text!]
+//      remainder: "<output>"
+//          [<opt> any-series!]
+//      state [frame!]
+//      input [any-series!]
+//      value [text!]
+//  ]
+//
+REBNATIVE(text_combinator)
+//
+// Matching is case-sensitive only if UPARSE was called with /CASE, except
+// on BINARY! input where the text is aliased `AS BINARY!` and matched bytewise.
+{
+    INCLUDE_PARAMS_OF_TEXT_COMBINATOR;
+
+    REBVAL *input = ARG(input);
+    REBVAL *value = ARG(value);
+
+    if (ANY_ARRAY(input)) {
+        if (not Match_Literal_Array_Item(D_OUT, D_SPARE, input, value))
+            return nullptr;
+        return Finish_Combinator(frame_, ARG(remainder), D_SPARE);
+    }
+
+    REBFLGS flags;
+    if (IS_BINARY(input))
+        flags = AM_FIND_CASE;  // `as binary! value` compares bytes exactly
+    else
+        flags = Is_Uparse_Case(ARG(state)) ? AM_FIND_CASE : 0;
+
+    if (not Match_Literal_Binstr(D_SPARE, input, value, flags))
+        return nullptr;
+
+    Copy_Cell(D_OUT, value);
+    return Finish_Combinator(frame_, ARG(remainder), D_SPARE);
+}
+
+
+//
+//  issue-combinator: native [
+//
+//  {Native ISSUE! (TOKEN!) combinator for UPARSE}
+//
+//      return: "The token matched against (not input value)"
+//          [<opt> issue!]
+//      remainder: "<output>"
+//          [<opt> any-series!]
+//      state [frame!]
+//      input [any-series!]
+//      value [issue!]
+//  ]
+//
+REBNATIVE(issue_combinator)
+//
+// !!! The usermode version does a FIND/MATCH without /CASE on strings, so
+// it matches caselessly there regardless of UPARSE's /CASE setting.  That
+// is replicated here, but it's probably not what the comments intend.
+{
+    INCLUDE_PARAMS_OF_ISSUE_COMBINATOR;
+
+    REBVAL *input = ARG(input);
+    REBVAL *value = ARG(value);
+    UNUSED(ARG(state));
+
+    if (ANY_ARRAY(input)) {
+        if (not Match_Literal_Array_Item(D_OUT, D_SPARE, input, value))
+            return nullptr;
+        return Finish_Combinator(frame_, ARG(remainder), D_SPARE);
+    }
+
+    REBFLGS flags = IS_BINARY(input) ? AM_FIND_CASE : 0;
+    if (not Match_Literal_Binstr(D_SPARE, input, value, flags))
+        return nullptr;
+
+    Copy_Cell(D_OUT, value);
+    return Finish_Combinator(frame_, ARG(remainder), D_SPARE);
+}
+
+
+//
+//  binary-combinator: native [
+//
+//  {Native BINARY! combinator for UPARSE}
+//
+//      return: "The binary matched against (not input value)"
+//          [<opt> binary!]
+//      remainder: "<output>"
+//          [<opt> any-series!]
+//      state [frame!]
+//      input [any-series!]
+//      value [binary!]
+//  ]
+//
+REBNATIVE(binary_combinator)
+{
+    INCLUDE_PARAMS_OF_BINARY_COMBINATOR;
+
+    REBVAL *input = ARG(input);
+    REBVAL *value = ARG(value);
+    UNUSED(ARG(state));
+
+    if (ANY_ARRAY(input)) {
+        if (not Match_Literal_Array_Item(D_OUT, D_SPARE, input, value))
+            return nullptr;
+        return Finish_Combinator(frame_, ARG(remainder), D_SPARE);
+    }
+
+    if (not IS_BINARY(input))
+        fail ("Can't match BINARY! against TEXT! (use AS to alias)");
+
+    if (not Match_Literal_Binstr(D_SPARE, input, value, 0))
+        return nullptr;
+
+    Copy_Cell(D_OUT, value);
+    return Finish_Combinator(frame_, ARG(remainder), D_SPARE);
+}
+
+
+//
+//  bitset-combinator: native [
+//
+//  {Native BITSET! combinator for UPARSE}
+//
+//      return: "The matched input value"
+//          [<opt> char! integer!]
+//      remainder: "<output>"
+//          [<opt> any-series!]
+//      state [frame!]
+//      input [any-series!]
+//      value [bitset!]
+//  ]
+//
+REBNATIVE(bitset_combinator)
+//
+// The usermode version tests with `find value try input.1`, and FIND on a
+// bitset without /CASE checks bits case-sensitively...so that's done here.
+{
+    INCLUDE_PARAMS_OF_BITSET_COMBINATOR;
+
+    REBVAL *input = ARG(input);
+    REBVAL *value = ARG(value);
+    UNUSED(ARG(state));
+
+    if (ANY_ARRAY(input)) {
+        if (not Match_Literal_Array_Item(D_OUT, D_SPARE, input, value))
+            return nullptr;
+        return Finish_Combinator(frame_, ARG(remainder), D_SPARE);
+    }
+
+    REBLEN index = VAL_INDEX(input);
+    if (index >= VAL_LEN_HEAD(input))
+        return nullptr;  // `try input.1` gives BLANK!, never found
+
+    const bool uncased = false;
+
+    if (IS_BINARY(input)) {
+        REBYTE b = *BIN_AT(VAL_BINARY(input), index);
+        if (not Check_Bit(VAL_BITSET(value), b, uncased))
+            return nullptr;
+        Init_Integer(D_OUT, b);
+    }
+    else {
+        REBUNI c = GET_CHAR_AT(VAL_STRING(input), index);
+        if (not Check_Bit(VAL_BITSET(value), c, uncased))
+            return nullptr;
+        Init_Char_Unchecked(D_OUT, c);
+    }
+
+    Copy_Cell(D_SPARE, input);
+    ++VAL_INDEX_RAW(D_SPARE);
+    return Finish_Combinator(frame_, ARG(remainder), D_SPARE);
+}
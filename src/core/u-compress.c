@@ -28,8 +28,14 @@
 //
 // Options are offered for using zlib envelope, gzip envelope, or raw deflate.
 //
-// !!! zlib is designed to do streaming compression.  While that code is
-// part of the linked in library, it's not exposed by this interface.
+// zlib's streaming is exposed by DEFLATER and INFLATER, which make a HANDLE!
+// holding a z_stream.  ZSTREAM-STEP feeds it input a piece at a time and
+// gives back what output is ready, so data of any size can be processed in
+// constant memory.
+//
+// COMPRESS-BYTES and DECOMPRESS-BYTES default to an LZ4 codec written here,
+// which is many times faster than DEFLATE but makes bigger output.  It's what
+// the interpreter uses for its own cache files.
 //
 // !!! Since the zlib code/API isn't actually modified, one could dynamically
 // link to a zlib on the platform instead of using the extracted version.
@@ -38,6 +44,18 @@
 #include "sys-core.h"
 #include "sys-zlib.h"
 
+#if defined(USE_PARALLEL_DEFLATE)
+    #define PARALLEL_DEFLATE
+    #include <pthread.h>
+#endif
+
+#define MAX_DEFLATE_THREADS 64
+
+// Blocks smaller than this aren't worth a thread of their own (the same
+// block size the parallel gzip "pigz" uses)
+//
+#define DEFLATE_BLOCK_MIN (128 * 1024)
+
 
 //
 //  Bytes_To_U32_BE: C
@@ -215,6 +233,284 @@ REBYTE *Compress_Alloc_Core(
 }
 
 
+//=//// PARALLEL DEFLATE //////////////////////////////////////////////////=//
+//
+// DEFLATE/THREADS splits the input into a block per thread, and each block
+// is deflated as its own raw stream.  All but the last end with a sync flush
+// instead of a final block, so the streams can just be put end to end.  A
+// block's window is primed with the 32K of input before it, so matches
+// across the seam aren't lost.  (This is how "pigz" works.)  The checksums
+// of the blocks are combined, and the envelope is written around it all.
+//
+// Streams are made on the calling thread with rebMalloc(), so a fail() frees
+// them.  deflate() allocates nothing after deflateInit2(), so the threads
+// touch no memory but their own.
+//
+
+struct Reb_Deflate_Job {
+    z_stream strm;
+    const REBYTE *dict;  // input before the block, or nullptr
+    uInt dict_size;
+    const REBYTE *in;
+    REBSIZ in_size;
+    bool last;
+    REBYTE *out;  // part of the shared output, `out_size` big
+    REBSIZ out_size;
+    uLong check;  // ADLER32 or CRC32 of the block, for the envelope
+    enum Reb_Symbol_Id envelope;
+    int ret;
+};
+
+static void Run_Deflate_Job(struct Reb_Deflate_Job *job)
+{
+    if (job->envelope == SYM_GZIP)
+        job->check = Checksum_CRC32(0, job->in, job->in_size);
+    else if (job->envelope == SYM_ZLIB)
+        job->check = Checksum_Adler32(1, job->in, job->in_size);
+
+    if (job->dict) {
+        job->ret = deflateSetDictionary(&job->strm, job->dict, job->dict_size);
+        if (job->ret != Z_OK)
+            return;
+    }
+
+    job->strm.next_in = cast(const z_Bytef*, job->in);
+    job->strm.avail_in = job->in_size;
+    job->strm.next_out = job->out;
+    job->strm.avail_out = job->out_size;
+
+    int ret = deflate(&job->strm, job->last ? Z_FINISH : Z_SYNC_FLUSH);
+
+    bool done = job->last
+        ? (ret == Z_STREAM_END)
+        : (ret == Z_OK and job->strm.avail_in == 0
+            and job->strm.avail_out != 0);  // if 0, flush may not be done
+
+    if (done)
+        job->ret = Z_OK;
+    else if (ret == Z_OK or ret == Z_STREAM_END)
+        job->ret = Z_BUF_ERROR;  // the deflateBound() wasn't enough
+    else
+        job->ret = ret;
+}
+
+#ifdef PARALLEL_DEFLATE
+
+static void *Deflate_Job_Thread(void *job)
+{
+    Run_Deflate_Job(cast(struct Reb_Deflate_Job*, job));
+    return nullptr;
+}
+
+#endif
+
+inline static void Write_U32_BE(REBYTE *bp, uint32_t u) {
+    bp[0] = cast(REBYTE, u >> 24);
+    bp[1] = cast(REBYTE, u >> 16);
+    bp[2] = cast(REBYTE, u >> 8);
+    bp[3] = cast(REBYTE, u);
+}
+
+inline static void Write_U32_LE(REBYTE *bp, uint32_t u) {
+    bp[0] = cast(REBYTE, u);
+    bp[1] = cast(REBYTE, u >> 8);
+    bp[2] = cast(REBYTE, u >> 16);
+    bp[3] = cast(REBYTE, u >> 24);
+}
+
+
+//
+//  Compress_Alloc_Parallel: C
+//
+// Like Compress_Alloc_Core(), but with a compression level and compressing
+// blocks of the input on up to `threads` threads.  In builds without
+// PARALLEL_DEFLATE (or if the input is small), it's one block.  The result
+// is a single valid stream either way, which any inflate can read.
+//
+REBYTE *Compress_Alloc_Parallel(
+    REBSIZ *size_out,
+    const void* input,
+    REBSIZ size_in,
+    enum Reb_Symbol_Id envelope,  // SYM_NONE, SYM_ZLIB, or SYM_GZIP
+    int level,  // 0 to 9, or Z_DEFAULT_COMPRESSION
+    REBLEN threads
+){
+    assert(threads >= 1 and threads <= MAX_DEFLATE_THREADS);
+
+    const REBYTE *in = cast(const REBYTE*, input);
+
+    REBLEN num_jobs = 1;
+  #ifdef PARALLEL_DEFLATE
+    num_jobs = size_in / DEFLATE_BLOCK_MIN;
+    if (num_jobs > threads)
+        num_jobs = threads;
+    if (num_jobs < 1)
+        num_jobs = 1;
+  #else
+    UNUSED(threads);
+  #endif
+
+    REBSIZ head_size = 0;  // header and trailer around the raw streams
+    REBSIZ tail_size = 0;
+    switch (envelope) {
+      case SYM_NONE:
+        break;
+
+      case SYM_ZLIB:
+        head_size = 2;
+        tail_size = 4;  // ADLER32, big endian
+        break;
+
+      case SYM_GZIP:
+        head_size = 10;
+        tail_size = 8;  // CRC32 and size modulo 2^32, little endian
+        break;
+
+      default:
+        assert(false);
+    }
+
+    struct Reb_Deflate_Job jobs[MAX_DEFLATE_THREADS];
+    REBSIZ total = head_size + tail_size;
+
+    REBLEN i;
+    for (i = 0; i < num_jobs; ++i) {
+        struct Reb_Deflate_Job *job = &jobs[i];
+
+        REBSIZ lo = cast(REBSIZ, cast(uint64_t, size_in) * i / num_jobs);
+        REBSIZ hi = cast(REBSIZ, cast(uint64_t, size_in) * (i + 1) / num_jobs);
+        job->in = in + lo;
+        job->in_size = hi - lo;
+        job->last = (i == num_jobs - 1);
+        job->envelope = envelope;
+
+        job->dict_size = lo < 32768 ? lo : 32768;
+        job->dict = job->dict_size != 0 ? in + lo - job->dict_size : nullptr;
+
+        job->strm.zalloc = &zalloc;  // fail() cleans up automatically
+        job->strm.zfree = &zfree;
+        job->strm.opaque = nullptr;
+
+        int ret_init = deflateInit2(
+            &job->strm,
+            level,
+            Z_DEFLATED,
+            window_bits_zlib_raw,  // the envelope is written here
+            8,
+            Z_DEFAULT_STRATEGY
+        );
+        if (ret_init != Z_OK)
+            fail (Error_Compression(&job->strm, ret_init));
+
+        // deflateBound() is for a Z_FINISH, a sync flush adds an empty
+        // stored block (and deflate might need a byte to finish the last)
+        //
+        job->out_size = deflateBound(&job->strm, job->in_size) + 6;
+        total += job->out_size;
+    }
+
+    REBYTE *output = rebAllocN(REBYTE, total);
+    REBYTE *pos = output + head_size;
+    for (i = 0; i < num_jobs; ++i) {
+        jobs[i].out = pos;
+        pos += jobs[i].out_size;
+    }
+
+    // The first job runs on the calling thread.  If a thread can't be
+    // started, its job runs here instead.
+    //
+  #ifdef PARALLEL_DEFLATE
+    pthread_t thread_ids[MAX_DEFLATE_THREADS];
+    bool started[MAX_DEFLATE_THREADS];
+
+    for (i = 1; i < num_jobs; ++i) {
+        int err = pthread_create(
+            &thread_ids[i], nullptr, &Deflate_Job_Thread, &jobs[i]
+        );
+        started[i] = (err == 0);
+    }
+
+    Run_Deflate_Job(&jobs[0]);
+
+    for (i = 1; i < num_jobs; ++i) {
+        if (started[i])
+            pthread_join(thread_ids[i], nullptr);
+        else
+            Run_Deflate_Job(&jobs[i]);
+    }
+  #else
+    Run_Deflate_Job(&jobs[0]);
+  #endif
+
+    // Put the streams end to end, and combine their checksums.
+    //
+    pos = output + head_size;
+    uLong check = (envelope == SYM_GZIP)
+        ? crc32(0L, Z_NULL, 0)
+        : adler32(0L, Z_NULL, 0);
+    for (i = 0; i < num_jobs; ++i) {
+        struct Reb_Deflate_Job *job = &jobs[i];
+        if (job->ret != Z_OK)
+            fail (Error_Compression(&job->strm, job->ret));
+
+        REBSIZ size = job->out_size - job->strm.avail_out;
+        memmove(pos, job->out, size);
+        pos += size;
+
+        if (envelope == SYM_GZIP)
+            check = crc32_combine(check, job->check, job->in_size);
+        else if (envelope == SYM_ZLIB)
+            check = adler32_combine(check, job->check, job->in_size);
+        deflateEnd(&job->strm);
+    }
+
+    if (envelope == SYM_ZLIB) {
+        //
+        // Deflate method with a 32K window, then a "level" hint, padded out
+        // so the 16-bit value divides by 31.
+        //
+        int flevel;
+        if (level == Z_DEFAULT_COMPRESSION or level == 6)
+            flevel = 2;
+        else if (level < 2)
+            flevel = 0;
+        else if (level < 6)
+            flevel = 1;
+        else
+            flevel = 3;
+
+        output[0] = 0x78;
+        output[1] = flevel << 6;
+        output[1] += 31 - ((output[0] << 8) + output[1]) % 31;
+
+        Write_U32_BE(pos, check);
+        pos += 4;
+    }
+    else if (envelope == SYM_GZIP) {
+        output[0] = 0x1F;  // magic number
+        output[1] = 0x8B;
+        output[2] = 8;  // deflate method
+        output[3] = 0;  // no flags: no file name, comment, etc.
+        Write_U32_LE(output + 4, 0);  // no modification time
+        output[8] = (level == 9) ? 2 : (level == 1) ? 4 : 0;  // "XFL"
+        output[9] = 255;  // operating system unknown (zlib puts the OS)
+
+        Write_U32_LE(pos, check);
+        Write_U32_LE(pos + 4, size_in);  // modulo 2^32
+        pos += 8;
+    }
+
+    *size_out = pos - output;
+
+    // !!! Trim if more than 1K extra capacity, as Compress_Alloc_Core() does
+    //
+    if (total - *size_out > 1024)
+        output = cast(REBYTE*, rebRealloc(output, *size_out));
+
+    return output;
+}
+
+
 //
 //  Decompress_Alloc_Core: C
 //
@@ -377,9 +673,9 @@ REBYTE *Decompress_Alloc_Core(
 //
 //  {Built-in checksums from zlib (see CHECKSUM in Crypt extension for more)}
 //
-//      return: "Little-endian format of 4-byte CRC-32"
+//      return: "Little-endian format of 4-byte CRC-32 (8 bytes for HASH64)"
 //          [binary!]
-//      method "Either ADLER32 or CRC32"
+//      method "ADLER32, CRC32, CRC32C, or HASH64"
 //          [word!]
 //      data "Data to encode (using UTF-8 if TEXT!)"
 //          [binary! text!]
@@ -399,6 +695,14 @@ REBNATIVE(checksum_core)
 // It's a sunk cost to export them.  However, some builds may not want both
 // of these either--so bear that in mind.  (ADLER32 is only really needed for
 // PNG decoding, I believe (?))
+//
+// HASH64 is the interpreter's own fast hash for maps and sets (see comments
+// in %s-crc.c), with a seed of 0 instead of the random one used internally.
+// It's not cryptographic, and its values may change between versions.
+//
+// CRC32C is the Castagnoli polynomial used by iSCSI, ext4 and others.  It's
+// here since CPUs have instructions for it: like CRC32 and ADLER32, it runs
+// at about memory speed when they're available (see %s-crc.c).
 {
     INCLUDE_PARAMS_OF_CHECKSUM_CORE;
 
@@ -407,10 +711,28 @@ REBNATIVE(checksum_core)
     REBSIZ size;
     const REBYTE *data = VAL_BYTES_LIMIT_AT(&size, ARG(data), len);
 
-    uLong crc;  // Note: zlib.h defines "crc32" as "z_crc32"
+    if (VAL_WORD_ID(ARG(method)) == SYM_HASH64) {
+        uint64_t hash = Hash64_Bytes(data, size, 0);
+
+        REBBIN *bin = Make_Binary(8);
+        REBYTE *bp = BIN_HEAD(bin);
+        int i;
+        for (i = 0; i < 8; ++i, ++bp) {
+            *bp = cast(REBYTE, hash);
+            hash >>= 8;
+        }
+        TERM_BIN_LEN(bin, 8);
+        return Init_Binary(D_OUT, bin);
+    }
+
+    uint32_t crc;  // computed with CPU instructions if possible, see %s-crc.c
     switch (VAL_WORD_ID(ARG(method))) {
       case SYM_CRC32:
-        crc = crc32_z(0L, data, size);
+        crc = Checksum_CRC32(0, data, size);
+        break;
+
+      case SYM_CRC32C:
+        crc = Checksum_CRC32C(0, data, size);
         break;
 
       case SYM_ADLER32:
@@ -419,11 +741,11 @@ REBNATIVE(checksum_core)
         // "At the beginning [of Adler-32], A is initialized to 1, B to 0"
         // A is the low 16-bits, B is the high.  Hence start with 1L.
         //
-        crc = z_adler32(1L, data, size);
+        crc = Checksum_Adler32(1, data, size);
         break;
 
       default:
-        fail ("METHOD for CHECKSUM-CORE must be CRC32 or ADLER32");
+        fail ("CHECKSUM-CORE METHOD must be CRC32, CRC32C, ADLER32, HASH64");
     }
 
     REBBIN *bin = Make_Binary(4);
@@ -459,6 +781,10 @@ REBNATIVE(checksum_core)
 //          [any-value!]
 //      /envelope "ZLIB (adler32, no size) or GZIP (crc32, uncompressed size)"
 //          [word!]
+//      /level "0 (store only) to 9 (smallest), default is 6"
+//          [integer!]
+//      /threads "Compress blocks of the data at once (for 128K or more each)"
+//          [integer!]
 //  ]
 //
 REBNATIVE(deflate)
@@ -486,12 +812,40 @@ REBNATIVE(deflate)
     }
 
     size_t compressed_size;
-    void *compressed = Compress_Alloc_Core(
-        &compressed_size,
-        bp,
-        size,
-        envelope
-    );
+    void *compressed;
+    if (not REF(level) and not REF(threads)) {
+        compressed = Compress_Alloc_Core(
+            &compressed_size,
+            bp,
+            size,
+            envelope
+        );
+    }
+    else {
+        int level = Z_DEFAULT_COMPRESSION;
+        if (REF(level)) {
+            level = Int32(ARG(level));
+            if (level < 0 or level > 9)
+                fail (PAR(level));
+        }
+
+        REBLEN threads = 1;
+        if (REF(threads)) {
+            REBINT n = Int32(ARG(threads));
+            if (n < 1 or n > MAX_DEFLATE_THREADS)
+                fail (PAR(threads));
+            threads = n;
+        }
+
+        compressed = Compress_Alloc_Parallel(
+            &compressed_size,
+            bp,
+            size,
+            envelope,
+            level,
+            threads
+        );
+    }
 
     return rebRepossess(compressed, compressed_size);
 }
@@ -573,3 +927,819 @@ REBNATIVE(inflate)
 
     return rebRepossess(decompressed, decompressed_size);
 }
+
+
+//=//// LZ4 (COMPRESS-BYTES, DECOMPRESS-BYTES) ////////////////////////////=//
+//
+// DEFLATE spends most of its time hunting for the best match and on Huffman
+// coding.  For caches the interpreter writes and reads back itself, the size
+// matters less than the speed, so there is also a codec producing the LZ4
+// "block format": https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+//
+// A block is a run of sequences, each a token byte (4 bits literal length, 4
+// bits match length minus 4), any extra length bytes, the literals, and a
+// 2-byte little-endian offset back to the match.  The last sequence is only
+// literals.  Compression is a single greedy pass through a hash table of the
+// positions where 4-byte strings were last seen--there is no Huffman stage,
+// and decompression is only copying.
+//
+// The block format doesn't record the uncompressed size, so it is put in 4
+// little-endian bytes in front (as `lz4.block.compress(store_size=True)` in
+// Python's lz4 package does).
+//
+// !!! This is just the block format, not the LZ4 frame format with its magic
+// number and checksums.  Callers that need to detect damage check for it on
+// their own (as the scan cache does).
+//
+
+#define LZ4_MIN_MATCH 4
+#define LZ4_LAST_LITERALS 5  // the last 5 bytes are always literals
+#define LZ4_MFLIMIT 12  // and a match can't start in the last 12
+#define LZ4_MAX_OFFSET 65535
+#define LZ4_HASH_LOG 12
+#define LZ4_SKIP_TRIGGER 6  // miss 2^6 times in a row, start skipping ahead
+#define LZ4_MAX_INPUT 0x7E000000  // same limit as the reference LZ4
+
+inline static uint32_t Lz4_Read32(const REBYTE *bp) {
+    uint32_t u;
+    memcpy(&u, bp, 4);  // compilers make this a single (unaligned) load
+    return u;
+}
+
+inline static uint32_t Lz4_Get_U32_LE(const REBYTE *bp) {
+    return bp[0] | (bp[1] << 8) | (bp[2] << 16)
+        | (cast(uint32_t, bp[3]) << 24);
+}
+
+inline static uint32_t Lz4_Hash(uint32_t seq)
+  { return (seq * 2654435761U) >> (32 - LZ4_HASH_LOG); }
+
+inline static REBYTE *Lz4_Put_Length(REBYTE *op, REBSIZ len) {
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = cast(REBYTE, len);
+    return op;
+}
+
+// Copy in 16-byte pieces, rounding `len` up to a multiple of 16.  Fixed-size
+// memcpy()s compile to a pair of loads and stores, where a memcpy() of a
+// variable (usually small) size is a library call.
+//
+inline static void Lz4_Wild_Copy(REBYTE *dst, const REBYTE *src, REBSIZ len)
+{
+    REBYTE *stop = dst + len;
+    do {
+        memcpy(dst, src, 16);
+        dst += 16;
+        src += 16;
+    } while (dst < stop);
+}
+
+// Where the bytes at `mp` stop matching those at `rp` (or `limit`).  With a
+// little-endian word, the lowest set bit of an XOR is the first difference.
+//
+static const REBYTE *Lz4_Match_End(
+    const REBYTE *mp,
+    const REBYTE *rp,
+    const REBYTE *limit
+){
+  #if defined(ENDIAN_LITTLE) && (defined(__GNUC__) || defined(__clang__))
+    while (limit - mp >= 8) {
+        uint64_t m, r;
+        memcpy(&m, mp, 8);
+        memcpy(&r, rp, 8);
+        if (m != r)
+            return mp + (__builtin_ctzll(m ^ r) >> 3);
+        mp += 8;
+        rp += 8;
+    }
+  #else
+    while (limit - mp >= 4 and Lz4_Read32(mp) == Lz4_Read32(rp)) {
+        mp += 4;
+        rp += 4;
+    }
+  #endif
+    while (mp < limit and *mp == *rp) {
+        ++mp;
+        ++rp;
+    }
+    return mp;
+}
+
+static REBCTX *Error_Lz4(void) {
+    DECLARE_LOCAL (arg);
+    Init_Text(arg, Make_String_UTF8("damaged LZ4 block"));
+    return Error_Bad_Compression_Raw(arg);
+}
+
+static REBYTE *Lz4_Put_Literals(
+    REBYTE *op,
+    REBYTE *oend,
+    REBYTE token_match_bits,
+    const REBYTE *literals,
+    REBSIZ len,
+    const REBYTE *end
+){
+    if (len >= 15) {
+        *op++ = 0xF0 | token_match_bits;
+        op = Lz4_Put_Length(op, len - 15);
+    }
+    else
+        *op++ = cast(REBYTE, len << 4) | token_match_bits;
+
+    if (
+        cast(REBSIZ, end - literals) >= len + 16
+        and cast(REBSIZ, oend - op) >= len + 16
+    ){
+        Lz4_Wild_Copy(op, literals, len);
+    }
+    else
+        memcpy(op, literals, len);
+    return op + len;
+}
+
+
+//
+//  LZ4_Compress_Bound: C
+//
+// Largest LZ4 block that LZ4_Compress_Block() can make for `size` bytes
+// (incompressible input grows by a length byte for each 255 literals).
+//
+REBSIZ LZ4_Compress_Bound(REBSIZ size)
+{
+    return size + size / 255 + 16;
+}
+
+
+//
+//  LZ4_Compress_Block: C
+//
+// Compress `size` bytes into `dst`, which must have LZ4_Compress_Bound(size)
+// bytes of room.  Returns the size of the block.
+//
+REBSIZ LZ4_Compress_Block(REBYTE *dst, const REBYTE *src, REBSIZ size)
+{
+    if (size > LZ4_MAX_INPUT)
+        fail ("LZ4 can't compress more than 2113929216 bytes at once");
+
+    REBYTE *op = dst;
+    REBYTE *oend = dst + LZ4_Compress_Bound(size);
+    const REBYTE *anchor = src;  // start of the literals not yet written
+    const REBYTE *end = src + size;
+
+    if (size > LZ4_MFLIMIT) {
+        const REBYTE *mflimit = end - LZ4_MFLIMIT;
+        const REBYTE *matchlimit = end - LZ4_LAST_LITERALS;
+
+        // Positions are relative to src.  The zeros the table starts with
+        // look like matches at the head, but every candidate is verified
+        // by comparing its bytes, so a stale position costs only a miss.
+        //
+        uint32_t table[1 << LZ4_HASH_LOG];
+        memset(table, 0, sizeof(table));
+
+        const REBYTE *ip = src + 1;
+        uint32_t misses = 1 << LZ4_SKIP_TRIGGER;
+
+        while (ip <= mflimit) {
+            uint32_t seq = Lz4_Read32(ip);
+            uint32_t h = Lz4_Hash(seq);
+            const REBYTE *ref = src + table[h];
+            table[h] = cast(uint32_t, ip - src);
+
+            if (
+                ref >= ip
+                or ip - ref > LZ4_MAX_OFFSET
+                or Lz4_Read32(ref) != seq
+            ){
+                // Data that doesn't compress is stepped through faster and
+                // faster, which is most of why LZ4 is quick on it.
+                //
+                ip += misses++ >> LZ4_SKIP_TRIGGER;
+                continue;
+            }
+            misses = 1 << LZ4_SKIP_TRIGGER;
+
+            while (ip > anchor and ref > src and ip[-1] == ref[-1]) {
+                --ip;  // the match may have started in the literals
+                --ref;
+            }
+
+            const REBYTE *mp = Lz4_Match_End(
+                ip + LZ4_MIN_MATCH,
+                ref + LZ4_MIN_MATCH,
+                matchlimit
+            );
+
+            REBSIZ match_len = (mp - ip) - LZ4_MIN_MATCH;
+            op = Lz4_Put_Literals(
+                op,
+                oend,
+                match_len >= 15 ? 15 : cast(REBYTE, match_len),
+                anchor,
+                ip - anchor,
+                end
+            );
+
+            uint32_t offset = cast(uint32_t, ip - ref);
+            *op++ = offset & 0xFF;
+            *op++ = offset >> 8;
+            if (match_len >= 15)
+                op = Lz4_Put_Length(op, match_len - 15);
+
+            ip = anchor = mp;
+
+            if (ip - 2 >= src + 1 and ip <= mflimit)  // help the next search
+                table[Lz4_Hash(Lz4_Read32(ip - 2))]
+                    = cast(uint32_t, ip - 2 - src);
+        }
+    }
+
+    op = Lz4_Put_Literals(op, oend, 0, anchor, end - anchor, end);
+    return op - dst;
+}
+
+
+//
+//  LZ4_Decompress_Block: C
+//
+// Decompress a block that must come out to exactly `dst_size` bytes.  Every
+// length and offset is checked against the input and output, so damaged or
+// malicious data gives back false instead of reading or writing out of
+// bounds.
+//
+bool LZ4_Decompress_Block(
+    REBYTE *dst,
+    REBSIZ dst_size,
+    const REBYTE *src,
+    REBSIZ src_size
+){
+    const REBYTE *ip = src;
+    const REBYTE *iend = src + src_size;
+    REBYTE *op = dst;
+    REBYTE *oend = dst + dst_size;
+
+    while (true) {
+        if (ip == iend)
+            return false;
+        REBYTE token = *ip++;
+
+        REBSIZ len = token >> 4;
+        if (len == 15) {
+            REBYTE b;
+            do {
+                if (ip == iend)
+                    return false;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        if (len > cast(REBSIZ, iend - ip) or len > cast(REBSIZ, oend - op))
+            return false;
+        if (
+            cast(REBSIZ, iend - ip) >= len + 16
+            and cast(REBSIZ, oend - op) >= len + 16
+        ){
+            Lz4_Wild_Copy(op, ip, len);  // may copy up to 15 bytes too many
+        }
+        else
+            memcpy(op, ip, len);
+        op += len;
+        ip += len;
+
+        if (ip == iend)  // the last sequence has no match
+            break;
+
+        if (iend - ip < 2)
+            return false;
+        REBSIZ offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 or offset > cast(REBSIZ, op - dst))
+            return false;
+
+        len = token & 0x0F;
+        if (len == 15) {
+            REBYTE b;
+            do {
+                if (ip == iend)
+                    return false;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        len += LZ4_MIN_MATCH;
+        if (len > cast(REBSIZ, oend - op))
+            return false;
+
+        // A copy in chunks only reads what's already written if the match is
+        // at least a chunk back.  Closer matches overlap what they produce
+        // (e.g. offset 1 repeats a byte), so they go byte by byte.
+        //
+        const REBYTE *mp = op - offset;
+        if (offset >= 16 and cast(REBSIZ, oend - op) >= len + 16) {
+            Lz4_Wild_Copy(op, mp, len);
+            op += len;
+        }
+        else if (offset >= 8 and cast(REBSIZ, oend - op) >= len + 8) {
+            REBYTE *stop = op + len;
+            do {
+                memcpy(op, mp, 8);
+                op += 8;
+                mp += 8;
+            } while (op < stop);
+            op = stop;
+        }
+        else {
+            REBYTE *stop = op + len;
+            while (op != stop)
+                *op++ = *mp++;
+        }
+    }
+
+    return op == oend;
+}
+
+
+//
+//  Compress_LZ4_Alloc: C
+//
+// LZ4 block with the 4-byte size in front, allocated with rebMalloc().
+//
+REBYTE *Compress_LZ4_Alloc(
+    REBSIZ *size_out,
+    const void *input,
+    REBSIZ size_in
+){
+    REBSIZ bound = 4 + LZ4_Compress_Bound(size_in);
+    REBYTE *output = rebAllocN(REBYTE, bound);
+    Write_U32_LE(output, cast(uint32_t, size_in));
+
+    *size_out = 4 + LZ4_Compress_Block(
+        output + 4,
+        cast(const REBYTE*, input),
+        size_in
+    );
+
+    // !!! Trim if more than 1K extra capacity, as Compress_Alloc_Core() does
+    //
+    if (bound - *size_out > 1024)
+        output = cast(REBYTE*, rebRealloc(output, *size_out));
+
+    return output;
+}
+
+
+//
+//  Decompress_LZ4_Alloc: C
+//
+// Reverses Compress_LZ4_Alloc(), with the result allocated by rebMalloc().
+// Fails if the data is damaged, or if `max` isn't -1 and the size the data
+// says it decompresses to is more than that.
+//
+REBYTE *Decompress_LZ4_Alloc(
+    REBSIZ *size_out,
+    const void *input,
+    REBSIZ size_in,
+    int max
+){
+    const REBYTE *bp = cast(const REBYTE*, input);
+    if (size_in < 5)
+        fail (Error_Lz4());
+
+    REBSIZ size = Lz4_Get_U32_LE(bp);
+
+    // A byte of block can't stand for more than 255 bytes of output, so a
+    // size bigger than that is known to be bad before allocating for it.
+    //
+    if (size / 255 > size_in)
+        fail (Error_Lz4());
+    if (max >= 0 and size > cast(REBSIZ, max)) {
+        DECLARE_LOCAL (temp);
+        Init_Integer(temp, max);
+        fail (Error_Size_Limit_Raw(temp));
+    }
+
+    REBYTE *output = rebAllocN(REBYTE, size + 1);  // 0 size not legal
+    if (not LZ4_Decompress_Block(output, size, bp + 4, size_in - 4))
+        fail (Error_Lz4());
+
+    *size_out = size;
+    return output;
+}
+
+
+//
+//  compress-bytes: native [
+//
+//  {Compress data quickly (e.g. for caches), trading size for speed}
+//
+//      return: [binary!]
+//      data "If text, it will be UTF-8 encoded"
+//          [binary! text!]
+//      /part "Length of data (elements)"
+//          [any-value!]
+//      /method "LZ4 (default, fastest) or ZLIB or GZIP (smaller, as DEFLATE)"
+//          [word!]
+//  ]
+//
+REBNATIVE(compress_bytes)
+{
+    INCLUDE_PARAMS_OF_COMPRESS_BYTES;
+
+    REBLEN limit = Part_Len_May_Modify_Index(ARG(data), ARG(part));
+
+    REBSIZ size;
+    const REBYTE *bp = VAL_BYTES_LIMIT_AT(&size, ARG(data), limit);
+
+    enum Reb_Symbol_Id method = REF(method)
+        ? cast(enum Reb_Symbol_Id, VAL_WORD_ID(ARG(method)))
+        : SYM_LZ4;
+
+    size_t compressed_size;
+    void *compressed;
+    switch (method) {
+      case SYM_LZ4:
+        compressed = Compress_LZ4_Alloc(&compressed_size, bp, size);
+        break;
+
+      case SYM_ZLIB:
+      case SYM_GZIP:
+        compressed = Compress_Alloc_Core(&compressed_size, bp, size, method);
+        break;
+
+      default:
+        fail (PAR(method));
+    }
+
+    return rebRepossess(compressed, compressed_size);
+}
+
+
+//
+//  decompress-bytes: native [
+//
+//  "Decompress data made by COMPRESS-BYTES"
+//
+//      return: [binary!]
+//      data [binary!]
+//      /part "Length of compressed data"
+//          [any-value!]
+//      /max "Error out if result is larger than this"
+//          [integer!]
+//      /method "LZ4 (default), ZLIB, or GZIP (must match COMPRESS-BYTES)"
+//          [word!]
+//  ]
+//
+REBNATIVE(decompress_bytes)
+{
+    INCLUDE_PARAMS_OF_DECOMPRESS_BYTES;
+
+    REBINT max;
+    if (REF(max)) {
+        max = Int32s(ARG(max), 1);
+        if (max < 0)
+            fail (PAR(max));
+    }
+    else
+        max = -1;
+
+    REBSIZ size = Part_Len_May_Modify_Index(ARG(data), ARG(part));
+    const REBYTE *data = VAL_BINARY_AT(ARG(data));  // after index modified
+
+    enum Reb_Symbol_Id method = REF(method)
+        ? cast(enum Reb_Symbol_Id, VAL_WORD_ID(ARG(method)))
+        : SYM_LZ4;
+
+    size_t decompressed_size;
+    void *decompressed;
+    switch (method) {
+      case SYM_LZ4:
+        decompressed = Decompress_LZ4_Alloc(
+            &decompressed_size,
+            data,
+            size,
+            max
+        );
+        break;
+
+      case SYM_ZLIB:
+      case SYM_GZIP:
+        decompressed = Decompress_Alloc_Core(
+            &decompressed_size,
+            data,
+            size,
+            max,
+            method
+        );
+        break;
+
+      default:
+        fail (PAR(method));
+    }
+
+    return rebRepossess(decompressed, decompressed_size);
+}
+
+
+//=//// STREAMING (DEFLATER, INFLATER, ZSTREAM-STEP) //////////////////////=//
+//
+// A stream's z_stream lives in a HANDLE! between calls, so zlib's state can't
+// be allocated with rebMalloc() as in the one-shot routines above: a fail()
+// in some later call would free it out from under the stream.  So it uses
+// the core allocator, and the handle's cleaner calls deflateEnd() or
+// inflateEnd() when the GC finds the handle is no longer referenced.
+//
+// Each ZSTREAM-STEP's *output* is still rebMalloc()'d, since it becomes the
+// BINARY! that is returned (and is freed if the step fails).
+//
+
+struct Reb_Zstream {
+    z_stream strm;
+    bool deflating;
+    enum Reb_Symbol_Id envelope;  // SYM_NONE, SYM_ZLIB, SYM_GZIP, SYM_DETECT
+    bool finished;  // deflate got /FINISH, or inflate reached the end
+};
+
+static void *zalloc_stream(void *opaque, unsigned nr, unsigned size)
+{
+    UNUSED(opaque);
+    if (size != 0 and nr > (UINT32_MAX - ALIGN_SIZE) / size)
+        return Z_NULL;
+
+    // Free_Mem() needs the size, so it's stashed in front of the memory
+
+    REBSIZ total = ALIGN_SIZE + nr * size;
+    REBYTE *p = TRY_ALLOC_N(REBYTE, total);
+    if (not p)
+        return Z_NULL;  // zlib gives back Z_MEM_ERROR
+    *cast(REBSIZ*, p) = total;
+    return p + ALIGN_SIZE;
+}
+
+static void zfree_stream(void *opaque, void *addr)
+{
+    UNUSED(opaque);
+    REBYTE *p = cast(REBYTE*, addr) - ALIGN_SIZE;
+    FREE_N(REBYTE, *cast(REBSIZ*, p), p);
+}
+
+static void Cleanup_Zstream(const REBVAL *v)
+{
+    struct Reb_Zstream *z = VAL_HANDLE_POINTER(struct Reb_Zstream, v);
+    if (z->deflating)
+        deflateEnd(&z->strm);
+    else
+        inflateEnd(&z->strm);
+    FREE(struct Reb_Zstream, z);
+}
+
+static struct Reb_Zstream *Make_Zstream(
+    bool deflating,
+    enum Reb_Symbol_Id envelope
+){
+    struct Reb_Zstream *z = TRY_ALLOC(struct Reb_Zstream);
+    if (not z)
+        fail (Error_No_Memory(sizeof(struct Reb_Zstream)));
+
+    z->strm.zalloc = &zalloc_stream;
+    z->strm.zfree = &zfree_stream;
+    z->strm.opaque = nullptr;
+    z->strm.next_in = Z_NULL;
+    z->strm.avail_in = 0;
+    z->deflating = deflating;
+    z->envelope = envelope;
+    z->finished = false;
+    return z;
+}
+
+// Zlib's errors for a stream, with Z_MEM_ERROR possible since the state
+// isn't allocated with rebMalloc().
+//
+static REBCTX *Error_Zstream(struct Reb_Zstream *z, int ret)
+{
+    if (ret == Z_MEM_ERROR)
+        return Error_No_Memory(0);
+    return Error_Compression(&z->strm, ret);
+}
+
+
+//
+//  deflater: native [
+//
+//  {Make a stream to compress data a piece at a time with ZSTREAM-STEP}
+//
+//      return: [handle!]
+//      /envelope "ZLIB (adler32, no size) or GZIP (crc32, uncompressed size)"
+//          [word!]
+//      /level "0 (store only) to 9 (smallest), default is 6"
+//          [integer!]
+//  ]
+//
+REBNATIVE(deflater)
+{
+    INCLUDE_PARAMS_OF_DEFLATER;
+
+    int window_bits = window_bits_zlib_raw;
+    enum Reb_Symbol_Id envelope = SYM_NONE;
+    if (REF(envelope)) {
+        envelope = cast(enum Reb_Symbol_Id, VAL_WORD_ID(ARG(envelope)));
+        switch (envelope) {
+          case SYM_ZLIB:
+            window_bits = window_bits_zlib;
+            break;
+
+          case SYM_GZIP:
+            window_bits = window_bits_gzip;
+            break;
+
+          default:
+            fail (PAR(envelope));
+        }
+    }
+
+    int level = Z_DEFAULT_COMPRESSION;
+    if (REF(level)) {
+        level = Int32(ARG(level));
+        if (level < 0 or level > 9)
+            fail (PAR(level));
+    }
+
+    struct Reb_Zstream *z = Make_Zstream(true, envelope);
+    int ret = deflateInit2(
+        &z->strm, level, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY
+    );
+    if (ret != Z_OK) {
+        REBCTX *error = Error_Zstream(z, ret);
+        FREE(struct Reb_Zstream, z);
+        fail (error);
+    }
+
+    return Init_Handle_Cdata_Managed(
+        D_OUT, z, sizeof(struct Reb_Zstream), &Cleanup_Zstream
+    );
+}
+
+
+//
+//  inflater: native [
+//
+//  {Make a stream to decompress data a piece at a time with ZSTREAM-STEP}
+//
+//      return: [handle!]
+//      /envelope "ZLIB, GZIP, or DETECT (http://stackoverflow.com/a/9213826)"
+//          [word!]
+//  ]
+//
+REBNATIVE(inflater)
+//
+// Concatenated GZIP members (as made by `cat a.gz b.gz`, and by some gzip
+// tools for large files) are decompressed one after another, like gunzip.
+{
+    INCLUDE_PARAMS_OF_INFLATER;
+
+    int window_bits = window_bits_zlib_raw;
+    enum Reb_Symbol_Id envelope = SYM_NONE;
+    if (REF(envelope)) {
+        envelope = cast(enum Reb_Symbol_Id, VAL_WORD_ID(ARG(envelope)));
+        switch (envelope) {
+          case SYM_ZLIB:
+            window_bits = window_bits_zlib;
+            break;
+
+          case SYM_GZIP:
+            window_bits = window_bits_gzip;
+            break;
+
+          case SYM_DETECT:
+            window_bits = window_bits_detect_zlib_gzip;
+            break;
+
+          default:
+            fail (PAR(envelope));
+        }
+    }
+
+    struct Reb_Zstream *z = Make_Zstream(false, envelope);
+    int ret = inflateInit2(&z->strm, window_bits);
+    if (ret != Z_OK) {
+        REBCTX *error = Error_Zstream(z, ret);
+        FREE(struct Reb_Zstream, z);
+        fail (error);
+    }
+
+    return Init_Handle_Cdata_Managed(
+        D_OUT, z, sizeof(struct Reb_Zstream), &Cleanup_Zstream
+    );
+}
+
+
+//
+//  zstream-step: native [
+//
+//  {Feed input to a DEFLATER or INFLATER, and get back the output it makes}
+//
+//      return: "Output that is ready, may be empty until enough input"
+//          [binary!]
+//      stream [handle!]
+//      data "If text, it will be UTF-8 encoded"
+//          [blank! binary! text!]
+//      /finish "Input is over: flush a DEFLATER, or check an INFLATER ended"
+//  ]
+//
+REBNATIVE(zstream_step)
+//
+// The output is only as big as what this input (plus what zlib had held
+// back) makes, so feeding the input in pieces keeps memory use constant.
+{
+    INCLUDE_PARAMS_OF_ZSTREAM_STEP;
+
+    if (VAL_HANDLE_CLEANER(ARG(stream)) != &Cleanup_Zstream)
+        fail (PAR(stream));
+
+    struct Reb_Zstream *z = VAL_HANDLE_POINTER(
+        struct Reb_Zstream, ARG(stream)
+    );
+
+    REBSIZ size = 0;
+    const REBYTE *data = nullptr;
+    if (not IS_BLANK(ARG(data)))
+        data = VAL_BYTES_AT(&size, ARG(data));
+
+    if (z->finished and (z->deflating or size != 0))
+        fail ("ZSTREAM-STEP stream is already finished");
+
+    z->strm.next_in = cast(const z_Bytef*, data);
+    z->strm.avail_in = size;
+
+    // Guess at the output size and grow it as needed.  Deflate output is
+    // usually smaller than its input, and inflate output 2 to 5 times bigger.
+    //
+    REBSIZ buf_size = z->deflating
+        ? deflateBound(&z->strm, size)
+        : size * 4;
+    if (buf_size < 1024)
+        buf_size = 1024;
+    REBYTE *output = rebAllocN(REBYTE, buf_size);
+    REBSIZ out_size = 0;
+
+    int flush = (z->deflating and REF(finish)) ? Z_FINISH : Z_NO_FLUSH;
+
+    while (true) {
+        if (out_size == buf_size) {
+            buf_size *= 2;
+            output = cast(REBYTE*, rebRealloc(output, buf_size));
+        }
+        z->strm.next_out = output + out_size;
+        z->strm.avail_out = buf_size - out_size;
+
+        int ret = z->deflating
+            ? deflate(&z->strm, flush)
+            : inflate(&z->strm, Z_NO_FLUSH);
+
+        out_size = buf_size - z->strm.avail_out;
+
+        if (ret == Z_STREAM_END) {
+            if (
+                not z->deflating
+                and z->strm.avail_in != 0
+                and (z->envelope == SYM_GZIP or z->envelope == SYM_DETECT)
+            ){
+                ret = inflateReset(&z->strm);  // another gzip member
+                if (ret != Z_OK)
+                    fail (Error_Zstream(z, ret));
+                continue;
+            }
+            z->finished = true;
+            break;
+        }
+
+        if (ret == Z_BUF_ERROR) {  // no progress possible, not an error
+            if (z->strm.avail_out != 0)
+                break;  // needs more input
+            continue;  // needs more output space
+        }
+
+        if (ret != Z_OK)
+            fail (Error_Zstream(z, ret));
+
+        if (z->strm.avail_out != 0 and z->strm.avail_in == 0) {
+            if (flush != Z_FINISH)
+                break;  // took all the input, and has nothing more to give
+        }
+    }
+
+    if (z->strm.avail_in != 0)
+        fail ("ZSTREAM-STEP got data after the end of compressed data");
+
+    if (REF(finish) and not z->finished)
+        fail ("ZSTREAM-STEP compressed data ended before its end marker");
+
+    z->strm.next_in = Z_NULL;  // don't keep pointer into the input series
+
+    // !!! Trim if more than 1K extra capacity, as the one-shot routines do
+    //
+    if (out_size != 0 and buf_size - out_size > 1024)
+        output = cast(REBYTE*, rebRealloc(output, out_size));
+
+    return rebRepossess(output, out_size);
+}
@@ -108,6 +108,7 @@
     USED(ARG(flags)); \
     USED(ARG(collection)); \
     USED(ARG(inside)); \
+    USED(ARG(profile)); \
     USED(ARG(num_quotes)); \
     USED(ARG(position)); \
     USED(ARG(save))
@@ -135,6 +136,12 @@
         : VAL_CONTEXT(ARG(inside)) \
     )
 
+#define P_PROFILE \
+    (IS_NULLED(ARG(profile)) \
+        ? nullptr \
+        : VAL_ARRAY_KNOWN_MUTABLE(ARG(profile)) \
+    )
+
 #define P_NUM_QUOTES        VAL_INT32(ARG(num_quotes))
 
 #define P_POS               VAL_INDEX_UNBOUNDED(ARG(position))
@@ -254,7 +261,9 @@ enum parse_flags {
 
     PF_ONE_RULE = 1 << 14,  // signal to only run one step of the parse
 
-    PF_MAX = PF_ONE_RULE
+    PF_MEMO = 1 << 15,  // PARSE/MEMO, remember results of named subrules
+
+    PF_MAX = PF_MEMO
 };
 
 STATIC_ASSERT(PF_MAX <= INT32_MAX);  // needs to fit in VAL_INTEGER()
@@ -267,7 +276,10 @@ STATIC_ASSERT((int)AM_FIND_MATCH == (int)PF_FIND_MATCH);
 #define PF_FIND_MASK \
     (PF_FIND_ONLY | PF_FIND_CASE | PF_FIND_MATCH)
 
-#define PF_STATE_MASK (~PF_FIND_MASK & ~PF_ONE_RULE)
+#define PF_INHERIT_MASK \
+    (PF_FIND_MASK | PF_MEMO)  // passed on to subrules
+
+#define PF_STATE_MASK (~PF_INHERIT_MASK & ~PF_ONE_RULE)
 
 
 // In %words.r, the parse words are lined up in order so they can be quickly
@@ -306,6 +318,7 @@ static bool Subparse_Throws(
     REBFRM *f,
     option(REBARR*) collection,
     option(REBCTX*) inside,
+    option(REBARR*) profile,
     REBFLGS flags
 ){
     assert(ANY_SERIES_KIND(CELL_KIND(VAL_UNESCAPED(input))));
@@ -354,6 +367,11 @@ static bool Subparse_Throws(
     else
         Init_Nulled(Prep_Cell(ARG(inside)));
 
+    if (profile)
+        Init_Block(Prep_Cell(ARG(profile)), unwrap(profile));
+    else
+        Init_Nulled(Prep_Cell(ARG(profile)));
+
     // Locals in frame would be void on entry if called by action dispatch.
     //
     Init_Unset(Prep_Cell(ARG(num_quotes)));
@@ -564,6 +582,1031 @@ REB_R Process_Group_For_Parse(
 }
 
 
+//=//// COMPILED RULE PROGRAMS ////////////////////////////////////////////=//
+//
+// Each BLOCK! subrule normally costs a SUBPARSE frame, and every item in it
+// goes back through the classification in the main loop: is it a BAR!, a
+// GROUP!, a command, a variable to fetch, ...  Rules used over and over (as
+// in a request router) do that same work every time for the same blocks.
+//
+// So blocks that only *match* (no SET, COPY, GROUP!s, KEEP, etc.) can be
+// compiled into a list of ops, one per rule cell, and run by a tight loop
+// that doesn't need a frame.  The subset is what string and binary rules
+// mostly consist of:
+//
+//     "text" #c #{BIN} charset  skip end _  [subrule]  variable  |  ,
+//
+// ...each of which may be preceded by one OPT, SOME, or WHILE.  A variable
+// is looked up every time it runs, and must hold one of the literal types
+// above or a BLOCK! (which gets its own program).
+//
+// Programs are kept in a direct-mapped cache indexed by the array and index
+// of the block.  Since rule blocks can be changed between PARSEs (or freed,
+// with their node reused for another block), a cached program is checked
+// against the cells each time it is fetched: the length must be the same,
+// and each cell must have the kind (and WORD! symbol) it was compiled from.
+// The literals themselves are read from the cells as the program runs.
+//
+// Compiling also notes where each `|` alternate ends, and which alternates
+// start with a literal (that isn't under OPT or WHILE).  Before trying such
+// an alternate, its first character is checked against the input with the
+// same test FIND uses for the first character of a match.  Keyword grammars
+// with many alternates can then skip most of them without calling FIND.
+// (The character is read from the live cell, since text in a rule can be
+// changed without the block changing.)
+//
+// Running a program has no side effects, so if it runs into something it
+// can't handle (a variable holding a GROUP!, say) it just gives up and the
+// block is run by SUBPARSE from the start.  Such a block is marked in the
+// cache so that it isn't tried again.
+//
+// !!! PARSE/INSIDE, PARSE/MEMO, tracing, and ANY-ARRAY! input always use
+// SUBPARSE.  (A program's subrules would bypass the memo table.)
+//
+
+#define PARSE_CACHE_SIZE 128  // must be a power of 2
+#define PARSE_PROGRAM_MAX_OPS 32  // longer blocks aren't compiled
+#define PARSE_PROGRAM_MAX_DEPTH 64  // deeper subrules run via SUBPARSE
+
+#define INTERPRET_FLAG ((REBLEN)(-3))  // couldn't run program, use SUBPARSE
+#define UNCOMPILABLE_FLAG ((REBLEN)(-4))  // ...and don't try again
+
+enum Reb_Parse_Opcode {
+    PARSE_OP_LITERAL,  // TEXT!, ISSUE!, BINARY!, as via FIND/MATCH
+    PARSE_OP_BITSET,
+    PARSE_OP_SKIP,  // SKIP, or a source-level BLANK!
+    PARSE_OP_END,
+    PARSE_OP_BLOCK,  // inline subrule
+    PARSE_OP_VARIABLE,  // WORD! that is not a command
+    PARSE_OP_MODIFIER,  // OPT, SOME, WHILE (folded into the following op)
+    PARSE_OP_COMMA,
+    PARSE_OP_BAR  // starts the next alternate
+};
+
+struct Reb_Parse_Op {
+    REBYTE opcode;  // enum Reb_Parse_Opcode
+    REBYTE kind;  // KIND3Q_BYTE() the rule cell had when compiled
+    bool optional;  // after OPT or WHILE (mincount of 0)
+    bool looping;  // after SOME or WHILE (maxcount of "forever")
+    bool prefilter;  // literal starting an alternate, check first character
+    REBLEN next_alternate;  // op after the next BAR!, or num_ops if none
+    const REBSYM *symbol;  // if the rule cell is a WORD!, else nullptr
+};
+
+struct Reb_Parse_Program {
+    const REBARR *array;  // nullptr if the entry is unused
+    REBLEN index;  // position of the BLOCK! in the array
+    REBLEN num_ops;  // one op per rule cell, from index to the tail
+    bool compiled;  // false if the block must be run by SUBPARSE
+    REBLEN running;  // how many runs of it are in progress
+    struct Reb_Parse_Op ops[PARSE_PROGRAM_MAX_OPS];
+};
+
+struct Reb_Parse_Run {
+    REBVAL *position;  // the input, its index is moved as rules match
+    REBLEN len;  // length of the input
+    REBFLGS find_flags;  // e.g. AM_FIND_CASE for PARSE/CASE
+    REBLEN char_pos;  // where `ch` was read from the input (or NOT_FOUND)
+    REBUNI ch;  // saves rereading the same position for each alternate
+};
+
+
+//
+//  Compile_Parse_Program: C
+//
+// Fill in a cache entry for the block at the given array position.  If the
+// block isn't in the subset that can be compiled, the entry records that.
+//
+static void Compile_Parse_Program(
+    struct Reb_Parse_Program *p,
+    const REBARR *array,
+    REBLEN index
+){
+    p->array = array;
+    p->index = index;
+    p->num_ops = ARR_LEN(array) - index;
+    p->compiled = false;
+    p->running = 0;
+
+    if (p->num_ops > PARSE_PROGRAM_MAX_OPS)
+        return;
+
+    bool optional = false;
+    bool looping = false;
+    bool modified = false;  // saw OPT, SOME, or WHILE
+    bool head = true;  // no rule seen yet in this alternate
+
+    const RELVAL *cell = ARR_AT(array, index);
+    struct Reb_Parse_Op *op = p->ops;
+    REBLEN n;
+    for (n = 0; n < p->num_ops; ++n, ++cell, ++op) {
+        op->kind = KIND3Q_BYTE_UNCHECKED(cell);  // quoted cells don't match
+        op->symbol = nullptr;
+        op->prefilter = false;
+
+        switch (op->kind) {
+          case REB_TEXT:
+          case REB_ISSUE:
+          case REB_BINARY:
+            op->opcode = PARSE_OP_LITERAL;
+            break;
+
+          case REB_BITSET:
+            op->opcode = PARSE_OP_BITSET;
+            break;
+
+          case REB_BLANK:
+            op->opcode = PARSE_OP_SKIP;
+            break;
+
+          case REB_BLOCK:
+            op->opcode = PARSE_OP_BLOCK;
+            break;
+
+          case REB_COMMA:
+            if (modified)
+                return;  // SUBPARSE gives the error
+            op->opcode = PARSE_OP_COMMA;
+            continue;
+
+          case REB_WORD:
+            op->symbol = VAL_WORD_SYMBOL(cell);
+            if (op->symbol == PG_Bar_Canon) {
+                if (modified)
+                    return;  // e.g. `[some | ...]`
+                op->opcode = PARSE_OP_BAR;
+                head = true;
+                continue;
+            }
+            switch (VAL_CMD(cell)) {
+              case SYM_0:
+                op->opcode = PARSE_OP_VARIABLE;
+                break;
+
+              case SYM_SKIP:
+                op->opcode = PARSE_OP_SKIP;
+                break;
+
+              case SYM_END:
+                op->opcode = PARSE_OP_END;
+                break;
+
+              case SYM_OPT:
+                if (modified)
+                    return;
+                optional = modified = true;
+                op->opcode = PARSE_OP_MODIFIER;
+                continue;
+
+              case SYM_SOME:
+                if (modified)
+                    return;
+                looping = modified = true;
+                op->opcode = PARSE_OP_MODIFIER;
+                continue;
+
+              case SYM_WHILE:
+                if (modified)
+                    return;
+                optional = looping = modified = true;
+                op->opcode = PARSE_OP_MODIFIER;
+                continue;
+
+              default:
+                return;  // other commands need SUBPARSE
+            }
+            break;
+
+          default:
+            return;
+        }
+
+        op->optional = optional;
+        op->looping = looping;
+        op->prefilter = head and not optional
+            and op->opcode == PARSE_OP_LITERAL;
+        optional = looping = modified = head = false;
+    }
+
+    if (modified)
+        return;  // e.g. `[some]`, let SUBPARSE complain
+
+    REBLEN next_alternate = p->num_ops;  // fill in going backwards
+    while (n != 0) {
+        --n;
+        p->ops[n].next_alternate = next_alternate;
+        if (p->ops[n].opcode == PARSE_OP_BAR)
+            next_alternate = n + 1;
+    }
+
+    p->compiled = true;
+}
+
+
+//
+//  Get_Parse_Program: C
+//
+// Find the cached program for a block, compiling it if it isn't there or the
+// block has changed since.  Returns nullptr if the block can't be compiled,
+// or if its cache slot is busy with a program that is running.
+//
+static struct Reb_Parse_Program *Get_Parse_Program(
+    const REBARR *array,
+    REBLEN index
+){
+    if (index > ARR_LEN(array))
+        return nullptr;  // SUBPARSE deals with out of range blocks
+
+    uintptr_t hash = (cast(uintptr_t, array) >> 4) ^ index;
+    struct Reb_Parse_Program *p
+        = &TG_Parse_Programs[hash & (PARSE_CACHE_SIZE - 1)];
+
+    if (
+        p->array == array
+        and p->index == index
+        and p->num_ops == ARR_LEN(array) - index
+    ){
+        if (not p->compiled)
+            return nullptr;
+
+        const RELVAL *cell = ARR_AT(array, index);
+        const struct Reb_Parse_Op *op = p->ops;
+        const struct Reb_Parse_Op *op_tail = p->ops + p->num_ops;
+        for (; op != op_tail; ++op, ++cell) {
+            if (KIND3Q_BYTE_UNCHECKED(cell) != op->kind)
+                break;
+            if (op->symbol and VAL_WORD_SYMBOL(cell) != op->symbol)
+                break;
+        }
+        if (op == op_tail)
+            return p;
+    }
+
+    if (p->running != 0)
+        return nullptr;  // don't overwrite ops that are in use
+
+    Compile_Parse_Program(p, array, index);
+    return p->compiled ? p : nullptr;
+}
+
+
+static REBIXO Run_Parse_Program(
+    struct Reb_Parse_Run *run,
+    struct Reb_Parse_Program *p,
+    REBSPC *specifier,
+    REBLEN pos,
+    REBLEN depth
+);
+
+
+// Match one rule at `pos`, fetching it first if it is a variable.  Gives the
+// same kinds of results as Run_Parse_Program().
+//
+static REBIXO Match_Parse_Op(
+    struct Reb_Parse_Run *run,
+    enum Reb_Parse_Opcode opcode,
+    const RELVAL *rule,
+    REBSPC *specifier,
+    REBLEN pos,
+    REBLEN depth
+){
+    bool fetched = false;
+    if (opcode == PARSE_OP_VARIABLE) {
+        const REBVAL *var = try_unwrap(Lookup_Word(rule, specifier));
+        if (not var)
+            return UNCOMPILABLE_FLAG;  // let SUBPARSE raise the error
+
+        switch (KIND3Q_BYTE(var)) {
+          case REB_TEXT:
+          case REB_ISSUE:
+          case REB_BINARY:
+            opcode = PARSE_OP_LITERAL;
+            break;
+
+          case REB_BITSET:
+            opcode = PARSE_OP_BITSET;
+            break;
+
+          case REB_BLOCK:
+            opcode = PARSE_OP_BLOCK;
+            break;
+
+          default:
+            return UNCOMPILABLE_FLAG;
+        }
+        rule = var;
+        fetched = true;
+    }
+
+    if (pos == run->len) {  // at end of input, see Parse_One_Rule()
+        switch (opcode) {
+          case PARSE_OP_END:
+            return pos;
+
+          case PARSE_OP_BLOCK:
+            break;
+
+          case PARSE_OP_LITERAL:
+            if (not IS_ISSUE(rule) and VAL_LEN_AT(rule) == 0)
+                return pos;
+            return END_FLAG;
+
+          default:
+            return END_FLAG;
+        }
+    }
+
+    switch (opcode) {
+      case PARSE_OP_LITERAL: {
+        if (IS_BINARY(rule) and not IS_BINARY(run->position))
+            return UNCOMPILABLE_FLAG;  // SUBPARSE gives the error
+
+        VAL_INDEX_UNBOUNDED(run->position) = pos;
+
+        REBLEN len;
+        REBLEN index = Find_Value_In_Binstr(
+            &len,
+            run->position,
+            run->len,
+            VAL_UNESCAPED(rule),
+            run->find_flags | AM_FIND_MATCH
+                | (IS_ISSUE(rule) ? AM_FIND_CASE : 0),
+            1  // skip
+        );
+        if (index == NOT_FOUND)
+            return END_FLAG;
+        return index + len; }
+
+      case PARSE_OP_BITSET: {
+        bool uncased;
+        REBUNI uni;
+        if (IS_BINARY(run->position)) {
+            uni = *BIN_AT(VAL_BINARY(run->position), pos);
+            uncased = false;
+        }
+        else {
+            uni = GET_CHAR_AT(VAL_STRING(run->position), pos);
+            uncased = not (run->find_flags & AM_FIND_CASE);
+        }
+        if (Check_Bit(VAL_BITSET(rule), uni, uncased))
+            return pos + 1;
+        return END_FLAG; }
+
+      case PARSE_OP_SKIP:
+        return pos + 1;  // end of input was checked above
+
+      case PARSE_OP_END:
+        return END_FLAG;  // not at end of input
+
+      case PARSE_OP_BLOCK: {
+        if (depth == PARSE_PROGRAM_MAX_DEPTH)
+            return INTERPRET_FLAG;
+
+        REBSPC *derived = fetched
+            ? SPECIFIED  // as in Array_Rule_Specifier() for fetched rules
+            : Derive_Specifier(specifier, rule);
+
+        struct Reb_Parse_Program *sub = Get_Parse_Program(
+            VAL_ARRAY(rule),
+            VAL_INDEX_RAW(rule)
+        );
+        if (not sub)
+            return UNCOMPILABLE_FLAG;
+        return Run_Parse_Program(run, sub, derived, pos, depth + 1); }
+
+      default:
+        assert(false);
+        return UNCOMPILABLE_FLAG;
+    }
+}
+
+
+// The check FIND makes on the first character of a literal at `pos`, which
+// can say a match is impossible without doing the rest of FIND's setup.
+//
+static bool First_Char_May_Match(
+    struct Reb_Parse_Run *run,
+    const RELVAL *rule,
+    REBLEN pos
+){
+    if (pos == run->len)
+        return true;  // Match_Parse_Op() handles the end of input
+
+    bool binary_input = IS_BINARY(run->position);
+
+    if (IS_BINARY(rule)) {
+        if (not binary_input)
+            return true;  // Match_Parse_Op() defers this case to SUBPARSE
+
+        REBSIZ size;
+        const REBYTE *at = VAL_BINARY_SIZE_AT(&size, rule);
+        if (size == 0)
+            return true;
+        return *at == *BIN_AT(VAL_BINARY(run->position), pos);
+    }
+
+    REBLEN len;
+    REBSIZ size;
+    const REBYTE *utf8 = VAL_UTF8_LEN_SIZE_AT(&len, &size, rule);
+    if (len == 0)
+        return true;  // empty text, or `#` (which FIND never matches)
+
+    REBUNI first;
+    if (*utf8 < 0x80)
+        first = *utf8;
+    else
+        Back_Scan_UTF8_Char_Unchecked(&first, utf8);
+
+    if (run->char_pos != pos) {
+        if (binary_input)
+            run->ch = *BIN_AT(VAL_BINARY(run->position), pos);
+        else
+            run->ch = GET_CHAR_AT(VAL_STRING(run->position), pos);
+        run->char_pos = pos;
+    }
+    REBUNI c = run->ch;
+
+    if (binary_input and c >= 0x80)
+        return true;  // FIND would decode it as UTF-8, don't bother
+
+    if (c == first)
+        return true;
+
+    bool caseless = not IS_ISSUE(rule)
+        and not (run->find_flags & AM_FIND_CASE);
+
+    return caseless and c != '\0' and LO_CASE(c) == LO_CASE(first);
+}
+
+
+//
+//  Run_Parse_Program: C
+//
+// Returns the index after the block's match, END_FLAG if it didn't match,
+// INTERPRET_FLAG if SUBPARSE should run the block instead, or
+// UNCOMPILABLE_FLAG if it should *always* do so.
+//
+static REBIXO Run_Parse_Program(
+    struct Reb_Parse_Run *run,
+    struct Reb_Parse_Program *p,
+    REBSPC *specifier,
+    REBLEN pos,
+    REBLEN depth
+){
+    REBLEN start = pos;  // alternates reset the input to here
+    const RELVAL *rules = ARR_AT(p->array, p->index);
+
+    ++p->running;
+
+    REBIXO result;
+    REBLEN n = 0;
+    while (true) {
+        if (n == p->num_ops) {
+            result = pos;  // all rules matched
+            break;
+        }
+
+        const struct Reb_Parse_Op *op = &p->ops[n];
+        const RELVAL *rule = rules + n;
+        ++n;
+
+        if (op->opcode == PARSE_OP_MODIFIER or op->opcode == PARSE_OP_COMMA)
+            continue;
+
+        if (op->opcode == PARSE_OP_BAR) {
+            result = pos;  // reached BAR! without a match failure
+            break;
+        }
+
+        if (Eval_Count <= 1) {  // let SUBPARSE run Do_Signals_Throws()
+            result = INTERPRET_FLAG;
+            break;
+        }
+        --Eval_Count;
+
+        REBLEN count = 0;
+        REBIXO i;
+        if (op->prefilter and not First_Char_May_Match(run, rule, pos))
+            goto no_match;
+        do {
+            i = Match_Parse_Op(
+                run,
+                cast(enum Reb_Parse_Opcode, op->opcode),
+                rule,
+                specifier,
+                pos,
+                depth
+            );
+            if (i == END_FLAG)
+                break;
+            if (i == INTERPRET_FLAG or i == UNCOMPILABLE_FLAG)
+                goto bail;
+
+            // SUBPARSE would keep looping on a match that doesn't advance
+            // (e.g. `while [opt "a"]`).  Leave that to it.
+            //
+            if (op->looping and i == pos) {
+                i = INTERPRET_FLAG;
+                goto bail;
+            }
+
+            ++count;
+            pos = i;
+        } while (op->looping);
+
+        if (count == 0 and not op->optional) {  // try the next alternate
+          no_match:
+            n = op->next_alternate;
+            if (n == p->num_ops) {
+                result = END_FLAG;
+                break;
+            }
+            pos = start;
+        }
+        continue;
+
+      bail:
+        if (i == UNCOMPILABLE_FLAG)
+            p->compiled = false;  // e.g. variable holds a GROUP!
+        result = i;
+        break;
+    }
+
+    --p->running;
+    return result;
+}
+
+
+//
+//  Try_Parse_Program: C
+//
+// Match a BLOCK! subrule at `pos` using its compiled program, if it has one.
+// Returns the index after the match, END_FLAG for no match, or else
+// INTERPRET_FLAG to say the block must be run by SUBPARSE.
+//
+static REBIXO Try_Parse_Program(
+    REBFRM *frame_,
+    const RELVAL *rule,
+    REBLEN pos
+){
+    USE_PARAMS_OF_SUBPARSE;
+
+    if (IS_SER_ARRAY(P_INPUT) or P_INSIDE or Trace_Level)
+        return INTERPRET_FLAG;
+
+    if ((P_FLAGS & PF_MEMO) or P_PROFILE)  // every rule must be seen
+        return INTERPRET_FLAG;
+
+    if (pos > P_INPUT_LEN)
+        return INTERPRET_FLAG;
+
+    struct Reb_Parse_Program *p = Get_Parse_Program(
+        VAL_ARRAY(rule),
+        VAL_INDEX_RAW(rule)
+    );
+    if (not p)
+        return INTERPRET_FLAG;
+
+    DECLARE_LOCAL (position);
+    Copy_Cell(position, ARG(position));
+
+    struct Reb_Parse_Run run;
+    run.position = position;
+    run.len = P_INPUT_LEN;
+    run.find_flags = P_FLAGS & PF_FIND_MASK;
+    run.char_pos = NOT_FOUND;
+
+    REBIXO i = Run_Parse_Program(
+        &run,
+        p,
+        Array_Rule_Specifier(frame_, rule),
+        pos,
+        0
+    );
+    if (i == UNCOMPILABLE_FLAG)
+        return INTERPRET_FLAG;
+    return i;
+}
+
+
+//=//// PACKRAT MEMOIZATION (PARSE/MEMO) //////////////////////////////////=//
+//
+// A grammar that backtracks can match the same subrule at the same input
+// position again and again--exponentially often for bad inputs.  PARSE/MEMO
+// remembers the outcome of each *named* subrule (a BLOCK! fetched through a
+// variable) at each position it was tried, so that each pair only gets
+// matched once.  This is the "packrat" technique.
+//
+// The trade is that a remembered subrule's GROUP!s and SETs only happen the
+// first time it runs at a position, which is why it's opt-in.  Results are
+// not remembered while COLLECT is in effect (KEEPs would be lost), or when
+// ACCEPT or REJECT ended the subrule.
+//
+// There is one table for the interpreter.  Entries are tagged with a serial
+// number, and a new one is taken at the start of each PARSE/MEMO to forget
+// what came before without clearing the table.  It's also taken when PARSE
+// changes its input (REMOVE, INSERT, CHANGE), and by the GC--since a rule
+// block could be freed and its node reused for a different one.
+//
+// The table grows up to PARSE_MEMO_MAX entries.  After that, new results
+// replace old ones, so a long parse can't use unbounded memory.
+//
+
+#define PARSE_MEMO_MIN 1024  // must be a power of 2
+#define PARSE_MEMO_MAX (1 << 16)  // must be a power of 2
+#define PARSE_MEMO_PROBES 8  // how far to look before overwriting an entry
+
+struct Reb_Parse_Memo {
+    REBLEN serial;  // TG_Parse_Memo_Serial when the result was remembered
+    const REBARR *rule;  // nullptr if the entry was never used
+    REBLEN rule_index;
+    const REBSER *input;
+    REBLEN input_len;  // notices if GROUP! code changed the input's length
+    REBLEN pos;
+    REBFLGS flags;  // e.g. PF_FIND_CASE
+    const REBCTX *inside;  // PARSE/INSIDE context
+    REBIXO result;  // index after the match, or END_FLAG
+};
+
+
+//
+//  Forget_Parse_Memos: C
+//
+void Forget_Parse_Memos(void)
+{
+    ++TG_Parse_Memo_Serial;
+    TG_Parse_Memo_Count = 0;
+}
+
+
+static bool Is_Parse_Memo_For(
+    const struct Reb_Parse_Memo *m,
+    const struct Reb_Parse_Memo *key
+){
+    return m->serial == TG_Parse_Memo_Serial
+        and m->rule == key->rule
+        and m->rule_index == key->rule_index
+        and m->input == key->input
+        and m->input_len == key->input_len
+        and m->pos == key->pos
+        and m->flags == key->flags
+        and m->inside == key->inside;
+}
+
+
+// Gives back the entry for the key if there is one, otherwise the entry that
+// a result for the key should be written into.
+//
+static struct Reb_Parse_Memo *Find_Parse_Memo(
+    bool *found,
+    const struct Reb_Parse_Memo *key
+){
+    uintptr_t hash = (cast(uintptr_t, key->rule) >> 4) + key->rule_index;
+    hash = hash * 31 + (cast(uintptr_t, key->input) >> 4);
+    hash = hash * 2654435761u + key->pos;
+
+    struct Reb_Parse_Memo *home = nullptr;
+    struct Reb_Parse_Memo *reuse = nullptr;  // first entry from an old serial
+
+    REBLEN n;
+    for (n = 0; n != PARSE_MEMO_PROBES; ++n) {
+        struct Reb_Parse_Memo *m
+            = &TG_Parse_Memo[(hash + n) & (TG_Parse_Memo_Size - 1)];
+        if (n == 0)
+            home = m;
+
+        if (Is_Parse_Memo_For(m, key)) {
+            *found = true;
+            return m;
+        }
+        if (not reuse and m->serial != TG_Parse_Memo_Serial)
+            reuse = m;
+    }
+
+    *found = false;
+    return reuse ? reuse : home;
+}
+
+
+// The table grows when half full, and only the current serial's entries are
+// brought over.
+//
+static void Grow_Parse_Memos(void)
+{
+    struct Reb_Parse_Memo *old = TG_Parse_Memo;
+    REBLEN old_size = TG_Parse_Memo_Size;
+
+    TG_Parse_Memo_Size = old_size * 2;
+    TG_Parse_Memo = TRY_ALLOC_N_ZEROFILL(
+        struct Reb_Parse_Memo, TG_Parse_Memo_Size
+    );
+    TG_Parse_Memo_Count = 0;
+
+    REBLEN n;
+    for (n = 0; n != old_size; ++n) {
+        if (old[n].rule == nullptr or old[n].serial != TG_Parse_Memo_Serial)
+            continue;
+
+        bool found;
+        struct Reb_Parse_Memo *m = Find_Parse_Memo(&found, &old[n]);
+        if (m->serial != TG_Parse_Memo_Serial)
+            ++TG_Parse_Memo_Count;
+        *m = old[n];
+    }
+
+    FREE_N(struct Reb_Parse_Memo, old_size, old);
+}
+
+
+static void Init_Parse_Memo_Key(
+    struct Reb_Parse_Memo *key,
+    REBFRM *frame_,
+    const RELVAL *rule
+){
+    USE_PARAMS_OF_SUBPARSE;
+
+    key->serial = TG_Parse_Memo_Serial;
+    key->rule = VAL_ARRAY(rule);
+    key->rule_index = VAL_INDEX_RAW(rule);
+    key->input = P_INPUT;
+    key->input_len = P_INPUT_LEN;
+    key->pos = P_POS;
+    key->flags = P_FLAGS & PF_FIND_MASK;
+    key->inside = P_INSIDE;
+}
+
+
+//
+//  Recall_Parse_Memo: C
+//
+// If PARSE/MEMO has already matched this named subrule at the current input
+// position, give back the result (END_FLAG if it failed).  Otherwise it
+// gives back INTERPRET_FLAG, and the subrule needs to be run.
+//
+static REBIXO Recall_Parse_Memo(REBFRM *frame_, const RELVAL *rule)
+{
+    struct Reb_Parse_Memo key;
+    Init_Parse_Memo_Key(&key, frame_, rule);
+
+    bool found;
+    struct Reb_Parse_Memo *m = Find_Parse_Memo(&found, &key);
+    if (not found) {
+        ++TG_Parse_Memo_Misses;
+        return INTERPRET_FLAG;
+    }
+
+    ++TG_Parse_Memo_Hits;
+    return m->result;
+}
+
+
+//
+//  Remember_Parse_Memo: C
+//
+// Called with the result of running a named subrule at the current position,
+// unless running it changed the serial (e.g. the subrule did a REMOVE).
+//
+static void Remember_Parse_Memo(
+    REBFRM *frame_,
+    const RELVAL *rule,
+    REBIXO result
+){
+    if (
+        TG_Parse_Memo_Count * 2 >= TG_Parse_Memo_Size
+        and TG_Parse_Memo_Size < PARSE_MEMO_MAX
+    ){
+        Grow_Parse_Memos();
+    }
+
+    struct Reb_Parse_Memo key;
+    Init_Parse_Memo_Key(&key, frame_, rule);
+    key.result = result;
+
+    bool found;
+    struct Reb_Parse_Memo *m = Find_Parse_Memo(&found, &key);
+    if (m->serial != TG_Parse_Memo_Serial)
+        ++TG_Parse_Memo_Count;
+    *m = key;
+}
+
+
+//=//// RULE PROFILING (PARSE*'s PROFILE OUTPUT) ///////////////////////////=//
+//
+// When a grammar is slow, it's not apparent which rule is responsible.  If
+// PARSE* is asked for a PROFILE, it passes a profile array down to all of
+// its SUBPARSE levels, and each rule that comes to a match or a mismatch
+// gets its tally updated:
+//
+//     [rule count matched failed consumed time]
+//
+// RULE is the rule block at the position of the rule, so the same rule
+// reached through different paths is tallied together.  TIME includes the
+// time spent in any subrules and GROUP!s.  Prefixes like SOME or SET X are
+// counted as part of the rule they apply to, not on their own.  Rules like
+// HERE or SEEK that don't match or mismatch aren't counted.
+//
+// The profile array's first cell is a HANDLE! to the hash table of the C
+// tallies, with each subsequent cell the rule BLOCK! for the tally (which
+// keeps the rule arrays the table points at alive).  At the end PARSE* turns
+// the tallies into the rows of a block, which can be SORTed by any column.
+//
+// Compiled rule programs are not used while profiling, so that the rules
+// inside of subrule blocks get counted too.
+//
+
+#define PARSE_PROFILE_MIN 64  // must be a power of 2
+
+struct Reb_Parse_Stat {
+    const REBARR *rule;  // nullptr if the slot was never used
+    REBLEN index;  // index of the rule in the rule block
+    REBLEN row;  // index in the profile array of the rule's BLOCK!
+    REBLEN count;
+    REBLEN matched;
+    REBI64 consumed;  // total input advanced by matches
+    REBI64 nanoseconds;
+};
+
+
+static void Cleanup_Parse_Stats(const REBVAL *v)
+{
+    FREE_N(
+        struct Reb_Parse_Stat,
+        VAL_HANDLE_LEN(v),
+        VAL_HANDLE_POINTER(struct Reb_Parse_Stat, v)
+    );
+}
+
+
+//
+//  Make_Parse_Profile: C
+//
+static REBARR *Make_Parse_Profile(void)
+{
+    REBARR *profile = Make_Array(PARSE_PROFILE_MIN + 1);
+    Init_Handle_Cdata_Managed(
+        Alloc_Tail_Array(profile),
+        TRY_ALLOC_N_ZEROFILL(struct Reb_Parse_Stat, PARSE_PROFILE_MIN),
+        PARSE_PROFILE_MIN,
+        &Cleanup_Parse_Stats
+    );
+    Manage_Series(profile);
+    return profile;
+}
+
+
+static struct Reb_Parse_Stat *Find_Parse_Stat_Slot(
+    struct Reb_Parse_Stat *stats,
+    REBLEN size,
+    const REBARR *rule,
+    REBLEN index
+){
+    uintptr_t hash = (cast(uintptr_t, rule) >> 4) * 31 + index;
+
+    REBLEN n = hash & (size - 1);
+    while (stats[n].rule) {
+        if (stats[n].rule == rule and stats[n].index == index)
+            break;
+        n = (n + 1) & (size - 1);
+    }
+    return &stats[n];
+}
+
+
+//
+//  Profile_Parse_Rule: C
+//
+// Tally one try of the rule at `index` in the rule block being run by the
+// frame.  Pass the input consumed, or -1 if the rule did not match.
+//
+static void Profile_Parse_Rule(
+    REBARR *profile,
+    REBFRM *f,
+    REBLEN index,
+    REBINT consumed,
+    REBI64 nanoseconds
+){
+    RELVAL *handle = ARR_HEAD(profile);
+    struct Reb_Parse_Stat *stats = VAL_HANDLE_POINTER(
+        struct Reb_Parse_Stat, handle
+    );
+    REBLEN size = VAL_HANDLE_LEN(handle);
+    REBLEN num_stats = ARR_LEN(profile) - 1;
+
+    if (num_stats * 2 >= size) {  // keep the table at most half full
+        struct Reb_Parse_Stat *old = stats;
+        REBLEN old_size = size;
+
+        size = old_size * 2;
+        stats = TRY_ALLOC_N_ZEROFILL(struct Reb_Parse_Stat, size);
+
+        REBLEN n;
+        for (n = 0; n != old_size; ++n) {
+            if (old[n].rule)
+                *Find_Parse_Stat_Slot(
+                    stats, size, old[n].rule, old[n].index
+                ) = old[n];
+        }
+        FREE_N(struct Reb_Parse_Stat, old_size, old);
+
+        SET_HANDLE_CDATA(handle, stats);
+        SET_HANDLE_LEN(handle, size);
+    }
+
+    const REBARR *rule = FRM_ARRAY(f);
+    struct Reb_Parse_Stat *s = Find_Parse_Stat_Slot(stats, size, rule, index);
+    if (not s->rule) {
+        s->rule = rule;
+        s->index = index;
+        s->row = ARR_LEN(profile);
+        Init_Any_Series_At_Core(
+            Alloc_Tail_Array(profile),
+            REB_BLOCK,
+            rule,
+            index,
+            FRM_SPECIFIER(f)
+        );
+    }
+
+    ++s->count;
+    if (consumed >= 0) {
+        ++s->matched;
+        s->consumed += consumed;
+    }
+    s->nanoseconds += nanoseconds;
+}
+
+
+//
+//  Init_Parse_Profile_Report: C
+//
+// Turn the tallies into a block with a row for each rule, in the order that
+// the rules first finished a try.  (The profile array's BLOCK!s are in that
+// order, and give the key to look up each rule's tally.)
+//
+static REBVAL *Init_Parse_Profile_Report(RELVAL *out, REBARR *profile)
+{
+    const RELVAL *handle = ARR_HEAD(profile);
+    struct Reb_Parse_Stat *stats = VAL_HANDLE_POINTER(
+        struct Reb_Parse_Stat, handle
+    );
+    REBLEN size = VAL_HANDLE_LEN(handle);
+    REBLEN num_stats = ARR_LEN(profile) - 1;
+
+    REBARR *report = Make_Array(num_stats);
+
+    const RELVAL *tail = ARR_TAIL(profile);
+    const RELVAL *rule = ARR_AT(profile, 1);
+    for (; rule != tail; ++rule) {
+        struct Reb_Parse_Stat *s = Find_Parse_Stat_Slot(
+            stats, size, VAL_ARRAY(rule), VAL_INDEX(rule)
+        );
+        assert(s->rule);
+
+        REBARR *row = Make_Array(6);
+        Copy_Cell(Alloc_Tail_Array(row), SPECIFIC(rule));
+        Init_Integer(Alloc_Tail_Array(row), s->count);
+        Init_Integer(Alloc_Tail_Array(row), s->matched);
+        Init_Integer(Alloc_Tail_Array(row), s->count - s->matched);
+        Init_Integer(Alloc_Tail_Array(row), s->consumed);
+        Init_Time_Nanoseconds(Alloc_Tail_Array(row), s->nanoseconds);
+
+        Init_Block(Alloc_Tail_Array(report), row);
+    }
+
+    return Init_Block(out, report);
+}
+
+
+//
+//  Startup_Parse_Programs: C
+//
+void Startup_Parse_Programs(void)
+{
+    TG_Parse_Programs = TRY_ALLOC_N_ZEROFILL(
+        struct Reb_Parse_Program, PARSE_CACHE_SIZE
+    );
+
+    TG_Parse_Memo = nullptr;  // allocated by first PARSE/MEMO
+    TG_Parse_Memo_Size = 0;
+    TG_Parse_Memo_Count = 0;
+    TG_Parse_Memo_Serial = 1;
+    TG_Parse_Memo_Hits = 0;
+    TG_Parse_Memo_Misses = 0;
+}
+
+
+//
+//  Shutdown_Parse_Programs: C
+//
+void Shutdown_Parse_Programs(void)
+{
+    FREE_N(struct Reb_Parse_Program, PARSE_CACHE_SIZE, TG_Parse_Programs);
+
+    if (TG_Parse_Memo)  // only allocated if PARSE/MEMO was used
+        FREE_N(struct Reb_Parse_Memo, TG_Parse_Memo_Size, TG_Parse_Memo);
+}
+
+
 //
 //  Parse_One_Rule: C
 //
@@ -657,6 +1700,12 @@ static REB_R Parse_One_Rule(
         // value regarding whether a match occurred or not has to be based on
         // the result that comes back in D_OUT.
 
+        REBIXO i = Try_Parse_Program(frame_, rule, pos);
+        if (i == END_FLAG)
+            return R_UNHANDLED;
+        if (i != INTERPRET_FLAG)
+            return Init_Integer(D_OUT, i);
+
         REBLEN pos_before = P_POS;
         P_POS = pos;  // modify input position
 
@@ -676,7 +1725,8 @@ static REB_R Parse_One_Rule(
             subframe,
             P_COLLECTION,
             P_INSIDE,
-            (P_FLAGS & PF_FIND_MASK)
+            P_PROFILE,
+            (P_FLAGS & PF_INHERIT_MASK)
         )){
             Move_Cell(D_OUT, subresult);
             return R_THROWN;
@@ -1241,6 +2291,8 @@ static REB_R Handle_Seek_Rule_Dont_Update_Begin(
 //          [any-series!]
 //      /inside "Context added to rules (and subrules)"
 //          [any-context!]
+//      /profile "Array of per-rule statistics (see PARSE*'s PROFILE output)"
+//          [block!]
 //      <local> position num-quotes save
 //  ]
 //
@@ -1333,6 +2385,12 @@ REBNATIVE(subparse)
 
     REBIDX begin = P_POS;  // point at beginning of match
 
+    REBARR *profile = P_PROFILE;  // if tallying rules, see Profile_Parse_Rule()
+    bool profiling = false;  // true while a rule's try is being timed
+    REBLEN profile_index = 0;
+    REBIDX profile_pos = 0;
+    REBI64 profile_start = 0;
+
     // The loop iterates across each REBVAL's worth of "rule" in the rule
     // block.  Some of these rules just set `flags` and `continue`, so that
     // the flags will apply to the next rule item.  If the flag is PF_SET
@@ -1395,6 +2453,22 @@ REBNATIVE(subparse)
     if (IS_BAR(rule))  // reached BAR! without a match failure, good!
         return Init_Integer(D_OUT, P_POS);  // indicate match @ current pos
 
+    //=//// START TIMING THE RULE IF PROFILING ////////////////////////////=//
+
+    // A prefix like SOME or SET X comes back here for the rule it applies
+    // to, but leaves state flags or counts that say it's not a fresh rule.
+
+    if (
+        profile
+        and not (P_FLAGS & PF_STATE_MASK)
+        and mincount == 1 and maxcount == 1
+    ){
+        profiling = true;
+        profile_index = FRM_INDEX(f);
+        profile_pos = P_POS;
+        profile_start = Startup_Clock_Nanoseconds();
+    }
+
     //=//// HANDLE COMMA! (BEFORE GROUP...?) //////////////////////////////=//
 
     // The R3-Alpha PARSE design wasn't based on any particular notion of
@@ -1622,7 +2696,8 @@ REBNATIVE(subparse)
                     subframe,
                     collection,
                     P_INSIDE,
-                    (P_FLAGS & PF_FIND_MASK) | PF_ONE_RULE
+                    P_PROFILE,
+                    (P_FLAGS & PF_INHERIT_MASK) | PF_ONE_RULE
                 );
 
                 DROP_GC_GUARD(collection);
@@ -1720,7 +2795,8 @@ REBNATIVE(subparse)
                         subframe,
                         P_COLLECTION,
                         P_INSIDE,
-                        (P_FLAGS & PF_FIND_MASK) | PF_ONE_RULE
+                        P_PROFILE,
+                        (P_FLAGS & PF_INHERIT_MASK) | PF_ONE_RULE
                     );
 
                     UNUSED(interrupted);  // !!! ignore ACCEPT/REJECT (?)
@@ -2253,7 +3329,8 @@ REBNATIVE(subparse)
                     subframe,
                     P_COLLECTION,
                     P_INSIDE,
-                    (P_FLAGS & PF_FIND_MASK)  // PF_ONE_RULE?
+                    P_PROFILE,
+                    (P_FLAGS & PF_INHERIT_MASK)  // PF_ONE_RULE?
                 )){
                     goto return_thrown;
                 }
@@ -2282,6 +3359,21 @@ REBNATIVE(subparse)
         }
         else if (IS_BLOCK(rule)) {  // word fetched block, or inline block
 
+            REBLEN memo_serial = 0;  // nonzero if result should be remembered
+            if ((P_FLAGS & PF_MEMO) and rule == P_SAVE and not P_COLLECTION) {
+                i = Recall_Parse_Memo(f, rule);
+                if (i != INTERPRET_FLAG)
+                    goto matched;
+                memo_serial = TG_Parse_Memo_Serial;
+            }
+
+            i = Try_Parse_Program(f, rule, P_POS);  // if block just matches
+            if (i != INTERPRET_FLAG) {
+                if (memo_serial)
+                    Remember_Parse_Memo(f, rule, i);
+                goto matched;
+            }
+
             DECLARE_FRAME_AT_CORE (
                 subframe,
                 rule, Array_Rule_Specifier(f, rule),
@@ -2297,7 +3389,8 @@ REBNATIVE(subparse)
                 subframe,
                 P_COLLECTION,
                 P_INSIDE,
-                (P_FLAGS & PF_FIND_MASK)  // no PF_ONE_RULE
+                P_PROFILE,
+                (P_FLAGS & PF_INHERIT_MASK)  // no PF_ONE_RULE
             )){
                 Move_Cell(D_OUT, D_SPARE);
                 return R_THROWN;
@@ -2320,6 +3413,9 @@ REBNATIVE(subparse)
                     P_POS = i;
                 break;
             }
+
+            if (memo_serial and memo_serial == TG_Parse_Memo_Serial)
+                Remember_Parse_Memo(f, rule, i);  // input unchanged, no GC
         }
         else {
             // Parse according to datatype
@@ -2337,6 +3433,7 @@ REBNATIVE(subparse)
             SET_END(D_OUT);  // preserve invariant
         }
 
+      matched:
         assert(i != THROWN_FLAG);
 
         // i: indicates new index or failure of the *match*, but
@@ -2535,6 +3632,9 @@ REBNATIVE(subparse)
                 }
             }
 
+            if (P_FLAGS & (PF_REMOVE | PF_INSERT | PF_CHANGE))
+                Forget_Parse_Memos();  // remembered positions now wrong
+
             if (P_FLAGS & PF_REMOVE) {
                 ENSURE_MUTABLE(ARG(position));
                 if (count)
@@ -2631,6 +3731,19 @@ REBNATIVE(subparse)
         set_or_copy_word = NULL;
     }
 
+    if (profiling) {
+        Profile_Parse_Rule(
+            profile,
+            f,
+            profile_index,
+            IS_NULLED(ARG(position))
+                ? -1
+                : cast(REBINT, P_POS < profile_pos ? 0 : P_POS - profile_pos),
+            Startup_Clock_Nanoseconds() - profile_start
+        );
+        profiling = false;
+    }
+
     if (IS_NULLED(ARG(position))) {
 
       next_alternate:
@@ -2693,6 +3806,8 @@ REBNATIVE(subparse)
 //
 //      return: "TBD: parse product, currently either ~parsed~ or NULL"
 //          [<opt> bad-word! any-series!]
+//      profile: "<output> Rows of [rule count matched failed consumed time]"
+//          [block!]
 //
 //      input "Input series to parse"
 //          [<blank> any-series!]
@@ -2702,6 +3817,7 @@ REBNATIVE(subparse)
 //      /inside "Context to add to rules (and subrules)"
 //          [any-context!]
 //      /fully "Require parse to reach end, see PARSE specialization"
+//      /memo "Remember results of named subrules at each position"
 //  ]
 //
 REBNATIVE(parse_p)
@@ -2749,21 +3865,52 @@ REBNATIVE(parse_p)
     if (REF(inside))
         Virtual_Bind_Patchify(rules, VAL_CONTEXT(ARG(inside)), REB_WORD);
 
+    REBFLGS flags = REF(case) ? AM_FIND_CASE : 0;
+    //
+    // We always want "case-sensitivity" on binary bytes, vs. treating
+    // as case-insensitive bytes for ASCII characters.
+
+    if (REF(memo)) {
+        if (not TG_Parse_Memo) {
+            TG_Parse_Memo_Size = PARSE_MEMO_MIN;
+            TG_Parse_Memo = TRY_ALLOC_N_ZEROFILL(
+                struct Reb_Parse_Memo, TG_Parse_Memo_Size
+            );
+        }
+        Forget_Parse_Memos();  // results are only good for this PARSE
+        flags |= PF_MEMO;
+    }
+
+    REBARR *profile = nullptr;
+    if (REF(profile)) {
+        profile = Make_Parse_Profile();
+        PUSH_GC_GUARD(profile);
+    }
+
     DECLARE_FRAME_AT (subframe, rules, EVAL_MASK_DEFAULT);
 
     bool interrupted;
-    if (Subparse_Throws(
+    bool threw = Subparse_Throws(
         &interrupted,
         SET_END(D_OUT),
         input, SPECIFIED,
         subframe,
         nullptr,  // start out with no COLLECT in effect, so no P_COLLECTION
         REF(inside) ? VAL_CONTEXT(ARG(inside)) : nullptr,
-        REF(case) ? AM_FIND_CASE : 0
-        //
-        // We always want "case-sensitivity" on binary bytes, vs. treating
-        // as case-insensitive bytes for ASCII characters.
-    )){
+        profile,
+        flags
+    );
+
+    if (profile) {
+        if (not threw)  // a profile of a failed match is useful too
+            Init_Parse_Profile_Report(
+                Sink_Word_May_Fail(ARG(profile), SPECIFIED),
+                profile
+            );
+        DROP_GC_GUARD(profile);
+    }
+
+    if (threw) {
         // Any PARSE-specific THROWs (where a PARSE directive jumped the
         // stack) should be handled here.  However, RETURN was eliminated,
         // in favor of enforcing a more clear return value protocol for PARSE
@@ -38,6 +38,30 @@
 //   like `as text! as binary! make bitset! [...]`)
 
 
+#define LINK_Sharer_TYPE        REBBIN*  // see SERIES_INFO_SHARED
+#define LINK_Sharer_CAST        BIN
+#define HAS_LINK_Sharer         FLAVOR_BINARY
+
+#define MISC_Mapping_TYPE       REBARR*  // see BINARY_FLAG_MAPPED
+#define MISC_Mapping_CAST       ARR
+#define HAS_MISC_Mapping        FLAVOR_BINARY
+
+
+//=//// BINARY_FLAG_MAPPED ////////////////////////////////////////////////=//
+//
+// The data is not a series allocation, but memory owned by a managed HANDLE!
+// in MISC(Mapping), e.g. a file mapped in by an extension with mmap().  The
+// handle's cleaner releases the memory once no series are using it.  See
+// Make_Binary_Mapped().
+//
+// Since the pages are probably read-only, a mapped binary is always in a
+// ring of sharers (see SERIES_INFO_SHARED), if only with itself.  So the
+// first write or resize copies the bytes, just as for sharing by COPY.
+//
+#define BINARY_FLAG_MAPPED \
+    SERIES_FLAG_24
+
+
 #ifdef __cplusplus  // !!! Make fancier checks, as with SER() and ARR()
     inline static REBBIN *BIN(void *p)
         { return reinterpret_cast<REBBIN*>(p); }
@@ -47,6 +47,38 @@ inline static void INIT_BITS_NOT(REBSER *s, bool negated)
   { s->misc.negated = negated; }
 
 
+// A charset with a few high codepoints (an emoji, a CJK range) would need
+// thousands of bytes if all of its bits were in the binary.  So bits at or
+// above BITSET_DENSE_MAX that are past the binary's tail are instead kept in
+// a sorted list of inclusive ranges, in a second binary in LINK(BitRanges).
+// Check_Bit() only has to search those when the bit is past the tail.
+//
+// Operations that work on the bytes themselves (MOLD, comparison, the set
+// operations) first fold the ranges into the bytes with Densify_Bitset().
+// That changes the representation, not the bits, so it's done even when the
+// bitset is read-only.
+//
+// BITSET_DENSE_MAX covers codepoints that are one or two bytes in UTF-8, so
+// charsets for Latin, Greek, Cyrillic, Hebrew and Arabic text stay dense.
+//
+#define BITSET_DENSE_MAX 0x800
+
+#define LINK_BitRanges_TYPE     REBBIN*
+#define LINK_BitRanges_CAST     BIN
+#define HAS_LINK_BitRanges      FLAVOR_BINARY
+
+struct Reb_Bit_Range {
+    REBU32 lo;
+    REBU32 hi;  // inclusive
+};
+
+#define BIT_RANGES_HEAD(ranges) \
+    cast(struct Reb_Bit_Range*, BIN_HEAD(ranges))
+
+#define BIT_RANGES_LEN(ranges) \
+    (BIN_LEN(ranges) / sizeof(struct Reb_Bit_Range))
+
+
 inline static REBBIN *VAL_BITSET(REBCEL(const*) v) {
     assert(CELL_KIND(v) == REB_BITSET);
     return BIN(VAL_NODE1(v));
@@ -58,6 +90,7 @@ inline static REBBIN *VAL_BITSET(REBCEL(const*) v) {
 inline static REBVAL *Init_Bitset(RELVAL *out, REBBIN *bits) {
     RESET_CELL(out, REB_BITSET, CELL_FLAG_FIRST_IS_NODE);
     ASSERT_SERIES_MANAGED(bits);
+    assert(GET_SERIES_FLAG(bits, LINK_NODE_NEEDS_MARK));  // LINK(BitRanges)
     INIT_VAL_NODE1(out, bits);
     return cast(REBVAL*, out);
 }
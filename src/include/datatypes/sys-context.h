@@ -107,6 +107,35 @@
     SERIES_FLAG_24
 
 
+//=//// KEYLIST_FLAG_INDEXED //////////////////////////////////////////////=//
+//
+// Big keylists (e.g. those of modules) get a hash index built for them the
+// first time Find_Symbol_In_Context() is asked to search one.  This flag says
+// the MISC() of the keylist holds that index, which is freed along with the
+// keylist.  See "KEYLIST INDEX" in %c-context.c
+//
+// (The index is a plain allocation and not a node, so there is no need for
+// SERIES_FLAG_MISC_NODE_NEEDS_MARK on the keylist.)
+//
+#define KEYLIST_FLAG_INDEXED \
+    SERIES_FLAG_25
+
+
+//=//// KEYLIST_FLAG_SHAPE ////////////////////////////////////////////////=//
+//
+// The keylist was put in TG_Keylist_Shapes, so objects that have nothing to
+// do with each other may share it.  Derivation is tracked by keylist (see
+// Is_Overriding_Context()), so such a keylist can't say which object another
+// was derived from.  An object that is derived from gets a keylist of its
+// own first (see Prepare_Keylist_For_Derivation()).
+//
+#define KEYLIST_FLAG_SHAPE \
+    SERIES_FLAG_26
+
+#define MISC_KEYLIST_INDEX(keylist) \
+    (keylist)->misc.any.p
+
+
 // REBCTX* properties (note: shares LINK_KEYSOURCE() with REBACT*)
 //
 // Note: MODULE! contexts depend on a property stored in the META field, which
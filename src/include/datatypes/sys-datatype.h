@@ -154,8 +154,21 @@ inline static CFUNC** HOOKS_FOR_TYPE_OF(REBCEL(const*) v) {
     return cast(CFUNC**, m_cast(REBYTE*, SER_DATA(CELL_CUSTOM_TYPE(v))));
 }
 
-#define Generic_Hook_For_Type_Of(v) \
-    cast(GENERIC_HOOK*, HOOKS_FOR_TYPE_OF(v)[IDX_GENERIC_HOOK])
+// Generic dispatch (APPEND, FIND, COPY, PICK...) only needs one hook out of
+// the row, and a row is a cache line or more apart from the next.  So the
+// generic hooks of the builtin types are also in a column of their own, which
+// is small enough to stay in cache.  It is generated alongside the rows in
+// %tmp-type-hooks.c, and anything that changes a builtin type's generic hook
+// (only the EVENT! extension) has to change it in both.
+//
+extern GENERIC_HOOK *Builtin_Generic_Hooks[REB_MAX];
+
+inline static GENERIC_HOOK *Generic_Hook_For_Type_Of(REBCEL(const*) v) {
+    enum Reb_Kind k = CELL_KIND(v);
+    if (k != REB_CUSTOM)
+        return Builtin_Generic_Hooks[k];
+    return cast(GENERIC_HOOK*, HOOKS_FOR_TYPE_OF(v)[IDX_GENERIC_HOOK]);
+}
 
 #define Path_Hook_For_Type_Of(v) \
     cast(PATH_HOOK*, HOOKS_FOR_TYPE_OF(v)[IDX_PATH_HOOK])
@@ -260,24 +260,54 @@ inline static const char* Frame_Label_Or_Anonymous_UTF8(REBFRM *f) {
 // simple examples like `x: 0 repeat 1000000 [x: x + 1]` by at least 20%.
 // Broader studies might reveal better approaches--but point is, it does at
 // least do *something*.
+//
+// Varlists that do become managed--because the frame escaped as a FRAME!,
+// through BINDING OF, or by being captured in a closure--are left to the GC
+// as before.
+
+inline static REBLEN Varlist_Reuse_Bucket(REBLEN capacity) {
+    REBLEN n = 0;
+    while (
+        n + 1 < VARLIST_REUSE_BUCKETS
+        and (cast(REBLEN, 2) << (n + 1)) <= capacity
+    ){
+        ++n;
+    }
+    return n;
+}
 
-inline static bool Did_Reuse_Varlist_Of_Unknown_Size(
+inline static bool Did_Reuse_Varlist(
     REBFRM *f,
-    REBLEN size_hint  // !!! Currently ignored, smaller sizes can come back
+    REBLEN num_args  // the varlist needs room for this, +rootvar, +end
 ){
-    // !!! At the moment, the reuse is not very intelligent and just picks the
-    // last one...which could commonly be wastefully big or too small.  But it
-    // is a proof of concept to show an axis for performance work.
-    //
-    UNUSED(size_hint);
-
     assert(f->varlist == nullptr);
 
-    if (not TG_Reuse)
-        return false;
+    REBLEN need = num_args + 1 + 1;
+    REBLEN n = 0;
+    while (n < VARLIST_REUSE_BUCKETS and (cast(REBLEN, 2) << n) < need)
+        ++n;
 
-    f->varlist = TG_Reuse;
-    TG_Reuse = LINK(ReuseNext, TG_Reuse);
+    // Lists from `n` up have room, save for the last one which could still
+    // be too small.  If those are all empty, a smaller varlist is taken just
+    // to reuse its node, and Push_Action() gives it new data.
+    //
+    REBLEN i;
+    for (i = n; i < VARLIST_REUSE_BUCKETS; ++i) {
+        if (TG_Reuse[i])
+            goto found;
+    }
+    for (i = n; i > 0; --i) {
+        if (TG_Reuse[i - 1]) {
+            --i;
+            goto found;
+        }
+    }
+    return false;
+
+  found:
+    f->varlist = TG_Reuse[i];
+    TG_Reuse[i] = LINK(ReuseNext, f->varlist);
+    --TG_Reuse_Count[i];
     f->rootvar = cast(REBVAL*, f->varlist->content.dynamic.data);
     mutable_LINK(KeySource, f->varlist) = f;
     assert(NOT_SERIES_FLAG(f->varlist, MANAGED));
@@ -298,8 +328,15 @@ inline static void Conserve_Varlist(REBARR *varlist)
     TRASH_POINTER_IF_DEBUG(mutable_BINDING(rootvar));
   #endif
 
-    mutable_LINK(ReuseNext, varlist) = TG_Reuse;
-    TG_Reuse = varlist;
+    REBLEN n = Varlist_Reuse_Bucket(varlist->content.dynamic.rest);
+    if (TG_Reuse_Count[n] >= VARLIST_REUSE_MAX) {
+        GC_Kill_Series(varlist);  // no track for Free_Unmanaged_Series()
+        return;
+    }
+
+    mutable_LINK(ReuseNext, varlist) = TG_Reuse[n];
+    TG_Reuse[n] = varlist;
+    ++TG_Reuse_Count[n];
 }
 
 
@@ -649,7 +686,7 @@ inline static void Push_Action(
     REBSER *s;
     if (
         f->varlist  // !!! May be going to point of assuming nullptr
-        or Did_Reuse_Varlist_Of_Unknown_Size(f, num_args)  // want `num_args`
+        or Did_Reuse_Varlist(f, num_args)
     ){
         s = f->varlist;
       #ifdef DEBUG_TERM_ARRAYS
@@ -749,9 +786,20 @@ inline static void Push_Action(
 }
 
 
+// Used by both the evaluator and the action dispatch in %c-action.c, before
+// running something whose result may turn out to be invisible.
+//
+inline static void Expire_Out_Cell_Unless_Invisible(REBFRM *f) {
+    SET_CELL_FLAG(f->out, OUT_NOTE_STALE);
+}
+
+
 inline static void Drop_Action(REBFRM *f) {
     assert(not f->label or IS_SYMBOL(unwrap(f->label)));
 
+    if (TG_Call_Profiling)  // also reached by fail(), so no call is missed
+        Profile_Action_End(f);
+
     if (NOT_EVAL_FLAG(f, FULFILLING_ARG))
         CLEAR_FEED_FLAG(f->feed, BARRIER_HIT);
 
@@ -42,6 +42,18 @@
         | SERIES_FLAG_LINK_NODE_NEEDS_MARK  /* hashlist */)
 
 
+//=//// PAIRLIST_FLAG_SYMBOL_KEYS /////////////////////////////////////////=//
+//
+// Set while every key in the map is an unquoted ANY-WORD!.  Maps start out
+// this way, and stay so until a key of any other kind is put in...after which
+// they don't go back.  Finding a word key in such a map can then compare the
+// interned symbols of the keys directly, instead of going through the general
+// Cmp_Value().  (Dictionaries keyed by words are very common.)
+//
+#define PAIRLIST_FLAG_SYMBOL_KEYS \
+    SERIES_FLAG_25
+
+
 
 // See LINK() macro for how this is used.
 //
@@ -64,6 +76,57 @@ inline static REBARR *MAP_PAIRLIST(const_if_c REBMAP *map)
     SER_HEAD(MAP_HASHLIST(m))
 
 
+// Hashlists (used by maps and by the set operations) have a REBLEN slot per
+// hash position, which is 0 if empty or the 1-based number of the record in
+// the array being hashed.  After SER_USED() slots come the "control bytes",
+// one per slot.  These hold 7 bits of the hash of the key in that slot, so a
+// probe can usually tell that a slot can't match without dereferencing the
+// array and calling Cmp_Value().  (Bits are taken from a mix of the hash,
+// since the small INTEGER! hashes are all zero in their high bits.)
+//
+// The top bit is set if the record was seen to be a "zombie" (its value was
+// nulled out) so that probes only check the array for zombies on those.  It
+// is only a hint--zombie status is confirmed in the array before reuse.
+//
+// A control byte is written when Find_Key_Hashed() gives back an empty slot
+// that the caller may fill.  If the caller doesn't fill it, the byte is just
+// ignored while the slot stays empty.
+//
+#define HASH_ZOMBIE_HINT 0x80
+
+inline static REBYTE Hash_Fragment(uint32_t hash)
+  { return cast(REBYTE, (hash * 0x9E3779B1u) >> 25); }
+
+inline static REBLEN Hash_Series_Capacity(REBLEN slots) {
+    return slots + 1  // !!! extra REBLEN space as in original allocation
+        + (slots + sizeof(REBLEN) - 1) / sizeof(REBLEN);  // control bytes
+}
+
+inline static REBYTE *HASHLIST_CONTROLS(REBSER *hashlist) {
+    assert(SER_FLAVOR(hashlist) == FLAVOR_HASHLIST);
+    return cast(REBYTE*, SER_HEAD(REBLEN, hashlist) + SER_USED(hashlist));
+}
+
+
+// A map's hashlist counts the zombie records of the pairlist in its misc, so
+// growing the map can decide if squeezing them out is better than expanding.
+//
+// Growth of a managed map doesn't rehash all the records at once.  A bigger
+// hashlist is swapped in for new records, while the old one is kept in its
+// link so that lookups of records it indexes keep working until they have
+// been moved over.  Each map operation moves a few more, from the end of
+// the pairlist back, with the old hashlist counting how many remain in its
+// misc.  When none are left the link is cleared and the old one is garbage.
+//
+#define LINK_Old_Hashlist_TYPE      REBSER*
+#define LINK_Old_Hashlist_CAST      SER
+#define HAS_LINK_Old_Hashlist       FLAVOR_HASHLIST
+
+inline static bool Is_Hashlist_Migrating(REBSER *hashlist) {
+    return GET_SERIES_FLAG(hashlist, LINK_NODE_NEEDS_MARK);
+}
+
+
 inline static const REBMAP *VAL_MAP(REBCEL(const*) v) {
     assert(CELL_KIND(v) == REB_MAP);
 
@@ -307,8 +307,6 @@ inline static REBLEN SER_REST(const REBSER *s) {
     return sizeof(s->content) / SER_WIDE(s);
 }
 
-#define MAX_SERIES_BIAS 0x1000
-
 inline static void SER_SET_BIAS(REBSER *s, REBLEN bias) {
     assert(IS_SER_BIASED(s));
     s->content.dynamic.bonus.bias =
@@ -728,6 +726,13 @@ inline static REBSER *Manage_Series(REBSER *s)  // give manual series to GC
 
     s->leader.bits |= NODE_FLAG_MANAGED;
     Untrack_Manual_Series(s);
+
+    if (GC_Marking)
+        Remark_Series(s);  // may have references the mark phase hasn't seen
+    if (GC_Generational)
+        Nurse_Series(s);
+    Mark_If_Unswept(s);
+
     return s;
 }
 
@@ -841,6 +846,47 @@ inline static bool Is_Series_Read_Only(const REBSER *s) {  // may be temporary
 }
 
 
+//=//// INCREMENTAL GC WRITE BARRIER ///////////////////////////////////////=//
+//
+// When RECYCLE/INCREMENTAL is in effect, the mark phase is spread out over
+// evaluation steps (see Recycle_Step()).  If a series the GC had already
+// scanned were given a reference to a node not yet reached--and the only
+// other reference went away--then that node would be swept while in use.
+// So writes to series tell the GC, which rescans any that were already
+// marked before the cycle finishes.
+//
+// The same barrier keeps the "remembered set" for RECYCLE/GENERATIONAL.  A
+// minor collection doesn't look inside old series, so an old series that is
+// written to between collections is listed to have its contents scanned.
+//
+// FAIL_IF_READ_ONLY_SER() makes this call, which covers ENSURE_MUTABLE() and
+// variable assignment, and Expand_Series() makes it too.  Series that become
+// managed are handled by Alloc_Series_Node() and Manage_Series().  Code that
+// writes into an existing managed series *without* checking for mutability
+// should call GC_Write_Barrier() itself.
+//
+// Varlists are the exception, as CTX_VAR() is written by too much code (in
+// extensions especially) to be sure every write has the barrier.  The GC
+// rescans all of them instead (see Rescan_Varlists()), so for a varlist the
+// barrier is only a courtesy.
+//
+inline static void GC_Write_Barrier(const REBSER *s) {
+    if (s->leader.bits & SERIES_FLAG_GC_REMARK)
+        return;  // already listed to be rescanned
+
+    if (GC_Marking and (s->leader.bits & NODE_FLAG_MARKED))
+        Remark_Series(m_cast(REBSER*, s));
+    else if (
+        GC_Generational
+        and (s->leader.bits & (
+            NODE_FLAG_MANAGED | NODE_FLAG_ROOT | SERIES_FLAG_GC_YOUNG
+        )) == NODE_FLAG_MANAGED
+    ){
+        Remember_Series(m_cast(REBSER*, s));
+    }
+}
+
+
 // Gives the appropriate kind of error message for the reason the series is
 // read only (frozen, running, protected, locked to be a map key...)
 //
@@ -848,10 +894,25 @@ inline static bool Is_Series_Read_Only(const REBSER *s) {  // may be temporary
 // but if only one error is to be reported then this is probably the right
 // priority ordering.
 //
-
+// A series whose data is shared with a copy (SERIES_INFO_SHARED) is not read
+// only, but it has to get its own data before the write happens.  Testing
+// that bit along with the read-only bits keeps the common case to one test.
+//
 inline static void FAIL_IF_READ_ONLY_SER(REBSER *s) {
-    if (not Is_Series_Read_Only(s))
+    if (not (SER_INFO(s) & (
+        SERIES_INFO_HOLD | SERIES_INFO_PROTECTED
+        | SERIES_INFO_FROZEN_SHALLOW | SERIES_INFO_FROZEN_DEEP
+        | SERIES_INFO_SHARED
+    ))){
+        GC_Write_Barrier(s);  // caller is about to write
         return;
+    }
+
+    if (not Is_Series_Read_Only(s)) {
+        Unshare_Series(s);  // copy-on-write, see Copy_Binary_Shared_At_Len()
+        GC_Write_Barrier(s);
+        return;
+    }
 
     if (GET_SERIES_INFO(s, AUTO_LOCKED))
         fail (Error_Series_Auto_Locked_Raw());
@@ -1109,6 +1170,7 @@ inline static REBSER *Alloc_Series_Node(REBFLGS flags) {
     assert(not (flags & NODE_FLAG_CELL));
 
     REBSER *s = cast(REBSER*, Alloc_Node(SER_POOL));
+    GC_Bytes_Allocated += sizeof(REBSER);
     if ((GC_Ballast -= sizeof(REBSER)) <= 0)
         SET_SIGNAL(SIG_RECYCLE);
 
@@ -1119,6 +1181,26 @@ inline static REBSER *Alloc_Series_Node(REBFLGS flags) {
 
     s->leader.bits = NODE_FLAG_NODE | flags;  // #1
 
+    // Managed series made during an incremental mark phase are considered
+    // live for that cycle, and scanned before it ends (API handles are in
+    // the root set, which is rescanned anyway).  The generational GC needs
+    // to know about them too, see Nurse_Series().
+    //
+    // (Bookmarks and API instructions only say they are managed to dodge
+    // the manuals tracking, and clear the flag right away.)
+    //
+    if (
+        (flags & (NODE_FLAG_MANAGED | NODE_FLAG_ROOT)) == NODE_FLAG_MANAGED
+        and FLAVOR_BYTE(flags) != FLAVOR_BOOKMARKLIST
+        and FLAVOR_BYTE(flags) != FLAVOR_INSTRUCTION_ADJUST_QUOTING
+        and FLAVOR_BYTE(flags) != FLAVOR_INSTRUCTION_SPLICE
+    ){
+        if (GC_Marking)
+            Remark_Series(s);
+        if (GC_Generational)
+            Nurse_Series(s);
+    }
+
   #if !defined(NDEBUG)
     SAFETRASH_POINTER_IF_DEBUG(s->link.trash);  // #2
     memset(  // https://stackoverflow.com/q/57721104/
@@ -1216,7 +1298,12 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBLEN capacity) {
                 CLEAR_SERIES_FLAG(s, POWER_OF_2);
         }
 
-        s->content.dynamic.data = TRY_ALLOC_N(char, size);
+        if (Is_Mem_Mapped(size)) {
+            size = MEM_MAP_ROUND(size);  // capacity can use the whole page
+            s->content.dynamic.data = cast(char*, Try_Map_Mem(size));
+        }
+        else
+            s->content.dynamic.data = TRY_ALLOC_N(char, size);
         if (not s->content.dynamic.data)
             return false;
 
@@ -1247,6 +1334,7 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBLEN capacity) {
 
     // See if allocation tripped our need to queue a garbage collection
 
+    GC_Bytes_Allocated += size;
     if ((GC_Ballast -= size) <= 0)
         SET_SIGNAL(SIG_RECYCLE);
 
@@ -1267,6 +1355,7 @@ inline static REBSER *Make_Series(REBLEN capacity, REBFLGS flags)
     if (cast(REBU64, capacity) * wide > INT32_MAX)
         fail (Error_No_Memory(cast(REBU64, capacity) * wide));
 
+    REBI64 bytes_before = GC_Bytes_Allocated;  // for PROFILER/MEMORY
     REBSER *s = Alloc_Series_Node(flags);
 
     if (GET_SERIES_FLAG(s, INFO_NODE_NEEDS_MARK))
@@ -1312,6 +1401,10 @@ inline static REBSER *Make_Series(REBLEN capacity, REBFLGS flags)
         ] = s; // start out managed to not need to find/remove from this later
     }
 
+    REBI64 bytes = GC_Bytes_Allocated - bytes_before;
+    if ((TG_Alloc_Sample_Countdown -= bytes) < 0)
+        Sample_Allocation(s, cast(REBSIZ, bytes));
+
     return s;
 }
 
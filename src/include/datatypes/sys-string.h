@@ -33,11 +33,12 @@
 //   to smoothly traverse known good UTF-8 data using REBCHR(*).
 //
 // * Monitoring strings if they are ASCII only and using that to make an
-//   optimized jump.  !!! Work in progress, see notes below.
+//   optimized jump, where codepoint indexes and byte offsets are the same.
 //
 // * Maintaining caches (called "Bookmarks") that map from codepoint indexes
 //   to byte offsets for larger strings.  These caches must be updated
-//   whenever the string is modified.   !!! Only one bookmark per string ATM
+//   whenever the string is modified.  A few are kept per string, so that
+//   lookups which alternate between distant positions stay cheap.
 //
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
@@ -63,14 +64,23 @@
 // by character, to turn an index into an offset.  This is prohibitive.
 //
 // These bookmarks must be kept in sync.  How many bookmarks are kept
-// should be reigned in proportionally to the length of the series.  As
-// a first try of this strategy, singular arrays are being used.
+// should be reigned in proportionally to the length of the series.  For
+// now it's a short list of at most MAX_BOOKMARKS entries.
 //
 #define LINK_Bookmarks_TYPE     REBBMK*  // alias for REBSER* at this time
 #define LINK_Bookmarks_CAST     (REBBMK*)SER
 #define HAS_LINK_Bookmarks      FLAVOR_STRING
 
 
+//=//// STRING_FLAG_POOLED ////////////////////////////////////////////////=//
+//
+// The string is frozen and in the table of strings that equal ones share, so
+// it has to be taken out of the table when it is freed.  See %s-pool.c
+//
+#define STRING_FLAG_POOLED \
+    SERIES_FLAG_24
+
+
 inline static REBCHR(*) NEXT_CHR(
     REBUNI *codepoint_out,
     REBCHR(const_if_unchecked_utf8*) cp
@@ -182,26 +192,28 @@ inline static REBCHR(*) WRITE_CHR(REBCHR(*) cp, REBUNI c) {
 //=//// STRING ALL-ASCII FLAG /////////////////////////////////////////////=//
 //
 // One of the best optimizations that can be done on strings is to keep track
-// of if they contain only ASCII codepoints.  Such a flag would likely have
-// false negatives, unless all removals checked the removed portion for if
-// the ASCII flag is true.  It could be then refreshed by any routine that
-// walks an entire string for some other reason (like molding or printing).
+// of if they contain only ASCII codepoints.  Then a codepoint index is the
+// same as a byte offset, and no scanning or bookmarks are needed.
 //
-// For the moment, we punt on this optimization.  The main reason is that it
-// means the non-ASCII code is exercised on every code path, which is a good
-// substitute for finding high-codepoint data to pass through to places that
-// would not receive it otherwise.
+// A separate flag would have to be updated by every routine that modifies
+// strings, and would get false negatives unless removals checked what they
+// took out.  But non-symbol strings already cache their length in
+// codepoints next to their size in bytes.  For valid UTF-8 those are only
+// equal when every codepoint is a single byte--so comparing them gives an
+// answer that is exact and always up to date, at no bookkeeping cost.
 //
-// But ultimately this optimization will be necessary, and decisions on how
-// up-to-date the flag should be kept would need to be made.
-
-#define Is_Definitely_Ascii(s) false
-
-inline static bool Is_String_Definitely_ASCII(const REBSTR *str) {
-    UNUSED(str);
-    return false;
+// (Symbols don't cache their length, so they are never considered ASCII.
+// Also note that while a modification has changed the size but not yet
+// fixed up the length, the answer is meaningless.  That is already true of
+// STR_LEN() itself, so such code must not be doing index lookups anyway.)
+//
+inline static bool Is_Definitely_Ascii(const REBSTR *s) {
+    return IS_NONSYMBOL_STRING(s) and s->misc.length == SER_USED(s);
 }
 
+#define Is_String_Definitely_ASCII(str) \
+    Is_Definitely_Ascii(str)
+
 #define STR_UTF8(s) \
     SER_HEAD(const char, ensure(const REBSTR*, s))
 
@@ -302,23 +314,30 @@ inline static void TERM_STR_LEN_SIZE(REBSTR *s, REBLEN len, REBSIZ used) {
 // UTF-8 strings based on index, vs. having to necessarily search from the
 // beginning.
 //
-// !!! At the moment, only one bookmark is in effect at a time.  Even though
-// it's just two numbers, there's only one pointer's worth of space in the
-// series node otherwise.  Bookmarks aren't generated for strings that are
-// very short, or that are never enumerated.
+// Up to MAX_BOOKMARKS positions are remembered, the most recently used one
+// first.  That way code which alternates between distant positions (like a
+// PARSE with marks far apart in a large string) does not have to rescan
+// the distance between them on each access.  Bookmarks aren't generated for
+// strings that are very short, or that are never enumerated.
 
-#define BMK_INDEX(b) \
-    SER_HEAD(struct Reb_Bookmark, c_cast(REBBMK*, (b)))->index
+#define MAX_BOOKMARKS 4
 
-#define BMK_OFFSET(b) \
-    SER_HEAD(struct Reb_Bookmark, c_cast(REBBMK*, (b)))->offset
+// A lookup that lands within this many codepoints of an existing bookmark
+// moves that bookmark, vs. making a new one.  Lookups this near the head or
+// tail are not worth caching at all.
+//
+#define BOOKMARK_SPACING 64
+
+#define BMK_AT(b,n) \
+    SER_AT(struct Reb_Bookmark, c_cast(REBBMK*, (b)), (n))
 
 inline static REBBMK* Alloc_Bookmark(void) {
     REBSER *s = Make_Series(
-        1,
+        MAX_BOOKMARKS,
         FLAG_FLAVOR(BOOKMARKLIST) | SERIES_FLAG_MANAGED
     );
-    SET_SERIES_LEN(s, 1);
+    assert(SER_REST(s) >= MAX_BOOKMARKS);
+    SET_SERIES_LEN(s, 0);
     CLEAR_SERIES_FLAG(s, MANAGED);  // manual but untracked (avoid leak error)
     return cast(REBBMK*, s);
 }
@@ -331,22 +350,50 @@ inline static void Free_Bookmarks_Maybe_Null(REBSTR *str) {
     }
 }
 
+// Make the bookmark at position `n` the first one in the list, shuffling
+// the more recently used ones down.  If `n` is the length of the list then
+// a new bookmark is added, and if the list is full the last one is dropped.
+//
+inline static struct Reb_Bookmark *Promote_Bookmark(REBBMK *bookmark, REBLEN n)
+{
+    REBLEN used = SER_USED(bookmark);
+    assert(n <= used);
+
+    if (n == used) {
+        if (used < MAX_BOOKMARKS)
+            SET_SERIES_LEN(bookmark, used + 1);
+        else
+            --n;  // overwrite the least recently used
+    }
+
+    struct Reb_Bookmark *head = BMK_AT(bookmark, 0);
+    struct Reb_Bookmark temp = head[n];
+    memmove(head + 1, head, n * sizeof(struct Reb_Bookmark));
+    head[0] = temp;
+    return head;
+}
+
 #if !defined(NDEBUG)
     inline static void Check_Bookmarks_Debug(REBSTR *s) {
         REBBMK *bookmark = LINK(Bookmarks, s);
         if (not bookmark)
             return;
 
-        REBLEN index = BMK_INDEX(bookmark);
-        REBSIZ offset = BMK_OFFSET(bookmark);
+        assert(SER_USED(bookmark) <= MAX_BOOKMARKS);
 
-        REBCHR(*) cp = STR_HEAD(s);
-        REBLEN i;
-        for (i = 0; i != index; ++i)
-            cp = NEXT_STR(cp);
+        REBLEN n;
+        for (n = 0; n < SER_USED(bookmark); ++n) {
+            REBLEN index = BMK_AT(bookmark, n)->index;
+            REBSIZ offset = BMK_AT(bookmark, n)->offset;
 
-        REBSIZ actual = cast(REBYTE*, cp) - SER_DATA(s);
-        assert(actual == offset);
+            REBCHR(*) cp = STR_HEAD(s);
+            REBLEN i;
+            for (i = 0; i != index; ++i)
+                cp = NEXT_STR(cp);
+
+            REBSIZ actual = cast(REBYTE*, cp) - SER_DATA(s);
+            assert(actual == offset);
+        }
     }
 #endif
 
@@ -371,10 +418,8 @@ inline static void Free_Bookmarks_Maybe_Null(REBSTR *str) {
 inline static REBCHR(*) STR_AT(const_if_c REBSTR *s, REBLEN at) {
     assert(at <= STR_LEN(s));
 
-    if (Is_Definitely_Ascii(s)) {  // can't have any false positives
-        assert(not LINK(Bookmarks, s));  // mutations must ensure this
+    if (Is_Definitely_Ascii(s))  // can't have any false positives
         return cast(REBCHR(*), cast(REBYTE*, STR_HEAD(s)) + at);
-    }
 
     REBCHR(*) cp;  // can be used to calculate offset (relative to STR_HEAD())
     REBLEN index;
@@ -397,128 +442,107 @@ inline static REBCHR(*) STR_AT(const_if_c REBSTR *s, REBLEN at) {
     BOOKMARK_TRACE("%s", bookmark ? "bookmarked" : "no bookmark");
   #endif
 
-    if (at < len / 2) {
-        if (len < sizeof(REBVAL)) {
-            if (IS_NONSYMBOL_STRING(s))
-                assert(
-                    GET_SERIES_FLAG(s, DYNAMIC)  // e.g. mold buffer
-                    or not bookmark  // mutations must ensure this
-                );
-            goto scan_from_head;  // good locality, avoid bookmark logic
-        }
-        if (not bookmark and IS_NONSYMBOL_STRING(s)) {
-            bookmark = Alloc_Bookmark();
-            mutable_LINK(Bookmarks, m_cast(REBSTR*, s)) = bookmark;
-            goto scan_from_head;  // will fill in bookmark
-        }
-    }
-    else {
-        if (len < sizeof(REBVAL)) {
-            if (IS_NONSYMBOL_STRING(s))
-                assert(
-                    not bookmark  // mutations must ensure this usually but...
-                    or GET_SERIES_FLAG(s, DYNAMIC)  // !!! mold buffer?
-                );
-            goto scan_from_tail;  // good locality, avoid bookmark logic
-        }
-        if (not bookmark and IS_NONSYMBOL_STRING(s)) {
-            bookmark = Alloc_Bookmark();
-            mutable_LINK(Bookmarks, m_cast(REBSTR*, s)) = bookmark;
-            goto scan_from_tail;  // will fill in bookmark
-        }
+    if (len < sizeof(REBVAL)) {
+        if (IS_NONSYMBOL_STRING(s))
+            assert(
+                GET_SERIES_FLAG(s, DYNAMIC)  // e.g. mold buffer
+                or not bookmark  // mutations must ensure this
+            );
+        bookmark = nullptr;  // good locality, avoid bookmark logic
     }
 
-    // Theoretically, a large UTF-8 string could have multiple "bookmarks".
-    // That would complicate this logic by having to decide which one was
-    // closest to be using.  For simplicity we just use one right now to
-    // track the last access--which speeds up the most common case of an
-    // iteration.  Improve as time permits!
+    // Start from whichever of the head, the tail, or the bookmarks is the
+    // closest to the index.  Ties favor the head and tail, since scanning
+    // from them doesn't need to touch the bookmark list.
     //
-    assert(not bookmark or SER_USED(bookmark) == 1);  // only one
+    REBLEN nearest;  // position of bookmark in list, or SER_USED() if none
+    REBLEN distance;
 
   blockscope {
-    REBLEN booked = bookmark ? BMK_INDEX(bookmark) : 0;
-
-    // `at` is always positive.  `booked - at` may be negative, but if it
-    // is positive and bigger than `at`, faster to seek from head.
-    //
-    if (cast(REBINT, at) < cast(REBINT, booked) - cast(REBINT, at)) {
-        if (booked > sizeof(REBVAL))
-            bookmark = nullptr;  // don't throw away bookmark for low searches
-        goto scan_from_head;
+    bool from_tail = (len - at < at);
+    distance = from_tail ? len - at : at;
+    nearest = bookmark ? SER_USED(bookmark) : 0;
+
+    REBLEN used = nearest;
+    REBLEN n;
+    for (n = 0; n != used; ++n) {
+        REBLEN booked = BMK_AT(bookmark, n)->index;
+        REBLEN d = booked > at ? booked - at : at - booked;
+        if (d < distance) {
+            distance = d;
+            nearest = n;
+        }
     }
 
-    // `len - at` is always positive.  `at - booked` may be negative, but if
-    // it is positive and bigger than `len - at`, faster to seek from tail.
-    //
-    if (cast(REBINT, len - at) < cast(REBINT, at) - cast(REBINT, booked)) {
-        if (booked > sizeof(REBVAL))
-            bookmark = nullptr;  // don't throw away bookmark for low searches
-        goto scan_from_tail;
+    if (bookmark and nearest != SER_USED(bookmark)) {
+        index = BMK_AT(bookmark, nearest)->index;
+        cp = cast(REBCHR(*), SER_DATA(s) + BMK_AT(bookmark, nearest)->offset);
+    }
+    else if (from_tail) {
+      #ifdef DEBUG_TRACE_BOOKMARKS
+        BOOKMARK_TRACE("scan from tail");
+      #endif
+        index = len;
+        cp = STR_TAIL(s);
+    }
+    else {
+      #ifdef DEBUG_TRACE_BOOKMARKS
+        BOOKMARK_TRACE("scan from head");
+      #endif
+        index = 0;
+        cp = STR_HEAD(s);
     }
-
-    index = booked;
-    if (bookmark)
-        cp = cast(REBCHR(*), SER_DATA(s) + BMK_OFFSET(bookmark));
-    else
-        cp = cast(REBCHR(*), SER_DATA(s));
   }
 
     if (index > at) {
       #ifdef DEBUG_TRACE_BOOKMARKS
         BOOKMARK_TRACE("backward scan %ld", index - at);
       #endif
-        goto scan_backward;
+        for (; index != at; --index)
+            cp = BACK_STR(cp);
+    }
+    else {
+      #ifdef DEBUG_TRACE_BOOKMARKS
+        BOOKMARK_TRACE("forward scan %ld", at - index);
+      #endif
+        for (; index != at; ++index)
+            cp = NEXT_STR(cp);
     }
 
-  #ifdef DEBUG_TRACE_BOOKMARKS
-    BOOKMARK_TRACE("forward scan %ld", at - index);
-  #endif
-    goto scan_forward;
-
-  scan_from_head:
-  #ifdef DEBUG_TRACE_BOOKMARKS
-    BOOKMARK_TRACE("scan from head");
-  #endif
-    cp = STR_HEAD(s);
-    index = 0;
-
-  scan_forward:
-    assert(index <= at);
-    for (; index != at; ++index)
-        cp = NEXT_STR(cp);
-
-    if (not bookmark)
-        return cp;
-
-    goto update_bookmark;
-
-  scan_from_tail:
-  #ifdef DEBUG_TRACE_BOOKMARKS
-    BOOKMARK_TRACE("scan from tail");
-  #endif
-    cp = STR_TAIL(s);
-    index = len;
-
-  scan_backward:
-    assert(index >= at);
-    for (; index != at; --index)
-        cp = BACK_STR(cp);
+    // A scan that started from a bookmark moves it if it didn't go far, so
+    // that iterations keep reusing the same one.  Otherwise a long scan
+    // makes a new bookmark (dropping the least recently used if need be).
+    //
+    if (
+        len >= sizeof(REBVAL)
+        and IS_NONSYMBOL_STRING(s)
+        and NOT_SERIES_FLAG(s, SHARED_HEAP)  // other threads may be reading
+    ){
+        if (not bookmark or nearest == SER_USED(bookmark)) {
+            if (distance <= BOOKMARK_SPACING) {
+              #ifdef DEBUG_TRACE_BOOKMARKS
+                BOOKMARK_TRACE("not cached\n");
+              #endif
+                goto verify;
+            }
+            if (not bookmark) {
+                bookmark = Alloc_Bookmark();
+                mutable_LINK(Bookmarks, m_cast(REBSTR*, s)) = bookmark;
+            }
+            nearest = SER_USED(bookmark);  // adds new bookmark
+        }
+        else if (distance > BOOKMARK_SPACING)
+            nearest = SER_USED(bookmark);  // keep old one, adds new bookmark
 
-    if (not bookmark) {
       #ifdef DEBUG_TRACE_BOOKMARKS
-        BOOKMARK_TRACE("not cached\n");
+        BOOKMARK_TRACE("caching %ld\n", index);
       #endif
-        return cp;
+        struct Reb_Bookmark *book = Promote_Bookmark(bookmark, nearest);
+        book->index = index;
+        book->offset = cp - STR_HEAD(s);
     }
 
-  update_bookmark:
-  #ifdef DEBUG_TRACE_BOOKMARKS
-    BOOKMARK_TRACE("caching %ld\n", index);
-  #endif
-    BMK_INDEX(bookmark) = index;
-    BMK_OFFSET(bookmark) = cp - STR_HEAD(s);
-
+  verify:
   #if defined(DEBUG_VERIFY_STR_AT)
     REBCHR(*) check_cp = STR_HEAD(s);
     REBLEN check_index = 0;
@@ -623,6 +647,8 @@ inline static REBSIZ VAL_SIZE_LIMIT_AT(
     else {
         if (length_out)
             *unwrap(length_out) = limit;
+        if (Is_Definitely_Ascii(VAL_STRING(v)))
+            return limit;
         tail = at;
         for (; limit > 0; --limit)
             tail = NEXT_STR(tail);
@@ -731,12 +757,18 @@ inline static void SET_CHAR_AT(REBSTR *s, REBLEN n, REBUNI c) {
         *cast(REBYTE*, STR_TAIL(s)) = '\0';  // add terminator
 
         // `cp` still is the start of the character for the index we were
-        // dealing with.  Only update bookmark if it's an offset *after*
+        // dealing with.  Only update bookmarks if they're an offset *after*
         // that character position...
         //
-        REBBMK *book = LINK(Bookmarks, s);
-        if (book and BMK_OFFSET(book) > cp_offset)
-            BMK_OFFSET(book) += delta;
+        REBBMK *bookmark = LINK(Bookmarks, s);
+        if (bookmark) {
+            REBLEN i;
+            for (i = 0; i < SER_USED(bookmark); ++i) {
+                struct Reb_Bookmark *book = BMK_AT(bookmark, i);
+                if (book->offset > cp_offset)
+                    book->offset += delta;
+            }
+        }
     }
 
   #ifdef DEBUG_UTF8_EVERYWHERE  // see note on `len` at start of function
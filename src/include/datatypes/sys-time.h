@@ -103,6 +103,28 @@ inline static int VAL_ZONE(REBCEL(const*) v) {
     return VAL_DATE(v).zone;
 }
 
+// Make a DATE! with a time and zone, e.g. from the fields of a C `struct tm`
+// (MAKE-DATE-YMDSNZ does the same from usermode).  The zone is in minutes,
+// but stored in units of ZONE_MINS.
+//
+inline static REBVAL *Init_Date_Ymdnz(
+    RELVAL *v,
+    int year,
+    int month,
+    int day,
+    REBI64 nanoseconds,
+    int zone_minutes
+){
+    RESET_CELL(v, REB_DATE, CELL_MASK_NONE);
+    VAL_YEAR(v) = year;
+    VAL_MONTH(v) = month;
+    VAL_DAY(v) = day;
+    VAL_DATE(v).zone = zone_minutes / ZONE_MINS;
+    PAYLOAD(Time, v).nanoseconds = nanoseconds;
+    assert(Does_Date_Have_Zone(v));
+    return cast(REBVAL*, v);
+}
+
 
 //=////////////////////////////////////////////////////////////////////////=//
 //
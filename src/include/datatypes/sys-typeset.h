@@ -531,6 +531,52 @@ inline static bool Typecheck_Including_Constraints(
 }
 
 
+// Most arguments are checked by just seeing if their kind is in the typeset
+// of an ordinary parameter.  The pseudotype flags in these bits mean the
+// parameter needs more attention than that.
+//
+#define TS_PARAM_NOT_PLAIN \
+    (FLAGIT_KIND(REB_TS_VARIADIC) | FLAGIT_KIND(REB_TS_REFINEMENT) \
+        | FLAGIT_KIND(REB_TS_NOOP_IF_BLANK) | FLAGIT_KIND(REB_TS_CONST))
+
+// Fast path for the typecheck pass of action calls.  If this returns true,
+// the argument passes all of Process_Action()'s checks for the parameter,
+// which is decided with one AND of the typeset bits.  If false, the full
+// checks have to be run (which also give the errors).
+//
+// NULL and BAD-WORD! are left to the full checks since they could be endish
+// or isotopes, as are QUOTED!s (whose KIND3Q_BYTE() is over REB_64).
+//
+inline static bool Typecheck_Plain_Arg(
+    const REBPAR *param,
+    const RELVAL *arg
+){
+    REBYTE kind_byte = KIND3Q_BYTE(arg);
+    if (
+        kind_byte >= REB_MAX
+        or kind_byte == REB_NULL
+        or kind_byte == REB_BAD_WORD
+    ){
+        return false;
+    }
+
+    switch (VAL_PARAM_CLASS(param)) {
+      case REB_P_NORMAL:
+      case REB_P_SOFT:
+      case REB_P_MEDIUM:
+      case REB_P_HARD:
+        break;
+
+      default:  // RETURN, OUTPUT, and META have their own rules
+        return false;
+    }
+
+    REBU64 bits = VAL_TYPESET_LOW_BITS(param)
+        | (cast(REBU64, VAL_TYPESET_HIGH_BITS(param)) << 32);
+    REBU64 kind_flag = FLAGIT_KIND(kind_byte);
+    return (bits & (kind_flag | TS_PARAM_NOT_PLAIN)) == kind_flag;
+}
+
 inline static bool Is_Typeset_Empty(REBCEL(const*) param) {
     assert(CELL_HEART(param) == REB_TYPESET);
     REBU64 bits = VAL_TYPESET_LOW_BITS(param);
@@ -58,8 +58,94 @@ struct rebol_mem_pool {
     REBLEN num_units;  // units per segment allocation
     REBLEN free;  // number of units remaining
     REBLEN has;  // total number of units
+    REBLEN reclaimed;  // segments given back by Reclaim_Pool_Segments()
 };
 
+
+//=//// POOL UNIT CACHES //////////////////////////////////////////////////=//
+//
+// Try_Alloc_Node() first serves units out of a small LIFO cache in front of
+// each pool (see TG_Pool_Caches), so the common allocation is a pop off a
+// short stack of recently freed units instead of a trip through the REBPOL
+// bookkeeping.
+//
+// This is a single-threaded free-list cache, not a per-thread one.  The
+// caches are ordinary TVAR state, so there is one array of them for the
+// process (with USE_THREAD_ISOLATES, one per isolate--which has its own
+// pools too).  Only the thread that started the pools may allocate or free
+// nodes.  Helper threads (the GC's mark threads, the workers of a parallel
+// SORT) must not, and the debug build asserts it (see ASSERT_POOL_THREAD()).
+//
+// A cache that runs dry takes POOL_CACHE_BATCH units off its pool's free
+// list in one go.  In the release build, Free_Node() and the freeing of
+// series data push units back onto the cache, and if that grows past
+// POOL_CACHE_MAX a batch is handed back to the pool.  (The debug build puts
+// frees on the pool's own free list as it did before the caches, so that
+// Free_Node() can still append to the tail and lengthen the time freed
+// memory is "poisonous".)
+//
+// Cached units keep FREED_SERIES_BYTE in their first byte, so code that
+// enumerates pool segments (the GC sweep, leak checks) still sees them as
+// free.  But they are *not* on the pool's free list, nor counted in its
+// `free` field...use Pool_Units_Free() to get the combined figure.
+//
+struct rebol_pool_cache {
+    REBPLU *first;  // stack of free units, linked through `next_if_free`
+    REBLEN count;  // number of units on the stack
+
+    REBU64 hits;  // allocations served from the stack
+    REBU64 misses;  // allocations that found the stack empty
+    REBU64 refills;  // batches taken from the pool's free list
+    REBU64 drains;  // batches given back to the pool's free list
+};
+
+#define POOL_CACHE_BATCH 32
+#define POOL_CACHE_MAX (POOL_CACHE_BATCH * 2)
+
+#if !defined(NDEBUG)
+    extern THREAD_LOCAL bool Pool_Thread_Debug;  // set by Startup_Pools()
+
+    #define ASSERT_POOL_THREAD() \
+        assert(Pool_Thread_Debug)  // not a helper thread, see above
+#else
+    #define ASSERT_POOL_THREAD() NOOP
+#endif
+
+
+//=//// PAGE-MAPPED ALLOCATIONS ///////////////////////////////////////////=//
+//
+// Big heaps made of malloc()'d pool segments and series data are scattered
+// over ordinary 4K pages, so marking in the GC spends a lot of its time on
+// TLB misses.  When R3_HUGE_PAGES is set in the environment at startup (and
+// the platform has mmap(), see HAS_MEM_MAP in %m-pools.c), pool segments
+// are grown to a whole MEM_MAP_GRANULE and mapped directly from the OS, as
+// is any series data of MEM_MAP_THRESHOLD bytes or more:
+//
+//     R3_HUGE_PAGES=1  ; ordinary mapping, advised for transparent huge pages
+//     R3_HUGE_PAGES=2  ; explicit MAP_HUGETLB (needs vm.nr_hugepages), with
+//                      ; the transparent mapping as fallback
+//
+// Whether a block was mapped is decided only from its size (see Is_Mem_Mapped
+// in %sys-node.h), so nothing extra has to be stored with it.  The threshold
+// is half the granule, because the size a series reports back at free time
+// (SER_TOTAL) may be rounded down by up to one unit from what was allocated.
+//
+// Mapped series data can also be grown with mremap(), which moves the page
+// table entries instead of copying the bytes (see Expand_Series()).
+//
+enum Reb_Mem_Map_Mode {
+    MEM_MAP_NONE = 0,
+    MEM_MAP_TRANSPARENT,
+    MEM_MAP_HUGETLB
+};
+
+#define MEM_MAP_GRANULE (2 * 1024 * 1024)  // usual x86-64 and ARM64 huge page
+#define MEM_MAP_THRESHOLD (MEM_MAP_GRANULE / 2)
+
+#define MEM_MAP_ROUND(size) \
+    (((size) + (MEM_MAP_GRANULE - 1)) & ~cast(size_t, MEM_MAP_GRANULE - 1))
+
+
 #define DEF_POOL(size, count) {size, count}
 #define MOD_POOL(size, count) {size * MEM_MIN_SIZE, count}
 
@@ -68,6 +154,65 @@ struct rebol_mem_pool {
 
 #define MEM_BALLAST 3000000
 
+
+//=//// GC PAUSE LOG //////////////////////////////////////////////////////=//
+//
+// Each collection (minor or major) leaves an entry in a ring buffer, which
+// STATS/PAUSES gives back.  The bytes freed are what came free during the
+// pause, so a lazy sweep (RECYCLE/LAZY) frees more than is logged.  From the
+// bytes allocated between collections and the time between them, the rate
+// of allocation can be seen.
+//
+// That rate is also what RECYCLE/ADAPTIVE uses to set the GC_Ballast, in
+// Reset_GC_Ballast().
+//
+enum Reb_GC_Trigger {
+    GC_TRIGGER_REQUEST = 0,  // Recycle() called directly, e.g. by RECYCLE
+    GC_TRIGGER_BALLAST,  // allocations used up the GC_Ballast
+    GC_TRIGGER_PROMOTION,  // minor collections promoted enough for a major
+    GC_TRIGGER_SHUTDOWN
+};
+
+struct Reb_GC_Pause {
+    REBI64 nanoseconds;  // length of the pause
+    REBI64 interval;  // nanoseconds since the end of the prior collection
+    REBI64 allocated;  // bytes counted against the ballast in that interval
+    REBI64 freed;  // bytes no longer in use after the pause
+    REBI64 live;  // bytes still in use after the pause
+    REBLEN swept;  // nodes freed
+    enum Reb_GC_Trigger trigger;
+    bool minor;
+};
+
+#define GC_PAUSE_LOG_SIZE 64
+
+
+//=//// HEAP DUMP REFERENCES //////////////////////////////////////////////=//
+//
+// While Recycle_Tracing_Heap() runs, every reference the GC follows is given
+// to Trace_Heap_Reference() (see %d-heap.c).  A reference out of a cell says
+// the cell's heart (a Reb_Kind) for how it was made, and one out of a series
+// stub's own slots uses one of the HEAP_EDGE_XXX codes that come after them.
+// A reference from the root set says which part of the root set it was.
+//
+enum Reb_Heap_Edge {
+    HEAP_EDGE_LINK = 0xF0,
+    HEAP_EDGE_MISC,
+    HEAP_EDGE_INODE,
+    HEAP_EDGE_BONUS,
+    HEAP_EDGE_KEY  // keylist to the symbol of a key
+};
+
+enum Reb_Heap_Root {
+    HEAP_ROOT_MANUALS = 1,  // unmanaged series and API handles
+    HEAP_ROOT_NATIVES,
+    HEAP_ROOT_SYMBOLS,
+    HEAP_ROOT_DATA_STACK,
+    HEAP_ROOT_GUARDED,
+    HEAP_ROOT_FRAMES,
+    HEAP_ROOT_DEVICES
+};
+
 enum Mem_Pool_Specs {
     MEM_TINY_POOL = 0,
     MEM_SMALL_POOLS = MEM_TINY_POOL + 16,
@@ -601,6 +601,22 @@
     (((s) + (a) - 1) & ~((a) - 1))
 
 
+//=//// THREAD-LOCAL STORAGE ////////////////////////////////////////////=//
+//
+// C11 has `_Thread_local` and C++11 has `thread_local`, but older compilers
+// that are still supported have only their own spellings of it.
+//
+#if defined(CPLUSPLUS_11)
+    #define THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+    #define THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define THREAD_LOCAL _Thread_local
+#else
+    #define THREAD_LOCAL __thread  // GCC, Clang, TCC on ELF
+#endif
+
+
 //=//// C FUNCTION TYPE (__cdecl) /////////////////////////////////////////=//
 //
 // Note that you *CANNOT* cast something like a `void *` to (or from) a
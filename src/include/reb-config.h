@@ -60,6 +60,10 @@ To change the config, host-kit developers can define:
 
     REB_CORE        - build /core only, no graphics, windows, etc.
 
+    SIGNALS_AT_CALLS - poll for signals (GC, Ctrl-C...) only when an action
+                      is dispatched or a block starts evaluating, instead of
+                      on every evaluator step (see %c-signal.c)
+
 Special internal defines used by RT, not Host-Kit developers:
 
     REB_API         - build r3lib as API
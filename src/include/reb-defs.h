@@ -97,6 +97,7 @@ typedef uint_fast32_t REBUNI;
 //=//// MEMORY POOLS //////////////////////////////////////////////////////=//
 //
 typedef struct rebol_mem_pool REBPOL;
+typedef struct rebol_pool_cache REBPCH;
 
 struct Reb_Pool_Unit;
 typedef struct Reb_Pool_Unit REBPLU;
@@ -132,6 +133,8 @@ struct Reb_Bookmark {
     REBSIZ offset;
 };
 
+struct Reb_Shared_Region;  // frozen series any isolate can read, %m-shared.c
+
 //=//// BINDING ///////////////////////////////////////////////////////////=//
 
 struct Reb_Binder;
@@ -267,3 +270,10 @@ struct Reb_Request;
 #define REBREQ REBBIN
 struct rebol_device;
 #define REBDEV struct rebol_device
+
+// Readiness backend, installed by the event extension if the OS has one
+// (e.g. epoll or kqueue).  It is called with `want` of 0 to stop watching,
+// and before the request's flags are updated (so they hold the old `want`).
+// Returns false if the handle couldn't be watched, and should be polled.
+//
+typedef bool (*WATCH_CFUNC)(REBREQ *req, int fd, uint16_t want);
@@ -101,6 +101,14 @@ enum {
     RRF_PENDING = 1 << 3, // Request is attached to pending list
     RRF_ACTIVE = 1 << 5, // Port is active, even no new events yet
 
+    // A pending request that is waiting on an OS handle can say so with
+    // OS_Watch_Request(), and then Poll_Default() only retries it once the
+    // readiness backend (if there is one) has set RRF_READY.
+    //
+    RRF_WANT_READ = 1 << 6,  // retry when the handle has data or a connection
+    RRF_WANT_WRITE = 1 << 7,  // retry when the handle can be written
+    RRF_READY = 1 << 8,  // backend saw the handle become ready since last try
+
     // !!! This was a "local flag to mark null device" which when not managed
     // here was confusing.  Given the need to essentially replace the whole
     // device model, it's clearer to keep it here.
@@ -120,7 +128,8 @@ enum {
     RFM_TRUNCATE = 1 << 6,
     RFM_RESEEK = 1 << 7, // file index has moved, reseek
     RFM_DIR = 1 << 8,
-    RFM_TEXT = 1 << 9 // on appropriate platforms, translate LF to CR LF
+    RFM_TEXT = 1 << 9, // on appropriate platforms, translate LF to CR LF
+    RFM_ASYNC = 1 << 10  // READ or WRITE gives a READ or WROTE event when done
 };
 
 #define MAX_FILE_NAME 1022
@@ -168,6 +177,7 @@ struct rebol_devreq {
     uint16_t flags;         // request flags
     uint16_t state;         // device process flags
     int32_t timeout;        // request timeout
+    int watched;            // handle given to OS_Watch_Request(), if WANT
 //  int (*prewake)(void *); // callback before awake
 
     // !!! Only one of these fields is active at a time, so what it really
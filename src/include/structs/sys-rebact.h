@@ -139,16 +139,24 @@
     SERIES_FLAG_30
 
 
-//=//// DETAILS_FLAG_31 ///////////////////////////////////////////////////=//
+//=//// DETAILS_FLAG_SOFT_QUOTES_FIRST ////////////////////////////////////=//
 //
-#define DETAILS_FLAG_31 \
+// This is a calculated property, which is cached by Make_Action().
+//
+// A soft-quoting first argument (e.g. `:value` of an enfix DEFAULT) will let
+// evaluative material on its left run first when lookahead is suppressed.
+// Enfix lookahead asks this for every quoting enfix function it sees, so it
+// is cached alongside DETAILS_FLAG_QUOTES_FIRST (which it implies).
+//
+#define DETAILS_FLAG_SOFT_QUOTES_FIRST \
     SERIES_FLAG_31
 
 
 // These are the flags which are scanned for and set during Make_Action
 //
 #define DETAILS_MASK_CACHED \
-    (DETAILS_FLAG_QUOTES_FIRST | DETAILS_FLAG_SKIPPABLE_FIRST)
+    (DETAILS_FLAG_QUOTES_FIRST | DETAILS_FLAG_SKIPPABLE_FIRST \
+        | DETAILS_FLAG_SOFT_QUOTES_FIRST)
 
 // These flags should be copied when specializing or adapting.  They may not
 // be derivable from the paramlist (e.g. a native with no RETURN does not
@@ -79,9 +79,13 @@ typedef REBBIN REBTYP;  // Rebol Type (list of hook function pointers)
     (ARRAY_FLAG_HAS_FILE_LINE_UNMASKED | SERIES_FLAG_LINK_NODE_NEEDS_MARK)
 
 
-//=//// ARRAY_FLAG_25 /////////////////////////////////////////////////////=//
+//=//// ARRAY_FLAG_HASH_INDEXED ///////////////////////////////////////////=//
 //
-#define ARRAY_FLAG_25 \
+// A deep-frozen array that FIND and SELECT have searched has an entry in the
+// side table of hash indexes (see "ARRAY HASH INDEX" in %t-block.c).  This
+// tells Decay_Series() to remove it.
+//
+#define ARRAY_FLAG_HASH_INDEXED \
     SERIES_FLAG_25
 
 
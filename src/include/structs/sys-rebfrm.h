@@ -34,6 +34,15 @@
 #define LINK_ReuseNext_CAST         ARR
 #define HAS_LINK_ReuseNext          FLAVOR_VARLIST
 
+// The reusable varlists are kept in separate lists by capacity, so a push
+// can find one big enough without reallocating its data.  List `n` holds
+// varlists with room for at least `2 << n` cells, and the last list holds
+// everything bigger.  Lists are capped at VARLIST_REUSE_MAX entries, to not
+// hold onto the memory of a recursion that ran deep once.
+//
+#define VARLIST_REUSE_BUCKETS 8
+#define VARLIST_REUSE_MAX 64
+
 
 // !!! A REBFRM* answers that it is a node, and a cell.  This is questionable
 // and should be reviewed now that many features no longer depend on it.
@@ -57,4 +57,10 @@ struct Reb_State {
     // the signal mask and restoring it at the trap states.
     //
     REBFLGS saved_sigmask;
+
+    // A trap that throws away the error it catches (e.g. ATTEMPT) sets this,
+    // so fail() doesn't spend time capturing the WHERE and NEAR of the error
+    // from the stack, since nothing will look at them.
+    //
+    bool discards_error;
 };
@@ -64,6 +64,36 @@
 #define LINK_PatchSymbol_CAST           SYM
 #define HAS_LINK_PatchSymbol            FLAVOR_PATCH
 
+
+//=//// PATCH KEY FILTER //////////////////////////////////////////////////=//
+//
+// Patches that aren't LETs don't need the link slot for a symbol, so it holds
+// a one-word bloom filter of the keys in the patch's context (up to the
+// patch's limit).  Each symbol sets one bit, picked from its address.  If a
+// word's bit isn't in the filter, Get_Word_Container_Core() can step to the
+// next patch without searching the keys.
+//
+// Big contexts would saturate the filter anyway, so they don't spend time
+// computing it and just get all bits set.  So do FRAME!s, whose keys depend
+// on the phase.
+//
+// (This is not a node, so SERIES_FLAG_LINK_NODE_NEEDS_MARK isn't set on the
+// non-LET patches.)
+//
+#define LINK_PATCH_FILTER(patch) \
+    (patch)->link.any.u
+
+#define PATCH_FILTER_ALL \
+    (~cast(uintptr_t, 0))
+
+#define PATCH_FILTER_MAX_KEYS 32
+
+#define PATCH_FILTER_BIT(symbol) \
+    (cast(uintptr_t, 1) << ( \
+        ((cast(uintptr_t, (symbol)) >> 4) ^ (cast(uintptr_t, (symbol)) >> 10)) \
+            % (sizeof(uintptr_t) * 8) \
+    ))
+
 #define INODE_NextPatch_TYPE            REBARR*
 #define INODE_NextPatch_CAST            ARR
 #define HAS_INODE_NextPatch             FLAVOR_PATCH
@@ -239,9 +239,18 @@
     FLAG_LEFT_BIT(12)
 
 
-//=//// SERIES_FLAG_13 ////////////////////////////////////////////////////=//
+//=//// SERIES_FLAG_GC_REMARK /////////////////////////////////////////////=//
 //
-#define SERIES_FLAG_13 \
+// While an incremental mark phase is running (see GC_Marking), a series that
+// was already marked and then gets written to--or which becomes managed--is
+// put on the GC_Remarks list to be scanned again before the sweep.  This flag
+// says it is on that list, so a series that is written many times between
+// steps only gets listed once.
+//
+// The same list serves as the "remembered set" of RECYCLE/GENERATIONAL, for
+// old series that were written to (or made) since the last collection.
+//
+#define SERIES_FLAG_GC_REMARK \
     FLAG_LEFT_BIT(13)
 
 
@@ -260,9 +269,15 @@
     FLAG_LEFT_BIT(14)
 
 
-//=//// SERIES_FLAG_15 ////////////////////////////////////////////////////=//
+//=//// SERIES_FLAG_GC_YOUNG //////////////////////////////////////////////=//
+//
+// When RECYCLE/GENERATIONAL is in effect, managed arrays, strings and binaries
+// are put on the GC_Nursery list as they are made, and get this flag.  A minor
+// collection only marks and sweeps these "young" series--so any that survive
+// it are "promoted" by clearing the flag.  (A major collection promotes the
+// whole nursery.)
 //
-#define SERIES_FLAG_15 \
+#define SERIES_FLAG_GC_YOUNG \
     FLAG_LEFT_BIT(15)
 
 
@@ -326,6 +341,19 @@ inline static REBYTE FLAVOR_BYTE(uintptr_t flags)
 #define SERIES_FLAG_31 FLAG_LEFT_BIT(31)
 
 
+//=//// SERIES_FLAG_SHARED_HEAP ///////////////////////////////////////////=//
+//
+// A plain array, string, or binary made by SHARE, in memory that belongs to
+// no interpreter (see %m-shared.c).  It is permanently NODE_FLAG_MARKED and
+// frozen, and nothing may write to it--not even caches like bookmarks.
+//
+// (This bit is a subclass flag for varlists and actions, which are never
+// shared.  So check the flavor first if it could be one, see Is_Value_Shared)
+//
+#define SERIES_FLAG_SHARED_HEAP \
+    SERIES_FLAG_29
+
+
 //=////////////////////////////////////////////////////////////////////////=//
 //
 // SERIES <<INFO>> BITS
@@ -356,9 +384,15 @@ inline static REBYTE FLAVOR_BYTE(uintptr_t flags)
 STATIC_ASSERT(SERIES_INFO_0_IS_FALSE == NODE_FLAG_NODE);
 
 
-//=//// SERIES_INFO_1 /////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_SHARED ////////////////////////////////////////////////=//
+//
+// COPY of a big BINARY! doesn't copy the bytes, but points the new series at
+// the same data allocation (see Copy_Binary_Shared_At_Len()).  All series
+// sharing the data carry this bit and are linked in a ring by LINK(Sharer).
+// The first write or resize through any one of them calls Unshare_Series(),
+// which gives that series its own copy of the data.
 //
-#define SERIES_INFO_1 \
+#define SERIES_INFO_SHARED \
     FLAG_LEFT_BIT(1)
 
 
@@ -723,6 +757,13 @@ union Reb_Series_Misc {
     //
     int quoting_delta;
 
+    // The hashlist of a MAP! counts the zombie records in its pairlist, and
+    // one that is being migrated away from counts the records left to move.
+    // (See %sys-map.h)
+    //
+    REBLEN zombies;
+    REBLEN unmigrated;
+
     // If a REBNOD* is stored in the misc field, it has to use this union
     // member for SERIES_INFO_MISC_NODE_NEEDS_MARK to see it.  To help make
     // the reference sites be unique for each purpose and still be type safe,
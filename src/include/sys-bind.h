@@ -111,6 +111,12 @@ inline static bool Is_Overriding_Context(REBCTX *stored, REBCTX *override)
     if (Is_Node_Cell(temp))
         return false;
 
+    // Unrelated objects share a shape keylist, so it's no sign of derivation.
+    // (Objects that are derived from don't have one, see KEYLIST_FLAG_SHAPE)
+    //
+    if (GET_SUBCLASS_FLAG(KEYLIST, SER(stored_source), SHAPE))
+        return false;
+
     while (true) {
         if (temp == stored_source)
             return true;
@@ -268,7 +274,8 @@ enum {
     COLLECT_ONLY_SET_WORDS = 0,
     COLLECT_ANY_WORD = 1 << 1,
     COLLECT_DEEP = 1 << 2,
-    COLLECT_NO_DUP = 1 << 3  // Do not allow dups during collection (for specs)
+    COLLECT_NO_DUP = 1 << 3,  // Do not allow dups during collection (for specs)
+    COLLECT_SHARE_SHAPE = 1 << 4  // Reuse a same-keyed keylist if one is known
 };
 
 struct Reb_Collector {
@@ -321,6 +328,7 @@ inline static void INIT_BINDING_MAY_MANAGE(
     UNUSED(f);
 
     m_cast(REBSER*, binding)->leader.bits |= NODE_FLAG_MANAGED;  // GC sees...
+    Mark_If_Unswept(m_cast(REBSER*, binding));
 }
 
 
@@ -411,7 +419,10 @@ inline static REBCTX *VAL_WORD_CONTEXT(const REBVAL *v) {
         FRM(LINK(KeySource, binding))->key
             == FRM(LINK(KeySource, binding))->key_tail  // not fulfilling
     );
-    binding->leader.bits |= NODE_FLAG_MANAGED;  // !!! review managing needs
+    if (NOT_SERIES_FLAG(binding, MANAGED)) {
+        binding->leader.bits |= NODE_FLAG_MANAGED;  // !!! review managing needs
+        Mark_If_Unswept(binding);
+    }
     REBCTX *c = CTX(binding);
     FAIL_IF_INACCESSIBLE_CTX(c);
     return c;
@@ -462,10 +473,14 @@ inline static REBCTX *VAL_WORD_CONTEXT(const REBVAL *v) {
 // failure mode while it's running...even if the context is inaccessible or
 // the word is unbound.  Errors should be raised by callers if applicable.
 //
-inline static option(REBARR*) Get_Word_Container(
+// (Get_Word_Container() puts a cache in front of this, so `cacheable` is
+// set to false if the answer can't be trusted to stay the same.)
+//
+inline static option(REBARR*) Get_Word_Container_Core(
     REBLEN *index_out,
     const RELVAL* any_word,
-    REBSPC *specifier
+    REBSPC *specifier,
+    bool *cacheable
 ){
   #if !defined(NDEBUG)
     *index_out = 0xDECAFBAD;  // trash index to make sure it gets set
@@ -484,10 +499,12 @@ inline static option(REBARR*) Get_Word_Container(
     // and then save the hit or miss information in the word for next use.
     //
     const REBSTR *spelling = VAL_WORD_SYMBOL(VAL_UNESCAPED(any_word));
+    uintptr_t spelling_bit = PATCH_FILTER_BIT(spelling);
 
     // !!! Virtual binding could use the bind table as a kind of next
     // level cache if it encounters a large enough object to make it
-    // wortwhile?
+    // wortwhile?  For now, each object patch has a filter of its keys, so
+    // patches a word can't be in are passed over without a search.
     //
     do {
         if (GET_SUBCLASS_FLAG(PATCH, specifier, LET)) {
@@ -515,9 +532,15 @@ inline static option(REBARR*) Get_Word_Container(
             goto skip_miss_patch;
         }
 
+        if (not (LINK_PATCH_FILTER(specifier) & spelling_bit))
+            goto skip_miss_patch;  // definitely not in this patch's keys
+
       blockscope {
         REBCTX *overload = CTX(overbind);
 
+        if (CTX_TYPE(overload) == REB_FRAME)
+            *cacheable = false;  // keys depend on the phase
+
         // Length at time of virtual bind is cached by index.  This avoids
         // allowing untrustworthy cache states.
         //
@@ -535,8 +558,10 @@ inline static option(REBARR*) Get_Word_Container(
             // general questions of hiding which is the same bit.  Don't
             // count it as a hit.
             //
-            if (GET_CELL_FLAG(CTX_VAR(overload, index), BIND_NOTE_REUSE))
+            if (GET_CELL_FLAG(CTX_VAR(overload, index), BIND_NOTE_REUSE)) {
+                *cacheable = false;
                 break;
+            }
 
             // Found a match!  Cache it to speed up next time.  Note that
             // since specifier chains change frames for relativization,
@@ -646,6 +671,90 @@ inline static option(REBARR*) Get_Word_Container(
   }
 }
 
+
+//=//// WORD LOOKUP CACHE /////////////////////////////////////////////////=//
+//
+// Get_Word_Container_Core() only has real work to do when the specifier is
+// a virtual binding patch: each patch in the chain means a linear search of
+// its context's keys.  That answer depends just on the specifier and the
+// word's symbol, kind, binding and index (patches don't change once made).
+// So it is kept in a small direct-mapped cache, indexed by the address of
+// the word cell--which acts as an inline cache for each position in an array
+// that is run over and over, like the body of a loop.
+//
+// Entries are only good for the TG_Word_Cache_Generation they were made in.
+// This is bumped when what a lookup could see might change shape: by the GC
+// (a freed patch or context could have its node reused) and when a context
+// gets new keys in Append_Context().
+//
+#define WORD_CACHE_SIZE 1024  // must be a power of 2
+
+struct Reb_Word_Cache_Entry {
+    REBSPC *specifier;  // nullptr if the entry is unused
+    const REBSYM *symbol;
+    REBARR *binding;
+    REBLEN word_index;  // VAL_WORD_INDEX() of the word looked up
+    REBLEN generation;
+    REBARR *container;  // answer, nullptr if the word was unbound
+    REBLEN index;
+    REBYTE kind;
+};
+
+inline static option(REBARR*) Get_Word_Container(
+    REBLEN *index_out,
+    const RELVAL* any_word,
+    REBSPC *specifier
+){
+    if (specifier == SPECIFIED or not IS_PATCH(specifier))
+        return Get_Word_Container_Core(index_out, any_word, specifier, nullptr);
+
+    REBCEL(const*) word = VAL_UNESCAPED(any_word);
+
+    struct Reb_Word_Cache_Entry *entry = &TG_Word_Cache[
+        (cast(uintptr_t, any_word) / sizeof(RELVAL)) & (WORD_CACHE_SIZE - 1)
+    ];
+
+    if (
+        entry->specifier == specifier
+        and entry->generation == TG_Word_Cache_Generation
+        and entry->symbol == VAL_WORD_SYMBOL(word)
+        and entry->binding == VAL_WORD_BINDING(any_word)
+        and entry->word_index == VAL_WORD_PRIMARY_INDEX_UNCHECKED(any_word)
+        and entry->kind == CELL_KIND(word)
+    ){
+      #if !defined(NDEBUG)
+        REBLEN check_index;
+        bool check_cacheable = true;
+        REBARR *check = try_unwrap(Get_Word_Container_Core(
+            &check_index, any_word, specifier, &check_cacheable
+        ));
+        assert(check == entry->container);
+        assert(check == nullptr or check_index == entry->index);
+      #endif
+
+        *index_out = entry->index;
+        return entry->container;
+    }
+
+    bool cacheable = true;
+    REBARR *container = try_unwrap(Get_Word_Container_Core(
+        index_out, any_word, specifier, &cacheable
+    ));
+
+    if (cacheable) {
+        entry->specifier = specifier;
+        entry->symbol = VAL_WORD_SYMBOL(word);
+        entry->binding = VAL_WORD_BINDING(any_word);
+        entry->word_index = VAL_WORD_PRIMARY_INDEX_UNCHECKED(any_word);
+        entry->generation = TG_Word_Cache_Generation;
+        entry->container = container;
+        entry->index = container ? *index_out : 0;
+        entry->kind = CELL_KIND(word);
+    }
+
+    return container;
+}
+
 static inline const REBVAL *Lookup_Word_May_Fail(
     const RELVAL *any_word,
     REBSPC *specifier
@@ -705,8 +814,10 @@ static inline REBVAL *Lookup_Mutable_Word_May_Fail(
         fail (Error_Not_Bound_Raw(SPECIFIC(any_word)));
 
     REBVAL *var;
-    if (IS_PATCH(a))
+    if (IS_PATCH(a)) {
+        GC_Write_Barrier(a);  // varlists get this from FAIL_IF_READ_ONLY_SER()
         var = SPECIFIC(ARR_SINGLE(a));
+    }
     else {
         REBCTX *c = CTX(a);
 
@@ -99,6 +99,8 @@
 #include <math.h>
 #include <stddef.h> // for offsetof()
 
+#include "sys-probes.h"  // USDT_PROBEn() for perf/bpftrace, may be no-ops
+
 
 //
 // DISABLE STDIO.H IN RELEASE BUILD
@@ -239,6 +241,7 @@ typedef struct rebol_stats {
     REBLEN  Series_Made;
     REBLEN  Series_Freed;
     REBLEN  Series_Expanded;
+    REBI64  Series_Expand_Copied;  // bytes copied to new data by expansions
     REBLEN  Recycle_Counter;
     REBLEN  Recycle_Series_Total;
     REBLEN  Recycle_Series;
@@ -278,6 +281,22 @@ enum Boot_Levels {
     BOOT_LEVEL_FULL
 };
 
+// Startup_Core() notes how long each of these stages took, for STATS/STARTUP
+// (keep in sync with the names in the STATS native)
+//
+enum Startup_Stages {
+    STARTUP_POOLS,  // memory pools and the GC
+    STARTUP_SYMBOLS,  // builtin symbols, stacks, API, root values
+    STARTUP_DECOMPRESS,  // gunzip of the boot block (unless uncompressed)
+    STARTUP_SCAN,  // transcode of the boot block
+    STARTUP_NATIVES,  // boot words, datatypes, natives, errors, system object
+    STARTUP_BASE,  // %base-xxx.r files
+    STARTUP_SYS,  // %sys-xxx.r files
+    STARTUP_MEZZ,  // %mezz-xxx.r files
+    STARTUP_EXTENSIONS,  // total time in LOAD-EXTENSION (not in Startup_Core)
+    STARTUP_MAX
+};
+
 // Modes allowed by Make_Function:
 enum {
     MKF_RETURN      = 1 << 0,   // give a RETURN (but local RETURN: overrides)
@@ -311,9 +330,10 @@ enum {
     ((REBLEN)(-1))
 
 
-typedef int cmp_t(void *, const void *, const void *);
 extern void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
 
+#define MAX_SORT_THREADS 64  // for SORT/THREADS, see Sort_Parallel()
+
 
 
 #include "tmp-constants.h"
@@ -348,10 +368,31 @@ extern void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
 // out.  And so this separation really just caused problems when two different
 // threads wanted to work with the same data (at different times).  Such a
 // feature is better implemented as in the V8 JavaScript engine as "isolates"
+//
+// USE_THREAD_ISOLATES (from %systems.r) is a step in that direction: every
+// PVAR and TVAR becomes thread-local, as do the file-level statics in the
+// core that hold interpreter state (marked ISOLATE_LOCAL).  So each thread
+// that calls rebStartup() gets an interpreter of its own, sharing nothing
+// with interpreters on other threads, and they can all run at once.
+//
+// !!! An isolate can't move to another thread, and values must not be
+// passed between isolates.  Extensions that keep interpreter state in
+// statics of their own (e.g. the timers of the Event extension) are not
+// isolate-safe yet.  Features whose worker threads read interpreter state
+// would see empty thread-locals on those threads, so they are turned off.
+//
+#if defined(USE_THREAD_ISOLATES)
+    #define ISOLATE_LOCAL THREAD_LOCAL
+
+    #undef USE_PARALLEL_MARKING  // mark threads read the GC's globals
+    #undef USE_PARALLEL_SORT  // comparisons read e.g. the case tables
+#else
+    #define ISOLATE_LOCAL
+#endif
 
 #ifdef __cplusplus
-    #define PVAR extern "C" RL_API
-    #define TVAR extern "C" RL_API
+    #define PVAR extern "C" RL_API ISOLATE_LOCAL
+    #define TVAR extern "C" RL_API ISOLATE_LOCAL
 #else
     // When being preprocessed by TCC and combined with the user - native
     // code, all global variables need to be declared
@@ -360,10 +401,10 @@ extern void reb_qsort_r(void *a, size_t n, size_t es, void *thunk, cmp_t *cmp);
     // PVAR and TVAR allow for overriding at the compiler command line.
     //
     #if !defined(PVAR)
-        #define PVAR extern RL_API
+        #define PVAR extern ISOLATE_LOCAL RL_API
     #endif
     #if !defined(TVAR)
-        #define TVAR extern RL_API
+        #define TVAR extern ISOLATE_LOCAL RL_API
     #endif
 #endif
 
@@ -422,7 +463,13 @@ enum rebol_signals {
 
     // SIG_EVENT_PORT is to-be-documented
     //
-    SIG_EVENT_PORT = 1 << 3
+    SIG_EVENT_PORT = 1 << 3,
+
+    // SIG_STEP is left set while a debugger is single-stepping, so that the
+    // evaluator calls Do_Signals_Throws() on every step and it can run the
+    // PG_Step_Hook.  When not stepping, the evaluator pays nothing for this.
+    //
+    SIG_STEP = 1 << 4
 };
 
 inline static void SET_SIGNAL(REBFLGS f) { // used in %sys-series.h
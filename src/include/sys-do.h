@@ -42,6 +42,18 @@
 //
 
 
+// Count down toward the next Do_Signals_Throws().  The evaluator normally
+// does this at the start of each step.  Builds with SIGNALS_AT_CALLS do it
+// here instead, once per action dispatch and once per array evaluated.
+//
+inline static bool Poll_Signals_Throws(REBVAL *out) {
+    assert(Eval_Count >= 0);
+    if (--Eval_Count != 0)
+        return false;
+    return Do_Signals_Throws(out);
+}
+
+
 // This helper routine is able to take an arbitrary input cell to start with
 // that may not be END.  It is code that DO shares with GROUP! evaluation
 // in Eval_Core()--where being able to know if a group "completely vaporized"
@@ -56,6 +68,14 @@ inline static bool Do_Feed_To_End_Maybe_Stale_Throws(
 
     bool threw;
     Push_Frame(out, f);
+
+  #if defined(SIGNALS_AT_CALLS)
+    if (Poll_Signals_Throws(out)) {
+        Drop_Frame(f);  // same as a throw partway through the feed
+        return true;
+    }
+  #endif
+
     do {
         threw = Eval_Maybe_Stale_Throws(f);
     } while (not threw and NOT_END(feed->value));
@@ -184,10 +184,7 @@ inline static bool Did_Init_Inert_Optimize_Complete(
 
             CLEAR_FEED_FLAG(feed, NO_LOOKAHEAD);
 
-            // !!! Cache this test?
-            //
-            const REBPAR *first = First_Unspecialized_Param(nullptr, action);
-            if (VAL_PARAM_CLASS(first) == REB_P_SOFT)
+            if (GET_ACTION_FLAG(action, SOFT_QUOTES_FIRST))
                 return true;  // don't look back, yield the lookahead
 
             *flags |=
@@ -629,8 +629,13 @@ inline static void Prep_Array_Feed(
     // their time to run comes up to not be END anymore.  But if we put a
     // hold on conservatively, it won't be dropped by Free_Feed() time.
     //
-    if (IS_END(feed->value) or GET_SERIES_INFO(array, HOLD))
-        NOOP;  // already temp-locked
+    if (
+        IS_END(feed->value)
+        or GET_SERIES_INFO(array, HOLD)
+        or GET_SERIES_INFO(array, FROZEN_DEEP)  // e.g. shared, see SHARE
+    ){
+        NOOP;  // already temp-locked (or can't change anyway)
+    }
     else {
         SET_SERIES_INFO(m_cast(REBARR*, array), HOLD);
         SET_FEED_FLAG(feed, TOOK_HOLD);
@@ -24,6 +24,7 @@
 //-- Bootstrap variables:
 PVAR REBINT PG_Boot_Phase;  // To know how far in the boot we are.
 PVAR REBINT PG_Boot_Level;  // User specified startup level
+PVAR REBI64 PG_Startup_Nanoseconds[STARTUP_MAX];  // See Startup_Stages
 
 #if defined(DEBUG_COLLECT_STATS)
     PVAR REB_STATS *PG_Reb_Stats;  // Various statistics about memory, etc.
@@ -32,6 +33,8 @@ PVAR REBINT PG_Boot_Level;  // User specified startup level
 PVAR REBU64 PG_Mem_Usage;   // Overall memory used
 PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
 
+PVAR uint64_t PG_Hash_Seed;  // random per process, see Hash_Bytes()
+
 // In Ren-C, words are REBSER nodes (REBSTR subtype).  They may be GC'd (unless
 // they are in the %words.r list, in which case their canon forms are
 // protected in order to do SYM_XXX switch statements in the C source, etc.)
@@ -61,6 +64,7 @@ PVAR REBVAL *User_Context;
 PVAR REBYTE *White_Chars;
 PVAR REBUNI *Upper_Cases;
 PVAR REBUNI *Lower_Cases;
+PVAR bool Ascii_Unicode_Folds[128];  // if some non-ASCII char LO_CASE()s to it
 
 // Other:
 PVAR REBYTE *PG_Pool_Map;   // Memory pool size map (created on boot)
@@ -79,6 +83,8 @@ PVAR REB_OPTS *Reb_Opts;
     PVAR bool PG_Always_Malloc;   // For memory-related troubleshooting
 #endif
 
+PVAR enum Reb_Mem_Map_Mode PG_Mem_Map;  // big blocks from mmap() (R3_HUGE_PAGES)
+
 // These are some canon BLANK, TRUE, and FALSE values (and nulled/end cells).
 
 PVAR REBVAL PG_End_Cell;
@@ -139,6 +145,8 @@ PVAR REBARR *PG_Extension_Types;  // array of datatypes created by extensions
 PVAR REBFLGS Eval_Signals;   // Signal flags
 
 PVAR REBDEV *PG_Device_List;  // Linked list of R3-Alpha-style "devices"
+PVAR WATCH_CFUNC PG_Watch_Hook;  // readiness backend, see OS_Watch_Request()
+PVAR STEP_HOOK *PG_Step_Hook;  // debugger's per-step hook, see SIG_STEP
 
 
 /***********************************************************************
@@ -166,11 +174,29 @@ TVAR REBI64 TG_Max_Ballast;
 
 //-- Memory and GC:
 TVAR REBPOL *Mem_Pools;     // Memory pool array
+TVAR REBPCH *TG_Pool_Caches;  // Unit caches in front of each pool
 TVAR bool GC_Recycling;    // True when the GC is in a recycle
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
+TVAR REBI64 GC_Bytes_Allocated;  // Total taken from GC_Ballast (never reset)
 TVAR bool GC_Disabled;      // true when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+TVAR REBLEN GC_Step_Budget;  // Cells marked per incremental step (0 = off)
+TVAR bool GC_Marking;  // An incremental mark phase is spread over evaluation
+TVAR REBLEN GC_Mark_Threads;  // Threads propagating marks in full collections
+TVAR bool GC_Lazy_Sweep;  // Sweep the SER_POOL as nodes are needed
+TVAR bool GC_Sweeping;  // A lazy sweep of the SER_POOL is underway
+PVAR REBSER *GC_Remarks;  // Series to rescan (GC_Marking or remembered set)
+TVAR bool GC_Generational;  // Minor collections of GC_Nursery are enabled
+PVAR REBSER *GC_Nursery;  // Young series made since the last collection
+TVAR REBU64 GC_Minor_Count;  // Collections of only the nursery
+TVAR REBU64 GC_Major_Count;  // Collections of the whole heap
+TVAR REBI64 GC_Minor_Nanoseconds;  // Total time spent in minor collections
+TVAR REBI64 GC_Major_Nanoseconds;  // Total time spent in major collections
+TVAR enum Reb_GC_Trigger GC_Trigger;  // Why the next collection is run
+TVAR struct Reb_GC_Pause *GC_Pause_Log;  // Ring buffer of GC_PAUSE_LOG_SIZE
+TVAR REBU64 GC_Pauses_Logged;  // Total entries ever put in GC_Pause_Log
+TVAR REBLEN GC_Adaptive_Percent;  // Ballast as percent of live heap (0 = off)
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 #if !defined(NDEBUG)  // Used by the FUZZ native to inject memory failures
@@ -179,6 +205,11 @@ TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
 
+TVAR const REBARR **TG_Indexed_Arrays;  // Keys of FIND hash indexes (t-block.c)
+TVAR REBLEN **TG_Array_Indexes;  // ...and the indexes, in the same slots
+TVAR REBLEN TG_Array_Index_Capacity;  // Power of 2 (or 0 if not allocated)
+TVAR REBLEN TG_Num_Array_Indexes;
+
 TVAR REBBIN *TG_Byte_Buf; // temporary byte buffer used mainly by raw print
 TVAR REBSTR *TG_Mold_Buf; // temporary UTF8 buffer - used mainly by mold
 
@@ -213,8 +244,40 @@ TVAR REBFED *TG_End_Feed;
 // can be reused by the next Push_Frame().  Reusing this has a significant
 // performance impact, as opposed to paying for freeing the memory when a
 // frame is dropped and then reallocating it when the next one is pushed.
+// (The lists are grouped by capacity, see VARLIST_REUSE_BUCKETS.)
 //
-TVAR REBARR *TG_Reuse;
+TVAR REBARR *TG_Reuse[VARLIST_REUSE_BUCKETS];
+TVAR REBLEN TG_Reuse_Count[VARLIST_REUSE_BUCKETS];
+
+TVAR struct Reb_Word_Cache_Entry *TG_Word_Cache;  // see %sys-bind.h
+TVAR REBLEN TG_Word_Cache_Generation;  // bumped to invalidate TG_Word_Cache
+
+TVAR struct Reb_Hash_Cache_Entry *TG_Hash_Cache;  // see %s-crc.c
+TVAR REBLEN TG_Hash_Cache_Generation;  // bumped by GC to invalidate entries
+
+TVAR REBU64 TG_Map_Migrations;  // MAP! hashlist growths, see %t-map.c
+TVAR REBU64 TG_Map_Records_Migrated;  // moved over a few per operation
+TVAR REBU64 TG_Map_Compactions;  // growths that squeezed out zombies instead
+TVAR REBU64 TG_Map_Zombies_Removed;
+
+TVAR struct Reb_Parse_Program *TG_Parse_Programs;  // see %u-parse.c
+TVAR struct Reb_Parse_Memo *TG_Parse_Memo;  // for PARSE/MEMO, or nullptr
+TVAR REBLEN TG_Parse_Memo_Size;  // capacity of TG_Parse_Memo
+TVAR REBLEN TG_Parse_Memo_Count;  // entries from the current serial
+TVAR REBLEN TG_Parse_Memo_Serial;  // bumped to forget all memos
+TVAR REBU64 TG_Parse_Memo_Hits;
+TVAR REBU64 TG_Parse_Memo_Misses;
+
+TVAR struct Reb_Set_Slot *TG_Set_Slots;  // table for UNIQUE etc, %n-sets.c
+TVAR REBLEN TG_Set_Slots_Capacity;
+
+TVAR REBSER **TG_Keylist_Shapes;  // keylists to share, see %c-context.c
+TVAR struct Reb_Spec_Keylist_Entry *TG_Spec_Keylists;  // see %c-context.c
+
+TVAR struct Reb_Pooled_String *TG_Pooled_Strings;  // see %s-pool.c
+TVAR REBLEN TG_Pooled_String_Capacity;
+TVAR REBLEN TG_Num_Pooled_Strings;
+TVAR struct Reb_Field_Cache_Entry *TG_Field_Cache;  // see %c-context.c
 
 //-- Evaluation stack:
 TVAR REBARR *DS_Array;
@@ -233,7 +296,12 @@ TVAR REBI64 Eval_Cycles;    // Total evaluation counter (upward)
 TVAR REBI64 Eval_Limit;     // Evaluation limit (set by secure)
 TVAR int_fast32_t Eval_Count;     // Evaluation counter (downward)
 TVAR uint_fast32_t Eval_Dose;      // Evaluation counter reset value
+TVAR REBI64 Eval_Dose_Start;       // Clock when Eval_Count was last reset
 TVAR REBFLGS Eval_Sigmask;   // Masking out signal flags
+TVAR bool TG_Profiling;  // PROFILER is sampling, see Sample_Frame_Stack()
+TVAR bool TG_Call_Profiling;  // PROFILER/CALLS, see Profile_Action_Begin()
+TVAR REBI64 TG_Alloc_Sample_Countdown;  // PROFILER/MEMORY, bytes to sample
+TVAR bool TG_Alloc_Samples_Live;  // see Forget_Allocation_Sample()
 
 TVAR REBFLGS Trace_Flags;    // Trace flag
 TVAR REBINT Trace_Level;    // Trace depth desired
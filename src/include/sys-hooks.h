@@ -120,6 +120,19 @@ typedef REB_R (PATH_HOOK)(
 typedef REB_R (PORT_HOOK)(REBFRM *frame_, REBVAL *port, const REBVAL *verb);
 
 
+// A debugger that is single-stepping installs this to run on each evaluator
+// step, see SIG_STEP.  It returns true if it threw.
+//
+typedef bool (STEP_HOOK)(REBVAL *out);
+
+
+// Comparison callback for reb_qsort_r() and Sort_Unstable()/Sort_Stable().
+// The "thunk" is passed through from the caller, and the result is negative,
+// zero or positive for the first item being less, equal, or greater.
+//
+typedef int cmp_t(void *, const void *, const void *);
+
+
 //=//// PARAMETER ENUMERATION /////////////////////////////////////////////=//
 //
 // Parameter lists of composed/derived functions still must have compatible
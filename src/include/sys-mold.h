@@ -34,6 +34,7 @@ struct rebol_mold {
     REBYTE period;      // for decimal point
     REBYTE dash;        // for date fields
     REBYTE digits;      // decimal digits
+    const REBVAL *sink;  // PORT! or ACTION! to flush output to, see Flush_Mold()
 };
 
 #define Drop_Mold_If_Pushed(mo) \
@@ -93,6 +94,7 @@ enum REB_Mold_Opts {
     mold_struct.series = NULL; /* used to tell if pushed or not */ \
     mold_struct.opts = 0; \
     mold_struct.indent = 0; \
+    mold_struct.sink = NULL; \
     REB_MOLD *name = &mold_struct; \
 
 #define SET_MOLD_FLAG(mo,f) \
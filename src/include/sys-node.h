@@ -121,9 +121,14 @@
 //
 inline static void *Try_Alloc_Node(REBLEN pool_id)
 {
-    REBPOL *pool = &Mem_Pools[pool_id];
-    if (not pool->first) {  // pool has run out of nodes
-        if (not Try_Fill_Pool(pool))  // attempt to refill it
+    ASSERT_POOL_THREAD();
+
+    REBPCH *cache = &TG_Pool_Caches[pool_id];
+    if (cache->first)
+        ++cache->hits;
+    else {  // cache has run out of units
+        ++cache->misses;
+        if (not Try_Refill_Pool_Cache(pool_id))  // take a batch from the pool
             return nullptr;
     }
 
@@ -141,15 +146,12 @@ inline static void *Try_Alloc_Node(REBLEN pool_id)
     }
   #endif
 
-    assert(pool->first);
-
-    REBPLU *unit = pool->first;
+    assert(cache->first);
 
-    pool->first = unit->next_if_free;
-    if (unit == pool->last)
-        pool->last = nullptr;
+    REBPLU *unit = cache->first;
 
-    pool->free--;
+    cache->first = unit->next_if_free;
+    --cache->count;
 
   #ifdef DEBUG_MEMORY_ALIGN
     if (cast(uintptr_t, unit) % sizeof(REBI64) != 0) {
@@ -158,9 +160,9 @@ inline static void *Try_Alloc_Node(REBLEN pool_id)
             cast(void*, unit),
             cast(int, sizeof(REBI64))
         );
-        printf("Pool Unit address is %p and pool-first is %p\n",
-            cast(void*, pool),
-            cast(void*, pool->first)
+        printf("Pool Unit address is %p and cache-first is %p\n",
+            cast(void*, unit),
+            cast(void*, cache->first)
         );
         panic (unit);
     }
@@ -186,6 +188,8 @@ inline static void *Alloc_Node(REBLEN pool_id) {
 //
 inline static void Free_Node(REBLEN pool_id, REBNOD* node)
 {
+    ASSERT_POOL_THREAD();
+
   #ifdef DEBUG_MONITOR_SERIES
     if (
         pool_id == SER_POOL
@@ -205,12 +209,18 @@ inline static void Free_Node(REBLEN pool_id, REBNOD* node)
 
     mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
 
-    REBPOL *pool = &Mem_Pools[pool_id];
+    if (GC_Sweeping and pool_id == SER_POOL and Is_Node_Unswept(node))
+        return;  // lazy sweep will list it when it gets to the segment
 
   #ifdef NDEBUG
-    unit->next_if_free = pool->first;
-    pool->first = unit;
+    REBPCH *cache = &TG_Pool_Caches[pool_id];
+    unit->next_if_free = cache->first;
+    cache->first = unit;
+    if (++cache->count > POOL_CACHE_MAX)
+        Drain_Pool_Cache(pool_id, POOL_CACHE_BATCH);
   #else
+    REBPOL *pool = &Mem_Pools[pool_id];
+
     // !!! In R3-Alpha, the most recently freed node would become the first
     // node to hand out.  This is a simple and likely good strategy for
     // cache usage, but makes the "poisoning" nearly useless.
@@ -220,20 +230,28 @@ inline static void Free_Node(REBLEN pool_id, REBNOD* node)
     // time of this area to catch stale pointers.  But doing this in the
     // debug build only creates a source of variant behavior.
 
-    bool out_of_memory = false;
+    // During a lazy sweep the SER_POOL's free list is empty until segments
+    // get swept, and the unit caches take whole batches off the other pools.
+    // Filling a segment just to have something to append to would then be
+    // done for most frees, so that's only done outside of a lazy sweep.
+    //
+    bool at_head = false;
 
     if (not pool->last) {  // Fill pool if empty
-        if (not Try_Fill_Pool(pool))
-            out_of_memory = true;
+        if (GC_Sweeping or not Try_Fill_Pool(pool))
+            at_head = true;
     }
 
-    if (out_of_memory) {
+    if (at_head) {
         //
         // We don't want Free_Node to fail with an "out of memory" error, so
-        // just fall back to the release build behavior in this case.
+        // just fall back to the release build behavior in this case.  (The
+        // `last` is kept valid, so the next free can append to it.)
         //
         unit->next_if_free = pool->first;
         pool->first = unit;
+        if (not pool->last)
+            pool->last = unit;
     }
     else {
         assert(pool->last);
@@ -242,9 +260,36 @@ inline static void Free_Node(REBLEN pool_id, REBNOD* node)
         pool->last = unit;
         unit->next_if_free = nullptr;
     }
-  #endif
 
     pool->free++;
+  #endif
+}
+
+
+// A node that becomes managed during a lazy sweep wasn't marked, since it was
+// manual when marking ran.  If its segment hasn't been swept yet, the sweep
+// would take it for garbage--so it is marked now, and the sweep will clear
+// the mark.  (See Start_Lazy_Sweep().)
+//
+inline static void Mark_If_Unswept(void *node) {
+    if (GC_Sweeping and Is_Node_Unswept(node))
+        *cast(REBYTE*, node) |= NODE_BYTEMASK_0x10_MARKED;
+}
+
+
+// Free units of a pool, including those parked in its unit cache.
+//
+inline static REBLEN Pool_Units_Free(REBLEN pool_id) {
+    return Mem_Pools[pool_id].free + TG_Pool_Caches[pool_id].count;
+}
+
+
+// Blocks this big come from Try_Map_Mem() instead of Try_Alloc_Mem() when
+// the page-mapped allocator is on.  The mode is fixed at Startup_Pools(), so
+// the same answer comes back when the block is freed (see %mem-pools.h)
+//
+inline static bool Is_Mem_Mapped(size_t size) {
+    return PG_Mem_Map != MEM_MAP_NONE and size >= MEM_MAP_THRESHOLD;
 }
 
 
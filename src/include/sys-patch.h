@@ -159,6 +159,7 @@ inline static REBARR *Make_Patch_Core(
                 NextPatch(variant) == next
                 and BINDING(ARR_SINGLE(variant)) == binding and
                 VAL_WORD_PRIMARY_INDEX_UNCHECKED(ARR_SINGLE(variant)) == limit
+                and not Is_Series_Doomed(variant)  // list is weak, see GC
             ){
                 // The reused flag isn't initially set, but becomes set on
                 // the first reuse (and hence every reuse after).  This is
@@ -198,9 +199,8 @@ inline static REBARR *Make_Patch_Core(
     //
     REBARR *patch = Alloc_Singular(
         //
-        // LINK is not used yet (likely application: symbol for patches that
-        // represent lets).  Consider uses in patches that represent objects.
-        // So no SERIES_FLAG_LINK_NODE_NEEDS_MARK yet.
+        // LINK is the filter of the patch's keys (not a node, so there is
+        // no SERIES_FLAG_LINK_NODE_NEEDS_MARK).
         //
         // MISC is a node, but it's used for linking patches to variants
         // with different chains underneath them...and shouldn't keep that
@@ -244,10 +244,24 @@ inline static REBARR *Make_Patch_Core(
     if (IS_VARLIST(binding))
         mutable_BONUS(Patches, binding) = patch;
 
-    // The LINK field is only used in LET patches for the symbol, so no
-    // purpose found for the non-LET patches yet.
+    // The LINK field is used in LET patches for the symbol, so here it can
+    // hold the filter of which keys the patch might have.
     //
-    mutable_LINK(PatchSymbol, patch) = nullptr;
+    if (
+        not IS_VARLIST(binding)
+        or limit > PATCH_FILTER_MAX_KEYS
+        or CTX_TYPE(CTX(binding)) == REB_FRAME
+    ){
+        LINK_PATCH_FILTER(patch) = PATCH_FILTER_ALL;
+    }
+    else {
+        uintptr_t filter = 0;
+        const REBKEY *key = CTX_KEYS_HEAD(CTX(binding));
+        REBLEN n;
+        for (n = 1; n <= limit; ++key, ++n)
+            filter |= PATCH_FILTER_BIT(KEY_SYMBOL(key));
+        LINK_PATCH_FILTER(patch) = filter;
+    }
 
     return patch;
 }
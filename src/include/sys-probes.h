@@ -0,0 +1,77 @@
+//
+//  File: %sys-probes.h
+//  Summary: "Static tracepoints (USDT) for perf, bpftrace, and SystemTap"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A native profiler sampling the interpreter only sees C functions like the
+// evaluator and the dispatchers, not what Rebol code is doing.  With the
+// USE_SDT_PROBES definition (see %tools/systems.r) and the <sys/sdt.h>
+// header from SystemTap (`systemtap-sdt-dev` on Debian), "USDT" probes are
+// compiled in under the provider name `rebol`:
+//
+//     action__entry(frame, label)  before an action's dispatcher runs
+//     action__return(frame, label)  when the dispatcher returns
+//     fail__unwind(error)  when fail() unwinds (skipping action__return)
+//     gc__begin(minor, trigger)  when a collection starts
+//     gc__end(minor, swept, nanoseconds)  when a collection finishes
+//     series__expand(series, index, delta)  in Expand_Series()
+//     scan__begin(utf8, size) and scan__end(utf8, count)  around a scan
+//     device__begin(title, command)  before OS_Do_Device() runs a command
+//     device__end(title, command, result)  1 done, 0 pending, -1 error
+//
+// A probe is a single NOP in the instruction stream, plus a note in the ELF
+// file of where to find it and its arguments.  So they can be left in a
+// release build, and enabled by a tracer on the running process, e.g.:
+//
+//     perf buildid-cache --add ./r3
+//     perf probe -x ./r3 sdt_rebol:gc__end
+//     perf record -e sdt_rebol:gc__end -p <pid>
+//
+//     bpftrace -e 'usdt:./r3:rebol:action__entry { @[str(arg1)] = count(); }'
+//
+// Arguments are still computed when a probe isn't being traced, so those
+// given here are kept to things already at hand.  (The label of an action
+// is a pointer into its symbol's UTF-8, not a copy.)
+//
+// If the definition is missing or the header can't be found, the probes are
+// compiled out entirely.
+//
+
+#if defined(USE_SDT_PROBES) && defined(__has_include)
+  #if __has_include(<sys/sdt.h>)
+    #include <sys/sdt.h>
+    #define HAS_SDT_PROBES
+  #endif
+#endif
+
+#if defined(HAS_SDT_PROBES)
+    #define USDT_PROBE1(name,a) \
+        DTRACE_PROBE1(rebol, name, (a))
+    #define USDT_PROBE2(name,a,b) \
+        DTRACE_PROBE2(rebol, name, (a), (b))
+    #define USDT_PROBE3(name,a,b,c) \
+        DTRACE_PROBE3(rebol, name, (a), (b), (c))
+#else
+    #define USDT_PROBE1(name,a) \
+        NOOP
+    #define USDT_PROBE2(name,a,b) \
+        NOOP
+    #define USDT_PROBE3(name,a,b,c) \
+        NOOP
+#endif
@@ -322,7 +322,9 @@ typedef struct rebol_scan_level {  // each array scan corresponds to a level
 enum {
     SCAN_FLAG_NEXT = 1 << 0, // load/next feature
     SCAN_FLAG_NULLEDS_LEGAL = 1 << 2, // NULL splice in top level of rebValue()
-    SCAN_FLAG_LOCK_SCANNED = 1 << 3  // lock series as they are loaded
+    SCAN_FLAG_LOCK_SCANNED = 1 << 3,  // lock series as they are loaded
+    SCAN_FLAG_NO_FILE_LINE = 1 << 4,  // don't put file and line on arrays
+    SCAN_FLAG_DEDUP = 1 << 5  // freeze strings and share equal ones
 };
 
 
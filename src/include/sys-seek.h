@@ -0,0 +1,154 @@
+//
+//  File: %sys-seek.h
+//  Summary: "Vectorized search for the first of a set of bytes"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Text decoders (the scanner in %l-scan.c, JSON in %l-json.c) spend most of
+// their time on long runs of bytes that need no individual attention.  This
+// finds the end of such a run a vector at a time when SSE2, AVX2, or (64-bit)
+// NEON are available.  If none are, SCAN_SCALAR is defined, and the caller
+// has to use a byte-at-a-time loop instead.
+//
+// A caller writes a "stops" function, which builds a ScanVec mask of the
+// interesting bytes in a chunk out of SCAN_EQ(), SCAN_HIGH() etc. and turns
+// it into ScanBits with SCAN_BITS().  Seek_First_Stop() then gives back the
+// address of the first such byte at or after `cp`.  Seek_First_Stop_Or_Byte()
+// also stops at a byte that isn't known until runtime.
+//
+// The input must be NUL-terminated, and NUL must be in every stop set, so a
+// search never goes beyond the chunk holding the terminator.  Loads are done
+// on chunk-aligned addresses, hence they can't straddle a page boundary and
+// fault...though they do read some bytes before `cp` (masked out) and after
+// the terminator (never looked at).  Address sanitizer would complain about
+// the latter, so the vector routines are exempted from its instrumentation.
+//
+// SCAN_CTRL_OR_HIGH() is true for bytes below 0x20 or of 0x80 and up, which
+// is what a signed compare against space gives.
+//
+
+#if !defined(__GNUC__)  // uses __builtin_ctz() (clang defines __GNUC__ too)
+    #define SCAN_SCALAR
+#elif defined(__SANITIZE_ADDRESS__) && !__has_feature(address_sanitizer)
+    #define SCAN_SCALAR  // gcc ASAN, ATTRIBUTE_NO_SANITIZE_ADDRESS is a no-op
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+
+    #define SCAN_CHUNK 32
+    #define SCAN_BIT_WIDTH 1  // mask bits per byte
+    typedef __m256i ScanVec;
+    typedef uint32_t ScanBits;
+    #define SCAN_ALL_BITS 0xFFFFFFFFu
+
+    #define SCAN_LOAD(p)    _mm256_load_si256(cast(const __m256i*, (p)))
+    #define SCAN_EQ(v,c)    _mm256_cmpeq_epi8((v), _mm256_set1_epi8(c))
+    #define SCAN_HIGH(v)    _mm256_cmpgt_epi8(_mm256_setzero_si256(), (v))
+    #define SCAN_CTRL_OR_HIGH(v) \
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), (v))  // signed compare
+    #define SCAN_OR(a,b)    _mm256_or_si256((a), (b))
+    #define SCAN_BITS(v)    cast(ScanBits, _mm256_movemask_epi8(v))
+    #define SCAN_CTZ(bits)  __builtin_ctz(bits)
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+
+    #define SCAN_CHUNK 16
+    #define SCAN_BIT_WIDTH 1
+    typedef __m128i ScanVec;
+    typedef uint32_t ScanBits;  // only low 16 bits used
+    #define SCAN_ALL_BITS 0xFFFFu
+
+    #define SCAN_LOAD(p)    _mm_load_si128(cast(const __m128i*, (p)))
+    #define SCAN_EQ(v,c)    _mm_cmpeq_epi8((v), _mm_set1_epi8(c))
+    #define SCAN_HIGH(v)    _mm_cmplt_epi8((v), _mm_setzero_si128())
+    #define SCAN_CTRL_OR_HIGH(v) \
+        _mm_cmplt_epi8((v), _mm_set1_epi8(0x20))  // signed compare
+    #define SCAN_OR(a,b)    _mm_or_si128((a), (b))
+    #define SCAN_BITS(v)    cast(ScanBits, _mm_movemask_epi8(v))
+    #define SCAN_CTZ(bits)  __builtin_ctz(bits)
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+
+    // NEON has no "movemask", but narrowing each 16-bit lane of a compare
+    // result by 4 bits gives a 64-bit mask with a nibble per byte.
+    //
+    #define SCAN_CHUNK 16
+    #define SCAN_BIT_WIDTH 4
+    typedef uint8x16_t ScanVec;
+    typedef uint64_t ScanBits;
+    #define SCAN_ALL_BITS 0xFFFFFFFFFFFFFFFFull
+
+    #define SCAN_LOAD(p)    vld1q_u8(p)
+    #define SCAN_EQ(v,c)    vceqq_u8((v), vdupq_n_u8(c))
+    #define SCAN_HIGH(v)    vcgeq_u8((v), vdupq_n_u8(0x80))
+    #define SCAN_CTRL_OR_HIGH(v) \
+        vorrq_u8(vcltq_u8((v), vdupq_n_u8(0x20)), SCAN_HIGH(v))
+    #define SCAN_OR(a,b)    vorrq_u8((a), (b))
+    #define SCAN_BITS(v) \
+        vget_lane_u64(vreinterpret_u64_u8( \
+            vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0)
+    #define SCAN_CTZ(bits)  __builtin_ctzll(bits)
+#else
+    #define SCAN_SCALAR
+#endif
+
+
+#if !defined(SCAN_SCALAR)
+
+ATTRIBUTE_NO_SANITIZE_ADDRESS
+static inline const REBYTE *Seek_First_Stop(
+    const REBYTE *cp,
+    ScanBits (*stops)(ScanVec)
+){
+    REBLEN skew = cast(uintptr_t, cp) % SCAN_CHUNK;
+    const REBYTE *chunk = cp - skew;
+
+    ScanBits bits = stops(SCAN_LOAD(chunk))
+        & (SCAN_ALL_BITS << (skew * SCAN_BIT_WIDTH));  // ignore before `cp`
+
+    while (bits == 0) {
+        chunk += SCAN_CHUNK;
+        bits = stops(SCAN_LOAD(chunk));
+    }
+    return chunk + SCAN_CTZ(bits) / SCAN_BIT_WIDTH;
+}
+
+// Same, but with one more byte in the stop set that's only known at runtime
+// (e.g. the delimiter of a CSV file, which can be chosen by the caller).
+//
+ATTRIBUTE_NO_SANITIZE_ADDRESS
+static inline const REBYTE *Seek_First_Stop_Or_Byte(
+    const REBYTE *cp,
+    ScanBits (*stops)(ScanVec),
+    REBYTE b
+){
+    REBLEN skew = cast(uintptr_t, cp) % SCAN_CHUNK;
+    const REBYTE *chunk = cp - skew;
+
+    ScanVec v = SCAN_LOAD(chunk);
+    ScanBits bits = (stops(v) | SCAN_BITS(SCAN_EQ(v, b)))
+        & (SCAN_ALL_BITS << (skew * SCAN_BIT_WIDTH));
+
+    while (bits == 0) {
+        chunk += SCAN_CHUNK;
+        v = SCAN_LOAD(chunk);
+        bits = stops(v) | SCAN_BITS(SCAN_EQ(v, b));
+    }
+    return chunk + SCAN_CTZ(bits) / SCAN_BIT_WIDTH;
+}
+
+#endif
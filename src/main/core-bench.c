@@ -0,0 +1,320 @@
+//
+//  File: %core-bench.c
+//  Summary: "Microbenchmarks calling core routines directly from C"
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// This is the main() of the `r3-bench` executable (`make.r target=bench`).
+// It links the same core and extensions as `r3`, but instead of starting a
+// console it times the scanner, molding, map lookup, string search, garbage
+// collection, series expansion, and zlib on fixed inputs made up in C.  The
+// point is to measure low-level changes without the evaluator's overhead
+// mixed in, which %tests/benchmarks.reb can't avoid.
+//
+// Each operation is repeated (doubling the count) until a run takes at least
+// a quarter second.  Then what's reported is:
+//
+//     ns/op - wall clock nanoseconds per operation
+//     B/op - bytes allocated from the pools per operation (GC_Bytes_Allocated)
+//     MB/s - input processed per second, for operations that have an input
+//
+// Garbage collections that allocation triggers are run between operations
+// (as the evaluator would), so their cost is included in ns/op.
+//
+// Arguments on the command line limit what runs to the benchmarks whose
+// names contain one of them, e.g. `r3-bench scan mold`.
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sys-core.h"
+
+
+#define BENCH_MIN_NANOSECONDS 250000000  // quarter second per measurement
+
+typedef REBSIZ (*BENCHFUNC)(void);  // does one op, returns input bytes
+
+struct Reb_Bench {
+    const char *name;
+    BENCHFUNC op;
+};
+
+
+//=//// FIXED INPUTS //////////////////////////////////////////////////////=//
+//
+// These are made once up front.  The Rebol values are API handles, so they
+// are kept alive across the garbage collections until released at the end.
+//
+
+static REBYTE *source_utf8;  // LOAD-able text with a mix of datatypes
+static REBSIZ source_size;
+
+static REBVAL *loaded;  // BLOCK! of source_utf8, to be molded
+static REBVAL *map;  // MAP! of 1024 TEXT! keys
+static REBVAL *keys;  // BLOCK! of the keys of the map, to look up
+static REBVAL *haystack;  // TEXT! of lines, with the needle at the end
+static REBVAL *needle;
+static REBVAL *live;  // BLOCK! of nested blocks and strings, for the GC
+
+static REBYTE *plain;  // text for compression, as bytes
+static REBSIZ plain_size;
+static REBYTE *deflated;
+static REBSIZ deflated_size;
+
+
+static void Make_Inputs(void)
+{
+    REBSIZ capacity = 1 << 20;
+    source_utf8 = rebAllocN(REBYTE, capacity);
+    source_size = 0;
+
+    REBLEN i;
+    for (i = 0; source_size < capacity - 256; ++i)
+        source_size += snprintf(
+            s_cast(source_utf8 + source_size),
+            capacity - source_size,
+            "item-%u: [%u %u.%u \"text %u\" #issue-%u %u:%02u <tag> %%file-%u"
+                " a/path/(%u) 'quoted $%u.%02u 10x%u]\n",
+            i, i, i, i % 100, i, i, i % 24, i % 60, i, i, i, i % 100, i
+        );
+
+    loaded = rebValue("transcode", rebR(rebSizedText(
+        s_cast(source_utf8), source_size
+    )));
+
+    map = rebValue("make map! 1024");
+    keys = rebValue("copy []");
+    for (i = 0; i < 1024; ++i)
+        rebElide(
+            "let k: unspaced [{key-}", rebI(i), "{-}", rebI(i * 7919), "]",
+            "put", map, "k", rebI(i),
+            "append", keys, "k"
+        );
+
+    haystack = rebValue(
+        "let t: make text! 2000000",
+        "repeat 50000 [append t {2021-06-01 12:00:00 INFO request served^/}]",
+        "append t {2021-06-01 12:00:00 ERROR out of memory^/}"
+    );
+    needle = rebText("ERROR out of memory");
+
+    live = rebValue(
+        "let b: copy []",
+        "repeat 50000 [append/only b reduce [copy {live} 1 2 copy [a b]]]",
+        "b"
+    );
+
+    plain_size = source_size;
+    plain = source_utf8;
+    deflated = Compress_Alloc_Core(
+        &deflated_size, plain, plain_size, SYM_NONE
+    );
+}
+
+
+static void Free_Inputs(void)
+{
+    rebFree(deflated);
+    rebRelease(live);
+    rebRelease(needle);
+    rebRelease(haystack);
+    rebRelease(keys);
+    rebRelease(map);
+    rebRelease(loaded);
+    rebFree(source_utf8);
+}
+
+
+//=//// BENCHMARKED OPERATIONS ////////////////////////////////////////////=//
+
+static REBSIZ Bench_Scan(void)
+{
+    Scan_UTF8_Managed(ANONYMOUS, source_utf8, source_size);
+    return source_size;
+}
+
+static REBSIZ Bench_Mold(void)
+{
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+    Mold_Or_Form_Value(mo, loaded, false);
+    REBSIZ size = STR_SIZE(mo->series) - mo->offset;
+    Drop_Mold(mo);
+    return size;
+}
+
+static REBSIZ Bench_Map_Find(void)
+{
+    REBMAP *m = VAL_MAP_KNOWN_MUTABLE(map);
+    REBARR *pairlist = MAP_PAIRLIST(m);
+    REBSER *hashlist = MAP_HASHLIST(m);
+
+    const RELVAL *tail;
+    const RELVAL *key = VAL_ARRAY_AT(&tail, keys);
+    for (; key != tail; ++key) {
+        REBINT n = Find_Key_Hashed(
+            pairlist, hashlist, key, SPECIFIED, 2, false, 1
+        );
+        assert(n != -1);
+        UNUSED(n);
+    }
+    return 0;
+}
+
+static REBSIZ Bench_Find_Text(void)
+{
+    REBLEN len;
+    REBLEN n = Find_Binstr_In_Binstr(
+        &len,
+        haystack,
+        VAL_LEN_HEAD(haystack),
+        needle,
+        VAL_LEN_AT(needle),
+        0,  // caseless, as FIND is by default
+        1
+    );
+    assert(n != NOT_FOUND);
+    UNUSED(n);
+    return VAL_SIZE_LIMIT_AT(nullptr, haystack, UNLIMITED);
+}
+
+static REBSIZ Bench_Recycle(void)
+{
+    Recycle();
+    return 0;
+}
+
+static REBSIZ Bench_Expand(void)
+{
+    REBBIN *bin = Make_Binary(0);
+    REBLEN i;
+    for (i = 0; i < 4096; ++i)  // 256K in 64-byte appends
+        Expand_Series(bin, BIN_LEN(bin), 64);
+    TERM_BIN(bin);
+    Free_Unmanaged_Series(bin);
+    return 4096 * 64;
+}
+
+static REBSIZ Bench_Deflate(void)
+{
+    REBSIZ size;
+    rebFree(Compress_Alloc_Core(&size, plain, plain_size, SYM_NONE));
+    return plain_size;
+}
+
+static REBSIZ Bench_Inflate(void)
+{
+    REBSIZ size;
+    rebFree(Decompress_Alloc_Core(
+        &size, deflated, deflated_size, -1, SYM_NONE
+    ));
+    return deflated_size;
+}
+
+static const struct Reb_Bench benchmarks[] = {
+    {"scan", &Bench_Scan},
+    {"mold", &Bench_Mold},
+    {"map-find-1024", &Bench_Map_Find},
+    {"find-text", &Bench_Find_Text},
+    {"recycle", &Bench_Recycle},
+    {"expand-series", &Bench_Expand},
+    {"deflate", &Bench_Deflate},
+    {"inflate", &Bench_Inflate},
+    {nullptr, nullptr}
+};
+
+
+//=//// TIMING ////////////////////////////////////////////////////////////=//
+
+static void Run_Bench(const struct Reb_Bench *b)
+{
+    REBSIZ size = (*b->op)();  // warm up caches and pools
+    if (GET_SIGNAL(SIG_RECYCLE)) {
+        CLR_SIGNAL(SIG_RECYCLE);
+        Recycle();
+    }
+
+    REBI64 ops = 1;
+    REBI64 elapsed;
+    REBI64 allocated;
+    while (true) {
+        REBI64 bytes_before = GC_Bytes_Allocated;
+        REBI64 start = Startup_Clock_Nanoseconds();
+
+        REBI64 i;
+        for (i = 0; i < ops; ++i) {
+            (*b->op)();
+            if (GET_SIGNAL(SIG_RECYCLE)) {  // what the evaluator would do
+                CLR_SIGNAL(SIG_RECYCLE);
+                Recycle();
+            }
+        }
+
+        elapsed = Startup_Clock_Nanoseconds() - start;
+        allocated = GC_Bytes_Allocated - bytes_before;
+        if (elapsed >= BENCH_MIN_NANOSECONDS)
+            break;
+        ops *= 2;
+    }
+
+    double ns_per_op = cast(double, elapsed) / ops;
+    printf(
+        "%-16s %10ld %14.1f %12ld",
+        b->name,
+        cast(long, ops),
+        ns_per_op,
+        cast(long, allocated / ops)
+    );
+    if (size != 0)
+        printf(" %10.1f", size / ns_per_op * 1000);  // bytes/ns => MB/s
+    printf("\n");
+    fflush(stdout);
+}
+
+
+//=//// MAIN ENTRY POINT //////////////////////////////////////////////////=//
+
+int main(int argc, char *argv[])
+{
+    rebStartup();
+
+    Make_Inputs();
+
+    printf(
+        "%-16s %10s %14s %12s %10s\n",
+        "benchmark", "ops", "ns/op", "B/op", "MB/s"
+    );
+
+    const struct Reb_Bench *b;
+    for (b = benchmarks; b->name; ++b) {
+        bool wanted = (argc <= 1);
+        int i;
+        for (i = 1; i < argc; ++i)
+            if (strstr(b->name, argv[i]))
+                wanted = true;
+
+        if (wanted)
+            Run_Bench(b);
+    }
+
+    Free_Inputs();
+
+    rebShutdown(true);
+    return 0;
+}
@@ -41,6 +41,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <time.h>  // timespec_get() or clock(), for --startup-profile
 
 #ifdef TO_WINDOWS
     #undef _WIN32_WINNT  // https://forum.rebol.info/t/326/4
@@ -174,6 +175,41 @@
 #endif
 
 
+//=//// STARTUP PROFILE ///////////////////////////////////////////////////=//
+//
+// `--startup-profile` prints how long each stage of startup took, as a
+// baseline for judging changes meant to make startup faster.  The stages of
+// rebStartup() come from STATS/STARTUP, but what MAIN-STARTUP takes has to
+// be measured here.  The option is taken out of the arguments, so that it
+// works no matter what MAIN-STARTUP would make of it.
+//
+
+static int64_t Clock_Nanoseconds(void)  // same as Startup_Clock_Nanoseconds()
+{
+  #if defined(TIME_UTC)
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return cast(int64_t, ts.tv_sec) * 1000000000 + ts.tv_nsec;
+  #else
+    return cast(int64_t, clock()) * (1000000000 / CLOCKS_PER_SEC);
+  #endif
+}
+
+static void Print_Startup_Profile(int64_t startup, int64_t main_startup)
+{
+    rebElide(
+        "print {Startup profile:}",
+        "for-each [stage time] stats/startup [",
+            "print [{   } stage time]",
+        "]",
+        "print [{    main-startup}",
+            "to time!", rebI(main_startup), "/ 1000000000]",
+        "print [{    total}",
+            "to time!", rebI(startup + main_startup), "/ 1000000000]"
+    );
+}
+
+
 //=//// MAIN ENTRY POINT //////////////////////////////////////////////////=//
 //
 // Using a main() entry point for a console program (as opposed to WinMain())
@@ -185,8 +221,13 @@ int main(int argc, char *argv_ansi[])
     // the console extension (%extensions/console).  Halting should not be
     // possible while the mezzanine is loading.
 
+    int64_t startup_begin = Clock_Nanoseconds();
+
     rebStartup();
 
+    int64_t startup_end = Clock_Nanoseconds();
+    bool startup_profile = false;
+
     // With interpreter startup done, we want to turn the platform-dependent
     // argument strings into a block of Rebol strings as soon as possible.
     // That way the command line argument processing can be taken care of by
@@ -210,6 +251,11 @@ int main(int argc, char *argv_ansi[])
         if (argv_ucs2[i] == nullptr)
             continue;  // !!! R3-Alpha commented here saying "shell bug" (?)
 
+        if (i != 0 and wcscmp(argv_ucs2[i], L"--startup-profile") == 0) {
+            startup_profile = true;
+            continue;
+        }
+
         // Note: rebTextWide() currently only supports UCS-2, so codepoints
         // needing more than two bytes to be represented will cause a failure.
         //
@@ -225,6 +271,11 @@ int main(int argc, char *argv_ansi[])
         if (argv_ansi[i] == nullptr)
             continue;  // !!! R3-Alpha commented here saying "shell bug" (?)
 
+        if (i != 0 and strcmp(argv_ansi[i], "--startup-profile") == 0) {
+            startup_profile = true;
+            continue;
+        }
+
         rebElide("append", argv_block, rebT(argv_ansi[i]));
     }
   #endif
@@ -285,6 +336,12 @@ int main(int argc, char *argv_ansi[])
     REBVAL *code = rebValue("first", trapped); // entrap's output
     rebRelease(trapped);  // don't need the outer block any more
 
+    if (startup_profile)
+        Print_Startup_Profile(
+            startup_end - startup_begin,
+            Clock_Nanoseconds() - startup_end
+        );
+
     // !!! For the moment, the CONSOLE extension does all the work of running
     // usermode code or interpreting exit codes.  This requires significant
     // logic which is reused by the debugger, which ranges from the managing
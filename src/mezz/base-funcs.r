@@ -680,19 +680,6 @@ find-last: redescribe [
     ]
 )
 
-attempt: func [
-    {Tries to evaluate a block and returns result or NULL on error.}
-
-    return: "NULL on error"
-        [<opt> any-value!]
-    code [block! action!]
-][
-    trap [
-        return/isotope (do code else [null])  ; want NULL-2 if was NULL
-    ]
-    return null
-]
-
 for-next: redescribe [
     "Evaluates a block for each position until the end, using NEXT to skip"
 ](
@@ -1187,3 +1174,54 @@ input-lines: redescribe [
 ](
     specialize :read-lines [src: _]
 )
+
+read-values: func [
+    {Makes a generator that yields top-level values scanned from a port}
+    src [port! file!]
+    /part "Bytes to read from the port at a time (default 65536)"
+        [integer!]
+][
+    if file? src [src: open src]
+
+    ; Only the bytes that have not been scanned yet are kept in the buffer,
+    ; so memory use is bounded by the chunk size plus the largest top-level
+    ; value...not the size of the source.  A value ending at the tail of the
+    ; buffer (or an error, e.g. from an unclosed block) may just mean that
+    ; the rest of it hasn't been read yet, so those cases read and rescan.
+    ;
+    return function compose [
+        <static> buffer (to group! [make binary! 4096])
+        <static> port (groupify src)
+        <static> size (any [part 65536])
+        <static> line (1)
+        <static> eof (false)
+    ][
+        let value
+        let rest
+        cycle [
+            ln: line  ; only advanced when a scan is kept
+            let error: trap [
+                [value rest]: transcode/next/line buffer 'ln
+            ]
+            if eof [
+                if error [fail error]
+                break
+            ]
+            all [not error  not tail? rest] then [break]
+
+            let data: read/part port size
+            if empty? data [
+                eof: true
+                continue
+            ]
+            if not head? buffer [  ; drop what was already scanned
+                buffer: remove/part head of buffer buffer
+            ]
+            append buffer data
+        ]
+        if null? :value [return null]
+        line: ln
+        buffer: rest
+        return :value
+    ]
+]
@@ -40,7 +40,7 @@ REBOL [
     %mezz-files.r
     %mezz-shell.r
     %mezz-math.r
-    %mezz-help.r  ; depends on DUMP-OBJ in %mezz-dump.r
+    %mezz-help.r <lazy>  ; depends on DUMP-OBJ in %mezz-dump.r
     %mezz-colors.r
     %mezz-legacy.r
 
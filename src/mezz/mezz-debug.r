@@ -86,9 +86,9 @@ delta-profile: func [
     block [block!]
     <local> start end
 ][
-    start: values of stats/profile
+    start: values of stats/counters
     do block
-    end: values of stats/profile
+    end: values of stats/counters
     for-each num start [
         change end end/1 - num
         end: next end
@@ -438,6 +438,159 @@ to-relative-file: function [
 ]
 
 
+; PARSE needs all of its input in memory, which rules out matching a huge
+; file or a protocol stream directly.  But such input is usually a series of
+; records, and PARSE-STREAM matches one record at a time in a buffer that is
+; refilled from the port.  A record's data is released once it has matched,
+; since nothing can backtrack into it, so memory stays bounded by the record
+; size plus the read size however big the input is.
+;
+; A match that reaches the tail of the buffer can't be trusted (it might go
+; further, or be a different alternate, with more data), nor can a mismatch
+; before the end of the stream.  Both cases read more and try again.  So the
+; RULE should match just one record and not look at what is after it.  Since
+; a record may be matched more than once, the RULE should not have side
+; effects: each record is passed to the ACTION once it's been accepted.
+;
+parse-stream: func [
+    {Match RULE over and over against the data READ from an open PORT}
+
+    return: "Number of records matched, or NULL if data didn't match"
+        [<opt> integer!]
+    port [port!]
+    rule "Rule that matches a single record"
+        [block!]
+    action "Called with a copy of each matched record, as a BINARY!"
+        [action!]
+    /part "How many bytes to READ at a time (default 64K)"
+        [integer!]
+    /limit "Fail if a single record needs more than this many bytes"
+        [integer!]
+    /case "Do case-sensitive matching"
+][
+    part: default [65536]
+    let buffer: make binary! part
+    let count: 0
+    let done: false  ; the port has no more data
+
+    cycle [
+        let pos: parse*/(if case [/case]) buffer [rule here]
+        all [
+            pos
+            not same? pos buffer  ; an empty match is not a record
+            any [done, not tail? pos]
+        ] then [
+            let record: copy/part buffer pos
+            remove/part buffer pos
+            count: count + 1
+            action record
+            continue
+        ]
+
+        if done [
+            return if empty? buffer [count] else [null]
+        ]
+
+        if all [limit, (length of buffer) > limit] [
+            fail ["PARSE-STREAM record not matched within" limit "bytes"]
+        ]
+
+        let data: read/part port part
+        either any [not data, empty? data] [
+            done: true
+        ][
+            append buffer data
+        ]
+    ]
+]
+
+
+; DECODE-CSV needs its input in memory, but with the REST output it can be
+; given a file a chunk at a time: each call decodes the records that are
+; complete, and the unfinished one at the end waits for the next chunk.  So
+; nothing but the rows (or columns) being built up is kept around.
+;
+read-csv: func [
+    {Read a CSV (or TSV...) file or port a chunk at a time, see DECODE-CSV}
+
+    return: "Rows as blocks of fields, or a block of columns if /COLUMNS"
+        [block!]
+    source [file! url! port!]
+    /delimiter "Field separator (default is comma, use tab for TSV)"
+        [char!]
+    /infer "Make INTEGER!, DECIMAL! of numeric fields, BLANK! of empty"
+    /columns "Give back a block of columns (shorter rows get BLANK!s)"
+    /vectors "With /COLUMNS, make columns of only numbers into VECTOR!s"
+    /part "How many bytes to READ at a time (default 1M)"
+        [integer!]
+][
+    if vectors and (not columns) [
+        fail "READ-CSV/VECTORS only applies with /COLUMNS"
+    ]
+    part: default [1048576]
+    delimiter: default [#","]
+
+    let decoder: :decode-csv/delimiter
+    if infer [decoder: :decoder/infer]
+    if columns [decoder: :decoder/columns]
+
+    let port: either port? source [source] [open source]
+    let result: copy []
+    let buffer: make binary! part
+    let rest
+
+    cycle [
+        let data: read/part port part
+        let done: any [not data, empty? data]
+        if not done [append buffer data]
+
+        let decoded: if done [
+            decoder buffer delimiter
+        ] else [
+            [# rest]: decoder buffer delimiter
+        ]
+        if done [rest: tail buffer]
+
+        ; A chunk may not finish any record, if a record is longer than it
+        ;
+        if not empty? decoded [
+            either all [columns, not empty? result] [
+                if (length of decoded) <> length of result [
+                    fail "READ-CSV found rows with differing number of fields"
+                ]
+                for-each column result [append column take decoded]
+            ][
+                append result decoded
+            ]
+        ]
+
+        remove/part buffer rest  ; keep the unfinished record
+        if done [break]
+    ]
+
+    if not port? source [close port]
+
+    if vectors [
+        for-next pos result [
+            let column: first pos
+            case [
+                every item column [integer? item] [
+                    change/only pos make vector! compose/only [
+                        integer! 64 (column)
+                    ]
+                ]
+                every item column [any [integer? item, decimal? item]] [
+                    change/only pos make vector! compose/only [
+                        decimal! 64 (column)
+                    ]
+                ]
+            ]
+        ]
+    ]
+    return result
+]
+
+
 ; !!! Probably should not be in the "core" mezzanine.  But to make it easier
 ; for people who seem to be unable to let go of the tabbing/CR past, this
 ; helps them turn their files into sane ones :-/
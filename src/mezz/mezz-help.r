@@ -522,8 +522,9 @@ pending: does [
 ]
 
 
-bugs: func [return: <none>] [
+bugs: func [
     "View bug database."
+    return: <none>
 ][
     browse https://github.com/metaeducation/ren-c/issues
 ]
@@ -116,6 +116,28 @@ save: function [
         header: body-of header
     ]
 
+    ; If the header doesn't need to know about the whole of the data (for a
+    ; checksum or length, or to compress it) then a file can be written in
+    ; pieces as the value is molded.  That way, saving a very big block does
+    ; not need its molded text in memory all at once.
+    ;
+    all [
+        file? where
+        not compress
+        not length
+        not find try header [checksum:]
+    ] then [
+        let port: open/new where
+        if header [
+            write port unspaced [{REBOL} _ (mold header) newline]
+        ]
+        either all_SAVE [mold/all/only/sink :value port] [
+            mold/only/sink :value port
+        ]
+        write port "^/"  ; MOLD does not append a newline
+        return close port
+    ]
+
     ; !!! Maybe /all should be the default?  See #2159
     data: either all_SAVE [mold/all/only :value] [
         mold/only :value
@@ -174,6 +174,29 @@ replace: function [
         any-array? :pattern [length of :pattern]
     ]
 
+    ; Text and binary replacements that aren't made per-match by a function
+    ; are done in one pass, without moving the rest of the target each time.
+    ;
+    if all [
+        any [any-string? target, binary? target]
+        any [any-string? :pattern, binary? :pattern]
+        not empty? pattern
+        any [
+            text? :replacement
+            char? :replacement
+            all [binary? target, binary? :replacement]
+        ]
+    ][
+        return applique :replace* [
+            target: target
+            pattern: pattern
+            replacement: :replacement
+            all: all_REPLACE
+            case: case_REPLACE
+            tail: tail_REPLACE
+        ]
+    ]
+
     loop [pos: find/(if case_REPLACE [/case]) target :pattern] [
         either action? :replacement [
             ;
@@ -611,6 +634,13 @@ split: function [
     if all [any-string? series tag? dlm] [dlm: form dlm]
     ; reserve other strings for future meanings
 
+    if all [
+        any-string? series
+        any [bitset? dlm, char? dlm, all [text? dlm, not empty? dlm]]
+    ][
+        return split* series dlm
+    ]
+
     result: collect [parse series case [
         integer? dlm [
             size: dlm  ; alias for readability in integer case
@@ -209,3 +209,68 @@ export: func [
         append lib reduce [word get word]
     ]
 ]
+
+
+lazy-definitions: func [
+    {Put stand-ins in lib for functions whose definitions run on first use}
+
+    return: <none>
+    code "Only top-level `name: func [spec] [body]` (or FUNCTION, DOES)"
+        [block!]
+][
+    ; Deferring the definitions saves more than it might seem, since FUNC and
+    ; FUNCTION are usermode wrappers that process the spec (and FUNCTION
+    ; walks the body to gather locals).  Startup just makes a small stand-in
+    ; for each function instead, taking the same arguments.  The first call to
+    ; any of them makes an object from the code, and all the stand-ins pass
+    ; their arguments on to the real functions in it from then on.
+    ;
+    ; Lib keeps the stand-ins (rather than having the real functions put in
+    ; their place), so anything that has a HIJACK on one of them still works.
+    ;
+    let state: make object! [code: _  defs: _]
+    state/code: code
+
+    let name
+    let spec
+    (parse code [while [
+        set name set-word! [
+            ['func | 'function] set spec block! block!
+            | 'does (spec: copy []) block!
+        ] (
+            let word: to word! name
+            append lib reduce [word  make-stand-in state word spec]
+        )
+    ] end]) else [
+        fail ["LAZY-DEFINITIONS can only defer FUNC, FUNCTION, DOES:" name]
+    ]
+]
+
+make-stand-in: func [
+    {Make an action with the interface of a LAZY-DEFINITIONS function}
+
+    return: [action!]
+    state "Deferred CODE, and DEFS object once it has been run"
+        [object!]
+    word "Name of the function in DEFS"
+        [word!]
+    spec "Spec of the real function"
+        [block!]
+][
+    let interface: copy []
+    let item
+    parse spec [while [
+        'return: opt [block! | tag!] opt text!  ; real function checks result
+        | [<local> | <static> | <in> | <with>] to end
+        | set item skip (append interface ^item)
+    ] end]
+
+    return func interface compose [
+        let state: (state)
+        if not state/defs [state/defs: make object! state/code]
+        let f: make frame! get in state/defs (^word)
+        let here: binding of 'return
+        for-each key words of f [f/(key): get/any in here key]
+        do f
+    ]
+]
@@ -76,14 +76,38 @@ append system/options/file-types switch fourth system/version [
 ]
 
 
+; Compact binary format for exchanging data, see %l-rebin.c
+;
+register-codec* 'rebin %.rebin
+    func [data [binary!]] [#{52424E} = copy/part data 3]  ; "RBN"
+    :decode-rebin
+    :encode-rebin
+
+
+; JSON, see %l-json.c.  There's no telling JSON from other text by looking.
+;
+register-codec* 'json %.json
+    _
+    :decode-json
+    func [value [<opt> any-value!]] [as binary! encode-json :value]
+
+
 decode: function [
     {Decodes a series of bytes into the related datatype (e.g. image!).}
 
     type [word!]
         {Media type (jpeg, png, etc.)}
-    data [binary!]
-        {The data to decode}
+    data "The data to decode, or a PORT! to read it from"
+        [binary! port!]
 ][
+    ; !!! The image codecs read a PORT! a chunk at a time, but others only
+    ; take a BINARY! and are given all of it.  There's no way to ask a codec
+    ; what it takes yet, so they are just listed here.
+    ;
+    if all [port? data, not find [bmp gif jpeg png] type] [
+        data: read data
+    ]
+
     all [
         cod: select system/codecs type
         f: :cod/decode
@@ -102,12 +126,13 @@ encode: function [
     type "Media type (jpeg, png, etc.)"
         [word!]
     data [any-value!]
-    /options "Encoding options"
-        [block!]  ; !!! Not currently used
+    /options "Refinements of the codec's encoder, e.g. [level: 9]"
+        [block!]
 ][
     all [
         cod: select system/codecs type
         f: :cod/encode
+        (if options [f: specialize :f options] else [:f])
         (data: f data)
     ] else [
         cause-error 'access 'no-codec type
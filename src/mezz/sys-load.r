@@ -243,6 +243,46 @@ load-header: function [
 ]
 
 
+transcode-cached: func [
+    {TRANSCODE, reusing a saved scan of a file if there is a valid one}
+
+    return: [block!]
+    data "Source body (after any header)"
+        [binary! text!]
+    file [<opt> file! url!]
+    line "Line number the body starts at"
+        [<opt> integer!]
+][
+    ; Caches are kept in system/options/scan-cache, under a name made from
+    ; the file's full path and the interpreter build (the cache format uses
+    ; internal type numbering, which can change between builds).  DECODE-
+    ; SCANNED checks the cache was made from the same bytes, so a stale or
+    ; damaged cache is simply rescanned and overwritten.
+    ;
+    let dir: match file! system/options/scan-cache
+    if not all [dir  file? file] [
+        return transcode/file/line data file line
+    ]
+
+    let cache: join dir unspaced [
+        enbase/base (checksum-core 'crc32 mold reduce [
+            clean-path file  system/version  system/build
+        ]) 16
+        ".scan"
+    ]
+
+    let block: all [
+        exists? cache
+        attempt [decode-scanned/file/line read cache data file line]
+    ]
+    if block [return block]
+
+    block: transcode/file/line data file line
+    attempt [write cache encode-scanned/line block data line]  ; best effort
+    return block
+]
+
+
 load: function [
     {Loads code or data from a file, URL, text string, or binary.}
 
@@ -255,6 +295,7 @@ load: function [
         [file! url! text! binary!]
     /type "E.g. rebol, text, markup, jpeg... (by default, auto-detected)"
         [word!]
+    /untracked "Don't record file and line in arrays (faster, for data)"
 ][
     ; Note that code or data can be embedded in other datatypes, including
     ; not just text, but any binary data, including images, etc. The type
@@ -342,7 +383,11 @@ load: function [
 
     if not block? data [
         assert [match [binary! text!] data]  ; UTF-8
-        data: transcode/file/line data file 'line
+        data: either untracked [
+            transcode/untracked data
+        ][
+            transcode-cached data file line
+        ]
     ]
 
     ; Bind code to user context
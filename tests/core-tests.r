@@ -134,6 +134,9 @@
 %convert/enbin.test.reb
 %convert/encode.test.reb
 %convert/load.test.reb
+%convert/rebin.test.reb
+%convert/json.test.reb
+%convert/csv.test.reb
 %convert/mold.test.reb
 %convert/to.test.reb
 
@@ -147,6 +150,11 @@
 %file/open.test.reb
 %file/split-path.test.reb
 %file/file-typeq.test.reb
+%file/map-file.test.reb
+%file/async.test.reb
+%file/read-tree.test.reb
+%file/read-lines.test.reb
+%file/write-batch.test.reb
 
 %functions/adapt.test.reb
 %functions/augment.test.reb
@@ -161,6 +169,7 @@
 %functions/let.test.reb
 %functions/literal.test.reb
 %functions/macro.test.reb
+%functions/memoize.test.reb
 %functions/multi.test.reb
 %functions/native.test.reb
 %functions/oneshot.test.reb
@@ -217,6 +226,7 @@
 %parse/uparse-furthest.test.reb
 %parse/uparse-breaker.test.reb
 %parse/uparse-reword.test.reb
+%parse/parse-stream.test.reb
 
 %redbol/redbol-apply.test.reb
 
@@ -238,6 +248,7 @@
 %series/clear.test.reb
 %series/collect.test.reb
 %series/copy.test.reb
+%series/dedup.test.reb
 %series/delimit.test.reb
 %series/emptyq.test.reb
 %series/exclude.test.reb
@@ -280,6 +291,7 @@
 %system/system.test.reb
 %system/file.test.reb
 %system/gc.test.reb
+%system/profiler.test.reb
 
 
 ; !!! These tests require the named extensions to be built in.  Whether the
@@ -12,12 +12,17 @@ REBOL [
     }
     Purpose: {
         Lists of files used for creating makefiles.
+
+        A file can be given in a block with flags for it.  Some of these are
+        for the compiler (see GEN-OBJ in %make.r), and some are for tools:
+        <no-make-header> skips it in %make-headers.r, and <no-amalgamate>
+        keeps it out of %prep/core/rebol-core.c (see %make-amalgamation.r).
     }
 ]
 
 core: [
     ; (A)???
-    a-constants.c
+    [a-constants.c <no-amalgamate>]  ; only uses %rebol.h
     a-globals.c
     a-lib.c
 
@@ -36,6 +41,7 @@ core: [
     functionals/c-hijack.c
     functionals/c-lambda.c
     functionals/c-macro.c
+    functionals/c-memoize.c
     functionals/c-native.c
     functionals/c-oneshot.c
     functionals/c-reframer.c
@@ -84,12 +90,13 @@ core: [
     d-dump.c
     d-eval.c
     d-gc.c
+    d-heap.c
     d-print.c
     d-stack.c
     d-stats.c
     d-test.c
     d-trace.c
-    d-winstack.c
+    [d-winstack.c <no-amalgamate>]  ; includes <windows.h> before anything
 
     ; (F)???
     f-blocks.c
@@ -107,7 +114,8 @@ core: [
     f-device.c
     [
         f-dtoa.c
-        
+
+        <no-amalgamate>  ; third-party, with many #defines of common names
         ; f-dtoa.c comes from a third party and is an old file.  There is an
         ; updated package, but it is not a single-file...rather something with
         ; a complex build process.  If it were to be updated, it would need
@@ -138,13 +146,18 @@ core: [
     f-int.c
     f-math.c
     f-modify.c
-    f-qsort.c
+    [f-qsort.c <no-amalgamate>]  ; third-party
     f-random.c
     f-round.c
     f-series.c
+    f-sort.c
     f-stubs.c
 
     ; (L)exer
+    l-cache.c
+    l-csv.c
+    l-json.c
+    l-rebin.c
     l-scan.c
     l-types.c
 
@@ -152,6 +165,7 @@ core: [
     m-gc.c
     [m-pools.c <no-uninitialized>]
     m-series.c
+    m-shared.c
     m-stacks.c
 
     ; (N)atives
@@ -175,6 +189,8 @@ core: [
     s-make.c
     s-mold.c
     s-ops.c
+    s-pool.c
+    s-utf8.c
 
     ; (T)ypes
     t-binary.c
@@ -206,10 +222,12 @@ core: [
     ; (U)??? (3rd-party code extractions)
     u-compress.c
     u-parse.c
+    u-combinators.c
     [
         u-zlib.c
 
         <no-make-header>
+        <no-amalgamate>
         <implicit-fallthru>
         <no-constant-conditional>
 
@@ -237,6 +255,8 @@ made: [
 
 main: 'main.c
 
+bench: 'core-bench.c  ; in %src/main/, the `r3-bench` executable (target=bench)
+
 boot-files: [
     version.r
 ]
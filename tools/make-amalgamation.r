@@ -0,0 +1,224 @@
+REBOL [
+    System: "REBOL [R3] Language Interpreter and Run-time Environment"
+    Title: "Make rebol-core.c, the Core Sources as One Translation Unit"
+    File: %make-amalgamation.r
+    Rights: {
+        Copyright 2021 Ren-C Open Source Contributors
+        REBOL is a trademark of REBOL Technologies
+    }
+    License: {
+        Licensed under the Apache License, Version 2.0
+        See: http://www.apache.org/licenses/LICENSE-2.0
+    }
+    Needs: 2.100.100
+    Purpose: {
+        With `amalgamate: yes`, %make.r compiles the core from one file made
+        by pasting the %src/core/ files together (as SQLite is distributed).
+        Then the compiler can inline across what used to be separate files,
+        e.g. natives into the evaluator, or Try_Fill_Pool() into allocation,
+        without needing link-time optimization.  It's also just one file to
+        add to a project that embeds the interpreter.
+
+        Files marked <no-amalgamate> in %file-base.r (third-party code, and
+        files not built on %sys-core.h) are still compiled separately.
+
+        Pasting the files together means:
+
+        * Each #define that a file makes is #undef'd at the end of it, unless
+          a header defines it too (then it's assumed to be the same).
+
+        * A `#include "..."` seen in an earlier file is commented out, since
+          not all headers have include guards (e.g. %sys-money.h).
+
+        * Preprocessor settings made before `#include "sys-core.h"` are moved
+          to the top, so they apply before the one time it's included.
+
+        * Two files can't have `static` functions of the same name.  That is
+          checked for here, to give a better error than the compiler would.
+
+        `#line` directives are used so errors and debug info refer to the
+        original files.
+    }
+    Note: "This runs relative to ../tools directory."
+]
+
+do %common.r
+
+file-base: make object! load %file-base.r
+
+output-dir: make-file [(system/options/path) prep /]
+mkdir/deep make-file [(output-dir) core /]
+
+core-dir: %../src/core/
+
+identifier-char: charset [#"a" - #"z" #"A" - #"Z" #"0" - #"9" "_"]
+
+define-rule: [
+    while #" " "#" while #" " "define" some #" "
+    copy name some identifier-char
+    to end
+]
+
+include-rule: [
+    while #" " "#" while #" " "include" some #" "
+    {"} copy name to {"}
+    to end
+]
+
+directive-rule: [while #" " "#" to end]
+
+static-rule: [opt "inline " "static " to "(" to end]
+
+generated-note: {/* REBOL: see make-amalgamation.r */}
+
+
+=== {MACROS THE HEADERS DEFINE} ===
+
+header-macros: copy []
+for-each dir [
+    %../src/include/
+    %../src/include/datatypes/
+    %../src/include/structs/
+][
+    for-each file read dir [
+        if %.h <> suffix? file [continue]
+        for-each line read/lines join dir file [
+            if parse? line define-rule [
+                if not find header-macros name [append header-macros name]
+            ]
+        ]
+    ]
+]
+
+
+=== {PASTE FILES TOGETHER} ===
+
+prelude: copy []  ; preprocessor settings from before each `#include "sys-core.h"`
+body: copy []
+seen-includes: copy ["sys-core.h"]
+statics: copy []  ; [name file ...]
+
+for-each item file-base/core [
+    if all [block? item, find item <no-amalgamate>] [continue]
+    file: to file! either block? item [first item] [item]
+
+    lines: read/lines join core-dir file
+
+    ; Any directives before `#include "sys-core.h"` (and what's between them)
+    ; are hoisted, but the file's comment header before them stays put.
+    ;
+    core-at: _
+    first-directive: _
+    n: 0
+    for-each line lines [
+        n: n + 1
+        if parse? line include-rule [
+            if name = "sys-core.h" [core-at: n, break]
+        ]
+        if all [not first-directive, parse? line directive-rule] [
+            first-directive: n
+        ]
+    ]
+    if not core-at [
+        fail [
+            file {doesn't include "sys-core.h", so it has to be marked}
+            {<no-amalgamate> in %file-base.r}
+        ]
+    ]
+    first-directive: default [core-at]
+    if first-directive < core-at [
+        append prelude unspaced [
+            {#line } first-directive { "src/core/} file {"}
+        ]
+        n: first-directive
+        while [n < core-at] [
+            append prelude lines/(n)
+            poke lines n ""  ; keep the line numbering of the rest
+            n: n + 1
+        ]
+    ]
+
+    append body ""
+    append body unspaced [{#line 1 "src/core/} file {"}]
+
+    defined: copy []
+    for-each line lines [
+        case [
+            parse? line include-rule [
+                either find seen-includes name [
+                    line: unspaced [{// } line {  } generated-note]
+                ][
+                    append seen-includes name
+                ]
+            ]
+            parse? line define-rule [
+                if not any [find header-macros name, find defined name] [
+                    append defined name
+                ]
+            ]
+            parse? line static-rule [
+                ;
+                ; The name is the identifier just before the "(", as in
+                ; `static const REBVAL *Foo_Bar(` -- prototypes repeat it.
+                ;
+                name: copy/part line find line "("
+                if find name "=" [name: ""]  ; e.g. `static X x = f(...)`
+                trim/tail name
+                pos: tail name
+                while [all [
+                    not head? pos
+                    find identifier-char first back pos
+                ]][
+                    pos: back pos
+                ]
+                name: copy pos
+
+                other: select statics name
+                if all [other, other <> file] [
+                    fail [
+                        "Static" name "is in both" other "and" file
+                        "-- rename one, so they can be amalgamated"
+                    ]
+                ]
+                if all [not other, not empty? name] [
+                    append statics reduce [name file]
+                ]
+            ]
+        ]
+        append body line
+    ]
+
+    for-each name defined [
+        append body unspaced [{#undef } name {  } generated-note]
+    ]
+]
+
+
+=== {WRITE THE FILE} ===
+
+lines: reduce [
+    {/*}
+    { * Rebol interpreter core, as one file}
+    { *}
+    { * AUTO-GENERATED FILE - Do not modify. (From: make-amalgamation.r)}
+    { *}
+    { * Copyright 2012 REBOL Technologies}
+    { * Copyright 2012-2021 Ren-C Open Source Contributors}
+    { * REBOL is a trademark of REBOL Technologies}
+    { * Licensed under the Lesser GPL, Version 3.0}
+    { */}
+    {}
+]
+append lines prelude
+append lines [
+    {}
+    {#include "sys-core.h"}
+]
+append lines body
+
+write/lines make-file [(output-dir) core/rebol-core.c] lines
+
+print [
+    "Amalgamated" length of statics "static functions in"
+    length of body "lines into %prep/core/rebol-core.c"
+]
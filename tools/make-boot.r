@@ -444,10 +444,14 @@ hookname: enfixed func [
 ]
 
 n: 0
+generic-list: copy []
 hook-list: collect [
     for-each-record t type-table [
         name: either issue? t/name [as text! t/name] [unspaced [t/name "!"]]
 
+        append generic-list cscape/with
+            {${"T_" Hookname T 'Class}  /* $<NAME> = $<n> */} [t]
+
         keep cscape/with {
             {  /* $<NAME> = $<n> */
                 cast(CFUNC*, ${"T_" Hookname T 'Class}),  /* generic */
@@ -470,6 +474,11 @@ e-hooks/emit {
     CFUNC* Builtin_Type_Hooks[REB_MAX][IDX_HOOKS_MAX] = {
         $(Hook-List),
     };
+
+    /* Generic hooks of the rows above, see Generic_Hook_For_Type_Of() */
+    GENERIC_HOOK *Builtin_Generic_Hooks[REB_MAX] = {
+        $(Generic-List),
+    };
 }
 
 e-hooks/write-emitted
@@ -730,10 +739,29 @@ sys-toplevel: copy []
 for-each section [boot-base boot-sys boot-mezz] [
     set section s: make text! 20000
     append/line s "["
-    for-each file first mezz-files [  ; doesn't use LOAD to strip
+    files: first mezz-files
+    while [not tail? files] [
+        file: first files
+        files: next files
+
+        ; A file marked <lazy> only has its function definitions run when one
+        ; of them is first called (see LAZY-DEFINITIONS in %sys-base.r)
+        ;
+        lazy: false
+        if all [not tail? files  <lazy> = first files] [
+            lazy: true
+            files: next files
+        ]
+
         gather: try if section = 'boot-sys ['sys-toplevel]
-        text: stripload/gather join %../mezz/ file opt gather
-        append/line s text
+        text: stripload/gather join %../mezz/ file opt gather  ; doesn't LOAD
+        either lazy [
+            append/line s "sys/lazy-definitions ["
+            append/line s text
+            append/line s "]"
+        ][
+            append/line s text
+        ]
     ]
     append/line s "_"  ; !!! would <section-done> be better?
     append/line s "]"
@@ -823,6 +851,143 @@ e-bootblock/emit {
     };
 }
 
+=== BUILT-IN SYMBOL PERFECT HASH ===
+
+; The built-in symbols are made at startup directly from a static table of
+; their spellings (in SYMID order), instead of being interned as the words of
+; the boot block are scanned.  They also aren't put in the runtime hash table.
+; Intern_UTF8_Managed() finds them with one probe of a perfect hash that is
+; computed here, using the "hash and displace" method:
+;
+; http://cmph.sourceforge.net/papers/esa09.pdf
+;
+; The hash of a spelling picks a bucket, and each bucket has a displacement
+; chosen so that all the spellings in it land in slots that no other spelling
+; is in.  Buckets are filled biggest first, since those are hardest to place.
+;
+; HASH-SPELLING must agree with Hash_Builtin_Spelling() in %c-word.c, which
+; hashes the lowercase of each codepoint (all of %words.r is ASCII).  Note
+; that Rebol evaluates infix left to right, e.g. `d * h2 + h1` is (d * h2) + h1
+
+hash-spelling: function [spelling [text!]] [
+    hash: 0
+    for-each c lowercase copy spelling [
+        hash: remainder (hash * 31 + to integer! c) 4294967296  ; uint32_t wraps
+    ]
+    return hash
+]
+
+next-prime: function [n [integer!]] [
+    n: n - 1
+    until [
+        n: n + 1
+        d: 2
+        while [all [d * d <= n  0 <> remainder n d]] [d: d + 1]
+        d * d > n
+    ]
+    return n
+]
+
+num-builtins: length of boot-words
+num-slots: next-prime 2 * num-builtins
+num-buckets: (num-builtins - remainder num-builtins 4) / 4 + 1
+assert [num-slots < 65536]  ; slots and displacements are uint16_t
+
+hashes: collect [
+    for-each w boot-words [keep hash-spelling form w]
+]
+
+; Chain the symbols in each bucket with integer arrays, vs. blocks of blocks
+;
+bucket-sizes: array/initial num-buckets 0
+bucket-firsts: array/initial num-buckets 0
+sym-nexts: array/initial num-builtins 0
+repeat sym num-builtins [
+    b: 1 + remainder (pick hashes sym) num-buckets
+    poke bucket-sizes b 1 + pick bucket-sizes b
+    poke sym-nexts sym pick bucket-firsts b
+    poke bucket-firsts b sym
+]
+
+max-size: 0
+for-each size bucket-sizes [if size > max-size [max-size: size]]
+
+slots: array/initial num-slots 0
+displacements: array/initial num-buckets 0
+
+size: max-size
+while [size > 0] [
+    repeat b num-buckets [
+        if size = pick bucket-sizes b [
+            d: 0
+            until [
+                taken: copy []
+                sym: pick bucket-firsts b
+                while [sym <> 0] [
+                    h: pick hashes sym
+                    h1: remainder h num-slots
+                    h2: 1 + remainder ((h - h1) / num-slots) (num-slots - 1)
+                    slot: 1 + remainder (d * h2 + h1) num-slots
+                    if any [
+                        0 <> pick slots slot
+                        find taken slot
+                    ][
+                        taken: _
+                        break
+                    ]
+                    append taken slot
+                    sym: pick sym-nexts sym
+                ]
+                if not taken [
+                    d: d + 1
+                    if d = num-slots [
+                        fail [
+                            "Built-in symbols can't be perfectly hashed, try"
+                            "a new multiplier in HASH-SPELLING and C code"
+                        ]
+                    ]
+                ]
+                did taken
+            ]
+            sym: pick bucket-firsts b
+            for-each slot taken [
+                poke slots slot sym
+                sym: pick sym-nexts sym
+            ]
+            poke displacements b d
+        ]
+    ]
+    size: size - 1
+]
+
+spellings: collect [
+    for-each w boot-words [keep unspaced [{"} form w {"}]]
+]
+
+e-bootblock/emit {
+    /*
+     * Spellings of the built-in symbols, in SYMID order (see %tmp-symid.h)
+     */
+    const char * const Builtin_Symbol_Spellings[NUM_BUILTIN_SYMBOLS + 1] = {
+        nullptr,  /* SYM_0 */
+        $(Spellings),
+    };
+
+    /*
+     * Perfect hash of the built-in symbols, see Try_Find_Builtin_Symbol()
+     */
+    const uint16_t Builtin_Symbol_Displacements[NUM_BUILTIN_SYMBOL_BUCKETS] = {
+        $(Displacements),
+    };
+
+    const uint16_t Builtin_Symbol_Slots[NUM_BUILTIN_SYMBOL_SLOTS] = {
+        $(Slots),
+    };
+}
+
+print [num-builtins "built-in symbols hashed into" num-slots "slots"]
+
+
 ; Build typespecs block (in same order as datatypes table)
 
 boot-typespecs: collect [
@@ -850,7 +1015,12 @@ data: as binary! boot-molded
 
 compressed: gzip data
 
+; Both forms are emitted, the build picks one.  USE_UNCOMPRESSED_BOOT trades
+; executable size for not having to gunzip the boot block at every startup.
+; (It is NUL terminated, since the scanner relies on that.)
+;
 e-bootblock/emit {
+  #if !defined(USE_UNCOMPRESSED_BOOT)
     /*
      * Gzip compression of boot block
      * Originally $<length of data> bytes
@@ -862,6 +1032,15 @@ e-bootblock/emit {
     const REBYTE Native_Specs[$<length of compressed>] = {
         $<Binary-To-C Compressed>
     };
+  #else
+    /*
+     * Uncompressed boot block (plus NUL terminator, not counted in size)
+     */
+    const REBLEN Nat_Uncompressed_Size = $<length of data>;
+    const REBYTE Native_Specs[$<length of data> + 1] = {
+        $<Binary-To-C Join Data #{00}>
+    };
+  #endif
 }
 
 e-bootblock/write-emitted
@@ -896,6 +1075,7 @@ e-boot/emit {
      * Compressed data of the native specifications, uncompressed during boot.
      */
     EXTERN_C const REBLEN Nat_Compressed_Size;
+    EXTERN_C const REBLEN Nat_Uncompressed_Size;  // USE_UNCOMPRESSED_BOOT
     EXTERN_C const REBYTE Native_Specs[];
 
     /*
@@ -909,6 +1089,17 @@ e-boot/emit {
      */
     EXTERN_C REBACT *Natives[];  /* size is Num_Natives */
 
+    /*
+     * Built-in symbols and their perfect hash, see %c-word.c
+     */
+    #define NUM_BUILTIN_SYMBOLS $<num-builtins>
+    #define NUM_BUILTIN_SYMBOL_BUCKETS $<num-buckets>
+    #define NUM_BUILTIN_SYMBOL_SLOTS $<num-slots>
+
+    EXTERN_C const char * const Builtin_Symbol_Spellings[];
+    EXTERN_C const uint16_t Builtin_Symbol_Displacements[];
+    EXTERN_C const uint16_t Builtin_Symbol_Slots[];
+
     enum Native_Indices {
         $(Nids),
     };
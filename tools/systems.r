@@ -108,7 +108,7 @@ systems: [
         #SGD #LEN #LLC #F64 <M32> <UFS> /M32 %M %DL
 
     0.4.04 linux-x86/linux "libc6-2-11-x86"  ; glibc-2.11
-        #SGD #LEN #LLC #F64 #PIP2 <M32> <HID> /M32 /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN <M32> <HID> /M32 /HID /DYN %M %DL %PTH
 
     0.4.05 _ _
         ; was: "Linux 68K"
@@ -126,34 +126,34 @@ systems: [
         ; was: "Linux Cobalt Qube MIPS"
 
     0.4.10 linux-ppc/linux "libc6-ppc"
-        #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN <HID> /HID /DYN %M %DL %PTH
 
     0.4.11 linux-ppc64/linux "libc6-ppc64"
-        #SGD #BEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.20 linux-arm/linux "libc6-arm"
-        #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN <HID> /HID /DYN %M %DL %PTH
 
     0.4.21 linux-arm/linux _  ; for modern Android builds, see Android section
         #SGD #LEN #LLC #F64 #PIP2 <HID> <PIE> /HID /DYN %M %DL
 
     0.4.22 linux-aarch64/linux "libc6-aarch64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN #URG #SDT #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.30 linux-mips/linux "libc6-mips"
-        #SGD #LEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN <HID> /HID /DYN %M %DL %PTH
 
     0.4.31 linux-mips32be/linux "libc6-mips32be"
-        #SGD #BEN #LLC #F64 #PIP2 <HID> /HID /DYN %M %DL
+        #SGD #BEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN <HID> /HID /DYN %M %DL %PTH
 
     0.4.40 linux-x64/linux "libc-x64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN #URG #SDT #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.60 linux-axp/linux "dec-alpha"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN #LP64 <HID> /HID /DYN %M %DL %PTH
 
     0.4.61 linux-ia64/linux "libc-ia64"
-        #SGD #LEN #LLC #F64 #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #F64 #PIP2 #PMK #PSR #PRS #PJP #PPN #PDZ #PWK #ADN #LP64 <HID> /HID /DYN %M %DL %PTH
 
     BeOS: 5
     ;-------------------------------------------------------------------------
@@ -278,6 +278,9 @@ systems: [
     0.16.03 node/emscripten "nodejs"
         #SG? #LEN
 
+    0.16.04 jspi/emscripten "jspi"
+        #SG? #LEN
+
     AIX: 17
     ;-------------------------------------------------------------------------
     0.17.0 _ _
@@ -366,6 +369,17 @@ system-definitions: make object! [
     ; intended to be used with the standard compiler for that platform.
     ;
     PIP2: "USE_PIPE2_NOT_PIPE"    ; pipe2() linux only, glibc 2.9 or later
+    PMK: "USE_PARALLEL_MARKING"   ; RECYCLE/THREADS, needs %PTH (pthreads)
+    PSR: "USE_PARALLEL_SORT"      ; SORT/THREADS, needs %PTH (pthreads)
+    PRS: "USE_PARALLEL_RESAMPLE"  ; RESAMPLE/THREADS, needs %PTH (pthreads)
+    PJP: "USE_PARALLEL_JPEG"      ; DECODE-JPEG/THREADS, needs %PTH
+    PPN: "USE_PARALLEL_PNG"       ; ENCODE-PNG/THREADS, needs %PTH
+    PDZ: "USE_PARALLEL_DEFLATE"   ; DEFLATE/THREADS, needs %PTH (pthreads)
+    PWK: "USE_PARALLEL_WALK"      ; READ-TREE/THREADS, needs %PTH (pthreads)
+    ADN: "USE_ASYNC_DNS"          ; resolver threads for DNS, needs %PTH
+    URG: "USE_IO_URING"           ; async file I/O, <linux/io_uring.h> 5.1+
+    ISO: "USE_THREAD_ISOLATES"    ; one interpreter per thread, no PMK/PSR
+    SDT: "USE_SDT_PROBES"         ; USDT probes for perf, see %sys-probes.h
     NSER:                         ; strerror_r() in glibc 2.3.4, not 2.3.0
         "USE_STRERROR_NOT_STRERROR_R"
 ]
@@ -420,6 +434,7 @@ system-libraries: make object! [
     M: <gnu:m>
 
     DL: "dl" ; dynamic lib
+    PTH: "pthread" ; POSIX threads (parallel GC marking, interning lock)
     LOG: "log" ; Link with liblog.so on Android
 
     W32: ["wsock32" "comdlg32" "user32" "shell32" "advapi32"]